@@ -10,6 +10,8 @@ int main( int argc, char** argv )
 }
 #endif
 
+QA_DEMO( a1 )
+
 int a1( int argc, char** argv )
 {
  cv::VideoCapture cap(0);
@@ -7,6 +7,7 @@
 #include <conio.h>
 #include <fstream>
 #include <string.h>
+#include <algorithm>
 
 #define NOMINMAX
 
@@ -122,6 +123,153 @@ static vector<Point> simpleContour(vector<vector<Point> > _contoursQuery, int n
 	return cont;
 }
 
+// A library of reference shapes for repeated queries. Each reference is sampled and
+// described once when added; a query then goes through three stages and only the
+// last one runs the shape context distance:
+//   1. geometry: area ratio and aspect ratio of the minimum area rect (cheap, cached)
+//   2. Hu moments: sum of |log Hu| differences, as in CONTOURS_MATCH_I2
+//   3. rank: the maxSurvivors closest in Hu distance are compared with shape context,
+//      in parallel, one extractor per thread
+struct ShapeFilter
+{
+	double maxAreaRatio;	// larger / smaller area, <= 0 accepts any
+	double maxAspectDiff;	// difference of the short / long side ratios, <= 0 accepts any
+	double maxHuDistance;	// <= 0 accepts any
+	int maxSurvivors;
+	ShapeFilter() : maxAreaRatio(2.0), maxAspectDiff(0.25), maxHuDistance(1.0), maxSurvivors(3) {}
+};
+
+struct ShapeQueryStats
+{
+	int total;				// shapes in the library
+	int rejectedGeometry;
+	int rejectedHu;
+	int rejectedRank;		// passed both filters but beyond maxSurvivors
+	int compared;			// shape context distances computed
+	ShapeQueryStats() : total(0), rejectedGeometry(0), rejectedHu(0), rejectedRank(0), compared(0) {}
+};
+
+struct ShapeMatch
+{
+	int index;
+	double huDistance;
+	float distance;			// shape context distance
+	bool operator<(const ShapeMatch &m) const { return distance < m.distance; }
+};
+
+struct LibraryShape
+{
+	string name;
+	vector<Point> samples;	// simpleContour() of the contour
+	double hu[7];			// sign(h) * log10(|h|), 0 when h == 0
+	double area;
+	double aspect;
+};
+
+static void describeShape(const vector<Point> &contour, int nbSamples, LibraryShape &shape)
+{
+	vector<vector<Point> > borders(1, contour);
+	shape.samples = simpleContour(borders, nbSamples);
+
+	double h[7];
+	HuMoments(moments(contour, false), h);
+	for (int k = 0; k < 7; k++)
+		shape.hu[k] = fabs(h[k]) > 1e-300 ? (h[k] > 0 ? 1 : -1) * log10(fabs(h[k])) : 0;
+
+	shape.area = fabs(contourArea(contour));
+	RotatedRect box = minAreaRect(contour);
+	float longSide = std::max(box.size.width, box.size.height);
+	shape.aspect = longSide > 0 ? std::min(box.size.width, box.size.height) / longSide : 0;
+}
+
+class ShapeContextBody : public ParallelLoopBody
+{
+public:
+	ShapeContextBody(const vector<LibraryShape> &_shapes, const vector<Point> &_query, vector<ShapeMatch> &_matches)
+		: shapes(_shapes), query(_query), matches(_matches) {}
+
+	void operator()(const Range &range) const
+	{
+		// the extractor keeps state between calls, so it is not shared between threads
+		Ptr<ShapeContextDistanceExtractor> sc = createShapeContextDistanceExtractor();
+		for (int i = range.start; i < range.end; i++)
+			matches[i].distance = sc->computeDistance(query, shapes[matches[i].index].samples);
+	}
+
+private:
+	const vector<LibraryShape> &shapes;
+	const vector<Point> &query;
+	vector<ShapeMatch> &matches;
+};
+
+class ShapeLibrary
+{
+public:
+	explicit ShapeLibrary(int _nbSamples = 300) : nbSamples(_nbSamples) {}
+
+	int add(const string &name, const vector<Point> &contour)
+	{
+		shapes.push_back(LibraryShape());
+		shapes.back().name = name;
+		describeShape(contour, nbSamples, shapes.back());
+		return (int)shapes.size() - 1;
+	}
+
+	int size() const { return (int)shapes.size(); }
+	const string &name(int i) const { return shapes[i].name; }
+
+	// matches sorted by shape context distance, best first
+	void query(const vector<Point> &contour, const ShapeFilter &filter, vector<ShapeMatch> &matches,
+			   ShapeQueryStats &stats) const
+	{
+		LibraryShape q;
+		describeShape(contour, nbSamples, q);
+
+		stats = ShapeQueryStats();
+		stats.total = size();
+		matches.clear();
+		for (int i = 0; i < size(); i++)
+		{
+			const LibraryShape &s = shapes[i];
+			double areaRatio = std::max(q.area, s.area) / std::max(std::min(q.area, s.area), 1e-9);
+			if ((filter.maxAreaRatio > 0 && areaRatio > filter.maxAreaRatio) ||
+				(filter.maxAspectDiff > 0 && fabs(q.aspect - s.aspect) > filter.maxAspectDiff))
+			{
+				stats.rejectedGeometry++;
+				continue;
+			}
+			ShapeMatch m;
+			m.index = i;
+			m.huDistance = 0;
+			m.distance = FLT_MAX;
+			for (int k = 0; k < 7; k++)
+				m.huDistance += fabs(q.hu[k] - s.hu[k]);
+			if (filter.maxHuDistance > 0 && m.huDistance > filter.maxHuDistance)
+			{
+				stats.rejectedHu++;
+				continue;
+			}
+			matches.push_back(m);
+		}
+
+		if ((int)matches.size() > filter.maxSurvivors)
+		{
+			std::partial_sort(matches.begin(), matches.begin() + filter.maxSurvivors, matches.end(), lessHu);
+			stats.rejectedRank = (int)matches.size() - filter.maxSurvivors;
+			matches.resize(filter.maxSurvivors);
+		}
+		stats.compared = (int)matches.size();
+		parallel_for_(Range(0, (int)matches.size()), ShapeContextBody(shapes, q.samples, matches));
+		std::sort(matches.begin(), matches.end());
+	}
+
+private:
+	static bool lessHu(const ShapeMatch &a, const ShapeMatch &b) { return a.huDistance < b.huDistance; }
+
+	int nbSamples;
+	vector<LibraryShape> shapes;
+};
+
 int main()
 {
 	string sFileName = "e:\\git\\opencv\\samples\\data\\shape_sample\\6.png";
@@ -194,7 +342,29 @@ int main()
 		waitKey(0);
 	}
 
-	cout << format("Angle: %f , Score: %f", bestMatch, bestDis);
+	cout << format("Angle: %f , Score: %f", bestMatch, bestDis) << endl;
+
+	// library mode: every blob and rotated copies of the first one are described once,
+	// then the first blob is looked up without comparing it to every shape
+	ShapeLibrary library;
+	for (size_t i = 0; i < contours_Trans.size(); i++)
+		library.add(format("blob %d", (int)i), contours_Trans[i]);
+	for (double a = 45; a < 360; a += 45)
+	{
+		RotateContour(contours_Trans, contours_Rotated, a, ptCCentre);
+		library.add(format("blob 0 rotated %.0f", a), contours_Rotated[0]);
+	}
+
+	vector<ShapeMatch> matches;
+	ShapeQueryStats stats;
+	TickMeter tm;
+	tm.start();
+	library.query(contours_Trans[0], ShapeFilter(), matches, stats);
+	tm.stop();
+	cout << format("Library of %d shapes: %d rejected on geometry, %d on Hu moments, %d on rank, %d compared in %.1f ms",
+				   stats.total, stats.rejectedGeometry, stats.rejectedHu, stats.rejectedRank, stats.compared, tm.getTimeMilli()) << endl;
+	for (size_t i = 0; i < matches.size(); i++)
+		cout << format("  %s: Hu %f, Score: %f", library.name(matches[i].index).c_str(), matches[i].huDistance, matches[i].distance) << endl;
 
 	waitKey();
 
@@ -1,84 +1,80 @@
 #include <iostream>
 #include <opencv2/imgproc.hpp>
 #include <opencv2/highgui.hpp>
+#include "perf_stages.hpp"
+#include "point_distances.hpp"
 
-class TickMeter
-{
-public:
-    TickMeter();
-    void start();
-    void stop();
-
-    int64 getTimeTicks() const;
-    double getTimeMicro() const;
-    double getTimeMilli() const;
-    double getTimeSec()   const;
-    int64 getCounter() const;
-
-    void reset();
-private:
-    int64 counter;
-    int64 sumTime;
-    int64 startTime;
-};
-
-TickMeter::TickMeter()
-{
-    reset();
-}
-int64 TickMeter::getTimeTicks() const
-{
-    return sumTime;
-}
-double TickMeter::getTimeMicro() const
-{
-    return  getTimeMilli()*1e3;
-}
-double TickMeter::getTimeMilli() const
-{
-    return getTimeSec()*1e3;
-}
-double TickMeter::getTimeSec() const
-{
-    return (double)getTimeTicks()/cv::getTickFrequency();
-}
-int64 TickMeter::getCounter() const
-{
-    return counter;
-}
-void TickMeter::reset()
+float euclideanDist(cv::Point2f& a, cv::Point2f& b)
 {
-    startTime = 0;
-    sumTime = 0;
-    counter = 0;
+    cv::Point2f diff = a - b;
+    return cv::sqrt(diff.x*diff.x + diff.y*diff.y);
 }
 
-void TickMeter::start()
+// one to many, as the samples did it before point_distances.hpp
+static int nearestPointScalar(const std::vector<cv::Point2f>& points, const cv::Point2f& pt)
 {
-    startTime = cv::getTickCount();
-}
-void TickMeter::stop()
-{
-    int64 time = cv::getTickCount();
-    if ( startTime == 0 )
-        return;
-    ++counter;
-    sumTime += ( time - startTime );
-    startTime = 0;
+    int index = -1;
+    double mindistance = DBL_MAX;
+    for( size_t i = 0; i < points.size(); i++ )
+    {
+        double distance = distanceBtwPoints( pt, points[i] );
+        if( distance < mindistance )
+        {
+            mindistance = distance;
+            index = (int)i;
+        }
+    }
+    return index;
 }
 
-float euclideanDist(cv::Point2f& a, cv::Point2f& b)
+static double farthestPairScalar(const std::vector<cv::Point2f>& points)
 {
-    cv::Point2f diff = a - b;
-    return cv::sqrt(diff.x*diff.x + diff.y*diff.y);
+    double max_distance = 0;
+    for( size_t i = 0; i + 1 < points.size(); i++ )
+        for( size_t j = i+1; j < points.size(); j++ )
+            max_distance = std::max( max_distance, distanceBtwPoints( points[i], points[j] ) );
+    return max_distance;
 }
 
-static double distanceBtwPoints(const cv::Point2f &a, const cv::Point2f &b)
+// bulk kernels against the loops above, from 10 to 1e6 points
+static void bulkBenchmark()
 {
-    double xDiff = a.x - b.x;
-    double yDiff = a.y - b.y;
-
-    return std::sqrt((xDiff * xDiff) + (yDiff * yDiff));
+    cv::RNG& rng = cv::theRNG();
+    std::cout << std::endl << "points\tnearest scalar ms\tnearest simd ms\tall pairs scalar ms\tall pairs tiled ms\tequal" << std::endl;
+    for( int n = 10; n <= 1000000; n *= 10 )
+    {
+        std::vector<cv::Point2f> points( n );
+        for( int i = 0; i < n; i++ )
+            points[i] = cv::Point2f( rng.uniform( 0.f, 10000.f ), rng.uniform( 0.f, 10000.f ) );
+        PointSet set( points );
+        int queries = std::max( 1, 1000000 / n );   // about 1e6 distances per row of the table
+
+        cv::TickMeter t1, t2, t3, t4;
+        bool equal = true;
+        t1.start();
+        for( int q = 0; q < queries; q++ )
+            equal &= nearestPointScalar( points, points[q % n] ) == q % n;
+        t1.stop();
+        t2.start();
+        for( int q = 0; q < queries; q++ )
+            equal &= nearestPoint( set, points[q % n] ) == q % n;
+        t2.stop();
+
+        // all pairs is O(n^2): 1e5 and up would take minutes for the scalar loop
+        if( n <= 10000 )
+        {
+            t3.start();
+            double d1 = farthestPairScalar( points );
+            t3.stop();
+            t4.start();
+            int i, j;
+            double d2 = std::sqrt( (double)farthestPair( set, i, j ) );
+            t4.stop();
+            equal &= std::abs( d1 - d2 ) <= 1e-3 * d1;
+        }
+        std::cout << n << "\t" << t1.getTimeMilli() / queries << "\t" << t2.getTimeMilli() / queries << "\t"
+                  << t3.getTimeMilli() << "\t" << t4.getTimeMilli() << "\t" << ( equal ? "yes" : "NO" ) << std::endl;
+    }
 }
 
 int main(int argc, char**argv)
@@ -107,72 +103,80 @@ int main(int argc, char**argv)
     double distance;
     double max_distance = 0;
 
-    TickMeter tm;
-
-    tm.start();
-    for( int i = 0; i < 14999; i++ )
     {
-        for( int j = i+1; j < 15000; j++ )
+        PERF_STAGE("euclideanDist");
+        for( int i = 0; i < 14999; i++ )
         {
-            a = points[i];
-            b = points[j];
-
-            distance = euclideanDist( a, b );
-            if( distance > max_distance )
+            for( int j = i+1; j < 15000; j++ )
             {
-                max_distance = distance;
-                a_ = a;
-                b_ = b;
+                a = points[i];
+                b = points[j];
+
+                distance = euclideanDist( a, b );
+                if( distance > max_distance )
+                {
+                    max_distance = distance;
+                    a_ = a;
+                    b_ = b;
+                }
             }
         }
     }
+    std::cout << "max_distance euclideanDist : " << euclideanDist( a_, b_ ) << " time passed :" << perf::stats("euclideanDist").total_ms / 1000 << std::endl;
 
-    tm.stop();
-    std::cout << "max_distance euclideanDist : " << euclideanDist( a_, b_ ) << " time passed :" <<tm.getTimeSec() << std::endl;
-
-    tm.reset();
-    tm.start();
-    for( int i = 0; i < 14999; i++ )
     {
-        for( int j = i+1; j < 15000; j++ )
+        PERF_STAGE("distanceBtwPoints");
+        for( int i = 0; i < 14999; i++ )
         {
-            a = points[i];
-            b = points[j];
-
-            distance = distanceBtwPoints( a, b );
-            if( distance > max_distance )
+            for( int j = i+1; j < 15000; j++ )
             {
-                max_distance = distance;
-                a_ = a;
-                b_ = b;
+                a = points[i];
+                b = points[j];
+
+                distance = distanceBtwPoints( a, b );
+                if( distance > max_distance )
+                {
+                    max_distance = distance;
+                    a_ = a;
+                    b_ = b;
+                }
             }
         }
     }
+    std::cout << "max_distance distanceBtwPoints : " << distanceBtwPoints( a_, b_ ) << " time passed :" << perf::stats("distanceBtwPoints").total_ms / 1000 << std::endl;
 
-    tm.stop();
-    std::cout << "max_distance distanceBtwPoints : " << distanceBtwPoints( a_, b_ ) << " time passed :" <<tm.getTimeSec() << std::endl;
-
-    tm.reset();
-    tm.start();
-    for( int i = 0; i < 14999; i++ )
     {
-        for( int j = i+1; j < 15000; j++ )
+        PERF_STAGE("cv::norm");
+        for( int i = 0; i < 14999; i++ )
         {
-            a = points[i];
-            b = points[j];
-
-            distance = cv::norm( a - b );
-            if( distance > max_distance )
+            for( int j = i+1; j < 15000; j++ )
             {
-                max_distance = distance;
-                a_ = a;
-                b_ = b;
+                a = points[i];
+                b = points[j];
+
+                distance = cv::norm( a - b );
+                if( distance > max_distance )
+                {
+                    max_distance = distance;
+                    a_ = a;
+                    b_ = b;
+                }
             }
         }
     }
+    std::cout << "max_distance cv::norm : " << cv::norm( a_ - b_ ) << " time passed :" << perf::stats("cv::norm").total_ms / 1000 << std::endl;
+
+    {
+        PointSet set( points );
+        int i, j;
+        {
+            PERF_STAGE("farthestPair");
+            farthestPair( set, i, j );
+        }
+        std::cout << "max_distance farthestPair : " << distanceBtwPoints( points[i], points[j] ) << " time passed :" << perf::stats("farthestPair").total_ms / 1000 << std::endl;
+    }
 
-    tm.stop();
-    std::cout << "max_distance cv::norm : " << cv::norm( a_ - b_ ) << " time passed :" <<tm.getTimeSec() << std::endl;
+    bulkBenchmark();
 
     return 0;
 }
@@ -1,4 +1,7 @@
 #include "qa.hpp"
+#include "image_cache.hpp"
+#include "color_range.hpp"
+#include "binary_morph.hpp"
 #include <opencv2/highgui.hpp>
 #include <opencv2/imgproc.hpp>
 
@@ -12,22 +15,31 @@ int main( int argc, char** argv )
 }
 #endif
 
+QA_DEMO( a23910 )
+
+// compiled on the first run, the later ones only classify
+static ColorRangeClassifier greenRange()
+{
+  ColorRangeClassifier c( ColorRangeClassifier::HSV );
+  c.addRange( Scalar(44,90,30), Scalar(76,255,255) );
+  return c;
+}
+
 int a23910( int argc, char** argv )
 {
-  Mat edge,dst,threshold;
-  Mat HSV;
+  Mat edge,dst;
   int dilation_size =4;
 
   char* filename = argc >= 2 ? argv[1] : (char*)"23910.jpg";
 
-  Mat src = imread( filename, 1 );
+  Mat src = cachedImread( filename, 1 ).clone();
 
   imshow( "source", src );
   blur( src, src, Size(2,2) );
-  cvtColor(src,HSV,CV_BGR2HSV);
-  inRange(HSV,Scalar(44,90,30),Scalar(76,255,255),threshold);
-  Mat element = getStructuringElement( MORPH_RECT,Size( 2*dilation_size + 1, 2*dilation_size+1 ), Point( dilation_size, dilation_size ) );
-  morphologyEx( threshold, dst, MORPH_CLOSE, element );
+  static const ColorRangeClassifier green = greenRange();
+  // classified and closed row by row, the mask before closing is never stored
+  BinaryMorph close( MORPH_CLOSE, Size( 2*dilation_size + 1, 2*dilation_size+1 ), Point( dilation_size, dilation_size ) );
+  close.apply( src.size(), dst, [&]( int y, uchar* row ) { green.classifyRow( src.ptr<uchar>(y), row, src.cols ); } );
 
 
   int minBound=dst.rows;
@@ -51,13 +63,11 @@ int a23910( int argc, char** argv )
   line(src, Point(0,maxBound), Point(dst.cols,maxBound),  Scalar(0,0,255), 1,8, 0); // maximum boundary
 
   imshow( "final", src );
-  imshow( "threshold", threshold );
   imshow( "dst", dst );
 
   moveWindow("source",40,40);
-  moveWindow("threshold",300,40);
-  moveWindow("dst",560,40);
-  moveWindow("final",820,40);
+  moveWindow("dst",300,40);
+  moveWindow("final",560,40);
   waitKey(0);
   return 0;
 }
@@ -1,4 +1,6 @@
 #include "qa.hpp"
+#include "image_cache.hpp"
+#include "tiled_pyramid.hpp"
 #include <iostream>
 #include "opencv2/opencv.hpp"
 #include <stdio.h>
@@ -16,6 +18,19 @@ bool clicked=false;
 int i=0;
 char imgName[15];
 
+// a24405 <image> <tile dir>: the image is viewed through a tiled pyramid, built in
+// the directory on the first run, and never loaded whole again
+TiledPyramid pyramid;
+bool tiled=false;
+Rect2d view;                  // the part of the image in the window, full resolution
+const Size viewSize(1024,768);
+
+// the crop rectangle, from window to image coordinates
+Rect imageRect(const Rect& r){
+    double s=view.width/viewSize.width;
+    return Rect(cvRound(view.x+r.x*s),cvRound(view.y+r.y*s),cvRound(r.width*s),cvRound(r.height*s));
+}
+
 
 void checkBoundary(){
        //check croping rectangle exceed image boundary
@@ -29,14 +44,20 @@ void checkBoundary(){
          cropRect.x=0;
 
        if(cropRect.y<0)
-         cropRect.height=0;
+         cropRect.y=0;
 }
 
 void showImage(){
-    img=src.clone();
+    if(tiled)
+        pyramid.render(view,viewSize,img);
+    else
+        img=src.clone();
     checkBoundary();
     if(cropRect.width>0&&cropRect.height>0){
-        ROI=src(cropRect);
+        if(tiled)
+            pyramid.crop(imageRect(cropRect),viewSize,ROI); // at most the window size, level 0 only to save
+        else
+            ROI=src(cropRect);
         imshow("cropped",ROI);
         moveWindow("cropped",img.cols+ 60,150);
     }
@@ -105,6 +126,8 @@ int main( int argc, char** argv )
 }
 #endif
 
+QA_DEMO( a24405 )
+
 int a24405(int argc, char** argv)
 {
 
@@ -130,20 +153,37 @@ int a24405(int argc, char** argv)
     cout<<"------> Press 'Esc' to quit"<<endl<<endl;
 
     char* filename = argc >= 2 ? argv[1] : (char*)"fruits.jpg";
-    src = imread(filename);
+    if(argc >= 3){
+        tiled=pyramid.load(argv[2]) || pyramid.build(filename,argv[2]);
+        if(!tiled)
+            return -1;
+        cout<<"------> Press '+' / '-' to zoom, 'i' 'k' 'j' 'l' to pan"<<endl<<endl;
+        // the whole image, with the aspect of the window
+        Size s=pyramid.imageSize();
+        double w=max((double)s.width,s.height*(double)viewSize.width/viewSize.height);
+        view=Rect2d(0,0,w,w*viewSize.height/viewSize.width);
+    }
+    else
+        src = cachedImread(filename).clone();
 
     namedWindow(winName,WINDOW_AUTOSIZE);
 
     moveWindow(winName,40,150);
 
     setMouseCallback(winName,onMouse,NULL );
-    imshow(winName,src);
+    showImage();
 
     while(1){
     char c=waitKey();
     if(c=='s'&&ROI.data){
      sprintf(imgName,"%d.jpg",i++);
-     imwrite(imgName,ROI);
+     if(tiled){
+         Mat full;
+         pyramid.crop(imageRect(cropRect),full); // full resolution, from the tiles
+         imwrite(imgName,full);
+     }
+     else
+         imwrite(imgName,ROI);
      cout<<"  Saved "<<imgName<<endl;
     }
     if(c=='6') cropRect.x++;
@@ -163,6 +203,16 @@ int a24405(int argc, char** argv)
 
     if(c==27) break;
     if(c=='r') {cropRect.x=0;cropRect.y=0;cropRect.width=0;cropRect.height=0;}
+
+    if(tiled){
+        // zoom around the centre of the view, pan by a quarter of it
+        double zoom = c=='+' ? 0.5 : c=='-' ? 2 : 1;
+        view=Rect2d(view.x+view.width*(1-zoom)/2,view.y+view.height*(1-zoom)/2,view.width*zoom,view.height*zoom);
+        if(c=='j') view.x-=view.width/4;
+        if(c=='l') view.x+=view.width/4;
+        if(c=='i') view.y-=view.height/4;
+        if(c=='k') view.y+=view.height/4;
+    }
     showImage();
 
     }
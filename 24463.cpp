@@ -1,4 +1,6 @@
 #include "qa.hpp"
+#include "image_cache.hpp"
+#include "channel_remap.hpp"
 #include "opencv2/imgproc.hpp"
 #include "opencv2/highgui.hpp"
 #include <iostream>
@@ -14,11 +16,7 @@ void test(Mat src)
     cvtColor(src,tmp,CV_BGR2GRAY);
     threshold(tmp,alpha,100,255,THRESH_BINARY);
 
-    Mat rgb[3];
-    split(src,rgb);
-
-    Mat rgba[4]= {rgb[0],rgb[1],rgb[2],alpha};
-    merge(rgba,4,dst);
+    ChannelMap(4).from(0,0).from(1,1).from(2,2).plane(3,alpha).apply(src,dst);
     if( imwrite("result-24463.png",dst) )
         cout << "result-24463.png saved!" ;
 
@@ -31,10 +29,12 @@ int main( int argc, char** argv )
 }
 #endif
 
+QA_DEMO( a24463 )
+
 int a24463(int argc, char** argv)
 {
     char* filename = argc >= 2 ? argv[1] : (char*)"24463.jpg";
-    Mat src = imread( filename ,1 ),gray,temp;
+    Mat src = cachedImread( filename ,1 ),gray,temp;
 
     imshow("source",src);
 
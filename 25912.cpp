@@ -1,6 +1,9 @@
+#include "qa.hpp"
 #include <opencv2/core/utility.hpp>
 #include "opencv2/imgproc.hpp"
 #include "opencv2/imgcodecs.hpp"
+#include "image_cache.hpp"
+#include "rle_mask.hpp"
 #include "opencv2/highgui.hpp"
 #include <iostream>
 
@@ -9,9 +12,9 @@ using namespace std;
 
 static void detect(Mat src)
 {
-    Mat tmp,thr;
+    Mat tmp;
     cvtColor(src,tmp,CV_BGR2GRAY);
-    threshold(tmp,thr,200,255,THRESH_BINARY_INV);
+    RleMask thr = RleMask::threshold(tmp,200,THRESH_BINARY_INV);
 
     vector< vector <Point> > contours;
     vector< Vec4i > hierarchy;
@@ -22,7 +25,7 @@ static void detect(Mat src)
     int threshold_perc=25; //perceantage value for eliminating the box according to pixel count inside the box
     int threshold=(box_w*box_h*threshold_perc)/100;
 
-    findContours( thr, contours, hierarchy,CV_RETR_CCOMP, CV_CHAIN_APPROX_SIMPLE ); //Find contour
+    thr.findContours( contours, hierarchy,CV_RETR_CCOMP, CV_CHAIN_APPROX_SIMPLE ); //Find contour, traced on the bounding rect of each component only
 
     for( size_t i = 0; i< contours.size(); i++ )
     {
@@ -53,11 +56,13 @@ int main( int argc, char** argv )
 }
 #endif
 
+QA_DEMO( a25912 )
+
 int a25912( int argc, char** argv )
 {
     char* filename = argc >= 2 ? argv[1] : (char*)"25912.png";
 
-    Mat src = imread(filename);
+    Mat src = cachedImread(filename).clone();
     if(src.empty())
     {
         cout << "Could not read input image file: " << endl;
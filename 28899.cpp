@@ -47,34 +47,31 @@ int HSV_y=S_V_y+50;
 
 void onTrackbar_changed(int, void*);
 static void onMouse( int event, int x, int y, int, void* );
-void drawPointers(void);
-
-int main()
-{
+void drawPointers(Mat& frame);
+void render(void);
+
+// The window is made of layers converted to BGR once: the background with the hue
+// wheel, which never changes, and one S/V square per hue, made the first time that hue
+// is shown. Trackbar and mouse events only change H, S, V and mark the window dirty;
+// the main loop composes it at most once per refresh, from the cached layers plus the
+// pointers and the preview.
+Mat background;
+vector<Mat> svSquares(HUEMAX+1);
+Scalar textColor;
+bool dirty=true;
+
+// one HSV colour in BGR
+static Scalar toBGR(int h, int s, int v){
+    Mat hsv(1,1,CV_8UC3,Scalar(h,s,v)), bgr;
+    cvtColor(hsv, bgr, CV_HSV2BGR);
+    Vec3b c=bgr.at<Vec3b>(0,0);
+    return Scalar(c[0],c[1],c[2]);
+}
 
+static void renderBackground(){
 HSV.create(390,640,CV_8UC3); //Mat to store clock image
 HSV.setTo(Scalar(200,0,200));
 
-namedWindow(window_name);
-createTrackbar( "Hue",window_name, &H, HUEMAX, onTrackbar_changed );
-createTrackbar( "Saturation",window_name, &S, SATMAX,onTrackbar_changed );
-createTrackbar( "Value",window_name, &V, VALMAX,onTrackbar_changed);
-onTrackbar_changed(0,0); //initialoze window
-
-setMouseCallback( window_name, onMouse, 0 );
- while(true)
-  {
-    int c;
-    c = waitKey( 20 );
-    if( (char)c == 27 )
-      { break; }
-   }
-
-    return 0;
-}
-
-void onTrackbar_changed(int, void*){
-
 //Plot color wheel.
 int hue_range=0;
 int step=1;
@@ -97,36 +94,70 @@ for(int i=wheel_y;i<wheel_hight+wheel_y;i++){
     }
 
 }
+cvtColor(HSV, background,CV_HSV2BGR);
+textColor=toBGR(5,255,255);
+}
 
+//Plot for saturation and value, of one hue
+static const Mat& svSquare(int hue){
+Mat& square=svSquares[hue];
+if(square.empty()){
+    Mat hsv(S_V_Height,S_V_Width,CV_8UC3);
+    int value_range=255;
+    for(int i=0;i<S_V_Height;i++){
+        value_range--;
+        Vec3b* row=hsv.ptr<Vec3b>(i);
+        for(int j=0;j<S_V_Width;j++)
+            row[j]=Vec3b((uchar)hue,(uchar)j,(uchar)value_range);
+    }
+    cvtColor(hsv, square,CV_HSV2BGR);
+}
+return square;
+}
 
-//Plot for saturation and value
-int sat_range=0;
-int value_range=255;
-for(int i=S_V_y;i<S_V_Height+S_V_y;i++){
-    value_range--;
-    sat_range=0;
-for(int j=S_V_x;j<S_V_Width+S_V_x;j++){
-        Vec3b pix;
-        pix.val[0]=H;
-        pix.val[1]=sat_range++;
-        pix.val[2]=value_range;
-     HSV.at<Vec3b>(i,j)=pix;
+int main()
+{
 
+renderBackground();
+
+namedWindow(window_name);
+createTrackbar( "Hue",window_name, &H, HUEMAX, onTrackbar_changed );
+createTrackbar( "Saturation",window_name, &S, SATMAX,onTrackbar_changed );
+createTrackbar( "Value",window_name, &V, VALMAX,onTrackbar_changed);
+
+setMouseCallback( window_name, onMouse, 0 );
+ while(true)
+  {
+    if(dirty){
+        render();
+        dirty=false;
     }
+    int c;
+    c = waitKey( 20 );
+    if( (char)c == 's' )
+      { imwrite("hsv.jpg",HSV); }
+    if( (char)c == 27 )
+      { break; }
+   }
 
+    return 0;
 }
 
-//Ploat for HSV
-Mat roi1(HSV,Rect(HSV_x,HSV_y,HSV_Width,HSV_Height));
-roi1=Scalar(H,S,V);
-drawPointers();
+void onTrackbar_changed(int, void*){
+dirty=true;
+}
 
-Mat RGB;
-cvtColor(HSV, RGB,CV_HSV2BGR);
+// composes the window from the cached layers, HSV holds the BGR result
+void render(){
+background.copyTo(HSV);
+svSquare(H).copyTo(HSV(Rect(S_V_x,S_V_y,S_V_Width,S_V_Height)));
 
-imshow(window_name,RGB);
-imwrite("hsv.jpg",RGB);
+//Ploat for HSV
+Mat roi1(HSV,Rect(HSV_x,HSV_y,HSV_Width,HSV_Height));
+roi1=toBGR(H,S,V);
+drawPointers(HSV);
 
+imshow(window_name,HSV);
 }
 
 static void onMouse( int event, int x, int y, int f, void* ){
@@ -134,17 +165,19 @@ if(f&CV_EVENT_FLAG_LBUTTON){
         mouse_x=x;
         mouse_y=y;
     if(((wheel_x<=x)&&(x<=wheel_x+wheel_width))&&((wheel_y<=y)&&(y<=wheel_y+wheel_hight))){
-        H=(x-wheel_x)/ max_step;
+        H=min((x-wheel_x)/ max_step,HUEMAX);
         cvSetTrackbarPos("Hue", window_name, H);
+        dirty=true;
         }
     else if(((S_V_x<=x)&&(x<=S_V_x+S_V_Width))&&((S_V_y<=y)&&(y<=S_V_y+S_V_Height))){
 
-        S=x-S_V_x;
+        S=min(x-S_V_x,SATMAX);
         y=y-S_V_y;
-        V=255-y;
+        V=max(255-y,0);
 
         cvSetTrackbarPos("Saturation", window_name, S);
         cvSetTrackbarPos("Value", window_name, V);
+        dirty=true;
 
 
         }
@@ -153,7 +186,7 @@ if(f&CV_EVENT_FLAG_LBUTTON){
 
 }
 
-void drawPointers(){
+void drawPointers(Mat& frame){
    // Point p(S_V_x+S,S_V_y+(255-V));
     Point p(S,255-V);
 
@@ -166,7 +199,7 @@ void drawPointers(){
     p2.x=p.x+index;
     p2.y=p.y;
 
-    Mat roi1(HSV,Rect(S_V_x,S_V_y,S_V_Width,S_V_Height));
+    Mat roi1(frame,Rect(S_V_x,S_V_y,S_V_Width,S_V_Height));
     line(roi1, p1, p2,Scalar(255,255,255),1,CV_AA,0);
     p1.x=p.x;
     p1.y=p.y-index;
@@ -182,39 +215,32 @@ void drawPointers(){
     p1.y=wheel_y+1;
     p2.x=x_index;
     p2.y=wheel_y+20;
-    line(HSV, p1, p2,Scalar(255,255,255),2,CV_AA,0);
-
-    Mat RGB(1,1,CV_8UC3);
-    Mat temp;
-    RGB=Scalar(H,S,V);
-    cvtColor(RGB, temp,CV_HSV2BGR);
-    Vec3b rgb=temp.at<Vec3b>(0,0);
-    B=rgb.val[0];
-    G=rgb.val[1];
-    R=rgb.val[2];
+    line(frame, p1, p2,Scalar(255,255,255),2,CV_AA,0);
 
-    Mat roi2(HSV,Rect(450,130,175,175));
-    roi2=Scalar(200,0,200);
+    Scalar rgb=toBGR(H,S,V);
+    B=(int)rgb[0];
+    G=(int)rgb[1];
+    R=(int)rgb[2];
 
     char name[30];
     sprintf(name,"R=%d",R);
-    putText(HSV,name, Point(460,155) , FONT_HERSHEY_SIMPLEX, .7, Scalar(5,255,255), 2,8,false );
+    putText(frame,name, Point(460,155) , FONT_HERSHEY_SIMPLEX, .7, textColor, 2,8,false );
 
     sprintf(name,"G=%d",G);
-    putText(HSV,name, Point(460,180) , FONT_HERSHEY_SIMPLEX, .7, Scalar(5,255,255), 2,8,false );
+    putText(frame,name, Point(460,180) , FONT_HERSHEY_SIMPLEX, .7, textColor, 2,8,false );
 
     sprintf(name,"B=%d",B);
-    putText(HSV,name, Point(460,205) , FONT_HERSHEY_SIMPLEX, .7, Scalar(5,255,255), 2,8,false );
+    putText(frame,name, Point(460,205) , FONT_HERSHEY_SIMPLEX, .7, textColor, 2,8,false );
 
 
     sprintf(name,"H=%d",H);
-    putText(HSV,name, Point(545,155) , FONT_HERSHEY_SIMPLEX, .7, Scalar(5,255,255), 2,8,false );
+    putText(frame,name, Point(545,155) , FONT_HERSHEY_SIMPLEX, .7, textColor, 2,8,false );
 
     sprintf(name,"S=%d",S);
-    putText(HSV,name, Point(545,180) , FONT_HERSHEY_SIMPLEX, .7, Scalar(5,255,255), 2,8,false );
+    putText(frame,name, Point(545,180) , FONT_HERSHEY_SIMPLEX, .7, textColor, 2,8,false );
 
     sprintf(name,"V=%d",V);
-    putText(HSV,name, Point(545,205) , FONT_HERSHEY_SIMPLEX, .7, Scalar(5,255,255), 2,8,false );
+    putText(frame,name, Point(545,205) , FONT_HERSHEY_SIMPLEX, .7, textColor, 2,8,false );
 
 
 }
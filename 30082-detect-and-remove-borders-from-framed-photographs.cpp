@@ -1,5 +1,7 @@
 #include <opencv2/highgui.hpp>
 #include <opencv2/imgproc.hpp>
+#include <iostream>
+#include <vector>
 
 using namespace cv;
 
@@ -39,15 +41,113 @@ Rect deleteBorder(InputArray _src,int size){
     return result;
 }
 
+// Samples of one line, row or column i, every step pixels: their mean, and the share
+// of them farther than tol from ref (from their own mean when ref < 0)
+static void lineStats(const Mat& gray, bool row, int i, int step, double ref, int tol, double& mean, double& outside)
+{
+    int n = row ? gray.cols : gray.rows;
+    std::vector<uchar> v;
+    v.reserve(n / step + 1);
+    double sum = 0;
+    for (int k = 0; k < n; k += step)
+    {
+        v.push_back(row ? gray.at<uchar>(i, k) : gray.at<uchar>(k, i));
+        sum += v.back();
+    }
+    mean = sum / v.size();
+    if (ref < 0)
+        ref = mean;
+    int far = 0;
+    for (size_t k = 0; k < v.size(); k++)
+        far += std::abs(v[k] - ref) > tol;
+    outside = (double)far / v.size();
+}
+
+// From one edge inwards: lines start, start + dir * lineStep, ... up to limit (not
+// included). A line is content when more than frac of it is off the running mean of
+// the frame lines before it; returns the first one, or limit.
+static int scanEdge(const Mat& gray, bool row, int start, int dir, int limit, int lineStep, int sampleStep,
+                    int tol, double frac, double& frame, int& frameLines)
+{
+    for (int pos = start; (limit - pos) * dir > 0; pos += dir * lineStep)
+    {
+        double mean, outside;
+        lineStats(gray, row, pos, sampleStep, frame, tol, mean, outside);
+        if (outside > frac)
+            return pos;
+        frame = (frame * frameLines + mean) / (frameLines + 1);
+        frameLines++;
+    }
+    return limit;
+}
+
+// The rectangle inside a uniform frame, by scanning inwards from each edge and stopping
+// at the first content line. A first pass reads every coarse-th line and pixel, up to
+// the middle; a second one reads the lines in full between the last frame line and
+// the content line found, so about border width x side pixels are read, whatever the
+// size of the photograph.
+Rect scanBorder(const Mat& gray, int tol = 12, double frac = 0.05, int coarse = 8)
+{
+    CV_Assert(gray.type() == CV_8UC1);
+    int edge[4]; // top, bottom, left, right
+    for (int e = 0; e < 4; e++)
+    {
+        bool row = e < 2;
+        int n = row ? gray.rows : gray.cols;
+        int start = e % 2 ? n - 1 : 0, dir = e % 2 ? -1 : 1, middle = n / 2;
+        double frame = -1;
+        int frameLines = 0;
+        int c = scanEdge(gray, row, start, dir, middle, coarse, coarse, tol, frac, frame, frameLines);
+        if (c != start)
+        {
+            // c - dir * coarse was a frame line; the content starts after it, by c
+            int from = c - dir * coarse + dir, to = c == middle ? middle : c;
+            c = scanEdge(gray, row, from, dir, to, 1, 1, tol, frac, frame, frameLines);
+        }
+        edge[e] = c;
+    }
+    return Rect(Point(edge[2], edge[0]), Point(edge[3] + 1, edge[1] + 1));
+}
+
+// every image of a directory: the frame found and the time it took
+static int scanDirectory(const String& dir)
+{
+    std::vector<String> files;
+    glob(dir, files);
+    for (size_t i = 0; i < files.size(); i++)
+    {
+        Mat gray = imread(files[i], IMREAD_GRAYSCALE);
+        if (gray.empty())
+            continue;
+        int64 t = getTickCount();
+        Rect r = scanBorder(gray);
+        double ms = (getTickCount() - t) * 1000. / getTickFrequency();
+        std::cout << files[i] << "," << r.x << "," << r.y << "," << r.width << "," << r.height << "," << ms << std::endl;
+    }
+    return 0;
+}
+
 int main( int argc, const char** argv )
 {
+if (argc < 2 || (String(argv[1]) == "-d" && argc < 3))
+{
+    std::cout << "usage: " << argv[0] << " <image>" << std::endl
+              << "       " << argv[0] << " -d <dir>   (csv: file,x,y,width,height,ms)" << std::endl;
+    return -1;
+}
+// -d <dir>: every image of the directory, one csv line each
+if (String(argv[1]) == "-d")
+    return scanDirectory(argv[2]);
+
 Mat img = imread(argv[1]);
 Mat gray_img;
 cvtColor(img, gray_img, CV_BGR2GRAY);
 Rect r = deleteBorder(gray_img, 2);
+Rect s = scanBorder(gray_img);
 Mat color_img;
 
 rectangle(img, r, Scalar(0, 0, 255), 2);
+rectangle(img, s, Scalar(0, 255, 0), 2);
 imshow("result", img);
 waitKey(0);
 
@@ -1,22 +1,144 @@
 
 #include "opencv2/imgproc.hpp"
 #include "opencv2/highgui.hpp"
+#include <algorithm>
 #include <iostream>
 
 using namespace cv;
 using namespace std;
 
-struct contour_sorter // 'less' for contours
+enum ContourOrder
 {
-    bool operator ()( const vector<Point>& a, const vector<Point> & b )
+    ORDER_ROW_MAJOR,    // by top edge, then left edge
+    ORDER_COLUMN_MAJOR, // by left edge, then top edge
+    ORDER_READING       // lines of text: contours whose tops are within the tolerance share a line, left to right
+};
+
+class BoundingRectBody : public ParallelLoopBody
+{
+public:
+    BoundingRectBody(const vector<vector<Point> >& _contours, vector<Rect>& _rects)
+        : contours(_contours), rects(_rects) {}
+
+    void operator()(const Range& range) const
     {
-        Rect ra(boundingRect(a));
-        Rect rb(boundingRect(b));
-        // scale factor for y should be larger than img.width
-        return ( (ra.x + 1000*ra.y) < (rb.x + 1000*rb.y) );
+        for (int i = range.start; i < range.end; i++)
+            rects[i] = boundingRect(contours[i]);
     }
+
+private:
+    const vector<vector<Point> >& contours;
+    vector<Rect>& rects;
 };
 
+// (key, index) pairs: the index makes every key unique, so the order is stable
+typedef std::pair<int64, int> SortKey;
+
+class SortChunkBody : public ParallelLoopBody
+{
+public:
+    SortChunkBody(vector<SortKey>& _keys, int _chunk) : keys(_keys), chunk(_chunk) {}
+
+    void operator()(const Range& range) const
+    {
+        for (int c = range.start; c < range.end; c++)
+        {
+            size_t b = (size_t)c * chunk, e = std::min(b + chunk, keys.size());
+            std::sort(keys.begin() + b, keys.begin() + e);
+        }
+    }
+
+private:
+    vector<SortKey>& keys;
+    int chunk;
+};
+
+// std::sort for small inputs; large inputs are sorted in chunks on parallel_for_ and merged
+static void sortKeys(vector<SortKey>& keys)
+{
+    const int chunk = 1 << 14;
+    if (keys.size() <= (size_t)chunk * 2)
+    {
+        std::sort(keys.begin(), keys.end());
+        return;
+    }
+    int chunks = (int)((keys.size() + chunk - 1) / chunk);
+    parallel_for_(Range(0, chunks), SortChunkBody(keys, chunk));
+    for (size_t width = chunk; width < keys.size(); width *= 2)
+        for (size_t b = 0; b + width < keys.size(); b += 2 * width)
+            std::inplace_merge(keys.begin() + b, keys.begin() + b + width,
+                               keys.begin() + std::min(b + 2 * width, keys.size()));
+}
+
+static int64 makeKey(int primary, int secondary)
+{
+    // secondary offset so negative coordinates still sort correctly; primary is
+    // multiplied rather than shifted, a negative value shifted left is undefined
+    return (int64)primary * ((int64)1 << 32) + ((int64)secondary + 0x80000000LL);
+}
+
+// Indices of the contours in the requested order. Every bounding rect is computed
+// once, then only integer keys are compared. tolerance: for ORDER_READING, how far
+// (in pixels) the top of a contour may be below the top of the first contour of a
+// line and still belong to it; < 0 uses half the median contour height.
+void sortContourIndices(const vector<vector<Point> >& contours, vector<int>& order,
+                        ContourOrder mode = ORDER_ROW_MAJOR, int tolerance = -1)
+{
+    const int n = (int)contours.size();
+    vector<Rect> rects(n);
+    parallel_for_(Range(0, n), BoundingRectBody(contours, rects), std::max(1.0, n / 1024.0));
+
+    vector<SortKey> keys(n);
+    if (mode == ORDER_READING)
+    {
+        if (tolerance < 0 && n > 0)
+        {
+            vector<int> heights(n);
+            for (int i = 0; i < n; i++)
+                heights[i] = rects[i].height;
+            std::nth_element(heights.begin(), heights.begin() + n / 2, heights.end());
+            tolerance = heights[n / 2] / 2;
+        }
+        // walk the contours top to bottom, starting a new line past the tolerance
+        for (int i = 0; i < n; i++)
+            keys[i] = SortKey(makeKey(rects[i].y, rects[i].x), i);
+        sortKeys(keys);
+        int line = 0, lineTop = n > 0 ? rects[keys[0].second].y : 0;
+        for (int k = 0; k < n; k++)
+        {
+            const Rect& r = rects[keys[k].second];
+            if (r.y > lineTop + tolerance)
+            {
+                line++;
+                lineTop = r.y;
+            }
+            keys[k].first = makeKey(line, r.x);
+        }
+    }
+    else
+    {
+        for (int i = 0; i < n; i++)
+            keys[i] = SortKey(mode == ORDER_COLUMN_MAJOR ? makeKey(rects[i].x, rects[i].y)
+                                                         : makeKey(rects[i].y, rects[i].x), i);
+    }
+    sortKeys(keys);
+
+    order.resize(n);
+    for (int k = 0; k < n; k++)
+        order[k] = keys[k].second;
+}
+
+// Same order, applied to the contours themselves; the point vectors are swapped, not copied.
+void sortContours(vector<vector<Point> >& contours, ContourOrder mode = ORDER_ROW_MAJOR, int tolerance = -1)
+{
+    vector<int> order;
+    sortContourIndices(contours, order, mode, tolerance);
+    vector<vector<Point> > sorted(contours.size());
+    for (size_t k = 0; k < order.size(); k++)
+        sorted[k].swap(contours[order[k]]);
+    contours.swap(sorted);
+}
+
 int main()
 {
 vector<vector<Point> > contours(4);
@@ -32,9 +154,16 @@ for ( int i=0; i<contours.size(); i++ )
     cerr << Mat(contours[i]) << endl;
 
 // apply it to the contours:
-std::sort(contours.begin(), contours.end(), contour_sorter());
+sortContours(contours);
 
 for ( int i=0; i<contours.size(); i++ )
     cerr << Mat(contours[i]) << endl;
+
+// reading order: the tops 13 and 25 are within the tolerance, so they share a line
+vector<int> order;
+sortContourIndices(contours, order, ORDER_READING, 15);
+for ( int i=0; i<order.size(); i++ )
+    cerr << order[i] << " ";
+cerr << endl;
     return 0;
 }
@@ -3,10 +3,163 @@
 #include <opencv2/highgui.hpp>
 
 #include <iostream>
+#include <vector>
+#include <cfloat>
 
 using namespace cv;
 using namespace std;
 
+// Mini-batch k-means (Sculley 2010) for large or streaming Point2f sets.
+//
+//     MiniBatchKMeans km( K, 1024 );
+//     km.fit( points, 100 );        // 100 batches of 1024 random points
+//     km.partialFit( newPoints );   // later: move the centers with the new points only
+//     km.predict( points, labels );
+//
+// Centers are seeded with k-means++ on a sample, every batch is assigned in a
+// parallel_for_ over chunks, and each center moves towards its points with a step of
+// 1 / (points it has seen so far), so it keeps converging as data keeps coming.
+class MiniBatchKMeans
+{
+public:
+    MiniBatchKMeans( int _K, int _batchSize = 1024, uint64 seed = 0x12345678 )
+        : K(_K), batchSize(_batchSize), rng(seed) {}
+
+    const vector<Point2f>& getCenters() const { return centers; }
+
+    void fit( const vector<Point2f>& points, int iterations )
+    {
+        if( points.empty() )
+            return;
+        if( centers.empty() )
+            seed( points );
+        vector<Point2f> batch( std::min( (size_t)batchSize, points.size() ) );
+        for( int it = 0; it < iterations; it++ )
+        {
+            for( size_t i = 0; i < batch.size(); i++ )
+                batch[i] = points[rng.uniform( 0, (int)points.size() )];
+            update( batch );
+        }
+    }
+
+    // one pass over new points, batch by batch, without starting over
+    void partialFit( const vector<Point2f>& points )
+    {
+        if( points.empty() )
+            return;
+        if( centers.empty() )
+            seed( points );
+        for( size_t start = 0; start < points.size(); start += batchSize )
+        {
+            size_t end = std::min( points.size(), start + batchSize );
+            update( vector<Point2f>( points.begin() + start, points.begin() + end ) );
+        }
+    }
+
+    // returns the sum of squared distances to the nearest center (compactness)
+    double predict( const vector<Point2f>& points, vector<int>& labels ) const
+    {
+        vector<float> dist;
+        assign( points, labels, dist );
+        double sum = 0;
+        for( size_t i = 0; i < dist.size(); i++ )
+            sum += dist[i];
+        return sum;
+    }
+
+private:
+    class AssignBody : public ParallelLoopBody
+    {
+    public:
+        AssignBody( const vector<Point2f>& _points, const vector<Point2f>& _centers, vector<int>& _labels,
+                    vector<float>& _dist, int _chunk )
+            : points(_points), centers(_centers), labels(_labels), dist(_dist), chunk(_chunk) {}
+
+        void operator()( const Range& range ) const
+        {
+            int end = std::min( (int)points.size(), range.end * chunk );
+            for( int i = range.start * chunk; i < end; i++ )
+            {
+                const Point2f& p = points[i];
+                float best = FLT_MAX;
+                int label = 0;
+                for( size_t c = 0; c < centers.size(); c++ )
+                {
+                    float dx = p.x - centers[c].x, dy = p.y - centers[c].y;
+                    float d = dx * dx + dy * dy;
+                    if( d < best )
+                    {
+                        best = d;
+                        label = (int)c;
+                    }
+                }
+                labels[i] = label;
+                dist[i] = best;
+            }
+        }
+
+    private:
+        const vector<Point2f>& points;
+        const vector<Point2f>& centers;
+        vector<int>& labels;
+        vector<float>& dist;
+        int chunk;
+    };
+
+    void assign( const vector<Point2f>& points, vector<int>& labels, vector<float>& dist ) const
+    {
+        const int chunk = 4096;
+        labels.resize( points.size() );
+        dist.resize( points.size() );
+        int chunks = (int)( ( points.size() + chunk - 1 ) / chunk );
+        parallel_for_( Range( 0, chunks ), AssignBody( points, centers, labels, dist, chunk ) );
+    }
+
+    // k-means++ on at most 10 batches worth of points
+    void seed( const vector<Point2f>& points )
+    {
+        vector<Point2f> sample;
+        size_t n = std::min( points.size(), (size_t)batchSize * 10 );
+        for( size_t i = 0; i < n; i++ )
+            sample.push_back( points[n == points.size() ? i : rng.uniform( 0, (int)points.size() )] );
+
+        centers.assign( 1, sample[rng.uniform( 0, (int)sample.size() )] );
+        vector<int> labels;
+        vector<float> dist;
+        while( (int)centers.size() < K )
+        {
+            assign( sample, labels, dist );
+            double total = 0;
+            for( size_t i = 0; i < dist.size(); i++ )
+                total += dist[i];
+            double r = rng.uniform( 0., total );
+            size_t pick = 0;
+            for( ; pick + 1 < dist.size() && ( r -= dist[pick] ) > 0; pick++ )
+                ;
+            centers.push_back( sample[pick] );
+        }
+        counts.assign( K, 0 );
+    }
+
+    void update( const vector<Point2f>& batch )
+    {
+        assign( batch, batchLabels, batchDist );
+        for( size_t i = 0; i < batch.size(); i++ )
+        {
+            int c = batchLabels[i];
+            float eta = 1.f / (float)++counts[c];
+            centers[c] += ( batch[i] - centers[c] ) * eta;
+        }
+    }
+
+    int K, batchSize;
+    RNG rng;
+    vector<Point2f> centers;
+    vector<int64> counts;
+    vector<int> batchLabels;
+    vector<float> batchDist;
+};
+
 int main( int argc, char** argv )
 {
 vector<Point2f> points;
@@ -31,5 +184,45 @@ for ( int i=0; i<labels.rows; i++ )
     cerr << i << " " << idx << " " << original_point << " " << clustered_center << endl;
 }
 
+    // a bigger synthetic set: full kmeans against mini-batch with a few batch sizes
+    int N = argc > 1 ? atoi( argv[1] ) : 1000000;
+    int clusters = 16;
+    RNG rng;
+    vector<Point2f> truth( clusters ), big( N );
+    for( int c = 0; c < clusters; c++ )
+        truth[c] = Point2f( rng.uniform( 0.f, 1000.f ), rng.uniform( 0.f, 1000.f ) );
+    for( int i = 0; i < N; i++ )
+        big[i] = truth[i % clusters] + Point2f( (float)rng.gaussian( 20 ), (float)rng.gaussian( 20 ) );
+
+    double t = (double)getTickCount();
+    Mat fullLabels, fullCenters;
+    double fullCompactness = kmeans( big, clusters, fullLabels, TermCriteria( TermCriteria::COUNT + TermCriteria::EPS, 100, 0.1 ),
+                                     1, KMEANS_PP_CENTERS, fullCenters );
+    t = ( (double)getTickCount() - t ) * 1000. / getTickFrequency();
+    cout << "kmeans: " << t << " ms, compactness " << fullCompactness << endl;
+
+    int batchSizes[] = { 256, 1024, 4096 };
+    for( int b = 0; b < 3; b++ )
+    {
+        t = (double)getTickCount();
+        MiniBatchKMeans km( clusters, batchSizes[b] );
+        km.fit( big, 200 );
+        double fitTime = ( (double)getTickCount() - t ) * 1000. / getTickFrequency();
+        vector<int> miniLabels;
+        double compactness = km.predict( big, miniLabels );
+        cout << "mini-batch " << batchSizes[b] << ": " << fitTime << " ms, compactness " << compactness
+             << " (" << ( compactness / fullCompactness - 1 ) * 100 << "% above kmeans)" << endl;
+    }
+
+    // streaming: the points arrive in slices and only move the existing centers
+    MiniBatchKMeans stream( clusters, 1024 );
+    int slice = std::max( 1, N / 10 );
+    for( int start = 0; start < N; start += slice )
+        stream.partialFit( vector<Point2f>( big.begin() + start, big.begin() + std::min( N, start + slice ) ) );
+    vector<int> streamLabels;
+    double streamCompactness = stream.predict( big, streamLabels );
+    cout << "streamed in 10 slices: compactness " << streamCompactness
+         << " (" << ( streamCompactness / fullCompactness - 1 ) * 100 << "% above kmeans)" << endl;
+
     return 0;
 }
@@ -2,6 +2,8 @@
 #include "qa.hpp"
 #include "opencv2/imgproc.hpp"
 #include "opencv2/highgui.hpp"
+#include "rle_mask.hpp"
+#include <iostream>
 
 using namespace cv;
 using namespace std;
@@ -13,19 +15,24 @@ int main( int argc, char** argv )
 }
 #endif
 
+QA_DEMO( a4183 )
+
 int a4183(int argc, char** argv)
 {
     char* filename = argc >= 2 ? argv[1] : (char*)"65164.png";
     Mat src = imread( filename ,1 ),gray,temp;
 
-    Mat mSource_Bgr,mSource_Gray,mThreshold;
+    Mat mSource_Bgr,mSource_Gray;
     mSource_Bgr= src;
     cvtColor(mSource_Bgr,mSource_Gray,COLOR_BGR2GRAY);
-    threshold(mSource_Gray,mThreshold,254,255,THRESH_BINARY_INV);
 
-    Mat Points;
-    findNonZero(mThreshold,Points);
-    Rect Min_Rect=boundingRect(Points);
+    // the mask is kept as runs: the bounding rect needs the ends of the rows only
+    TickMeter tm;
+    tm.start();
+    RleMask mThreshold=RleMask::threshold(mSource_Gray,254,THRESH_BINARY_INV);
+    Rect Min_Rect=mThreshold.boundingRect();
+    tm.stop();
+    cout << mThreshold.countNonZero() << " points in " << mThreshold.runCount() << " runs, bounding rect " << Min_Rect << " in " << tm.getTimeMilli() << " ms" << endl;
 
     rectangle(mSource_Bgr,Min_Rect.tl(),Min_Rect.br(),Scalar(0,255,0),2);
 
@@ -12,6 +12,8 @@ int main( int argc, char** argv )
 }
 #endif
 
+QA_DEMO( a5147 )
+
 int a5147(int argc, char** argv)
 {
     Mat m = (Mat_<int>(6,8) <<
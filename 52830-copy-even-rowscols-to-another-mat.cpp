@@ -1,6 +1,7 @@
 
 #include "opencv2/core.hpp"
 #include "opencv2/imgproc.hpp"
+#include "decimate.hpp"
 #include <iostream>
 
 using namespace cv;
@@ -31,6 +32,24 @@ int main( int argc, char** argv )
     resize( m, m_resized, Size(), 0.5, 0.5, INTER_AREA );
 
     cout << "resized m ( with INTER_AREA flag )\n" << m_resized << "\n" << endl;
+
+    // the even rows are a view of m, only the columns are copied
+    Mat even_rows = decimateRows( m, 2 );
+
+    cout << "even rows of m ( a header sharing m's data )\n" << even_rows << "\n" << endl;
+
+    Mat m_even, m_odd;
+    decimate( m, m_even, 2 );
+    decimateCols( m, m_odd, 2, 1 );
+
+    cout << "even rows and cols of m\n" << m_even << "\n" << endl;
+    cout << "odd cols of m\n" << m_odd << "\n" << endl;
+
+    Mat planes[4];
+    splitPhases2x2( m, planes );
+
+    for( int k = 0; k < 4; k++ )
+        cout << "phase (" << k / 2 << "," << k % 2 << ")\n" << planes[k] << "\n" << endl;
     return 0;
 }
 
@@ -1,20 +1,159 @@
 #include "opencv2/imgproc.hpp"
 #include "opencv2/highgui.hpp"
+#include "opencv2/core/hal/intrin.hpp"
 #include "iostream"
+#include <algorithm>
 
 using namespace cv;
 
+// Sum of Gx^2 + Gy^2 (3x3 Sobel) over rows [y0, y1) of an 8 bit gray image, without
+// storing the gradients. Only pixels with all 8 neighbours inside the image count.
+static int64 sobelEnergyRows( const Mat &gray, int y0, int y1 )
+{
+    int64 total = 0;
+    y0 = std::max( y0, 1 );
+    y1 = std::min( y1, gray.rows - 1 );
+    for( int y = y0; y < y1; y++ )
+    {
+        const uchar *r0 = gray.ptr( y - 1 ), *r1 = gray.ptr( y ), *r2 = gray.ptr( y + 1 );
+        int x = 1;
+#if CV_SIMD128
+        // a step adds at most 4 * 1020^2 to an int32 lane, flushed every 128 steps
+        for( ; x <= gray.cols - 9; )
+        {
+            v_int32x4 acc = v_setzero_s32();
+            for( int n = 0; n < 128 && x <= gray.cols - 9; n++, x += 8 )
+            {
+                v_int16x8 a0 = v_reinterpret_as_s16( v_load_expand( r0 + x - 1 ) ), a2 = v_reinterpret_as_s16( v_load_expand( r0 + x + 1 ) );
+                v_int16x8 b0 = v_reinterpret_as_s16( v_load_expand( r1 + x - 1 ) ), b2 = v_reinterpret_as_s16( v_load_expand( r1 + x + 1 ) );
+                v_int16x8 c0 = v_reinterpret_as_s16( v_load_expand( r2 + x - 1 ) ), c2 = v_reinterpret_as_s16( v_load_expand( r2 + x + 1 ) );
+                v_int16x8 a1 = v_reinterpret_as_s16( v_load_expand( r0 + x ) ), c1 = v_reinterpret_as_s16( v_load_expand( r2 + x ) );
+                v_int16x8 gx = ( a2 - a0 ) + ( b2 - b0 ) + ( b2 - b0 ) + ( c2 - c0 );
+                v_int16x8 gy = ( c0 + c1 + c1 + c2 ) - ( a0 + a1 + a1 + a2 );
+                acc += v_dotprod( gx, gx );
+                acc += v_dotprod( gy, gy );
+            }
+            total += (unsigned)v_reduce_sum( acc );
+        }
+#endif
+        for( ; x < gray.cols - 1; x++ )
+        {
+            int gx = ( r0[x+1] - r0[x-1] ) + 2 * ( r1[x+1] - r1[x-1] ) + ( r2[x+1] - r2[x-1] );
+            int gy = ( r2[x-1] + 2 * r2[x] + r2[x+1] ) - ( r0[x-1] + 2 * r0[x] + r0[x+1] );
+            total += gx * gx + gy * gy;
+        }
+    }
+    return total;
+}
+
+class SobelEnergyBody : public ParallelLoopBody
+{
+public:
+    SobelEnergyBody( const Mat &_gray, int64 &_total, Mutex &_lock )
+        : gray( _gray ), total( _total ), lock( _lock ) {}
+
+    void operator()( const Range &range ) const
+    {
+        int64 e = sobelEnergyRows( gray, range.start, range.end );
+        AutoLock l( lock );
+        total += e;
+    }
+
+private:
+    const Mat &gray;
+    int64 &total;
+    Mutex &lock;
+};
+
+// mean gradient energy per pixel of an 8 bit gray image, higher is sharper
+double sobelEnergy( const Mat &gray )
+{
+    CV_Assert( gray.type() == CV_8UC1 );
+    if( gray.rows < 3 || gray.cols < 3 )
+        return 0;
+    int64 total = 0;
+    Mutex lock;
+    parallel_for_( Range( 0, gray.rows ), SobelEnergyBody( gray, total, lock ), std::max( 1.0, gray.rows / 64.0 ) );
+    return (double)total / ( ( gray.rows - 2 ) * ( gray.cols - 2 ) );
+}
+
 float calcBlurriness( const Mat &src )
 {
-    Mat Gx, Gy;
-    Sobel( src, Gx, CV_32F, 1, 0 );
-    Sobel( src, Gy, CV_32F, 0, 1 );
-    double normGx = norm( Gx );
-    double normGy = norm( Gy );
-    double sumSq = normGx * normGx + normGy * normGy;
-    return static_cast<float>( 1. / ( sumSq / src.size().area() + 1e-6 ));
+    Mat gray;
+    if( src.channels() == 1 )
+        gray = src;
+    else
+        cvtColor( src, gray, COLOR_BGR2GRAY );
+    return static_cast<float>( 1. / ( sobelEnergy( gray ) + 1e-6 ));
 }
 
+// Scores frames as they arrive on a downscaled gray copy (of roi, when set) and keeps the
+// k sharpest. With a tile grid the score is the one of the sharpest tile, so a frame
+// with a sharp subject on a blurred background still scores high.
+class SharpestFrames
+{
+public:
+    explicit SharpestFrames( int _k = 3, int _maxWidth = 320, Size _tiles = Size( 1, 1 ), Rect _roi = Rect() )
+        : k( _k ), maxWidth( _maxWidth ), tiles( _tiles ), roi( _roi ) {}
+
+    double score( const Mat &frame )
+    {
+        Mat view = roi.area() > 0 ? frame( roi & Rect( 0, 0, frame.cols, frame.rows ) ) : frame;
+        if( view.channels() == 1 )
+            gray = view;
+        else
+            cvtColor( view, gray, COLOR_BGR2GRAY );
+        if( maxWidth > 0 && gray.cols > maxWidth )
+            resize( gray, gray, Size( maxWidth, gray.rows * maxWidth / gray.cols ), 0, 0, INTER_AREA );
+
+        double top = 0;
+        for( int ty = 0; ty < tiles.height; ty++ )
+            for( int tx = 0; tx < tiles.width; tx++ )
+            {
+                Rect t( tx * gray.cols / tiles.width, ty * gray.rows / tiles.height,
+                        gray.cols / tiles.width, gray.rows / tiles.height );
+                top = std::max( top, sobelEnergy( gray( t ) ) );
+            }
+        return top;
+    }
+
+    // returns the score; the frame is copied only when it makes the top k
+    double push( const Mat &frame, int index )
+    {
+        double s = score( frame );
+        if( (int)best.size() < k )
+            best.push_back( Entry() );
+        else if( s <= best.back().score )
+            return s;
+        Entry &e = best.back();
+        e.score = s;
+        e.index = index;
+        frame.copyTo( e.frame );
+        // keep best sorted, sharpest first
+        for( size_t i = best.size() - 1; i > 0 && best[i].score > best[i-1].score; i-- )
+            std::swap( best[i], best[i-1] );
+        return s;
+    }
+
+    struct Entry
+    {
+        double score;
+        int index;
+        Mat frame;
+        Entry() : score( -1 ), index( -1 ) {}
+    };
+
+    const std::vector<Entry> &frames() const { return best; }
+    void clear() { best.clear(); }
+
+private:
+    int k, maxWidth;
+    Size tiles;
+    Rect roi;
+    Mat gray;
+    std::vector<Entry> best;
+};
+
 int main( int argc, char** argv )
 {
     char* filename = argc >= 2 ? argv[1] : (char*)"lena.jpg";
@@ -24,6 +163,9 @@ int main( int argc, char** argv )
     {
         std::cout << "original image : " << calcBlurriness( src ) << std::endl;
 
+        SharpestFrames sharpest( 3, 320, Size( 2, 2 ) );
+        TickMeter tm;
+        int index = 0;
         for( int i =3; i < 80; i+=2 )
         {
             Mat blurred;
@@ -31,7 +173,14 @@ int main( int argc, char** argv )
             imshow(  "blurred image", blurred );
             waitKey(200);
             std::cout << "blurred image  : " << calcBlurriness( blurred ) << std::endl;
+            tm.start();
+            sharpest.push( blurred, index++ );
+            tm.stop();
         }
+        std::cout << "scoring: " << tm.getTimeMilli() / std::max( 1, index ) << " ms per frame" << std::endl;
+        for( size_t i = 0; i < sharpest.frames().size(); i++ )
+            std::cout << "sharpest #" << i << ": frame " << sharpest.frames()[i].index
+                      << " score " << sharpest.frames()[i].score << std::endl;
     }
     return 0;
 }
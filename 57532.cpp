@@ -1,5 +1,6 @@
 #include "opencv2/imgproc.hpp"
 #include "opencv2/highgui.hpp"
+#include "channel_remap.hpp"
 
 using namespace cv;
 using namespace std;
@@ -23,16 +24,11 @@ int main( int argc, char** argv )
     dst = dst - Scalar(127,127,0);
     imshow("result 1",dst);
 
-    Mat bgr[3];
-    split(src,bgr);
-
-    Mat mZero = Mat::zeros(src.size(),CV_8UC1);
-    Mat bgr1[3]= {mZero,mZero,bgr[1]};
-    merge(bgr1,3,dst);
+    // (0, 0, green) and (blue, 0, green), straight from src
+    ChannelMap(3).constant(0,0).constant(1,0).from(2,1).apply(src,dst);
     imshow("result 2",dst);
 
-    Mat bgr2[3]= {bgr[0],mZero,bgr[1]};
-    merge(bgr2,3,dst);
+    ChannelMap(3).from(0,0).constant(1,0).from(2,1).apply(src,dst);
     imshow("result 3",dst);
     waitKey();
 }
@@ -1,4 +1,6 @@
 #include "qa.hpp"
+#include "image_cache.hpp"
+#include "color_range.hpp"
 #include "opencv/highgui.h"
 #include "opencv2/opencv.hpp"
 #include "opencv2/core/core.hpp"
@@ -21,6 +23,17 @@ int main( int argc, char** argv )
 }
 #endif
 
+QA_DEMO( a59782 )
+
+// both red ranges in one table, compiled on the first run
+static ColorRangeClassifier redRanges()
+{
+    ColorRangeClassifier c( ColorRangeClassifier::HSV );
+    c.addRange( Scalar(0, 85, 241), Scalar(18, 255, 255) );
+    c.addRange( Scalar(171, 0, 0), Scalar(255, 255, 255) );
+    return c;
+}
+
 int a59782( int argc, char** argv )
 {
     cvNamedWindow( "RGB", 1 );
@@ -29,25 +42,16 @@ int a59782( int argc, char** argv )
     //cvNamedWindow( "Binary1", 1 );
     cvNamedWindow( "Contour", 1 );
     //cvNamedWindow( "Final", 1 );
-    Mat img,hsv,binary,binary1,imgToProcess;
+    Mat img,imgToProcess;
 
     char* filename = argc >= 2 ? argv[1] : (char*)"59782.png";
 
-    img = imread( filename, 1 );
+    img = cachedImread( filename, 1 );
     imshow("RGB",img);
 
-    //convert RGB image into HSV image
-    cvtColor(img, hsv, CV_BGR2HSV);
-    //imshow("HSV",hsv);
-
-    //get binary image
-    inRange(hsv, Scalar(0, 85, 241), Scalar(18, 255, 255), binary);
-    // imshow("Binary",binary);
-    inRange(hsv, Scalar(171, 0, 0), Scalar(255, 255, 255), binary1);
-
-    //binary.copyTo(binary1);
-    //imshow("Binary1",binary1);
-    add(binary1, binary, imgToProcess, noArray(), 8);
+    //get binary image: the colours of either HSV range, without converting the image
+    static const ColorRangeClassifier red = redRanges();
+    red.classify(img, imgToProcess);
 
     //absdiff(binary1, binary, imgToProcess);
     imshow("Binary2",imgToProcess);
@@ -1,6 +1,9 @@
 #include "opencv2/opencv.hpp"
+#include "burst_capture.hpp"
+#include <iostream>
 
 using namespace cv;
+using namespace std;
 
 int main(int argc, char** argv)
 {
@@ -9,18 +12,26 @@ int main(int argc, char** argv)
     if(!cap.open(0))
         return 0;
 
-    Mat frame[5];
+    int n = argc > 1 ? atoi(argv[1]) : 5; // 30 - 120 for motion analysis
 
-    for(int i=0; i<5; )
-    {
+    BurstCapture burst(n);
+    // the buffers are allocated here, from one frame, not inside the burst
+    if(!burst.prepare(cap))
+        return 0;
 
-        cap >> frame[i];
+    if(!burst.capture(cap))
+        cout << "the camera stopped after " << burst.size() << " frames" << endl;
 
-        if( !frame[i].empty() )
-        {
-            imshow(format("Frame - %d",i), frame[i]);
-            i++;
-        }
+    cout << (burst.backendTimestamps() ? "backend" : "grab") << " timestamps, "
+         << burst.framePeriod() << " ms per frame, " << burst.dropped() << " dropped" << endl;
+    for(size_t i = 0; i < burst.gaps().size(); i++)
+        cout << "  " << burst.gaps()[i].missing << " missing before frame " << burst.gaps()[i].index << endl;
+
+    for(int i=0; i<burst.size() && i<5; i++)
+    {
+        Mat show = burst.frame(i).clone();
+        putText(show, format("%.1f ms", burst.timestamp(i)), Point(10, 30), FONT_HERSHEY_PLAIN, 2, Scalar(0, 255, 0), 2);
+        imshow(format("Frame - %d",i), show);
     }
 
     waitKey();
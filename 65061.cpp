@@ -1,4 +1,6 @@
 #include "qa.hpp"
+#include "image_cache.hpp"
+#include "rle_mask.hpp"
 #include "opencv2/imgproc.hpp"
 #include "opencv2/highgui.hpp"
 
@@ -9,16 +11,16 @@ void step2(Mat src)
 {
     Mat gray;
     cvtColor(src,gray,CV_BGR2GRAY);
-    threshold(gray,gray,200,255,THRESH_BINARY_INV);
+    RleMask mask = RleMask::threshold(gray,200,THRESH_BINARY_INV);
 
-    vector< vector <Point> > contours;
-    vector< Vec4i > hierarchy;
+    // the outer contours of RETR_CCOMP are the 8-connected components: their
+    // bounding rects come from the labeling of the runs, nothing is traced
+    Mat stats, centroids;
+    int n = mask.label( stats, centroids );
 
-    findContours( gray, contours, hierarchy,CV_RETR_CCOMP, CV_CHAIN_APPROX_SIMPLE );
-
-    for( size_t i = 0; i< contours.size(); i=hierarchy[i][0] )
+    for( int i = 1; i < n; i++ )
     {
-        Rect r= boundingRect(contours[i]);
+        Rect r( stats.at<int>(i,CC_STAT_LEFT), stats.at<int>(i,CC_STAT_TOP), stats.at<int>(i,CC_STAT_WIDTH), stats.at<int>(i,CC_STAT_HEIGHT) );
         rectangle(src,Point(r.x,r.y), Point(r.x+r.width,r.y+r.height), Scalar(0,0,255),1,8,0);
 
     }
@@ -34,10 +36,12 @@ int main( int argc, char** argv )
 }
 #endif
 
+QA_DEMO( a65061 )
+
 int a65061( int argc, char** argv )
 {
     char* filename = argc >= 2 ? argv[1] : (char*)"65061.png";
-    Mat src = imread( filename ,1 ),gray,temp;
+    Mat src = cachedImread( filename ,1 ).clone(),gray,temp;
 
     cvtColor(src,gray,CV_BGR2GRAY);
     gray = gray > 127;
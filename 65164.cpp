@@ -2,6 +2,7 @@
 // http://answers.opencv.org/question/65164
 
 #include "qa.hpp"
+#include "image_cache.hpp"
 #include <opencv2/highgui/highgui.hpp>
 #include <opencv2/imgproc/imgproc.hpp>
 
@@ -29,10 +30,13 @@ int main( int argc, char** argv )
 }
 #endif
 
+QA_DEMO( a65164 )
+QA_DEMO( a65164a )
+
 int a65164( int argc, char** argv )
 {
     char* filename = argc >= 2 ? argv[1] : (char*)"65164.png";
-    Mat img = imread(filename);
+    Mat img = cachedImread(filename);
     if (img.empty())
         return -1;
 
@@ -48,7 +52,8 @@ int a65164( int argc, char** argv )
     Mat bw;
     Canny(gray, bw, 0, 50, 5);
 
-    // Find contours
+    // Find contours: Canny leaves many small edge fragments, which one pass of
+    // findContours over the dense map traces faster than RleMask's per component traces
     vector<vector<Point> > contours;
     findContours(bw.clone(), contours, CV_RETR_EXTERNAL, CV_CHAIN_APPROX_SIMPLE);
 
@@ -107,7 +112,7 @@ int a65164( int argc, char** argv )
 int a65164a( int argc, char** argv )
 {
     char* filename = argc >= 2 ? argv[1] : (char*)"65164.png";
-    Mat img = imread(filename);
+    Mat img = cachedImread(filename);
     if (img.empty())
         return -1;
 
@@ -121,7 +126,8 @@ int a65164a( int argc, char** argv )
     Mat bw;
     Canny(gray, bw, 0, 50, 5);
 
-    // Find contours
+    // Find contours: Canny leaves many small edge fragments, which one pass of
+    // findContours over the dense map traces faster than RleMask's per component traces
     vector<vector<Point> > contours;
     findContours(bw.clone(), contours, CV_RETR_EXTERNAL, CV_CHAIN_APPROX_SIMPLE);
 
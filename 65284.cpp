@@ -6,74 +6,100 @@
 #include "opencv2/imgproc.hpp"
 #include "opencv2/imgcodecs.hpp"
 #include "opencv2/highgui.hpp"
+#include "stage_graph.hpp"
+#include <iostream>
 
 using namespace cv;
 using namespace std;
 
 Mat src,gray,small,srcclone;
 int threshval = 25;
+int minHeight = 20;
 
-static void on_trackbar(int, void*)
-{
-
-    Mat bw = threshval < 128 ? (gray < threshval) : (gray > threshval);
-    //imshow( "threshold", bw );
+// stage outputs, kept between trackbar moves
+Mat bw;
+vector<vector<Point> > contours;
 
-    vector<Vec4i> hierarchy;
-    vector<vector<Point> > contours;
+static void on_trackbar(int, void* runner)
+{
+    // only schedules a run; moves made while it runs are coalesced
+    static_cast<AsyncStageRunner*>(runner)->request();
+}
 
-    findContours(bw, contours, hierarchy, CV_RETR_LIST, CV_CHAIN_APPROX_SIMPLE);
-    srcclone=src.clone();
-    Rect minRect;
+int main( int argc, char** argv )
+{
+    char* filename = argc >= 2 ? argv[1] : (char*)"65284.png";
+    src = imread(filename);
+    if(src.empty())
+        return -1;
 
-    for (size_t i = 0; i < contours.size(); ++i)
+    // gray -> threshold -> contours -> draw -> display: moving "Min height" only redraws
+    StageGraph graph;
+    int grayStage = graph.add( "gray", [](const StageGraph&)
     {
-        // Calculate the area of each contour
-        double area = contourArea(contours[i]);
-        // Ignore contours that are too small or too large
-        // if (area < 1e2 || 1e5 < area) continue;
-
-        minRect = boundingRect( Mat(contours[i]) );
-
-        if (minRect.height < 20 ) continue;
+        cvtColor( src, gray, COLOR_BGR2GRAY );
 
-        Scalar color= Scalar(0,255,0);
-
-        if (minRect.height < 50 | minRect.height > minRect.width*2) color= Scalar(0,0,255);
-
-        rectangle( srcclone, minRect,color , 2, 8 );
+// you can try different values below
+        GaussianBlur(gray,gray,Size(5,5),1,1);
+        Mat kernel = Mat::ones(3, 3, CV_8UC1);
+        dilate(gray, gray, kernel);
+    });
 
-        // Draw each contour only for visualisation purposes
-        //  drawContours(srcclone, contours, static_cast<int>(i), Scalar(0, 0, 255), 2, 8, hierarchy, 0);
-    }
+    int thresholdStage = graph.add( "threshold", [](const StageGraph& g)
+    {
+        int t = g.value( &threshval );
+        bw = t < 128 ? (gray < t) : (gray > t);
+    }, { grayStage }, { &threshval } );
 
-    imwrite("result-65284.jpg",srcclone);
-    resize(srcclone,small,Size(src.cols/2,src.rows/2)); // resize image to fit display
+    int contoursStage = graph.add( "contours", [](const StageGraph&)
+    {
+        vector<Vec4i> hierarchy;
+        findContours(bw.clone(), contours, hierarchy, CV_RETR_LIST, CV_CHAIN_APPROX_SIMPLE);
+    }, { thresholdStage } );
 
-    imshow( "Display Window", small );
-}
+    int drawStage = graph.add( "draw", [](const StageGraph& g)
+    {
+        srcclone=src.clone();
+        Rect minRect;
 
+        for (size_t i = 0; i < contours.size(); ++i)
+        {
+            minRect = boundingRect( Mat(contours[i]) );
 
-int main( int argc, char** argv )
-{
-    char* filename = argc >= 2 ? argv[1] : (char*)"65284.png";
-    src = imread(filename);
-    if(src.empty())
-        return -1;
+            if (minRect.height < g.value( &minHeight ) ) continue;
 
-    cvtColor( src, gray, COLOR_BGR2GRAY );
+            Scalar color= Scalar(0,255,0);
 
+            if (minRect.height < 50 | minRect.height > minRect.width*2) color= Scalar(0,0,255);
 
-// you can try different values below
-    GaussianBlur(gray,gray,Size(5,5),1,1);
-    Mat kernel = Mat::ones(3, 3, CV_8UC1);
-    dilate(gray, gray, kernel);
+            rectangle( srcclone, minRect,color , 2, 8 );
+        }
+    }, { contoursStage }, { &minHeight } );
 
+    graph.add( "display", [](const StageGraph&)
+    {
+        resize(srcclone,small,Size(src.cols/2,src.rows/2)); // resize image to fit display
+    }, { drawStage } );
 
-    namedWindow( "Display Window", 1 );
-    createTrackbar( "Threshold", "Display Window", &threshval, 127, on_trackbar );
-    on_trackbar(threshval, 0);
+    {
+        AsyncStageRunner runner( graph, small );
+
+        namedWindow( "Display Window", 1 );
+        createTrackbar( "Threshold", "Display Window", &threshval, 127, on_trackbar, &runner );
+        createTrackbar( "Min height", "Display Window", &minHeight, 200, on_trackbar, &runner );
+        runner.request();
+
+        Mat shown;
+        for (;;)
+        {
+            if( runner.fetch( shown ) )
+                imshow( "Display Window", shown );
+            if( waitKey( 30 ) == 27 )
+                break;
+        }
+    } // waits for the worker
 
-    waitKey(0);
+    imwrite("result-65284.jpg",srcclone);
+    graph.printStats( cout );
     return 0;
 }
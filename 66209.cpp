@@ -1,6 +1,8 @@
 #include "qa.hpp"
+#include "image_cache.hpp"
 #include "opencv2/imgproc.hpp"
 #include "opencv2/highgui.hpp"
+#include "stage_graph.hpp"
 
 using namespace cv;
 
@@ -16,28 +18,36 @@ int main( int argc, char** argv )
 }
 #endif
 
+QA_DEMO( a66209 )
+
 int a66209( int argc, char** argv )
 {
 
 
-// Callback function for trackbar event
-    TrackbarCallback on_trackbar = [](int , void *)
+    // the resize runs off the GUI thread, slider moves made meanwhile are coalesced
+    Mat img_converted;
+    StageGraph graph;
+    graph.add( "resize", [&img_converted](const StageGraph& g)
     {
         // here's the main gotcha:
         // int(10)/int(100) == 0 !
         // we have to cast to float, to avoid the problem with integer division !
         // also, scale should never become 0, so add a minimum value of 1:
-        float scale = float(slider+1)/100;
+        float scale = float(g.value(&slider)+1)/100;
 
-        Mat img_converted;
         Size s(img66209.size().width*scale, img66209.size().height*scale);
         resize(img66209, img_converted, s);
-        imshow("Scaled", img_converted);
+    }, {}, { &slider } );
+
+// Callback function for trackbar event
+    TrackbarCallback on_trackbar = [](int , void *runner)
+    {
+        static_cast<AsyncStageRunner*>(runner)->request();
     };
 
     char* filename = argc >= 2 ? argv[1] : (char*)"23910.jpg";
 
-    img66209 = imread( filename );
+    img66209 = cachedImread( filename );
     namedWindow("Trackbar app", 0 );
 
     // better start with a nice value (not 0)
@@ -45,12 +55,20 @@ int a66209( int argc, char** argv )
 
     // trick: put the trackbar in its own window,
     // it really sucks, if it has to resize along with the image !!
-    createTrackbar("Size", "Trackbar app", &slider, slider_max, on_trackbar);
+    AsyncStageRunner runner( graph, img_converted );
+    createTrackbar("Size", "Trackbar app", &slider, slider_max, on_trackbar, &runner);
 
     // make it show without having to move the trackbar initially:
-    on_trackbar(0,0);
+    on_trackbar(0,&runner);
 
-    // just wait forever. (no loop nessecary)
-    waitKey();
+    // show the results as they come, until a key is pressed
+    Mat shown;
+    for (;;)
+    {
+        if (runner.fetch(shown))
+            imshow("Scaled", shown);
+        if (waitKey(30) >= 0)
+            break;
+    }
     return 0;
 }
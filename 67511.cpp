@@ -8,18 +8,40 @@ int main(int, char**)
     if(!cap.isOpened())  // check if we succeeded
         return -1;
 
-    for(;;)
-    {
-        Mat frame;
-        cap >> frame; // get a new frame from camera
+    const int border = 50; // here you can widen your image
 
-        Mat image;
-        copyMakeBorder(frame, image, 50, 0, 0, 0, BORDER_CONSTANT); // here you can widen your image
+    // the image is allocated once: a band for the text above a view of the frame.
+    // read() copies into the view as long as its size and type match, so the border
+    // needs no copyMakeBorder and no new image per frame
+    Mat first;
+    cap >> first;
+    if(first.empty())
+        return -1;
+    Mat image(first.rows + border, first.cols, first.type(), Scalar::all(0));
+    Mat frame = image(Rect(0, border, first.cols, first.rows));
+    first.copyTo(frame);
+    Mat header = image(Rect(0, 0, image.cols, border));
+    uchar* canvas = frame.data;
 
+    for(;;)
+    {
+        header.setTo(Scalar::all(0)); // only the text band is redrawn
         putText(image,format("frame dimensions : %d x %d",frame.cols,frame.rows),Point(10, 20),FONT_HERSHEY_PLAIN, 1, Scalar::all(255));
         putText(image,format("image dimensions : %d x %d",image.cols,image.rows),Point(10, 40),FONT_HERSHEY_PLAIN, 1, Scalar::all(255));
         imshow("copyMakeBorder example", image);
         if(waitKey(30) >= 0) break;
+
+        if(!cap.read(frame)) // get a new frame from camera, straight into the image
+            break;
+        if(frame.data != canvas) // the camera changed its format: a new image around it
+        {
+            image.create(frame.rows + border, frame.cols, frame.type());
+            Mat view = image(Rect(0, border, frame.cols, frame.rows));
+            frame.copyTo(view);
+            frame = view;
+            header = image(Rect(0, 0, image.cols, border));
+            canvas = frame.data;
+        }
     }
     // the camera will be deinitialized automatically in VideoCapture destructor
     return 0;
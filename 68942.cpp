@@ -1,4 +1,6 @@
 #include "qa.hpp"
+#include "image_cache.hpp"
+#include "tile_scheduler.hpp"
 #include "opencv2/highgui/highgui.hpp"
 #include "opencv2/imgproc/imgproc.hpp"
 
@@ -11,6 +13,8 @@ int main( int argc, char** argv )
 }
 #endif
 
+QA_DEMO( a68942 )
+
 int a68942( int argc, char** argv )
 {
 
@@ -21,37 +25,24 @@ for( int i=0; i < 5; i++)
 {
 char* filename = argc >= 2 ? argv[1] : (char*)"fruits.jpg";
 
-Mat img = imread( filename );
+Mat img = cachedImread( filename );
 
-Mat roi1 =img(Rect( 0, 0, img.cols/2, img.rows/2)).clone();
-Mat roi2 =img(Rect( img.cols/2, 0, img.cols/2, img.rows/2)).clone();
-Mat roi3 =img(Rect( 0, img.rows/2, img.cols/2, img.rows/2)).clone();
-Mat roi4 =img(Rect( img.cols/2, img.rows/2, img.cols/2, img.rows/2)).clone();
+// the four quadrants resized on their own, straight from views of img into views of
+// quads: no clone() of a quadrant and no copy of a resized one. The quadrants are
+// rounded up, so an odd middle row or column goes to the first half instead of
+// making a one pixel third tile.
+Mat quads( img.rows/2, img.cols/2, img.type() );
+TileScheduler quadrants( Size( (img.cols+1)/2, (img.rows+1)/2 ) );
+quadrants.run( img, quads, [i]( const Mat& s, Mat& d, const Tile& ) { resize( s, d, d.size(), 0, 0, i ); } );
 
 resize( img, img, Size( img.cols/2, img.rows/2 ),0,0, i);
 
-resize( roi1, roi1, Size( roi1.cols/2, roi1.rows/2 ),0,0, i);
-resize( roi2, roi2, Size( roi2.cols/2, roi2.rows/2 ),0,0, i);
-resize( roi3, roi3, Size( roi3.cols/2, roi3.rows/2 ),0,0, i);
-resize( roi4, roi4, Size( roi4.cols/2, roi4.rows/2 ),0,0, i);
-
-Mat rroi1 =img(Rect( 0, 0, img.cols/2, img.rows/2));
-Mat rroi2 =img(Rect( img.cols/2, 0, img.cols/2, img.rows/2));
-Mat rroi3 =img(Rect( 0, img.rows/2, img.cols/2, img.rows/2));
-Mat rroi4 =img(Rect( img.cols/2, img.rows/2, img.cols/2, img.rows/2));
-
-rroi1 = rroi1 - roi1;
-rroi2 = rroi2 - roi2;
-rroi3 = rroi3 - roi3;
-rroi4 = rroi4 - roi4;
+img = img - quads;
 
 img = img > 0;
 imshow(InterpolationFlags[i],img);
 moveWindow(InterpolationFlags[i],i*240,20);
-//imshow("roi1",roi1);
-//imshow("roi2",roi2);
-//imshow("roi3",roi3);
-//imshow("roi4",roi4);
+//imshow("quads",quads);
 
 }
 waitKey(0);
@@ -3,38 +3,11 @@
 #include <iostream>
 #include <opencv2/highgui.hpp>
 #include <opencv2/imgproc.hpp>
+#include "point_distances.hpp"
 
 using namespace cv;
 using namespace std;
 
-// calculates distance between two points
-static double distanceBtwPoints(const cv::Point a, const cv::Point b)
-{
-    double xDiff = a.x - b.x;
-    double yDiff = a.y - b.y;
-
-    return std::sqrt((xDiff * xDiff) + (yDiff * yDiff));
-}
-
-static int findNearestPointIndex(const cv::Point pt, const vector<Point> points)
-{
-    int nearestpointindex = 0;
-    double distance;
-    double mindistance = 1e+9;
-
-    for ( size_t i = 0; i < points.size(); i++)
-    {
-        distance = distanceBtwPoints(pt,points[i]);
-
-        if( distance < mindistance )
-        {
-            mindistance =  distance;
-            nearestpointindex = i;
-        }
-    }
-    return nearestpointindex;
-}
-
 int main( int argc, char** argv )
 {
     Point pt0;
@@ -68,14 +41,21 @@ int main( int argc, char** argv )
 
     }
 
+    // built once, all the points of a contour are matched in one batch query
+    PointGrid grid(contour);
+    vector<Point2f> queries;
+    vector<int> nearest;
+
     for ( size_t i = 0; i < contours.size(); i++)
     {
         if( contour != contours[i] && contours[i].size() > 10 )
         {
+            queries.assign(contours[i].begin(), contours[i].end());
+            grid.nearest(queries, nearest);
             for ( size_t j = 0; j <  contours[i].size(); j++)
             {
                 pt0 = contours[i][j];
-                line(src,pt0,contour[findNearestPointIndex(pt0,contour)],color,1,LINE_8,shift);
+                line(src,pt0,contour[nearest[j]],color,1,LINE_8,shift);
             }
         }
     }
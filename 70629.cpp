@@ -1,6 +1,7 @@
 
 #include <opencv2/highgui.hpp>
 #include <opencv2/imgproc.hpp>
+#include "point_distances.hpp"
 
 using namespace cv;
 using namespace std;
@@ -10,33 +11,6 @@ Point pt0,pt1;
 int shift=0; // optional value for drawing scaled
 Scalar color = Scalar(0,0,0);
 
-// calculates distance between two points
-static double distanceBtwPoints(const cv::Point a, const cv::Point b)
-{
-    double xDiff = a.x - b.x;
-    double yDiff = a.y - b.y;
-
-    return std::sqrt((xDiff * xDiff) + (yDiff * yDiff));
-}
-
-static int findNearestPointIndex(const cv::Point pt, const vector<Point> points)
-{
-    int nearestpointindex = 0;
-    double distance;
-    double mindistance = 1e+9;
-
-    for ( size_t i = 0; i < points.size(); i++)
-    {
-        distance = distanceBtwPoints(pt,points[i]);
-
-        if( distance < mindistance )
-        {
-            mindistance =  distance;
-            nearestpointindex = i;
-        }
-    }
-    return nearestpointindex;
-}
 // draws point vector on given image
 int static drawPoints( vector<Point> source_points,int start_index,int end_index, Mat m )
 {
@@ -108,6 +82,9 @@ int main( int argc, char** argv )
 
     src = Scalar(255,255,255); // clears source image to redraw
 
+    // built once, every nearest point query below is a few grid cells
+    PointGrid grid(contour);
+
     for ( size_t i = 0; i < contours.size(); i++)
     {
         if( contour != contours[i] && contours[i].size() > 10 )
@@ -127,8 +104,8 @@ int main( int argc, char** argv )
                 pt0 = contours[i][0];
 
             // find nearest points of closed contour
-            int nearestpointindex_start = findNearestPointIndex(pt0,contour);
-            int nearestpointindex_end = findNearestPointIndex(pt1,contour);
+            int nearestpointindex_start = grid.nearest(pt0);
+            int nearestpointindex_end = grid.nearest(pt1);
 
             // redrawing
             line(src,pt1,contour[nearestpointindex_end],color,1,LINE_8,shift);
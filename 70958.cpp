@@ -1,23 +1,12 @@
 
 #include "opencv2/imgproc.hpp"
 #include "opencv2/highgui.hpp"
+#include "square_detector.hpp"
 #include <iostream>
 
 using namespace cv;
 using namespace std;
 
-// helper function:
-// finds a cosine of angle between vectors
-// from pt0->pt1 and from pt0->pt2
-static double angle( Point pt1, Point pt2, Point pt0 )
-{
-    double dx1 = pt1.x - pt0.x;
-    double dy1 = pt1.y - pt0.y;
-    double dx2 = pt2.x - pt0.x;
-    double dy2 = pt2.y - pt0.y;
-    return (dx1*dx2 + dy1*dy2)/sqrt((dx1*dx1 + dy1*dy1)*(dx2*dx2 + dy2*dy2) + 1e-10);
-}
-
 static void drawSquares( Mat& image, const vector<vector<Point> >& squares )
 {
     for( size_t i = 0; i < squares.size(); i++ )
@@ -95,8 +84,10 @@ static void findSquares( const Mat& image, vector<vector<Point> >& squares , boo
 
 }
 
-int main()
+int main( int argc, char** argv )
 {
+    // --full runs the original findSquares() on every full size frame
+    bool full = argc > 1 && string( argv[1] ) == "--full";
     VideoCapture cap(0);
 
     if (!cap.isOpened())
@@ -106,6 +97,8 @@ int main()
 
     Mat frame;
     vector<vector<Point> > squares;
+    SquareDetector detector;
+    TickMeter tm;
 
     for (;;)
     {
@@ -115,8 +108,15 @@ int main()
         {
             return -1;
         }
-        findSquares(frame, squares);
+        tm.start();
+        if( full )
+            findSquares(frame, squares);
+        else
+            detector.detect(frame, squares);
+        tm.stop();
         drawSquares(frame, squares);
+        putText(frame, format("%.1f ms%s", tm.getTimeMilli() / tm.getCounter(), detector.reused() ? " (reused)" : ""),
+                Point(10, 30), FONT_HERSHEY_SIMPLEX, 0.8, Scalar(0, 255, 0), 2);
         imshow("Rubic Detection Demo", frame);
         waitKey(1);
     }
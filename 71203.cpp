@@ -2,6 +2,7 @@
 #include <opencv2/highgui/highgui.hpp>
 #include <opencv2/imgproc/imgproc.hpp>
 
+#include <algorithm>
 #include <iostream>
 
 using namespace std;
@@ -15,26 +16,119 @@ Mat image,blurredImage;
 
 vector<Rect> blurredAreas;
 
-static bool doMosaic( Mat img, int msize)
+// Pixelation from one integral image of the source. Blocks sit on a grid aligned to
+// the image origin, so overlapping areas agree and an area can be rendered again on
+// its own. Every pixel of "area" gets the mean of its block (clipped to the image).
+class MosaicBody : public ParallelLoopBody
 {
-    for (int i = 0; i < img.cols-msize; i+=msize)
-        for(int j = 0; j < img.rows-msize; j+=msize)
+public:
+    MosaicBody(const Mat& _sum, Mat& _dst, Rect _area, int _msize)
+        : sum(_sum), dst(_dst), area(_area), msize(_msize) {}
+
+    void operator()(const Range& range) const
+    {
+        const int cn = dst.channels();
+        int mean[4];
+        int bx0 = area.x / msize, bx1 = (area.br().x - 1) / msize;
+        for (int by = range.start; by < range.end; by++)
         {
-            Rect r = Rect(i,j,msize,msize);
-            Mat mosaic = img( r );
-            mosaic.setTo(mean(mosaic));
+            int y0 = by * msize, y1 = std::min(y0 + msize, dst.rows);
+            int wy0 = std::max(y0, area.y), wy1 = std::min(y1, area.br().y);
+            const int* top = sum.ptr<int>(y0);
+            const int* bottom = sum.ptr<int>(y1);
+            for (int bx = bx0; bx <= bx1; bx++)
+            {
+                int x0 = bx * msize, x1 = std::min(x0 + msize, dst.cols);
+                int n = (x1 - x0) * (y1 - y0);
+                for (int c = 0; c < cn; c++)
+                {
+                    int s = bottom[x1 * cn + c] - bottom[x0 * cn + c] - top[x1 * cn + c] + top[x0 * cn + c];
+                    mean[c] = (s + n / 2) / n;
+                }
+                int wx0 = std::max(x0, area.x), wx1 = std::min(x1, area.br().x);
+                for (int y = wy0; y < wy1; y++)
+                {
+                    uchar* d = dst.ptr(y) + wx0 * cn;
+                    for (int x = wx0; x < wx1; x++, d += cn)
+                        for (int c = 0; c < cn; c++)
+                            d[c] = (uchar)mean[c];
+                }
+            }
         }
-    return true;
+    }
+
+private:
+    const Mat& sum;
+    Mat& dst;
+    Rect area;
+    int msize;
+};
+
+// sum: integral( src, sum, CV_32S ) of the 8 bit image dst was made from
+static void doMosaic(const Mat& sum, Mat& dst, Rect area, int msize)
+{
+    area &= Rect(0, 0, dst.cols, dst.rows);
+    if (area.empty())
+        return;
+    parallel_for_(Range(area.y / msize, (area.br().y - 1) / msize + 1), MosaicBody(sum, dst, area, msize));
 }
 
-static bool doBlur()
+// Keeps the pixelated image up to date with a list of areas. render() only touches
+// what changed since the previous call: removed areas are restored from the source
+// (and the areas overlapping them drawn again), new areas are drawn; a new image or
+// block size redraws everything.
+class Pixelator
 {
-    for(size_t i = 0; i< blurredAreas.size(); i++)
+public:
+    Pixelator() : msize(5), rendered(-1) {}
+
+    void setImage(const Mat& img)
+    {
+        CV_Assert(img.depth() == CV_8U && img.channels() <= 4);
+        source = img;
+        integral(source, sum, CV_32S);   // fine below 2^31 / 255 pixels
+        source.copyTo(result);
+        drawn.clear();
+    }
+
+    void setBlockSize(int size) { msize = std::max(1, size); }
+
+    const Mat& render(const vector<Rect>& areas)
     {
-        Mat roi = blurredImage(selection);
-        //GaussianBlur(roi,roi,Size(),5,5);
-        doMosaic(roi,msize);
+        if (rendered != msize)
+        {
+            source.copyTo(result);
+            drawn.clear();
+            rendered = msize;
+        }
+        for (size_t i = 0; i < drawn.size(); i++)
+        {
+            if (std::find(areas.begin(), areas.end(), drawn[i]) != areas.end())
+                continue;
+            Rect gone = drawn[i] & Rect(0, 0, result.cols, result.rows);
+            source(gone).copyTo(result(gone));
+            for (size_t j = 0; j < areas.size(); j++)
+                doMosaic(sum, result, areas[j] & gone, msize);
+        }
+        for (size_t j = 0; j < areas.size(); j++)
+            if (std::find(drawn.begin(), drawn.end(), areas[j]) == drawn.end())
+                doMosaic(sum, result, areas[j], msize);
+        drawn = areas;
+        return result;
     }
+
+private:
+    Mat source, sum, result;
+    int msize, rendered;
+    vector<Rect> drawn;
+};
+
+Pixelator pixelator;
+
+static bool doBlur()
+{
+    pixelator.setBlockSize(msize);
+    blurredImage = pixelator.render(blurredAreas);
     imshow("Demo", blurredImage);
     return true;
 }
@@ -82,6 +176,9 @@ int main( int argc, char** argv )
 {
     char* filename = argc >= 2 ? argv[1] : (char*)"fruits.jpg";
     image = imread(filename);
+    if (image.empty())
+        return -1;
+    pixelator.setImage(image);
     image.copyTo(blurredImage);
 
     namedWindow("Demo");
@@ -104,21 +201,18 @@ int main( int argc, char** argv )
         if( key == 'i' ) // space key for clear blurred areas
         {
             msize +=5;
-            image.copyTo(blurredImage);
             doBlur();
         }
 
         if( key == 'd' ) // space key for clear blurred areas
         {
             msize = msize == 5 ? 5 : msize - 5;
-            image.copyTo(blurredImage);
             doBlur();
         }
 
         if( key == 32 ) // space key for clear blurred areas
         {
             blurredAreas.clear();
-            image.copyTo(blurredImage);
             doBlur();
         }
     }
@@ -1,71 +1,8 @@
 #include <iostream>
 #include <opencv2/imgproc.hpp>
 #include <opencv2/highgui.hpp>
+#include "perf_stages.hpp"
 
-class TickMeter
-{
-public:
-    TickMeter();
-    void start();
-    void stop();
-
-    int64 getTimeTicks() const;
-    double getTimeMicro() const;
-    double getTimeMilli() const;
-    double getTimeSec()   const;
-    int64 getCounter() const;
-
-    void reset();
-private:
-    int64 counter;
-    int64 sumTime;
-    int64 startTime;
-};
-
-TickMeter::TickMeter()
-{
-    reset();
-}
-int64 TickMeter::getTimeTicks() const
-{
-    return sumTime;
-}
-double TickMeter::getTimeMicro() const
-{
-    return  getTimeMilli()*1e3;
-}
-double TickMeter::getTimeMilli() const
-{
-    return getTimeSec()*1e3;
-}
-double TickMeter::getTimeSec() const
-{
-    return (double)getTimeTicks()/cv::getTickFrequency();
-}
-int64 TickMeter::getCounter() const
-{
-    return counter;
-}
-void TickMeter::reset()
-{
-    startTime = 0;
-    sumTime = 0;
-    counter = 0;
-}
-
-void TickMeter::start()
-{
-    startTime = cv::getTickCount();
-}
-void TickMeter::stop()
-{
-    int64 time = cv::getTickCount();
-    if ( startTime == 0 )
-        return;
-    ++counter;
-    sumTime += ( time - startTime );
-    startTime = 0;
-}
 
 int main(int argc, char**argv)
 {
@@ -92,29 +29,40 @@ int main(int argc, char**argv)
 
     cv::Mat frame;
     int c;
-    TickMeter tm;
+    perf::PeriodicReport report(5.0, argc > 2 ? argv[2] : "");
+    perf::StageStats loop = perf::StageStats();
 
     do
     {
-        tm.stop();
-        tm.start();
-        capture.read(frame);
+        PERF_STAGE("frame");
+        {
+            PERF_STAGE("grab");
+            capture.read(frame);
+        }
 
         if( frame.empty() )
         {
             break;
         }
 
-        if(tm.getCounter() > 0)
+        // collecting takes the registry lock and merges every thread's histograms: once per report
+        if(loop.count == 0 || report.due())
+            loop = perf::stats("frame");
+        if(loop.count > 0)
         {
-            cv::putText(frame, cv::format("Average FPS=%d",cvRound( tm.getCounter()/tm.getTimeSec())), cv::Point(30, 30), cv::FONT_HERSHEY_SIMPLEX, 0.8, cv::Scalar(0,0,255));
+            PERF_STAGE("draw");
+            cv::putText(frame, cv::format("Average FPS=%d p95=%.1fms",cvRound( loop.fps() ), loop.p95_ms), cv::Point(30, 30), cv::FONT_HERSHEY_SIMPLEX, 0.8, cv::Scalar(0,0,255));
         }
 
-        cv::imshow("Video Capture Test", frame);
-
-        c = cv::waitKey(1);
+        {
+            PERF_STAGE("show");
+            cv::imshow("Video Capture Test", frame);
+            c = cv::waitKey(1);
+        }
+        report.tick();
     }
     while(c != 27);
 
+    perf::printReport(std::cout);
     return 0;
 }
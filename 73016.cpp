@@ -3,38 +3,159 @@
 
 #include "opencv2/imgproc.hpp"
 #include "opencv2/highgui.hpp"
+#include "opencv2/core/hal/intrin.hpp"
+#include "pixel_kernels.hpp"
+#include <iostream>
 
 using namespace cv;
 using namespace std;
 
-void overlayImage(Mat* src, Mat* overlay, const Point& location)
+// An 8 bit BGRA overlay with its colour premultiplied by alpha, ready to be blended
+// many times: dst = colour + dst * (255 - alpha) / 255, all in integers.
+class Sprite
 {
-    for (int y = max(location.y, 0); y < src->rows; ++y)
-    {
-        int fY = y - location.y;
-
-        if (fY >= overlay->rows)
-            break;
+public:
+    Sprite() {}
+    explicit Sprite(const Mat& bgra) { set(bgra); }
 
-        for (int x = max(location.x, 0); x < src->cols; ++x)
+    void set(const Mat& bgra)
+    {
+        CV_Assert(bgra.type() == CV_8UC4);
+        pixelkernel::forEachPixel<Vec4b, Vec4b>(bgra, premultiplied, [](const Vec4b& s)
         {
-            int fX = x - location.x;
+            int a = s[3];
+            return Vec4b(div255(s[0] * a), div255(s[1] * a), div255(s[2] * a), (uchar)a);
+        });
+    }
 
-            if (fX >= overlay->cols)
-                break;
+    Size size() const { return premultiplied.size(); }
+    const Mat& data() const { return premultiplied; }
 
-            double opacity = ((double)overlay->data[fY * overlay->step + fX * overlay->channels() + 3]) / 255;
+    // x / 255 rounded, exact for 0 <= x <= 255 * 255
+    static uchar div255(int x) { x += 128; return (uchar)((x + (x >> 8)) >> 8); }
 
-            for (int c = 0; opacity > 0 && c < src->channels(); ++c)
+private:
+    Mat premultiplied;
+};
+
+// blends n premultiplied BGRA pixels over n dst pixels of cn (3 or 4) channels; a 4th
+// dst channel gets the usual "over" alpha, a + dst_a * (255 - a) / 255
+template<int cn> static void blendRow(uchar* d, const uchar* p, int n)
+{
+    int x = 0;
+#if CV_SIMD128
+    v_uint8x16 zero = v_setzero_u8(), full = v_setall_u8(255);
+    v_uint16x8 half = v_setall_u16(128);
+    for (; x <= n - 16; x += 16, p += 64, d += 16 * cn)
+    {
+        v_uint8x16 pb, pg, pr, pa;
+        v_load_deinterleave(p, pb, pg, pr, pa);
+        if (v_check_all(pa == zero))
+            continue;           // transparent, dst unchanged
+        v_uint8x16 db, dg, dr, da;
+        if (cn == 4)
+            v_load_deinterleave(d, db, dg, dr, da);
+        else
+            v_load_deinterleave(d, db, dg, dr);
+        if (v_check_all(pa == full))
+        {
+            db = pb; dg = pg; dr = pr; da = pa;  // opaque, premultiplied colour is the colour
+        }
+        else
+        {
+            v_uint16x8 inv0, inv1;
+            v_expand(full - pa, inv0, inv1);
+            v_uint8x16* ch[4] = { &db, &dg, &dr, &da };
+            const v_uint8x16 src[4] = { pb, pg, pr, pa };
+            for (int c = 0; c < cn; c++)
             {
-                unsigned char overlayPx = overlay->data[fY * overlay->step + fX * overlay->channels() + c];
-                unsigned char srcPx = src->data[y * src->step + x * src->channels() + c];
-                src->data[y * src->step + src->channels() * x + c] = srcPx * (1. - opacity) + overlayPx * opacity;
+                v_uint16x8 d0, d1;
+                v_expand(*ch[c], d0, d1);
+                d0 = d0 * inv0 + half;
+                d1 = d1 * inv1 + half;
+                d0 = (d0 + (d0 >> 8)) >> 8;
+                d1 = (d1 + (d1 >> 8)) >> 8;
+                *ch[c] = src[c] + v_pack(d0, d1);   // saturating, never above 255 anyway
             }
         }
+        if (cn == 4)
+            v_store_interleave(d, db, dg, dr, da);
+        else
+            v_store_interleave(d, db, dg, dr);
+    }
+#endif
+    for (; x < n; x++, p += 4, d += cn)
+    {
+        int a = p[3];
+        if (a == 0)
+            continue;
+        if (a == 255)
+        {
+            for (int c = 0; c < cn; c++)
+                d[c] = p[c];
+            continue;
+        }
+        for (int c = 0; c < cn; c++)
+            d[c] = (uchar)(p[c] + Sprite::div255(d[c] * (255 - a)));
     }
 }
 
+// part of the sprite placed at location that falls inside rows [rowStart, rowEnd) of dst
+static void compositeRows(Mat& dst, const Sprite& sprite, Point location, int rowStart, int rowEnd)
+{
+    Rect r = Rect(location, sprite.size()) & Rect(0, rowStart, dst.cols, rowEnd - rowStart);
+    if (r.empty())
+        return;
+    // the channel count picked once, the row loops are compiled for it
+    int cn = dst.channels();
+    void (*blend)(uchar*, const uchar*, int) = cn == 4 ? blendRow<4> : blendRow<3>;
+    const Mat& p = sprite.data();
+    for (int y = r.y; y < r.br().y; y++)
+        blend(dst.ptr(y) + r.x * cn, p.ptr(y - location.y) + (r.x - location.x) * 4, r.width);
+}
+
+void composite(Mat& dst, const Sprite& sprite, Point location)
+{
+    CV_Assert(dst.depth() == CV_8U && (dst.channels() == 3 || dst.channels() == 4));
+    compositeRows(dst, sprite, location, 0, dst.rows);
+}
+
+// Many sprites into one frame. The frame is cut into bands of rows and every band
+// blends all the sprites crossing it, in order, so the result is the same as calling
+// composite() for each sprite in turn, and no two threads touch the same pixel.
+class CompositeBody : public ParallelLoopBody
+{
+public:
+    CompositeBody(Mat& _dst, const vector<Sprite>& _sprites, const vector<Point>& _locations, int _bandRows)
+        : dst(_dst), sprites(_sprites), locations(_locations), bandRows(_bandRows) {}
+
+    void operator()(const Range& range) const
+    {
+        int rowStart = range.start * bandRows, rowEnd = std::min(range.end * bandRows, dst.rows);
+        for (size_t i = 0; i < sprites.size(); i++)
+            compositeRows(dst, sprites[i], locations[i], rowStart, rowEnd);
+    }
+
+private:
+    Mat& dst;
+    const vector<Sprite>& sprites;
+    const vector<Point>& locations;
+    int bandRows;
+};
+
+void composite(Mat& dst, const vector<Sprite>& sprites, const vector<Point>& locations)
+{
+    CV_Assert(dst.depth() == CV_8U && (dst.channels() == 3 || dst.channels() == 4));
+    CV_Assert(sprites.size() == locations.size());
+    const int bandRows = 32;
+    parallel_for_(Range(0, (dst.rows + bandRows - 1) / bandRows), CompositeBody(dst, sprites, locations, bandRows));
+}
+
+void overlayImage(Mat* src, Mat* overlay, const Point& location)
+{
+    composite(*src, Sprite(*overlay), location);
+}
+
 int main( int argc, char** argv )
 {
     Mat underlay = imread("73016b.png",IMREAD_UNCHANGED);
@@ -66,6 +187,23 @@ int main( int argc, char** argv )
     merge(rgba, underlay);
     overlayImage( &test, &underlay, Point(120,180) );
 
+    // a HUD: the same icon many times over a 1080p frame
+    Mat frame(1080, 1920, CV_8UC3, Scalar(40, 40, 40));
+    Sprite icon(underlay);
+    vector<Sprite> sprites;
+    vector<Point> locations;
+    for (int i = 0; i < 48; i++)
+    {
+        sprites.push_back(icon);
+        locations.push_back(Point((i % 8) * 240 - 40, (i / 8) * 180 - 30));
+    }
+    TickMeter tm;
+    tm.start();
+    composite(frame, sprites, locations);
+    tm.stop();
+    cout << sprites.size() << " sprites composited in " << tm.getTimeMilli() << " ms" << endl;
+    imshow("hud", frame);
+
     imshow("result1",underlay);
     imwrite("result1.png",underlay);
     imshow("result2",test);
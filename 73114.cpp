@@ -1,26 +1,26 @@
 #include "opencv2/highgui/highgui.hpp"
 #include "opencv2/imgproc/imgproc.hpp"
+#include "channel_remap.hpp"
 
 using namespace cv;
 
 int main( int, char** argv )
 {
     Mat image(400, 400, CV_8UC4, Scalar(0, 0, 200));
-    Mat rgba[4];
-    split(image,rgba);
+    // the alpha channel is drawn on its own and put back in place
+    Mat alpha(image.size(), CV_8UC1, Scalar(0));
 
-    rectangle(rgba[3],Rect(100,100,200,200),Scalar(255),-1);
+    rectangle(alpha,Rect(100,100,200,200),Scalar(255),-1);
 
-    merge(rgba,4,image);
+    ChannelMap(4).from(0,0).from(1,1).from(2,2).plane(3,alpha).apply(image,image);
     imwrite("transparent1.png",image);
 
-    rectangle(rgba[3],Rect(150,150,100,100),Scalar(127),-1);
-    merge(rgba,4,image);
+    rectangle(alpha,Rect(150,150,100,100),Scalar(127),-1);
+    ChannelMap(4).from(0,0).from(1,1).from(2,2).plane(3,alpha).apply(image,image);
     imwrite("transparent2.png",image);
 
-    rgba[3] = rgba[3] * 0.5; // here you can change transparency
-
-    merge(rgba,4,image);
+    // here you can change transparency
+    ChannelMap(4).from(0,0).from(1,1).from(2,2).plane(3,alpha,0.5).apply(image,image);
     imwrite("transparent3.png",image);
 
     waitKey(0);
@@ -6,6 +6,9 @@ using namespace std;
 typedef Vec<float,5> Vec5f;
 
 #include <fstream>
+#include <algorithm>
+#include <vector>
+#include <stdint.h>
 #define SPARSEBINARY
 
 bool write2d(const char *fn, SparseMat &m)
@@ -76,6 +79,160 @@ bool read2d(const char *fn, SparseMat &m)
     return true;
 }
 
+// ----------------------------------------------------------------------------------
+// Bulk format: only the stored nodes are visited, sorted by (row, col) and written in
+// blocks of up to SPARSE_BLOCK nonzeros, one write() per block. Inside a block the
+// indices are delta coded as varints (row step, then column step from the previous
+// column of the same row, or from 0 on a new row) and the values follow raw. Works for
+// any 2d SparseMat type.
+//
+//   header: "SPMAT\0\0\0", int32 version, type, rows, cols, int64 nnz
+//   block:  uint32 count, uint32 indexBytes, indexBytes of varints, count * elemSize values
+
+static const char SPARSE_MAGIC[8] = { 'S', 'P', 'M', 'A', 'T', 0, 0, 0 };
+static const int SPARSE_VERSION = 1;
+static const int SPARSE_BLOCK = 1 << 16;
+
+struct SparseEntry
+{
+    int i, j;
+    const uchar* value;
+    bool operator<(const SparseEntry& e) const { return i < e.i || (i == e.i && j < e.j); }
+};
+
+static inline void putVarint(vector<uchar>& buf, uint32_t v)
+{
+    while (v >= 0x80)
+    {
+        buf.push_back((uchar)(v | 0x80));
+        v >>= 7;
+    }
+    buf.push_back((uchar)v);
+}
+
+static inline uint32_t getVarint(const uchar*& p, const uchar* end)
+{
+    uint32_t v = 0;
+    for (int shift = 0; p < end && shift < 35; shift += 7)
+    {
+        uchar b = *p++;
+        v |= (uint32_t)(b & 0x7f) << shift;
+        if (!(b & 0x80))
+            break;
+    }
+    return v;
+}
+
+bool writeSparse(const char *fn, const SparseMat &m)
+{
+    CV_Assert(m.dims() == 2);
+    ofstream s(fn, ios::out | ios::binary);
+    if (!s) return false;
+
+    // nodes in hash order, then sorted, the dense index space is never walked
+    vector<SparseEntry> entries;
+    entries.reserve(m.nzcount());
+    for (SparseMatConstIterator it = m.begin(); it != m.end(); ++it)
+    {
+        const SparseMat::Node* n = it.node();
+        SparseEntry e = { n->idx[0], n->idx[1], it.ptr };
+        entries.push_back(e);
+    }
+    sort(entries.begin(), entries.end());
+
+    int header[4] = { SPARSE_VERSION, m.type(), m.size(0), m.size(1) };
+    int64_t nnz = (int64_t)entries.size();
+    s.write(SPARSE_MAGIC, sizeof(SPARSE_MAGIC));
+    s.write((const char*)header, sizeof(header));
+    s.write((const char*)&nnz, sizeof(nnz));
+
+    size_t esz = m.elemSize();
+    vector<uchar> block;
+    for (size_t start = 0; start < entries.size(); start += SPARSE_BLOCK)
+    {
+        uint32_t count = (uint32_t)std::min(entries.size() - start, (size_t)SPARSE_BLOCK);
+        block.assign(8, 0);
+        int prevRow = entries[start].i, prevCol = 0;
+        putVarint(block, (uint32_t)prevRow);               // absolute first row
+        for (uint32_t k = 0; k < count; k++)
+        {
+            const SparseEntry& e = entries[start + k];
+            if (e.i != prevRow)
+                prevCol = 0;
+            putVarint(block, (uint32_t)(e.i - prevRow));
+            putVarint(block, (uint32_t)(e.j - prevCol));
+            prevRow = e.i;
+            prevCol = e.j;
+        }
+        uint32_t indexBytes = (uint32_t)(block.size() - 8);
+        memcpy(&block[0], &count, 4);
+        memcpy(&block[4], &indexBytes, 4);
+        size_t valuesAt = block.size();
+        block.resize(valuesAt + count * esz);
+        for (uint32_t k = 0; k < count; k++)
+            memcpy(&block[valuesAt + k * esz], entries[start + k].value, esz);
+        s.write((const char*)&block[0], block.size());
+    }
+    return (bool)s;
+}
+
+bool readSparse(const char *fn, SparseMat &m)
+{
+    ifstream s(fn, ios::in | ios::binary);
+    if (!s) return false;
+
+    char magic[8];
+    int header[4];
+    int64_t nnz = 0;
+    s.read(magic, sizeof(magic));
+    s.read((char*)header, sizeof(header));
+    s.read((char*)&nnz, sizeof(nnz));
+    if (!s || memcmp(magic, SPARSE_MAGIC, sizeof(magic)) != 0 || header[0] != SPARSE_VERSION || nnz < 0)
+        return false;
+
+    int sz[] = { header[2], header[3] };
+    m.create(2, sz, header[1]);
+
+    // size the hash table and the node pool for nnz up front, so filling it never
+    // rehashes; an empty table can be resized to any power of two
+    size_t hsize = 1;
+    while (hsize < (size_t)nnz)
+        hsize *= 2;
+    if (hsize > m.hdr->hashtab.size())
+        m.hdr->hashtab.assign(hsize, 0);
+    m.hdr->pool.reserve((size_t)nnz * m.hdr->nodeSize + m.hdr->nodeSize);
+
+    size_t esz = m.elemSize();
+    vector<uchar> block;
+    for (int64_t done = 0; done < nnz; )
+    {
+        uint32_t info[2];
+        if (!s.read((char*)info, sizeof(info)) || info[0] == 0 || info[0] > (uint32_t)SPARSE_BLOCK)
+            return false;
+        block.resize(info[1] + (size_t)info[0] * esz);
+        if (!s.read((char*)&block[0], block.size()))
+            return false;
+
+        const uchar* p = &block[0];
+        const uchar* end = p + info[1];
+        const uchar* values = end;
+        int row = (int)getVarint(p, end), col = 0;
+        for (uint32_t k = 0; k < info[0]; k++)
+        {
+            uint32_t dr = getVarint(p, end);
+            if (dr)
+                col = 0;
+            row += (int)dr;
+            col += (int)getVarint(p, end);
+            if ((unsigned)row >= (unsigned)sz[0] || (unsigned)col >= (unsigned)sz[1])
+                return false;
+            memcpy(m.ptr(row, col, true), values + k * esz, esz);
+        }
+        done += info[0];
+    }
+    return true;
+}
+
 int main(int argc, char **argv)
 {
     int sz[] = {10,10};
@@ -92,5 +249,34 @@ int main(int argc, char **argv)
     cerr << m2.ref<Vec5f>(4,7) << endl;
     cerr << m2.ref<Vec5f>(7,3) << endl;
     cerr << m2.ref<Vec5f>(9,9) << endl; // does not exist
+
+    SparseMat m3;
+    writeSparse("my.spm", m);
+    readSparse("my.spm", m3);
+    cerr << m3.ref<Vec5f>(2,2) << " " << m3.ref<Vec5f>(4,7) << " " << m3.ref<Vec5f>(7,3) << endl;
+
+    // a bigger one: the per element version walks all h*w indices, the bulk one only the nonzeros
+    int n = argc > 1 ? atoi(argv[1]) : 4000;
+    int big[] = { n, n };
+    SparseMat b(2, big, CV_32FC(5));
+    RNG rng;
+    for (int k = 0; k < n * 10; k++)
+        b.ref<Vec5f>(rng.uniform(0, n), rng.uniform(0, n)) = Vec5f(1, 2, 3, 4, (float)k);
+
+    double t = (double)getTickCount();
+    write2d("big.xxx", b);
+    SparseMat b2;
+    read2d("big.xxx", b2);
+    double perElement = ((double)getTickCount() - t) / getTickFrequency();
+
+    t = (double)getTickCount();
+    writeSparse("big.spm", b);
+    SparseMat b3;
+    readSparse("big.spm", b3);
+    double bulk = ((double)getTickCount() - t) / getTickFrequency();
+
+    cerr << b.nzcount() << " nonzeros in " << n << "x" << n << ": write2d/read2d " << perElement
+         << " s, writeSparse/readSparse " << bulk << " s, " << (b3.nzcount() == b.nzcount() ? "same" : "different")
+         << " node count" << endl;
     return 0;
 }
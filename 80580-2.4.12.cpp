@@ -2,6 +2,7 @@
 #include <opencv2/highgui.hpp>
 #include<opencv2/objdetect/objdetect.hpp>
 #include "opencv2/video/background_segm.hpp"
+#include "tiled_people_detector.hpp"
 
 using namespace cv;
 using namespace std;
@@ -18,6 +19,8 @@ int main( int argc, char** argv )
                        HOGDescriptor::L2Hys, 0.2, false, cv::HOGDescriptor::DEFAULT_NLEVELS);
     hog.setSVMDetector( HOGDescriptor::getDaimlerPeopleDetector() );
 
+    TiledPeopleDetector detector( hog );
+
     BackgroundSubtractorMOG2 bgS;
     Mat frame,output;
 
@@ -32,38 +35,14 @@ int main( int argc, char** argv )
         bgS(frame, output);
         erode(output,output,Mat());
 
-        // Find contours
-        vector<vector<Point> > contours;
-        findContours( output, contours, RETR_LIST, CHAIN_APPROX_SIMPLE );
-
-        for ( size_t i = 0; i < contours.size(); i++)
-        {
-            Rect r = boundingRect( contours[i] );
-            if( r.height > 80 & r.width < r.height )
-            {
-                r.x -= r.width / 2;
-                r.y -= r.height / 2;
-                r.width += r.width;
-                r.height += r.height;
-                r = r & Rect( 0, 0, frame.cols, frame.rows );
-
-                Mat roi;
-                cvtColor( frame( r ), roi, COLOR_BGR2GRAY);
+        std::vector<Rect> rects;
+        detector.detect( frame, output, rects );
 
-                std::vector<Rect> rects;
+        for (size_t i=0; i<rects.size(); i++)
+            rectangle( frame, rects[i], Scalar( 0, 0, 255 ), 2 );
 
-                if( roi.cols > hog.winSize.width & roi.rows > hog.winSize.height )
-                    hog.detectMultiScale( roi, rects);
-
-                for (size_t i=0; i<rects.size(); i++)
-                {
-                    rects[i].x += r.x;
-                    rects[i].y += r.y;
-
-                    rectangle( frame, rects[i], Scalar( 0, 0, 255 ), 2 );
-                }
-            }
-        }
+        putText( frame, format( "%d/%d tiles scanned", detector.dirtyTiles(), detector.tileCount() ),
+                 Point( 10, 20 ), FONT_HERSHEY_SIMPLEX, 0.6, Scalar( 0, 255, 0 ), 2 );
 
         imshow("display", frame);
         if(waitKey(30)==27)
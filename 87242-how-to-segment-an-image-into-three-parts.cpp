@@ -1,6 +1,7 @@
 
 #include <opencv2/imgproc.hpp>
 #include <opencv2/highgui.hpp>
+#include "palette_quantizer.hpp"
 
 #include <iostream>
 
@@ -22,14 +23,19 @@ int main( int argc, char** argv )
         return -1;
     }
 
-    Mat gray;
-    cvtColor( image, gray, COLOR_BGR2GRAY);
+    // three parts: a palette of three colours fitted on a sample of the pixels, then
+    // one table lookup per pixel of the full image
+    int parts = argc > 2 ? atoi(argv[2]) : 3;
+    PaletteQuantizer quantizer( parts );
+    quantizer.fit( image );
 
-    gray = gray / 128;
-    gray = gray * 128;
+    Mat labels, result;
+    quantizer.apply( image, labels, result );
+    labels = labels * ( 255 / std::max( parts - 1, 1 ) );
 
     imshow( "source", image );
-    imshow( "result", gray );
+    imshow( "parts", labels );
+    imshow( "result", result );
     waitKey(0); // Wait for a keystroke in the window
 
     return 0;
@@ -1,6 +1,7 @@
 #include <opencv2/highgui.hpp>
 #include <opencv2/imgproc.hpp>
 #include <iostream>
+#include "blob_labels.hpp"
 
 using namespace cv;
 using namespace std;
@@ -17,11 +18,26 @@ int main( int argc, char** argv )
 
     bw = bw < 60;
 
-    // Find contours
+    // Label the blobs; only the ones whose box can hold a contour of area 500
+    // are traced, each in its own box
+    BlobLabeler labeler;
+    Mat labels, stats, centroids, blob;
+    int n = labeler.label( bw, labels, stats, centroids, 8 );
+
     vector<vector<Point> > contours;
     vector<int> contoursHull;
     vector<Vec4i> defects;
-    findContours( bw.clone(), contours, CV_RETR_EXTERNAL, CV_CHAIN_APPROX_NONE );
+    for ( int b = 1; b < n; b++ )
+    {
+        Rect box( stats.at<int>( b, CC_STAT_LEFT ), stats.at<int>( b, CC_STAT_TOP ),
+                  stats.at<int>( b, CC_STAT_WIDTH ), stats.at<int>( b, CC_STAT_HEIGHT ) );
+        if( ( box.width - 1 ) * ( box.height - 1 ) <= 500 )
+            continue;
+        blob = labels( box ) == b;
+        vector<vector<Point> > blobContours;
+        findContours( blob, blobContours, CV_RETR_EXTERNAL, CV_CHAIN_APPROX_NONE, box.tl() );
+        contours.insert( contours.end(), blobContours.begin(), blobContours.end() );
+    }
 
     for ( size_t i = 0; i < contours.size(); i++)
     {
@@ -1,22 +1,23 @@
 #include <opencv2/opencv.hpp>
+#include "histogram8u.hpp"
+#include "pixel_kernels.hpp"
 using namespace cv;
 
 #include <vector>
+#include <iostream>
 using namespace std;
 
 #define HISTMATCH_EPSILON 0.000001
+// the intermediate histograms in windows, unless BTM_NO_DEBUG is defined before this point
+#ifndef BTM_NO_DEBUG
 #define BTM_DEBUG
+#endif
 // Compute histogram and CDF for an image with mask
 void do1ChnHist(const Mat_<uchar> &img, const Mat_<uchar> &mask, Mat_<double> &h, Mat_<double> &cdf)
 {
-    for(size_t p=0; p<img.total(); p++)
-    {
-        if(mask(p) > 0)
-        {
-            uchar c = img(p);
-            h(c) += 1.0;
-        }
-    }
+    Histogram8u counts(img, mask);
+    for(int c=0; c<256; c++)
+        h(c) = counts[c];
 
     normalize(h,h,1,0,NORM_MINMAX);
 
@@ -88,14 +89,125 @@ void histMatchRGB(Mat &src, const Mat &src_mask, const Mat &dst, const Mat &dst_
     res.copyTo(src);
 }
 
+// Same matching for a fixed reference applied to many frames. The reference CDFs are
+// computed once; each apply() reads the frame twice: one pass building the three
+// channel histograms straight from the interleaved pixels (calcHistograms8u, no
+// split), one pass applying the three LUTs.
+class HistMatcher
+{
+public:
+    HistMatcher(const Mat &reference, const Mat &mask = Mat())
+    {
+        CV_Assert(reference.type() == CV_8UC3);
+        Mat_<double> hist[3];
+        histograms(reference, mask, hist);
+        for (int i=0; i<3; i++)
+            cdfOf(hist[i], ref_cdf[i]);
+    }
+
+    void apply(const Mat &src, Mat &dst, const Mat &mask = Mat()) const
+    {
+        CV_Assert(src.type() == CV_8UC3);
+        Mat_<double> hist[3];
+        histograms(src, mask, hist);
+
+        uchar lut[3][256];
+        for (int i=0; i<3; i++)
+        {
+            Mat_<double> src_cdf;
+            cdfOf(hist[i], src_cdf);
+            int last = 0;
+            for (int j=0; j<256; j++)
+            {
+                double F1j = src_cdf(j);
+                lut[i][j] = (uchar)last;
+                for (int k = last; k<256; k++)
+                {
+                    double F2k = ref_cdf[i](k);
+                    if(abs(F2k - F1j) < HISTMATCH_EPSILON || F2k > F1j)
+                    {
+                        lut[i][j] = (uchar)k;
+                        last = k;
+                        break;
+                    }
+                }
+            }
+        }
+
+        pixelkernel::forEachPixel<Vec3b, Vec3b>(src, dst, [&lut](const Vec3b &p)
+        {
+            return Vec3b(lut[0][p[0]], lut[1][p[1]], lut[2][p[2]]);
+        });
+    }
+
+private:
+
+    static void histograms(const Mat &img, const Mat &mask, Mat_<double> *hist)
+    {
+        vector<int> total;
+        calcHistograms8u(img, mask, total);
+        for (int i = 0; i < 3; i++)
+        {
+            hist[i].create(1, 256);
+            for (int j = 0; j < 256; j++)
+                hist[i](j) = total[i*256 + j];
+        }
+    }
+
+    // as do1ChnHist: normalized histogram, cumulated, normalized again
+    static void cdfOf(Mat_<double> &h, Mat_<double> &cdf)
+    {
+        normalize(h,h,1,0,NORM_MINMAX);
+        cdf.create(1,256);
+        cdf(0) = h(0);
+        for(int j=1; j<256; j++)
+            cdf(j) = cdf(j-1) + h(j);
+        normalize(cdf,cdf,1,0,NORM_MINMAX);
+    }
+
+    Mat_<double> ref_cdf[3];
+};
+
 int main(int argc, char **argv)
 {
     Mat src = imread("fruits.jpg");
     Mat dst = imread("lena.jpg");
-    Mat mask = Mat(src.size(), CV_8U, Scalar(255));
+    if (src.empty() || dst.empty())
+    {
+        cout << "cannot read fruits.jpg or lena.jpg" << endl;
+        return -1;
+    }
+    // one mask per image, the two are not the same size
+    Mat src_mask = Mat(src.size(), CV_8U, Scalar(255));
+    Mat dst_mask = Mat(dst.size(), CV_8U, Scalar(255));
     //Mat src_mask = imread("image008_mask.bmp",0);
     //Mat dst_mask = imread("image003_mask.bmp",0);
 
-    histMatchRGB(dst,mask,src,mask);
+    // the reference is analysed once, then any number of frames can be matched to it
+    HistMatcher matcher(src, src_mask);
+    Mat matched;
+    int64 t = getTickCount();
+    matcher.apply(dst, matched, dst_mask);
+    cout << "HistMatcher::apply: " << (getTickCount() - t) * 1000. / getTickFrequency() << " ms" << endl;
+
+    if (argc > 1)
+    {
+        // 90288 <video>: every frame matched to fruits.jpg
+        VideoCapture cap(argv[1]);
+        Mat frame;
+        while (cap.read(frame))
+        {
+            matcher.apply(frame, matched);
+            imshow("matched video", matched);
+            if (waitKey(1) == 27)
+                break;
+        }
+        return 0;
+    }
+
+    t = getTickCount();
+    histMatchRGB(dst,dst_mask,src,src_mask);
+    cout << "histMatchRGB: " << (getTickCount() - t) * 1000. / getTickFrequency() << " ms (including the debug windows)" << endl;
+    cout << "max difference: " << norm(dst, matched, NORM_INF) << endl;
     return 0;
 }
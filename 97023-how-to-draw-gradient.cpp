@@ -1,11 +1,195 @@
 //http://answers.opencv.org/question/97023
 #include "opencv2/imgproc.hpp"
 #include "opencv2/highgui.hpp"
+#include "lru_cache.hpp"
+#include <iostream>
 
 using namespace cv;
 
+enum GradientKind
+{
+    GRADIENT_LINEAR,   // 0 on the top row to 255 on the bottom row
+    GRADIENT_RADIAL,   // 0 at the center to 255 on the inscribed circle
+    GRADIENT_ANGULAR   // 0 to 255 clockwise from the positive x axis, as linearPolar of GRADIENT_LINEAR
+};
+
+// The position along every gradient of each pixel of one size, as 8 bit indices,
+// and the inscribed circle as a mask.
+struct GradientMaps
+{
+    Mat index[3];
+    Mat circle;
+};
+
+struct PolarKey
+{
+    Size src, dst;
+    Point2f center;
+    double maxRadius;
+    bool inverse;
+
+    bool operator<(const PolarKey& k) const
+    {
+        if (src.width != k.src.width) return src.width < k.src.width;
+        if (src.height != k.src.height) return src.height < k.src.height;
+        if (dst.width != k.dst.width) return dst.width < k.dst.width;
+        if (dst.height != k.dst.height) return dst.height < k.dst.height;
+        if (center.x != k.center.x) return center.x < k.center.x;
+        if (center.y != k.center.y) return center.y < k.center.y;
+        if (maxRadius != k.maxRadius) return maxRadius < k.maxRadius;
+        return inverse < k.inverse;
+    }
+};
+
+struct PolarMaps
+{
+    Mat map1, map2;    // fixed point, from convertMaps
+};
+
+struct SizeLess
+{
+    bool operator()(const Size& a, const Size& b) const
+    {
+        return a.height != b.height ? a.height < b.height : a.width < b.width;
+    }
+};
+
+// Renders gradient backgrounds and polar warps from maps built once per size. A
+// gradient is one LUT() of a cached index map, a polar warp one remap() with cached
+// fixed point tables; only a size (or polar geometry) not seen recently pays for
+// the trigonometry again.
+class GradientRenderer
+{
+public:
+    explicit GradientRenderer(size_t capacity = 4) : gradients(capacity), polars(capacity) {}
+
+    const GradientMaps& maps(Size size)
+    {
+        return gradients.get(size, buildGradients);
+    }
+
+    // lut: 256 entries of CV_8UC1 (gray) or CV_8UC3 (colour), the value at each position
+    // of the gradient; LUT() wants as many channels in the index as in a colour table,
+    // so colour is looked up here instead, one pass from the 1 channel index
+    void render(Size size, GradientKind kind, const Mat& lut, Mat& dst)
+    {
+        CV_Assert(lut.total() == 256 && lut.depth() == CV_8U && (lut.channels() == 1 || lut.channels() == 3));
+        const Mat& index = maps(size).index[kind];
+        if (lut.channels() == 1)
+        {
+            LUT(index, lut, dst);
+            return;
+        }
+        Mat table = lut.isContinuous() ? lut : lut.clone();
+        const Vec3b* colours = table.ptr<Vec3b>();
+        dst.create(size, CV_8UC3);
+        for (int y = 0; y < size.height; y++)
+        {
+            const uchar* in = index.ptr<uchar>(y);
+            Vec3b* out = dst.ptr<Vec3b>(y);
+            for (int x = 0; x < size.width; x++)
+                out[x] = colours[in[x]];
+        }
+    }
+
+    // Same result as linearPolar(src, dst, center, maxRadius, flags) with
+    // WARP_FILL_OUTLIERS, dst of the size of src.
+    void linearPolar(const Mat& src, Mat& dst, Point2f center, double maxRadius, int flags)
+    {
+        PolarKey key;
+        key.src = key.dst = src.size();
+        key.center = center;
+        key.maxRadius = maxRadius;
+        key.inverse = (flags & WARP_INVERSE_MAP) != 0;
+        const PolarMaps& m = polars.get(key, buildPolar);
+        const Mat* from = &src;
+        if (key.inverse)
+        {
+            // the angle wraps around: rows above the first and below the last, as linearPolar does
+            copyMakeBorder(src, padded, PAD, PAD, 0, 0, BORDER_WRAP);
+            from = &padded;
+        }
+        remap(*from, dst, m.map1, m.map2, flags & INTER_MAX, BORDER_CONSTANT, Scalar());
+    }
+
+    LruCache<Size, GradientMaps, SizeLess> gradients;
+    LruCache<PolarKey, PolarMaps> polars;
+
+private:
+    enum { PAD = 4 };      // enough rows for INTER_LANCZOS4
+
+    static void buildGradients(const Size& size, GradientMaps& g)
+    {
+        Point2f c(size.width / 2.f, size.height / 2.f);
+        float radius = std::min(size.width, size.height) / 2.f;
+        for (int k = 0; k < 3; k++)
+            g.index[k].create(size, CV_8U);
+        g.circle.create(size, CV_8U);
+        for (int y = 0; y < size.height; y++)
+        {
+            uchar* lin = g.index[GRADIENT_LINEAR].ptr<uchar>(y);
+            uchar* rad = g.index[GRADIENT_RADIAL].ptr<uchar>(y);
+            uchar* ang = g.index[GRADIENT_ANGULAR].ptr<uchar>(y);
+            uchar* in = g.circle.ptr<uchar>(y);
+            uchar v = size.height > 1 ? saturate_cast<uchar>(y * 255.0 / (size.height - 1)) : 0;
+            for (int x = 0; x < size.width; x++)
+            {
+                float dx = x - c.x, dy = y - c.y, r = std::sqrt(dx * dx + dy * dy);
+                lin[x] = v;
+                rad[x] = saturate_cast<uchar>(std::min(r / radius, 1.f) * 255);
+                ang[x] = saturate_cast<uchar>(fastAtan2(dy, dx) * (255.0 / 360));
+                in[x] = r <= radius ? 255 : 0;
+            }
+        }
+    }
+
+    static void buildPolar(const PolarKey& k, PolarMaps& m)
+    {
+        Mat mapx(k.dst, CV_32F), mapy(k.dst, CV_32F);
+        if (k.inverse)
+        {
+            // dst is cartesian: columns of src are the radius, rows the angle
+            double Mag = k.maxRadius / k.src.width, Kangle = CV_2PI / k.src.height;
+            for (int y = 0; y < k.dst.height; y++)
+            {
+                float* mx = mapx.ptr<float>(y);
+                float* my = mapy.ptr<float>(y);
+                for (int x = 0; x < k.dst.width; x++)
+                {
+                    double dx = x - k.center.x, dy = y - k.center.y;
+                    double angle = std::atan2(dy, dx);
+                    if (angle < 0)
+                        angle += CV_2PI;
+                    mx[x] = (float)(std::sqrt(dx * dx + dy * dy) / Mag);
+                    my[x] = (float)(angle / Kangle + PAD);
+                }
+            }
+        }
+        else
+        {
+            double Mag = k.maxRadius / k.dst.width, Kangle = CV_2PI / k.dst.height;
+            for (int phi = 0; phi < k.dst.height; phi++)
+            {
+                float* mx = mapx.ptr<float>(phi);
+                float* my = mapy.ptr<float>(phi);
+                double cp = std::cos(phi * Kangle), sp = std::sin(phi * Kangle);
+                for (int rho = 0; rho < k.dst.width; rho++)
+                {
+                    mx[rho] = (float)(k.center.x + rho * Mag * cp);
+                    my[rho] = (float)(k.center.y + rho * Mag * sp);
+                }
+            }
+        }
+        convertMaps(mapx, mapy, m.map1, m.map2, CV_16SC2);
+    }
+
+    Mat padded;
+};
+
 int main( int argc, char** argv )
 {
+    GradientRenderer renderer;
+
     //Set linear gradient (255 gray levels)
     Mat lines(255, 255, CV_8U, Scalar(0));
     for (int r = 0; r < lines.rows; r++)
@@ -15,18 +199,35 @@ int main( int argc, char** argv )
     namedWindow("Linear Gradient", CV_WINDOW_NORMAL);
     imshow("Linear Gradient", lines);
 
-    //Convert to polar (needs WARP_INVERSE_MAP flag)
-    cv::linearPolar(lines, lines, cv::Point(lines.cols / 2, lines.rows / 2), 255, INTER_CUBIC | WARP_FILL_OUTLIERS | WARP_INVERSE_MAP);
+    //Convert to polar (needs WARP_INVERSE_MAP flag), the maps are kept for the next frame
+    Mat polar;
+    renderer.linearPolar(lines, polar, cv::Point(lines.cols / 2, lines.rows / 2), 255, INTER_CUBIC | WARP_FILL_OUTLIERS | WARP_INVERSE_MAP);
     namedWindow("Polar Gradient", CV_WINDOW_NORMAL);
-    imshow("Polar Gradient", lines);
+    imshow("Polar Gradient", polar);
 
     //Mask out circle section
-    Mat mask(lines.size(), CV_8U, Scalar(0));
-    circle(mask, cv::Point(mask.cols / 2, mask.rows / 2), lines.rows/2, Scalar(255), -1,LINE_8);
     Mat circle_gradient;
-    lines.copyTo(circle_gradient, mask);
+    polar.copyTo(circle_gradient, renderer.maps(polar.size()).circle);
     namedWindow("Circle Gradient", CV_WINDOW_NORMAL);
     imshow("Circle Gradient", circle_gradient);
+
+    //The same backgrounds in colour straight from the index maps, one LUT per frame
+    Mat lut(1, 256, CV_8UC3);
+    for (int i = 0; i < 256; i++)
+        lut.at<Vec3b>(i) = Vec3b(255 - i, 128, i);
+    Mat radial, angular;
+    int64 t = getTickCount();
+    const int frames = 100;
+    for (int f = 0; f < frames; f++)
+    {
+        Size size = f % 2 ? Size(640, 480) : Size(320, 240);
+        renderer.render(size, GRADIENT_RADIAL, lut, radial);
+        renderer.render(size, GRADIENT_ANGULAR, lut, angular);
+    }
+    std::cout << "two gradients per frame: " << (getTickCount() - t) * 1000.0 / getTickFrequency() / frames
+              << " ms, maps built " << renderer.gradients.misses << " times for " << frames << " frames" << std::endl;
+    imshow("Radial Gradient", radial);
+    imshow("Angular Gradient", angular);
     waitKey(0);
     return 0;
 }
@@ -1,74 +1,377 @@
-
 #include <opencv2/imgproc.hpp>
 #include <opencv2/highgui.hpp>
 #include<opencv2/objdetect/objdetect.hpp>
 #include "opencv2/video/background_segm.hpp"
+#include <opencv2/core/ocl.hpp>
+#include "tiled_people_detector.hpp"
+#include "people_tracker.hpp"
+#include "perf_stages.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
 
 using namespace cv;
 using namespace std;
 
+// Expanded blob rects overlap a lot, and a person split into several blobs gives
+// several rects over the same area. Merge every pair that overlaps or is closer than
+// "gap" pixels until nothing changes, so each pixel is scanned by HOG at most once.
+static void mergeRois( vector<Rect>& rois, int gap )
+{
+    bool merged = true;
+    while( merged )
+    {
+        merged = false;
+        for( size_t i = 0; i < rois.size() && !merged; i++ )
+            for( size_t j = i + 1; j < rois.size(); j++ )
+            {
+                Rect grown( rois[i].x - gap, rois[i].y - gap, rois[i].width + gap * 2, rois[i].height + gap * 2 );
+                if( ( grown & rois[j] ).area() > 0 )
+                {
+                    rois[i] |= rois[j];
+                    rois.erase( rois.begin() + j );
+                    merged = true;
+                    break;
+                }
+            }
+    }
+}
+
+// keeps the strongest of every group of detections overlapping by more than "overlap" (IoU)
+static void nonMaximumSuppression( vector<Rect>& rects, vector<double>& weights, double overlap )
+{
+    vector<size_t> order( rects.size() );
+    for( size_t i = 0; i < order.size(); i++ )
+        order[i] = i;
+    sort( order.begin(), order.end(), [&weights]( size_t a, size_t b ) { return weights[a] > weights[b]; } );
+
+    vector<Rect> kept;
+    vector<double> kept_weights;
+    for( size_t k = 0; k < order.size(); k++ )
+    {
+        const Rect& r = rects[order[k]];
+        bool suppressed = false;
+        for( size_t i = 0; i < kept.size() && !suppressed; i++ )
+        {
+            double inter = ( r & kept[i] ).area();
+            suppressed = inter > overlap * ( r.area() + kept[i].area() - inter );
+        }
+        if( !suppressed )
+        {
+            kept.push_back( r );
+            kept_weights.push_back( weights[order[k]] );
+        }
+    }
+    rects.swap( kept );
+    weights.swap( kept_weights );
+}
+
+// A rect of the background model's resolution in frame pixels, rounded outwards.
+static Rect toFrame( const Rect& r, double fx, double fy )
+{
+    int x0 = cvFloor( r.x * fx ), y0 = cvFloor( r.y * fy );
+    return Rect( x0, y0, cvCeil( r.br().x * fx ) - x0, cvCeil( r.br().y * fy ) - y0 );
+}
+
+// The MOG2 learning rate from the share of foreground in the mask. A quiet scene learns
+// at the default rate; while people move through it the model learns slowly so that
+// someone standing for a while does not fade into the background; when most of the
+// frame changes at once (lights, auto exposure, a camera bump) it learns fast to get a
+// usable background back within a second or so instead of minutes.
+struct SceneActivity
+{
+    SceneActivity() : activity( 0 ) {}
+
+    double learningRate( const Mat& mask, const Mat& ignored )
+    {
+        if( mask.empty() )
+            return -1;
+        int active = countNonZero( mask ), total = (int)mask.total();
+        if( !ignored.empty() )
+            total -= countNonZero( ignored );
+        activity += ( (double)active / std::max( total, 1 ) - activity ) * 0.2;
+        if( activity > 0.5 )
+            return 0.05;
+        if( activity > 0.02 )
+            return 0.0005;
+        return -1;   // MOG2's own, 1 / history
+    }
+
+    double activity;   // smoothed foreground share
+};
+
+class RoiDetectBody : public ParallelLoopBody
+{
+public:
+    RoiDetectBody( const HOGDescriptor& _hog, const Mat& _gray, const vector<Rect>& _rois,
+                   vector<vector<Rect> >& _found, vector<vector<double> >& _weights )
+        : hog(_hog), gray(_gray), rois(_rois), found(_found), weights(_weights) {}
+
+    void operator()( const Range& range ) const
+    {
+        for( int i = range.start; i < range.end; i++ )
+        {
+            const Rect& r = rois[i];
+            if( r.width <= hog.winSize.width || r.height <= hog.winSize.height )
+                continue;
+            hog.detectMultiScale( gray( r ), found[i], weights[i] );
+            for( size_t k = 0; k < found[i].size(); k++ )
+                found[i][k] += r.tl();
+        }
+    }
+
+private:
+    const HOGDescriptor& hog;
+    const Mat& gray;
+    const vector<Rect>& rois;
+    vector<vector<Rect> >& found;
+    vector<vector<double> >& weights;
+};
+
 int main( int argc, char** argv )
 {
     char* filename = argc >= 2 ? argv[1] : (char*)"768x576.avi";
     VideoCapture capture( filename );
 
+    // "--opencl" or 'o' runs background subtraction, erode, resize, gray conversion and
+    // HOG on UMat through OpenCL; with it off the same UMat code runs on the CPU
+    // "--bg-scale=N" runs the background model at 1/N of the frame size (4 by default, 1
+    // for the full size); the blobs are mapped back and HOG still sees the full frame
+    // "--static=mask.png" ignores the non-zero pixels of mask.png (trees, screens, a clock)
+    // "--hog-every=N" scans every blob with HOG only every N frames (5 by default); in
+    // between only the blobs not covered by a confirmed track are, and the tracks coast
+    bool use_opencl = false;
+    int bg_scale = 4, hog_every = 5;
+    Mat static_zones;
+    for( int i = 2; i < argc; i++ )
+    {
+        string arg = argv[i];
+        if( arg == "--opencl" )
+            use_opencl = true;
+        else if( arg.find( "--bg-scale=" ) == 0 )
+            bg_scale = std::max( 1, atoi( arg.c_str() + 11 ) );
+        else if( arg.find( "--hog-every=" ) == 0 )
+            hog_every = std::max( 1, atoi( arg.c_str() + 12 ) );
+        else if( arg.find( "--static=" ) == 0 )
+        {
+            static_zones = imread( arg.substr( 9 ), IMREAD_GRAYSCALE );
+            if( static_zones.empty() )
+                cout << "cannot read " << arg.substr( 9 ) << endl;
+        }
+    }
+    if( use_opencl && !ocl::haveOpenCL() )
+    {
+        cout << "OpenCL is not available, running on the CPU" << endl;
+        use_opencl = false;
+    }
+    ocl::setUseOpenCL( use_opencl );
+
     HOGDescriptor hog;
     hog.setSVMDetector(hog.getDefaultPeopleDetector());
 
+    // 't' switches between merged foreground ROIs and the per tile result cache
+    TiledPeopleDetector detector( hog );
+    bool use_tiles = false;
+
     Ptr<BackgroundSubtractor> bgS = createBackgroundSubtractorMOG2();
-    Mat frame,output;
+    SceneActivity scene;
+    PeopleTracker tracker;
+    int64 frame_index = 0, hog_pixels = 0;
+    Mat frame,mask,small_mask,ignored;
+    UMat uframe,uoutput,ugray,usmall,uignored;
 
     while(true)
     {
         capture.read(frame);
         if (!frame.data)
-            return 0;
-        if( frame.cols > 800 )
-            resize( frame, frame, Size(), 0.5, 0.5 );
-
-        bgS->apply(frame, output);
-        erode(output,output,Mat());
-
-        // Find contours
-        vector<vector<Point> > contours;
-        findContours( output, contours, RETR_LIST, CHAIN_APPROX_SIMPLE );
+            break;
 
-        for ( size_t i = 0; i < contours.size(); i++)
+        const char* device = use_opencl ? "opencl" : "cpu";
+        vector<Rect> rects, searched;
+        bool full_pass = frame_index++ % hog_every == 0;
+        tracker.predict();
         {
-            Rect r = boundingRect( contours[i] );
-            if( r.height > 80 & r.width < r.height )
+            PERF_STAGE( device );
+            {
+                PERF_STAGE( "upload" );
+                frame.copyTo( uframe );
+                if( uframe.cols > 800 )
+                    resize( uframe, uframe, Size(), 0.5, 0.5 );
+            }
+            {
+                PERF_STAGE( "mog2" );
+                Size small( std::max( 1, uframe.cols / bg_scale ), std::max( 1, uframe.rows / bg_scale ) );
+                if( !static_zones.empty() && ignored.size() != small )
+                {
+                    resize( static_zones, ignored, small, 0, 0, INTER_NEAREST );
+                    ignored.copyTo( uignored );
+                }
+                if( bg_scale > 1 )
+                    resize( uframe, usmall, small, 0, 0, INTER_AREA );
+                else if( !ignored.empty() )
+                    uframe.copyTo( usmall );   // HOG and the display still want the zones
+                else
+                    usmall = uframe;
+                // a constant in the ignored zones: the model there settles on a single
+                // Gaussian, the cheapest case of MOG2, and never reports foreground
+                if( !ignored.empty() )
+                    usmall.setTo( Scalar::all( 0 ), uignored );
+                bgS->apply( usmall, uoutput, scene.learningRate( small_mask, ignored ) );
+                erode(uoutput,uoutput,Mat());
+            }
+            {
+                // contours and the tile statistics need the mask on the host
+                PERF_STAGE( "download" );
+                uoutput.copyTo( small_mask );
+                if( !ignored.empty() )
+                    small_mask.setTo( Scalar::all( 0 ), ignored );   // before the model has settled there
+                uframe.copyTo( frame );
+                // the tiles compare foreground shares, a nearest neighbour mask is enough
+                if( use_tiles )
+                    resize( small_mask, mask, frame.size(), 0, 0, INTER_NEAREST );
+            }
+
+            PERF_STAGE( "detect" );
+            if( use_tiles )
             {
-                r.x -= r.width / 2;
-                r.y -= r.height / 2;
-                r.width += r.width;
-                r.height += r.height;
-                r = r & Rect( 0, 0, frame.cols, frame.rows );
+                detector.detect( frame, mask, rects );
+                searched.assign( 1, Rect( 0, 0, frame.cols, frame.rows ) );
+            }
+            else
+            {
+                // Find contours, in the model's resolution, and their rects in the frame
+                vector<vector<Point> > contours;
+                findContours( small_mask, contours, RETR_LIST, CHAIN_APPROX_SIMPLE );
+                double fx = (double)frame.cols / small_mask.cols, fy = (double)frame.rows / small_mask.rows;
 
-                Mat roi;
-                cvtColor( frame( r ), roi, COLOR_BGR2GRAY);
+                vector<Rect> rois;
+                for ( size_t i = 0; i < contours.size(); i++)
+                {
+                    Rect r = toFrame( boundingRect( contours[i] ), fx, fy );
+                    if( r.height > 80 & r.width < r.height )
+                    {
+                        r.x -= r.width / 2;
+                        r.y -= r.height / 2;
+                        r.width += r.width;
+                        r.height += r.height;
+                        rois.push_back( r & Rect( 0, 0, frame.cols, frame.rows ) );
+                    }
+                }
+                mergeRois( rois, hog.blockStride.width * 2 );
 
-                std::vector<Rect> rects;
+                // once the merged ROIs cover most of the frame one full frame pass is cheaper
+                int covered = 0;
+                for( size_t i = 0; i < rois.size(); i++ )
+                    covered += rois[i].area();
+                if( covered > frame.total() * 0.6 )
+                    rois.assign( 1, Rect( 0, 0, frame.cols, frame.rows ) );
 
-                if( roi.cols > hog.winSize.width & roi.rows > hog.winSize.height )
-                    hog.detectMultiScale( roi, rects);
+                // between full passes, leave the people already followed to the tracker
+                if( !full_pass )
+                {
+                    const vector<PeopleTracker::Track>& tracks = tracker.tracks();
+                    size_t kept = 0;
+                    for( size_t i = 0; i < rois.size(); i++ )
+                    {
+                        int followed = 0, unsure = 0;
+                        for( size_t k = 0; k < tracks.size(); k++ )
+                            if( ( tracks[k].box & rois[i] ).area() > tracks[k].box.area() / 2 )
+                                ( tracks[k].confirmed ? followed : unsure )++;
+                        if( unsure > 0 || followed == 0 )
+                            rois[kept++] = rois[i];
+                    }
+                    rois.resize( kept );
+                }
+                searched = rois;
+                for( size_t i = 0; i < rois.size(); i++ )
+                    hog_pixels += rois[i].area();
 
-                for (size_t i=0; i<rects.size(); i++)
+                vector<double> weights;
+                if( !rois.empty() )
                 {
-                    rects[i].x += r.x;
-                    rects[i].y += r.y;
+                    cvtColor( uframe, ugray, COLOR_BGR2GRAY );
+
+                    vector<vector<Rect> > found( rois.size() );
+                    vector<vector<double> > found_weights( rois.size() );
+                    if( use_opencl )
+                    {
+                        // one ROI after the other, the device is already busy with each of them
+                        for( size_t i = 0; i < rois.size(); i++ )
+                        {
+                            if( rois[i].width <= hog.winSize.width || rois[i].height <= hog.winSize.height )
+                                continue;
+                            hog.detectMultiScale( ugray( rois[i] ), found[i], found_weights[i] );
+                            for( size_t k = 0; k < found[i].size(); k++ )
+                                found[i][k] += rois[i].tl();
+                        }
+                    }
+                    else
+                    {
+                        Mat gray = ugray.getMat( ACCESS_READ );
+                        parallel_for_( Range( 0, (int)rois.size() ), RoiDetectBody( hog, gray, rois, found, found_weights ) );
+                    }
 
-                    rectangle( frame, Point(rects[i].x, rects[i].y),
-                               Point(rects[i].x+rects[i].width, rects[i].y+rects[i].height),
-                               Scalar( 0, 0, 255 ), 2 );
+                    for( size_t i = 0; i < rois.size(); i++ )
+                    {
+                        rects.insert( rects.end(), found[i].begin(), found[i].end() );
+                        weights.insert( weights.end(), found_weights[i].begin(), found_weights[i].end() );
+                    }
+                    nonMaximumSuppression( rects, weights, 0.5 );
                 }
             }
         }
 
+        {
+            PERF_STAGE( "track" );
+            tracker.update( rects, searched, frame.size() );
+        }
+
+        // confirmed tracks in green with their id, tentative ones in yellow
+        const vector<PeopleTracker::Track>& tracks = tracker.tracks();
+        for (size_t i=0; i<tracks.size(); i++)
+        {
+            const Rect& r = tracks[i].box;
+            Scalar color = tracks[i].confirmed ? Scalar( 0, 255, 0 ) : Scalar( 0, 255, 255 );
+            rectangle( frame, r, color, 2 );
+            if( tracks[i].confirmed )
+                putText( frame, format( "%d", tracks[i].id ), r.tl() + Point( 2, 14 ), FONT_HERSHEY_SIMPLEX, 0.5, color, 2 );
+        }
+        if( use_tiles )
+            putText( frame, format( "%s, %d/%d tiles scanned", device, detector.dirtyTiles(), detector.tileCount() ),
+                     Point( 10, 20 ), FONT_HERSHEY_SIMPLEX, 0.6, Scalar( 0, 255, 0 ), 2 );
+        else
+            putText( frame, format( "%s, merged ROIs", device ), Point( 10, 20 ), FONT_HERSHEY_SIMPLEX, 0.6, Scalar( 0, 255, 0 ), 2 );
+        putText( frame, format( "background 1/%d, activity %.0f%%", bg_scale, scene.activity * 100 ),
+                 Point( 10, 45 ), FONT_HERSHEY_SIMPLEX, 0.6, Scalar( 0, 255, 0 ), 2 );
+        putText( frame, format( "%d people, HOG every %d", tracker.peopleSeen(), hog_every ),
+                 Point( 10, 70 ), FONT_HERSHEY_SIMPLEX, 0.6, Scalar( 0, 255, 0 ), 2 );
+
         imshow("display", frame);
-        if(waitKey(1)==27)
+        int key = waitKey(1);
+        if(key==27)
         {
             break;
         }
+        if( key == 't' )
+            use_tiles = !use_tiles;
+        if( key == 'o' && ocl::haveOpenCL() )
+        {
+            // the subtractor keeps its model on the device it was started on
+            use_opencl = !use_opencl;
+            ocl::setUseOpenCL( use_opencl );
+            bgS = createBackgroundSubtractorMOG2();
+            uignored.release();
+            ignored.release();
+            small_mask.release();
+            scene = SceneActivity();
+            tracker.clear();
+            detector.reset();
+        }
     }
+
+    // per device totals: compare cpu and opencl "mean" of the top level rows
+    perf::printReport( cout );
+    cout << tracker.peopleSeen() << " people, " << ( frame_index ? hog_pixels / frame_index : 0 )
+         << " pixels scanned by HOG per frame" << endl;
     return 0;
 }
@@ -1,9 +1,11 @@
 
 #include "opencv2/imgproc/imgproc.hpp"
 #include "opencv2/highgui/highgui.hpp"
+#include "point_distances.hpp"
 
 #include <iostream>
 #include <ctime>
+#include <algorithm>
 
 using namespace cv;
 using namespace std;
@@ -22,98 +24,103 @@ static double angle( Point pt1, Point pt2, Point pt0 )
     return (dx1*dx2 + dy1*dy2)/sqrt((dx1*dx1 + dy1*dy1)*(dx2*dx2 + dy2*dy2) + 1e-10);
 }
 
-static double distanceBtwPoints(const cv::Point &a, const cv::Point &b)
+// Everything the detector looks at for one (approximated) contour.
+struct ContourFeatures
 {
-    double xDiff = a.x - b.x;
-    double yDiff = a.y - b.y;
-
-    return std::sqrt((xDiff * xDiff) + (yDiff * yDiff));
-}
-
-static double sum_distanceBtwPoints( vector<Point> contour )
+    double perimeter;   // open polyline length, first to last point
+    double avgCosine;   // 0 when the centres disagree or the contour has less than 8 points
+    Rect boundingRect;
+    Rect ellipseRect;   // bounding rect of fitEllipse(), empty with less than 5 points
+    Point massCenter;
+};
+
+// The features in one pass over the points: perimeter, bounding rect, the polygon
+// moments and the edge lengths and corner cosines for the average. Only fitEllipse()
+// makes its own pass. The average cosine keeps the rules of the former avg_cosine():
+// the centres of the ellipse, of the bounding rect and of mass must fall within 10%
+// of the rect size, and a corner counts only when its two edges have about the same
+// length.
+static void contourFeatures( const vector<Point>& contour, ContourFeatures& f )
 {
-    double sum = 0;
-    for( size_t i = 1; i < contour.size(); i++ )
+    const size_t n = contour.size();
+    f.perimeter = 0;
+    f.avgCosine = 0;
+    f.boundingRect = Rect();
+    f.ellipseRect = Rect();
+    f.massCenter = Point();
+    if( n == 0 )
+        return;
+
+    int xmin = contour[0].x, xmax = xmin, ymin = contour[0].y, ymax = ymin;
+    double m00 = 0, m10 = 0, m01 = 0, sumCos = 0, prevEdge = 0;
+    for( size_t i = 0; i < n; i++ )
     {
-        // cout << i << ". dist " << distanceBtwPoints( contour[i], contour[i-1] ) << endl;
-        sum += distanceBtwPoints( contour[i], contour[i-1] );
+        const Point& p = contour[i];
+        xmin = std::min( xmin, p.x ); xmax = std::max( xmax, p.x );
+        ymin = std::min( ymin, p.y ); ymax = std::max( ymax, p.y );
+
+        // moments of the closed polygon (Green's formula)
+        const Point& q = contour[(i + n - 1) % n];
+        double a = (double)q.x * p.y - (double)p.x * q.y;
+        m00 += a;
+        m10 += a * ( q.x + p.x );
+        m01 += a * ( q.y + p.y );
+
+        if( i == 0 )
+            continue;
+        double edge = distanceBtwPoints( p, contour[i-1] );
+        f.perimeter += edge;
+        if( i >= 2 && fabs( edge - prevEdge ) < edge * 0.4 )
+            sumCos += fabs( angle( p, contour[i-2], contour[i-1] ) );
+        prevEdge = edge;
     }
-
-    return sum ;
-}
-
-static Rect fitEllipse_check( vector<Point> contour )
-{
-    Mat pointsf;
-    Mat(contour).convertTo(pointsf, CV_32F);
-    RotatedRect box = fitEllipse(pointsf);
-    //cout << box.size << "  " << box.size <<endl;
-    return box.boundingRect();
-    if( MAX(box.size.width, box.size.height) > MIN(box.size.width, box.size.height)*2 )
-        return Rect(-1,-1,0,0);
-    else
-        return box.boundingRect();
-}
-
-static Point moment_check( vector<Point> contour )
-{
-    /// Get the moment
-    Moments mu;
-    mu = moments( contour, false );
-
-    ///  Get the mass centers:
-    Point2f mc;
-    mc = Point2f( static_cast<float>(mu.m10/mu.m00), static_cast<float>(mu.m01/mu.m00) );
-
-    return Point(mc.x,mc.y);
+    f.boundingRect = Rect( xmin, ymin, xmax - xmin + 1, ymax - ymin + 1 );
+    if( m00 != 0 )
+        f.massCenter = Point( (int)( m10 / ( 3 * m00 ) ), (int)( m01 / ( 3 * m00 ) ) );
+    if( n >= 5 )
+        f.ellipseRect = fitEllipse( contour ).boundingRect();
+    if( n < 8 )
+        return;
+
+    const Rect& r0 = f.ellipseRect;
+    const Rect& r1 = f.boundingRect;
+    vector<Point> pts(3);
+    pts[0] = Point( r0.x + r0.width / 2, r0.y + r0.height / 2 );
+    pts[1] = Point( r1.x + r1.width / 2, r1.y + r1.height / 2 );
+    pts[2] = f.massCenter;
+    Rect2f rDiff = boundingRect( pts );
+    double diffRatio = ( rDiff.width / r1.width ) + ( rDiff.height / r1.height );
+    if( diffRatio <= 0.1 )
+        f.avgCosine = sumCos / ( n - 2 );
 }
 
-static double avg_cosine( vector<Point> contour )
+class ContourFeatureBody : public ParallelLoopBody
 {
-    double avg_cos = 0;
-    if( contour.size() < 8 ) return avg_cos;
-    Rect r0,r1;
-    Rect2f rDiff;
-    vector<Point> pts(3);
-
-    r0 = fitEllipse_check( contour );
-    r1 = boundingRect( contour );
-
-    pts[0].x = r0.x + (r0.width / 2);
-    pts[0].y = r0.y + (r0.height / 2);
-
-    pts[1].x = r1.x + (r1.width / 2);
-    pts[1].y = r1.y + (r1.height / 2);
+public:
+    ContourFeatureBody( const vector<vector<Point> >& _contours, vector<vector<Point> >& _approx,
+                        vector<ContourFeatures>& _features )
+        : contours( _contours ), approx( _approx ), features( _features ) {}
 
-    pts[2] = moment_check( contour );
-
-    rDiff = boundingRect( pts );
-    double diffRatio = ((rDiff.width / r1.width) + (rDiff.height / r1.height));
-    //cout << "moments\n" << pts[1] << endl << pts[1] << endl << pts[2] << endl << diffRatio << endl;
-    //    cout << "***********************   " << contour.size() << "  " << sum_distanceBtwPoints(contour) <<endl;
-    if( diffRatio > 0.1) return avg_cos;
-
-    for( size_t i = 2; i < contour.size(); i++ )
+    void operator()( const Range& range ) const
     {
-        double cosine = fabs(angle(contour[i], contour[i-2], contour[i-1]));
-
-        double dist0 = distanceBtwPoints( contour[i], contour[i-1] );
-        double dist1 = distanceBtwPoints( contour[i-1], contour[i-2] );
-
-        double diff = std::sqrt((dist0 - dist1) * (dist0 - dist1));
-
+        for( int i = range.start; i < range.end; i++ )
+        {
+            // approximate contour with accuracy proportional
+            // to the contour perimeter
+            approxPolyDP( contours[i], approx[i], 6, true );
+            contourFeatures( approx[i], features[i] );
+        }
+    }
 
-        if( diff < dist0 * 0.4)
-            avg_cos += cosine;
-        // cout << "avg_cos = " << avg_cos << "   " << i <<endl;
+private:
+    const vector<vector<Point> >& contours;
+    vector<vector<Point> >& approx;
+    vector<ContourFeatures>& features;
+};
 
-    }
-    //  cout << "return avg_cos = " << avg_cos / (contour.size()-2) <<endl;
-    return avg_cos / (contour.size()-2) ;
-}
-// returns sequence of squares detected on the image.
-// the sequence is stored in the specified memory storage
-static void findObjects( Mat image, vector<Rect>& objects )
+// returns the bounding rects of the objects detected on the image;
+// with showDebug the fitted shapes are drawn on the image
+static void findObjects( Mat& image, vector<Rect>& objects, bool showDebug = true )
 {
     objects.clear();
     Mat gray;
@@ -122,42 +129,35 @@ static void findObjects( Mat image, vector<Rect>& objects )
     //dilate(gray, gray, Mat(), Point(-1,-1));
     erode( gray, gray, Mat(), Point(-1,-1));
 
-    // find contours and store them all as a list
+    // find contours and store them all as a list; CHAIN_APPROX_SIMPLE only drops
+    // points in the middle of straight runs, which approxPolyDP drops anyway
     vector<vector<Point> > contours;
-    findContours(gray, contours, RETR_LIST, CHAIN_APPROX_NONE);
-
-    vector<Point> approx;
+    findContours(gray, contours, RETR_LIST, CHAIN_APPROX_SIMPLE);
 
     // test each contour
+    vector<vector<Point> > approx( contours.size() );
+    vector<ContourFeatures> features( contours.size() );
+    parallel_for_( Range( 0, (int)contours.size() ), ContourFeatureBody( contours, approx, features ),
+                   std::max( 1.0, contours.size() / 256.0 ) );
+
     for( size_t i = 0; i < contours.size(); i++ )
     {
-        // approximate contour with accuracy proportional
-        // to the contour perimeter
-        approxPolyDP(Mat(contours[i]), approx, 6, true);
-        double avg_cosine_ = avg_cosine( approx );
-
-        if( (approx.size() > 7 && approx.size() < 20 && avg_cosine_ > 0.45 ))// ||
-            //       (approx.size() > 16 && approx.size() < 20 && avg_cosine_ > 0.80) )
+        const ContourFeatures& f = features[i];
+        if( approx[i].size() > 7 && approx[i].size() < 20 && f.avgCosine > 0.45 )
         {
-            //   cout << "**   " << avg_cosine_ << "   " << approx.size() <<endl;
-
-            Rect boundingRect_ = boundingRect(approx);
-            objects.push_back( boundingRect_ );
+            objects.push_back( f.boundingRect );
 
-           bool showDebug = true; // change it true to see detailed drawings
-           if( showDebug )
+            if( showDebug )
             {
-                rectangle( image, fitEllipse_check( approx ),Scalar( (rand()&255), (rand()&255), (rand()&255) ),1 );
-                rectangle( image, boundingRect_,Scalar(0,0,255),1);
-                polylines( image, approx,true,Scalar(0,127,255),2 );
-                circle( image, moment_check( approx ), 4, Scalar(255,0,0), -1, 8, 0 );
+                rectangle( image, f.ellipseRect,Scalar( (rand()&255), (rand()&255), (rand()&255) ),1 );
+                rectangle( image, f.boundingRect,Scalar(0,0,255),1);
+                polylines( image, approx[i],true,Scalar(0,127,255),2 );
+                circle( image, f.massCenter, 4, Scalar(255,0,0), -1, 8, 0 );
             }
-
         }
     }
 }
 
-
 int main(int argc, char** argv)
 {
     cout <<
@@ -257,6 +257,307 @@ for(int i=0;i<nbElt;i++)
 return r;
 }
 
+// Compact Fourier descriptor of a closed contour, computed once: the contour is
+// resampled to nbElt points, transformed with dft(), and only the 2K coefficients
+// of frequencies +-1..K are kept (Z[0] is the position, the rest is fine detail).
+// signature[k] = |Z[k]| / |Z[1]| does not change with rotation, scale or starting
+// point, so comparing signatures is a cheap first test before aligning two shapes.
+struct FourierShape
+{
+    int nbElt;
+    vector<complex<float> > coef;   // Z[1..K] then Z[nbElt-1..nbElt-K]
+    vector<int> freq;               // signed frequency index of each coef: 1..K, -1..-K
+    vector<float> signature;
+};
+
+FourierShape makeFourierShape(vector<Point> &contour, int nbElt = 1024, int K = 20)
+{
+    FourierShape shape;
+    vector<Point2d> c = ReSampleContour(contour, nbElt), Z;
+    dft(c, Z, DFT_SCALE|DFT_REAL_OUTPUT);
+    shape.nbElt = (int)Z.size();
+    K = std::min(K, (shape.nbElt - 1) / 2);
+    for (int side = 0; side < 2; side++)
+        for (int k = 1; k <= K; k++)
+        {
+            int n = side == 0 ? k : shape.nbElt - k;
+            shape.coef.push_back(complex<float>((float)Z[n].x, (float)Z[n].y));
+            shape.freq.push_back(side == 0 ? k : -k);
+        }
+    float ref = K > 0 ? std::max(abs(shape.coef[0]), 1e-6f) : 1.f;
+    for (size_t i = 0; i < shape.coef.size(); i++)
+        shape.signature.push_back(abs(shape.coef[i]) / ref);
+    return shape;
+}
+
+// cos and sin of 2*pi*i/nbElt: the phase of frequency n at an integer shift x is
+// entry (n*x) mod nbElt, so the bracketing scan of the alignment needs no trigonometry.
+struct PhaseTable
+{
+    int nbElt;
+    vector<float> cosv, sinv;
+
+    explicit PhaseTable(int n = 0) : nbElt(n), cosv(n), sinv(n)
+    {
+        double pi = acos(-1.0);
+        for (int i = 0; i < n; i++)
+        {
+            cosv[i] = (float)cos(2*pi*i/n);
+            sinv[i] = (float)sin(2*pi*i/n);
+        }
+    }
+};
+
+// Same fit as MatchDescriptor::AjustementRtSafe(), on the kept coefficients only:
+// find the start point shift alpha, rotation phi and scale s that bring ref onto
+// target. Returns the distance of MatchDescriptor::Distance().
+class FourierAlignment
+{
+public:
+    FourierAlignment(const FourierShape &_ref, const FourierShape &_target, const PhaseTable &_table)
+        : ref(_ref), target(_target), table(_table)
+    {
+        CV_Assert(ref.nbElt == target.nbElt && ref.coef.size() == target.coef.size() && table.nbElt == ref.nbElt);
+        float w = 2*(float)acos(-1.0)/ref.nbElt;
+        int m = (int)ref.coef.size();
+        f.resize(m);
+        C.resize(m);
+        S.resize(m);
+        for (int i = 0; i < m; i++)
+        {
+            complex<float> zz = conj(target.coef[i])*ref.coef[i];
+            f[i] = w*ref.freq[i];
+            C[i] = zz.real();   // rho*cos(psi)
+            S[i] = zz.imag();   // rho*sin(psi)
+        }
+    }
+
+    float fit(float &alphaMin, float &phiMin, float &sMin) const
+    {
+        const int nbElt = ref.nbElt;
+        float distMin = 10000;
+        sMin = 1;
+        alphaMin = 0;
+        phiMin = ref.coef.empty() ? 0 : arg(target.coef[0]/ref.coef[0]);
+
+        // scan integer shifts for sign changes of f(alpha), refine each with rtsafe;
+        // a shift where f is exactly 0 (the same contour) is a root as it is
+        float df, fPrev, fCur;
+        falpha((float)nbElt, &fPrev, &df);
+        for (int x = nbElt - 1; x >= -nbElt; x--)
+        {
+            falpha((float)x, &fCur, &df);
+            if (fCur*fPrev < 0 || fCur == 0)
+            {
+                float alpha = fCur == 0 ? (float)x : rtsafe((float)x, (float)(x + 1), 1e-8f);
+                float phi, s;
+                float dist = evaluate(alpha, phi, s);
+                if (dist < distMin)
+                {
+                    distMin = dist;
+                    alphaMin = alpha;
+                    phiMin = phi;
+                    sMin = s;
+                }
+            }
+            fPrev = fCur;
+        }
+        return distMin;
+    }
+
+    float distance(complex<float> r, float alpha) const
+    {
+        float d = 0;
+        for (size_t n = 0; n < f.size(); n++)
+            d += abs(target.coef[n] - ref.coef[n]*r*complex<float>(cos(alpha*f[n]), sin(alpha*f[n])));
+        return d;
+    }
+
+private:
+    // best rotation and scale for the start point shift alpha, and the distance they give
+    float evaluate(float alpha, float &phi, float &s) const
+    {
+        float s1 = 0, s2 = 0;
+        for (size_t n = 0; n < f.size(); n++)
+        {
+            float c = cos(f[n]*alpha), si = sin(f[n]*alpha);
+            s1 += S[n]*c + C[n]*si;
+            s2 += C[n]*c - S[n]*si;
+        }
+        phi = -atan2(s1, s2);
+        float num = 0, den = 0;
+        for (size_t n = 0; n < f.size(); n++)
+        {
+            float c = cos(f[n]*alpha + phi), si = sin(f[n]*alpha + phi);
+            num += C[n]*c - S[n]*si;    // rho*cos(psi + f*alpha + phi)
+            den += norm(ref.coef[n]);
+        }
+        s = num/den;
+        return s > 0 ? distance(s*complex<float>(cos(phi), sin(phi)), alpha) : 10000;
+    }
+
+    // cos and sin of f[n]*x, from the table when x is a whole number of samples
+    void phase(size_t n, float x, float &c, float &s) const
+    {
+        int xi = (int)x;
+        if ((float)xi == x)
+        {
+            int k = (int)(((long long)ref.freq[n]*xi) % table.nbElt);
+            if (k < 0)
+                k += table.nbElt;
+            c = table.cosv[k];
+            s = table.sinv[k];
+        }
+        else
+        {
+            c = cos(f[n]*x);
+            s = sin(f[n]*x);
+        }
+    }
+
+    void falpha(float x, float *fn, float *df) const
+    {
+        float s1 = 0, s2 = 0, s3 = 0, s4 = 0, ds2 = 0, ds4 = 0;
+        for (size_t n = 0; n < f.size(); n++)
+        {
+            float c, s;
+            phase(n, x, c, s);
+            float rs = S[n]*c + C[n]*s;     // rho*sin(psi + f*x)
+            float rc = C[n]*c - S[n]*s;     // rho*cos(psi + f*x)
+            s1 += rs;
+            s2 += f[n]*rc;
+            s3 += rc;
+            s4 += f[n]*rs;
+            ds2 -= f[n]*f[n]*rs;
+            ds4 += f[n]*f[n]*rc;
+        }
+        // ds1 = s2 and ds3 = -s4
+        *fn = s1*s2 - s3*s4;
+        *df = s2*s2 + s1*ds2 + s4*s4 - s3*ds4;
+    }
+
+    float rtsafe(float x1, float x2, float xacc) const
+    {
+        float df, dx, dxold, fv, fh, fl, temp, xh, xl, rts;
+        falpha(x1, &fl, &df);
+        falpha(x2, &fh, &df);
+        if (fl < 0.0) { xl = x2; xh = x1; }
+        else { xh = x2; xl = x1; }
+        rts = 0.5f*(x1 + x2);
+        dxold = fabs(x2 - x1);
+        dx = dxold;
+        falpha(rts, &fv, &df);
+        for (int j = 1; j <= MAXIT; j++)
+        {
+            if ((((rts - xh)*df - fv)*((rts - xl)*df - fv) >= 0.0) || (fabs(2.0*fv) > fabs(dxold*df)))
+            {
+                dxold = dx;
+                dx = 0.5f*(xh - xl);
+                rts = xl + dx;
+                if (xl == rts) return rts;
+            }
+            else
+            {
+                dxold = dx;
+                dx = fv/df;
+                temp = rts;
+                rts -= dx;
+                if (temp == rts) return rts;
+            }
+            if (fabs(dx) < xacc)
+                return rts;
+            falpha(rts, &fv, &df);
+            if (fv < 0.0) xl = rts;
+            else xh = rts;
+        }
+        return 0.0;
+    }
+
+    const FourierShape &ref, &target;
+    const PhaseTable &table;
+    vector<float> f, C, S;
+};
+
+struct ShapeMatch
+{
+    int index;          // position of the shape in the database
+    float distance, alpha, phi, scale;  // fit of the query onto that shape
+    bool operator<(const ShapeMatch &m) const { return distance < m.distance; }
+};
+
+class AlignBody : public ParallelLoopBody
+{
+public:
+    AlignBody(const vector<FourierShape> &_shapes, const FourierShape &_query, const PhaseTable &_table,
+              vector<ShapeMatch> &_matches)
+        : shapes(_shapes), query(_query), table(_table), matches(_matches) {}
+
+    void operator()(const Range &range) const
+    {
+        for (int i = range.start; i < range.end; i++)
+        {
+            ShapeMatch &m = matches[i];
+            FourierAlignment fa(query, shapes[m.index], table);
+            m.distance = fa.fit(m.alpha, m.phi, m.scale);
+        }
+    }
+
+private:
+    const vector<FourierShape> &shapes;
+    const FourierShape &query;
+    const PhaseTable &table;
+    vector<ShapeMatch> &matches;
+};
+
+// Shapes are described once when added. match() ranks the whole database on the
+// L1 distance between signatures, then only the maxCandidates closest are aligned
+// (in parallel) and sorted on the fitted distance.
+class ShapeDatabase
+{
+public:
+    explicit ShapeDatabase(int _nbElt = 1024, int _K = 20) : nbElt(_nbElt), K(_K), table(_nbElt) {}
+
+    int add(vector<Point> &contour)
+    {
+        shapes.push_back(makeFourierShape(contour, nbElt, K));
+        CV_Assert(shapes.back().nbElt == nbElt);
+        return (int)shapes.size() - 1;
+    }
+
+    int size() const { return (int)shapes.size(); }
+    const FourierShape &shape(int i) const { return shapes[i]; }
+
+    void match(vector<Point> &contour, int maxCandidates, vector<ShapeMatch> &results) const
+    {
+        match(makeFourierShape(contour, nbElt, K), maxCandidates, results);
+    }
+
+    void match(const FourierShape &query, int maxCandidates, vector<ShapeMatch> &results) const
+    {
+        vector<pair<float, int> > ranked(shapes.size());
+        for (size_t i = 0; i < shapes.size(); i++)
+        {
+            float d = 0;
+            for (size_t k = 0; k < query.signature.size(); k++)
+                d += fabs(query.signature[k] - shapes[i].signature[k]);
+            ranked[i] = make_pair(d, (int)i);
+        }
+        int n = std::min(maxCandidates, (int)ranked.size());
+        partial_sort(ranked.begin(), ranked.begin() + n, ranked.end());
+
+        results.resize(n);
+        for (int i = 0; i < n; i++)
+            results[i].index = ranked[i].second;
+        parallel_for_(Range(0, n), AlignBody(shapes, query, table, results));
+        sort(results.begin(), results.end());
+    }
+
+private:
+    int nbElt, K;
+    PhaseTable table;
+    vector<FourierShape> shapes;
+};
+
 int main(int argc, char **argv)
 {
 vector<vector<Point> > contours;
@@ -296,16 +597,17 @@ int indRef=1;
 MatchDescriptor md;
 md.sContour=Z[indRef];
 md.nbDesFit=20;
-vector<float> alpha,phi,s;
+vector<float> alpha,phi,s,dist;
 vector<vector<Point> > ctrRotated;
 alpha.resize(ctrSelec.size());
 phi.resize(ctrSelec.size());
 s.resize(ctrSelec.size());
+dist.resize(ctrSelec.size());
 
 
 for (int i = 0; i<ctrSelec.size();i++)
 {
-    md.AjustementRtSafe(Z[i],alpha[i],phi[i],s[i]);
+    dist[i] = md.AjustementRtSafe(Z[i],alpha[i],phi[i],s[i]);
     complex<float> expitheta=s[i]*complex<float>(cos(phi[i]), sin(phi[i]));
     cout<<"Contour "<<indRef<<" with "<<i<< " origin "<< alpha[i]<<" and rotated of "<<phi[i]*180/md.pi<<" and scale "<<s[i]<<" Distance between contour is "<<md.Distance(expitheta,alpha[i])<<" "<<endl;
     for (int j=1;j<Z[i].size();j++)
@@ -321,6 +623,24 @@ for (int i = 0; i<ctrSelec.size();i++)
         c.push_back(Point(z[i][j].x, z[i][j].y));
     ctrRotated.push_back(c);
 }
+
+// same search with the database: each shape is described once, candidates are
+// prefiltered on their signature and aligned in parallel
+ShapeDatabase db(1024, md.nbDesFit);
+for (int i = 0; i<ctrSelec.size();i++)
+    db.add(contours[ctrSelec[i]]);
+vector<ShapeMatch> matches;
+TickMeter tm;
+tm.start();
+db.match(contours[ctrSelec[indRef]], db.size(), matches);
+tm.stop();
+cout << "Database match of contour " << indRef << " in " << tm.getTimeMilli() << " ms" << endl;
+for (size_t i = 0; i < matches.size(); i++)
+{
+    const ShapeMatch &r = matches[i];
+    cout << "  contour " << r.index << " distance " << r.distance << " rotated of " << r.phi*180/md.pi
+         << " scale " << r.scale << " (MatchDescriptor distance " << dist[r.index] << ")" << endl;
+}
 for (int i = 0; i < ctrSelec.size(); i++)
 {
     if (i!=indRef)
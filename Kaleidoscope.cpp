@@ -8,50 +8,115 @@
 using namespace cv;
 using namespace std;
 
-int main()
+// The mirroring geometry only depends on the input size, the output size and the
+// number of segments, so it is baked once into remap tables. Every output pixel
+// is folded by angle into the source wedge (mirrored on every other segment) and
+// scaled back into the input frame, which also replaces the resize. A frame then
+// costs a single parallel remap gather. The number of segments is rounded up to an
+// even one: with an odd count the last wedge would meet the first one unmirrored,
+// leaving a seam.
+class KaleidoscopeEngine
 {
-    Mat img,img2,kal1(400,400,CV_8UC3,Scalar(0,0,0));
-    Mat kal2,add;
-    VideoCapture cap(0);
-    int i=0,j=0;
-    for(;;)
+public:
+    KaleidoscopeEngine( Size _outputSize = Size(400,400), int _segments = 8 )
+        : outputSize(_outputSize), segments(evenSegments(_segments)) {}
+
+    void apply( const Mat& src, Mat& dst )
     {
-        cap>>img;
-        resize(img,img,Size(400,400));
-        for(i=0; i<600; i++)
+        if( src.size() != inputSize )
+            build( src.size() );
+        remap( src, dst, map1, map2, INTER_LINEAR, BORDER_REFLECT );
+    }
+
+    // wedge of the input that gets mirrored around, in input coordinates
+    void wedge( Point& center, Point& edge1, Point& edge2 ) const
+    {
+        float sx = (float)inputSize.width / outputSize.width, sy = (float)inputSize.height / outputSize.height;
+        float cx = outputSize.width * 0.5f, cy = outputSize.height * 0.5f, r = std::min(cx, cy);
+        center = Point( cvRound(cx * sx), cvRound(cy * sy) );
+        edge1 = Point( cvRound((cx + r * std::cos(base)) * sx), cvRound((cy + r * std::sin(base)) * sy) );
+        edge2 = Point( cvRound((cx + r * std::cos(base + step)) * sx), cvRound((cy + r * std::sin(base + step)) * sy) );
+    }
+
+    void setSegments( int n ) { segments = evenSegments(n); inputSize = Size(); }
+    int getSegments() const { return segments; }   // after the rounding
+
+private:
+    static int evenSegments( int n ) { return std::max(n + (n & 1), 2); }
+
+    void build( Size _inputSize )
+    {
+        inputSize = _inputSize;
+        step = (float)(CV_PI * 2 / segments);
+        base = (float)(-CV_PI / 2) - step;   // wedge just left of "12 o'clock", as in the original sample
+
+        Mat mapx( outputSize, CV_32F ), mapy( outputSize, CV_32F );
+        float cx = outputSize.width * 0.5f, cy = outputSize.height * 0.5f;
+        float sx = (float)inputSize.width / outputSize.width, sy = (float)inputSize.height / outputSize.height;
+
+        for( int y = 0; y < outputSize.height; y++ )
         {
-            for(j=0; j<i/3; j++)
+            float* mx = mapx.ptr<float>(y);
+            float* my = mapy.ptr<float>(y);
+            for( int x = 0; x < outputSize.width; x++ )
             {
-                kal1.at<uchar>(Point(i,j))=img.at<uchar>(Point(i,j));//gives 1/8 of img
+                float dx = x - cx, dy = y - cy;
+                float r = std::sqrt(dx * dx + dy * dy);
+                float a = std::atan2(dy, dx) - base;
+                a -= std::floor(a / (2 * (float)CV_PI)) * 2 * (float)CV_PI;
 
-                if(j>i)
-                {
-                    continue;
-                }
-            }
+                int sector = (int)(a / step);
+                float t = a - sector * step;
+                if( sector & 1 )
+                    t = step - t;
 
+                mx[x] = (cx + r * std::cos(base + t)) * sx;
+                my[x] = (cy + r * std::sin(base + t)) * sy;
+            }
         }
-        flip(kal1,kal2,0);
-        addWeighted(kal1,1,kal2,1,0,add);
-        flip(kal2,kal2,1);
-        addWeighted(add,1,kal2,1,0,add);
-        flip(kal2,kal2,0);
-        addWeighted(add,1,kal2,1,0,add);
-        transpose(kal2,kal2);
-        addWeighted(add,1,kal2,1,0,add);
-        flip(kal2,kal2,0);
-        addWeighted(add,1,kal2,1,0,add);
-        flip(kal2,kal2,1);
-        addWeighted(add,1,kal2,1,0,add);
-        flip(kal2,kal2,0);
-        addWeighted(add,1,kal2,1,0,add);
-        line(img,Point(200,0),Point(200,200),Scalar(0,255,255),1);
-        line(img,Point(0,0),Point(200,200),Scalar(0,255,255),1);
-        moveWindow("img",30,30);
-        moveWindow("Kaleidoscope",500,30);
+        convertMaps( mapx, mapy, map1, map2, CV_16SC2 );
+    }
+
+    Size outputSize;
+    Size inputSize;
+    int segments;
+    float step;
+    float base;
+    Mat map1, map2;
+};
+
+int main( int argc, char** argv )
+{
+    int segments = argc > 1 ? atoi(argv[1]) : 8;
+    int size = argc > 2 ? atoi(argv[2]) : 400;
+
+    Mat img, kaleidoscope;
+    VideoCapture cap(0);
+    KaleidoscopeEngine engine( Size(size, size), segments );
+    namedWindow("img");
+    namedWindow("Kaleidoscope");
+    moveWindow("img",30,30);
+    moveWindow("Kaleidoscope",500,30);
+
+    for(;;)
+    {
+        cap>>img;
+        if( img.empty() )
+            break;
+
+        engine.apply( img, kaleidoscope );
+
+        Point center, edge1, edge2;
+        engine.wedge( center, edge1, edge2 );
+        line(img,center,edge1,Scalar(0,255,255),1);
+        line(img,center,edge2,Scalar(0,255,255),1);
         imshow("img",img);
-        imshow("Kaleidoscope",add);
-        waitKey(10);
+        imshow("Kaleidoscope",kaleidoscope);
+
+        int key = waitKey(10);
+        if( key == 27 ) break;
+        if( key == '+' ) engine.setSegments( engine.getSegments() + 2 );
+        if( key == '-' && engine.getSegments() > 2 ) engine.setSegments( engine.getSegments() - 2 );
     }
 
     return 1;
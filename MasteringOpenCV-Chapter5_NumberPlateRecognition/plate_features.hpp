@@ -0,0 +1,142 @@
+// Short descriptor for 144x33 plate candidates, shared by trainSVM.cpp and
+// licence-plate.cpp so that training and inference always agree.
+//
+// Per candidate: the horizontal projection (mean of every row, 33 values), the
+// vertical projection pooled to 36 bins, and a HOG of the candidate shrunk to 64x16
+// (7 blocks of 2x2 cells, 252 values). That is 321 floats instead of 4752 raw
+// pixels. An optional PCA fitted on the training set shrinks it further; it is saved
+// together with the extractor settings.
+//
+// compute() works on a whole batch: all candidates are stacked into one image so the
+// projections are two reduce() calls, the HOG is one compute() call over a strip of
+// windows, and the PCA is one matrix product.
+
+#ifndef PLATE_FEATURES_HPP
+#define PLATE_FEATURES_HPP
+
+#include <opencv2/core.hpp>
+#include <opencv2/imgproc.hpp>
+#include <opencv2/objdetect.hpp>
+#include <algorithm>
+#include <vector>
+
+class PlateFeatureExtractor
+{
+public:
+    enum { PLATE_WIDTH = 144, PLATE_HEIGHT = 33, VERTICAL_BINS = 36, HOG_WIDTH = 64, HOG_HEIGHT = 16 };
+
+    PlateFeatureExtractor()
+        : hog( cv::Size( HOG_WIDTH, HOG_HEIGHT ), cv::Size( 16, 16 ), cv::Size( 8, 8 ), cv::Size( 8, 8 ), 9 ) {}
+
+    int rawSize() const { return PLATE_HEIGHT + VERTICAL_BINS + (int)hog.getDescriptorSize(); }
+    int size() const { return pca.eigenvectors.empty() ? rawSize() : pca.eigenvectors.rows; }
+
+    // plates: 8 bit gray (or float 0..255) candidates, any size; features: one row per plate
+    void compute( const std::vector<cv::Mat>& plates, cv::Mat& features ) const
+    {
+        int n = (int)plates.size();
+        features.create( n, size(), CV_32F );
+        if( n == 0 )
+            return;
+
+        cv::Mat stacked( n * PLATE_HEIGHT, PLATE_WIDTH, CV_8U ), strip( n * HOG_HEIGHT, HOG_WIDTH, CV_8U ), tmp;
+        for( int i = 0; i < n; i++ )
+        {
+            const cv::Mat* p = &plates[i];
+            if( p->depth() != CV_8U )
+            {
+                p->convertTo( tmp, CV_8U );
+                p = &tmp;
+            }
+            cv::Mat dst = stacked.rowRange( i * PLATE_HEIGHT, ( i + 1 ) * PLATE_HEIGHT );
+            if( p->size() == dst.size() )
+                p->copyTo( dst );
+            else
+                cv::resize( *p, dst, dst.size() );
+            cv::resize( dst, strip.rowRange( i * HOG_HEIGHT, ( i + 1 ) * HOG_HEIGHT ), cv::Size( HOG_WIDTH, HOG_HEIGHT ), 0, 0, cv::INTER_AREA );
+        }
+
+        cv::Mat raw( n, rawSize(), CV_32F );
+
+        // projections of the binarized candidates: share of dark pixels per row and per column bin
+        cv::Mat binary, rowMeans, pooled, colMeans;
+        cv::threshold( stacked, binary, 60, 1, cv::THRESH_BINARY_INV );
+        binary.convertTo( binary, CV_32F );
+        cv::reduce( binary, rowMeans, 1, cv::REDUCE_AVG );                    // n*33 x 1
+        cv::resize( binary, pooled, cv::Size( VERTICAL_BINS, n * PLATE_HEIGHT ), 0, 0, cv::INTER_AREA );
+        for( int i = 0; i < n; i++ )
+        {
+            float* f = raw.ptr<float>( i );
+            const float* rm = rowMeans.ptr<float>( i * PLATE_HEIGHT );
+            for( int y = 0; y < PLATE_HEIGHT; y++ )
+                f[y] = rm[y];
+            cv::reduce( pooled.rowRange( i * PLATE_HEIGHT, ( i + 1 ) * PLATE_HEIGHT ), colMeans, 0, cv::REDUCE_AVG, CV_32F );
+            const float* cm = colMeans.ptr<float>();
+            for( int x = 0; x < VERTICAL_BINS; x++ )
+                f[PLATE_HEIGHT + x] = cm[x];
+        }
+
+        // one HOG pass over the strip, one window per candidate
+        std::vector<cv::Point> locations( n );
+        for( int i = 0; i < n; i++ )
+            locations[i] = cv::Point( 0, i * HOG_HEIGHT );
+        std::vector<float> descriptors;
+        hog.compute( strip, descriptors, cv::Size(), cv::Size(), locations );
+        int hogSize = (int)hog.getDescriptorSize();
+        for( int i = 0; i < n; i++ )
+            std::copy( descriptors.begin() + i * hogSize, descriptors.begin() + ( i + 1 ) * hogSize,
+                       raw.ptr<float>( i ) + PLATE_HEIGHT + VERTICAL_BINS );
+
+        project( raw, features );
+    }
+
+    // raw features (rows, rawSize() wide) to features, through the PCA when there is one
+    void project( const cv::Mat& raw, cv::Mat& features ) const
+    {
+        if( pca.eigenvectors.empty() )
+            raw.copyTo( features );
+        else
+            pca.project( raw, features );
+    }
+
+    void compute( const cv::Mat& plate, cv::Mat& features ) const
+    {
+        compute( std::vector<cv::Mat>( 1, plate ), features );
+    }
+
+    // fits the projection on raw training features (rows), keeping "components" axes
+    void fitPca( const cv::Mat& rawFeatures, int components )
+    {
+        pca = cv::PCA( rawFeatures, cv::noArray(), cv::PCA::DATA_AS_ROW, components );
+    }
+
+    void clearPca() { pca = cv::PCA(); }
+
+    void write( cv::FileStorage& fs ) const
+    {
+        fs << "{" << "rawSize" << rawSize();
+        if( !pca.eigenvectors.empty() )
+            fs << "pca_mean" << pca.mean << "pca_eigenvectors" << pca.eigenvectors << "pca_eigenvalues" << pca.eigenvalues;
+        fs << "}";
+    }
+
+    bool read( const cv::FileNode& node )
+    {
+        if( node.empty() || (int)node["rawSize"] != rawSize() )
+            return false;
+        clearPca();
+        if( !node["pca_mean"].empty() )
+        {
+            node["pca_mean"] >> pca.mean;
+            node["pca_eigenvectors"] >> pca.eigenvectors;
+            node["pca_eigenvalues"] >> pca.eigenvalues;
+        }
+        return true;
+    }
+
+private:
+    cv::HOGDescriptor hog;
+    cv::PCA pca;
+};
+
+#endif
@@ -0,0 +1,167 @@
+// Binary training file for the plate SVM, written next to (or instead of) SVM.xml.
+//
+// Layout, little endian:
+//   64 byte header (SvmDatasetHeader)
+//   rows x cols float32 samples, row major, starting at header.dataOffset
+//   rows int32 labels, starting at header.labelOffset
+// Both offsets are 64 byte aligned, so the file can be memory mapped and the samples
+// wrapped in a Mat header without a copy:
+//
+//     MappedSvmDataset set( "SVM.bin" );
+//     svm->train( ml::TrainData::create( set.data(), ml::ROW_SAMPLE, set.labels() ) );
+//
+// readSvmDataset() reads it into Mats of its own instead, with 64 bit offsets on every
+// platform, so files above 2 GB load on Windows and 32 bit builds too.
+
+#ifndef SVM_DATASET_HPP
+#define SVM_DATASET_HPP
+
+#include <opencv2/core.hpp>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <stdint.h>
+#include "../mapped_file.hpp"
+
+struct SvmDatasetHeader
+{
+    char magic[8];          // "PLATESVM"
+    uint32_t version;
+    uint32_t rows;
+    uint32_t cols;
+    uint32_t reserved0;
+    uint64_t dataOffset;
+    uint64_t labelOffset;
+    uint8_t reserved[24];
+};
+
+static_assert( sizeof(SvmDatasetHeader) == 64, "SvmDatasetHeader must stay 64 bytes" );
+
+static const char SVM_DATASET_MAGIC[8] = { 'P', 'L', 'A', 'T', 'E', 'S', 'V', 'M' };
+static const uint32_t SVM_DATASET_VERSION = 1;
+
+inline uint64_t svmDatasetAlign( uint64_t offset ) { return ( offset + 63 ) & ~(uint64_t)63; }
+
+// data: CV_32FC1 samples, one per row; labels: CV_32SC1 column, one per sample
+inline bool writeSvmDataset( const std::string& path, const cv::Mat& data, const cv::Mat& labels )
+{
+    CV_Assert( data.type() == CV_32FC1 && labels.type() == CV_32SC1 && labels.total() == (size_t)data.rows );
+
+    SvmDatasetHeader header;
+    memset( &header, 0, sizeof(header) );
+    memcpy( header.magic, SVM_DATASET_MAGIC, sizeof(header.magic) );
+    header.version = SVM_DATASET_VERSION;
+    header.rows = data.rows;
+    header.cols = data.cols;
+    header.dataOffset = svmDatasetAlign( sizeof(header) );
+    header.labelOffset = svmDatasetAlign( header.dataOffset + (uint64_t)data.rows * data.cols * sizeof(float) );
+
+    FILE* f = fopen( path.c_str(), "wb" );
+    if( !f )
+        return false;
+    static const char zeros[64] = { 0 };
+    bool ok = fwrite( &header, sizeof(header), 1, f ) == 1;
+    ok = ok && fwrite( zeros, 1, (size_t)( header.dataOffset - sizeof(header) ), f ) == header.dataOffset - sizeof(header);
+    for( int i = 0; ok && i < data.rows; i++ )
+        ok = fwrite( data.ptr<float>( i ), sizeof(float), data.cols, f ) == (size_t)data.cols;
+    uint64_t end = header.dataOffset + (uint64_t)data.rows * data.cols * sizeof(float);
+    ok = ok && fwrite( zeros, 1, (size_t)( header.labelOffset - end ), f ) == header.labelOffset - end;
+    cv::Mat labelsCont = labels.isContinuous() ? labels : labels.clone();
+    ok = ok && fwrite( labelsCont.ptr<int>(), sizeof(int), data.rows, f ) == (size_t)data.rows;
+    return fclose( f ) == 0 && ok;
+}
+
+inline bool readSvmDatasetHeader( FILE* f, SvmDatasetHeader& header )
+{
+    return fread( &header, sizeof(header), 1, f ) == 1 &&
+           memcmp( header.magic, SVM_DATASET_MAGIC, sizeof(header.magic) ) == 0 &&
+           header.version == SVM_DATASET_VERSION;
+}
+
+// fseek with a 64 bit offset, whatever the size of long
+inline bool svmDatasetSeek( FILE* f, uint64_t offset )
+{
+#ifdef _WIN32
+    return _fseeki64( f, (__int64)offset, SEEK_SET ) == 0;
+#else
+    return fseeko( f, (off_t)offset, SEEK_SET ) == 0;
+#endif
+}
+
+// reads the whole file, one fread per block
+inline bool readSvmDataset( const std::string& path, cv::Mat& data, cv::Mat& labels )
+{
+    FILE* f = fopen( path.c_str(), "rb" );
+    if( !f )
+        return false;
+    SvmDatasetHeader header;
+    bool ok = readSvmDatasetHeader( f, header );
+    if( ok )
+    {
+        data.create( header.rows, header.cols, CV_32FC1 );
+        labels.create( header.rows, 1, CV_32SC1 );
+        ok = svmDatasetSeek( f, header.dataOffset ) &&
+             fread( data.ptr<float>(), sizeof(float), data.total(), f ) == data.total() &&
+             svmDatasetSeek( f, header.labelOffset ) &&
+             fread( labels.ptr<int>(), sizeof(int), labels.total(), f ) == labels.total();
+    }
+    fclose( f );
+    return ok;
+}
+
+// The file mapped read only: data() and labels() point into the mapping, they must not
+// be written to or used after the MappedSvmDataset is closed (clone() them to keep them).
+class MappedSvmDataset
+{
+public:
+    MappedSvmDataset() {}
+    explicit MappedSvmDataset( const std::string& path ) { open( path ); }
+
+    bool open( const std::string& path )
+    {
+        close();
+        if( !file.open( path ) )
+            return false;
+        uchar* base = file.data();
+        size_t length = file.size();
+        SvmDatasetHeader header;
+        bool ok = length >= sizeof(header);
+        if( ok )
+        {
+            memcpy( &header, base, sizeof(header) );
+            uint64_t dataEnd = header.dataOffset + (uint64_t)header.rows * header.cols * sizeof(float);
+            ok = memcmp( header.magic, SVM_DATASET_MAGIC, sizeof(header.magic) ) == 0 &&
+                 header.version == SVM_DATASET_VERSION &&
+                 header.dataOffset % 64 == 0 && header.labelOffset % 64 == 0 &&
+                 dataEnd <= header.labelOffset && header.labelOffset + (uint64_t)header.rows * sizeof(int) <= length;
+        }
+        if( !ok )
+        {
+            close();
+            return false;
+        }
+        samples = cv::Mat( header.rows, header.cols, CV_32FC1, base + header.dataOffset );
+        classes = cv::Mat( header.rows, 1, CV_32SC1, base + header.labelOffset );
+        return true;
+    }
+
+    void close()
+    {
+        samples.release();
+        classes.release();
+        file.close();
+    }
+
+    bool isOpened() const { return file.isOpened(); }
+    const cv::Mat& data() const { return samples; }
+    const cv::Mat& labels() const { return classes; }
+
+private:
+    MappedFile file;
+    cv::Mat samples, classes;
+
+    MappedSvmDataset( const MappedSvmDataset& );
+    MappedSvmDataset& operator=( const MappedSvmDataset& );
+};
+
+#endif
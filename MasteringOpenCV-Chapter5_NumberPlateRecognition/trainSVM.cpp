@@ -1,10 +1,66 @@
 
 #include <highgui.hpp>
+#include <opencv2/imgproc.hpp>
 #include <iostream>
+#include <sstream>
+#include <memory>
+#include "svm_dataset.hpp"
+#include "plate_features.hpp"
+#include "../result_cache.hpp"
 
 using namespace std;
 using namespace cv;
 
+// Decodes one sample per row straight into the preallocated training matrix.
+// Rows whose image cannot be read are flagged and dropped afterwards. With a cache, a
+// file seen before is copied from it instead: its sample and, when raw is not empty,
+// its raw compact features.
+class LoadSamplesBody : public ParallelLoopBody
+{
+public:
+    LoadSamplesBody( const vector<string>& _files, Size _size, Mat& _data, Mat& _raw, vector<uchar>& _loaded,
+                     ResultCache* _cache, const vector<ResultCache::Key>& _keys, vector<uchar>& _cached )
+        : files(_files), size(_size), data(_data), raw(_raw), loaded(_loaded), cache(_cache), keys(_keys), cached(_cached) {}
+
+    void operator()( const Range& range ) const
+    {
+        Mat resized;
+        vector<Mat> fields;
+        for( int i = range.start; i < range.end; i++ )
+        {
+            if( cache && cache->lookup( keys[i], fields ) && fields.size() == ( raw.empty() ? 1u : 2u ) )
+            {
+                fields[0].copyTo( data.row( i ) );
+                if( !raw.empty() )
+                    fields[1].copyTo( raw.row( i ) );
+                loaded[i] = cached[i] = 1;
+                continue;
+            }
+            Mat img = imread( files[i], 0 );
+            loaded[i] = !img.empty();
+            if( img.empty() )
+                continue;
+            if( img.size() != size )
+            {
+                resize( img, resized, size );
+                img = resized;
+            }
+            Mat row = data.row( i ).reshape( 1, size.height );
+            img.convertTo( row, CV_32FC1 );
+        }
+    }
+
+private:
+    const vector<string>& files;
+    Size size;
+    Mat& data;
+    Mat& raw;
+    vector<uchar>& loaded;
+    ResultCache* cache;
+    const vector<ResultCache::Key>& keys;
+    vector<uchar>& cached;
+};
+
 int main ( int argc, char** argv )
 {
     cout << "OpenCV Training SVM Automatic Number Plate Recognition\n";
@@ -16,6 +72,10 @@ int main ( int argc, char** argv )
     int numNoPlates;
     int imageWidth=144;
     int imageHeight=33;
+    string format = "both";
+    bool compact = false;
+    int pcaComponents = 0;
+    string cachePath;
 
     //Check if user specify image to process
     if(argc >= 5 )
@@ -24,50 +84,158 @@ int main ( int argc, char** argv )
         numNoPlates= atoi(argv[2]);
         path_Plates= argv[3];
         path_NoPlates= argv[4];
+        for( int i = 5; i < argc; i++ )
+        {
+            string arg = argv[i];
+            if( arg.compare(0, 9, "--format=") == 0 )
+                format = arg.substr(9);
+            else if( arg == "--features=compact" )
+                compact = true;
+            else if( arg.compare(0, 6, "--pca=") == 0 )
+                pcaComponents = atoi(arg.c_str() + 6);
+            else if( arg.compare(0, 8, "--cache=") == 0 )
+                cachePath = arg.substr(8);
+        }
 
     }else{
-        cout << "Usage:\n" << argv[0] << " <num Plate Files> <num Non Plate Files> <path to plate folder files> <path to non plate files> \n";
+        cout << "Usage:\n" << argv[0] << " <num Plate Files> <num Non Plate Files> <path to plate folder files> <path to non plate files> [--format=xml|bin|both] [--features=compact] [--pca=N] [--cache=<file>]\n";
+        cout << "bin writes SVM.bin, see svm_dataset.hpp\n";
+        cout << "--features=compact stores projections + HOG (plate_features.hpp) instead of raw pixels,\n";
+        cout << "--pca=N also fits an N component PCA on them; the extractor is saved as PlateFeatures\n";
+        cout << "--cache=<file> keeps the samples and features of every image there, so a rerun only decodes new or changed ones\n";
         return 0;
     }
 
-    Mat classes;//(numPlates+numNoPlates, 1, CV_32FC1);
-    Mat trainingData;//(numPlates+numNoPlates, imageWidth*imageHeight, CV_32FC1 );
-
-    Mat trainingImages;
+    vector<string> files;
     vector<int> trainingLabels;
-
     for(int i=0; i< numPlates; i++)
     {
-
         stringstream ss(stringstream::in | stringstream::out);
         ss << path_Plates << i << ".jpg";
-        Mat img=imread(ss.str(), 0);
-        imshow("pos",img);
-        img= img.reshape(1, 1);
-        trainingImages.push_back(img);
+        files.push_back(ss.str());
         trainingLabels.push_back(1);
     }
-
     for(int i=0; i< numNoPlates; i++)
     {
         stringstream ss(stringstream::in | stringstream::out);
         ss << path_NoPlates << i << ".jpg";
-        Mat img=imread(ss.str(), 0);
-        img= img.reshape(1, 1);
-        trainingImages.push_back(img);
+        files.push_back(ss.str());
         trainingLabels.push_back(0);
+    }
+
+    // the same extractor licence-plate.cpp rebuilds from the PlateFeatures node
+    PlateFeatureExtractor extractor;
+
+    // the cached results depend on the sample size and on whether features are kept
+    std::unique_ptr<ResultCache> cache;
+    vector<ResultCache::Key> keys;
+    if( !cachePath.empty() )
+    {
+        cache.reset( new ResultCache( cachePath, cv::format( "trainSVM 1 %dx%d compact=%d raw=%d", imageWidth, imageHeight,
+                                                           (int)compact, compact ? extractor.rawSize() : 0 ) ) );
+        keys = cache->keys( vector<String>( files.begin(), files.end() ) );
+    }
 
+    // sized up front from the file count, every row is written by exactly one worker
+    int64 start = getTickCount();
+    Mat trainingData( (int)files.size(), imageWidth*imageHeight, CV_32FC1 ), rawFeatures;
+    if( compact )
+        rawFeatures.create( (int)files.size(), extractor.rawSize(), CV_32FC1 );
+    vector<uchar> loaded( files.size(), 0 ), cached( files.size(), 0 );
+    parallel_for_( Range(0, (int)files.size()), LoadSamplesBody(files, Size(imageWidth, imageHeight), trainingData, rawFeatures,
+                                                                loaded, cache.get(), keys, cached) );
+
+    // the raw features of the samples just decoded, in one batch; then both go to the cache
+    if( compact || cache )
+    {
+        vector<int> fresh;
+        vector<Mat> samples;
+        for( size_t i = 0; i < files.size(); i++ )
+            if( loaded[i] && !cached[i] )
+            {
+                fresh.push_back( (int)i );
+                samples.push_back( trainingData.row( (int)i ).reshape( 1, imageHeight ) );
+            }
+        Mat features;
+        if( compact )
+            extractor.compute( samples, features );
+        for( size_t k = 0; k < fresh.size(); k++ )
+        {
+            vector<Mat> fields( 1, trainingData.row( fresh[k] ) );
+            if( compact )
+            {
+                features.row( (int)k ).copyTo( rawFeatures.row( fresh[k] ) );
+                fields.push_back( rawFeatures.row( fresh[k] ) );
+            }
+            if( cache )
+                cache->store( keys[fresh[k]], fields );
+        }
+        if( cache )
+        {
+            cout << cache->hitCount() << " images from the cache, " << fresh.size() << " decoded\n";
+            if( !cache->save() )
+                cout << "cannot write " << cachePath << "\n";
+        }
     }
 
-    Mat(trainingImages).copyTo(trainingData);
-    //trainingData = trainingData.reshape(1,trainingData.rows);
-    trainingData.convertTo(trainingData, CV_32FC1);
-    Mat(trainingLabels).copyTo(classes);
+    // drop the samples that failed to load, keeping the order
+    int rows = 0;
+    for( size_t i = 0; i < files.size(); i++ )
+    {
+        if( !loaded[i] )
+        {
+            cout << "cannot read " << files[i] << ", skipped\n";
+            continue;
+        }
+        if( rows != (int)i )
+        {
+            trainingData.row((int)i).copyTo(trainingData.row(rows));
+            if( compact )
+                rawFeatures.row((int)i).copyTo(rawFeatures.row(rows));
+            trainingLabels[rows] = trainingLabels[i];
+        }
+        rows++;
+    }
+    trainingData = trainingData.rowRange(0, rows);
+    trainingLabels.resize(rows);
+    Mat classes = Mat(trainingLabels, true);
+    cout << rows << " samples loaded in " << (getTickCount() - start) / getTickFrequency() << " s\n";
 
-    FileStorage fs("SVM.xml", FileStorage::WRITE);
-    fs << "TrainingData" << trainingData;
-    fs << "classes" << classes;
-    fs.release();
+    if( compact )
+    {
+        start = getTickCount();
+        rawFeatures = rawFeatures.rowRange(0, rows);
+        if( pcaComponents > 0 && pcaComponents < rawFeatures.cols )
+            extractor.fitPca( rawFeatures, pcaComponents );
+        Mat features;
+        extractor.project( rawFeatures, features );
+        trainingData = features;
+        cout << trainingData.cols << " features per sample in " << (getTickCount() - start) / getTickFrequency() << " s\n";
+    }
+
+    if( format == "bin" || format == "both" )
+    {
+        if( !writeSvmDataset("SVM.bin", trainingData, classes) )
+            cout << "cannot write SVM.bin\n";
+        if( compact )
+        {
+            FileStorage fs("SVM_features.yml", FileStorage::WRITE);
+            fs << "PlateFeatures";
+            extractor.write(fs);
+        }
+    }
+    if( format == "xml" || format == "both" )
+    {
+        FileStorage fs("SVM.xml", FileStorage::WRITE);
+        fs << "TrainingData" << trainingData;
+        fs << "classes" << classes;
+        if( compact )
+        {
+            fs << "PlateFeatures";
+            extractor.write(fs);
+        }
+        fs.release();
+    }
 
     return 0;
 }
@@ -1,294 +1,277 @@
 #include <opencv2/opencv.hpp>
+#include <opencv2/core/hal/intrin.hpp>
 #include <iostream>
+#include "philox_noise.hpp"
+#include "image_metrics.hpp"
 using namespace cv;
 using namespace std;
 
 // additional functions/////////////////////////////////////
-void addNoiseSoltPepperMono(Mat& src, Mat& dest,double per)
+// Gaussian noise of sigma, then a share sprate of salt and pepper, in one pass over the
+// interleaved channels; the same image for a seed whatever the number of threads
+void addNoise(Mat&src, Mat& dest, double sigma,double sprate=0.0, uint64 seed=0)
 {
-    cv::RNG rng;
-#pragma omp parallel for
-    for(int j=0;j<src.rows;j++)
-    {
-        uchar* s=src.ptr(j);
-        uchar* d=dest.ptr(j);
-        for(int i=0;i<src.cols;i++)
-        {
-            double a1 = rng.uniform((double)0, (double)1);
-
-            if(a1>per)
-                d[i]=s[i];
-            else
-            {
-                double a2 = rng.uniform((double)0, (double)1);
-                if(a2>0.5)d[i]=0;
-                else d[i]=255;
-            }
-        }
-    }
+    philox::addNoise(src,dest,sigma,sprate,seed);
 }
-void addNoiseMono(Mat& src, Mat& dest,double sigma)
+// PSNR of the gray image, or of the luma of BGR images (as cvtColor BGR2YUV), without
+// converting either image
+double calcPSNR(Mat& src, Mat& dest)
 {
-    Mat s;
-    src.convertTo(s,CV_16S);
-    Mat n(s.size(),CV_16S);
-    randn(n,0,sigma);
-    Mat temp = s+n;
-    temp.convertTo(dest,CV_8U);
+    return metrics::psnr(src,dest,src.channels()==1 ? metrics::ALL_CHANNELS : metrics::LUMA);
 }
-void addNoise(Mat&src, Mat& dest, double sigma,double sprate=0.0)
+////////////////////////////////////////////////////////////////////////////////
+//main implementaion
+
+//weight of a mean squared template distance, shared by both implementations
+static void createWeightTable(vector<double>& weight, int channels, double h, double sigma)
 {
-    if(src.channels()==1)
-    {
-        addNoiseMono(src,dest,sigma);
-        if(sprate!=0)addNoiseSoltPepperMono(dest,dest,sprate);
-        return;
-    }
-    else
+    weight.assign(256*256*channels,0.0);
+    double* w = &weight[0];
+    const double gauss_sd = (sigma == 0.0) ? h :sigma;
+    double gauss_color_coeff = -(1.0/(double)(channels))*(1.0/(h*h));
+    for(int i = 0; i < 256*256*channels; i++ )
     {
-        vector<Mat> s;
-        vector<Mat> d(src.channels());
-        split(src,s);
-        for(int i=0;i<src.channels();i++)
-        {
-            addNoiseMono(s[i],d[i],sigma);
-            if(sprate!=0)addNoiseSoltPepperMono(d[i],d[i],sprate);
-        }
-        cv::merge(d,dest);
+        double v = std::exp( max(i-2.0*gauss_sd*gauss_sd,0.0)*gauss_color_coeff);
+        if(v<0.001)
+            break;//the rest stays 0
+        w[i] = v;
     }
 }
-static double getPSNR(Mat& src, Mat& dest)
+//sum of squared differences of a templeteWindowSize^2 patch, "width" = templeteWindowSize*cn
+//bytes per row; the SIMD version reads up to 7 bytes past each row, see the padding below
+static inline int templateSSD(const uchar* t, const uchar* s, size_t step, int rows, int width)
 {
-    int i,j;
-    double sse,mse,psnr;
-    sse = 0.0;
-
-
-    for(j=0;j<src.rows;j++)
+    int e=0;
+#if CV_SIMD128
+    const int last = (width-1)&~7;
+    v_int32x4 acc = v_setzero_s32();
+    short lanes[8];
+    for(int k=0;k<8;k++) lanes[k] = (short)(last+k<width ? -1 : 0);
+    const v_int16x8 tail = v_load(lanes);
+    for(int n=rows;n--;t+=step,s+=step)
     {
-        uchar* d=dest.ptr(j);
-        uchar* s=src.ptr(j);
-        for(i=0;i<src.cols;i++)
+        int x=0;
+        for(;x<last;x+=8)
         {
-            sse += ((d[i] - s[i])*(d[i] - s[i]));
+            v_int16x8 d = v_reinterpret_as_s16(v_load_expand(t+x)) - v_reinterpret_as_s16(v_load_expand(s+x));
+            acc += v_dotprod(d,d);
         }
+        v_int16x8 d = (v_reinterpret_as_s16(v_load_expand(t+x)) - v_reinterpret_as_s16(v_load_expand(s+x))) & tail;
+        acc += v_dotprod(d,d);
     }
-    if(sse == 0.0)
-    {
-        return 0;
-    }
-    else
-    {
-        mse =sse /(double)(src.cols*src.rows);
-        psnr = 10.0*log10((255*255)/mse);
-        return psnr;
-    }
+    e = v_reduce_sum(acc);
+#else
+    for(int n=rows;n--;t+=step,s+=step)
+        for(int m=0;m<width;m++)
+            e += (s[m]-t[m])*(s[m]-t[m]);
+#endif
+    return e;
 }
 
-double calcPSNR(Mat& src, Mat& dest)
-{
-    Mat ssrc;
-    Mat ddest;
-    if(src.channels()==1)
-    {
-        src.copyTo(ssrc);
-        dest.copyTo(ddest);
-    }
-    else
-    {
-        cvtColor(src,ssrc,CV_BGR2YUV);
-        cvtColor(dest,ddest,CV_BGR2YUV);
-    }
-    double sn   = getPSNR(ssrc,ddest);
-    return sn;
-}
-////////////////////////////////////////////////////////////////////////////////
-//main implementaion
-void nonlocalMeansFilter(Mat& src, Mat& dest, int templeteWindowSize, int searchWindowSize, double h, double sigma=0.0)
+//one kernel for gray and colour: im is the padded source, w the float weight table
+template<int cn>
+static void nonlocalMeansImpl(const Mat& im, Mat& dest, int templeteWindowSize, int searchWindowSize, const float* w)
 {
-    if(templeteWindowSize>searchWindowSize)
-    {
-        cout<<"searchWindowSize should be larger than templeteWindowSize"<<endl;
-        return;
-    }
-    if(dest.empty())dest=Mat::zeros(src.size(),src.type());
-
     const int tr = templeteWindowSize>>1;
     const int sr = searchWindowSize>>1;
-    const int bb = sr+tr;
     const int D = searchWindowSize*searchWindowSize;
     const int H=D/2+1;
-    const double div = 1.0/(double)D;//search area div
     const int tD = templeteWindowSize*templeteWindowSize;
     const double tdiv = 1.0/(double)(tD);//templete square div
+    const int width = templeteWindowSize*cn;
+    const size_t step = im.step;
+    const int csstep = (int)step-searchWindowSize*cn;
 
-    //create large size image for bounding box;
-    Mat im;
-    copyMakeBorder(src,im,bb,bb,bb,bb,cv::BORDER_DEFAULT);
-
-    //weight computation;
-    vector<double> weight(256*256*src.channels());
-    double* w = &weight[0];
-    const double gauss_sd = (sigma == 0.0) ? h :sigma;
-    double gauss_color_coeff = -(1.0/(double)(src.channels()))*(1.0/(h*h));
-    int emax;
-    for(int i = 0; i < 256*256*src.channels(); i++ )
+#pragma omp parallel
     {
-        double v = std::exp( max(i-2.0*gauss_sd*gauss_sd,0.0)*gauss_color_coeff);
-        w[i] = v;
-        if(v<0.001)
-        {
-            emax=i;
-            break;
-        }
-    }
-    for(int i = emax; i < 256*256*src.channels(); i++ )w[i] = 0.0;
-
-    if(src.channels()==3)
-    {
-        const int cstep = im.step-templeteWindowSize*3;
-        const int csstep = im.step-searchWindowSize*3;
-#pragma omp parallel for
-        for(int j=0;j<src.rows;j++)
+        //scratch of this thread, reused for every row
+        vector<int> wwbuf(D);
+        vector<float> nwbuf(D);
+        int* ww = &wwbuf[0];
+        float* nw = &nwbuf[0];
+#pragma omp for
+        for(int j=0;j<dest.rows;j++)
         {
             uchar* d = dest.ptr(j);
-            int* ww=new int[D];
-            double* nw=new double[D];
-            for(int i=0;i<src.cols;i++)
+            for(int i=0;i<dest.cols;i++)
             {
-                double tweight=0.0;
+                float tweight=0.f;
                 //search loop
-                uchar* tprt = im.data +im.step*(sr+j) + 3*(sr+i);
-                uchar* sptr2 = im.data +im.step*j + 3*i;
+                const uchar* tprt = im.data +step*(sr+j) + cn*(sr+i);
+                const uchar* sptr2 = im.data +step*j + cn*i;
                 for(int l=searchWindowSize,count=D-1;l--;)
                 {
-                    uchar* sptr = sptr2 +im.step*(l);
+                    const uchar* sptr = sptr2 +step*(l);
                     for (int k=searchWindowSize;k--;)
                     {
-                        //templete loop
-                        int e=0;
-                        uchar* t = tprt;
-                        uchar* s = sptr+3*k;
-                        for(int n=templeteWindowSize;n--;)
-                        {
-                            for(int m=templeteWindowSize;m--;)
-                            {
-                                // computing color L2 norm
-                                e += (s[0]-t[0])*(s[0]-t[0])+(s[1]-t[1])*(s[1]-t[1])+(s[2]-t[2])*(s[2]-t[2]);//L2 norm
-                                s+=3,t+=3;
-                            }
-                            t+=cstep;
-                            s+=cstep;
-                        }
-                        const int ediv = e*tdiv;
+                        const int ediv = (int)(templateSSD(tprt,sptr+cn*k,step,templeteWindowSize,width)*tdiv);
                         ww[count--]=ediv;
                         //get weighted Euclidean distance
                         tweight+=w[ediv];
                     }
                 }
                 //weight normalization
-                if(tweight==0.0)
+                if(tweight==0.f)
                 {
                     for(int z=0;z<D;z++) nw[z]=0;
                     nw[H]=1;
                 }
                 else
                 {
-                    double itweight=1.0/(double)tweight;
+                    float itweight=1.f/tweight;
                     for(int z=0;z<D;z++) nw[z]=w[ww[z]]*itweight;
                 }
 
-                double r=0.0,g=0.0,b=0.0;
-                uchar* s = im.ptr(j+tr); s+=3*(tr+i);
+                float v[cn] = {0.f};
+                const uchar* s = im.ptr(j+tr); s+=cn*(tr+i);
                 for(int l=searchWindowSize,count=0;l--;)
                 {
-                    for(int k=searchWindowSize;k--;)
-                    {
-                        r += s[0]*nw[count];
-                        g += s[1]*nw[count];
-                        b += s[2]*nw[count++];
-                        s+=3;
-                    }
+                    for(int k=searchWindowSize;k--;count++,s+=cn)
+                        for(int c=0;c<cn;c++)
+                            v[c] += s[c]*nw[count];
                     s+=csstep;
                 }
-                d[0] = saturate_cast<uchar>(r);
-                d[1] = saturate_cast<uchar>(g);
-                d[2] = saturate_cast<uchar>(b);
-                d+=3;
+                for(int c=0;c<cn;c++)
+                    *(d++) = saturate_cast<uchar>(v[c]);
             }//i
-            delete[] ww;
-            delete[] nw;
         }//j
     }
-    else if(src.channels()==1)
+}
+
+void nonlocalMeansFilter(Mat& src, Mat& dest, int templeteWindowSize, int searchWindowSize, double h, double sigma=0.0)
+{
+    if(templeteWindowSize>searchWindowSize)
     {
-        const int cstep = im.step-templeteWindowSize;
-        const int csstep = im.step-searchWindowSize;
+        cout<<"searchWindowSize should be larger than templeteWindowSize"<<endl;
+        return;
+    }
+    CV_Assert(src.type()==CV_8UC1 || src.type()==CV_8UC3);
+    if(dest.empty())dest=Mat::zeros(src.size(),src.type());
+
+    const int tr = templeteWindowSize>>1;
+    const int sr = searchWindowSize>>1;
+    const int bb = sr+tr;
+
+    //create large size image for bounding box; 8 more columns on the right so the
+    //SIMD template rows never read past the buffer
+    Mat im;
+    copyMakeBorder(src,im,bb,bb,bb,bb+8,cv::BORDER_DEFAULT);
+
+    //weight computation;
+    vector<double> weight;
+    createWeightTable(weight,src.channels(),h,sigma);
+    vector<float> w(weight.begin(),weight.end());
+
+    if(src.channels()==3)
+        nonlocalMeansImpl<3>(im,dest,templeteWindowSize,searchWindowSize,&w[0]);
+    else
+        nonlocalMeansImpl<1>(im,dest,templeteWindowSize,searchWindowSize,&w[0]);
+}
+
+//Same filter, but the template distances are box sums: for every search offset the
+//squared difference image is computed once and summed over the template with a
+//running box sum, so a distance costs O(1) instead of templeteWindowSize^2.
+//Weights, normalization and the fallback when all weights are 0 are the ones of
+//nonlocalMeansFilter(); the output differs only by floating point rounding.
+void nonlocalMeansFilterFast(Mat& src, Mat& dest, int templeteWindowSize, int searchWindowSize, double h, double sigma=0.0)
+{
+    if(templeteWindowSize>searchWindowSize)
+    {
+        cout<<"searchWindowSize should be larger than templeteWindowSize"<<endl;
+        return;
+    }
+    CV_Assert(src.type()==CV_8UC1 || src.type()==CV_8UC3);
+    if(dest.empty())dest=Mat::zeros(src.size(),src.type());
+
+    const int cn = src.channels();
+    const int T = templeteWindowSize;
+    const int tr = templeteWindowSize>>1;
+    const int sr = searchWindowSize>>1;
+    const int bb = sr+tr;
+    const int D = searchWindowSize*searchWindowSize;
+    const int H=D/2+1;
+    const double tdiv = 1.0/(double)(T*T);//templete square div
+
+    Mat im;
+    copyMakeBorder(src,im,bb,bb,bb,bb,cv::BORDER_DEFAULT);
+
+    vector<double> weight;
+    createWeightTable(weight,cn,h,sigma);
+    const double* w = &weight[0];
+
+    //template pixels of row j are rows sr+j .. sr+j+T-1 of im, columns sr .. sr+cols+2tr-1
+    const int dcols = src.cols+2*tr;
+    const int band = 16;
+    const int bands = (src.rows+band-1)/band;
 #pragma omp parallel for
-        for(int j=0;j<src.rows;j++)
+    for(int b=0;b<bands;b++)
+    {
+        const int j0 = b*band, j1 = min(src.rows,j0+band);
+        const int n = j1-j0;
+        vector<double> num((size_t)n*src.cols*cn,0.0), den((size_t)n*src.cols,0.0);
+        vector<int> diff((size_t)T*dcols), colsum(dcols);
+
+        for(int l=0;l<searchWindowSize;l++)
+        for(int k=0;k<searchWindowSize;k++)
         {
-            uchar* d = dest.ptr(j);
-            int* ww=new int[D];
-            double* nw=new double[D];
-            for(int i=0;i<src.cols;i++)
+            //squared difference of row p (template row sr+p, candidate row l+p)
+            auto diffRow = [&](int p, int* o)
             {
-                double tweight=0.0;
-                //search loop
-                uchar* tprt = im.data +im.step*(sr+j) + (sr+i);
-                uchar* sptr2 = im.data +im.step*j + i;
-                for(int l=searchWindowSize,count=D-1;l--;)
-                {
-                    uchar* sptr = sptr2 +im.step*(l);
-                    for (int k=searchWindowSize;k--;)
-                    {
-                        //templete loop
-                        int e=0;
-                        uchar* t = tprt;
-                        uchar* s = sptr+k;
-                        for(int n=templeteWindowSize;n--;)
-                        {
-                            for(int m=templeteWindowSize;m--;)
-                            {
-                                // computing color L2 norm
-                                e += (*s-*t)*(*s-*t);
-                                s++,t++;
-                            }
-                            t+=cstep;
-                            s+=cstep;
-                        }
-                        const int ediv = e*tdiv;
-                        ww[count--]=ediv;
-                        //get weighted Euclidean distance
-                        tweight+=w[ediv];
-                    }
-                }
-                //weight normalization
-                if(tweight==0.0)
-                {
-                    for(int z=0;z<D;z++) nw[z]=0;
-                    nw[H]=1;
-                }
+                const uchar* t = im.ptr(sr+p)+sr*cn;
+                const uchar* c = im.ptr(l+p)+k*cn;
+                if(cn==3)
+                    for(int q=0;q<dcols;q++,t+=3,c+=3)
+                        o[q]=(t[0]-c[0])*(t[0]-c[0])+(t[1]-c[1])*(t[1]-c[1])+(t[2]-c[2])*(t[2]-c[2]);
                 else
+                    for(int q=0;q<dcols;q++)
+                        o[q]=(t[q]-c[q])*(t[q]-c[q]);
+            };
+
+            std::fill(colsum.begin(),colsum.end(),0);
+            for(int r=0;r<T;r++)
+            {
+                int* row = &diff[(size_t)r*dcols];
+                diffRow(j0+r,row);
+                for(int q=0;q<dcols;q++) colsum[q]+=row[q];
+            }
+
+            for(int j=j0;j<j1;j++)
+            {
+                double* nm = &num[(size_t)(j-j0)*src.cols*cn];
+                double* dn = &den[(size_t)(j-j0)*src.cols];
+                //center of the candidate patch
+                const uchar* s = im.ptr(j+tr+l)+(tr+k)*cn;
+                int e=0;
+                for(int q=0;q<T;q++) e+=colsum[q];
+                for(int i=0;i<src.cols;i++)
                 {
-                    double itweight=1.0/(double)tweight;
-                    for(int z=0;z<D;z++) nw[z]=w[ww[z]]*itweight;
+                    if(i) e+=colsum[i+T-1]-colsum[i-1];
+                    const double wv = w[(int)(e*tdiv)];
+                    dn[i]+=wv;
+                    for(int c=0;c<cn;c++) nm[i*cn+c]+=wv*s[i*cn+c];
                 }
-
-                double v=0.0;
-                uchar* s = im.ptr(j+tr); s+=(tr+i);
-                for(int l=searchWindowSize,count=0;l--;)
+                if(j+1<j1)
                 {
-                    for(int k=searchWindowSize;k--;)
-                    {
-                        v += *(s++)*nw[count++];
-                    }
-                    s+=csstep;
+                    //slide the window one row down: drop row j, add row j+T
+                    int* row = &diff[(size_t)((j-j0)%T)*dcols];
+                    for(int q=0;q<dcols;q++) colsum[q]-=row[q];
+                    diffRow(j+T,row);
+                    for(int q=0;q<dcols;q++) colsum[q]+=row[q];
                 }
-                 *(d++) = saturate_cast<uchar>(v);
-            }//i
-            delete[] ww;
-            delete[] nw;
-        }//j
+            }
+        }
+
+        for(int j=j0;j<j1;j++)
+        {
+            uchar* d = dest.ptr(j);
+            const double* nm = &num[(size_t)(j-j0)*src.cols*cn];
+            const double* dn = &den[(size_t)(j-j0)*src.cols];
+            //all weights 0: nonlocalMeansFilter() takes search position H
+            const uchar* fallback = im.ptr(j+tr+H/searchWindowSize)+(tr+H%searchWindowSize)*cn;
+            for(int i=0;i<src.cols;i++)
+                for(int c=0;c<cn;c++)
+                    d[i*cn+c] = dn[i]==0.0 ? fallback[i*cn+c] : saturate_cast<uchar>(nm[i*cn+c]*(1.0/dn[i]));
+        }
     }
 }
 
@@ -337,6 +320,23 @@ int main(int argc, char** argv)
     cout<<"nonlocal: "<<calcPSNR(src,dest)<<endl<<endl;
     imwrite("nonlocal.png",dest);
 
+    //(3-1) the box sum version, same result
+    Mat destFast;
+    pre = getTickCount();
+    nonlocalMeansFilterFast(snoise,destFast,3,7,noise_sigma,noise_sigma);
+    cout<<"time: "<<1000.0*(getTickCount()-pre)/(getTickFrequency())<<" ms"<<endl;
+    cout<<"nonlocal fast: "<<calcPSNR(src,destFast)<<" (vs nonlocal: "<<calcPSNR(dest,destFast)<<")"<<endl<<endl;
+
+    //(3-2) 7x7 templates in a 21x21 search window
+    Mat dest7, dest7Fast;
+    pre = getTickCount();
+    nonlocalMeansFilter(snoise,dest7,7,21,noise_sigma,noise_sigma);
+    cout<<"time: "<<1000.0*(getTickCount()-pre)/(getTickFrequency())<<" ms"<<endl;
+    pre = getTickCount();
+    nonlocalMeansFilterFast(snoise,dest7Fast,7,21,noise_sigma,noise_sigma);
+    cout<<"time: "<<1000.0*(getTickCount()-pre)/(getTickFrequency())<<" ms"<<endl;
+    cout<<"nonlocal 7/21: "<<calcPSNR(src,dest7)<<", fast "<<calcPSNR(src,dest7Fast)<<endl<<endl;
+
     imshow("noise", snoise);
     imshow("Non-local Means Filter", dest);
     waitKey();
@@ -1,8 +1,15 @@
-
 #include "opencv2/imgproc.hpp"
 #include "opencv2/highgui.hpp"
 #include <Windows.h>
 #include <iostream>
+#include <vector>
+
+#ifdef USE_DXGI_DUPLICATION
+#include <d3d11.h>
+#include <dxgi1_2.h>
+#pragma comment(lib, "d3d11.lib")
+#pragma comment(lib, "dxgi.lib")
+#endif
 
 using namespace std;
 using namespace cv;
@@ -58,17 +65,266 @@ Mat hwnd2mat(HWND hwnd)
     return src;
 }
 
+// Keeps the window DC, a memory DC and a top-down 32 bit DIB section alive across
+// frames. StretchBlt renders straight into the DIB memory and the returned Mat is a
+// header over that memory, so there is no GetDIBits copy and no allocation per frame.
+// The frame stays valid until the next grab() call or until the object is destroyed.
+class ScreenCapture
+{
+public:
+    ScreenCapture( HWND _hwnd, double _scale = 1.0 )
+        : hwnd(_hwnd), scale(_scale), hwindowDC(0), hmemDC(0), hdib(0), hold(0), srcwidth(0), srcheight(0)
+    {
+        hwindowDC = GetDC(hwnd);
+        hmemDC = CreateCompatibleDC(hwindowDC);
+        SetStretchBltMode(hmemDC, COLORONCOLOR);
+    }
+
+    ~ScreenCapture()
+    {
+        releaseBitmap();
+        DeleteDC(hmemDC);
+        ReleaseDC(hwnd, hwindowDC);
+    }
+
+    // dirty receives the changed regions, GDI can not tell so it is always the whole frame
+    bool grab( Mat& frame, vector<Rect>* dirty = 0 )
+    {
+        RECT windowsize;
+        GetClientRect(hwnd, &windowsize);
+        if( windowsize.right != srcwidth || windowsize.bottom != srcheight )
+        {
+            if( !createBitmap(windowsize.right, windowsize.bottom) )
+                return false;
+        }
+
+        if( dibMat.cols == srcwidth && dibMat.rows == srcheight )
+            BitBlt( hmemDC, 0, 0, dibMat.cols, dibMat.rows, hwindowDC, 0, 0, SRCCOPY );
+        else
+            StretchBlt( hmemDC, 0, 0, dibMat.cols, dibMat.rows, hwindowDC, 0, 0, srcwidth, srcheight, SRCCOPY );
+        GdiFlush();
+
+        frame = dibMat;
+        if( dirty )
+        {
+            dirty->clear();
+            dirty->push_back( Rect(0, 0, dibMat.cols, dibMat.rows) );
+        }
+        return true;
+    }
+
+private:
+    bool createBitmap( int w, int h )
+    {
+        releaseBitmap();
+        srcwidth = w;
+        srcheight = h;
+        int width = cvRound(w * scale), height = cvRound(h * scale);
+        if( width <= 0 || height <= 0 )
+            return false;
+
+        BITMAPINFO bi;
+        memset(&bi, 0, sizeof(bi));
+        bi.bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
+        bi.bmiHeader.biWidth = width;
+        bi.bmiHeader.biHeight = -height;  // top-down rows, matches Mat layout
+        bi.bmiHeader.biPlanes = 1;
+        bi.bmiHeader.biBitCount = 32;
+        bi.bmiHeader.biCompression = BI_RGB;
+
+        void* bits = 0;
+        hdib = CreateDIBSection(hwindowDC, &bi, DIB_RGB_COLORS, &bits, NULL, 0);
+        if( !hdib || !bits )
+            return false;
+        hold = (HBITMAP)SelectObject(hmemDC, hdib);
+        // 32 bit DIB rows are always DWORD aligned, so step is width * 4
+        dibMat = Mat(height, width, CV_8UC4, bits);
+        return true;
+    }
+
+    void releaseBitmap()
+    {
+        dibMat.release();
+        if( hdib )
+        {
+            SelectObject(hmemDC, hold);
+            DeleteObject(hdib);
+            hdib = 0;
+        }
+    }
+
+    HWND hwnd;
+    double scale;
+    HDC hwindowDC;
+    HDC hmemDC;
+    HBITMAP hdib;
+    HBITMAP hold;
+    int srcwidth;
+    int srcheight;
+    Mat dibMat;
+};
+
+#ifdef USE_DXGI_DUPLICATION
+// DXGI Desktop Duplication backend (Windows 8+). The OS reports which rectangles
+// changed since the previous frame; only those are copied to the staging texture
+// and into the persistent output Mat, and they are handed to the caller so
+// downstream processing can skip untouched regions.
+class DesktopDuplication
+{
+public:
+    DesktopDuplication() : device(0), context(0), duplication(0), staging(0) {}
+
+    ~DesktopDuplication()
+    {
+        if( staging ) staging->Release();
+        if( duplication ) duplication->Release();
+        if( context ) context->Release();
+        if( device ) device->Release();
+    }
+
+    bool open( int outputIndex = 0 )
+    {
+        if( FAILED(D3D11CreateDevice(NULL, D3D_DRIVER_TYPE_HARDWARE, NULL, 0, NULL, 0,
+                                     D3D11_SDK_VERSION, &device, NULL, &context)) )
+            return false;
+
+        IDXGIDevice* dxgiDevice = 0;
+        IDXGIAdapter* adapter = 0;
+        IDXGIOutput* output = 0;
+        IDXGIOutput1* output1 = 0;
+        bool ok = SUCCEEDED(device->QueryInterface(__uuidof(IDXGIDevice), (void**)&dxgiDevice)) &&
+                  SUCCEEDED(dxgiDevice->GetAdapter(&adapter)) &&
+                  SUCCEEDED(adapter->EnumOutputs(outputIndex, &output)) &&
+                  SUCCEEDED(output->QueryInterface(__uuidof(IDXGIOutput1), (void**)&output1)) &&
+                  SUCCEEDED(output1->DuplicateOutput(device, &duplication));
+        if( output1 ) output1->Release();
+        if( output ) output->Release();
+        if( adapter ) adapter->Release();
+        if( dxgiDevice ) dxgiDevice->Release();
+        return ok;
+    }
+
+    // returns false on error; when nothing changed within timeout frame is the
+    // previous image and dirty is empty
+    bool grab( Mat& frame, vector<Rect>& dirty, UINT timeoutMs = 16 )
+    {
+        dirty.clear();
+        DXGI_OUTDUPL_FRAME_INFO info;
+        IDXGIResource* resource = 0;
+        HRESULT hr = duplication->AcquireNextFrame(timeoutMs, &info, &resource);
+        if( hr == DXGI_ERROR_WAIT_TIMEOUT )
+        {
+            frame = output;
+            return !output.empty();
+        }
+        if( FAILED(hr) )
+            return false;
+
+        ID3D11Texture2D* texture = 0;
+        resource->QueryInterface(__uuidof(ID3D11Texture2D), (void**)&texture);
+        resource->Release();
+
+        D3D11_TEXTURE2D_DESC desc;
+        texture->GetDesc(&desc);
+        bool fullFrame = false;
+        if( !staging || output.cols != (int)desc.Width || output.rows != (int)desc.Height )
+        {
+            if( staging ) staging->Release();
+            desc.Usage = D3D11_USAGE_STAGING;
+            desc.BindFlags = 0;
+            desc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
+            desc.MiscFlags = 0;
+            desc.MipLevels = 1;
+            desc.ArraySize = 1;
+            device->CreateTexture2D(&desc, NULL, &staging);
+            output.create(desc.Height, desc.Width, CV_8UC4);
+            fullFrame = true;
+        }
+
+        if( info.TotalMetadataBufferSize > 0 )
+            collectChangedRects(info.TotalMetadataBufferSize, dirty);
+        if( fullFrame )
+        {
+            dirty.clear();
+            dirty.push_back(Rect(0, 0, output.cols, output.rows));
+        }
+
+        for( size_t i = 0; i < dirty.size(); i++ )
+        {
+            D3D11_BOX box = { (UINT)dirty[i].x, (UINT)dirty[i].y, 0, (UINT)dirty[i].br().x, (UINT)dirty[i].br().y, 1 };
+            context->CopySubresourceRegion(staging, 0, dirty[i].x, dirty[i].y, 0, texture, 0, &box);
+        }
+        texture->Release();
+
+        D3D11_MAPPED_SUBRESOURCE mapped;
+        if( !dirty.empty() && SUCCEEDED(context->Map(staging, 0, D3D11_MAP_READ, 0, &mapped)) )
+        {
+            Mat mappedMat(output.rows, output.cols, CV_8UC4, mapped.pData, mapped.RowPitch);
+            for( size_t i = 0; i < dirty.size(); i++ )
+                mappedMat(dirty[i]).copyTo(output(dirty[i]));
+            context->Unmap(staging, 0);
+        }
+        duplication->ReleaseFrame();
+        frame = output;
+        return true;
+    }
+
+private:
+    // dirty rects plus the destinations of move rects, clipped to the output
+    void collectChangedRects( UINT bufferSize, vector<Rect>& rects )
+    {
+        metadata.resize(bufferSize);
+        UINT used = 0;
+        Rect bounds(0, 0, output.cols, output.rows);
+        if( SUCCEEDED(duplication->GetFrameMoveRects(bufferSize, (DXGI_OUTDUPL_MOVE_RECT*)&metadata[0], &used)) )
+        {
+            DXGI_OUTDUPL_MOVE_RECT* moves = (DXGI_OUTDUPL_MOVE_RECT*)&metadata[0];
+            for( UINT i = 0; i < used / sizeof(DXGI_OUTDUPL_MOVE_RECT); i++ )
+            {
+                const RECT& r = moves[i].DestinationRect;
+                rects.push_back(Rect(r.left, r.top, r.right - r.left, r.bottom - r.top) & bounds);
+            }
+        }
+        if( SUCCEEDED(duplication->GetFrameDirtyRects(bufferSize, (RECT*)&metadata[0], &used)) )
+        {
+            RECT* r = (RECT*)&metadata[0];
+            for( UINT i = 0; i < used / sizeof(RECT); i++ )
+                rects.push_back(Rect(r[i].left, r[i].top, r[i].right - r[i].left, r[i].bottom - r[i].top) & bounds);
+        }
+    }
+
+    ID3D11Device* device;
+    ID3D11DeviceContext* context;
+    IDXGIOutputDuplication* duplication;
+    ID3D11Texture2D* staging;
+    vector<uchar> metadata;
+    Mat output;
+};
+#endif
+
 int main(int argc, char **argv)
 {
     HWND hwndDesktop = GetDesktopWindow();
-    int key;
+    int key = 0;
+    Mat src;
+    vector<Rect> dirty;
+
+#ifdef USE_DXGI_DUPLICATION
+    DesktopDuplication duplication;
+    bool useDuplication = duplication.open();
+#endif
+    ScreenCapture capture(hwndDesktop);
 
     while( key != 27 )
     {
-        Mat src = hwnd2mat(hwndDesktop);
-        imshow("output", src);
+#ifdef USE_DXGI_DUPLICATION
+        if( !useDuplication || !duplication.grab(src, dirty) )
+#endif
+        capture.grab(src, &dirty);
+
+        if( !src.empty() )
+            imshow("output", src);
         key = waitKey(60);
     }
 
 }
-
@@ -0,0 +1,205 @@
+// Thresholding and rectangular morphology of binary masks in one streaming pass.
+//
+//     BinaryMorph close( MORPH_CLOSE, Size( 9, 9 ) );
+//     close.threshold( gray, mask, 127 );            // threshold( THRESH_BINARY ) + morphologyEx
+//     close.inRange( hsv, lower, upper, mask );      // inRange + morphologyEx
+//     close.apply( src.size(), mask, [&]( int y, uchar* row )
+//     {
+//         ...                                        // any mask, one row at a time, 0 or 255
+//     } );
+//
+// The result is the one of morphologyEx with a rectangular element and the default
+// border, but no full size intermediate image is written: each row of the mask is
+// made, filtered and passed on while it is still in cache. For 0/255 images the
+// running min/max of van Herk / Gil-Werman reduces to run lengths: a pixel survives
+// an erosion when the run of 255 ending at the far edge of its window is as long as
+// the window; a dilation is the same with the runs of 0. Each row is filtered in
+// place with one counter, each column keeps one counter across rows, so every stage
+// of the operation holds one row and one row of counters, and the cost per pixel does
+// not depend on the size of the element. The image is cut into bands run in
+// parallel, each one starting the stream a few rows above its own (the sum of the
+// anchors of the stages) and discarding those rows.
+
+#ifndef BINARY_MORPH_HPP
+#define BINARY_MORPH_HPP
+
+#include <opencv2/core.hpp>
+#include <opencv2/core/utility.hpp>
+#include <opencv2/imgproc.hpp>
+#include <algorithm>
+#include <vector>
+
+namespace binmorph
+{
+
+struct Stage
+{
+    int kw, kh, ax, ay;
+    bool keep;                 // true: erosion, runs of 255 are kept; false: dilation
+};
+
+// in place: row[x] is the extreme of row[x - ax .. x - ax + k - 1], outside the row the
+// pixels are keep, as the default border of erode and dilate
+inline void filterRow( uchar* row, int n, int k, int ax, bool keep )
+{
+    if( k == 1 )
+        return;
+    int lead = k - 1 - ax, run = k;
+    const uchar in = keep ? 255 : 0, out = keep ? 0 : 255;
+    for( int i = 0; i < n + lead; i++ )
+    {
+        bool v = i < n ? row[i] != 0 : keep;
+        run = v == keep ? std::min( run + 1, k ) : 0;
+        if( i >= lead )
+            row[i - lead] = run >= k ? in : out;
+    }
+}
+
+template<typename RowMask> class StreamBody : public cv::ParallelLoopBody
+{
+public:
+    StreamBody( const std::vector<Stage>& _stages, cv::Mat& _dst, RowMask& _mask, int _band )
+        : stages( _stages ), dst( _dst ), mask( _mask ), band( _band ) {}
+
+    void operator()( const cv::Range& range ) const
+    {
+        int rows = dst.rows, cols = dst.cols, above = 0, below = 0;
+        for( size_t i = 0; i < stages.size(); i++ )
+        {
+            above += stages[i].ay;
+            below += stages[i].kh - 1 - stages[i].ay;
+        }
+        for( int b = range.start; b < range.end; b++ )
+        {
+            State st;
+            st.start = b * band;
+            st.end = std::min( rows, st.start + band );
+            st.first = std::max( 0, st.start - above );
+            st.rows.assign( stages.size() + 1, std::vector<uchar>( cols ) );
+            st.count.resize( stages.size() );
+            for( size_t i = 0; i < stages.size(); i++ )
+                st.count[i].assign( cols, stages[i].kh );
+            int last = std::min( rows, st.end + below );
+            for( int y = st.first; y < last; y++ )
+            {
+                mask( y, &st.rows[0][0] );
+                feed( st, 0, y );
+            }
+            // below the image, every stage sees rows of its own border value
+            if( last == rows )
+                for( size_t i = 0; i < stages.size(); i++ )
+                    for( int t = 0; t < stages[i].kh - 1 - stages[i].ay; t++ )
+                    {
+                        std::fill( st.rows[i].begin(), st.rows[i].end(), stages[i].keep ? 255 : 0 );
+                        feed( st, (int)i, rows + t );
+                    }
+        }
+    }
+
+private:
+    struct State
+    {
+        int start, end, first;
+        std::vector<std::vector<uchar> > rows;     // rows[i]: the input row of stage i
+        std::vector<std::vector<int> > count;      // per column run of keep pixels
+    };
+
+    // st.rows[i] is row y of the input of stage i
+    void feed( State& st, int i, int y ) const
+    {
+        if( i == (int)stages.size() )
+        {
+            if( y >= st.start && y < st.end )
+                std::copy( st.rows[i].begin(), st.rows[i].end(), dst.ptr<uchar>( y ) );
+            return;
+        }
+        const Stage& s = stages[i];
+        uchar* row = &st.rows[i][0];
+        filterRow( row, dst.cols, s.kw, s.ax, s.keep );
+        int* count = &st.count[i][0];
+        uchar* out = &st.rows[i + 1][0];
+        const uchar in = s.keep ? 255 : 0, other = s.keep ? 0 : 255;
+        for( int x = 0; x < dst.cols; x++ )
+        {
+            count[x] = ( row[x] != 0 ) == s.keep ? std::min( count[x] + 1, s.kh ) : 0;
+            out[x] = count[x] >= s.kh ? in : other;
+        }
+        // the window of output row o ends at input row y
+        int o = y - ( s.kh - 1 - s.ay );
+        if( o >= st.first )
+            feed( st, i + 1, o );
+    }
+
+    const std::vector<Stage>& stages;
+    cv::Mat& dst;
+    RowMask& mask;
+    int band;
+};
+
+}
+
+class BinaryMorph
+{
+public:
+    // op: MORPH_ERODE, MORPH_DILATE, MORPH_OPEN or MORPH_CLOSE; a rectangle of ksize
+    BinaryMorph( int op, cv::Size ksize, cv::Point anchor = cv::Point( -1, -1 ), int iterations = 1 )
+    {
+        CV_Assert( ksize.width > 0 && ksize.height > 0 );
+        if( op != cv::MORPH_ERODE && op != cv::MORPH_DILATE && op != cv::MORPH_OPEN && op != cv::MORPH_CLOSE )
+            CV_Error( cv::Error::StsBadArg, "BinaryMorph: erode, dilate, open or close" );
+        if( anchor.x < 0 ) anchor.x = ksize.width / 2;
+        if( anchor.y < 0 ) anchor.y = ksize.height / 2;
+        binmorph::Stage erode = { ksize.width, ksize.height, anchor.x, anchor.y, true };
+        binmorph::Stage dilate = erode;
+        dilate.keep = false;
+        // as morphologyEx: each half of open and close is iterated in turn
+        for( int half = 0; half < ( op == cv::MORPH_OPEN || op == cv::MORPH_CLOSE ? 2 : 1 ); half++ )
+        {
+            bool eroding = op == cv::MORPH_ERODE || ( op != cv::MORPH_DILATE && ( op == cv::MORPH_OPEN ) == ( half == 0 ) );
+            for( int i = 0; i < iterations; i++ )
+                stages.push_back( eroding ? erode : dilate );
+        }
+    }
+
+    // mask( y, row ) writes row y of the mask, size.width pixels of 0 or 255; it is
+    // called from several threads, some rows more than once
+    template<typename RowMask> void apply( cv::Size size, cv::Mat& dst, RowMask mask ) const
+    {
+        dst.create( size, CV_8UC1 );
+        int above = 0;
+        for( size_t i = 0; i < stages.size(); i++ )
+            above += stages[i].kh;
+        // bands several times the rows streamed twice, at least 64K pixels
+        int band = std::max( std::max( 4 * above, 16 ), ( 1 << 16 ) / std::max( size.width, 1 ) );
+        int bands = ( size.height + band - 1 ) / band;
+        cv::parallel_for_( cv::Range( 0, bands ), binmorph::StreamBody<RowMask>( stages, dst, mask, band ) );
+    }
+
+    // gray > thresh, as threshold( THRESH_BINARY ) with a maxval of 255
+    void threshold( const cv::Mat& gray, cv::Mat& dst, double thresh ) const
+    {
+        CV_Assert( gray.type() == CV_8UC1 && gray.data != dst.data );
+        int t = cvFloor( thresh );
+        apply( gray.size(), dst, [&]( int y, uchar* row )
+        {
+            const uchar* p = gray.ptr<uchar>( y );
+            for( int x = 0; x < gray.cols; x++ )
+                row[x] = p[x] > t ? 255 : 0;
+        } );
+    }
+
+    void inRange( const cv::Mat& src, const cv::Scalar& lower, const cv::Scalar& upper, cv::Mat& dst ) const
+    {
+        CV_Assert( src.data != dst.data );
+        apply( src.size(), dst, [&]( int y, uchar* row )
+        {
+            cv::Mat out( 1, src.cols, CV_8UC1, row );
+            cv::inRange( src.row( y ), lower, upper, out );
+        } );
+    }
+
+private:
+    std::vector<binmorph::Stage> stages;
+};
+
+#endif
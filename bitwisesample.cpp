@@ -1,4 +1,7 @@
 #include "qa.hpp"
+#include "image_cache.hpp"
+#include "packed_mask.hpp"
+#include <iostream>
 #include "opencv2/imgproc.hpp"
 #include "opencv2/highgui.hpp"
 
@@ -11,11 +14,13 @@ int main( int argc, char** argv )
 }
 #endif
 
+QA_DEMO( bitwisesample )
+
 int bitwisesample( int argc, char** argv )
 {
     // Load two images
-    Mat img1 = imread( "fruits.jpg" );
-    Mat img2 = imread( "opencv-logo.png" );
+    Mat img1 = cachedImread( "fruits.jpg" );
+    Mat img2 = cachedImread( "opencv-logo.png" );
 
     imshow( "image1", img1 );
     imshow( "image2", img2 );
@@ -45,6 +50,57 @@ int bitwisesample( int argc, char** argv )
     imwrite( "result.jpg", img1 );
     imshow( "result", img1);
 
+    // The same mask logic at one bit per pixel: the logo, a zone around it and a
+    // few thresholds of the fruits, combined as a frame of a pipeline would
+    Mat fruitsGray;
+    cvtColor( img1, fruitsGray, COLOR_BGR2GRAY );
+    Mat logoMask( img1.size(), CV_8UC1, Scalar( 0 ) ), zone( img1.size(), CV_8UC1, Scalar( 0 ) );
+    Rect logoRect( ( img1.cols - img2.cols / 2 ) / 2, ( img1.rows - img2.rows / 2 ) / 2, img2.cols / 2, img2.rows / 2 );
+    resize( mask, logoMask( logoRect ), logoRect.size(), 0, 0, INTER_NEAREST );
+    rectangle( zone, logoRect, Scalar( 255 ), -1 );
+
+    PackedMask packedLogo( logoMask ), packedZone( zone ), grown, shrunk;
+    dilate( packedLogo, grown, 3 );
+    erode( packedZone, shrunk, 8 );
+    std::vector<PackedMask> levels;
+    for( int t = 64; t < 256; t += 64 )
+        levels.push_back( PackedMask( fruitsGray > t ) );
+
+    int64 start = getTickCount();
+    PackedMask combined = grown & shrunk;
+    for( size_t i = 0; i < levels.size(); i++ )
+        combined = i % 2 ? combined.andNot( levels[i] ) : combined ^ levels[i];
+    int area = combined.countNonZero();
+    double packedMs = ( getTickCount() - start ) * 1000.0 / getTickFrequency();
+
+    // the 8 bit version for comparison
+    Mat g8, s8, c8;
+    grown.unpack( g8 );
+    shrunk.unpack( s8 );
+    std::vector<Mat> levels8( levels.size() );
+    for( size_t i = 0; i < levels.size(); i++ )
+        levels[i].unpack( levels8[i] );
+    start = getTickCount();
+    bitwise_and( g8, s8, c8 );
+    for( size_t i = 0; i < levels8.size(); i++ )
+    {
+        Mat notLevel;
+        if( i % 2 )
+        {
+            bitwise_not( levels8[i], notLevel );
+            bitwise_and( c8, notLevel, c8 );
+        }
+        else
+            bitwise_xor( c8, levels8[i], c8 );
+    }
+    int area8 = countNonZero( c8 );
+    double byteMs = ( getTickCount() - start ) * 1000.0 / getTickFrequency();
+    std::cout << "combined mask: " << area << " pixels in " << packedMs << " ms packed, " << area8 << " in " << byteMs << " ms as 8 bit masks" << std::endl;
+
+    Mat combinedView;
+    combined.unpack( combinedView );
+    imshow( "combined", combinedView );
+
     moveWindow( "image1", 50, 50 );
     moveWindow( "image2", 100, 100 );
     moveWindow( "result", 690, 50 );
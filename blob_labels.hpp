@@ -0,0 +1,309 @@
+// Connected components with statistics and a distance transform for large binary
+// images, computed in parallel bands or tiles. Shared by the blob separation samples.
+//
+//     BlobLabeler labeler;                           // keep it: its buffers are reused
+//     labeler.distance( bin, dist, 64 );             // exact up to 64 pixels, clamped above
+//     int n = labeler.label( bin, labels, stats, centroids, 8 );
+//
+// label() gives the output of connectedComponentsWithStats: CV_32S labels, 0 for the
+// background, an n x 5 CV_32S stats matrix indexed by CC_STAT_* and an n x 2 CV_64F
+// centroid matrix (row 0 describes the background). The image is split in bands of
+// rows labeled in parallel, each band with its own range of provisional labels in one
+// union-find array; the bands are then joined along their seams, the labels are made
+// consecutive, and a second parallel pass writes the final labels and sums the
+// statistics. Labels are numbered in raster order, as connectedComponents does.
+//
+// distance() runs distanceTransform on tiles grown by a halo of maxDistance pixels.
+// Every distance below maxDistance has its nearest zero inside the grown tile and is
+// the one of the whole image; larger ones are clamped to maxDistance.
+
+#ifndef BLOB_LABELS_HPP
+#define BLOB_LABELS_HPP
+
+#include <opencv2/core.hpp>
+#include <opencv2/core/utility.hpp>
+#include <opencv2/imgproc.hpp>
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <vector>
+
+namespace bloblabels
+{
+
+// union-find over provisional labels, P[i] <= i and P[root] == root
+inline int findRoot( const int* P, int i )
+{
+    while( P[i] < i )
+        i = P[i];
+    return i;
+}
+
+inline void setRoot( int* P, int i, int root )
+{
+    while( P[i] < i )
+    {
+        int j = P[i];
+        P[i] = root;
+        i = j;
+    }
+    P[i] = root;
+}
+
+inline int merge( int* P, int i, int j )
+{
+    int root = findRoot( P, i );
+    if( i != j )
+    {
+        int rj = findRoot( P, j );
+        root = std::min( root, rj );
+        setRoot( P, j, root );
+    }
+    setRoot( P, i, root );
+    return root;
+}
+
+// first pass over a band of rows; a new label needs a background pixel on its left,
+// so a row opens at most (cols + 1) / 2 of them
+class BandLabelBody : public cv::ParallelLoopBody
+{
+public:
+    BandLabelBody( const cv::Mat& _bin, cv::Mat& _labels, int* _P, std::vector<int>& _next, int _bandRows, bool _eight )
+        : bin( _bin ), labels( _labels ), P( _P ), next( _next ), bandRows( _bandRows ), eight( _eight ) {}
+
+    void operator()( const cv::Range& range ) const
+    {
+        const int cols = bin.cols, perRow = ( cols + 1 ) / 2;
+        for( int b = range.start; b < range.end; b++ )
+        {
+            int y0 = b * bandRows, y1 = std::min( y0 + bandRows, bin.rows );
+            int label = 1 + y0 * perRow;
+            for( int y = y0; y < y1; y++ )
+            {
+                const uchar* s = bin.ptr<uchar>( y );
+                int* L = labels.ptr<int>( y );
+                const int* T = y > y0 ? labels.ptr<int>( y - 1 ) : 0;
+                for( int x = 0; x < cols; x++ )
+                {
+                    if( !s[x] )
+                    {
+                        L[x] = 0;
+                        continue;
+                    }
+                    int l = x > 0 ? L[x-1] : 0;
+                    if( T )
+                    {
+                        int n[3] = { T[x], eight && x > 0 ? T[x-1] : 0, eight && x + 1 < cols ? T[x+1] : 0 };
+                        for( int k = 0; k < 3; k++ )
+                            if( n[k] )
+                                l = l ? merge( P, l, n[k] ) : n[k];
+                    }
+                    if( !l )
+                    {
+                        l = label++;
+                        P[l] = l;
+                    }
+                    L[x] = l;
+                }
+            }
+            next[b] = label;
+        }
+    }
+
+private:
+    const cv::Mat& bin;
+    cv::Mat& labels;
+    int* P;
+    std::vector<int>& next;
+    int bandRows;
+    bool eight;
+};
+
+// final labels and per band statistics, summed under the lock
+class BandStatsBody : public cv::ParallelLoopBody
+{
+public:
+    BandStatsBody( cv::Mat& _labels, const int* _P, int _nLabels, int _bandRows,
+                   cv::Mat& _stats, std::vector<double>& _sums, cv::Mutex& _lock )
+        : labels( _labels ), P( _P ), nLabels( _nLabels ), bandRows( _bandRows ), stats( _stats ), sums( _sums ), lock( _lock ) {}
+
+    void operator()( const cv::Range& range ) const
+    {
+        std::vector<int> area( nLabels, 0 ), x0( nLabels, INT_MAX ), y0( nLabels, INT_MAX ), x1( nLabels, -1 ), y1( nLabels, -1 );
+        std::vector<double> sx( nLabels, 0 ), sy( nLabels, 0 );
+        for( int b = range.start; b < range.end; b++ )
+        {
+            int yb = b * bandRows, ye = std::min( yb + bandRows, labels.rows );
+            for( int y = yb; y < ye; y++ )
+            {
+                int* L = labels.ptr<int>( y );
+                for( int x = 0; x < labels.cols; x++ )
+                {
+                    int l = L[x] = P[L[x]];
+                    area[l]++;
+                    x0[l] = std::min( x0[l], x );
+                    x1[l] = std::max( x1[l], x );
+                    y0[l] = std::min( y0[l], y );
+                    y1[l] = std::max( y1[l], y );
+                    sx[l] += x;
+                    sy[l] += y;
+                }
+            }
+        }
+
+        cv::AutoLock l( lock );
+        for( int i = 0; i < nLabels; i++ )
+        {
+            if( !area[i] )
+                continue;
+            int* s = stats.ptr<int>( i );
+            s[cv::CC_STAT_LEFT] = std::min( s[cv::CC_STAT_LEFT], x0[i] );
+            s[cv::CC_STAT_TOP] = std::min( s[cv::CC_STAT_TOP], y0[i] );
+            // WIDTH and HEIGHT hold the right and bottom edges until all bands are in
+            s[cv::CC_STAT_WIDTH] = std::max( s[cv::CC_STAT_WIDTH], x1[i] );
+            s[cv::CC_STAT_HEIGHT] = std::max( s[cv::CC_STAT_HEIGHT], y1[i] );
+            s[cv::CC_STAT_AREA] += area[i];
+            sums[2*i] += sx[i];
+            sums[2*i+1] += sy[i];
+        }
+    }
+
+private:
+    cv::Mat& labels;
+    const int* P;
+    int nLabels, bandRows;
+    cv::Mat& stats;
+    std::vector<double>& sums;
+    cv::Mutex& lock;
+};
+
+class DistanceTileBody : public cv::ParallelLoopBody
+{
+public:
+    DistanceTileBody( const cv::Mat& _bin, cv::Mat& _dist, const std::vector<cv::Rect>& _tiles,
+                      int _halo, float _maxDistance, int _distanceType, int _maskSize )
+        : bin( _bin ), dist( _dist ), tiles( _tiles ), halo( _halo ), maxDistance( _maxDistance ),
+          distanceType( _distanceType ), maskSize( _maskSize ) {}
+
+    void operator()( const cv::Range& range ) const
+    {
+        cv::Mat local;
+        cv::Rect full( 0, 0, bin.cols, bin.rows );
+        for( int i = range.start; i < range.end; i++ )
+        {
+            const cv::Rect& t = tiles[i];
+            cv::Rect grown = cv::Rect( t.x - halo, t.y - halo, t.width + 2 * halo, t.height + 2 * halo ) & full;
+            cv::distanceTransform( bin( grown ), local, distanceType, maskSize );
+            cv::Mat out = dist( t );
+            cv::min( local( t - grown.tl() ), maxDistance, out );
+        }
+    }
+
+private:
+    const cv::Mat& bin;
+    cv::Mat& dist;
+    const std::vector<cv::Rect>& tiles;
+    int halo;
+    float maxDistance;
+    int distanceType, maskSize;
+};
+
+}
+
+class BlobLabeler
+{
+public:
+    explicit BlobLabeler( int _bandRows = 128, int _tileSize = 512 ) : bandRows( std::max( 1, _bandRows ) ), tileSize( _tileSize ) {}
+
+    // bin: CV_8UC1, non zero is foreground; connectivity 4 or 8; returns the number of
+    // labels, background included
+    int label( const cv::Mat& bin, cv::Mat& labels, cv::Mat& stats, cv::Mat& centroids, int connectivity = 8 )
+    {
+        CV_Assert( bin.type() == CV_8UC1 && ( connectivity == 4 || connectivity == 8 ) );
+        labels.create( bin.size(), CV_32S );
+        const int bands = ( bin.rows + bandRows - 1 ) / bandRows, perRow = ( bin.cols + 1 ) / 2;
+        parent.resize( (size_t)bin.rows * perRow + 1 );
+        next.resize( bands );
+        int* P = &parent[0];
+        P[0] = 0;
+        cv::parallel_for_( cv::Range( 0, bands ), bloblabels::BandLabelBody( bin, labels, P, next, bandRows, connectivity == 8 ) );
+
+        // join the first row of every band to the last row of the band above
+        for( int b = 1; b < bands; b++ )
+        {
+            int y = b * bandRows;
+            int* L = labels.ptr<int>( y );
+            const int* T = labels.ptr<int>( y - 1 );
+            for( int x = 0; x < bin.cols; x++ )
+            {
+                if( !L[x] )
+                    continue;
+                if( T[x] )
+                    bloblabels::merge( P, L[x], T[x] );
+                if( connectivity == 8 && x > 0 && T[x-1] )
+                    bloblabels::merge( P, L[x], T[x-1] );
+                if( connectivity == 8 && x + 1 < bin.cols && T[x+1] )
+                    bloblabels::merge( P, L[x], T[x+1] );
+            }
+        }
+
+        // consecutive final labels, in the order of the provisional ones
+        int nLabels = 1;
+        for( int b = 0; b < bands; b++ )
+            for( int i = 1 + b * bandRows * perRow; i < next[b]; i++ )
+                P[i] = P[i] < i ? P[P[i]] : nLabels++;
+
+        stats.create( nLabels, 5, CV_32S );
+        for( int i = 0; i < nLabels; i++ )
+        {
+            int* s = stats.ptr<int>( i );
+            s[cv::CC_STAT_LEFT] = s[cv::CC_STAT_TOP] = INT_MAX;
+            s[cv::CC_STAT_WIDTH] = s[cv::CC_STAT_HEIGHT] = -1;
+            s[cv::CC_STAT_AREA] = 0;
+        }
+        sums.assign( 2 * nLabels, 0. );
+        cv::Mutex lock;
+        cv::parallel_for_( cv::Range( 0, bands ), bloblabels::BandStatsBody( labels, P, nLabels, bandRows, stats, sums, lock ) );
+
+        centroids.create( nLabels, 2, CV_64F );
+        for( int i = 0; i < nLabels; i++ )
+        {
+            int* s = stats.ptr<int>( i );
+            double* c = centroids.ptr<double>( i );
+            if( !s[cv::CC_STAT_AREA] )
+            {
+                // no background pixel at all
+                s[cv::CC_STAT_LEFT] = s[cv::CC_STAT_TOP] = s[cv::CC_STAT_WIDTH] = s[cv::CC_STAT_HEIGHT] = 0;
+                c[0] = c[1] = 0;
+                continue;
+            }
+            s[cv::CC_STAT_WIDTH] -= s[cv::CC_STAT_LEFT] - 1;
+            s[cv::CC_STAT_HEIGHT] -= s[cv::CC_STAT_TOP] - 1;
+            c[0] = sums[2*i] / s[cv::CC_STAT_AREA];
+            c[1] = sums[2*i+1] / s[cv::CC_STAT_AREA];
+        }
+        return nLabels;
+    }
+
+    // dist: CV_32F distance to the nearest zero pixel of bin, clamped to maxDistance
+    void distance( const cv::Mat& bin, cv::Mat& dist, float maxDistance, int distanceType = cv::DIST_L2, int maskSize = 5 )
+    {
+        CV_Assert( bin.type() == CV_8UC1 && maxDistance > 0 );
+        dist.create( bin.size(), CV_32F );
+        tiles.clear();
+        for( int y = 0; y < bin.rows; y += tileSize )
+            for( int x = 0; x < bin.cols; x += tileSize )
+                tiles.push_back( cv::Rect( x, y, tileSize, tileSize ) & cv::Rect( 0, 0, bin.cols, bin.rows ) );
+        int halo = (int)std::ceil( maxDistance ) + 2;
+        cv::parallel_for_( cv::Range( 0, (int)tiles.size() ),
+                           bloblabels::DistanceTileBody( bin, dist, tiles, halo, maxDistance, distanceType, maskSize ) );
+    }
+
+private:
+    int bandRows, tileSize;
+    std::vector<int> parent, next;
+    std::vector<double> sums;
+    std::vector<cv::Rect> tiles;
+};
+
+#endif
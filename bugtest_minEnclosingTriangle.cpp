@@ -105,6 +105,18 @@
 
 namespace minEnclosingTriangle {
 
+//! Parameters a, b and c of the line equation ax + by + c = 0
+struct LineParams {
+    double a, b, c;
+};
+
+//! Buffers reused from one point set to the next
+struct Workspace {
+    std::vector<cv::Point2f> points;
+    std::vector<cv::Point2f> polygon;
+    std::vector<cv::Point2f> triangle;
+};
+
 static void advance(unsigned int &index, unsigned int nrOfPoints);
 
 static void advanceBToRightChain(const std::vector<cv::Point2f> &polygon,
@@ -117,13 +129,13 @@ static double angleOfLineWrtOxAxis(const cv::Point2f &a, const cv::Point2f &b);
 
 static bool areEqualPoints(const cv::Point2f &point1, const cv::Point2f &point2);
 
-static bool areIdenticalLines(const std::vector<double> &side1Params,
-                              const std::vector<double> &side2Params, double sideCExtraParam);
+static bool areIdenticalLines(const LineParams &side1Params,
+                              const LineParams &side2Params, double sideCExtraParam);
 
 static bool areIdenticalLines(double a1, double b1, double c1, double a2, double b2, double c2);
 
-static bool areIntersectingLines(const std::vector<double> &side1Params,
-                                 const std::vector<double> &side2Params,
+static bool areIntersectingLines(const LineParams &side1Params,
+                                 const LineParams &side2Params,
                                  double sideCExtraParam, cv::Point2f &intersectionPoint1,
                                  cv::Point2f &intersectionPoint2);
 
@@ -136,6 +148,9 @@ static void copyResultingTriangle(const std::vector<cv::Point2f> &resultingTrian
 
 static void createConvexHull(cv::InputArray points, std::vector<cv::Point2f> &polygon);
 
+static void createConvexHull(cv::InputArray points, std::vector<cv::Point2f> &polygon,
+                             std::vector<cv::Point2f> &pointsVector);
+
 static double distanceBtwPoints(const cv::Point2f &a, const cv::Point2f &b);
 
 static double distanceFromPointToLine(const cv::Point2f &a, const cv::Point2f &linePointB,
@@ -233,7 +248,7 @@ static bool lessOrEqual(double number1, double number2);
 static void lineEquationDeterminedByPoints(const cv::Point2f &p, const cv::Point2f &q,
                                            double &a, double &b, double &c);
 
-static std::vector<double> lineEquationParameters(const cv::Point2f& p, const cv::Point2f &q);
+static LineParams lineEquationParameters(const cv::Point2f& p, const cv::Point2f &q);
 
 static bool lineIntersection(const cv::Point2f &a1, const cv::Point2f &b1, const cv::Point2f &a2,
                              const cv::Point2f &b2, cv::Point2f &intersection);
@@ -336,9 +351,21 @@ static void findMinEnclosingTriangle(cv::InputArray points,
 * @param polygon    The polygon representing the convex hull of the points
 */
 static void createConvexHull(cv::InputArray points, std::vector<cv::Point2f> &polygon) {
-    cv::Mat pointsMat = points.getMat();
     std::vector<cv::Point2f> pointsVector;
 
+    createConvexHull(points, polygon, pointsVector);
+}
+
+//! Create the convex hull of the given set of points, reusing the storage of pointsVector
+/*!
+* @param points         The provided set of points
+* @param polygon        The polygon representing the convex hull of the points
+* @param pointsVector   Scratch buffer for the points converted to float
+*/
+static void createConvexHull(cv::InputArray points, std::vector<cv::Point2f> &polygon,
+                             std::vector<cv::Point2f> &pointsVector) {
+    cv::Mat pointsMat = points.getMat();
+
     CV_Assert((pointsMat.checkVector(2) > 0) &&
               ((pointsMat.depth() == CV_32F) || (pointsMat.depth() == CV_32S)));
 
@@ -995,12 +1022,12 @@ static bool findGammaIntersectionPoints(const std::vector<cv::Point2f> &polygon,
                                         const cv::Point2f &side1StartVertex, const cv::Point2f &side1EndVertex,
                                         const cv::Point2f &side2StartVertex, const cv::Point2f &side2EndVertex,
                                         cv::Point2f &intersectionPoint1, cv::Point2f &intersectionPoint2) {
-    std::vector<double> side1Params = lineEquationParameters(side1StartVertex, side1EndVertex);
-    std::vector<double> side2Params = lineEquationParameters(side2StartVertex, side2EndVertex);
+    LineParams side1Params = lineEquationParameters(side1StartVertex, side1EndVertex);
+    LineParams side2Params = lineEquationParameters(side2StartVertex, side2EndVertex);
 
     // Compute side C extra parameter using the formula for distance from a point to a line
     double polygonPointHeight = height(polygonPointIndex, polygon, nrOfPoints, c);
-    double distFormulaDenom = sqrt((side2Params[0] * side2Params[0]) + (side2Params[1] * side2Params[1]));
+    double distFormulaDenom = sqrt((side2Params.a * side2Params.a) + (side2Params.b * side2Params.b));
     double sideCExtraParam = 2 * polygonPointHeight * distFormulaDenom;
 
     // Get intersection points if they exist or if lines are identical
@@ -1021,17 +1048,17 @@ static bool findGammaIntersectionPoints(const std::vector<cv::Point2f> &polygon,
 *  OR
 *      ax + by + c (+/-) sideCExtraParam = 0
 *
-* @param side1Params       Vector containing the values of a, b and c for side 1
-* @param side2Params       Vector containing the values of a, b and c for side 2
+* @param side1Params       Values of a, b and c for side 1
+* @param side2Params       Values of a, b and c for side 2
 * @param sideCExtraParam   Extra parameter for the flush edge C
 */
-static bool areIdenticalLines(const std::vector<double> &side1Params,
-                              const std::vector<double> &side2Params, double sideCExtraParam) {
+static bool areIdenticalLines(const LineParams &side1Params,
+                              const LineParams &side2Params, double sideCExtraParam) {
     return (
-        (areIdenticalLines(side1Params[0], side1Params[1], -(side1Params[2]),
-                           side2Params[0], side2Params[1], -(side2Params[2]) - sideCExtraParam)) ||
-        (areIdenticalLines(side1Params[0], side1Params[1], -(side1Params[2]),
-                           side2Params[0], side2Params[1], -(side2Params[2]) + sideCExtraParam))
+        (areIdenticalLines(side1Params.a, side1Params.b, -(side1Params.c),
+                           side2Params.a, side2Params.b, -(side2Params.c) - sideCExtraParam)) ||
+        (areIdenticalLines(side1Params.a, side1Params.b, -(side1Params.c),
+                           side2Params.a, side2Params.b, -(side2Params.c) + sideCExtraParam))
     );
 }
 
@@ -1042,22 +1069,22 @@ static bool areIdenticalLines(const std::vector<double> &side1Params,
 *  OR
 *      ax + by + c (+/-) sideCExtraParam = 0
 *
-* @param side1Params           Vector containing the values of a, b and c for side 1
-* @param side2Params           Vector containing the values of a, b and c for side 2
+* @param side1Params           Values of a, b and c for side 1
+* @param side2Params           Values of a, b and c for side 2
 * @param sideCExtraParam       Extra parameter for the flush edge C
 * @param intersectionPoint1    The first intersection point, if it exists
 * @param intersectionPoint2    The second intersection point, if it exists
 */
-static bool areIntersectingLines(const std::vector<double> &side1Params,
-                                 const std::vector<double> &side2Params,
+static bool areIntersectingLines(const LineParams &side1Params,
+                                 const LineParams &side2Params,
                                  double sideCExtraParam, cv::Point2f &intersectionPoint1,
                                  cv::Point2f &intersectionPoint2) {
     return (
-        (lineIntersection(side1Params[0], side1Params[1], -(side1Params[2]),
-                          side2Params[0], side2Params[1], -(side2Params[2]) - sideCExtraParam,
+        (lineIntersection(side1Params.a, side1Params.b, -(side1Params.c),
+                          side2Params.a, side2Params.b, -(side2Params.c) - sideCExtraParam,
                           intersectionPoint1)) &&
-        (lineIntersection(side1Params[0], side1Params[1], -(side1Params[2]),
-                          side2Params[0], side2Params[1], -(side2Params[2]) + sideCExtraParam,
+        (lineIntersection(side1Params.a, side1Params.b, -(side1Params.c),
+                          side2Params.a, side2Params.b, -(side2Params.c) + sideCExtraParam,
                           intersectionPoint2))
     );
 }
@@ -1070,15 +1097,11 @@ static bool areIntersectingLines(const std::vector<double> &side1Params,
 * @param p One point for defining the equation of the line
 * @param q Second point for defining the equation of the line
 */
-static std::vector<double> lineEquationParameters(const cv::Point2f& p, const cv::Point2f &q) {
-    std::vector<double> lineEquationParameters;
-    double a, b, c;
+static LineParams lineEquationParameters(const cv::Point2f& p, const cv::Point2f &q) {
+    LineParams lineEquationParameters;
 
-    lineEquationDeterminedByPoints(p, q, a, b, c);
-
-    lineEquationParameters.push_back(a);
-    lineEquationParameters.push_back(b);
-    lineEquationParameters.push_back(c);
+    lineEquationDeterminedByPoints(p, q, lineEquationParameters.a, lineEquationParameters.b,
+                                   lineEquationParameters.c);
 
     return lineEquationParameters;
 }
@@ -1564,6 +1587,68 @@ static bool lessOrEqual(double number1, double number2) {
     return ((number1 < number2) || (almostEqual(number1, number2)));
 }
 
+
+///////////////////////////////////// Batch interface ////////////////////////////////////
+
+
+//! Minimum enclosing triangle of one point set, using the buffers of the workspace
+/*!
+* @param points     Set of points (empty sets give an empty triangle and area 0)
+* @param triangle   Minimum area triangle enclosing the points
+* @param ws         Workspace reused between calls
+* @return           Area of the triangle
+*/
+static double findMinEnclosingTriangle(const std::vector<cv::Point> &points,
+                                       std::vector<cv::Point2f> &triangle, Workspace &ws) {
+    double area = 0;
+
+    triangle.clear();
+    if (!points.empty()) {
+        createConvexHull(points, ws.polygon, ws.points);
+        findMinEnclosingTriangle(ws.polygon, ws.triangle, area);
+        triangle.assign(ws.triangle.begin(), ws.triangle.end());
+    }
+
+    return area;
+}
+
+class BatchBody : public cv::ParallelLoopBody {
+public:
+    BatchBody(const std::vector<std::vector<cv::Point> > &_contours,
+              std::vector<std::vector<cv::Point2f> > &_triangles, std::vector<double> &_areas)
+        : contours(_contours), triangles(_triangles), areas(_areas) {}
+
+    void operator()(const cv::Range &range) const {
+        Workspace ws;
+
+        for (int i = range.start; i < range.end; i++) {
+            areas[i] = findMinEnclosingTriangle(contours[i], triangles[i], ws);
+        }
+    }
+
+private:
+    const std::vector<std::vector<cv::Point> > &contours;
+    std::vector<std::vector<cv::Point2f> > &triangles;
+    std::vector<double> &areas;
+};
+
+//! Minimum enclosing triangles of many point sets, split over threads
+/*!
+* @param contours   Point sets, e.g. the output of findContours
+* @param triangles  One triangle per point set
+* @param areas      One area per point set
+*/
+static void findMinEnclosingTriangles(const std::vector<std::vector<cv::Point> > &contours,
+                                      std::vector<std::vector<cv::Point2f> > &triangles,
+                                      std::vector<double> &areas) {
+    triangles.resize(contours.size());
+    areas.resize(contours.size());
+
+    // a few dozen contours per stripe, each stripe allocates one workspace
+    cv::parallel_for_(cv::Range(0, static_cast<int>(contours.size())),
+                      BatchBody(contours, triangles, areas), contours.size() / 32.0);
+}
+
 }
 
 using namespace cv;
@@ -1684,6 +1769,29 @@ int main( int argc, char* argv[] )
         }
     }
 
+    // Benchmark on the test cases: cv::minEnclosingTriangle one by one vs the batch
+    {
+        vector<vector<Point> > sets;
+        for( int r = 0; r < 100; r++ )
+            sets.insert( sets.end(), testpoints.begin(), testpoints.end() );
+
+        vector<Point2f> tri;
+        TickMeter tm1, tm2;
+        tm1.start();
+        for( size_t k = 0; k < sets.size(); k++ )
+            cv::minEnclosingTriangle( sets[k], tri );
+        tm1.stop();
+
+        vector<vector<Point2f> > triangles;
+        vector<double> areas;
+        tm2.start();
+        minEnclosingTriangle::findMinEnclosingTriangles( sets, triangles, areas );
+        tm2.stop();
+
+        cout << sets.size() << " point sets: cv::minEnclosingTriangle " << tm1.getTimeMilli()
+             << " ms, batch " << tm2.getTimeMilli() << " ms\n";
+    }
+
     int i = -1;
 
     for(;;)
@@ -0,0 +1,157 @@
+// Bursts of frames at the rate of the camera, into buffers allocated once.
+//
+//     BurstCapture burst( 60 );                    // 60 frames
+//     if( burst.capture( cap ) )                   // all of them, or false when the camera stops
+//         for( int i = 0; i < burst.size(); i++ )
+//             ... burst.frame( i ), burst.timestamp( i ) ...   // ms since the first frame
+//     for( size_t i = 0; i < burst.gaps().size(); i++ )
+//         ... burst.gaps()[i].index, burst.gaps()[i].missing ...
+//
+// The buffers are all allocated before the first grab of a burst: from the size and
+// type given to the constructor, or else by prepare(), which the first capture() calls
+// and which reads the first non-empty frame, outside the burst, to learn them.
+// retrieve() then decodes into them in place, in the first burst as in the next ones. The loop does
+// nothing between grab() and retrieve() but read the time, so the device is polled as
+// fast as it delivers. (Most backends keep only the last grabbed frame, so the decode
+// of a frame cannot wait past the next grab; it goes straight into its buffer.)
+// Timestamps are CAP_PROP_POS_MSEC when the backend reports increasing values, the
+// time grab() returned otherwise. A gap is an interval of more than 1.5 times the
+// median interval; missing is the number of frame periods it spans, less one.
+// Many webcams deliver a few empty frames after they open, so reads that give nothing
+// are retried, up to maxEmptyReads (30 unless set) per prepare() or capture(), before
+// the camera is taken for stopped.
+
+#ifndef BURST_CAPTURE_HPP
+#define BURST_CAPTURE_HPP
+
+#include <opencv2/core.hpp>
+#include <opencv2/videoio.hpp>
+#include <algorithm>
+#include <vector>
+
+class BurstCapture
+{
+public:
+    struct Gap
+    {
+        int index;             // the first frame after the gap
+        int missing;           // frames dropped before it
+    };
+
+    // frameSize, type: the frames of the camera, to allocate the buffers right away
+    explicit BurstCapture( int frames, cv::Size frameSize = cv::Size(), int type = CV_8UC3 )
+        : maxEmptyReads( 30 ), buffers( frames ), stamps( frames ), backend( frames ), count( 0 ), period( 0 ), backendClock( false )
+    {
+        CV_Assert( frames > 0 );
+        if( frameSize.area() > 0 )
+            allocate( frameSize, type );
+    }
+
+    // allocates the buffers for the frames of cap, from one frame that is not kept;
+    // false when cap gives none
+    bool prepare( cv::VideoCapture& cap )
+    {
+        if( !buffers[0].empty() )
+            return true;
+        cv::Mat probe;
+        for( int empty = 0; empty <= maxEmptyReads; empty++ )
+            if( cap.read( probe ) && !probe.empty() )
+            {
+                allocate( probe.size(), probe.type() );
+                return true;
+            }
+        return false;
+    }
+
+    // false when the capture stops before the burst is full; size() frames are kept
+    bool capture( cv::VideoCapture& cap )
+    {
+        count = 0;
+        if( !prepare( cap ) )
+        {
+            findGaps();
+            return false;
+        }
+        double t0 = (double)cv::getTickCount();
+        int empty = 0;
+        for( int i = 0; i < (int)buffers.size(); )
+        {
+            // allocated by prepare(): decoded in place unless the camera changed its format
+            bool grabbed = cap.grab();
+            stamps[i] = ( (double)cv::getTickCount() - t0 ) * 1000. / cv::getTickFrequency();
+            backend[i] = cap.get( cv::CAP_PROP_POS_MSEC );
+            if( !grabbed || !cap.retrieve( buffers[i] ) || buffers[i].empty() )
+            {
+                if( ++empty > maxEmptyReads )
+                    break;
+                continue;
+            }
+            count = ++i;
+        }
+        backendClock = count > 1;
+        for( int i = 1; i < count; i++ )
+            if( !( backend[i] > backend[i - 1] ) )
+                backendClock = false;
+        if( backendClock )
+            for( int i = 0; i < count; i++ )
+                stamps[i] = backend[i] - backend[0];
+        findGaps();
+        return count == (int)buffers.size();
+    }
+
+    int maxEmptyReads;     // reads giving no frame tolerated per prepare() or capture()
+
+    int size() const { return count; }
+    const cv::Mat& frame( int i ) const { CV_Assert( i >= 0 && i < count ); return buffers[i]; }
+    double timestamp( int i ) const { CV_Assert( i >= 0 && i < count ); return stamps[i]; }
+    // true: the timestamps came from CAP_PROP_POS_MSEC
+    bool backendTimestamps() const { return backendClock; }
+    // the median interval, ms
+    double framePeriod() const { return period; }
+    const std::vector<Gap>& gaps() const { return gapList; }
+    int dropped() const
+    {
+        int n = 0;
+        for( size_t i = 0; i < gapList.size(); i++ )
+            n += gapList[i].missing;
+        return n;
+    }
+
+private:
+    void allocate( cv::Size frameSize, int type )
+    {
+        for( size_t i = 0; i < buffers.size(); i++ )
+            buffers[i].create( frameSize, type );
+    }
+
+    void findGaps()
+    {
+        gapList.clear();
+        period = 0;
+        if( count < 2 )
+            return;
+        std::vector<double> d( count - 1 );
+        for( int i = 1; i < count; i++ )
+            d[i - 1] = stamps[i] - stamps[i - 1];
+        std::vector<double> sorted( d );
+        std::nth_element( sorted.begin(), sorted.begin() + sorted.size() / 2, sorted.end() );
+        period = sorted[sorted.size() / 2];
+        if( period <= 0 )
+            return;
+        for( int i = 1; i < count; i++ )
+            if( d[i - 1] > 1.5 * period )
+            {
+                Gap g = { i, std::max( 1, cvRound( d[i - 1] / period ) - 1 ) };
+                gapList.push_back( g );
+            }
+    }
+
+    std::vector<cv::Mat> buffers;
+    std::vector<double> stamps, backend;   // ms: the burst's, CAP_PROP_POS_MSEC
+    std::vector<Gap> gapList;
+    int count;
+    double period;
+    bool backendClock;
+};
+
+#endif
@@ -42,6 +42,18 @@
 #include "precomp.hpp"
 #include "cap_intelperc.hpp"
 #include "cap_dshow.hpp"
+#include "videoio_ext.hpp"
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <chrono>
+#include <cstdlib>
 
 // All WinRT versions older than 8.0 should provide classes used for video support
 #if defined(WINRT) && !defined(WINRT_8_0)
@@ -552,6 +564,493 @@ static Ptr<IVideoWriter> IVideoWriter_create(const String& filename, int _fourcc
     return iwriter;
 }
 
+/**
+ * Backend probing.
+ * With CAP_ANY, open() of a camera index, a file or a URL starts every compiled in
+ * backend that could open it at the same time, each on a thread of its own. It keeps
+ * the first one in the usual order that opened, as soon as all those before it have
+ * failed, so it picks the backend the sequential search would and waits for the
+ * slowest of the failures rather than for their sum. Each backend is given up on
+ * after OPENCV_VIDEOIO_PROBE_TIMEOUT_MS (10000 unless set) and counts as failed from
+ * then on. A backend cannot be interrupted while it opens, so the ones given up on or
+ * beaten are abandoned rather than cancelled: their threads finish on their own and
+ * release whatever they opened, and the end of the process waits for them.
+ *
+ * The camera backends that open the same system video device (DirectShow, MSMF, V4L,
+ * Unicap, QuickTime, AVFoundation) get in each other's way when they open it at once,
+ * so they are tried one after the other, the next one starting when the one before
+ * fails or times out; the vendor SDK backends, which own their devices, probe next to
+ * them. The COM based Windows backends (DirectShow, MSMF, VFW) belong to the thread
+ * that created them, so they are tried on the calling thread, one after the other,
+ * while the others probe. They are the exception to the timeout: nothing can give up
+ * on a call the calling thread is making itself, so a hung DirectShow or MSMF open
+ * still blocks open(), as it does without probing.
+ *
+ * The winner is remembered per camera index, per URL scheme ("rtsp", "http", ...) and
+ * per file extension, and tried alone first the next time: reopening a stream after it
+ * dropped goes straight to the backend that worked. When OPENCV_VIDEOIO_BACKEND_CACHE
+ * names a file, the choices are kept there and survive restarts.
+ */
+struct ProbedCapture
+{
+    Ptr<IVideoCapture> icap;
+    Ptr<CvCapture> cap;
+
+    bool isOpened() const { return (!icap.empty() && icap->isOpened()) || !cap.empty(); }
+};
+
+typedef std::function<ProbedCapture(int)> ProbeOpen;
+
+class BackendCache
+{
+public:
+    static BackendCache& instance()
+    {
+        static BackendCache cache;
+        return cache;
+    }
+
+    // the api that opened key last, -1 when there is none
+    int get(const String& key)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::map<String, int>::const_iterator it = apis.find(key);
+        return it == apis.end() ? -1 : it->second;
+    }
+
+    void put(const String& key, int api)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (apis.count(key) && apis[key] == api)
+            return;
+        apis[key] = api;
+        if (path.empty())
+            return;
+        // keys hold ':' and '/', so they are values of a sequence rather than node names
+        FileStorage fs(path, FileStorage::WRITE);
+        if (!fs.isOpened())
+            return;
+        fs << "backends" << "[";
+        for (std::map<String, int>::const_iterator it = apis.begin(); it != apis.end(); ++it)
+            fs << "{" << "key" << it->first << "api" << it->second << "}";
+        fs << "]";
+    }
+
+private:
+    BackendCache()
+    {
+        const char* p = getenv("OPENCV_VIDEOIO_BACKEND_CACHE");
+        if (!p || !*p)
+            return;
+        path = p;
+        FileStorage fs(path, FileStorage::READ);
+        if (!fs.isOpened())
+            return;
+        FileNode backends = fs["backends"];
+        for (FileNodeIterator it = backends.begin(); it != backends.end(); ++it)
+            apis[(String)(*it)["key"]] = (int)(*it)["api"];
+    }
+
+    String path;
+    std::map<String, int> apis;
+    std::mutex mutex;
+};
+
+static int readProbeTimeoutMs()
+{
+    const char* p = getenv("OPENCV_VIDEOIO_PROBE_TIMEOUT_MS");
+    return p && atoi(p) > 0 ? atoi(p) : 10000;
+}
+
+static int probeTimeoutMs()
+{
+    static const int timeout = readProbeTimeoutMs();
+    return timeout;
+}
+
+static bool isThreadBound(int api)
+{
+#ifdef _WIN32
+    return api == CV_CAP_DSHOW || api == CV_CAP_MSMF || api == CV_CAP_VFW;
+#else
+    (void)api;
+    return false;
+#endif
+}
+
+static String probeKey(int index)
+{
+    return format("camera:%d", index);
+}
+
+static String probeKey(const String& filename)
+{
+    size_t scheme = filename.find("://");
+    if (scheme != String::npos)
+        return filename.substr(0, scheme).toLowerCase();
+    size_t dot = filename.rfind('.'), slash = filename.find_last_of("/\\");
+    if (dot == String::npos || (slash != String::npos && slash > dot))
+        return "file";
+    return "file:" + filename.substr(dot).toLowerCase();
+}
+
+// the camera APIs in the order cvCreateCameraCapture and IVideoCapture_create try them
+static std::vector<int> cameraBackends()
+{
+    const int apis[] =
+    {
+#ifdef HAVE_DSHOW
+        CV_CAP_DSHOW,
+#endif
+#ifdef HAVE_INTELPERC
+        CV_CAP_INTELPERC,
+#endif
+#ifdef HAVE_GPHOTO2
+        CV_CAP_GPHOTO2,
+#endif
+#ifdef HAVE_MSMF
+        CV_CAP_MSMF,
+#endif
+#ifdef HAVE_TYZX
+        CV_CAP_STEREO,
+#endif
+#if defined HAVE_VFW || defined HAVE_LIBV4L || defined HAVE_CAMV4L || defined HAVE_CAMV4L2 || \
+    defined HAVE_VIDEOIO || defined HAVE_GSTREAMER
+        CV_CAP_VFW,         // VFW, V4L and GStreamer V4L
+#endif
+#if defined HAVE_DC1394_2 || defined HAVE_DC1394 || defined HAVE_CMU1394
+        CV_CAP_FIREWIRE,
+#endif
+#ifdef HAVE_MIL
+        CV_CAP_MIL,
+#endif
+#if defined(HAVE_QUICKTIME) || defined(HAVE_QTKIT)
+        CV_CAP_QT,
+#endif
+#ifdef HAVE_UNICAP
+        CV_CAP_UNICAP,
+#endif
+#ifdef HAVE_PVAPI
+        CV_CAP_PVAPI,
+#endif
+#ifdef HAVE_OPENNI
+        CV_CAP_OPENNI,
+#endif
+#ifdef HAVE_OPENNI2
+        CV_CAP_OPENNI2,
+#endif
+#ifdef HAVE_XIMEA
+        CV_CAP_XIAPI,
+#endif
+#ifdef HAVE_AVFOUNDATION
+        CV_CAP_AVFOUNDATION,
+#endif
+#ifdef HAVE_GIGE_API
+        CV_CAP_GIGANETIX,
+#endif
+        -1
+    };
+    return std::vector<int>(apis, apis + sizeof(apis) / sizeof(apis[0]) - 1);
+}
+
+// the file APIs in the order of cvCreateFileCaptureWithPreference, after CAP_ANY, which
+// stands for the IVideoCapture ones (Motion JPEG, GPhoto2)
+static std::vector<int> fileBackends()
+{
+    const int apis[] =
+    {
+        CV_CAP_ANY,
+#ifdef HAVE_FFMPEG
+        CV_CAP_FFMPEG,
+#endif
+#ifdef HAVE_VFW
+        CV_CAP_VFW,
+#endif
+#if defined HAVE_MSMF || defined HAVE_XINE
+        CV_CAP_MSMF,        // MSMF and XINE
+#endif
+#ifdef HAVE_GSTREAMER
+        CV_CAP_GSTREAMER,
+#endif
+#if defined(HAVE_QUICKTIME) || defined(HAVE_QTKIT)
+        CV_CAP_QT,
+#endif
+#ifdef HAVE_AVFOUNDATION
+        CV_CAP_AVFOUNDATION,
+#endif
+#ifdef HAVE_OPENNI
+        CV_CAP_OPENNI,
+#endif
+        CV_CAP_IMAGES
+    };
+    return std::vector<int>(apis, apis + sizeof(apis) / sizeof(apis[0]));
+}
+
+// the abandoned probe threads still running; the end of the process waits for them, so
+// that none is still inside a backend while the library unloads
+class ProbeThreads
+{
+public:
+    // never destroyed: a probe that outlasts the wait at exit still reports to it
+    static ProbeThreads& instance()
+    {
+        static ProbeThreads* threads = new ProbeThreads;
+        return *threads;
+    }
+
+    // at most the probe timeout
+    void wait()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        idle.wait_for(lock, std::chrono::milliseconds(probeTimeoutMs()), [this] { return running == 0; });
+    }
+
+    void started()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        running++;
+    }
+
+    void stopped()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (--running == 0)
+            idle.notify_all();
+    }
+
+private:
+    ProbeThreads() : running(0) {}
+
+    std::mutex mutex;
+    std::condition_variable idle;
+    int running;
+};
+
+static struct ProbeThreadsAtExit
+{
+    ~ProbeThreadsAtExit() { ProbeThreads::instance().wait(); }
+} probeThreadsAtExit;
+
+struct ProbeState
+{
+    std::mutex mutex;
+    std::condition_variable done;
+    std::vector<int> apis;
+    // indices into apis; the members of a lane are opened one after the other
+    std::vector<std::vector<size_t> > lanes;
+    std::vector<ProbedCapture> results;
+    // failed, opened, or given up at its timeout
+    std::vector<uchar> finished;
+    std::vector<uchar> running;
+    std::vector<std::chrono::steady_clock::time_point> deadline;
+    bool abandoned;
+};
+
+// an api before i has opened: i cannot be picked any more; called with the lock held
+static bool beaten(const ProbeState& state, size_t i)
+{
+    for (size_t j = 0; j < i; j++)
+        if (state.results[j].isOpened())
+            return true;
+    return false;
+}
+
+// the members of lane from pos on, each until it returns or the waiter gives up on it
+static void runLane(const std::shared_ptr<ProbeState>& state, const ProbeOpen& open, size_t lane, size_t pos)
+{
+    ProbeState& s = *state;
+    for (size_t k = pos; k < s.lanes[lane].size(); k++)
+    {
+        size_t i = s.lanes[lane][k];
+        {
+            std::lock_guard<std::mutex> lock(s.mutex);
+            if (s.abandoned || beaten(s, i))
+            {
+                s.finished[i] = 1;
+                s.done.notify_all();
+                continue;
+            }
+            s.running[i] = 1;
+            s.deadline[i] = std::chrono::steady_clock::now() + std::chrono::milliseconds(probeTimeoutMs());
+            s.done.notify_all();
+        }
+        ProbedCapture c = open(s.apis[i]);
+        bool givenUp;
+        {
+            std::lock_guard<std::mutex> lock(s.mutex);
+            // given up on: the waiter started the rest of the lane on another thread
+            givenUp = !s.running[i];
+            if (!givenUp)
+            {
+                s.running[i] = 0;
+                if (!s.abandoned && c.isOpened())
+                    s.results[i] = c;
+                s.finished[i] = 1;
+                s.done.notify_all();
+            }
+        }
+        // a loser is released outside the lock: closing a backend can take a while
+        c = ProbedCapture();
+        if (givenUp)
+            return;
+    }
+}
+
+static void startLane(const std::shared_ptr<ProbeState>& state, const ProbeOpen& open, size_t lane, size_t pos)
+{
+    ProbeThreads::instance().started();
+    std::thread([state, open, lane, pos]()
+    {
+        runLane(state, open, lane, pos);
+        ProbeThreads::instance().stopped();
+    }).detach();
+}
+
+// the first result that opened once all before it have failed, -1 while undecided
+static int decide(const ProbeState& state)
+{
+    for (size_t i = 0; i < state.results.size(); i++)
+    {
+        if (state.results[i].isOpened())
+            return (int)i;
+        if (!state.finished[i])
+            return -1;
+    }
+    return -2; // none opened
+}
+
+// the one the sequential search would pick, with the apis in shared opened one after
+// the other and all others at once, each given up on at its own timeout; api: the
+// winner's, -1 when none opened
+static ProbedCapture probeBackends(const std::vector<int>& apis, const std::vector<int>& shared,
+                                   const ProbeOpen& open, int& api)
+{
+    std::shared_ptr<ProbeState> state = std::make_shared<ProbeState>();
+    ProbeState& s = *state;
+    s.apis = apis;
+    s.results.resize(apis.size());
+    s.finished.assign(apis.size(), 0);
+    s.running.assign(apis.size(), 0);
+    s.deadline.resize(apis.size());
+    s.abandoned = false;
+    // lane 0 runs on the calling thread, lane 1 holds the apis that share a device
+    s.lanes.resize(2);
+    for (size_t i = 0; i < apis.size(); i++)
+    {
+        if (isThreadBound(apis[i]))
+            s.lanes[0].push_back(i);
+        else if (std::find(shared.begin(), shared.end(), apis[i]) != shared.end())
+            s.lanes[1].push_back(i);
+        else
+            s.lanes.push_back(std::vector<size_t>(1, i));
+    }
+    for (size_t l = 1; l < s.lanes.size(); l++)
+        if (!s.lanes[l].empty())
+            startLane(state, open, l, 0);
+    // not bounded by the timeout: a COM capture cannot be opened on another thread
+    runLane(state, open, 0, 0);
+
+    std::unique_lock<std::mutex> lock(s.mutex);
+    int best;
+    while ((best = decide(s)) == -1)
+    {
+        // the backends past their timeout count as failed, the rest of their lane goes on
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        std::chrono::steady_clock::time_point next = std::chrono::steady_clock::time_point::max();
+        for (size_t l = 0; l < s.lanes.size(); l++)
+            for (size_t k = 0; k < s.lanes[l].size(); k++)
+            {
+                size_t i = s.lanes[l][k];
+                if (!s.running[i])
+                    continue;
+                if (s.deadline[i] > now)
+                {
+                    next = std::min(next, s.deadline[i]);
+                    continue;
+                }
+                s.running[i] = 0;
+                s.finished[i] = 1;
+                if (k + 1 < s.lanes[l].size())
+                    startLane(state, open, l, k + 1);
+            }
+        if (decide(s) != -1)
+            continue;
+        if (next == std::chrono::steady_clock::time_point::max())
+            s.done.wait(lock);
+        else
+            s.done.wait_until(lock, next);
+    }
+    // the backends still opening release what they get
+    s.abandoned = true;
+    ProbedCapture result;
+    api = -1;
+    if (best >= 0)
+    {
+        result = s.results[best];
+        api = apis[best];
+    }
+    // the other ones that opened are released once the lock is left
+    std::vector<ProbedCapture> losers;
+    losers.swap(s.results);
+    lock.unlock();
+    return result;
+}
+
+// the remembered backend of key alone, then all the others
+static ProbedCapture probeCapture(const String& key, const std::vector<int>& apis, const std::vector<int>& shared,
+                                  const ProbeOpen& open)
+{
+    BackendCache& cache = BackendCache::instance();
+    int api = cache.get(key);
+    std::vector<int> rest;
+    for (size_t i = 0; i < apis.size(); i++)
+        if (apis[i] != api)
+            rest.push_back(apis[i]);
+    if (rest.size() < apis.size())
+    {
+        int cached;
+        ProbedCapture c = probeBackends(std::vector<int>(1, api), shared, open, cached);
+        if (c.isOpened())
+            return c;
+    }
+    ProbedCapture c = probeBackends(rest, shared, open, api);
+    if (c.isOpened())
+        cache.put(key, api);
+    return c;
+}
+
+// the camera APIs that open the same system video device
+static std::vector<int> sharedCameraBackends()
+{
+    const int apis[] = { CV_CAP_DSHOW, CV_CAP_MSMF, CV_CAP_VFW, CV_CAP_UNICAP, CV_CAP_QT, CV_CAP_AVFOUNDATION };
+    return std::vector<int>(apis, apis + sizeof(apis) / sizeof(apis[0]));
+}
+
+static ProbedCapture probeCamera(int index)
+{
+    return probeCapture(probeKey(index), cameraBackends(), sharedCameraBackends(), [index](int api)
+    {
+        ProbedCapture c;
+        c.icap = IVideoCapture_create(api + index);
+        if (c.icap.empty())
+            c.cap.reset(cvCreateCameraCapture(api + index));
+        return c;
+    });
+}
+
+static ProbedCapture probeFile(const String& filename)
+{
+    return probeCapture(probeKey(filename), fileBackends(), std::vector<int>(), [filename](int api)
+    {
+        ProbedCapture c;
+        if (api == CV_CAP_ANY)
+            c.icap = IVideoCapture_create(filename);
+        else
+            c.cap.reset(cvCreateFileCaptureWithPreference(filename.c_str(), api));
+        return c;
+    });
+}
+
 VideoCapture::VideoCapture()
 {}
 
@@ -579,6 +1078,13 @@ VideoCapture::~VideoCapture()
 bool VideoCapture::open(const String& filename, int apiPreference)
 {
     if (isOpened()) release();
+    if (apiPreference == CAP_ANY)
+    {
+        ProbedCapture c = probeFile(filename);
+        icap = c.icap;
+        cap = c.cap;
+        return isOpened();
+    }
     icap = IVideoCapture_create(filename);
     if (!icap.empty())
         return true;
@@ -595,6 +1101,16 @@ bool VideoCapture::open(const String& filename)
 bool VideoCapture::open(int index)
 {
     if (isOpened()) release();
+#ifndef WINRT_VIDEO
+    // WinRT keeps the sequential search: its API id does not survive the index arithmetic
+    if (index >= 0 && index < 100)
+    {
+        ProbedCapture c = probeCamera(index);
+        icap = c.icap;
+        cap = c.cap;
+        return isOpened();
+    }
+#endif
     icap = IVideoCapture_create(index);
     if (!icap.empty())
         return true;
@@ -699,6 +1215,145 @@ double VideoCapture::get(int propId) const
 }
 
 
+// lets the legacy CvVideoWriter backends sit behind the IVideoWriter interface
+class LegacyVideoWriter : public IVideoWriter
+{
+public:
+    LegacyVideoWriter(const Ptr<CvVideoWriter>& _writer) : writer(_writer) {}
+
+    bool isOpened() const { return !writer.empty(); }
+
+    void write(InputArray image)
+    {
+        Mat m = image.getMat();
+        IplImage _img = m;
+        cvWriteFrame(writer, &_img);
+    }
+
+    Ptr<CvVideoWriter> writer;
+};
+
+class AsyncVideoWriter : public IVideoWriter
+{
+public:
+    AsyncVideoWriter(const Ptr<IVideoWriter>& _backend, size_t _capacity)
+        : backend(_backend), capacity(_capacity), policy(ASYNC_WRITE_BLOCK), dropped(0), stopping(false)
+    {
+        encoder = std::thread(&AsyncVideoWriter::run, this);
+    }
+
+    ~AsyncVideoWriter()
+    {
+        finish();
+    }
+
+    bool isOpened() const { return backend && backend->isOpened(); }
+
+    void write(InputArray image)
+    {
+        Mat frame = image.getMat(); // shares the buffer, no copy
+        std::unique_lock<std::mutex> lock(mutex);
+        if (queue.size() >= capacity)
+        {
+            if (policy == ASYNC_WRITE_DROP_NEWEST)
+            {
+                dropped++;
+                return;
+            }
+            if (policy == ASYNC_WRITE_DROP_OLDEST)
+            {
+                queue.pop_front();
+                dropped++;
+            }
+            else
+                notFull.wait(lock, [this] { return queue.size() < capacity; });
+        }
+        queue.push_back(frame);
+        notEmpty.notify_one();
+    }
+
+    bool setProperty(int propId, double value)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (propId == VIDEOWRITER_PROP_ASYNC_POLICY)
+            {
+                policy = (int)value;
+                return true;
+            }
+            if (propId == VIDEOWRITER_PROP_ASYNC_QUEUE && value > 0)
+            {
+                capacity = (size_t)value;
+                notFull.notify_all();
+                return true;
+            }
+        }
+        std::lock_guard<std::mutex> lock(backendMutex);
+        return backend->setProperty(propId, value);
+    }
+
+    double getProperty(int propId) const
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            switch (propId)
+            {
+            case VIDEOWRITER_PROP_ASYNC_QUEUE: return (double)capacity;
+            case VIDEOWRITER_PROP_ASYNC_POLICY: return policy;
+            case VIDEOWRITER_PROP_QUEUE_DEPTH: return (double)queue.size();
+            case VIDEOWRITER_PROP_DROPPED_FRAMES: return (double)dropped;
+            }
+        }
+        std::lock_guard<std::mutex> lock(backendMutex);
+        return backend->getProperty(propId);
+    }
+
+    // drains the queue, stops the encoder thread and hands the backend back
+    Ptr<IVideoWriter> finish()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+            notEmpty.notify_one();
+        }
+        if (encoder.joinable())
+            encoder.join();
+        return backend;
+    }
+
+private:
+    void run()
+    {
+        for (;;)
+        {
+            Mat frame;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                notEmpty.wait(lock, [this] { return !queue.empty() || stopping; });
+                if (queue.empty())
+                    return;
+                frame = queue.front();
+                queue.pop_front();
+                notFull.notify_one();
+            }
+            // set() and get() reach the backend from the caller's thread meanwhile
+            std::lock_guard<std::mutex> lock(backendMutex);
+            backend->write(frame);
+        }
+    }
+
+    Ptr<IVideoWriter> backend;
+    size_t capacity;
+    int policy;
+    int64 dropped;
+    bool stopping;
+    std::deque<Mat> queue;
+    mutable std::mutex mutex;          // the queue and the settings above
+    mutable std::mutex backendMutex;   // every call into the backend
+    std::condition_variable notEmpty, notFull;
+    std::thread encoder;
+};
+
 VideoWriter::VideoWriter()
 {}
 
@@ -736,6 +1391,24 @@ bool VideoWriter::isOpened() const
 
 bool VideoWriter::set(int propId, double value)
 {
+    if (propId == VIDEOWRITER_PROP_ASYNC_QUEUE && isOpened())
+    {
+        AsyncVideoWriter* async = dynamic_cast<AsyncVideoWriter*>(iwriter.get());
+        if (async && value <= 0)
+        {
+            iwriter = async->finish();
+            return true;
+        }
+        if (!async && value > 0)
+        {
+            Ptr<IVideoWriter> backend = iwriter;
+            if (backend.empty())
+                backend = makePtr<LegacyVideoWriter>(writer);
+            writer.release();
+            iwriter = makePtr<AsyncVideoWriter>(backend, (size_t)value);
+            return true;
+        }
+    }
     if (!iwriter.empty())
         return iwriter->setProperty(propId, value);
     return false;
@@ -770,4 +1443,60 @@ int VideoWriter::fourcc(char c1, char c2, char c3, char c4)
     return (c1 & 255) + ((c2 & 255) << 8) + ((c3 & 255) << 16) + ((c4 & 255) << 24);
 }
 
+class BatchRetrieveBody : public ParallelLoopBody
+{
+public:
+    BatchRetrieveBody(const std::vector<VideoCapture*>& _captures, VideoFrameSet& _set)
+        : captures(_captures), set(_set) {}
+
+    void operator()(const Range& range) const
+    {
+        for (int i = range.start; i < range.end; i++)
+        {
+            if (!set.valid[i])
+                continue;
+            set.valid[i] = captures[i]->retrieve(set.frames[i]) && !set.frames[i].empty();
+            set.positions[i] = captures[i]->get(CAP_PROP_POS_MSEC);
+        }
+    }
+
+private:
+    const std::vector<VideoCapture*>& captures;
+    VideoFrameSet& set;
+};
+
+bool grabRetrieveSynchronized(const std::vector<VideoCapture*>& captures, VideoFrameSet& set, double maxSkewMsec)
+{
+    size_t n = captures.size();
+    set.frames.resize(n);
+    set.timestamps.assign(n, 0);
+    set.positions.assign(n, 0.);
+    set.valid.assign(n, 0);
+    set.skewMsec = 0;
+    set.synchronized = false;
+
+    for (size_t i = 0; i < n; i++)
+    {
+        set.valid[i] = captures[i] && captures[i]->isOpened() && captures[i]->grab();
+        set.timestamps[i] = getTickCount();
+    }
+
+    // retrieve() keeps reusing set.frames[i] when the caller passes the same set back
+    parallel_for_(Range(0, (int)n), BatchRetrieveBody(captures, set));
+
+    int64 first = 0, last = 0;
+    size_t count = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        if (!set.valid[i])
+            continue;
+        if (count == 0 || set.timestamps[i] < first) first = set.timestamps[i];
+        if (count == 0 || set.timestamps[i] > last) last = set.timestamps[i];
+        count++;
+    }
+    set.skewMsec = (last - first) * 1000. / getTickFrequency();
+    set.synchronized = n > 0 && count == n && set.skewMsec <= maxSkewMsec;
+    return count == n;
+}
+
 }
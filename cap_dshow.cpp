@@ -43,6 +43,7 @@
 
 #if (defined WIN32 || defined _WIN32) && defined HAVE_DSHOW
 #include "cap_dshow.hpp"
+#include "swap_red_blue.hpp"
 
 /*
    DirectShow-based Video Capturing module is based on
@@ -224,6 +225,7 @@ DEFINE_GUID(MEDIASUBTYPE_YV12,0x32315659,0x0000,0x0010,0x80,0x00,0x00,0xaa,0x00,
 DEFINE_GUID(MEDIASUBTYPE_YVU9,0x39555659,0x0000,0x0010,0x80,0x00,0x00,0xaa,0x00,0x38,0x9b,0x71);
 DEFINE_GUID(MEDIASUBTYPE_YVYU,0x55595659,0x0000,0x0010,0x80,0x00,0x00,0xaa,0x00,0x38,0x9b,0x71);
 DEFINE_GUID(MEDIASUBTYPE_MJPG,0x47504A4D, 0x0000, 0x0010, 0x80, 0x00, 0x00, 0xaa, 0x00, 0x38, 0x9b, 0x71); // MGB
+DEFINE_GUID(MEDIASUBTYPE_NV12,0x3231564E,0x0000,0x0010,0x80,0x00,0x00,0xaa,0x00,0x38,0x9b,0x71);
 DEFINE_GUID(MEDIATYPE_Interleaved,0x73766169,0x0000,0x0010,0x80,0x00,0x00,0xaa,0x00,0x38,0x9b,0x71);
 DEFINE_GUID(MEDIATYPE_Video,0x73646976,0x0000,0x0010,0x80,0x00,0x00,0xaa,0x00,0x38,0x9b,0x71);
 DEFINE_GUID(PIN_CATEGORY_CAPTURE,0xfb6c4281,0x0353,0x11d1,0x90,0x5f,0x00,0x00,0xc0,0xcc,0x16,0xba);
@@ -370,7 +372,7 @@ static void DebugPrintOut(const char *format, ...)
 //videoInput defines
 #define VI_VERSION      0.1995
 #define VI_MAX_CAMERAS  20
-#define VI_NUM_TYPES    20 //MGB
+#define VI_NUM_TYPES    21 //MGB
 #define VI_NUM_FORMATS  18 //DON'T TOUCH
 
 //defines for setPhyCon - tuner is not as well supported as composite and s-video
@@ -453,6 +455,7 @@ class videoDevice{
         IMediaEventEx * pMediaEvent;
 
         GUID videoType;
+        GUID grabberType;   //what the sample grabber delivers: RGB24, or the native NV12 / YUY2
         long formatType;
 
         SampleGrabberCallback * sgCallback;
@@ -537,6 +540,18 @@ class videoInput{
         //Or pass in a buffer for getPixels to fill returns true if successful.
         bool getPixels(int id, unsigned char * pixels, bool flipRedAndBlue = true, bool flipImage = false);
 
+        //Same as above for a buffer with its own row stride in bytes (eg. a cv::Mat or a ROI of one).
+        bool getPixels(int id, unsigned char * pixels, size_t step, bool flipRedAndBlue, bool flipImage);
+
+        //call before setupDevice
+        //true: deliver NV12 or YUY2 frames as the camera sends them instead of converting to RGB,
+        //when the camera format is one of those; getPixels then copies the raw frame
+        void setNativeYUV(int deviceID, bool native);
+        bool getNativeYUV(int deviceID) const;
+
+        //the format getPixels delivers: MEDIASUBTYPE_RGB24, MEDIASUBTYPE_NV12 or MEDIASUBTYPE_YUY2
+        GUID getDeliveredSubtype(int deviceID) const;
+
         //Launches a pop up settings window
         //For some reason in GLUT you have to call it twice each time.
         void showSettingsWindow(int deviceID);
@@ -577,7 +592,8 @@ class videoInput{
         void setPhyCon(int deviceID, int conn);
         void setAttemptCaptureSize(int deviceID, int w, int h,GUID mediaType=MEDIASUBTYPE_RGB24);
         bool setup(int deviceID);
-        void processPixels(unsigned char * src, unsigned char * dst, int width, int height, bool bRGB, bool bFlip);
+        void processPixels(unsigned char * src, unsigned char * dst, int width, int height, bool bRGB, bool bFlip, size_t dstStep = 0);
+        void copyFrame(videoDevice * VD, unsigned char * src, unsigned char * dst, bool bRGB, bool bFlip, size_t dstStep);
         int  start(int deviceID, videoDevice * VD);
         int  getDeviceCount();
         void getMediaSubtypeAsString(GUID type, char * typeAsString);
@@ -610,6 +626,7 @@ class videoInput{
         GUID MEDIASUBTYPE_GREY;
 
         videoDevice * VDList[VI_MAX_CAMERAS];
+        bool nativeYUV[VI_MAX_CAMERAS];     //kept here, VDList entries are recreated by stopDevice
         GUID mediaSubtypes[VI_NUM_TYPES];
         long formatTypes[VI_NUM_FORMATS];
 
@@ -648,6 +665,10 @@ static void MyDeleteMediaType(AM_MEDIA_TYPE *pmt)
 //////////////////////////////  CALLBACK  ////////////////////////////////
 
 //Callback class
+//The callback fills one of three buffers and publishes it by swapping buffer
+//indices under the critical section; the consumer swaps the latest complete
+//buffer out the same way and converts it without holding the lock, so neither
+//side copies a frame while the other one waits.
 class SampleGrabberCallback : public ISampleGrabberCB{
 public:
 
@@ -660,6 +681,10 @@ public:
         bufferSetup         = false;
         newFrame            = false;
         latestBufferLength  = 0;
+        writeIndex          = 0;
+        readyIndex          = 1;
+        readIndex           = 2;
+        for(int i = 0; i < 3; i++) buffers[i] = NULL;
 
         hEvent = CreateEvent(NULL, true, false, NULL);
     }
@@ -671,7 +696,7 @@ public:
         DeleteCriticalSection(&critSection);
         CloseHandle(hEvent);
         if(bufferSetup){
-            delete[] pixels;
+            for(int i = 0; i < 3; i++) delete[] buffers[i];
         }
     }
 
@@ -682,7 +707,10 @@ public:
             return false;
         }else{
             numBytes            = numBytesIn;
-            pixels              = new unsigned char[numBytes];
+            for(int i = 0; i < 3; i++){
+                buffers[i]      = new unsigned char[numBytes];
+                memset(buffers[i], 0, numBytes);
+            }
             bufferSetup         = true;
             newFrame            = false;
             latestBufferLength  = 0;
@@ -691,6 +719,23 @@ public:
     }
 
 
+    //------------------------------------------------
+    //Takes the most recent complete frame for reading, the returned buffer stays
+    //valid and untouched by the callback until the next call.
+    unsigned char * acquireLatest(){
+        EnterCriticalSection(&critSection);
+            if(newFrame){
+                int tmp     = readIndex;
+                readIndex   = readyIndex;
+                readyIndex  = tmp;
+                newFrame    = false;
+            }
+            unsigned char * latest = buffers[readIndex];
+        LeaveCriticalSection(&critSection);
+        return latest;
+    }
+
+
     //------------------------------------------------
     STDMETHODIMP_(ULONG) AddRef() { return 1; }
     STDMETHODIMP_(ULONG) Release() { return 2; }
@@ -706,15 +751,18 @@ public:
     //This method is meant to have less overhead
     //------------------------------------------------
     STDMETHODIMP SampleCB(double , IMediaSample *pSample){
-        if(WaitForSingleObject(hEvent, 0) == WAIT_OBJECT_0) return S_OK;
-
         HRESULT hr = pSample->GetPointer(&ptrBuffer);
 
         if(hr == S_OK){
             latestBufferLength = pSample->GetActualDataLength();
               if(latestBufferLength == numBytes){
+                //the sample memory goes back to the allocator when we return,
+                //so this one copy is needed, but it happens outside the lock
+                memcpy(buffers[writeIndex], ptrBuffer, latestBufferLength);
                 EnterCriticalSection(&critSection);
-                      memcpy(pixels, ptrBuffer, latestBufferLength);
+                    int tmp     = readyIndex;
+                    readyIndex  = writeIndex;
+                    writeIndex  = tmp;
                     newFrame    = true;
                     freezeCheck = 1;
                 LeaveCriticalSection(&critSection);
@@ -739,7 +787,10 @@ public:
     int numBytes;
     bool newFrame;
     bool bufferSetup;
-    unsigned char * pixels;
+    unsigned char * buffers[3];
+    int writeIndex;     //owned by the callback
+    int readyIndex;     //latest complete frame, swapped under critSection
+    int readIndex;      //owned by the consumer
     unsigned char * ptrBuffer;
     CRITICAL_SECTION critSection;
     HANDLE hEvent;
@@ -772,6 +823,7 @@ videoDevice::videoDevice(){
 
      //Default values for capture type
      videoType          = MEDIASUBTYPE_RGB24;
+     grabberType        = MEDIASUBTYPE_RGB24;
      connection         = PhysConn_Video_Composite;
      storeConn          = 0;
 
@@ -1059,6 +1111,7 @@ videoInput::videoInput(){
 
     //setup a max no of device objects
     for(int i=0; i<VI_MAX_CAMERAS; i++)  VDList[i] = new videoDevice();
+    for(int i=0; i<VI_MAX_CAMERAS; i++)  nativeYUV[i] = false;
 
     DebugPrintOut("\n***** VIDEOINPUT LIBRARY - %2.04f - TFW07 *****\n\n",VI_VERSION);
 
@@ -1092,6 +1145,7 @@ videoInput::videoInput(){
     mediaSubtypes[17]    = MEDIASUBTYPE_Y8;
     mediaSubtypes[18]    = MEDIASUBTYPE_GREY;
     mediaSubtypes[19]    = MEDIASUBTYPE_I420;
+    mediaSubtypes[20]    = MEDIASUBTYPE_NV12; // last: tried after every format tried before it
 
     //The video formats we support
     formatTypes[VI_NTSC_M]      = AnalogVideo_NTSC_M;
@@ -1499,6 +1553,16 @@ int videoInput::getSize(int id) const
 // ----------------------------------------------------------------------
 
 bool videoInput::getPixels(int id, unsigned char * dstBuffer, bool flipRedAndBlue, bool flipImage){
+    return getPixels(id, dstBuffer, 0, flipRedAndBlue, flipImage);
+}
+
+
+// ----------------------------------------------------------------------
+// Uses a supplied buffer with its own row stride, eg. a caller owned Mat
+// or a ROI inside one. dstStep == 0 means tightly packed rows.
+// ----------------------------------------------------------------------
+
+bool videoInput::getPixels(int id, unsigned char * dstBuffer, size_t dstStep, bool flipRedAndBlue, bool flipImage){
 
     bool success = false;
 
@@ -1508,22 +1572,12 @@ bool videoInput::getPixels(int id, unsigned char * dstBuffer, bool flipRedAndBlu
 
             DWORD result = WaitForSingleObject(VDList[id]->sgCallback->hEvent, 1000);
             if( result != WAIT_OBJECT_0) return false;
-
-            //double paranoia - mutexing with both event and critical section
-            EnterCriticalSection(&VDList[id]->sgCallback->critSection);
-
-                unsigned char * src = VDList[id]->sgCallback->pixels;
-                unsigned char * dst = dstBuffer;
-                int height             = VDList[id]->height;
-                int width              = VDList[id]->width;
-
-                processPixels(src, dst, width, height, flipRedAndBlue, flipImage);
-                VDList[id]->sgCallback->newFrame = false;
-
-            LeaveCriticalSection(&VDList[id]->sgCallback->critSection);
-
             ResetEvent(VDList[id]->sgCallback->hEvent);
 
+            //the acquired buffer is ours until the next acquire, no lock needed while converting
+            unsigned char * src = VDList[id]->sgCallback->acquireLatest();
+            copyFrame(VDList[id], src, dstBuffer, flipRedAndBlue, flipImage, dstStep);
+
             success = true;
 
         }
@@ -1536,11 +1590,7 @@ bool videoInput::getPixels(int id, unsigned char * dstBuffer, bool flipRedAndBlu
                 if (numBytes == bufferSize){
 
                     unsigned char * src = (unsigned char * )VDList[id]->pBuffer;
-                    unsigned char * dst = dstBuffer;
-                    int height             = VDList[id]->height;
-                    int width             = VDList[id]->width;
-
-                    processPixels(src, dst, width, height, flipRedAndBlue, flipImage);
+                    copyFrame(VDList[id], src, dstBuffer, flipRedAndBlue, flipImage, dstStep);
                     success = true;
                 }else{
                     DebugPrintOut("ERROR: GetPixels() - bufferSizes do not match!\n");
@@ -1555,6 +1605,48 @@ bool videoInput::getPixels(int id, unsigned char * dstBuffer, bool flipRedAndBlu
 }
 
 
+// ----------------------------------------------------------------------
+// RGB frames are converted by processPixels, native YUV frames are top
+// down already and only copied row by row: NV12 is height * 3 / 2 rows of
+// width bytes, YUY2 height rows of width * 2 bytes.
+// ----------------------------------------------------------------------
+
+void videoInput::copyFrame(videoDevice * VD, unsigned char * src, unsigned char * dst, bool bRGB, bool bFlip, size_t dstStep){
+
+    if(VD->grabberType == MEDIASUBTYPE_RGB24){
+        processPixels(src, dst, VD->width, VD->height, bRGB, bFlip, dstStep);
+        return;
+    }
+    bool nv12 = VD->grabberType == MEDIASUBTYPE_NV12;
+    int rows = nv12 ? VD->height * 3 / 2 : VD->height;
+    int widthInBytes = nv12 ? VD->width : VD->width * 2;
+    if(dstStep == 0 || dstStep == (size_t)widthInBytes){
+        memcpy(dst, src, (size_t)rows * widthInBytes);
+        return;
+    }
+    for(int y = 0; y < rows; y++){
+        memcpy(dst + y * dstStep, src + (size_t)y * widthInBytes, widthInBytes);
+    }
+}
+
+
+void videoInput::setNativeYUV(int id, bool native){
+    if(id >= VI_MAX_CAMERAS || VDList[id]->readyToCapture) return;
+    nativeYUV[id] = native;
+}
+
+
+bool videoInput::getNativeYUV(int id) const{
+    return id < VI_MAX_CAMERAS && nativeYUV[id];
+}
+
+
+GUID videoInput::getDeliveredSubtype(int id) const{
+    if(isDeviceSetup(id)) return VDList[id]->grabberType;
+    return MEDIASUBTYPE_RGB24;
+}
+
+
 // ----------------------------------------------------------------------
 // Returns a buffer
 // ----------------------------------------------------------------------
@@ -2118,10 +2210,11 @@ bool videoInput::setup(int deviceNumber){
 // You have any combination of those.
 // ----------------------------------------------------------------------
 
-void videoInput::processPixels(unsigned char * src, unsigned char * dst, int width, int height, bool bRGB, bool bFlip){
+void videoInput::processPixels(unsigned char * src, unsigned char * dst, int width, int height, bool bRGB, bool bFlip, size_t dstStep){
 
     int widthInBytes = width * 3;
     int numBytes = widthInBytes * height;
+    if(dstStep == 0) dstStep = widthInBytes;
 
     if(!bRGB){
 
@@ -2130,51 +2223,25 @@ void videoInput::processPixels(unsigned char * src, unsigned char * dst, int wid
 
         if(bFlip){
             for(int y = 0; y < height; y++){
-                memcpy(dst + (y * widthInBytes), src + ( (height -y -1) * widthInBytes), widthInBytes);
+                memcpy(dst + (y * dstStep), src + ( (height -y -1) * widthInBytes), widthInBytes);
             }
 
-        }else{
+        }else if(dstStep == (size_t)widthInBytes){
             memcpy(dst, src, numBytes);
+        }else{
+            for(int y = 0; y < height; y++){
+                memcpy(dst + (y * dstStep), src + (y * widthInBytes), widthInBytes);
+            }
         }
     }else{
-        if(bFlip){
-
-            int x = 0;
-            int y = (height - 1) * widthInBytes;
-            src += y;
-
-            for(int i = 0; i < numBytes; i+=3){
-                if(x >= width){
-                    x = 0;
-                    src -= widthInBytes*2;
-                }
-
-                *dst = *(src+2);
-                dst++;
-
-                *dst = *(src+1);
-                dst++;
-
-                *dst = *src;
-                dst++;
-
-                src+=3;
-                x++;
-            }
+        //a vertical flip is only a different source row order, so every
+        //combination goes through the same vectorized row kernel
+        if(!bFlip && dstStep == (size_t)widthInBytes){
+            swapRedAndBlueRow(src, dst, width * height);
+            return;
         }
-        else{
-            for(int i = 0; i < numBytes; i+=3){
-                *dst = *(src+2);
-                dst++;
-
-                *dst = *(src+1);
-                dst++;
-
-                *dst = *src;
-                dst++;
-
-                src+=3;
-            }
+        for(int y = 0; y < height; y++){
+            swapRedAndBlueRow(src + (bFlip ? (height - y - 1) : y) * widthInBytes, dst + y * dstStep, width);
         }
     }
 }
@@ -2204,6 +2271,7 @@ void videoInput::getMediaSubtypeAsString(GUID type, char * typeAsString){
     else if(type == MEDIASUBTYPE_Y8)    sprintf(tmpStr, "Y8");
     else if(type == MEDIASUBTYPE_GREY)  sprintf(tmpStr, "GREY");
     else if(type == MEDIASUBTYPE_I420)  sprintf(tmpStr, "I420");
+    else if(type == MEDIASUBTYPE_NV12)  sprintf(tmpStr, "NV12");
     else sprintf(tmpStr, "OTHER");
 
     memcpy(typeAsString, tmpStr, sizeof(char)*8);
@@ -2703,6 +2771,18 @@ int videoInput::start(int deviceID, videoDevice *VD){
     mt.subtype         = MEDIASUBTYPE_RGB24;
     mt.formattype     = FORMAT_VideoInfo;
 
+    //native frames: the grabber takes the format of the stream, no colour converter is inserted
+    VD->grabberType = MEDIASUBTYPE_RGB24;
+    GUID streamType = VD->pAmMediaType ? VD->pAmMediaType->subtype : MEDIASUBTYPE_RGB24;
+    if(nativeYUV[deviceID] && (streamType == MEDIASUBTYPE_NV12 || streamType == MEDIASUBTYPE_YUY2)){
+        mt.subtype = streamType;
+        VD->grabberType = streamType;
+        //smaller than the RGB24 buffers allocated by setSize, which are kept
+        VD->videoSize = streamType == MEDIASUBTYPE_NV12 ? VD->width * VD->height * 3 / 2 : VD->width * VD->height * 2;
+        VD->sgCallback->numBytes = VD->videoSize;
+        DebugPrintOut("SETUP: delivering native %s frames\n", streamType == MEDIASUBTYPE_NV12 ? "NV12" : "YUY2");
+    }
+
     //VD->pAmMediaType->subtype = VD->videoType;
     hr = VD->pGrabber->SetMediaType(&mt);
 
@@ -3171,6 +3251,8 @@ double VideoCapture_DShow::getProperty(int propIdx) const
         return g_VI.getFourcc(m_index);
     case CV_CAP_PROP_FPS:
         return g_VI.getFPS(m_index);
+    case CV_CAP_PROP_CONVERT_RGB:
+        return g_VI.getNativeYUV(m_index) ? 0 : 1;
 
     // video filter properties
     case CV_CAP_PROP_BRIGHTNESS:
@@ -3266,6 +3348,24 @@ bool VideoCapture_DShow::setProperty(int propIdx, double propVal)
         return true;
     }
 
+    // 0: the NV12 / YUY2 frames of the camera as they are, see retrieveFrame
+    if (propIdx == CV_CAP_PROP_CONVERT_RGB)
+    {
+        bool native = propVal == 0;
+        if (native != g_VI.getNativeYUV(m_index))
+        {
+            int fps = static_cast<int>(g_VI.getFPS(m_index));
+            g_VI.stopDevice(m_index);
+            g_VI.setNativeYUV(m_index, native);
+            g_VI.setIdealFramerate(m_index, fps);
+            if (m_widthSet > 0 && m_heightSet > 0)
+                g_VI.setupDevice(m_index, m_widthSet, m_heightSet);
+            else
+                g_VI.setupDevice(m_index);
+        }
+        return g_VI.isDeviceSetup(m_index);
+    }
+
     // show video/camera filter dialog
     if (propIdx == CV_CAP_PROP_SETTINGS )
     {
@@ -3311,9 +3411,19 @@ bool VideoCapture_DShow::grabFrame()
 }
 bool VideoCapture_DShow::retrieveFrame(int, OutputArray frame)
 {
-    frame.create(Size(g_VI.getWidth(m_index), g_VI.getHeight(m_index)), CV_8UC3);
+    int width = g_VI.getWidth(m_index), height = g_VI.getHeight(m_index);
+    GUID delivered = g_VI.getDeliveredSubtype(m_index);
+    // native frames in the layouts cvtColor takes: NV12 as one plane of height * 3 / 2
+    // rows, the Y plane first; YUY2 as two channels
+    if (delivered == MEDIASUBTYPE_NV12)
+        frame.create(Size(width, height * 3 / 2), CV_8UC1);
+    else if (delivered == MEDIASUBTYPE_YUY2)
+        frame.create(Size(width, height), CV_8UC2);
+    else
+        frame.create(Size(width, height), CV_8UC3);
     cv::Mat mat = frame.getMat();
-    return g_VI.getPixels(m_index, mat.ptr(), false, true );
+    // decode straight into the caller's Mat, which may be a ROI with a wider step
+    return g_VI.getPixels(m_index, mat.ptr(), mat.step, false, true );
 }
 int VideoCapture_DShow::getCaptureDomain()
 {
@@ -0,0 +1,212 @@
+// Rearranging channels in one pass, without split() and merge().
+//
+//     // ( 0, 0, green ): no zero planes, no split
+//     ChannelMap( 3 ).constant( 0, 0 ).constant( 1, 0 ).from( 2, 1 ).apply( src, dst );
+//
+//     // BGR plus an alpha mask, the mask at half opacity
+//     ChannelMap( 4 ).from( 0, 0 ).from( 1, 1 ).from( 2, 2 ).plane( 3, alpha, 0.5 ).apply( bgr, bgra );
+//
+// Every output channel is a channel of src, a constant or a separate single channel
+// plane of the size and depth of src, each optionally scaled (with saturation). The
+// output is written pixel by pixel from the input, so no full size plane is ever made;
+// dst may be src when both have as many channels, and may be a ROI of a larger image,
+// as for the collages of the samples. 8 bit images of up to 4 channels without scaling
+// go 16 pixels at a time: the source deinterleaved into registers, the registers of
+// the output picked from them, from constants or from the planes, and interleaved
+// back. Other depths, and scaled channels, take a scalar loop of the same mapping.
+
+#ifndef CHANNEL_REMAP_HPP
+#define CHANNEL_REMAP_HPP
+
+#include <opencv2/core.hpp>
+#include <opencv2/core/utility.hpp>
+#include <opencv2/core/hal/intrin.hpp>
+#include <algorithm>
+#include <vector>
+
+namespace chanremap
+{
+
+enum Kind { UNSET, SOURCE, CONSTANT, PLANE };
+
+struct Entry
+{
+    Kind kind;
+    int channel;
+    double value, scale;
+    cv::Mat plane;
+    Entry() : kind( UNSET ), channel( 0 ), value( 0 ), scale( 1 ) {}
+};
+
+// x to n of one row, for any depth
+template<typename T> inline void remapRow( const T* s, T* d, int x, int n, int scn, const std::vector<Entry>& map,
+                                           const std::vector<const uchar*>& planes )
+{
+    const int dcn = (int)map.size();
+    T in[4], out[4];
+    for( ; x < n; x++ )
+    {
+        // read the whole pixel first, d may be s
+        for( int k = 0; k < scn; k++ )
+            in[k] = s[x * scn + k];
+        for( int c = 0; c < dcn; c++ )
+        {
+            const Entry& e = map[c];
+            T v = e.kind == SOURCE ? in[e.channel] : e.kind == PLANE ? ( (const T*)planes[c] )[x] : T();
+            out[c] = e.kind == CONSTANT ? cv::saturate_cast<T>( e.value ) : e.scale == 1 ? v : cv::saturate_cast<T>( v * e.scale );
+        }
+        for( int c = 0; c < dcn; c++ )
+            d[x * dcn + c] = out[c];
+    }
+}
+
+// 16 pixels at a time, 8 bit without scaling; returns the pixels done
+inline int remapRow8u( const uchar* s, uchar* d, int n, int scn, const std::vector<Entry>& map, const std::vector<const uchar*>& planes )
+{
+    int x = 0;
+#if CV_SIMD128
+    const int dcn = (int)map.size();
+    cv::v_uint8x16 konst[4];
+    for( int c = 0; c < dcn; c++ )
+        konst[c] = cv::v_setall_u8( cv::saturate_cast<uchar>( map[c].value ) );
+    for( ; x <= n - 16; x += 16 )
+    {
+        cv::v_uint8x16 in[4], out[4];
+        const uchar* p = s + x * scn;
+        switch( scn )
+        {
+        case 1: in[0] = cv::v_load( p ); break;
+        case 2: cv::v_load_deinterleave( p, in[0], in[1] ); break;
+        case 3: cv::v_load_deinterleave( p, in[0], in[1], in[2] ); break;
+        default: cv::v_load_deinterleave( p, in[0], in[1], in[2], in[3] ); break;
+        }
+        for( int c = 0; c < dcn; c++ )
+            out[c] = map[c].kind == SOURCE ? in[map[c].channel] : map[c].kind == PLANE ? cv::v_load( planes[c] + x ) : konst[c];
+        uchar* q = d + x * dcn;
+        switch( dcn )
+        {
+        case 1: cv::v_store( q, out[0] ); break;
+        case 2: cv::v_store_interleave( q, out[0], out[1] ); break;
+        case 3: cv::v_store_interleave( q, out[0], out[1], out[2] ); break;
+        default: cv::v_store_interleave( q, out[0], out[1], out[2], out[3] ); break;
+        }
+    }
+#else
+    (void)s; (void)d; (void)n; (void)scn; (void)map; (void)planes;
+#endif
+    return x;
+}
+
+template<typename T> class RemapBody : public cv::ParallelLoopBody
+{
+public:
+    RemapBody( const cv::Mat& _src, cv::Mat& _dst, const std::vector<Entry>& _map, bool _simd )
+        : src( _src ), dst( _dst ), map( _map ), simd( _simd ) {}
+
+    void operator()( const cv::Range& range ) const
+    {
+        std::vector<const uchar*> planes( map.size(), (const uchar*)0 );
+        for( int y = range.start; y < range.end; y++ )
+        {
+            for( size_t c = 0; c < map.size(); c++ )
+                if( map[c].kind == PLANE )
+                    planes[c] = map[c].plane.ptr( y );
+            const T* s = src.ptr<T>( y );
+            T* d = dst.ptr<T>( y );
+            int x = simd ? remapRow8u( (const uchar*)s, (uchar*)d, src.cols, src.channels(), map, planes ) : 0;
+            remapRow<T>( s, d, x, src.cols, src.channels(), map, planes );
+        }
+    }
+
+private:
+    const cv::Mat& src;
+    cv::Mat& dst;
+    const std::vector<Entry>& map;
+    bool simd;
+};
+
+}
+
+class ChannelMap
+{
+public:
+    // channels: of the output, 1 to 4
+    explicit ChannelMap( int channels ) : map( channels )
+    {
+        CV_Assert( channels >= 1 && channels <= 4 );
+    }
+
+    // out[c] = src[channel] * scale
+    ChannelMap& from( int c, int channel, double scale = 1 )
+    {
+        chanremap::Entry& e = at( c );
+        e.kind = chanremap::SOURCE;
+        e.channel = channel;
+        e.scale = scale;
+        return *this;
+    }
+
+    // out[c] = value
+    ChannelMap& constant( int c, double value )
+    {
+        chanremap::Entry& e = at( c );
+        e.kind = chanremap::CONSTANT;
+        e.value = value;
+        e.scale = 1;
+        return *this;
+    }
+
+    // out[c] = p * scale; p: one channel, size and depth of the src given to apply(),
+    // read when apply() runs
+    ChannelMap& plane( int c, const cv::Mat& p, double scale = 1 )
+    {
+        CV_Assert( p.channels() == 1 );
+        chanremap::Entry& e = at( c );
+        e.kind = chanremap::PLANE;
+        e.plane = p;
+        e.scale = scale;
+        return *this;
+    }
+
+    void apply( const cv::Mat& src, cv::Mat& dst ) const
+    {
+        const int scn = src.channels(), dcn = (int)map.size(), depth = src.depth();
+        CV_Assert( src.dims == 2 && scn <= 4 );
+        bool simd = depth == CV_8U;
+        for( int c = 0; c < dcn; c++ )
+        {
+            const chanremap::Entry& e = map[c];
+            CV_Assert( e.kind != chanremap::UNSET );
+            CV_Assert( e.kind != chanremap::SOURCE || ( e.channel >= 0 && e.channel < scn ) );
+            CV_Assert( e.kind != chanremap::PLANE || ( e.plane.size() == src.size() && e.plane.depth() == depth ) );
+            if( e.kind != chanremap::CONSTANT && e.scale != 1 )
+                simd = false;
+        }
+        // in place only when the pixels keep their size
+        CV_Assert( dst.data != src.data || dst.type() == CV_MAKETYPE( depth, dcn ) );
+        dst.create( src.size(), CV_MAKETYPE( depth, dcn ) );
+        cv::Range rows( 0, src.rows );
+        double stripes = std::max( 1.0, src.total() / (double)( 1 << 16 ) );
+        switch( depth )
+        {
+        case CV_8U:  cv::parallel_for_( rows, chanremap::RemapBody<uchar>( src, dst, map, simd ), stripes ); break;
+        case CV_8S:  cv::parallel_for_( rows, chanremap::RemapBody<schar>( src, dst, map, false ), stripes ); break;
+        case CV_16U: cv::parallel_for_( rows, chanremap::RemapBody<ushort>( src, dst, map, false ), stripes ); break;
+        case CV_16S: cv::parallel_for_( rows, chanremap::RemapBody<short>( src, dst, map, false ), stripes ); break;
+        case CV_32S: cv::parallel_for_( rows, chanremap::RemapBody<int>( src, dst, map, false ), stripes ); break;
+        case CV_32F: cv::parallel_for_( rows, chanremap::RemapBody<float>( src, dst, map, false ), stripes ); break;
+        default:     cv::parallel_for_( rows, chanremap::RemapBody<double>( src, dst, map, false ), stripes ); break;
+        }
+    }
+
+private:
+    chanremap::Entry& at( int c )
+    {
+        CV_Assert( c >= 0 && c < (int)map.size() );
+        return map[c];
+    }
+
+    std::vector<chanremap::Entry> map;
+};
+
+#endif
@@ -0,0 +1,151 @@
+// Saturation, value and hue adjustments of BGR images, without an HSV round trip.
+//
+//     ColorAdjuster boost( 2.0 );                    // saturation x2, as S *= 2 in HSV
+//     boost.apply( frame );                          // in place
+//     ColorAdjuster( 1.2, 0.9, 15 ).apply( src, dst ); // saturation, value, hue in degrees
+//
+// In HSV the value is the largest channel and the saturation the spread below it, so
+// scaling the saturation by k with the hue and value kept is c' = max - k (max - c)
+// for each channel, with k capped where the smallest channel reaches 0 (S = 255). The
+// value is a gain on all three channels, capped where the largest reaches 255. Hue
+// shifts are a rotation of the colour around the gray axis, applied first: about the
+// hue of HSV, exact for the primaries and multiples of 120 degrees. Everything is one
+// pass in float, 16 pixels at a time with SIMD, rows in parallel; src and dst may be
+// the same image. Results agree with cvtColor to HSV, the adjustment and back within
+// the rounding of the 8 bit HSV image.
+
+#ifndef COLOR_ADJUST_HPP
+#define COLOR_ADJUST_HPP
+
+#include <opencv2/core.hpp>
+#include <opencv2/core/utility.hpp>
+#include <opencv2/core/hal/intrin.hpp>
+#include <algorithm>
+#include <cmath>
+
+namespace coloradjust
+{
+
+struct Params
+{
+    float m[9];                // hue rotation, BGR in and out
+    float saturation, value;
+};
+
+inline float vmax( float a, float b ) { return std::max( a, b ); }
+inline float vmin( float a, float b ) { return std::min( a, b ); }
+template<typename T> inline T splat( float v );
+template<> inline float splat<float>( float v ) { return v; }
+#if CV_SIMD128
+inline cv::v_float32x4 vmax( const cv::v_float32x4& a, const cv::v_float32x4& b ) { return cv::v_max( a, b ); }
+inline cv::v_float32x4 vmin( const cv::v_float32x4& a, const cv::v_float32x4& b ) { return cv::v_min( a, b ); }
+template<> inline cv::v_float32x4 splat<cv::v_float32x4>( float v ) { return cv::v_setall_f32( v ); }
+#endif
+
+// the same arithmetic for one pixel in float or four in a register
+template<typename T> inline void adjust( T& b, T& g, T& r, const Params& p )
+{
+    T b1 = splat<T>( p.m[0] ) * b + splat<T>( p.m[1] ) * g + splat<T>( p.m[2] ) * r;
+    T g1 = splat<T>( p.m[3] ) * b + splat<T>( p.m[4] ) * g + splat<T>( p.m[5] ) * r;
+    T r1 = splat<T>( p.m[6] ) * b + splat<T>( p.m[7] ) * g + splat<T>( p.m[8] ) * r;
+    T eps = splat<T>( 1e-3f );
+    T mx = vmax( vmax( b1, g1 ), r1 ), mn = vmin( vmin( b1, g1 ), r1 );
+    T k = vmin( splat<T>( p.saturation ), mx / vmax( mx - mn, eps ) );
+    T gain = vmin( splat<T>( p.value ), splat<T>( 255.f ) / vmax( mx, eps ) );
+    b = gain * ( mx - k * ( mx - b1 ) );
+    g = gain * ( mx - k * ( mx - g1 ) );
+    r = gain * ( mx - k * ( mx - r1 ) );
+}
+
+inline void adjustRow( const uchar* s, uchar* d, int n, const Params& p )
+{
+    int x = 0;
+#if CV_SIMD128
+    for( ; x <= n - 16; x += 16 )
+    {
+        cv::v_uint8x16 c8[3];
+        cv::v_load_deinterleave( s + x * 3, c8[0], c8[1], c8[2] );
+        cv::v_float32x4 f[3][4];
+        for( int c = 0; c < 3; c++ )
+        {
+            cv::v_uint16x8 lo, hi;
+            cv::v_uint32x4 q[4];
+            cv::v_expand( c8[c], lo, hi );
+            cv::v_expand( lo, q[0], q[1] );
+            cv::v_expand( hi, q[2], q[3] );
+            for( int k = 0; k < 4; k++ )
+                f[c][k] = cv::v_cvt_f32( cv::v_reinterpret_as_s32( q[k] ) );
+        }
+        for( int k = 0; k < 4; k++ )
+            adjust( f[0][k], f[1][k], f[2][k], p );
+        for( int c = 0; c < 3; c++ )
+            c8[c] = cv::v_pack_u( cv::v_pack( cv::v_round( f[c][0] ), cv::v_round( f[c][1] ) ),
+                                  cv::v_pack( cv::v_round( f[c][2] ), cv::v_round( f[c][3] ) ) );
+        cv::v_store_interleave( d + x * 3, c8[0], c8[1], c8[2] );
+    }
+#endif
+    for( ; x < n; x++ )
+    {
+        float b = s[x * 3], g = s[x * 3 + 1], r = s[x * 3 + 2];
+        adjust( b, g, r, p );
+        d[x * 3] = cv::saturate_cast<uchar>( b );
+        d[x * 3 + 1] = cv::saturate_cast<uchar>( g );
+        d[x * 3 + 2] = cv::saturate_cast<uchar>( r );
+    }
+}
+
+class AdjustBody : public cv::ParallelLoopBody
+{
+public:
+    AdjustBody( const cv::Mat& _src, cv::Mat& _dst, const Params& _p ) : src( _src ), dst( _dst ), p( _p ) {}
+
+    void operator()( const cv::Range& range ) const
+    {
+        for( int y = range.start; y < range.end; y++ )
+            adjustRow( src.ptr<uchar>( y ), dst.ptr<uchar>( y ), src.cols, p );
+    }
+
+private:
+    const cv::Mat& src;
+    cv::Mat& dst;
+    Params p;
+};
+
+}
+
+class ColorAdjuster
+{
+public:
+    // saturation, value: gains, 1 keeps; hueShift: degrees, towards green from red
+    explicit ColorAdjuster( double saturation = 1, double value = 1, double hueShift = 0 )
+    {
+        p.saturation = (float)saturation;
+        p.value = (float)value;
+        // rotation around ( 1, 1, 1 ) / sqrt( 3 ) in RGB: c I + ( 1 - c ) / 3 + s / sqrt( 3 ) K
+        double a = hueShift * CV_PI / 180, c = std::cos( a ), s = std::sin( a ) / std::sqrt( 3.0 ), o = ( 1 - c ) / 3;
+        double rgb[3][3] = { { c + o, o - s, o + s },
+                             { o + s, c + o, o - s },
+                             { o - s, o + s, c + o } };
+        // to BGR order: index 0 is blue
+        for( int i = 0; i < 3; i++ )
+            for( int j = 0; j < 3; j++ )
+                p.m[i * 3 + j] = (float)rgb[2 - i][2 - j];
+    }
+
+    // src: CV_8UC3 BGR; dst may be src
+    void apply( const cv::Mat& src, cv::Mat& dst ) const
+    {
+        CV_Assert( src.type() == CV_8UC3 );
+        if( dst.data != src.data )
+            dst.create( src.size(), src.type() );
+        cv::parallel_for_( cv::Range( 0, src.rows ), coloradjust::AdjustBody( src, dst, p ),
+                           std::max( 1.0, src.total() / (double)( 1 << 16 ) ) );
+    }
+
+    void apply( cv::Mat& img ) const { apply( img, img ); }
+
+private:
+    coloradjust::Params p;
+};
+
+#endif
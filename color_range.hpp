@@ -0,0 +1,172 @@
+// Colour range masks straight from BGR pixels, without converting the frame.
+//
+//     ColorRangeClassifier skin( ColorRangeClassifier::HSV );
+//     skin.addRange( Scalar( 0, 85, 241 ), Scalar( 18, 255, 255 ) );
+//     skin.addRange( Scalar( 171, 0, 0 ), Scalar( 255, 255, 255 ) );   // ORed with the first
+//     skin.classify( frame, mask );                  // same as cvtColor + inRange + max
+//     skin.classify( frame, mask, roi );             // only roi is classified, 0 elsewhere
+//
+// The ranges are compiled into one bit per BGR colour, 2 MB for the 2^24 colours: a
+// mask is then a single gather pass over the frame, and no HSV or YCrCb image is ever
+// allocated. addRange() converts every colour once, in parallel slabs of equal blue,
+// through cvtColor itself, so the result is exactly the one of inRange on the
+// converted frame; it only ORs the bits of the new range into the table, the ranges
+// added before are not converted again. HSV slabs of a blue above the range's top V
+// are skipped. In HSV a range with a lower hue above the upper one wraps around 180.
+// The compilation costs about one conversion of a 16 megapixel image, paid when the
+// colour changes instead of on every frame of every camera.
+
+#ifndef COLOR_RANGE_HPP
+#define COLOR_RANGE_HPP
+
+#include <opencv2/core.hpp>
+#include <opencv2/core/utility.hpp>
+#include <opencv2/imgproc.hpp>
+#include <algorithm>
+#include <vector>
+
+namespace colorrange
+{
+
+// bit ( b << 16 | g << 8 | r ): every blue owns 8 KB of the table
+inline int index( const uchar* bgr )
+{
+    return bgr[0] << 16 | bgr[1] << 8 | bgr[2];
+}
+
+inline void classifyRow( const uchar* bits, const uchar* p, uchar* d, int n )
+{
+    for( int x = 0; x < n; x++, p += 3 )
+    {
+        int i = index( p );
+        d[x] = ( bits[i >> 3] >> ( i & 7 ) ) & 1 ? 255 : 0;
+    }
+}
+
+class CompileBody : public cv::ParallelLoopBody
+{
+public:
+    CompileBody( uchar* _bits, int _code, const cv::Scalar& _lower, const cv::Scalar& _upper, bool _wrap, int _maxBlue )
+        : bits( _bits ), code( _code ), lower( _lower ), upper( _upper ), wrap( _wrap ), maxBlue( _maxBlue ) {}
+
+    void operator()( const cv::Range& range ) const
+    {
+        cv::Mat slab( 256, 256, CV_8UC3 ), converted;
+        for( int b = range.start; b < range.end; b++ )
+        {
+            if( b > maxBlue )
+                continue;
+            for( int g = 0; g < 256; g++ )
+            {
+                uchar* p = slab.ptr<uchar>( g );
+                for( int r = 0; r < 256; r++, p += 3 )
+                {
+                    p[0] = (uchar)b;
+                    p[1] = (uchar)g;
+                    p[2] = (uchar)r;
+                }
+            }
+            cv::cvtColor( slab, converted, code );
+            uchar* out = bits + ( b << 13 );
+            for( int g = 0; g < 256; g++ )
+            {
+                const uchar* c = converted.ptr<uchar>( g );
+                uchar* o = out + ( g << 5 );
+                for( int r = 0; r < 256; r++, c += 3 )
+                {
+                    bool first = wrap ? c[0] >= lower[0] || c[0] <= upper[0] : c[0] >= lower[0] && c[0] <= upper[0];
+                    if( first && c[1] >= lower[1] && c[1] <= upper[1] && c[2] >= lower[2] && c[2] <= upper[2] )
+                        o[r >> 3] |= (uchar)( 1 << ( r & 7 ) );
+                }
+            }
+        }
+    }
+
+private:
+    uchar* bits;
+    int code;
+    cv::Scalar lower, upper;
+    bool wrap;
+    int maxBlue;
+};
+
+class ClassifyBody : public cv::ParallelLoopBody
+{
+public:
+    ClassifyBody( const uchar* _bits, const cv::Mat& _src, cv::Mat& _dst ) : bits( _bits ), src( _src ), dst( _dst ) {}
+
+    void operator()( const cv::Range& range ) const
+    {
+        for( int y = range.start; y < range.end; y++ )
+        {
+            classifyRow( bits, src.ptr<uchar>( y ), dst.ptr<uchar>( y ), src.cols );
+        }
+    }
+
+private:
+    const uchar* bits;
+    const cv::Mat& src;
+    cv::Mat& dst;
+};
+
+}
+
+class ColorRangeClassifier
+{
+public:
+    enum Space { HSV, YCRCB };
+
+    explicit ColorRangeClassifier( Space _space = HSV ) : space( _space ), bits( 1 << 21, 0 ) {}
+
+    // no colour is in the mask
+    void clear() { std::fill( bits.begin(), bits.end(), (uchar)0 ); }
+
+    // the colours with lower <= converted <= upper, as inRange, join the mask
+    void addRange( const cv::Scalar& lower, const cv::Scalar& upper )
+    {
+        bool wrap = space == HSV && lower[0] > upper[0];
+        int code = space == HSV ? cv::COLOR_BGR2HSV : cv::COLOR_BGR2YCrCb;
+        // V is the largest of b, g and r: a blue above the top V is never in the range
+        int maxBlue = space == HSV ? std::min( 255, (int)upper[2] ) : 255;
+        cv::parallel_for_( cv::Range( 0, 256 ), colorrange::CompileBody( &bits[0], code, lower, upper, wrap, maxBlue ) );
+    }
+
+    void setRange( const cv::Scalar& lower, const cv::Scalar& upper )
+    {
+        clear();
+        addRange( lower, upper );
+    }
+
+    bool contains( const cv::Vec3b& bgr ) const
+    {
+        int i = colorrange::index( bgr.val );
+        return ( ( bits[i >> 3] >> ( i & 7 ) ) & 1 ) != 0;
+    }
+
+    // bgr: CV_8UC3; mask: CV_8UC1 of the size of bgr, 255 for the colours in range.
+    // With a roi only its pixels are classified and the rest of the mask is 0.
+    void classify( const cv::Mat& bgr, cv::Mat& mask, cv::Rect roi = cv::Rect() ) const
+    {
+        CV_Assert( bgr.type() == CV_8UC3 );
+        cv::Rect all( 0, 0, bgr.cols, bgr.rows );
+        roi = roi.area() ? roi & all : all;
+        mask.create( bgr.size(), CV_8UC1 );
+        if( roi != all )
+            mask.setTo( cv::Scalar::all( 0 ) );
+        cv::Mat src = bgr( roi ), dst = mask( roi );
+        cv::parallel_for_( cv::Range( 0, src.rows ), colorrange::ClassifyBody( &bits[0], src, dst ),
+                           std::max( 1.0, src.total() / (double)( 1 << 16 ) ) );
+    }
+
+    // one row: n pixels of bgr to n mask bytes, for the callers streaming rows themselves
+    void classifyRow( const uchar* bgr, uchar* mask, int n ) const
+    {
+        colorrange::classifyRow( &bits[0], bgr, mask, n );
+    }
+
+private:
+    Space space;
+    std::vector<uchar> bits;
+};
+
+#endif
@@ -1,11 +1,243 @@
 #include <opencv2/highgui/highgui.hpp>
 #include <opencv2/imgproc/imgproc.hpp>
+#include <opencv2/videoio/videoio.hpp>
+#include <algorithm>
+#include <cctype>
+#include <iostream>
 
 using namespace cv;
 using namespace std;
 
+// Gesture video: hull and convexity defects of the K largest blobs of each frame.
+// The blobs are ranked by contourArea, which is one pass over the contour points,
+// and only the K kept get a hull and defects, computed in parallel. Fingertips are
+// the deep defects with a sharp angle, plus one. Each blob is matched to the track of
+// the previous frame with the nearest centroid, and the track keeps a running average
+// of its fingertip count, so the count is smoothed without going over old frames.
+
+struct Blob
+{
+    vector<Point> contour;
+    double area;
+    Point2f centroid;
+    vector<int> hull;           // indices into contour, for convexityDefects
+    vector<Vec4i> defects;
+    int fingertips;
+};
+
+struct BlobTrack
+{
+    Point2f centroid;
+    float fingertips;           // running average
+    int age, missed;
+};
+
+static int countFingertips( const Blob& b )
+{
+    Rect box = boundingRect( b.contour );
+    double minDepth = 0.1 * box.height;
+    int n = 0;
+    for( size_t i = 0; i < b.defects.size(); i++ )
+    {
+        const Vec4i& d = b.defects[i];
+        if( d[3] / 256.0 < minDepth )
+            continue;
+        // the angle at the far point between the two fingers below 90 degrees
+        Point s = b.contour[d[0]] - b.contour[d[2]], e = b.contour[d[1]] - b.contour[d[2]];
+        if( s.dot( e ) > 0 )
+            n++;
+    }
+    return n ? n + 1 : 0;
+}
+
+class HullBody : public ParallelLoopBody
+{
+public:
+    HullBody( vector<Blob>& _blobs ) : blobs( _blobs ) {}
+
+    void operator()( const Range& range ) const
+    {
+        for( int i = range.start; i < range.end; i++ )
+        {
+            Blob& b = blobs[i];
+            b.defects.clear();
+            convexHull( b.contour, b.hull, false, false );
+            if( b.hull.size() > 3 && b.contour.size() > 3 )
+            {
+                // self-touching contours from findContours give a hull whose indices
+                // are not monotonous; such a blob is left without defects
+                try
+                {
+                    convexityDefects( b.contour, b.hull, b.defects );
+                }
+                catch( const cv::Exception& )
+                {
+                    b.defects.clear();
+                }
+            }
+            b.fingertips = countFingertips( b );
+        }
+    }
+
+private:
+    vector<Blob>& blobs;
+};
+
+class GestureTracker
+{
+public:
+    // k: blobs kept per frame; minArea: smaller ones are noise; alpha: weight of the new count
+    GestureTracker( int _k = 2, double _minArea = 1000, float _alpha = 0.3f ) : k( _k ), minArea( _minArea ), alpha( _alpha ) {}
+
+    // bw: binary frame; the kept blobs, largest first
+    const vector<Blob>& process( const Mat& bw )
+    {
+        findContours( bw, contours, RETR_EXTERNAL, CHAIN_APPROX_SIMPLE );
+        areas.resize( contours.size() );
+        order.clear();
+        for( size_t i = 0; i < contours.size(); i++ )
+        {
+            areas[i] = contourArea( contours[i] );
+            if( areas[i] >= minArea )
+                order.push_back( (int)i );
+        }
+        int n = std::min( k, (int)order.size() );
+        partial_sort( order.begin(), order.begin() + n, order.end(), AreaGreater( areas ) );
+
+        blobs.resize( n );
+        for( int i = 0; i < n; i++ )
+        {
+            Blob& b = blobs[i];
+            b.contour.swap( contours[order[i]] );
+            b.area = areas[order[i]];
+            Moments m = moments( b.contour );
+            b.centroid = Point2f( (float)( m.m10 / m.m00 ), (float)( m.m01 / m.m00 ) );
+        }
+        parallel_for_( Range( 0, n ), HullBody( blobs ) );
+        update();
+        return blobs;
+    }
+
+    // tracks[i] follows blobs[i]; tracks beyond blobs.size() were not seen this frame
+    const vector<BlobTrack>& tracks() const { return tracked; }
+
+private:
+    struct AreaGreater
+    {
+        AreaGreater( const vector<double>& _a ) : a( _a ) {}
+        bool operator()( int i, int j ) const { return a[i] > a[j]; }
+        const vector<double>& a;
+    };
+
+    // greedy nearest centroid matching, K is small
+    void update()
+    {
+        vector<BlobTrack> next( blobs.size() );
+        vector<bool> used( tracked.size(), false );
+        for( size_t i = 0; i < blobs.size(); i++ )
+        {
+            int best = -1;
+            double bestDist = 0;
+            for( size_t t = 0; t < tracked.size(); t++ )
+            {
+                double d = norm( tracked[t].centroid - blobs[i].centroid );
+                if( !used[t] && ( best < 0 || d < bestDist ) )
+                {
+                    best = (int)t;
+                    bestDist = d;
+                }
+            }
+            // a track further than the blob's size belongs to another hand
+            BlobTrack& tr = next[i];
+            tr.centroid = blobs[i].centroid;
+            if( best >= 0 && bestDist * bestDist < blobs[i].area )
+            {
+                used[best] = true;
+                tr.fingertips = tracked[best].fingertips + alpha * ( blobs[i].fingertips - tracked[best].fingertips );
+                tr.age = tracked[best].age + 1;
+            }
+            else
+            {
+                tr.fingertips = (float)blobs[i].fingertips;
+                tr.age = 1;
+            }
+            tr.missed = 0;
+        }
+        // unmatched tracks survive a few frames, a blob may drop under minArea for a moment
+        for( size_t t = 0; t < tracked.size(); t++ )
+            if( !used[t] && tracked[t].missed < 5 )
+            {
+                next.push_back( tracked[t] );
+                next.back().missed++;
+            }
+        tracked.swap( next );
+    }
+
+    int k;
+    double minArea;
+    float alpha;
+    vector<vector<Point> > contours;
+    vector<double> areas;
+    vector<int> order;
+    vector<Blob> blobs;
+    vector<BlobTrack> tracked;
+};
+
+static int video( VideoCapture& cap )
+{
+    GestureTracker tracker;
+    Mat frame, gray, bw;
+    double total = 0;
+    int frames = 0;
+    while( cap.read( frame ) )
+    {
+        int64 t = getTickCount();
+        cvtColor( frame, gray, COLOR_BGR2GRAY );
+        threshold( gray, bw, 127, 255, THRESH_BINARY );
+        const vector<Blob>& blobs = tracker.process( bw );
+        total += ( getTickCount() - t ) * 1000.0 / getTickFrequency();
+        frames++;
+
+        const vector<BlobTrack>& tracks = tracker.tracks();
+        for( size_t i = 0; i < blobs.size(); i++ )
+        {
+            const Blob& b = blobs[i];
+            vector<Point> hull;
+            for( size_t j = 0; j < b.hull.size(); j++ )
+                hull.push_back( b.contour[b.hull[j]] );
+            polylines( frame, hull, true, Scalar( 255, 0, 0 ), 2 );
+            for( size_t j = 0; j < b.defects.size(); j++ )
+                circle( frame, b.contour[b.defects[j][2]], 4, Scalar( 0, 0, 255 ), -1 );
+            putText( frame, format( "%.0f", tracks[i].fingertips ), b.centroid, FONT_HERSHEY_SIMPLEX, 1.5, Scalar( 0, 255, 0 ), 3 );
+        }
+        putText( frame, format( "%.2f ms", total / frames ), Point( 10, 30 ), FONT_HERSHEY_SIMPLEX, 0.8, Scalar( 0, 255, 255 ), 2 );
+        imshow( "result", frame );
+        if( waitKey( 1 ) == 27 )
+            break;
+    }
+    if( frames )
+        cout << frames << " frames, " << total / frames << " ms per frame" << endl;
+    return 0;
+}
+
+// convexityDefects_sample [image]          the hulls of a still image
+// convexityDefects_sample -v [file|camera] gesture video, camera 0 by default
 int main( int argc, char** argv )
 {
+    if( argc >= 2 && string( argv[1] ) == "-v" )
+    {
+        VideoCapture cap;
+        if( argc >= 3 && isdigit( (uchar)argv[2][0] ) && !argv[2][1] )
+            cap.open( argv[2][0] - '0' );
+        else if( argc >= 3 )
+            cap.open( argv[2] );
+        else
+            cap.open( 0 );
+        if( !cap.isOpened() )
+            return -1;
+        return video( cap );
+    }
+
     char* filename = argc >= 2 ? argv[1] : (char*)"fingers-1.png";
     Mat src = imread( filename );
     if (src.empty())
@@ -0,0 +1,225 @@
+// Every n-th row and column of a Mat, shared by the samples.
+//
+//     Mat even = decimateRows( src, 2 );             // a header: no copy, twice the step
+//     Mat odd;
+//     decimateCols( src, odd, 2, 1 );                // columns 1, 3, 5, ...
+//
+//     Mat preview;
+//     decimate( src, preview, 4 );                   // every 4th pixel, like INTER_NEAREST at 1/4
+//
+//     Mat planes[4];                                 // (0,0) (0,1) (1,0) (1,1) of a raw Bayer frame
+//     splitPhases2x2( raw, planes );
+//
+// Row decimation never touches the pixels: the result shares src's data and steps
+// over factor rows at a time. Column decimation copies. Pixels of 1, 2 or 4 bytes
+// are loaded as 8, 16 or 32 bit lanes and factors 2 to 4 are taken by
+// v_load_deinterleave, which treats the factor consecutive pixels as the channels of
+// one "pixel" and keeps the channel at the phase; 3 channel 8 bit images get the
+// same for a factor of 2. Everything else, and the tails, are copied pixel by pixel.
+// splitPhases2x2 deinterleaves each row once into the two planes of its row phase,
+// so the four planes are written in a single pass over the frame.
+
+#ifndef DECIMATE_HPP
+#define DECIMATE_HPP
+
+#include <opencv2/core.hpp>
+#include <opencv2/core/utility.hpp>
+#include <opencv2/core/hal/intrin.hpp>
+#include <algorithm>
+#include <cstring>
+
+namespace decimation
+{
+
+// d[x] = s[x * factor + phase] for x < width, n of them taken with SIMD
+template<typename T, typename V> inline int colsSimd( const T* s, T* d, int n, int factor, int phase )
+{
+    int x = 0;
+#if CV_SIMD128
+    const int lanes = V::nlanes;
+    s += phase;
+    if( factor == 2 )
+        for( ; x <= n - lanes; x += lanes )
+        {
+            V p[2];
+            cv::v_load_deinterleave( s + x * 2, p[0], p[1] );
+            cv::v_store( d + x, p[0] );
+        }
+    else if( factor == 3 )
+        for( ; x <= n - lanes; x += lanes )
+        {
+            V p[3];
+            cv::v_load_deinterleave( s + x * 3, p[0], p[1], p[2] );
+            cv::v_store( d + x, p[0] );
+        }
+    else if( factor == 4 )
+        for( ; x <= n - lanes; x += lanes )
+        {
+            V p[4];
+            cv::v_load_deinterleave( s + x * 4, p[0], p[1], p[2], p[3] );
+            cv::v_store( d + x, p[0] );
+        }
+#else
+    (void)s; (void)d; (void)n; (void)factor; (void)phase;
+#endif
+    return x;
+}
+
+template<typename T, typename V> inline void colsRow( const T* s, T* d, int width, int cols, int factor, int phase )
+{
+    // only whole groups of factor pixels are loaded, never past the end of the row
+    int x = colsSimd<T, V>( s, d, ( cols - phase ) / factor, factor, phase );
+    for( ; x < width; x++ )
+        d[x] = s[x * factor + phase];
+}
+
+// 3 channel 8 bit, factor 2: the even or odd bytes of two deinterleaved registers
+inline int colsSimd3x8u( const uchar* s, uchar* d, int n, int phase )
+{
+    int x = 0;
+#if CV_SIMD128
+    const cv::v_uint16x8 low = cv::v_setall_u16( 0xff );
+    for( ; x <= n - 16; x += 16 )
+    {
+        cv::v_uint8x16 a[3], b[3], out[3];
+        cv::v_load_deinterleave( s + x * 6, a[0], a[1], a[2] );
+        cv::v_load_deinterleave( s + x * 6 + 48, b[0], b[1], b[2] );
+        for( int c = 0; c < 3; c++ )
+        {
+            cv::v_uint16x8 ua = cv::v_reinterpret_as_u16( a[c] ), ub = cv::v_reinterpret_as_u16( b[c] );
+            if( phase )
+                out[c] = cv::v_pack( ua >> 8, ub >> 8 );
+            else
+                out[c] = cv::v_pack( ua & low, ub & low );
+        }
+        cv::v_store_interleave( d + x * 3, out[0], out[1], out[2] );
+    }
+#else
+    (void)s; (void)d; (void)n; (void)phase;
+#endif
+    return x;
+}
+
+inline void decimateRow( const uchar* s, uchar* d, int width, int cols, size_t esz, int factor, int phase )
+{
+    switch( esz )
+    {
+    case 1: colsRow<uchar, cv::v_uint8x16>( s, d, width, cols, factor, phase ); return;
+    case 2: colsRow<ushort, cv::v_uint16x8>( (const ushort*)s, (ushort*)d, width, cols, factor, phase ); return;
+    case 4: colsRow<unsigned, cv::v_uint32x4>( (const unsigned*)s, (unsigned*)d, width, cols, factor, phase ); return;
+    }
+    int x = esz == 3 && factor == 2 ? colsSimd3x8u( s, d, ( cols - phase ) / 2, phase ) : 0;
+    for( ; x < width; x++ )
+        memcpy( d + x * esz, s + ( (size_t)x * factor + phase ) * esz, esz );
+}
+
+// s to d0 (even pixels) and d1 (odd pixels)
+template<typename T, typename V> inline void splitRow2( const T* s, T* d0, T* d1, int cols )
+{
+    int x = 0;
+#if CV_SIMD128
+    const int lanes = V::nlanes;
+    for( ; x <= cols / 2 - lanes; x += lanes )
+    {
+        V a, b;
+        cv::v_load_deinterleave( s + x * 2, a, b );
+        cv::v_store( d0 + x, a );
+        cv::v_store( d1 + x, b );
+    }
+#endif
+    for( ; x * 2 < cols; x++ )
+    {
+        d0[x] = s[x * 2];
+        if( x * 2 + 1 < cols )
+            d1[x] = s[x * 2 + 1];
+    }
+}
+
+class ColsBody : public cv::ParallelLoopBody
+{
+public:
+    ColsBody( const cv::Mat& _src, cv::Mat& _dst, int _factor, int _phase ) : src( _src ), dst( _dst ), factor( _factor ), phase( _phase ) {}
+
+    void operator()( const cv::Range& range ) const
+    {
+        for( int y = range.start; y < range.end; y++ )
+            decimateRow( src.ptr( y ), dst.ptr( y ), dst.cols, src.cols, src.elemSize(), factor, phase );
+    }
+
+private:
+    const cv::Mat& src;
+    cv::Mat& dst;
+    int factor, phase;
+};
+
+template<typename T, typename V> class SplitBody : public cv::ParallelLoopBody
+{
+public:
+    SplitBody( const cv::Mat& _src, cv::Mat* _planes ) : src( _src ), planes( _planes ) {}
+
+    void operator()( const cv::Range& range ) const
+    {
+        for( int y = range.start; y < range.end; y++ )
+        {
+            cv::Mat* p = planes + ( y & 1 ) * 2;
+            splitRow2<T, V>( src.ptr<T>( y ), p[0].ptr<T>( y / 2 ), p[1].ptr<T>( y / 2 ), src.cols );
+        }
+    }
+
+private:
+    const cv::Mat& src;
+    cv::Mat* planes;
+};
+
+// one stripe per ~64K pixels, so small images stay on the calling thread
+inline double stripes( const cv::Mat& m )
+{
+    return std::max( 1.0, (double)m.total() / ( 1 << 16 ) );
+}
+
+}
+
+// Rows phase, phase + factor, phase + 2 * factor, ... of src; shares src's data.
+inline cv::Mat decimateRows( const cv::Mat& src, int factor, int phase = 0 )
+{
+    CV_Assert( src.dims == 2 && factor > 0 && phase >= 0 && phase < factor );
+    int rows = ( src.rows - phase + factor - 1 ) / factor;
+    if( rows <= 0 )
+        return cv::Mat();
+    return cv::Mat( rows, src.cols, src.type(), (void*)src.ptr( phase ), src.step * factor );
+}
+
+// Columns phase, phase + factor, ... of src, into dst.
+inline void decimateCols( const cv::Mat& src, cv::Mat& dst, int factor, int phase = 0 )
+{
+    CV_Assert( src.dims == 2 && factor > 0 && phase >= 0 && phase < factor );
+    int cols = ( src.cols - phase + factor - 1 ) / factor;
+    CV_Assert( cols > 0 && src.data != dst.data );
+    dst.create( src.rows, cols, src.type() );
+    cv::parallel_for_( cv::Range( 0, src.rows ), decimation::ColsBody( src, dst, factor, phase ), decimation::stripes( src ) );
+}
+
+// Every factor-th pixel in both directions, starting at (phase, phase).
+inline void decimate( const cv::Mat& src, cv::Mat& dst, int factor, int phase = 0 )
+{
+    cv::Mat rows = decimateRows( src, factor, phase );
+    decimateCols( rows, dst, factor, phase );
+}
+
+// The four 2x2 phases of a single channel 8 or 16 bit frame: planes[dy * 2 + dx]
+// holds the pixels (2y + dy, 2x + dx).
+inline void splitPhases2x2( const cv::Mat& src, cv::Mat planes[4] )
+{
+    CV_Assert( src.dims == 2 && src.channels() == 1 && ( src.depth() == CV_8U || src.depth() == CV_16U ) && src.rows >= 2 && src.cols >= 2 );
+    for( int k = 0; k < 4; k++ )
+    {
+        int dy = k / 2, dx = k % 2;
+        planes[k].create( ( src.rows - dy + 1 ) / 2, ( src.cols - dx + 1 ) / 2, src.type() );
+    }
+    if( src.depth() == CV_8U )
+        cv::parallel_for_( cv::Range( 0, src.rows ), decimation::SplitBody<uchar, cv::v_uint8x16>( src, planes ), decimation::stripes( src ) );
+    else
+        cv::parallel_for_( cv::Range( 0, src.rows ), decimation::SplitBody<ushort, cv::v_uint16x8>( src, planes ), decimation::stripes( src ) );
+}
+
+#endif
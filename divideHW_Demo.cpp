@@ -2,6 +2,8 @@
 #include "opencv2/imgproc.hpp"
 #include "opencv2/imgcodecs.hpp"
 #include "opencv2/highgui.hpp"
+#include "opencv2/core/hal/intrin.hpp"
+#include "stage_graph.hpp"
 
 using namespace cv;
 using namespace std;
@@ -18,9 +20,98 @@ int canny_threshold2 = 255;
 
 const char* window_name = "divideHW Demo";
 
+/**
+ * Row and column projections of a gray image, for any rectangle, built in one pass
+ * @param columns (rows + 1) x cols: columns(y, x) = sum of the pixels of column x above row y
+ * @param rows rows x (cols + 1): rows(y, x) = sum of the pixels of row y left of column x
+ * average() then gives the profile of reduce( gray( area ), dim, REDUCE_AVG ) with one
+ * subtraction per element, so subdividing a region never goes back to the pixels.
+ */
+class ProjectionProfiles
+{
+public:
+    void compute( const Mat& src )
+    {
+        Mat gray;
+        if( src.channels() == 3 )
+            cvtColor( src, gray, CV_BGR2GRAY );
+        else
+            gray = src;
+        CV_Assert( gray.type() == CV_8UC1 );
+
+        columns.create( gray.rows + 1, gray.cols, CV_32S );
+        rows.create( gray.rows, gray.cols + 1, CV_32S );
+        columns.row( 0 ).setTo( 0 );
+        for( int y = 0; y < gray.rows; y++ )
+        {
+            const uchar* g = gray.ptr<uchar>( y );
+            const unsigned* above = columns.ptr<unsigned>( y );
+            unsigned* below = columns.ptr<unsigned>( y + 1 );
+            int x = 0;
+#if CV_SIMD128
+            for( ; x <= gray.cols - 16; x += 16 )
+            {
+                v_uint16x8 w0, w1;
+                v_uint32x4 d0, d1, d2, d3;
+                v_expand( v_load( g + x ), w0, w1 );
+                v_expand( w0, d0, d1 );
+                v_expand( w1, d2, d3 );
+                v_store( below + x, v_load( above + x ) + d0 );
+                v_store( below + x + 4, v_load( above + x + 4 ) + d1 );
+                v_store( below + x + 8, v_load( above + x + 8 ) + d2 );
+                v_store( below + x + 12, v_load( above + x + 12 ) + d3 );
+            }
+#endif
+            for( ; x < gray.cols; x++ )
+                below[x] = above[x] + g[x];
+
+            int* r = rows.ptr<int>( y );
+            r[0] = 0;
+            for( x = 0; x < gray.cols; x++ )
+                r[x + 1] = r[x] + g[x];
+        }
+    }
+
+    Size size() const { return Size( columns.cols, rows.rows ); }
+
+    // dim 1: area.height x 1 profile of the row means, dim 0: 1 x area.width of the column means
+    void average( const Rect& area, int dim, Mat& profile ) const
+    {
+        if( dim )
+        {
+            profile.create( area.height, 1, CV_8U );
+            double scale = 1. / area.width;
+            for( int y = 0; y < area.height; y++ )
+            {
+                const int* r = rows.ptr<int>( area.y + y );
+                profile.at<uchar>( y ) = saturate_cast<uchar>( ( r[area.x + area.width] - r[area.x] ) * scale );
+            }
+        }
+        else
+        {
+            profile.create( 1, area.width, CV_8U );
+            double scale = 1. / area.height;
+            const int *top = columns.ptr<int>( area.y ) + area.x, *bottom = columns.ptr<int>( area.y + area.height ) + area.x;
+            uchar* d = profile.ptr<uchar>();
+            for( int x = 0; x < area.width; x++ )
+                d[x] = saturate_cast<uchar>( ( bottom[x] - top[x] ) * scale );
+        }
+    }
+
+private:
+    Mat columns, rows;
+};
+
 /** Function Headers */
 void process_image( int, void* );
 vector<Rect> divideHW( Mat src, int dim, double threshold1, double threshold2 );
+vector<Rect> divideHW( const ProjectionProfiles& profiles, const Rect& area, int dim, double threshold1, double threshold2 );
+
+/// stage outputs: the resized image and its profiles, its rows and the columns of every row
+Mat resized_clean;
+ProjectionProfiles profiles;
+vector<Rect> rois_h;
+vector<vector<Rect> > rois_w;
 
 /**
  * @function main
@@ -35,78 +126,102 @@ int main( int, char** argv )
         return -1;
     }
 
+    /// resize -> rows -> columns -> draw; the scale only reruns everything
+    StageGraph graph;
+    int resizeStage = graph.add( "resize", []( const StageGraph& g )
+    {
+        int s = std::max( 1, g.value( &scale ) );
+        resize( src, resized_clean, Size(), (double) 1 / s, (double) 1 / s );
+    }, {}, { &scale } );
+
+    int profilesStage = graph.add( "profiles", []( const StageGraph& )
+    {
+        profiles.compute( resized_clean );
+    }, { resizeStage } );
+
+    int rowsStage = graph.add( "rows", []( const StageGraph& g )
+    {
+        rois_h = divideHW( profiles, Rect( Point(), profiles.size() ), 1, g.value( &canny_threshold1 ), g.value( &canny_threshold2 ) );
+    }, { profilesStage }, { &canny_threshold1, &canny_threshold2 } );
+
+    int columnsStage = graph.add( "columns", []( const StageGraph& g )
+    {
+        rois_w.assign( rois_h.size(), vector<Rect>() );
+        if( !g.value( &vertical_divide ) )
+            return;
+        for( size_t i = 0; i < rois_h.size(); i++ )
+            rois_w[i] = divideHW( profiles, rois_h[i], 0, g.value( &canny_threshold1 ), g.value( &canny_threshold2 ) );
+    }, { rowsStage }, { &vertical_divide, &canny_threshold1, &canny_threshold2 } );
+
+    graph.add( "draw", []( const StageGraph& g )
+    {
+        int s = std::max( 1, g.value( &scale ) );
+        dst = src.clone();
+        resized_clean.copyTo( dst_resized );
+        for( size_t i = 0; i < rois_h.size(); i++ )
+        {
+            for( size_t j = 0; j < rois_w[i].size(); j++ )
+            {
+                Rect r = rois_w[i][j];
+                rectangle( dst_resized, r, Scalar( 0, 255, 0 ), 1 );
+                rectangle( dst, Rect( r.x * s, r.y * s, r.width * s, r.height * s ), Scalar( 0, 255, 0 ), 3 );
+            }
+            Rect r = rois_h[i];
+            rectangle( dst_resized, r, Scalar( 0, 0, 255 ), 2 );
+            rectangle( dst, Rect( r.x * s, r.y * s, r.width * s, r.height * s ), Scalar( 0, 0, 255), 3 );
+        }
+    }, { columnsStage }, { &scale } );
+
+    vector<const Mat*> outputs;
+    outputs.push_back( &dst );
+    outputs.push_back( &dst_resized );
+    AsyncStageRunner runner( graph, outputs );
+
     /// Create window
     namedWindow( window_name, WINDOW_NORMAL );
 
     /// Create Trackbar to select Vertical process
-    createTrackbar("Vertical process:", window_name, &vertical_divide, 1, process_image );
+    createTrackbar("Vertical process:", window_name, &vertical_divide, 1, process_image, &runner );
 
     /// Create Trackbar to select scale to resize
     createTrackbar( "Scale:", window_name,
                     &scale, 10,
-                    process_image );
+                    process_image, &runner );
 
     /// Create Trackbar to choose threshold1
     createTrackbar( "threshold1", window_name,
                     &canny_threshold1, 255,
-                    process_image );
+                    process_image, &runner );
 
     /// Create Trackbar to choose threshold2
     createTrackbar( "threshold2", window_name,
                     &canny_threshold2, 255,
-                    process_image );
+                    process_image, &runner );
 
     /// Default start
-    process_image( 0, 0 );
+    process_image( 0, &runner );
 
-    waitKey(0);
+    vector<Mat> shown;
+    for(;;)
+    {
+        if( runner.fetch( shown ) )
+        {
+            imshow( "resized", shown[1] );
+            imshow( window_name, shown[0] );
+        }
+        if( waitKey( 30 ) == 27 )
+            break;
+    }
     return 0;
 }
 
 /**
  * @function process_image
+ * schedules a run of the stages whose parameters changed, off the GUI thread
  */
-void process_image( int, void* )
+void process_image( int, void* runner )
 {
-    dst = src.clone();
-    if( scale < 1)
-    {
-        scale = 1;
-    }
-    resize( dst, dst_resized, Size(), (double) 1 / scale, (double) 1 / scale );
-
-    vector<Rect> rois_h = divideHW( dst_resized, 1, canny_threshold1, canny_threshold2 );
-
-    for( size_t i=0; i< rois_h.size(); i++ )
-    {
-        if( vertical_divide )
-        {
-            Mat roi_h = dst_resized( rois_h[i]);
-
-            vector<Rect> rois_w = divideHW( roi_h, 0, canny_threshold1, canny_threshold2 );
-
-            for( size_t j=0; j< rois_w.size(); j++ )
-            {
-                rois_w[j].y += rois_h[i].y;
-                rectangle( dst_resized, rois_w[j], Scalar( 0, 255, 0 ), 1 );
-                rois_w[j].x = rois_w[j].x * scale;
-                rois_w[j].y = rois_w[j].y * scale;
-                rois_w[j].width = rois_w[j].width * scale;
-                rois_w[j].height = rois_w[j].height * scale;
-
-                rectangle( dst, rois_w[j], Scalar( 0, 255, 0 ), 3 );
-            }
-        }
-        rectangle( dst_resized, rois_h[i], Scalar( 0, 0, 255 ), 2 );
-        rois_h[i].x = rois_h[i].x * scale;
-        rois_h[i].y = rois_h[i].y * scale;
-        rois_h[i].width = rois_h[i].width * scale;
-        rois_h[i].height = rois_h[i].height * scale;
-        rectangle( dst, rois_h[i], Scalar( 0, 0, 255), 3 );
-    }
-
-    imshow( "resized", dst_resized );
-    imshow( window_name, dst );
+    static_cast<AsyncStageRunner*>( runner )->request();
 }
 
 // helper function returns rectangles according horizontal or vertical projection of given image
@@ -118,65 +233,63 @@ void process_image( int, void* )
 
 vector<Rect> divideHW( Mat src, int dim, double threshold1, double threshold2 )
 {
-    Mat gray, reduced, canny;
-
-    if( src.channels() == 1 )
-    {
-        gray = src;
-    }
-
-    if( src.channels() == 3 )
-    {
-        cvtColor( src, gray, CV_BGR2GRAY );
-    }
+    ProjectionProfiles profiles;
+    profiles.compute( src );
+    return divideHW( profiles, Rect( 0, 0, src.cols, src.rows ), dim, threshold1, threshold2 );
+}
 
-    reduce( gray, reduced, dim, REDUCE_AVG );
+// same split from precomputed profiles; area is in image coordinates and so are the rectangles
+vector<Rect> divideHW( const ProjectionProfiles& profiles, const Rect& area, int dim, double threshold1, double threshold2 )
+{
+    if( area.area() == 0 )
+        return vector<Rect>( 1, area );
 
-    //GaussianBlur( reduced, reduced, Size(),3);
+    Mat reduced, canny;
+    profiles.average( area, dim, reduced );
 
     Canny( reduced, canny, threshold1, threshold2 );
 
     vector<Point> pts;
-    findNonZero( canny, pts);
+    findNonZero( canny, pts );
 
     vector<Rect> rects;
 
-    Rect rect(0,0,gray.cols,gray.rows);
+    Rect rect = area;
     if( !pts.size() )
     {
         rects.push_back( rect );
     }
-    int ref_x = 0;
-    int ref_y = 0;
+    int ref_x = area.x;
+    int ref_y = area.y;
 
-    for( size_t i=0; i< pts.size(); i++ )
+    for( size_t i = 0; i < pts.size(); i++ )
     {
         if( dim )
         {
-            rect.height = pts[i].y-ref_y;
+            int y = area.y + pts[i].y;
+            rect.height = y - ref_y;
             rects.push_back( rect );
-            rect.y = pts[i].y;
-            ref_y = rect.y;
-            if( i == pts.size()-1 )
+            rect.y = y;
+            ref_y = y;
+            if( i == pts.size() - 1 )
             {
-                rect.height = gray.rows - pts[i].y;
+                rect.height = area.y + area.height - y;
                 rects.push_back( rect );
             }
         }
-
         else
         {
-            rect.width = pts[i].x-ref_x;
+            int x = area.x + pts[i].x;
+            rect.width = x - ref_x;
             rects.push_back( rect );
-            rect.x = pts[i].x;
-            ref_x = rect.x;
-            if( i == pts.size()-1 )
+            rect.x = x;
+            ref_x = x;
+            if( i == pts.size() - 1 )
             {
-                rect.width = gray.cols - pts[i].x;
+                rect.width = area.x + area.width - x;
                 rects.push_back( rect );
             }
         }
-
     }
     return rects;
 }
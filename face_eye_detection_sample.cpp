@@ -1,5 +1,5 @@
 const char *faceCascadeFilename = "lbpcascade_frontalface.xml";     // LBP face detector.
-const char *eyeCascadeFilename1 = "haarcascade_mcs_rightteye.xml";               // Basic eye detector for open eyes only.
+const char *eyeCascadeFilename1 = "haarcascade_mcs_righteye.xml";               // Basic eye detector for open eyes only.
 const char *eyeCascadeFilename2 = "haarcascade_mcs_lefteye.xml"; // Basic eye detector for open eyes if they might wear glasses.
 
 const char *windowName = "WebcamFaceRec";   // Name shown in the GUI window.
@@ -9,6 +9,8 @@ const char *windowName = "WebcamFaceRec";   // Name shown in the GUI window.
 #include <iostream>
 
 #include "opencv2/opencv.hpp"
+#include "frame_arena.hpp"
+#include "yuv_frame.hpp"
 
 using namespace cv;
 using namespace std;
@@ -28,14 +30,9 @@ Rect shrinkRect( Rect rect, int width_percent, int height_percent )
 }
 
 
-// Search for just a single object in the image, such as the largest face, storing the result into 'largestObject'.
-// Can use Haar cascades or LBP cascades for Face Detection, or even eye, mouth, or car detection.
-// Input is temporarily shrunk to 'scaledWidth' for much faster detection, since 200 is enough to find faces.
-// Note: detectLargestObject() should be faster than detectManyObjects().
-void detectObjectsCustom(const Mat &img, CascadeClassifier &cascade, vector<Rect> &objects, int scaledWidth, int flags, Size minFeatureSize, float searchScaleFactor, int minNeighbors)
+// If the input image is not grayscale, then convert the BGR or BGRA color image to grayscale.
+void toGray(const Mat &img, Mat &gray)
 {
-    // If the input image is not grayscale, then convert the BGR or BGRA color image to grayscale.
-    Mat gray;
     if (img.channels() == 3)
     {
         cvtColor(img, gray, CV_BGR2GRAY);
@@ -49,31 +46,39 @@ void detectObjectsCustom(const Mat &img, CascadeClassifier &cascade, vector<Rect
         // Access the input image directly, since it is already grayscale.
         gray = img;
     }
+}
 
+// Shrink a gray image to 'scaledWidth' and equalize it. 'scale' receives the factor to map results back.
+void prepareDetectionImage(const Mat &gray, int scaledWidth, Mat &shrunk, Mat &equalized, float &scale)
+{
     // Possibly shrink the image, to run much faster.
-    Mat inputImg;
-    float scale = img.cols / (float)scaledWidth;
-    if (img.cols > scaledWidth)
+    scale = gray.cols / (float)scaledWidth;
+    const Mat *inputImg = &gray;
+    if (gray.cols > scaledWidth)
     {
         // Shrink the image while keeping the same aspect ratio.
-        int scaledHeight = cvRound(img.rows / scale);
-        resize(gray, inputImg, Size(scaledWidth, scaledHeight));
+        int scaledHeight = cvRound(gray.rows / scale);
+        resize(gray, shrunk, Size(scaledWidth, scaledHeight));
+        inputImg = &shrunk;
     }
     else
     {
-        // Access the input image directly, since it is already small.
-        inputImg = gray;
+        scale = 1.f;
     }
 
     // Standardize the brightness and contrast to improve dark images.
-    Mat equalizedImg;
-    equalizeHist(inputImg, equalizedImg);
+    equalizeHist(*inputImg, equalized);
+}
 
+// Run a cascade on an already prepared (gray, shrunk, equalized) image and map the results
+// back to an image of size 'original' that was shrunk by 'scale'.
+void detectObjectsPrepared(const Mat &equalizedImg, float scale, Size original, CascadeClassifier &cascade, vector<Rect> &objects, int flags, Size minFeatureSize, float searchScaleFactor, int minNeighbors)
+{
     // Detect objects in the small grayscale image.
     cascade.detectMultiScale(equalizedImg, objects, searchScaleFactor, minNeighbors, flags, minFeatureSize);
 
     // Enlarge the results if the image was temporarily shrunk before detection.
-    if (img.cols > scaledWidth)
+    if (scale != 1.f)
     {
         for (int i = 0; i < (int)objects.size(); i++)
         {
@@ -91,17 +96,30 @@ void detectObjectsCustom(const Mat &img, CascadeClassifier &cascade, vector<Rect
             objects[i].x = 0;
         if (objects[i].y < 0)
             objects[i].y = 0;
-        if (objects[i].x + objects[i].width > img.cols)
-            objects[i].x = img.cols - objects[i].width;
-        if (objects[i].y + objects[i].height > img.rows)
-            objects[i].y = img.rows - objects[i].height;
+        if (objects[i].x + objects[i].width > original.width)
+            objects[i].x = original.width - objects[i].width;
+        if (objects[i].y + objects[i].height > original.height)
+            objects[i].y = original.height - objects[i].height;
     }
 
     // Return with the detected face rectangles stored in "objects".
 }
 
+// Search for just a single object in the image, such as the largest face, storing the result into 'largestObject'.
+// Can use Haar cascades or LBP cascades for Face Detection, or even eye, mouth, or car detection.
+// Input is temporarily shrunk to 'scaledWidth' for much faster detection, since 200 is enough to find faces.
+// Note: detectLargestObject() should be faster than detectManyObjects().
+void detectObjectsCustom(const Mat &img, CascadeClassifier &cascade, vector<Rect> &objects, int scaledWidth, int flags, Size minFeatureSize, float searchScaleFactor, int minNeighbors)
+{
+    Mat gray, shrunk, equalizedImg;
+    float scale;
+    toGray(img, gray);
+    prepareDetectionImage(gray, scaledWidth, shrunk, equalizedImg, scale);
+    detectObjectsPrepared(equalizedImg, scale, img.size(), cascade, objects, flags, minFeatureSize, searchScaleFactor, minNeighbors);
+}
 
-void detectLargestObject(const Mat &img, CascadeClassifier &cascade, Rect &largestObject, int scaledWidth)
+
+void detectLargestObjectPrepared(const Mat &equalizedImg, float scale, Size original, CascadeClassifier &cascade, Rect &largestObject)
 {
     // Only search for just 1 object (the biggest in the image).
     int flags = CASCADE_FIND_BIGGEST_OBJECT;// | CASCADE_DO_ROUGH_SEARCH;
@@ -115,22 +133,64 @@ void detectLargestObject(const Mat &img, CascadeClassifier &cascade, Rect &large
 
     // Perform Object or Face Detection, looking for just 1 object (the biggest in the image).
     vector<Rect> objects;
-    detectObjectsCustom(img, cascade, objects, scaledWidth, flags, minFeatureSize, searchScaleFactor, minNeighbors);
+    detectObjectsPrepared(equalizedImg, scale, original, cascade, objects, flags, minFeatureSize, searchScaleFactor, minNeighbors);
     if (objects.size() > 0)
     {
         // Return the only detected object.
         largestObject = (Rect)objects.at(0);
-
-
     }
     else
     {
         // Return an invalid rect.
         largestObject = Rect(-1, -1, -1, -1);
     }
+}
 
+void detectLargestObject(const Mat &img, CascadeClassifier &cascade, Rect &largestObject, int scaledWidth)
+{
+    Mat gray, shrunk, equalizedImg;
+    float scale;
+    toGray(img, gray);
+    prepareDetectionImage(gray, scaledWidth, shrunk, equalizedImg, scale);
+    detectLargestObjectPrepared(equalizedImg, scale, img.size(), cascade, largestObject);
 }
 
+
+// Per-frame detection state. The gray conversion and the shrunk and equalized face search
+// image are each built once per frame and shared by the cascades; the eye cascades search
+// ROIs of the gray frame, each equalized once by detectBothEyes(). A context lives for one
+// frame, inside its FrameScope, so its buffers come from the frame arena rather than
+// being kept from one frame to the next.
+struct DetectionContext
+{
+    Mat gray;           // full resolution gray frame
+    Mat shrunk;         // gray frame shrunk to the face search width
+    Mat equalized;      // equalized face search image
+    float scale;        // equalized -> gray scale factor
+    Rect face;
+
+    void build(const Mat &frame, int scaledWidth)
+    {
+        toGray(frame, gray);
+        prepareDetectionImage(gray, scaledWidth, shrunk, equalized, scale);
+        face = Rect();
+    }
+
+    // straight from the camera's YUV frame: gray is its Y plane, not a conversion
+    void build(YuvFrame &frame, int scaledWidth)
+    {
+        gray = frame.gray();
+        prepareDetectionImage(gray, scaledWidth, shrunk, equalized, scale);
+        face = Rect();
+    }
+
+    bool detectFace(CascadeClassifier &faceCascade)
+    {
+        detectLargestObjectPrepared(equalized, scale, gray.size(), faceCascade, face);
+        return face.width > 0;
+    }
+};
+
 void initDetectors(CascadeClassifier &faceCascade, CascadeClassifier &eyeCascade1, CascadeClassifier &eyeCascade2)
 {
     // Load the Face Detection cascade classifier xml file.
@@ -201,6 +261,8 @@ void initWebcam(VideoCapture &videoCapture, int cameraNumber)
 }
 
 
+// "face" is the gray face crop; each eye region is equalized on its own, as detectLargestObject()
+// would, once for both eye cascades.
 void detectBothEyes(const Mat &face, CascadeClassifier &eyeCascade1, CascadeClassifier &eyeCascade2, Point &leftEye, Point &rightEye, Rect *searchedLeftEye, Rect *searchedRightEye)
 {
     // Skip the borders of the face, since it is usually just hair and ears, that we don't care about.
@@ -241,17 +303,10 @@ void detectBothEyes(const Mat &face, CascadeClassifier &eyeCascade1, CascadeClas
     Mat new_rect= face(Rect(newX, newY, newWidth, newHeight));
     */
 
-    Mat topLeftOfFace = face(Rect(leftX, topY, widthX, heightY));
-
-
+    Mat topLeftOfFace, topRightOfFace;
+    equalizeHist(face(Rect(leftX, topY, widthX, heightY)), topLeftOfFace);
 
-    Mat binaryMat;
-    //Apply thresholding
-    cv::threshold(topLeftOfFace, binaryMat, 60, 255, cv::THRESH_BINARY);
-
-    //imshow("threshold   ", binaryMat);
-
-    Mat topRightOfFace = face(Rect(rightX, topY, widthX, heightY));
+    equalizeHist(face(Rect(rightX, topY, widthX, heightY)), topRightOfFace);
     //imshow("topRightOfFace  ", topRightOfFace);
 
 
@@ -264,15 +319,15 @@ void detectBothEyes(const Mat &face, CascadeClassifier &eyeCascade1, CascadeClas
         *searchedRightEye = Rect(rightX, topY, widthX, heightY);
 
     // Search the left region, then the right region using the 1st eye detector.
-    detectLargestObject(topLeftOfFace, eyeCascade1, leftEyeRect, topLeftOfFace.cols);
+    detectLargestObjectPrepared(topLeftOfFace, 1.f, topLeftOfFace.size(), eyeCascade1, leftEyeRect);
 
 
-    detectLargestObject(topRightOfFace, eyeCascade1, rightEyeRect, topRightOfFace.cols);
+    detectLargestObjectPrepared(topRightOfFace, 1.f, topRightOfFace.size(), eyeCascade1, rightEyeRect);
 
     // If the eye was not detected, try a different cascade classifier.
     if (leftEyeRect.width <= 0 && !eyeCascade2.empty())
     {
-        detectLargestObject(topLeftOfFace, eyeCascade2, leftEyeRect, topLeftOfFace.cols);
+        detectLargestObjectPrepared(topLeftOfFace, 1.f, topLeftOfFace.size(), eyeCascade2, leftEyeRect);
         //if (leftEyeRect.width > 0)
         //    cout << "2nd eye detector LEFT SUCCESS" << endl;
         //else
@@ -284,7 +339,7 @@ void detectBothEyes(const Mat &face, CascadeClassifier &eyeCascade1, CascadeClas
     // If the eye was not detected, try a different cascade classifier.
     if (rightEyeRect.width <= 0 && !eyeCascade2.empty())
     {
-        detectLargestObject(topRightOfFace, eyeCascade2, rightEyeRect, topRightOfFace.cols);
+        detectLargestObjectPrepared(topRightOfFace, 1.f, topRightOfFace.size(), eyeCascade2, rightEyeRect);
         //if (rightEyeRect.width > 0)
         //    cout << "2nd eye detector RIGHT SUCCESS" << endl;
         //else
@@ -338,39 +393,35 @@ int main()
     // Load the face and 1 or 2 eye detection XML classifiers.
     initDetectors(faceCascade, eyeCascade1, eyeCascade2);
 
-    Mat thresh, gray;
+    // detection runs on the Y plane of the native frames, BGR is only made for display
+    YuvFrame::enable(videoCapture);
+    YuvFrame yuv;
+
+    // the frame and every temporary of it come from the arena, rewound once per frame
+    FrameArena arena;
     while (1)
     {
-        Mat frame;
-        videoCapture >> frame;
-        detectLargestObject(frame, faceCascade, faceRect, frame.cols);
-        if (faceRect.width > 0)
+        FrameScope scope(arena);
+        Mat frame, thresh;
+        DetectionContext ctx;
+        if (!yuv.read(videoCapture))
+            break;
+        yuv.bgr(frame);
+
+        ctx.build(yuv, frame.cols);
+        if (ctx.detectFace(faceCascade))
         {
             // modification is begin here
+            faceRect = ctx.face;
 
             Mat faceImg = frame(faceRect);
 
             rectangle(frame, faceRect, CV_RGB(255, 0, 0), 2, CV_AA);
 
-            Mat gray;
-            if (faceImg.channels() == 3)
-            {
-                cvtColor(faceImg, gray, CV_BGR2GRAY);
-            }
-            else if (faceImg.channels() == 4)
-            {
-                cvtColor(faceImg, gray, CV_BGRA2GRAY);
-            }
-            else
-            {
-                // Access the input image directly, since it is already grayscale.
-                gray = faceImg;
-            }
-
             Point leftEye, rightEye;
             Rect searchedLeftEye, searchedRightEye;
 
-            detectBothEyes(gray, eyeCascade1, eyeCascade2, leftEye, rightEye, &searchedLeftEye, &searchedRightEye);
+            detectBothEyes(ctx.gray(faceRect), eyeCascade1, eyeCascade2, leftEye, rightEye, &searchedLeftEye, &searchedRightEye);
 
             rectangle(faceImg, searchedLeftEye, Scalar(0, 255, 0), 2, 8, 0);
             rectangle(faceImg, searchedRightEye, Scalar(0, 255, 0), 2, 8, 0);
@@ -385,11 +436,10 @@ int main()
 
             searchedRightEye.height -= searchedRightEye.height / 3;
 
-            Mat eye_region = faceImg(searchedRightEye);
-
-            cvtColor(eye_region, gray, CV_BGR2GRAY);
+            // the gray frame is already there, no need to convert the eye region again
+            Mat eye_region = ctx.gray(faceRect)(searchedRightEye);
 
-            threshold(gray, thresh, 60, 255, THRESH_BINARY);
+            threshold(eye_region, thresh, 60, 255, THRESH_BINARY);
 
 
             imshow("eye_  video", thresh);
@@ -400,5 +450,6 @@ int main()
         if (waitKey(30) == 'c') break;
     }
 
+    FrameArenaAllocator::instance().report(cout);
     return 0;
 }
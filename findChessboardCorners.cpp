@@ -1,16 +1,294 @@
 #include "qa.hpp"
+#include "image_cache.hpp"
 #include "opencv2/imgproc.hpp"
 #include "opencv2/highgui.hpp"
 #include "opencv2/calib3d.hpp"
+#include <sys/stat.h>
+#include <iostream>
+#include <map>
 
 using namespace cv;
 using namespace std;
 
+// Coarse to fine detection of calibration patterns, for frames of many megapixels.
+// The pattern is found on a downscaled copy, where the detectors are fast and a frame
+// without the pattern is rejected early (CALIB_CB_FAST_CHECK). The points are then
+// scaled back and refined at full resolution, each in a window around its coarse
+// position that stays clear of its neighbours: cornerSubPix for chessboard corners,
+// the centroid of the dark blob for circle centers.
+
+enum CalibPattern
+{
+    PATTERN_CHESSBOARD,
+    PATTERN_CIRCLES_GRID
+};
+
+static bool findPattern(const Mat& gray, CalibPattern pattern, Size patternsize, vector<Point2f>& points)
+{
+    if (pattern == PATTERN_CHESSBOARD)
+        return findChessboardCorners(gray, patternsize, points,
+                                     CALIB_CB_ADAPTIVE_THRESH + CALIB_CB_NORMALIZE_IMAGE + CALIB_CB_FAST_CHECK);
+    return findCirclesGrid(gray, patternsize, points);
+}
+
+// smallest distance between two neighbours of the grid, in pixels
+static double gridSpacing(const vector<Point2f>& points, Size patternsize)
+{
+    double spacing = DBL_MAX;
+    for (int r = 0; r < patternsize.height; r++)
+        for (int c = 0; c < patternsize.width; c++)
+        {
+            const Point2f& p = points[r * patternsize.width + c];
+            if (c + 1 < patternsize.width)
+                spacing = std::min(spacing, norm(points[r * patternsize.width + c + 1] - p));
+            if (r + 1 < patternsize.height)
+                spacing = std::min(spacing, norm(points[(r + 1) * patternsize.width + c] - p));
+        }
+    return spacing;
+}
+
+// points: coarse positions in full resolution coordinates, refined in place.
+// coarseScale: full resolution pixels per coarse pixel, the expected error.
+static void refinePoints(const Mat& gray, CalibPattern pattern, Size patternsize, double coarseScale, vector<Point2f>& points)
+{
+    double spacing = gridSpacing(points, patternsize);
+    int half = std::max(2, std::min(cvCeil(2 * coarseScale) + 3, (int)(spacing / 3)));
+    if (pattern == PATTERN_CHESSBOARD)
+    {
+        cornerSubPix(gray, points, Size(half, half), Size(-1, -1),
+                     TermCriteria(TermCriteria::EPS + TermCriteria::COUNT, 30, 0.1));
+        return;
+    }
+    // circles: the dark blob around the center, the window must hold the whole circle
+    half = std::max(half, (int)(spacing / 3));
+    Rect image(0, 0, gray.cols, gray.rows);
+    for (size_t i = 0; i < points.size(); i++)
+    {
+        Rect win = Rect(cvRound(points[i].x) - half, cvRound(points[i].y) - half, 2 * half + 1, 2 * half + 1) & image;
+        if (win.area() == 0)
+            continue;
+        Mat blob;
+        threshold(gray(win), blob, 0, 255, THRESH_BINARY_INV | THRESH_OTSU);
+        Moments m = moments(blob, true);
+        if (m.m00 > 0)
+            points[i] = Point2f((float)(win.x + m.m10 / m.m00), (float)(win.y + m.m01 / m.m00));
+    }
+}
+
+// points: found on coarse, scaled to gray, the full resolution image, and refined there
+static void refineCoarsePoints(Size coarseSize, const Mat& gray, CalibPattern pattern, Size patternsize, vector<Point2f>& points)
+{
+    double sx = (double)gray.cols / coarseSize.width, sy = (double)gray.rows / coarseSize.height;
+    if (sx != 1 || sy != 1)
+        for (size_t i = 0; i < points.size(); i++)
+            points[i] = Point2f((float)((points[i].x + 0.5) * sx - 0.5), (float)((points[i].y + 0.5) * sy - 0.5));
+    refinePoints(gray, pattern, patternsize, std::max(sx, sy), points);
+}
+
+// coarse: gray downscaled by some factor; gray: the full resolution image
+static bool detectCoarseToFine(const Mat& coarse, const Mat& gray, CalibPattern pattern, Size patternsize, vector<Point2f>& points)
+{
+    if (!findPattern(coarse, pattern, patternsize, points))
+        return false;
+    refineCoarsePoints(coarse.size(), gray, pattern, patternsize, points);
+    return true;
+}
+
+// the same for an image in memory, downscaled to at most maxSide pixels
+static bool detectCoarseToFine(const Mat& gray, CalibPattern pattern, Size patternsize, vector<Point2f>& points, int maxSide = 1000)
+{
+    double scale = (double)maxSide / std::max(gray.cols, gray.rows);
+    if (scale >= 1)
+        return detectCoarseToFine(gray, gray, pattern, patternsize, points);
+    Mat coarse;
+    resize(gray, coarse, Size(), scale, scale, INTER_AREA);
+    return detectCoarseToFine(coarse, gray, pattern, patternsize, points);
+}
+
+struct CalibDetection
+{
+    string path;
+    long long mtime, fileSize;
+    Size imageSize;
+    bool found;
+    vector<Point2f> points;
+};
+
+// the imread flags that decode at 1 / reduce of the size
+static int reducedGrayscale(int reduce)
+{
+    return reduce >= 8 ? IMREAD_REDUCED_GRAYSCALE_8 : reduce >= 4 ? IMREAD_REDUCED_GRAYSCALE_4
+         : reduce >= 2 ? IMREAD_REDUCED_GRAYSCALE_2 : IMREAD_GRAYSCALE;
+}
+
+class CalibDetectBody : public ParallelLoopBody
+{
+public:
+    CalibDetectBody(vector<CalibDetection>& _frames, const vector<int>& _todo, CalibPattern _pattern, Size _patternsize, int _reduce)
+        : frames(_frames), todo(_todo), pattern(_pattern), patternsize(_patternsize), reduce(_reduce) {}
+
+    void operator()(const Range& range) const
+    {
+        for (int i = range.start; i < range.end; i++)
+        {
+            CalibDetection& f = frames[todo[i]];
+            f.found = false;
+            f.points.clear();
+            // the decoder downscales, a frame rejected here is never decoded at full size
+            Mat coarse = imread(f.path, reducedGrayscale(reduce));
+            if (coarse.empty())
+                continue;
+            // less on small frames: the squares must stay wide enough to be found
+            int r = reduce;
+            while (r > 1 && coarse.cols * reduce / r < minCoarseWidth)
+                r /= 2;
+            if (r != reduce)
+                coarse = imread(f.path, reducedGrayscale(r));
+            if (coarse.empty() || !findPattern(coarse, pattern, patternsize, f.points))
+                continue;
+            Mat gray = r == 1 ? coarse : imread(f.path, IMREAD_GRAYSCALE);
+            if (gray.empty())
+            {
+                f.points.clear();
+                continue;
+            }
+            f.imageSize = gray.size();
+            // the points of the coarse pass are kept, only the refinement is left
+            refineCoarsePoints(coarse.size(), gray, pattern, patternsize, f.points);
+            f.found = true;
+        }
+    }
+
+private:
+    static const int minCoarseWidth = 640;
+
+    vector<CalibDetection>& frames;
+    const vector<int>& todo;
+    CalibPattern pattern;
+    Size patternsize;
+    int reduce;
+};
+
+// Detects a pattern in every frame of a directory, in parallel, and calibrates from
+// the detections. Detections are cached per file (path, modification time and size)
+// in memory and, with load()/save(), in a YAML file: a second calibration with other
+// flags, or a run after a few frames were added, only detects what is new.
+class CalibrationFrontEnd
+{
+public:
+    // reduce: 1, 2, 4 or 8, the most the coarse pass downscales; a frame is downscaled
+    // less when that keeps the coarse image at least 640 pixels wide
+    CalibrationFrontEnd(CalibPattern _pattern, Size _patternsize, int _reduce = 4)
+        : pattern(_pattern), patternsize(_patternsize), reduce(_reduce), detected(0) {}
+
+    // frames matching globPattern, in file name order
+    const vector<CalibDetection>& detect(const String& globPattern)
+    {
+        vector<String> paths;
+        glob(globPattern, paths, false);
+        vector<CalibDetection> current(paths.size());
+        vector<int> todo;
+        for (size_t i = 0; i < paths.size(); i++)
+        {
+            CalibDetection& f = current[i];
+            f.path = paths[i];
+            struct stat st;
+            f.mtime = stat(f.path.c_str(), &st) == 0 ? (long long)st.st_mtime : -1;
+            f.fileSize = f.mtime >= 0 ? (long long)st.st_size : -1;
+            map<string, CalibDetection>::const_iterator it = cache.find(f.path);
+            if (it != cache.end() && it->second.mtime == f.mtime && it->second.fileSize == f.fileSize)
+                f = it->second;
+            else
+                todo.push_back((int)i);
+        }
+        parallel_for_(Range(0, (int)todo.size()), CalibDetectBody(current, todo, pattern, patternsize, reduce));
+        detected = (int)todo.size();
+        for (size_t i = 0; i < current.size(); i++)
+            cache[current[i].path] = current[i];
+        frames.swap(current);
+        return frames;
+    }
+
+    // frames detected by the last detect(), the others came from the cache
+    int detectedCount() const { return detected; }
+
+    // RMS reprojection error of calibrateCamera over the frames where the pattern was found
+    double calibrate(float squareSize, int flags, Mat& cameraMatrix, Mat& distCoeffs) const
+    {
+        vector<Point3f> board;
+        for (int r = 0; r < patternsize.height; r++)
+            for (int c = 0; c < patternsize.width; c++)
+                board.push_back(Point3f(c * squareSize, r * squareSize, 0));
+        vector<vector<Point3f> > objectPoints;
+        vector<vector<Point2f> > imagePoints;
+        Size imageSize;
+        for (size_t i = 0; i < frames.size(); i++)
+            if (frames[i].found)
+            {
+                objectPoints.push_back(board);
+                imagePoints.push_back(frames[i].points);
+                imageSize = frames[i].imageSize;
+            }
+        if (imagePoints.size() < 3)
+            return -1;
+        vector<Mat> rvecs, tvecs;
+        return calibrateCamera(objectPoints, imagePoints, imageSize, cameraMatrix, distCoeffs, rvecs, tvecs, flags);
+    }
+
+    // the cache is dropped when it was made for another pattern
+    bool load(const string& file)
+    {
+        FileStorage fs(file, FileStorage::READ);
+        if (!fs.isOpened() || (int)fs["pattern"] != pattern || (int)fs["cols"] != patternsize.width
+            || (int)fs["rows"] != patternsize.height || (int)fs["reduce"] != reduce)
+            return false;
+        FileNode list = fs["frames"];
+        for (FileNodeIterator it = list.begin(); it != list.end(); ++it)
+        {
+            CalibDetection f;
+            (*it)["path"] >> f.path;
+            f.mtime = (long long)(double)(*it)["mtime"];
+            f.fileSize = (long long)(double)(*it)["size"];
+            f.found = (int)(*it)["found"] != 0;
+            f.imageSize = Size((int)(*it)["width"], (int)(*it)["height"]);
+            Mat points;
+            (*it)["points"] >> points;
+            if (f.found)
+                points.reshape(2, 1).copyTo(f.points);
+            cache[f.path] = f;
+        }
+        return true;
+    }
+
+    void save(const string& file) const
+    {
+        FileStorage fs(file, FileStorage::WRITE);
+        fs << "pattern" << (int)pattern << "cols" << patternsize.width << "rows" << patternsize.height << "reduce" << reduce;
+        fs << "frames" << "[";
+        for (map<string, CalibDetection>::const_iterator it = cache.begin(); it != cache.end(); ++it)
+        {
+            const CalibDetection& f = it->second;
+            // times and sizes as doubles: FileStorage has no 64 bit integers
+            fs << "{" << "path" << f.path << "mtime" << (double)f.mtime << "size" << (double)f.fileSize
+               << "found" << (int)f.found << "width" << f.imageSize.width << "height" << f.imageSize.height
+               << "points" << Mat(f.points, true) << "}";
+        }
+        fs << "]";
+    }
+
+private:
+    CalibPattern pattern;
+    Size patternsize;
+    int reduce, detected;
+    vector<CalibDetection> frames;
+    map<string, CalibDetection> cache;
+};
+
 //Sample usage of detecting and drawing chessboard corners
 
 bool detectAndDrawChessboardCorners()
 {
-    Mat img = imread("right07.jpg",33);
+    Mat img = cachedImread("right07.jpg",33).clone();
     imshow("image",img);
     moveWindow("image",40,40);
 
@@ -21,13 +299,8 @@ bool detectAndDrawChessboardCorners()
 
     //CALIB_CB_FAST_CHECK saves a lot of time on images
     //that do not contain any chessboard corners
-    bool patternfound = findChessboardCorners(gray, patternsize, corners,
-                        CALIB_CB_ADAPTIVE_THRESH + CALIB_CB_NORMALIZE_IMAGE
-                        + CALIB_CB_FAST_CHECK);
-
-    if(patternfound)
-        cornerSubPix(gray, corners, Size(11, 11), Size(-1, -1),
-                     TermCriteria(CV_TERMCRIT_EPS + CV_TERMCRIT_ITER, 30, 0.1));
+    //found on a copy of at most 1000 pixels, refined at full resolution
+    bool patternfound = detectCoarseToFine(gray, PATTERN_CHESSBOARD, patternsize, corners);
 
     drawChessboardCorners(img, patternsize, Mat(corners), patternfound);
 
@@ -41,14 +314,14 @@ bool detectAndDrawChessboardCorners()
 
 bool detectAndDrawCentersOfCircles()
 {
-    Mat img = imread("circles6.png");
+    Mat img = cachedImread("circles6.png").clone();
     imshow("image",img);
     Size patternsize(7,7); //number of centers
     Mat gray;
     cvtColor(img,gray,COLOR_BGR2GRAY);//source image
     vector<Point2f> centers; //this will be filled by the detected centers
 
-    bool patternfound = findCirclesGrid(gray, patternsize, centers);
+    bool patternfound = detectCoarseToFine(gray, PATTERN_CIRCLES_GRID, patternsize, centers);
 
     drawChessboardCorners(img, patternsize, Mat(centers), patternfound);
 
@@ -58,11 +331,47 @@ bool detectAndDrawCentersOfCircles()
     return true;
 }
 
+//Calibration from every frame matching argv[1], twice: the second run only
+//calibrates again, the detections come from the cache
+
+int acalibrationFrontEnd( int argc, char** argv )
+{
+    String frames = argc >= 2 ? argv[1] : "right*.jpg";
+    string cacheFile = argc >= 3 ? argv[2] : "calibration_cache.yml";
+    CalibrationFrontEnd frontEnd(PATTERN_CHESSBOARD, Size(8,6));
+    frontEnd.load(cacheFile);
+
+    int flags[] = { 0, CALIB_FIX_K3 | CALIB_ZERO_TANGENT_DIST };
+    for( int run = 0; run < 2; run++ )
+    {
+        int64 t = getTickCount();
+        const vector<CalibDetection>& found = frontEnd.detect(frames);
+        int valid = 0;
+        for( size_t i = 0; i < found.size(); i++ )
+            valid += found[i].found;
+        Mat K, D;
+        double rms = frontEnd.calibrate(1.f, flags[run], K, D);
+        cout << found.size() << " frames, " << frontEnd.detectedCount() << " detected, " << valid << " with the pattern, "
+             << (getTickCount() - t) * 1000.0 / getTickFrequency() << " ms";
+        if( rms >= 0 )
+            cout << ", rms " << rms << endl << K << endl;
+        else
+            cout << ", not enough views to calibrate" << endl;
+    }
+    frontEnd.save(cacheFile);
+    return 0;
+}
+
 #if QA_MULTI_DEMO
 int main( int argc, char** argv )
 {
     detectAndDrawChessboardCorners();
     detectAndDrawCentersOfCircles();
+    acalibrationFrontEnd( argc, argv );
 }
 #endif
 
+QA_DEMO( detectAndDrawChessboardCorners )
+QA_DEMO( detectAndDrawCentersOfCircles )
+QA_DEMO( acalibrationFrontEnd )
+
@@ -0,0 +1,257 @@
+// Per frame temporaries from an arena instead of the heap.
+//
+//     FrameArena arena;                          // one per thread that loops over frames
+//     for( ;; )
+//     {
+//         FrameScope scope( arena );             // Mats created in here come from the arena
+//         Mat frame, gray, small;
+//         cap >> frame;
+//         cvtColor( frame, gray, COLOR_BGR2GRAY );
+//         ...
+//     }                                          // the arena is rewound for the next frame
+//     FrameArenaAllocator::instance().report( std::cout );
+//
+// A FrameScope installs FrameArenaAllocator as the default Mat allocator (once, for the
+// process) and binds the arena to its thread until it ends. While a thread has a scope,
+// the buffers of the Mats it creates are cut from a large block of the arena by moving
+// a pointer, with the bookkeeping (UMatData) in the block too: no malloc and no free.
+// Threads without a scope, parallel_for_ workers included, and Mats on user data get the
+// standard allocator, so nothing changes for them.
+//
+// When the scope ends the block is reused from its start if all its Mats were released.
+// A Mat that outlives the frame (a buffer declared outside the loop, a cached result)
+// keeps its block alive instead: the block is handed over to its remaining Mats and freed
+// with the last of them, on whatever thread that happens, and the arena takes a new one.
+// Blocks grow to the largest frame seen, so after the first frames a loop runs on a
+// single block whose size no longer changes, which is what keeps a long running process
+// from fragmenting its heap.
+
+#ifndef FRAME_ARENA_HPP
+#define FRAME_ARENA_HPP
+
+#include <opencv2/core.hpp>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <ostream>
+#include <vector>
+
+namespace framearena
+{
+
+enum { ALIGN = 64 };
+
+inline size_t alignUp( size_t n ) { return ( n + ALIGN - 1 ) & ~(size_t)( ALIGN - 1 ); }
+
+// a block of memory; refs: one for the arena while it owns the block, one per live Mat
+struct Block
+{
+    uchar* base;
+    size_t size, used;
+    std::atomic<int> refs;
+};
+
+struct Counters
+{
+    std::atomic<size_t> arenaAllocs, arenaBytes, fallbackAllocs, escaped, blockAllocs, blockBytes;
+};
+
+inline Counters& counters()
+{
+    static Counters c;
+    return c;
+}
+
+inline Block* newBlock( size_t size )
+{
+    Block* b = new Block;
+    // room to align the first allocation whatever fastMalloc returns
+    b->base = (uchar*)cv::fastMalloc( size + ALIGN );
+    b->size = size;
+    b->used = 0;
+    b->refs = 1;
+    counters().blockAllocs++;
+    counters().blockBytes += size;
+    return b;
+}
+
+inline void release( Block* b )
+{
+    if( b->refs.fetch_sub( 1 ) == 1 )
+    {
+        cv::fastFree( b->base );
+        delete b;
+    }
+}
+
+}
+
+class FrameArena
+{
+public:
+    // blockSize: the first block; later ones are sized to the largest frame
+    explicit FrameArena( size_t _blockSize = 16 << 20 ) : blockSize( _blockSize ), frameBytes( 0 ), peakBytes( 0 ) {}
+
+    ~FrameArena()
+    {
+        for( size_t i = 0; i < blocks.size(); i++ )
+            framearena::release( blocks[i] );
+    }
+
+    // bytes taken from the arena in the current frame, and at most in one frame
+    size_t currentBytes() const { return frameBytes; }
+    size_t peak() const { return peakBytes; }
+
+    // the bound arena of this thread, 0 outside a FrameScope
+    static FrameArena*& current()
+    {
+        static thread_local FrameArena* arena = 0;
+        return arena;
+    }
+
+    // size bytes aligned to 64, from the block returned in block
+    uchar* take( size_t size, framearena::Block*& block )
+    {
+        size = framearena::alignUp( size );
+        if( blocks.empty() || blocks.back()->used + size > blocks.back()->size )
+            blocks.push_back( framearena::newBlock( std::max( size, blockSize ) ) );
+        block = blocks.back();
+        uchar* start = (uchar*)framearena::alignUp( (size_t)block->base );
+        uchar* p = start + block->used;
+        block->used += size;
+        block->refs++;
+        frameBytes += size;
+        return p;
+    }
+
+    // the end of a frame: keep or hand over the blocks, one block of the peak size next
+    void reset()
+    {
+        peakBytes = std::max( peakBytes, frameBytes );
+        frameBytes = 0;
+        std::vector<framearena::Block*> kept;
+        for( size_t i = 0; i < blocks.size(); i++ )
+        {
+            framearena::Block* b = blocks[i];
+            if( b->refs == 1 && kept.empty() && b->size >= peakBytes )
+            {
+                b->used = 0;
+                kept.push_back( b );
+            }
+            else
+            {
+                if( b->refs > 1 )
+                    framearena::counters().escaped += b->refs - 1;
+                // freed now, or by the last of its Mats
+                framearena::release( b );
+            }
+        }
+        blocks.swap( kept );
+        blockSize = std::max( blockSize, framearena::alignUp( peakBytes ) );
+    }
+
+private:
+    size_t blockSize, frameBytes, peakBytes;
+    std::vector<framearena::Block*> blocks;
+};
+
+// the default Mat allocator: from the bound arena of the thread, else the standard one
+class FrameArenaAllocator : public cv::MatAllocator
+{
+public:
+    static FrameArenaAllocator& instance()
+    {
+        static FrameArenaAllocator allocator;
+        return allocator;
+    }
+
+    static void install()
+    {
+        static std::once_flag once;
+        std::call_once( once, [] { cv::Mat::setDefaultAllocator( &instance() ); } );
+    }
+
+    cv::UMatData* allocate( int dims, const int* sizes, int type, void* data0, size_t* step,
+                            int flags, cv::UMatUsageFlags usageFlags ) const
+    {
+        FrameArena* arena = FrameArena::current();
+        if( data0 || !arena )
+        {
+            if( !data0 )
+                framearena::counters().fallbackAllocs++;
+            return standard()->allocate( dims, sizes, type, data0, step, flags, usageFlags );
+        }
+        size_t total = CV_ELEM_SIZE( type );
+        for( int i = dims - 1; i >= 0; i-- )
+        {
+            if( step )
+                step[i] = total;
+            total *= sizes[i];
+        }
+        // the UMatData first, the data on the next 64 byte boundary
+        framearena::Block* block;
+        uchar* p = arena->take( framearena::alignUp( sizeof(cv::UMatData) ) + total, block );
+        cv::UMatData* u = new( p ) cv::UMatData( this );
+        u->data = u->origdata = p + framearena::alignUp( sizeof(cv::UMatData) );
+        u->size = total;
+        u->handle = block;
+        framearena::counters().arenaAllocs++;
+        framearena::counters().arenaBytes += total;
+        return u;
+    }
+
+    bool allocate( cv::UMatData* u, int, cv::UMatUsageFlags ) const { return u != 0; }
+
+    void deallocate( cv::UMatData* u ) const
+    {
+        if( !u )
+            return;
+        CV_Assert( u->urefcount == 0 && u->refcount == 0 );
+        framearena::Block* block = (framearena::Block*)u->handle;
+        u->~UMatData();
+        framearena::release( block );
+    }
+
+    void report( std::ostream& out ) const
+    {
+        framearena::Counters& c = framearena::counters();
+        size_t saved = c.arenaAllocs > c.blockAllocs ? c.arenaAllocs - c.blockAllocs : 0;
+        out << "frame arena: " << c.arenaAllocs << " allocations (" << ( c.arenaBytes >> 20 ) << " MB) from "
+            << c.blockAllocs << " blocks (" << ( c.blockBytes >> 20 ) << " MB), " << saved << " mallocs saved; "
+            << c.escaped << " outlived their frame, " << c.fallbackAllocs << " from the standard allocator" << std::endl;
+    }
+
+private:
+    FrameArenaAllocator() {}
+
+    static cv::MatAllocator* standard() { return cv::Mat::getStdAllocator(); }
+};
+
+// binds an arena to the thread for its lifetime and rewinds it at the end; scopes nest,
+// an inner scope of the arena already bound leaves the rewinding to the outer one
+class FrameScope
+{
+public:
+    explicit FrameScope( FrameArena& _arena ) : arena( _arena ), previous( FrameArena::current() )
+    {
+        FrameArenaAllocator::install();
+        FrameArena::current() = &arena;
+    }
+
+    ~FrameScope()
+    {
+        FrameArena::current() = previous;
+        if( previous != &arena )
+            arena.reset();
+    }
+
+private:
+    FrameScope( const FrameScope& );
+    FrameScope& operator=( const FrameScope& );
+
+    FrameArena& arena;
+    FrameArena* previous;
+};
+
+#endif
@@ -0,0 +1,262 @@
+// Video processing stages run on their own threads, one frame per stage at a time.
+//
+//     FramePipeline pipe;
+//     pipe.source( "capture", [&]( Mat& frame ) { return cap.read( frame ); } );
+//     pipe.stage( "gray", []( const Mat& in, Mat& out ) { cvtColor( in, out, COLOR_BGR2GRAY ); } );
+//     pipe.stage( "canny", []( const Mat& in, Mat& out ) { Canny( in, out, 0, 30, 3 ); } );
+//     pipe.start();
+//     Mat edges;
+//     while( pipe.next( edges ) )                 // in capture order, on this (GUI) thread
+//     {
+//         imshow( "edges", edges );
+//         if( waitKey( 1 ) >= 0 ) break;
+//     }
+//     pipe.stop();
+//     pipe.report( cout );                         // frames/s of each stage, queue occupancy
+//
+// Stages are connected by bounded queues, so while stage k works on frame n, stage k - 1
+// can work on frame n + 1: the rate of the whole is the one of the slowest stage instead
+// of the sum of all of them. Each stage writes into Mats of its own pool (its queue
+// capacity plus two), handed back by the next stage once read, so after the first
+// frames nothing is allocated: out keeps the size and type of the previous frame it
+// held. A stage must write its result into out, not make out share the data of in.
+// As each stage is one thread reading its queue in order, the frames keep their order.
+// The frame next() returns stays valid until the following next() call.
+
+#ifndef FRAME_PIPELINE_HPP
+#define FRAME_PIPELINE_HPP
+
+#include <opencv2/core.hpp>
+#include <opencv2/core/utility.hpp>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace framepipe
+{
+
+// a bounded FIFO that can be closed: pop() returns false once it is closed and empty,
+// push() returns false once it is closed
+template<typename T> class BoundedQueue
+{
+public:
+    explicit BoundedQueue( size_t _capacity ) : capacity( _capacity ), closed( false ), pops( 0 ), occupancy( 0 ) {}
+
+    bool push( const T& v )
+    {
+        std::unique_lock<std::mutex> lock( mutex );
+        changed.wait( lock, [this] { return items.size() < capacity || closed; } );
+        if( closed )
+            return false;
+        items.push_back( v );
+        changed.notify_all();
+        return true;
+    }
+
+    bool pop( T& v )
+    {
+        std::unique_lock<std::mutex> lock( mutex );
+        changed.wait( lock, [this] { return !items.empty() || closed; } );
+        if( items.empty() )
+            return false;
+        occupancy += items.size();
+        pops++;
+        v = items.front();
+        items.pop_front();
+        changed.notify_all();
+        return true;
+    }
+
+    void close()
+    {
+        std::lock_guard<std::mutex> lock( mutex );
+        closed = true;
+        changed.notify_all();
+    }
+
+    // the mean number of items waiting when one was taken
+    double meanOccupancy() const
+    {
+        std::lock_guard<std::mutex> lock( mutex );
+        return pops ? (double)occupancy / pops : 0.;
+    }
+
+    size_t limit() const { return capacity; }
+
+private:
+    size_t capacity;
+    bool closed;
+    size_t pops, occupancy;
+    std::deque<T> items;
+    mutable std::mutex mutex;
+    std::condition_variable changed;
+};
+
+struct Frame
+{
+    size_t seq;
+    cv::Mat image;
+};
+
+struct Stage
+{
+    std::string name;
+    std::function<bool( cv::Mat& )> produce;               // the source only
+    std::function<void( const cv::Mat&, cv::Mat& )> compute;
+    std::unique_ptr<BoundedQueue<Frame> > out;              // to the next stage or next()
+    std::unique_ptr<BoundedQueue<cv::Mat> > pool;           // free output Mats
+    // written by the stage thread only, read by report()
+    std::atomic<size_t> frames;
+    std::atomic<double> busy;                               // seconds in produce/compute
+    std::thread thread;
+};
+
+}
+
+class FramePipeline
+{
+public:
+    // capacity: frames each queue holds
+    explicit FramePipeline( int _capacity = 2 ) : capacity( _capacity ), started( false ), held( false ), wall( 0 )
+    {
+        CV_Assert( capacity > 0 );
+    }
+
+    ~FramePipeline() { stop(); }
+
+    // the first stage: fills frame, false at the end of the stream
+    void source( const std::string& name, const std::function<bool( cv::Mat& )>& produce )
+    {
+        CV_Assert( !started && stages.empty() );
+        add( name ).produce = produce;
+    }
+
+    void stage( const std::string& name, const std::function<void( const cv::Mat&, cv::Mat& )>& compute )
+    {
+        CV_Assert( !started && !stages.empty() );
+        add( name ).compute = compute;
+    }
+
+    void start()
+    {
+        CV_Assert( !started && !stages.empty() );
+        started = true;
+        t0 = (double)cv::getTickCount();
+        for( size_t i = 0; i < stages.size(); i++ )
+            stages[i]->thread = std::thread( &FramePipeline::run, this, i );
+    }
+
+    // the next output frame, false once the source has ended and all frames came out
+    bool next( cv::Mat& frame )
+    {
+        CV_Assert( started );
+        framepipe::Stage& last = *stages.back();
+        if( held )
+            last.pool->push( current.image );
+        held = last.out->pop( current );
+        if( held )
+            frame = current.image;
+        return held;
+    }
+
+    // ends every stage, frames in flight are dropped
+    void stop()
+    {
+        if( !started )
+            return;
+        for( size_t i = 0; i < stages.size(); i++ )
+        {
+            stages[i]->out->close();
+            stages[i]->pool->close();
+        }
+        for( size_t i = 0; i < stages.size(); i++ )
+            if( stages[i]->thread.joinable() )
+                stages[i]->thread.join();
+        wall = ( (double)cv::getTickCount() - t0 ) / cv::getTickFrequency();
+        started = false;
+    }
+
+    // per stage: frames, frames per second of work, the share of the time busy and the
+    // mean occupancy of its output queue; a full queue means the next stage is the
+    // bottleneck, an empty one that this stage or one before it is
+    void report( std::ostream& out ) const
+    {
+        double t = started ? ( (double)cv::getTickCount() - t0 ) / cv::getTickFrequency() : wall;
+        out << std::left << std::setw( 16 ) << "stage" << std::right << std::setw( 8 ) << "frames"
+            << std::setw( 10 ) << "fps" << std::setw( 8 ) << "busy" << std::setw( 12 ) << "queue" << std::endl;
+        for( size_t i = 0; i < stages.size(); i++ )
+        {
+            const framepipe::Stage& s = *stages[i];
+            size_t frames = s.frames.load();
+            double busy = s.busy.load();
+            std::ostringstream q;
+            q << std::fixed << std::setprecision( 1 ) << s.out->meanOccupancy() << "/" << s.out->limit();
+            out << std::left << std::setw( 16 ) << s.name << std::right << std::setw( 8 ) << frames
+                << std::fixed << std::setprecision( 1 ) << std::setw( 10 ) << ( busy > 0 ? frames / busy : 0. )
+                << std::setw( 7 ) << ( t > 0 ? 100 * busy / t : 0. ) << "%" << std::setw( 12 ) << q.str() << std::endl;
+        }
+    }
+
+private:
+    framepipe::Stage& add( const std::string& name )
+    {
+        std::unique_ptr<framepipe::Stage> s( new framepipe::Stage );
+        s->name = name;
+        s->frames = 0;
+        s->busy = 0;
+        s->out.reset( new framepipe::BoundedQueue<framepipe::Frame>( capacity ) );
+        // enough buffers for a full queue, the one being read and the one being written
+        s->pool.reset( new framepipe::BoundedQueue<cv::Mat>( capacity + 2 ) );
+        for( int i = 0; i < capacity + 2; i++ )
+            s->pool->push( cv::Mat() );
+        stages.push_back( std::move( s ) );
+        return *stages.back();
+    }
+
+    void run( size_t i )
+    {
+        framepipe::Stage& s = *stages[i];
+        framepipe::Stage* in = i > 0 ? stages[i - 1].get() : 0;
+        for( size_t seq = 0; ; seq++ )
+        {
+            framepipe::Frame f;
+            if( in && !in->out->pop( f ) )
+                break;
+            framepipe::Frame r;
+            r.seq = in ? f.seq : seq;
+            if( !s.pool->pop( r.image ) )
+                break;
+            double t = (double)cv::getTickCount();
+            bool ok = true;
+            if( in )
+                s.compute( f.image, r.image );
+            else
+                ok = s.produce( r.image );
+            s.busy.store( s.busy.load() + ( (double)cv::getTickCount() - t ) / cv::getTickFrequency() );
+            if( in )
+                in->pool->push( f.image );
+            if( !ok || !s.out->push( r ) )
+                break;
+            s.frames++;
+        }
+        // no more frames downstream
+        s.out->close();
+    }
+
+    int capacity;
+    bool started, held;
+    double t0, wall;
+    framepipe::Frame current;
+    std::vector<std::unique_ptr<framepipe::Stage> > stages;
+};
+
+#endif
@@ -43,6 +43,15 @@
 #include "precomp.hpp"
 #include "highgui.hpp"
 #include "imgproc.hpp"
+#include "prefetch_loader.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
 
 #define WIN32
 #if defined WIN32 || defined _WIN32 || defined WINCE
@@ -225,7 +234,115 @@ static bool wildcmp(const char *string, const char *wild)
     return *wild == 0;
 }
 
-static void glob_rec(const cv::String& directory, const cv::String& wildchart, std::vector<cv::String>& result, bool recursive)
+// A glob pattern compiled once per glob call and tested against every entry. The
+// common shapes skip wildcmp() altogether: "" or "*" match everything, "name" is a
+// string compare, "*.jpg" and "img_*" compare the tail or the head. Several
+// alternatives come from brace groups, as in a shell: "*.{jpg,png}" is tried as "*.jpg"
+// and "*.png", "{a,b}_{1,2}*" as four patterns. A comma outside braces, or in braces
+// without a comma ("{draft}.png"), is part of the name; groups do not nest. An
+// alternative that expands to nothing, as in "{,*.png}", is skipped rather than taken for
+// "match everything".
+class WildcardMatcher
+{
+public:
+    explicit WildcardMatcher(const cv::String& pattern = cv::String()) : matchAll(pattern.empty())
+    {
+        expand(pattern);
+    }
+
+    bool operator()(const char* name) const
+    {
+        if (matchAll)
+            return true;
+        size_t len = strlen(name);
+        for (size_t i = 0; i < parts.size(); i++)
+        {
+            const Part& p = parts[i];
+            switch (p.kind)
+            {
+            case LITERAL:
+                if (len == p.text.size() && memcmp(name, p.text.c_str(), len) == 0)
+                    return true;
+                break;
+            case PREFIX:
+                if (len >= p.text.size() && memcmp(name, p.text.c_str(), p.text.size()) == 0)
+                    return true;
+                break;
+            case SUFFIX:
+                if (len >= p.text.size() && memcmp(name + len - p.text.size(), p.text.c_str(), p.text.size()) == 0)
+                    return true;
+                break;
+            default:
+                if (wildcmp(name, p.text.c_str()))
+                    return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    enum Kind { LITERAL, PREFIX, SUFFIX, GENERIC };
+
+    struct Part
+    {
+        Kind kind;
+        cv::String text;     // the literal part, or the whole pattern for GENERIC
+    };
+
+    // adds every expansion of the first brace group holding a comma
+    void expand(const cv::String& pattern)
+    {
+        size_t open = pattern.find('{'), close = cv::String::npos;
+        for (; open != cv::String::npos; open = pattern.find('{', open + 1))
+        {
+            close = pattern.find('}', open);
+            if (close == cv::String::npos)
+                break;
+            size_t comma = pattern.find(',', open);
+            if (comma < close)
+                break;
+        }
+        if (open == cv::String::npos || close == cv::String::npos)
+        {
+            if (!pattern.empty())
+                add(pattern);
+            return;
+        }
+        cv::String head = pattern.substr(0, open), tail = pattern.substr(close + 1);
+        for (size_t start = open + 1; start <= close; )
+        {
+            size_t end = std::min(pattern.find(',', start), close);
+            expand(head + pattern.substr(start, end - start) + tail);
+            start = end + 1;
+        }
+    }
+
+    void add(const cv::String& pattern)
+    {
+        if (pattern.empty() || pattern.find_first_not_of('*') == cv::String::npos)
+        {
+            matchAll = true;
+            return;
+        }
+        size_t stars = std::count(pattern.begin(), pattern.end(), '*');
+        bool plain = pattern.find('?') == cv::String::npos;
+        Part p;
+        p.kind = GENERIC;
+        p.text = pattern;
+        if (plain && stars == 0)
+            p.kind = LITERAL;
+        else if (plain && stars == 1 && pattern[pattern.size() - 1] == '*')
+            p.kind = PREFIX, p.text = pattern.substr(0, pattern.size() - 1);
+        else if (plain && stars == 1 && pattern[0] == '*')
+            p.kind = SUFFIX, p.text = pattern.substr(1);
+        parts.push_back(p);
+    }
+
+    bool matchAll;
+    std::vector<Part> parts;
+};
+
+static void glob_rec(const cv::String& directory, const WildcardMatcher& wildchart, std::vector<cv::String>& result, bool recursive)
 {
     DIR *dir;
     struct dirent *ent;
@@ -250,7 +367,7 @@ static void glob_rec(const cv::String& directory, const cv::String& wildchart, s
                 }
                 else
                 {
-                    if (wildchart.empty() || wildcmp(name, wildchart.c_str()))
+                    if (wildchart(name))
                         result.push_back(path);
                 }
             }
@@ -265,7 +382,7 @@ static void glob_rec(const cv::String& directory, const cv::String& wildchart, s
     else CV_Error(CV_StsObjectNotFound, cv::format("could not open directory: %s", directory.c_str()));
 }
 
-static void glob_rec(const cv::String& directory, const cv::String& wildchart, cv::GlobCallback_ onFileFound, bool recursive)
+static void glob_rec(const cv::String& directory, const WildcardMatcher& wildchart, cv::GlobCallback_ onFileFound, bool recursive)
 {
     DIR *dir;
     struct dirent *ent;
@@ -290,7 +407,7 @@ static void glob_rec(const cv::String& directory, const cv::String& wildchart, c
                 }
                 else
                 {
-                    if (wildchart.empty() || wildcmp(name, wildchart.c_str()))
+                    if (wildchart(name))
                         if(!onFileFound(path))
                             CV_Error(CV_StsOk, "glob canceled");
                 }
@@ -306,11 +423,9 @@ static void glob_rec(const cv::String& directory, const cv::String& wildchart, c
     else CV_Error(CV_StsObjectNotFound, cv::format("could not open directory: %s", directory.c_str()));
 }
 
-void cv::glob(String pattern, std::vector<String>& result, bool recursive)
+// "dir", "dir/" or "dir/wildchart" -> directory to walk and file name pattern
+static void splitPattern(const cv::String& pattern, cv::String& path, cv::String& wildchart)
 {
-    result.clear();
-    String path, wildchart;
-
     if (isDir(pattern, 0))
     {
         if(strchr(dir_separators, pattern[pattern.size() - 1]) != 0)
@@ -325,7 +440,7 @@ void cv::glob(String pattern, std::vector<String>& result, bool recursive)
     else
     {
         size_t pos = pattern.find_last_of(dir_separators);
-        if (pos == String::npos)
+        if (pos == cv::String::npos)
         {
             wildchart = pattern;
             path = ".";
@@ -336,8 +451,16 @@ void cv::glob(String pattern, std::vector<String>& result, bool recursive)
             wildchart = pattern.substr(pos + 1);
         }
     }
+}
 
-    glob_rec(path, wildchart, result, recursive);
+void cv::glob(String pattern, std::vector<String>& result, bool recursive)
+{
+    result.clear();
+    String path, wildchart;
+
+    splitPattern(pattern, path, wildchart);
+
+    glob_rec(path, WildcardMatcher(wildchart), result, recursive);
     std::sort(result.begin(), result.end());
 }
 
@@ -348,60 +471,270 @@ void glob(String pattern, GlobCallback_ onFileFound, bool recursive)
 {
     String path, wildchart;
 
-    if (isDir(pattern, 0))
+    splitPattern(pattern, path, wildchart);
+
+    try
     {
-        if(strchr(dir_separators, pattern[pattern.size() - 1]) != 0)
-        {
-            path = pattern.substr(0, pattern.size() - 1);
-        }
-        else
+    glob_rec(path, WildcardMatcher(wildchart), onFileFound, recursive);
+    }
+    catch (...)
+    {
+
+    }
+}
+}
+
+// ----------------------------------------------------------------------------------
+// Parallel walk: every directory is a task. Each worker keeps its own deque of
+// directories, takes the newest one from its own back and, when it runs dry, steals
+// the oldest one from the front of another worker, so large subtrees spread out over
+// all threads. Matches go to the callback while the walk goes on (GLOB_UNORDERED), or
+// are collected and handed out sorted at the end (GLOB_SORTED). Callback calls are
+// serialized, the callback does not need to lock anything.
+//
+// The walk stops early when the callback returns false or *options.cancel becomes
+// true; globParallel() then returns false. Unreadable directories raise the same
+// error as glob(), from the calling thread.
+
+namespace cv
+{
+
+enum GlobOrder { GLOB_UNORDERED = 0, GLOB_SORTED = 1 };
+
+typedef std::function<bool(const String&)> GlobVisitor;
+
+struct GlobParallelOptions
+{
+    GlobParallelOptions() : threads(0), order(GLOB_UNORDERED), cancel(0) {}
+
+    int threads;                        // <= 0: one per hardware thread
+    GlobOrder order;
+    const std::atomic<bool>* cancel;    // optional, polled between entries
+};
+
+}
+
+namespace
+{
+
+class ParallelGlob
+{
+public:
+    ParallelGlob(const cv::String& _wildchart, const cv::GlobVisitor& _visitor, bool _recursive,
+                 const cv::GlobParallelOptions& _options)
+        : wildchart(_wildchart), visitor(_visitor), recursive(_recursive), options(_options),
+          pending(0), canceled(false), failed(false)
+    {
+        int n = options.threads > 0 ? options.threads : (int)std::max(1u, std::thread::hardware_concurrency());
+        std::vector<WorkQueue> q(n);
+        queues.swap(q);
+    }
+
+    bool run(const cv::String& root)
+    {
+        push(0, root);
+        std::vector<std::thread> threads;
+        for (size_t i = 1; i < queues.size(); i++)
+            threads.push_back(std::thread(&ParallelGlob::worker, this, (int)i));
+        worker(0);
+        for (size_t i = 0; i < threads.size(); i++)
+            threads[i].join();
+
+        if (failed)
+            CV_Error(CV_StsObjectNotFound, error);
+        if (options.order == cv::GLOB_SORTED && !stopped())
         {
-            path = pattern;
+            std::sort(sorted.begin(), sorted.end());
+            for (size_t i = 0; i < sorted.size() && !stopped(); i++)
+                if (!visitor(sorted[i]))
+                    canceled = true;
         }
+        return !stopped();
     }
-    else
+
+private:
+    struct WorkQueue
     {
-        size_t pos = pattern.find_last_of(dir_separators);
-        if (pos == String::npos)
+        std::mutex mutex;
+        std::deque<cv::String> dirs;
+    };
+
+    bool stopped() const { return canceled || failed || (options.cancel && options.cancel->load()); }
+
+    void push(int id, const cv::String& dir)
+    {
+        pending++;
         {
-            wildchart = pattern;
-            path = ".";
+            std::lock_guard<std::mutex> lock(queues[id].mutex);
+            queues[id].dirs.push_back(dir);
         }
-        else
+        idle.notify_one();
+    }
+
+    bool pop(int id, cv::String& dir)
+    {
+        for (size_t k = 0; k < queues.size(); k++)
         {
-            path = pattern.substr(0, pos);
-            wildchart = pattern.substr(pos + 1);
+            WorkQueue& q = queues[(id + k) % queues.size()];
+            std::lock_guard<std::mutex> lock(q.mutex);
+            if (q.dirs.empty())
+                continue;
+            if (k == 0)
+            {
+                dir = q.dirs.back();
+                q.dirs.pop_back();
+            }
+            else
+            {
+                dir = q.dirs.front();
+                q.dirs.pop_front();
+            }
+            return true;
         }
+        return false;
     }
 
-    try
+    void worker(int id)
     {
-    glob_rec(path, wildchart, onFileFound, recursive);
+        cv::String dir;
+        while (!stopped())
+        {
+            if (pop(id, dir))
+            {
+                walk(id, dir);
+                if (--pending == 0)
+                    idle.notify_all();
+                continue;
+            }
+            if (pending == 0)
+                break;
+            // another worker is still listing, it may push more directories
+            std::unique_lock<std::mutex> lock(idleMutex);
+            idle.wait_for(lock, std::chrono::milliseconds(1));
+        }
+        idle.notify_all();
     }
-    catch (...)
+
+    void walk(int id, const cv::String& directory)
     {
+        DIR* dir = opendir(directory.c_str());
+        if (!dir)
+        {
+            std::lock_guard<std::mutex> lock(visitorMutex);
+            if (!failed)
+                error = cv::format("could not open directory: %s", directory.c_str());
+            failed = true;
+            return;
+        }
+        struct dirent* ent;
+        while (!stopped() && (ent = readdir(dir)) != 0)
+        {
+            const char* name = ent->d_name;
+            if((name[0] == 0) || (name[0] == '.' && name[1] == 0) || (name[0] == '.' && name[1] == '.' && name[2] == 0))
+                continue;
 
+            cv::String path = directory + native_separator + name;
+            if (isDir(path, dir))
+            {
+                if (recursive)
+                    push(id, path);
+            }
+            else if (wildchart(name))
+            {
+                std::lock_guard<std::mutex> lock(visitorMutex);
+                if (options.order == cv::GLOB_SORTED)
+                    sorted.push_back(path);
+                else if (!stopped() && !visitor(path))
+                    canceled = true;
+            }
+        }
+        closedir(dir);
     }
+
+    WildcardMatcher wildchart;
+    const cv::GlobVisitor& visitor;
+    bool recursive;
+    cv::GlobParallelOptions options;
+
+    std::vector<WorkQueue> queues;
+    std::atomic<int> pending;           // directories queued or being listed
+    std::mutex idleMutex;
+    std::condition_variable idle;
+
+    std::mutex visitorMutex;            // visitor calls, sorted, error
+    std::vector<cv::String> sorted;
+    cv::String error;
+    std::atomic<bool> canceled, failed;
+};
+
 }
+
+namespace cv
+{
+
+bool globParallel(String pattern, const GlobVisitor& onFileFound, bool recursive,
+                  const GlobParallelOptions& options = GlobParallelOptions())
+{
+    String path, wildchart;
+    splitPattern(pattern, path, wildchart);
+    ParallelGlob walker(wildchart, onFileFound, recursive, options);
+    return walker.run(path);
+}
+
 }
 
-bool globTest( cv::String filename)
+// shows every match in gray; the walk and the decoding run ahead on other threads
+// while the current image is on screen
+static void globTest(const cv::String& pattern, bool recursive)
 {
+    PrefetchImageLoader loader(cv::IMREAD_GRAYSCALE);
+    std::atomic<bool> stop(false);
+    std::thread walker([&]()
+    {
+        // unordered: the first images are on screen while the walk goes on; sorted
+        // would have to list the whole tree before the first one
+        cv::GlobParallelOptions options;
+        options.order = cv::GLOB_UNORDERED;
+        options.cancel = &stop;
+        try
+        {
+            cv::globParallel(pattern, [&loader](const cv::String& path) { return loader.push(path); }, recursive, options);
+        }
+        catch (...)
+        {
+        }
+        loader.finish();
+    });
+
+    cv::String path;
     cv::Mat image;
-    image = cv::imread(filename,0);
-    if(!image.empty())
+    while (loader.next(path, image))
     {
-        cv::imshow("image_gray",image);
-        return !(cv::waitKey()== 27);
+        if (image.empty())
+            continue;
+        cv::imshow("image_gray", image);
+        if (cv::waitKey() == 27)
+            break;
     }
-    return true;
-
+    stop = true;
+    loader.cancel();
+    walker.join();
 }
 
-
-
 int main( int argc, const char** argv )
 {
-    glob("C:\\OpenCV", globTest, true);
+    if (argc > 1)
+    {
+        // glob_new <pattern> [threads]: count the matches with the parallel walker
+        cv::GlobParallelOptions options;
+        options.threads = argc > 2 ? atoi(argv[2]) : 0;
+        size_t count = 0;
+        double t = (double)cv::getTickCount();
+        cv::globParallel(argv[1], [&count](const cv::String&) { count++; return true; }, true, options);
+        t = ((double)cv::getTickCount() - t) / cv::getTickFrequency();
+        printf("%d files in %.3f s\n", (int)count, t);
+        return 0;
+    }
+    globTest("C:\\OpenCV", true);
 }
 
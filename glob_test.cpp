@@ -1,4 +1,5 @@
 #include <opencv2/highgui.hpp>
+#include "prefetch_loader.hpp"
 
 using namespace cv;
 using namespace std;
@@ -10,10 +11,14 @@ int main()
 
     glob(folder, filenames);
 
-    for(size_t i = 0; i < filenames.size(); ++i)
-    {
-        Mat src = imread(filenames[i]);
+    // decoded a few images ahead while the current one is shown
+    PrefetchImageLoader loader;
+    loader.start(filenames);
 
+    String filename;
+    Mat src;
+    while(loader.next(filename, src))
+    {
         if(src.data)
         {
             imshow( "glob test", src );
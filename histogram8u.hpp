@@ -0,0 +1,174 @@
+// 256 bin histograms of 8 bit images, shared by the samples.
+//
+//     Histogram8u h( gray );                  // or h.compute( img, mask ) for one channel of many
+//     int low = h.percentile( 1 ), high = h.percentile( 99 );
+//     LUT( gray, Histogram8u::stretchLut( low, high, 0, 255 ), stretched );
+//     LUT( gray, h.equalizationLut(), equalized );   // same result as equalizeHist()
+//
+// calcHistograms8u() fills one histogram per channel of an interleaved image in one
+// pass. The rows are split into stripes for parallel_for_; each stripe counts into
+// its own tables, four of them per channel used in turn, so runs of the same value
+// do not make every increment wait for the previous one to be stored. The tables
+// are summed at the end.
+
+#ifndef HISTOGRAM8U_HPP
+#define HISTOGRAM8U_HPP
+
+#include <opencv2/core.hpp>
+#include <opencv2/core/utility.hpp>
+#include <algorithm>
+#include <vector>
+
+namespace hist8u
+{
+
+enum { LANES = 4 };
+
+class CalcBody : public cv::ParallelLoopBody
+{
+public:
+    CalcBody( const cv::Mat& _img, const cv::Mat& _mask, std::vector<int>& _total, cv::Mutex& _lock )
+        : img( _img ), mask( _mask ), total( _total ), lock( _lock ) {}
+
+    void operator()( const cv::Range& range ) const
+    {
+        const int cn = img.channels();
+        std::vector<int> buf( LANES * cn * 256, 0 );
+        int* h = &buf[0];
+        for( int y = range.start; y < range.end; y++ )
+        {
+            const uchar* p = img.ptr( y );
+            const uchar* m = mask.empty() ? 0 : mask.ptr( y );
+            int x = 0;
+            if( cn == 1 && !m )
+            {
+                for( ; x <= img.cols - LANES; x += LANES )
+                {
+                    h[p[x]]++;
+                    h[256 + p[x + 1]]++;
+                    h[512 + p[x + 2]]++;
+                    h[768 + p[x + 3]]++;
+                }
+            }
+            for( ; x < img.cols; x++ )
+            {
+                if( m && !m[x] )
+                    continue;
+                int* lane = h + ( x & ( LANES - 1 ) ) * cn * 256;
+                for( int c = 0; c < cn; c++ )
+                    lane[c * 256 + p[x * cn + c]]++;
+            }
+        }
+
+        cv::AutoLock l( lock );
+        for( int i = 0; i < cn * 256; i++ )
+        {
+            int sum = 0;
+            for( int k = 0; k < LANES; k++ )
+                sum += h[k * cn * 256 + i];
+            total[i] += sum;
+        }
+    }
+
+private:
+    const cv::Mat& img;
+    const cv::Mat& mask;
+    std::vector<int>& total;
+    cv::Mutex& lock;
+};
+
+}
+
+// hist: channels() * 256 counts, channel c at hist[c * 256]; mask: optional CV_8UC1
+inline void calcHistograms8u( const cv::Mat& img, const cv::Mat& mask, std::vector<int>& hist )
+{
+    CV_Assert( img.depth() == CV_8U && img.dims == 2 );
+    CV_Assert( mask.empty() || ( mask.type() == CV_8UC1 && mask.size() == img.size() ) );
+    hist.assign( img.channels() * 256, 0 );
+    cv::Mutex lock;
+    // stripes of at least 16 rows, each one has its own tables
+    cv::parallel_for_( cv::Range( 0, img.rows ), hist8u::CalcBody( img, mask, hist, lock ), std::max( 1.0, img.rows / 16.0 ) );
+}
+
+class Histogram8u
+{
+public:
+    Histogram8u() : bins( 256, 0 ), count( 0 ) {}
+    explicit Histogram8u( const cv::Mat& img, const cv::Mat& mask = cv::Mat(), int channel = 0 ) { compute( img, mask, channel ); }
+
+    // histogram of one channel of an 8 bit image
+    void compute( const cv::Mat& img, const cv::Mat& mask = cv::Mat(), int channel = 0 )
+    {
+        CV_Assert( channel >= 0 && channel < img.channels() );
+        std::vector<int> all;
+        calcHistograms8u( img, mask, all );
+        bins.assign( all.begin() + channel * 256, all.begin() + ( channel + 1 ) * 256 );
+        count = 0;
+        for( int i = 0; i < 256; i++ )
+            count += bins[i];
+    }
+
+    int operator[]( int i ) const { return bins[i]; }
+    int total() const { return count; }
+
+    // counts of all values <= i
+    std::vector<int> cumulative() const
+    {
+        std::vector<int> cum( bins );
+        for( int i = 1; i < 256; i++ )
+            cum[i] += cum[i - 1];
+        return cum;
+    }
+
+    // smallest value with at least count * p / 100 pixels at or below it
+    int percentile( double p ) const
+    {
+        std::vector<int> cum = cumulative();
+        int bound = (int)( (double)count * p / 100 );
+        return (int)( std::lower_bound( cum.begin(), cum.end(), bound ) - cum.begin() );
+    }
+
+    // linear map of [inLow, inHigh] onto [outLow, outHigh], clamped, as imadjust
+    static cv::Mat stretchLut( int inLow, int inHigh, int outLow = 0, int outHigh = 255 )
+    {
+        cv::Mat lut( 1, 256, CV_8U );
+        float scale = inHigh != inLow ? float( outHigh - outLow ) / float( inHigh - inLow ) : 0.f;
+        for( int v = 0; v < 256; v++ )
+        {
+            int vs = std::max( v - inLow, 0 );
+            int vd = std::min( int( vs * scale + 0.5f ) + outLow, outHigh );
+            lut.at<uchar>( v ) = cv::saturate_cast<uchar>( vd );
+        }
+        return lut;
+    }
+
+    // the mapping equalizeHist() uses
+    cv::Mat equalizationLut() const
+    {
+        cv::Mat lut( 1, 256, CV_8U, cv::Scalar( 0 ) );
+        int i = 0;
+        while( i < 256 && !bins[i] )
+            i++;
+        if( i == 256 )
+            return lut;
+        if( bins[i] == count )
+        {
+            lut.setTo( i );
+            return lut;
+        }
+        float scale = 255.f / ( count - bins[i] );
+        int sum = 0;
+        for( lut.at<uchar>( i++ ) = 0; i < 256; i++ )
+        {
+            sum += bins[i];
+            lut.at<uchar>( i ) = cv::saturate_cast<uchar>( sum * scale );
+        }
+        return lut;
+    }
+
+private:
+    std::vector<int> bins;
+    int count;
+};
+
+#endif
@@ -3,13 +3,284 @@
 
 #include <opencv2/highgui.hpp>
 #include <opencv2/imgproc.hpp>
+#include <opencv2/videoio.hpp>
 
+#include <algorithm>
+#include <cctype>
+#include <cmath>
 #include <iostream>
 
+#include "histogram8u.hpp"
+
 using namespace cv;
 using namespace std;
 
-int main(int /*argc*/, char** /*argv*/) {
+// Histogram equalization for video without the flicker of equalizeHist() per frame.
+// The histogram is counted on every step-th pixel of every step-th row and blended
+// into a running average, hist = (1 - alpha) * hist + alpha * frame. The LUT is built
+// again only when the CDF of the running histogram is more than a threshold away from
+// the CDF the current LUT was built from; otherwise the frame costs the grid count
+// and one LUT() pass (which splits large images over threads itself).
+
+struct EqualizerState
+{
+    vector<float> hist, cdfAtLut;      // normalized to a sum of 1
+    Mat lut;
+    int rebuilds;
+
+    EqualizerState() : hist(256, 0.f), cdfAtLut(256, 0.f), rebuilds(0) {}
+
+    // frame: the grid counts of the new frame, n of them; clip: CLAHE like clip limit
+    // as a multiple of the mean bin, 0 for none
+    void update(const int* frame, int n, float alpha, float threshold, float clip)
+    {
+        if (n == 0)
+            return;
+        float a = lut.empty() ? 1.f : alpha;
+        for (int i = 0; i < 256; i++)
+            hist[i] += a * (frame[i] / (float)n - hist[i]);
+
+        float h[256];
+        std::copy(hist.begin(), hist.end(), h);
+        if (clip > 0)
+        {
+            // the excess over the limit is spread evenly over all the bins
+            float limit = clip / 256, excess = 0;
+            for (int i = 0; i < 256; i++)
+                if (h[i] > limit)
+                {
+                    excess += h[i] - limit;
+                    h[i] = limit;
+                }
+            for (int i = 0; i < 256; i++)
+                h[i] += excess / 256;
+        }
+        float cdf[256], sum = 0, moved = 0;
+        for (int i = 0; i < 256; i++)
+        {
+            cdf[i] = sum += h[i];
+            moved = std::max(moved, std::abs(cdf[i] - cdfAtLut[i]));
+        }
+        if (!lut.empty() && moved <= threshold)
+            return;
+
+        // as equalizeHist: the first occupied bin maps to 0, the last to 255
+        lut.create(1, 256, CV_8U);
+        int first = 0;
+        while (first < 255 && h[first] <= 0)
+            first++;
+        float scale = cdf[255] - cdf[first] > 0 ? 255.f / (cdf[255] - cdf[first]) : 0.f;
+        for (int i = 0; i < 256; i++)
+            lut.at<uchar>(i) = saturate_cast<uchar>(std::max(cdf[i] - cdf[first], 0.f) * scale);
+        std::copy(cdf, cdf + 256, cdfAtLut.begin());
+        rebuilds++;
+    }
+};
+
+// counts of every step-th pixel of every step-th row of gray inside r; a rect narrower
+// or shorter than step still gets one sample per row or column, so a non empty r
+// never gives n = 0 (and a state without a LUT)
+static int countGrid(const Mat& gray, Rect r, int step, int* counts)
+{
+    std::fill(counts, counts + 256, 0);
+    int n = 0;
+    int dx = std::min(step / 2, r.width - 1), dy = std::min(step / 2, r.height - 1);
+    for (int y = r.y + dy; y < r.y + r.height; y += step)
+    {
+        const uchar* p = gray.ptr<uchar>(y);
+        for (int x = r.x + dx; x < r.x + r.width; x += step, n++)
+            counts[p[x]]++;
+    }
+    return n;
+}
+
+class StreamingEqualizer
+{
+public:
+    // step: the grid of counted pixels; alpha: weight of a new frame; threshold: largest
+    // change of the CDF, as a fraction of the pixels, that keeps the current LUT
+    StreamingEqualizer(int _step = 4, float _alpha = 0.1f, float _threshold = 0.01f)
+        : step(_step), alpha(_alpha), threshold(_threshold) {}
+
+    void apply(const Mat& gray, Mat& dst)
+    {
+        CV_Assert(gray.type() == CV_8UC1);
+        int counts[256];
+        int n = countGrid(gray, Rect(0, 0, gray.cols, gray.rows), step, counts);
+        state.update(counts, n, alpha, threshold, 0);
+        LUT(gray, state.lut, dst);
+    }
+
+    int rebuilds() const { return state.rebuilds; }
+
+private:
+    int step;
+    float alpha, threshold;
+    EqualizerState state;
+};
+
+// CLAHE like variant: one streaming state per tile, updated in parallel, and every pixel
+// mapped through the LUTs of the four nearest tile centers, bilinearly weighted.
+class TiledStreamingEqualizer
+{
+public:
+    TiledStreamingEqualizer(Size _tiles = Size(8, 8), float _clip = 4.f, int _step = 2, float _alpha = 0.1f, float _threshold = 0.01f)
+        : tiles(_tiles), clip(_clip), step(_step), alpha(_alpha), threshold(_threshold), states(_tiles.area()) {}
+
+    void apply(const Mat& gray, Mat& dst)
+    {
+        CV_Assert(gray.type() == CV_8UC1 && gray.cols >= tiles.width && gray.rows >= tiles.height);
+        if (gray.size() != size)
+        {
+            size = gray.size();
+            states.assign(tiles.area(), EqualizerState());
+            weights(size.width, tiles.width, col0, colW);
+            weights(size.height, tiles.height, row0, rowW);
+        }
+        parallel_for_(Range(0, tiles.area()), UpdateBody(*this, gray));
+        dst.create(gray.size(), CV_8U);
+        parallel_for_(Range(0, gray.rows), ApplyBody(*this, gray, dst), gray.total() / (double)(1 << 16));
+    }
+
+    int rebuilds() const
+    {
+        int n = 0;
+        for (size_t i = 0; i < states.size(); i++)
+            n += states[i].rebuilds;
+        return n;
+    }
+
+private:
+    Rect tile(int i) const
+    {
+        int tx = i % tiles.width, ty = i / tiles.width;
+        int x0 = tx * size.width / tiles.width, y0 = ty * size.height / tiles.height;
+        return Rect(x0, y0, (tx + 1) * size.width / tiles.width - x0, (ty + 1) * size.height / tiles.height - y0);
+    }
+
+    // for each coordinate the tile center before it and the weight of the one after
+    static void weights(int len, int n, vector<int>& first, vector<float>& w)
+    {
+        first.resize(len);
+        w.resize(len);
+        for (int x = 0; x < len; x++)
+        {
+            float t = (x + 0.5f) * n / len - 0.5f;
+            int t0 = cvFloor(t);
+            w[x] = n == 1 || t0 < 0 ? 0.f : t0 >= n - 1 ? 1.f : t - t0;
+            first[x] = std::min(std::max(t0, 0), std::max(n - 2, 0));
+        }
+    }
+
+    class UpdateBody : public ParallelLoopBody
+    {
+    public:
+        UpdateBody(TiledStreamingEqualizer& _eq, const Mat& _gray) : eq(_eq), gray(_gray) {}
+
+        void operator()(const Range& range) const
+        {
+            int counts[256];
+            for (int i = range.start; i < range.end; i++)
+            {
+                int n = countGrid(gray, eq.tile(i), eq.step, counts);
+                eq.states[i].update(counts, n, eq.alpha, eq.threshold, eq.clip);
+            }
+        }
+
+    private:
+        TiledStreamingEqualizer& eq;
+        const Mat& gray;
+    };
+
+    class ApplyBody : public ParallelLoopBody
+    {
+    public:
+        ApplyBody(const TiledStreamingEqualizer& _eq, const Mat& _gray, Mat& _dst) : eq(_eq), gray(_gray), dst(_dst) {}
+
+        void operator()(const Range& range) const
+        {
+            int tw = eq.tiles.width, nx = std::min(tw, 2) - 1, ny = std::min(eq.tiles.height, 2) - 1;
+            for (int y = range.start; y < range.end; y++)
+            {
+                const uchar* s = gray.ptr<uchar>(y);
+                uchar* d = dst.ptr<uchar>(y);
+                int ty = eq.row0[y];
+                float wy = eq.rowW[y];
+                const EqualizerState* top = &eq.states[ty * tw];
+                const EqualizerState* bottom = &eq.states[(ty + ny) * tw];
+                for (int x = 0; x < gray.cols; x++)
+                {
+                    int tx = eq.col0[x], v = s[x];
+                    float wx = eq.colW[x];
+                    float t = top[tx].lut.at<uchar>(v) * (1 - wx) + top[tx + nx].lut.at<uchar>(v) * wx;
+                    float b = bottom[tx].lut.at<uchar>(v) * (1 - wx) + bottom[tx + nx].lut.at<uchar>(v) * wx;
+                    d[x] = saturate_cast<uchar>(t + (b - t) * wy);
+                }
+            }
+        }
+
+    private:
+        const TiledStreamingEqualizer& eq;
+        const Mat& gray;
+        Mat& dst;
+    };
+
+    Size tiles, size;
+    float clip;
+    int step;
+    float alpha, threshold;
+    vector<EqualizerState> states;
+    vector<int> col0, row0;
+    vector<float> colW, rowW;
+};
+
+// histogram_equalization video.avi (or a camera index): equalizeHist per frame next to
+// the streaming equalizer and its tiled variant
+static int video(VideoCapture& cap)
+{
+    StreamingEqualizer global;
+    TiledStreamingEqualizer tiled;
+    Mat frame, gray, perFrame, streaming, local;
+    double ms[3] = { 0, 0, 0 };
+    int frames = 0;
+    while (cap.read(frame))
+    {
+        cvtColor(frame, gray, COLOR_BGR2GRAY);
+        int64 t0 = getTickCount();
+        equalizeHist(gray, perFrame);
+        int64 t1 = getTickCount();
+        global.apply(gray, streaming);
+        int64 t2 = getTickCount();
+        tiled.apply(gray, local);
+        int64 t3 = getTickCount();
+        ms[0] += (t1 - t0) * 1000.0 / getTickFrequency();
+        ms[1] += (t2 - t1) * 1000.0 / getTickFrequency();
+        ms[2] += (t3 - t2) * 1000.0 / getTickFrequency();
+        frames++;
+        imshow("equalizeHist", perFrame);
+        imshow("streaming", streaming);
+        imshow("streaming tiles", local);
+        if (waitKey(1) == 27)
+            break;
+    }
+    if (frames)
+        cout << frames << " frames, ms per frame: equalizeHist " << ms[0] / frames << ", streaming " << ms[1] / frames
+             << " (" << global.rebuilds() << " LUTs), tiles " << ms[2] / frames << " (" << tiled.rebuilds() << " LUTs)" << endl;
+    return 0;
+}
+
+int main(int argc, char** argv) {
+
+    if (argc >= 2) {
+        VideoCapture cap;
+        if (isdigit((uchar)argv[1][0]) && !argv[1][1])
+            cap.open(argv[1][0] - '0');
+        else
+            cap.open(argv[1]);
+        if (!cap.isOpened())
+            return -1;
+        return video(cap);
+    }
 
     // wikipedia example
     Mat img = (Mat_<uchar>(8,8) <<
@@ -31,5 +302,12 @@ int main(int /*argc*/, char** /*argv*/) {
     equalizeHist(img, imgEqualized);
     cout << imgEqualized << endl;
 
+    // same mapping from the shared histogram, plus a few percentiles
+    Histogram8u hist(img);
+    Mat imgEqualizedLut;
+    LUT(img, hist.equalizationLut(), imgEqualizedLut);
+    cout << "LUT matches equalizeHist: " << (countNonZero(imgEqualized != imgEqualizedLut) == 0 ? "yes" : "no") << endl;
+    cout << "percentiles 1/50/99: " << hist.percentile(1) << " " << hist.percentile(50) << " " << hist.percentile(99) << endl;
+
     return 0;
 }
@@ -0,0 +1,109 @@
+// Process wide cache of decoded images.
+//
+//     Mat img = cachedImread( "lena.jpg" );           // decoded once, shared afterwards
+//     Mat canvas = cachedImread( "lena.jpg" ).clone(); // when the demo draws on it
+//
+// Entries are keyed on path and imread flags and remember the file's modification
+// time and size: a file changed on disk is decoded again. Hits return a Mat header
+// sharing the cached pixels, so the result must be treated as read only. Functions
+// that reallocate their output (resize( img, img, ... ) to another size, pyrUp, ...)
+// are fine; anything that writes into the pixels needs a clone().
+//
+// The least recently used images are dropped once the decoded bytes exceed the
+// budget (256 MB unless setBudget() says otherwise). Images still referenced by a
+// caller stay alive after eviction, they are only no longer found.
+
+#ifndef IMAGE_CACHE_HPP
+#define IMAGE_CACHE_HPP
+
+#include <opencv2/core.hpp>
+#include <opencv2/imgcodecs.hpp>
+#include "lru_cache.hpp"
+#include <sys/stat.h>
+#include <mutex>
+#include <string>
+
+class ImageCache
+{
+public:
+    static ImageCache& instance()
+    {
+        static ImageCache cache;
+        return cache;
+    }
+
+    cv::Mat imread( const cv::String& path, int flags = cv::IMREAD_COLOR )
+    {
+        struct stat st;
+        if( stat( path.c_str(), &st ) != 0 )
+            return cv::Mat();
+        Key key( path, flags );
+        {
+            std::lock_guard<std::mutex> lock( mutex );
+            if( Entry* e = cache.find( key ) )
+            {
+                if( e->mtime == st.st_mtime && e->fileSize == (long long)st.st_size )
+                {
+                    hits++;
+                    return e->image;
+                }
+                cache.erase( key );
+            }
+            misses++;
+        }
+
+        // decoded without the lock, two threads may decode the same file once each
+        cv::Mat image = cv::imread( path, flags );
+        if( image.empty() )
+            return image;
+        size_t bytes = image.total() * image.elemSize();
+
+        std::lock_guard<std::mutex> lock( mutex );
+        if( bytes > cache.capacity() )
+            return image;
+        Entry& e = cache.put( key, bytes );
+        e.image = image;
+        e.mtime = st.st_mtime;
+        e.fileSize = (long long)st.st_size;
+        return image;
+    }
+
+    void setBudget( size_t bytes )
+    {
+        std::lock_guard<std::mutex> lock( mutex );
+        cache.setCapacity( bytes );
+    }
+
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock( mutex );
+        cache.clear();
+    }
+
+    size_t bytesUsed() const { std::lock_guard<std::mutex> lock( mutex ); return cache.used(); }
+    size_t hitCount() const { std::lock_guard<std::mutex> lock( mutex ); return hits; }
+    size_t missCount() const { std::lock_guard<std::mutex> lock( mutex ); return misses; }
+
+private:
+    typedef std::pair<std::string, int> Key;
+
+    struct Entry
+    {
+        cv::Mat image;
+        time_t mtime;
+        long long fileSize;
+    };
+
+    ImageCache() : cache( (size_t)256 << 20 ), hits( 0 ), misses( 0 ) {}
+
+    mutable std::mutex mutex;
+    LruCache<Key, Entry> cache;   // costs in decoded bytes
+    size_t hits, misses;
+};
+
+inline cv::Mat cachedImread( const cv::String& path, int flags = cv::IMREAD_COLOR )
+{
+    return ImageCache::instance().imread( path, flags );
+}
+
+#endif
@@ -0,0 +1,348 @@
+// PSNR and SSIM of 8 bit images, per channel or on the luma, without copies.
+//
+//     double all = metrics::psnr( ref, test );                    // every channel together
+//     double y   = metrics::psnr( ref, test, metrics::LUMA );     // Y of BGR, as cvtColor BGR2YUV
+//     Scalar per = metrics::psnrPerChannel( ref, test );
+//     Scalar s   = metrics::ssimPerChannel( ref, test );          // 11x11 Gaussian window
+//
+//     metrics::QualityMeter meter( true );                        // with SSIM
+//     while( ref.read( a ) && decoded.read( b ) )
+//         meter.add( a, b );                                      // or meter.compare( refCap, testCap )
+//     meter.report( std::cout );                                  // mean, worst frame
+//
+// The squared errors are summed in integers, so they are exact: 16 values at a time
+// with SIMD, the absolute differences widened to 16 bits and multiplied pairwise into
+// 32 bit sums (v_dotprod), which are added to 64 bit totals once per row; channels are
+// deinterleaved in registers for the per channel results. Rows are summed in
+// parallel and the partial sums added at the end. The luma is made in registers too,
+// 16 pixels at a time with the fixed point coefficients of cvtColor as word products
+// (v_dotprod again), never as an image. Identical images have an infinite PSNR.
+//
+// SSIM is the one of Wang et al. (2004): within a Gaussian window of sigma 1.5 the
+// means, variances and covariance of the two images, with C1 = (0.01 * 255)^2 and
+// C2 = (0.03 * 255)^2, averaged over the image. The window is separable, so every
+// local moment is one GaussianBlur, a row and a column pass.
+
+#ifndef IMAGE_METRICS_HPP
+#define IMAGE_METRICS_HPP
+
+#include <opencv2/core.hpp>
+#include <opencv2/core/utility.hpp>
+#include <opencv2/core/hal/intrin.hpp>
+#include <opencv2/imgproc.hpp>
+#include <opencv2/videoio.hpp>
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <limits>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+namespace metrics
+{
+
+enum Mode { ALL_CHANNELS, LUMA };
+
+// Y of BGR in the fixed point of cvtColor( BGR2YUV )
+inline int luma( const uchar* p )
+{
+    return ( p[0] * 1868 + p[1] * 9617 + p[2] * 4899 + ( 1 << 13 ) ) >> 14;
+}
+
+// squared differences of one row, per channel (up to 4) or of the luma into sse[0]
+inline void rowSse( const uchar* a, const uchar* b, int width, int cn, bool useLuma, uint64 sse[4] )
+{
+    int x = 0;
+    if( useLuma )
+    {
+        uint64 s = 0;
+#if CV_SIMD128
+        // b * 1868 + g * 9617 and r * 4899 + 1 * 8192 as pairwise products of words:
+        // the same integers as luma(), 8 pixels per pair of v_dotprod
+        const cv::v_int16x8 bg = cv::v_int16x8( 1868, 9617, 1868, 9617, 1868, 9617, 1868, 9617 );
+        const cv::v_int16x8 r1 = cv::v_int16x8( 4899, 1 << 13, 4899, 1 << 13, 4899, 1 << 13, 4899, 1 << 13 );
+        const cv::v_int16x8 one = cv::v_setall_s16( 1 );
+        cv::v_int32x4 acc = cv::v_setzero_s32();
+        int sinceFlush = 0;
+        for( ; x <= width - 16; x += 16 )
+        {
+            cv::v_int32x4 y[2][4];
+            const uchar* p[2] = { a + x * 3, b + x * 3 };
+            for( int i = 0; i < 2; i++ )
+            {
+                cv::v_uint8x16 c[3];
+                cv::v_load_deinterleave( p[i], c[0], c[1], c[2] );
+                cv::v_uint16x8 lo[3], hi[3];
+                for( int k = 0; k < 3; k++ )
+                    cv::v_expand( c[k], lo[k], hi[k] );
+                for( int h = 0; h < 2; h++ )
+                {
+                    const cv::v_uint16x8* w = h ? hi : lo;
+                    cv::v_int16x8 p0, p1, q0, q1;
+                    cv::v_zip( cv::v_reinterpret_as_s16( w[0] ), cv::v_reinterpret_as_s16( w[1] ), p0, p1 );
+                    cv::v_zip( cv::v_reinterpret_as_s16( w[2] ), one, q0, q1 );
+                    y[i][h * 2] = ( cv::v_dotprod( p0, bg ) + cv::v_dotprod( q0, r1 ) ) >> 14;
+                    y[i][h * 2 + 1] = ( cv::v_dotprod( p1, bg ) + cv::v_dotprod( q1, r1 ) ) >> 14;
+                }
+            }
+            for( int h = 0; h < 4; h += 2 )
+            {
+                // differences of 8 bit lumas fit in words
+                cv::v_int16x8 d = cv::v_pack( y[0][h] - y[1][h], y[0][h + 1] - y[1][h + 1] );
+                acc += cv::v_dotprod( d, d );
+            }
+            // a lane gains at most 4 x 255^2 per step: flushed every 512 steps
+            if( ++sinceFlush == 512 )
+            {
+                s += (unsigned)cv::v_reduce_sum( acc );
+                acc = cv::v_setzero_s32();
+                sinceFlush = 0;
+            }
+        }
+        s += (unsigned)cv::v_reduce_sum( acc );
+#endif
+        for( ; x < width; x++ )
+        {
+            int d = luma( a + x * 3 ) - luma( b + x * 3 );
+            s += d * d;
+        }
+        sse[0] += s;
+        return;
+    }
+    uint64 part[4] = { 0, 0, 0, 0 };
+#if CV_SIMD128
+    if( cn == 1 || cn == 3 || cn == 4 )
+    {
+        // a lane gains at most 4 x 255^2 per step: flushed every 512 steps, far below
+        // the 32 bit limit
+        cv::v_int32x4 acc[4] = { cv::v_setzero_s32(), cv::v_setzero_s32(), cv::v_setzero_s32(), cv::v_setzero_s32() };
+        int sinceFlush = 0;
+        for( ; x <= width - 16; x += 16 )
+        {
+            cv::v_uint8x16 va[4], vb[4];
+            if( cn == 1 )
+            {
+                va[0] = cv::v_load( a + x );
+                vb[0] = cv::v_load( b + x );
+            }
+            else if( cn == 3 )
+            {
+                cv::v_load_deinterleave( a + x * 3, va[0], va[1], va[2] );
+                cv::v_load_deinterleave( b + x * 3, vb[0], vb[1], vb[2] );
+            }
+            else
+            {
+                cv::v_load_deinterleave( a + x * 4, va[0], va[1], va[2], va[3] );
+                cv::v_load_deinterleave( b + x * 4, vb[0], vb[1], vb[2], vb[3] );
+            }
+            for( int c = 0; c < cn; c++ )
+            {
+                cv::v_uint16x8 lo, hi;
+                cv::v_expand( cv::v_absdiff( va[c], vb[c] ), lo, hi );
+                cv::v_int16x8 l = cv::v_reinterpret_as_s16( lo ), h = cv::v_reinterpret_as_s16( hi );
+                // differences below 256: as signed words they stay positive
+                acc[c] += cv::v_dotprod( l, l ) + cv::v_dotprod( h, h );
+            }
+            if( ++sinceFlush == 512 )
+            {
+                for( int c = 0; c < cn; c++ )
+                {
+                    sse[c] += (unsigned)cv::v_reduce_sum( acc[c] );
+                    acc[c] = cv::v_setzero_s32();
+                }
+                sinceFlush = 0;
+            }
+        }
+        for( int c = 0; c < cn; c++ )
+            sse[c] += (unsigned)cv::v_reduce_sum( acc[c] );
+    }
+#endif
+    for( ; x < width; x++ )
+        for( int c = 0; c < cn; c++ )
+        {
+            int d = a[x * cn + c] - b[x * cn + c];
+            part[c] += d * d;
+        }
+    for( int c = 0; c < cn; c++ )
+        sse[c] += part[c];
+}
+
+class SseBody : public cv::ParallelLoopBody
+{
+public:
+    SseBody( const cv::Mat& _a, const cv::Mat& _b, bool _useLuma, uint64* _total, std::mutex& _mutex )
+        : a( _a ), b( _b ), useLuma( _useLuma ), total( _total ), mutex( _mutex ) {}
+
+    void operator()( const cv::Range& range ) const
+    {
+        uint64 sse[4] = { 0, 0, 0, 0 };
+        for( int y = range.start; y < range.end; y++ )
+            rowSse( a.ptr<uchar>( y ), b.ptr<uchar>( y ), a.cols, a.channels(), useLuma, sse );
+        std::lock_guard<std::mutex> lock( mutex );
+        for( int c = 0; c < 4; c++ )
+            total[c] += sse[c];
+    }
+
+private:
+    const cv::Mat& a;
+    const cv::Mat& b;
+    bool useLuma;
+    uint64* total;
+    std::mutex& mutex;
+};
+
+// per channel sums of squared differences; LUMA: of Y, in [0]
+inline void sse( const cv::Mat& a, const cv::Mat& b, Mode mode, uint64 total[4] )
+{
+    CV_Assert( a.size() == b.size() && a.type() == b.type() && a.depth() == CV_8U && a.channels() <= 4 );
+    CV_Assert( mode != LUMA || a.channels() == 3 );
+    std::mutex mutex;
+    total[0] = total[1] = total[2] = total[3] = 0;
+    cv::parallel_for_( cv::Range( 0, a.rows ), SseBody( a, b, mode == LUMA, total, mutex ),
+                       std::max( 1.0, a.total() / (double)( 1 << 16 ) ) );
+}
+
+inline double psnrOf( uint64 s, double count )
+{
+    if( s == 0 )
+        return std::numeric_limits<double>::infinity();
+    return 10.0 * std::log10( 255.0 * 255.0 * count / (double)s );
+}
+
+inline double psnr( const cv::Mat& a, const cv::Mat& b, Mode mode = ALL_CHANNELS )
+{
+    uint64 t[4];
+    sse( a, b, mode, t );
+    double count = (double)a.total() * ( mode == LUMA ? 1 : a.channels() );
+    return psnrOf( t[0] + t[1] + t[2] + t[3], count );
+}
+
+inline cv::Scalar psnrPerChannel( const cv::Mat& a, const cv::Mat& b )
+{
+    uint64 t[4];
+    sse( a, b, ALL_CHANNELS, t );
+    cv::Scalar r;
+    for( int c = 0; c < a.channels(); c++ )
+        r[c] = psnrOf( t[c], (double)a.total() );
+    return r;
+}
+
+// SSIM of two single channel float images
+inline double ssimPlane( const cv::Mat& x, const cv::Mat& y )
+{
+    const double C1 = 6.5025, C2 = 58.5225;
+    const cv::Size window( 11, 11 );
+    cv::Mat mx, my, sxx, syy, sxy, t;
+    cv::GaussianBlur( x, mx, window, 1.5 );
+    cv::GaussianBlur( y, my, window, 1.5 );
+    cv::GaussianBlur( x.mul( x ), sxx, window, 1.5 );
+    cv::GaussianBlur( y.mul( y ), syy, window, 1.5 );
+    cv::GaussianBlur( x.mul( y ), sxy, window, 1.5 );
+    cv::Mat mxy = mx.mul( my ), mxx = mx.mul( mx ), myy = my.mul( my );
+    sxx -= mxx;
+    syy -= myy;
+    sxy -= mxy;
+    cv::Mat num = ( 2 * mxy + C1 ).mul( 2 * sxy + C2 );
+    cv::Mat den = ( mxx + myy + C1 ).mul( sxx + syy + C2 );
+    cv::divide( num, den, t );
+    return cv::mean( t )[0];
+}
+
+inline cv::Scalar ssimPerChannel( const cv::Mat& a, const cv::Mat& b )
+{
+    CV_Assert( a.size() == b.size() && a.type() == b.type() && a.depth() == CV_8U && a.channels() <= 4 );
+    cv::Scalar r;
+    cv::Mat x, y;
+    for( int c = 0; c < a.channels(); c++ )
+    {
+        cv::extractChannel( a, x, c );
+        cv::extractChannel( b, y, c );
+        x.convertTo( x, CV_32F );
+        y.convertTo( y, CV_32F );
+        r[c] = ssimPlane( x, y );
+    }
+    return r;
+}
+
+// per frame PSNR (all channels) and optionally SSIM (mean of the channels)
+class QualityMeter
+{
+public:
+    explicit QualityMeter( bool _withSsim = false ) : withSsim( _withSsim ), totalSse( 0 ), totalCount( 0 ) {}
+
+    struct Frame
+    {
+        double psnr, ssim;
+    };
+
+    const Frame& add( const cv::Mat& ref, const cv::Mat& test )
+    {
+        uint64 t[4];
+        sse( ref, test, ALL_CHANNELS, t );
+        Frame f;
+        double count = (double)ref.total() * ref.channels();
+        f.psnr = psnrOf( t[0] + t[1] + t[2] + t[3], count );
+        f.ssim = 0;
+        if( withSsim )
+        {
+            cv::Scalar s = ssimPerChannel( ref, test );
+            f.ssim = ( s[0] + s[1] + s[2] + s[3] ) / ref.channels();
+        }
+        totalSse += t[0] + t[1] + t[2] + t[3];
+        totalCount += count;
+        frames.push_back( f );
+        return frames.back();
+    }
+
+    // frame by frame until either capture ends; returns the frames compared
+    int compare( cv::VideoCapture& ref, cv::VideoCapture& test )
+    {
+        cv::Mat a, b;
+        int n = 0;
+        while( ref.read( a ) && test.read( b ) )
+        {
+            add( a, b );
+            n++;
+        }
+        return n;
+    }
+
+    const std::vector<Frame>& results() const { return frames; }
+
+    // the PSNR of all the frames as one signal
+    double overallPsnr() const { return psnrOf( totalSse, totalCount ); }
+
+    void report( std::ostream& out ) const
+    {
+        if( frames.empty() )
+        {
+            out << "no frames" << std::endl;
+            return;
+        }
+        double meanPsnr = 0, meanSsim = 0;
+        size_t worst = 0;
+        for( size_t i = 0; i < frames.size(); i++ )
+        {
+            meanPsnr += std::min( frames[i].psnr, 100.0 );   // identical frames count as 100 dB
+            meanSsim += frames[i].ssim;
+            if( frames[i].psnr < frames[worst].psnr )
+                worst = i;
+        }
+        out << std::fixed << std::setprecision( 3 ) << frames.size() << " frames, PSNR overall " << overallPsnr()
+            << " dB, mean " << meanPsnr / frames.size() << " dB, worst " << frames[worst].psnr << " dB (frame " << worst << ")";
+        if( withSsim )
+            out << ", mean SSIM " << meanSsim / frames.size();
+        out << std::endl;
+    }
+
+private:
+    bool withSsim;
+    uint64 totalSse;
+    double totalCount;
+    std::vector<Frame> frames;
+};
+
+}
+
+#endif
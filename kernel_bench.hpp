@@ -0,0 +1,174 @@
+// Timing harness for per-pixel kernels, shared by the samples.
+//
+//     KernelBench bench;
+//     bench.add( "at<>", thresholdAt );          // void( const Mat& src, Mat& dst )
+//     bench.add( "LUT", thresholdLut );
+//     bench.run( sizes, CV_8UC1 );               // every variant on every size
+//     bench.printTable( std::cout );             // or bench.writeCsv( file )
+//     bench.runOn( imread( "lena.jpg" ), sizes );  // a real image, resized to every size
+//
+// For every size one random source image is made and each variant runs "warmup"
+// times untimed, then "repeats" times timed one by one. The first variant added is
+// the reference: the output of every other variant is compared to it (NORM_INF), so a
+// fast path that changes the result shows up in the table. Reported times are the
+// median, minimum and standard deviation of the repeats, in ms.
+
+#ifndef KERNEL_BENCH_HPP
+#define KERNEL_BENCH_HPP
+
+#include <opencv2/core.hpp>
+#include <opencv2/core/utility.hpp>
+#include <opencv2/imgproc.hpp>
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <iomanip>
+#include <ostream>
+#include <string>
+#include <vector>
+
+class KernelBench
+{
+public:
+    typedef std::function<void( const cv::Mat&, cv::Mat& )> Kernel;
+
+    struct Result
+    {
+        std::string name;
+        cv::Size size;
+        double median_ms, min_ms, stddev_ms;
+        double maxDiff;     // NORM_INF against the reference output, 0 for the reference
+        double speedup;     // reference median / this median
+    };
+
+    explicit KernelBench( int _repeats = 20, int _warmup = 2 ) : repeats( std::max( 1, _repeats ) ), warmup( _warmup ) {}
+
+    void add( const std::string& name, const Kernel& kernel )
+    {
+        names.push_back( name );
+        kernels.push_back( kernel );
+    }
+
+    // src is filled with randu( low, high ); returns the results of this call only
+    std::vector<Result> run( const std::vector<cv::Size>& sizes, int type, double low = 0, double high = 256 )
+    {
+        CV_Assert( !kernels.empty() );
+        std::vector<Result> current;
+        for( size_t s = 0; s < sizes.size(); s++ )
+        {
+            cv::Mat src( sizes[s], type );
+            cv::randu( src, cv::Scalar::all( low ), cv::Scalar::all( high ) );
+            runAll( src, current );
+        }
+        return current;
+    }
+
+    // src is image resized to every size (INTER_AREA when shrinking), for kernels
+    // whose speed depends on the content
+    std::vector<Result> runOn( const cv::Mat& image, const std::vector<cv::Size>& sizes )
+    {
+        CV_Assert( !kernels.empty() && !image.empty() );
+        std::vector<Result> current;
+        for( size_t s = 0; s < sizes.size(); s++ )
+        {
+            cv::Mat src;
+            bool shrink = sizes[s].area() < image.size().area();
+            cv::resize( image, src, sizes[s], 0, 0, shrink ? cv::INTER_AREA : cv::INTER_LINEAR );
+            runAll( src, current );
+        }
+        return current;
+    }
+
+    const std::vector<Result>& all() const { return results; }
+
+    void printTable( std::ostream& out ) const
+    {
+        out << std::left << std::setw( 12 ) << "size" << std::setw( 20 ) << "kernel" << std::right
+            << std::setw( 10 ) << "median" << std::setw( 10 ) << "min" << std::setw( 10 ) << "stddev"
+            << std::setw( 10 ) << "speedup" << std::setw( 8 ) << "equal" << "  (ms)" << std::endl;
+        out << std::fixed << std::setprecision( 3 );
+        for( size_t i = 0; i < results.size(); i++ )
+        {
+            const Result& r = results[i];
+            out << std::left << std::setw( 12 ) << sizeName( r.size ) << std::setw( 20 ) << r.name << std::right
+                << std::setw( 10 ) << r.median_ms << std::setw( 10 ) << r.min_ms << std::setw( 10 ) << r.stddev_ms
+                << std::setw( 10 ) << r.speedup << std::setw( 8 ) << ( r.maxDiff == 0 ? "yes" : "NO" ) << std::endl;
+        }
+        out.unsetf( std::ios::floatfield );
+    }
+
+    void writeCsv( std::ostream& out ) const
+    {
+        out << "width,height,kernel,median_ms,min_ms,stddev_ms,speedup,max_diff" << std::endl;
+        for( size_t i = 0; i < results.size(); i++ )
+        {
+            const Result& r = results[i];
+            out << r.size.width << "," << r.size.height << "," << r.name << "," << r.median_ms << "," << r.min_ms << ","
+                << r.stddev_ms << "," << r.speedup << "," << r.maxDiff << std::endl;
+        }
+    }
+
+private:
+    void runAll( const cv::Mat& src, std::vector<Result>& current )
+    {
+        cv::Mat reference;
+        double referenceMedian = 0;
+        for( size_t k = 0; k < kernels.size(); k++ )
+        {
+            cv::Mat dst;
+            Result r = measure( names[k], kernels[k], src, dst );
+            if( k == 0 )
+            {
+                reference = dst;
+                referenceMedian = r.median_ms;
+                r.maxDiff = 0;
+            }
+            else
+                r.maxDiff = dst.size() == reference.size() && dst.type() == reference.type()
+                            ? cv::norm( dst, reference, cv::NORM_INF ) : HUGE_VAL;
+            r.speedup = r.median_ms > 0 ? referenceMedian / r.median_ms : 0;
+            current.push_back( r );
+            results.push_back( r );
+        }
+    }
+
+    Result measure( const std::string& name, const Kernel& kernel, const cv::Mat& src, cv::Mat& dst ) const
+    {
+        for( int i = 0; i < warmup; i++ )
+            kernel( src, dst );
+        std::vector<double> times( repeats );
+        for( int i = 0; i < repeats; i++ )
+        {
+            int64 t = cv::getTickCount();
+            kernel( src, dst );
+            times[i] = ( cv::getTickCount() - t ) * 1000.0 / cv::getTickFrequency();
+        }
+
+        Result r;
+        r.name = name;
+        r.size = src.size();
+        double mean = 0, var = 0;
+        for( int i = 0; i < repeats; i++ )
+            mean += times[i];
+        mean /= repeats;
+        for( int i = 0; i < repeats; i++ )
+            var += ( times[i] - mean ) * ( times[i] - mean );
+        r.stddev_ms = std::sqrt( var / repeats );
+        std::sort( times.begin(), times.end() );
+        r.min_ms = times[0];
+        r.median_ms = repeats % 2 ? times[repeats / 2] : ( times[repeats / 2 - 1] + times[repeats / 2] ) / 2;
+        return r;
+    }
+
+    static std::string sizeName( cv::Size s )
+    {
+        return cv::format( "%dx%d", s.width, s.height );
+    }
+
+    int repeats, warmup;
+    std::vector<std::string> names;
+    std::vector<Kernel> kernels;
+    std::vector<Result> results;
+};
+
+#endif
@@ -4,10 +4,24 @@
 #include "opencv2/imgproc/imgproc.hpp"
 #include "opencv2/imgcodecs.hpp"
 #include "opencv2/highgui/highgui.hpp"
+#include "opencv2/ml.hpp"
+#include "MasteringOpenCV-Chapter5_NumberPlateRecognition/plate_features.hpp"
+#include "MasteringOpenCV-Chapter5_NumberPlateRecognition/svm_dataset.hpp"
+#include "histogram8u.hpp"
+#include "result_cache.hpp"
 
 #include <iostream>
+#include <fstream>
+#include <sstream>
 #include <math.h>
 #include <string.h>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <algorithm>
 
 using namespace cv;
 using namespace std;
@@ -36,37 +50,14 @@ Plate::Plate(Mat img, Rect pos){
 }
 
 string Plate::str(){
+    //Order the characters left to right
+    vector<pair<int, int> > order;
+    for(size_t i=0; i< charsPos.size(); i++)
+        order.push_back(make_pair(charsPos[i].x, (int)i));
+    sort(order.begin(), order.end());
     string result="";
-    //Order numbers
-    vector<int> orderIndex;
-    vector<int> xpositions;
-    for(int i=0; i< charsPos.size(); i++){
-        orderIndex.push_back(i);
-        xpositions.push_back(charsPos[i].x);
-    }
-    float min=xpositions[0];
-    int minIdx=0;
-    for(int i=0; i< xpositions.size(); i++){
-        min=xpositions[i];
-        minIdx=i;
-        for(int j=i; j<xpositions.size(); j++){
-            if(xpositions[j]<min){
-                min=xpositions[j];
-                minIdx=j;
-            }
-        }
-        int aux_i=orderIndex[i];
-        int aux_min=orderIndex[minIdx];
-        orderIndex[i]=aux_min;
-        orderIndex[minIdx]=aux_i;
-
-        float aux_xi=xpositions[i];
-        float aux_xmin=xpositions[minIdx];
-        xpositions[i]=aux_xmin;
-        xpositions[minIdx]=aux_xi;
-    }
-    for(int i=0; i<orderIndex.size(); i++){
-        result=result+chars[orderIndex[i]];
+    for(size_t i=0; i<order.size(); i++){
+        result=result+chars[order[i].second];
     }
     return result;
 }
@@ -108,50 +99,207 @@ Mat DetectRegions::histeq(Mat in)
 {
     Mat out(in.size(), in.type());
     if(in.channels()==3){
+        // V equalized through a 3 channel LUT, identity on H and S: no split and merge
         Mat hsv;
-        vector<Mat> hsvSplit;
         cvtColor(in, hsv, CV_BGR2HSV);
-        split(hsv, hsvSplit);
-        equalizeHist(hsvSplit[2], hsvSplit[2]);
-        merge(hsvSplit, hsv);
+        Mat identity(1, 256, CV_8U), lut;
+        for(int i=0;i<256;i++)
+            identity.at<uchar>(i)=(uchar)i;
+        Mat tables[]={identity, identity, Histogram8u(hsv, Mat(), 2).equalizationLut()};
+        merge(tables, 3, lut);
+        LUT(hsv, lut, hsv);
         cvtColor(hsv, out, CV_HSV2BGR);
     }else if(in.channels()==1){
-        equalizeHist(in, out);
+        LUT(in, Histogram8u(in).equalizationLut(), out);
     }
 
     return out;
 
 }
 
-vector<Plate> DetectRegions::segment(Mat input){
+namespace DetectRegions {
+
+// Mats reused from one image to the next. Batch mode keeps one per worker thread,
+// so after the first few images segment() stops allocating.
+struct SegmentWorkspace
+{
+    Mat img_gray, img_sobel, img_threshold, element;
+    Mat result;
+    vector< vector< Point> > contours;
+    String name;    // prefix of the saved regions
+};
+
+// Buffers of one candidate refinement, one set per thread. The flood fill mask only
+// ever grows, and only the part covering the candidate ROI is cleared.
+struct RefineBuffers
+{
+    Mat mask, img_crop, resultResized;
+    vector<Point> pointsInterest;
+};
+
+// Flood fills around one candidate inside a padded ROI instead of the whole image,
+// and cuts the deskewed plate out with a single warp of the plate area.
+template<bool ShowSteps>
+bool refineCandidate(const Mat& input, const RotatedRect& candidate, int index, RefineBuffers& buf, Mat* debug, Plate& plate){
+    //For better rect cropping for each posible box
+    //Make floodfill algorithm because the plate has white background
+    //And then we can retrieve more clearly the contour box
+    if(ShowSteps)
+        circle(*debug, candidate.center, 3, Scalar(0,255,0), -1);
+
+    //the fill is kept to the candidate plus its own size on every side, which is
+    //more than a plate fill ever reaches
+    Rect box = candidate.boundingRect();
+    int pad = std::max(box.width, box.height);
+    Rect roi = Rect(box.x - pad, box.y - pad, box.width + pad*2, box.height + pad*2) & Rect(0, 0, input.cols, input.rows);
+    if(roi.area() == 0)
+        return false;
+
+    //get the min size between width and height
+    float minSize=(candidate.size.width < candidate.size.height)?candidate.size.width:candidate.size.height;
+    minSize=minSize-minSize*0.5;
+    //Initialize floodfill parameters and variables
+    if(buf.mask.rows < roi.height + 2 || buf.mask.cols < roi.width + 2)
+        buf.mask.create(std::max(buf.mask.rows, roi.height + 2), std::max(buf.mask.cols, roi.width + 2), CV_8UC1);
+    Mat mask = buf.mask(Rect(0, 0, roi.width + 2, roi.height + 2));
+    mask= Scalar::all(0);
+    Mat inputRoi = input(roi);
+    int loDiff = 30;
+    int upDiff = 30;
+    int connectivity = 4;
+    int newMaskVal = 255;
+    int NumSeeds = 10;
+    Rect ccomp;
+    int flags = connectivity + (newMaskVal << 8 ) + CV_FLOODFILL_FIXED_RANGE + CV_FLOODFILL_MASK_ONLY;
+    //get 10 points around center for floodfill algorithm, seeded per candidate so
+    //that the result does not depend on the order candidates are refined in
+    RNG rng(0x1234 + index);
+    for(int j=0; j<NumSeeds; j++){
+        Point seed;
+        seed.x=candidate.center.x+rng.uniform(0, std::max((int)minSize, 1))-(minSize/2);
+        seed.y=candidate.center.y+rng.uniform(0, std::max((int)minSize, 1))-(minSize/2);
+        if(ShowSteps)
+            circle(*debug, seed, 1, Scalar(0,255,255), -1);
+        if(!roi.contains(seed))
+            continue;
+        floodFill(inputRoi, mask, seed - roi.tl(), Scalar(255,0,0), &ccomp, Scalar(loDiff, loDiff, loDiff), Scalar(upDiff, upDiff, upDiff), flags);
+    }
+    if(ShowSteps)
+        imshow("MASK", mask);
+
+    //Check new floodfill mask match for a correct patch.
+    //Get all points detected for get Minimal rotated Rect, in image coordinates
+    vector<Point>& pointsInterest = buf.pointsInterest;
+    pointsInterest.clear();
+    for(int y = 1; y <= roi.height; y++){
+        const uchar* m = mask.ptr<uchar>(y);
+        for(int x = 1; x <= roi.width; x++)
+            if(m[x]==255)
+                pointsInterest.push_back(Point(roi.x + x - 1, roi.y + y - 1));
+    }
+    if(pointsInterest.empty())
+        return false;
+    //a fill reaching a side where the roi cut the image was cut short there: its
+    //true extent is unknown, so it must not pass verifySizes on the part kept
+    Rect filled = boundingRect(pointsInterest);
+    if((filled.x == roi.x && roi.x > 0) || (filled.y == roi.y && roi.y > 0) ||
+       (filled.br().x == roi.br().x && roi.br().x < input.cols) || (filled.br().y == roi.br().y && roi.br().y < input.rows))
+        return false;
+
+    RotatedRect minRect = minAreaRect(pointsInterest);
+    if(!verifySizes(minRect))
+        return false;
+
+    // rotated rectangle drawing
+    if(ShowSteps){
+        Point2f rect_points[4]; minRect.points( rect_points );
+        for( int j = 0; j < 4; j++ )
+            line( *debug, rect_points[j], rect_points[(j+1)%4], Scalar(0,0,255), 1, 8 );
+    }
+
+    //Get rotation matrix
+    float r= (float)minRect.size.width / (float)minRect.size.height;
+    float angle=minRect.angle;
+    if(r<1)
+        angle=90+angle;
+    Size rect_size=minRect.size;
+    if(r < 1)
+        swap(rect_size.width, rect_size.height);
+
+    //Rotate and crop in one go: move the plate centre to the centre of the crop
+    Mat rotmat= getRotationMatrix2D(minRect.center, angle,1);
+    rotmat.at<double>(0,2) += rect_size.width*0.5 - minRect.center.x;
+    rotmat.at<double>(1,2) += rect_size.height*0.5 - minRect.center.y;
+    warpAffine(input, buf.img_crop, rotmat, rect_size, CV_INTER_CUBIC);
+
+    buf.resultResized.create(33,144, CV_8UC3);
+    resize(buf.img_crop, buf.resultResized, buf.resultResized.size(), 0, 0, INTER_CUBIC);
+    //Equalize croped image
+    Mat grayResult;   // handed out with the plate, so not reused
+    cvtColor(buf.resultResized, grayResult, CV_BGR2GRAY);
+    blur(grayResult, grayResult, Size(3,3));
+    grayResult=histeq(grayResult);
+    if(ShowSteps){
+        imshow("grayResult", grayResult);
+        waitKey();
+    }
+    plate = Plate(grayResult,minRect.boundingRect());
+    return true;
+}
+
+class RefineBody : public ParallelLoopBody
+{
+public:
+    RefineBody(const Mat& _input, const vector<RotatedRect>& _rects, vector<Plate>& _plates, vector<uchar>& _found)
+        : input(_input), rects(_rects), plates(_plates), found(_found) {}
+
+    void operator()(const Range& range) const{
+        static thread_local RefineBuffers buf;
+        for(int i = range.start; i < range.end; i++)
+            found[i] = refineCandidate<false>(input, rects[i], i, buf, 0, plates[i]);
+    }
+
+private:
+    const Mat& input;
+    const vector<RotatedRect>& rects;
+    vector<Plate>& plates;
+    vector<uchar>& found;
+};
+
+// ShowSteps is a template argument so that batch instantiations carry no imshow,
+// waitKey or debug drawing at all.
+template<bool ShowSteps>
+vector<Plate> segmentImpl(const Mat& input, SegmentWorkspace& ws){
     vector<Plate> output;
 
     //convert image to gray
-    Mat img_gray;
-    cvtColor(input, img_gray, CV_BGR2GRAY);
-    blur(img_gray, img_gray, Size(5,5));
+    cvtColor(input, ws.img_gray, CV_BGR2GRAY);
+    blur(ws.img_gray, ws.img_gray, Size(5,5));
 
     //Finde vertical lines. Car plates have high density of vertical lines
-    Mat img_sobel;
-    Sobel(img_gray, img_sobel, CV_8U, 1, 0, 3, 1, 0, BORDER_DEFAULT);
-    if(showSteps)
-        imshow("Sobel", img_sobel);
-waitKey();
+    Sobel(ws.img_gray, ws.img_sobel, CV_8U, 1, 0, 3, 1, 0, BORDER_DEFAULT);
+    if(ShowSteps){
+        imshow("Sobel", ws.img_sobel);
+        waitKey();
+    }
     //threshold image
-    Mat img_threshold;
-    threshold(img_sobel, img_threshold, 0, 255, CV_THRESH_OTSU+CV_THRESH_BINARY);
-    if(showSteps)
-        imshow("Threshold", img_threshold);
-waitKey();
+    threshold(ws.img_sobel, ws.img_threshold, 0, 255, CV_THRESH_OTSU+CV_THRESH_BINARY);
+    if(ShowSteps){
+        imshow("Threshold", ws.img_threshold);
+        waitKey();
+    }
     //Morphplogic operation close
-    Mat element = getStructuringElement(MORPH_RECT, Size(17, 3) );
-    morphologyEx(img_threshold, img_threshold, CV_MOP_CLOSE, element);
-    if(showSteps)
-        imshow("Close", img_threshold);
-waitKey();
+    if(ws.element.empty())
+        ws.element = getStructuringElement(MORPH_RECT, Size(17, 3) );
+    morphologyEx(ws.img_threshold, ws.img_threshold, CV_MOP_CLOSE, ws.element);
+    if(ShowSteps){
+        imshow("Close", ws.img_threshold);
+        waitKey();
+    }
     //Find contours of possibles plates
-    vector< vector< Point> > contours;
-    findContours(img_threshold,
+    vector< vector< Point> >& contours = ws.contours;
+    contours.clear();
+    findContours(ws.img_threshold,
             contours, // a vector of contours
             CV_RETR_EXTERNAL, // retrieve the external contours
             CV_CHAIN_APPROX_NONE); // all pixels of each contours
@@ -173,116 +321,474 @@ waitKey();
     }
 
     // Draw blue contours on a white image
-    cv::Mat result;
-    input.copyTo(result);
-    cv::drawContours(result,contours,
-            -1, // draw all contours
-            cv::Scalar(255,0,0), // in blue
-            1); // with a thickness of 1
+    if(ShowSteps){
+        input.copyTo(ws.result);
+        cv::drawContours(ws.result,contours,
+                -1, // draw all contours
+                cv::Scalar(255,0,0), // in blue
+                1); // with a thickness of 1
+    }
+
+    //candidates are independent, refine them in parallel unless we are showing steps
+    vector<Plate> plates(rects.size());
+    vector<uchar> found(rects.size(), 0);
+    if(ShowSteps){
+        RefineBuffers buf;
+        for(int i=0; i< rects.size(); i++)
+            found[i] = refineCandidate<ShowSteps>(input, rects[i], i, buf, &ws.result, plates[i]);
+    }else{
+        parallel_for_(Range(0, (int)rects.size()), RefineBody(input, rects, plates, found));
+    }
 
     for(int i=0; i< rects.size(); i++){
+        if(!found[i])
+            continue;
+        if(saveRegions){
+            stringstream ss(stringstream::in | stringstream::out);
+            ss << "tmp/" << ws.name << "_" << i << ".jpg";
+            imwrite(ss.str(), plates[i].plateImg);
+        }
+        output.push_back(plates[i]);
+    }
+    if(ShowSteps)
+        imshow("Contours", ws.result);
 
-        //For better rect cropping for each posible box
-        //Make floodfill algorithm because the plate has white background
-        //And then we can retrieve more clearly the contour box
-        circle(result, rects[i].center, 3, Scalar(0,255,0), -1);
-        //get the min size between width and height
-        float minSize=(rects[i].size.width < rects[i].size.height)?rects[i].size.width:rects[i].size.height;
-        minSize=minSize-minSize*0.5;
-        //initialize rand and get 5 points around center for floodfill algorithm
-//        srand ( time(NULL) );
-        //Initialize floodfill parameters and variables
-        Mat mask;
-        mask.create(input.rows + 2, input.cols + 2, CV_8UC1);
-        mask= Scalar::all(0);
-        int loDiff = 30;
-        int upDiff = 30;
-        int connectivity = 4;
-        int newMaskVal = 255;
-        int NumSeeds = 10;
-        Rect ccomp;
-        int flags = connectivity + (newMaskVal << 8 ) + CV_FLOODFILL_FIXED_RANGE + CV_FLOODFILL_MASK_ONLY;
-        for(int j=0; j<NumSeeds; j++){
-            Point seed;
-            seed.x=rects[i].center.x+rand()%(int)minSize-(minSize/2);
-            seed.y=rects[i].center.y+rand()%(int)minSize-(minSize/2);
-            circle(result, seed, 1, Scalar(0,255,255), -1);
-            int area = floodFill(input, mask, seed, Scalar(255,0,0), &ccomp, Scalar(loDiff, loDiff, loDiff), Scalar(upDiff, upDiff, upDiff), flags);
+    return output;
+}
+
+}
+
+vector<Plate> DetectRegions::segment(Mat input){
+    static SegmentWorkspace ws;
+    ws.name = filename;
+    return showSteps ? segmentImpl<true>(input, ws) : segmentImpl<false>(input, ws);
+}
+
+// ----------------------------------------------------------------------------------
+// Optional plate / no plate check of the candidates. The model is an SVM.xml written by
+// trainSVM --features=compact, the extractor settings and PCA come from its
+// PlateFeatures node, so candidates are described exactly like the training samples.
+// An SVM.bin (trainSVM --format=bin) is mapped instead of parsed, with the extractor
+// from the SVM_features.yml written next to it.
+
+class PlateClassifier
+{
+public:
+    bool load(const string& path){
+        bool binary = path.size() > 4 && path.compare(path.size() - 4, 4, ".bin") == 0;
+        string featuresPath = binary ? path.substr(0, path.find_last_of("/\\") + 1) + "SVM_features.yml" : path;
+        FileStorage fs(featuresPath, FileStorage::READ);
+        if(!fs.isOpened() || !extractor.read(fs["PlateFeatures"])){
+            cout << featuresPath << " has no PlateFeatures, train it with trainSVM --features=compact" << endl;
+            return false;
         }
-        if(showSteps)
-            imshow("MASK", mask);
-        //cvWaitKey(0);
-
-        //Check new floodfill mask match for a correct patch.
-        //Get all points detected for get Minimal rotated Rect
-        vector<Point> pointsInterest;
-        Mat_<uchar>::iterator itMask= mask.begin<uchar>();
-        Mat_<uchar>::iterator end= mask.end<uchar>();
-        for( ; itMask!=end; ++itMask)
-            if(*itMask==255)
-                pointsInterest.push_back(itMask.pos());
-
-        RotatedRect minRect = minAreaRect(pointsInterest);
-
-        if(verifySizes(minRect)){
-            // rotated rectangle drawing
-            Point2f rect_points[4]; minRect.points( rect_points );
-            for( int j = 0; j < 4; j++ )
-                line( result, rect_points[j], rect_points[(j+1)%4], Scalar(0,0,255), 1, 8 );
-
-            //Get rotation matrix
-            float r= (float)minRect.size.width / (float)minRect.size.height;
-            float angle=minRect.angle;
-            if(r<1)
-                angle=90+angle;
-            Mat rotmat= getRotationMatrix2D(minRect.center, angle,1);
-
-            //Create and rotate image
-            Mat img_rotated;
-            warpAffine(input, img_rotated, rotmat, input.size(), CV_INTER_CUBIC);
-
-            //Crop image
-            Size rect_size=minRect.size;
-            if(r < 1)
-                swap(rect_size.width, rect_size.height);
-            Mat img_crop;
-            getRectSubPix(img_rotated, rect_size, minRect.center, img_crop);
-
-            Mat resultResized;
-            resultResized.create(33,144, CV_8UC3);
-            resize(img_crop, resultResized, resultResized.size(), 0, 0, INTER_CUBIC);
-            //Equalize croped image
-            Mat grayResult;
-            cvtColor(resultResized, grayResult, CV_BGR2GRAY);
-            blur(grayResult, grayResult, Size(3,3));
-            grayResult=histeq(grayResult);
-             imshow("grayResult", grayResult);
-             waitKey();
-            if(saveRegions){
-                stringstream ss(stringstream::in | stringstream::out);
-                ss << "tmp/" << filename << "_" << i << ".jpg";
-                imwrite(ss.str(), grayResult);
+        MappedSvmDataset mapped;
+        Mat data, classes;
+        if(binary){
+            if(!mapped.open(path)){
+                cout << path << " is not an SVM dataset" << endl;
+                return false;
             }
-            output.push_back(Plate(grayResult,minRect.boundingRect()));
+            data = mapped.data();       // train() copies what it keeps
+            classes = mapped.labels();
+        }else{
+            fs["TrainingData"] >> data;
+            fs["classes"] >> classes;
+        }
+        if(data.cols != extractor.size()){
+            cout << path << ": TrainingData does not match PlateFeatures" << endl;
+            return false;
         }
+        svm = ml::SVM::create();
+        svm->setType(ml::SVM::C_SVC);
+        svm->setKernel(ml::SVM::LINEAR);
+        svm->setTermCriteria(TermCriteria(TermCriteria::MAX_ITER, 1000, 0.01));
+        svm->train(data, ml::ROW_SAMPLE, classes);
+        return true;
     }
-    if(showSteps)
-        imshow("Contours", result);
 
-    return output;
+    bool empty() const { return svm.empty(); }
+
+    // keeps the candidates classified as plates; all of them go through one
+    // extractor call and one predict call
+    void filter(vector<Plate>& plates) const {
+        if(plates.empty())
+            return;
+        vector<Mat> images(plates.size());
+        for(size_t i = 0; i < plates.size(); i++)
+            images[i] = plates[i].plateImg;
+        Mat features, responses;
+        extractor.compute(images, features);
+        svm->predict(features, responses);
+        vector<Plate> kept;
+        for(size_t i = 0; i < plates.size(); i++)
+            if(responses.at<float>((int)i) == 1)
+                kept.push_back(plates[i]);
+        plates.swap(kept);
+    }
+
+private:
+    PlateFeatureExtractor extractor;
+    Ptr<ml::SVM> svm;
+};
+
+// ----------------------------------------------------------------------------------
+// Optional character recognition of the plates. The model is an OCR.xml with CharSize,
+// TrainingData (one row of CharSize x CharSize floats per sample, a character as
+// segmentChars() cuts it, squared and resized) and classes (the character codes).
+// All the characters of all the plates of a frame go into one feature matrix and
+// through one predict call.
+
+class CharRecognizer
+{
+public:
+    CharRecognizer() : charSize(20) {}
+
+    bool load(const string& path){
+        FileStorage fs(path, FileStorage::READ);
+        Mat data, classes;
+        if(fs.isOpened()){
+            fs["CharSize"] >> charSize;
+            fs["TrainingData"] >> data;
+            fs["classes"] >> classes;
+        }
+        if(data.empty() || data.cols != charSize*charSize || data.rows != (int)classes.total()){
+            cout << path << " has no CharSize x CharSize TrainingData with its classes" << endl;
+            return false;
+        }
+        data.convertTo(data, CV_32F);
+        classes.convertTo(classes, CV_32F);
+        Ptr<ml::KNearest> knn = ml::KNearest::create();
+        knn->setDefaultK(3);
+        knn->train(data, ml::ROW_SAMPLE, classes);
+        model = knn;
+        return true;
+    }
+
+    bool empty() const { return model.empty(); }
+
+    // the characters of one 144x33 plate: dark blobs of character size and shape
+    static void segmentChars(const Mat& plateImg, vector<Mat>& chars, vector<Rect>& pos){
+        Mat bw;
+        threshold(plateImg, bw, 60, 255, CV_THRESH_BINARY_INV);
+        vector<vector<Point> > contours;
+        findContours(bw.clone(), contours, CV_RETR_EXTERNAL, CV_CHAIN_APPROX_NONE);
+        for(size_t i = 0; i < contours.size(); i++){
+            Rect r = boundingRect(contours[i]);
+            //Spain plate characters: 45x77, aspect 0.5844, 15 to 28 pixels high here
+            float aspect = 45.0f/77.0f, charAspect = (float)r.width/(float)r.height;
+            float error = 0.35f, minAspect = 0.2f, maxAspect = aspect + aspect*error;
+            float area = (float)countNonZero(bw(r)), bbArea = (float)r.area();
+            if(area/bbArea < 0.8f && charAspect > minAspect && charAspect < maxAspect && r.height >= 15 && r.height < 28){
+                chars.push_back(bw(r));
+                pos.push_back(r);
+            }
+        }
+    }
+
+    // fills chars and charsPos of every plate
+    void recognize(vector<Plate>& plates) const {
+        vector<Mat> chars;
+        vector<int> owner;
+        for(size_t p = 0; p < plates.size(); p++){
+            plates[p].chars.clear();
+            plates[p].charsPos.clear();
+            segmentChars(plates[p].plateImg, chars, plates[p].charsPos);
+            owner.resize(chars.size(), (int)p);
+        }
+        if(chars.empty())
+            return;
+
+        //one row per character: centred in a square, resized to charSize x charSize
+        Mat features((int)chars.size(), charSize*charSize, CV_32F), square, small;
+        for(size_t i = 0; i < chars.size(); i++){
+            int side = std::max(chars[i].cols, chars[i].rows);
+            square.create(side, side, CV_8UC1);
+            square = Scalar::all(0);
+            chars[i].copyTo(square(Rect((side - chars[i].cols)/2, (side - chars[i].rows)/2, chars[i].cols, chars[i].rows)));
+            resize(square, small, Size(charSize, charSize), 0, 0, INTER_AREA);
+            small.reshape(1, 1).convertTo(features.row((int)i), CV_32F, 1./255);
+        }
+        Mat responses;
+        model->predict(features, responses);
+        for(size_t i = 0; i < chars.size(); i++)
+            plates[owner[i]].chars.push_back((char)cvRound(responses.at<float>((int)i)));
+    }
+
+private:
+    int charSize;
+    Ptr<ml::StatModel> model;
+};
+
+// ----------------------------------------------------------------------------------
+// batch mode: licence-plate --batch <dir | video/stream url> [--out=plates.csv] [--plates=dir] [--threads=N]
+//                                            [--svm=SVM.xml or SVM.bin] [--ocr=OCR.xml] [--cache=plates.cache]
+// With --cache the plates of every image are kept by content hash: a rerun over the same
+// directory only segments the images that are new or changed, or all of them when the
+// models or --plates change. With --plates the crops are cached too, so a cached image
+// still writes its PNGs. The workers look the images up, so hits are served in parallel.
+
+struct BatchItem
+{
+    BatchItem() { key.valid = false; }
+
+    string name;
+    Mat image;              // empty for files, the worker loads them
+    ResultCache::Key key;   // valid for files when there is a cache
+};
+
+// bounded queue so a fast stream cannot run away from the workers
+class BatchQueue
+{
+public:
+    BatchQueue(size_t _capacity) : capacity(_capacity), closed(false) {}
+
+    void push(BatchItem& item){
+        std::unique_lock<std::mutex> lock(mutex);
+        not_full.wait(lock, [this] { return queue.size() < capacity; });
+        queue.push_back(item);
+        not_empty.notify_one();
+    }
+
+    bool pop(BatchItem& item){
+        std::unique_lock<std::mutex> lock(mutex);
+        not_empty.wait(lock, [this] { return !queue.empty() || closed; });
+        if(queue.empty())
+            return false;
+        item = queue.front();
+        queue.pop_front();
+        not_full.notify_one();
+        return true;
+    }
+
+    void close(){ std::lock_guard<std::mutex> lock(mutex); closed = true; not_empty.notify_all(); }
+
+private:
+    size_t capacity;
+    bool closed;
+    std::deque<BatchItem> queue;
+    std::mutex mutex;
+    std::condition_variable not_full, not_empty;
+};
+
+struct BatchOutput
+{
+    std::ofstream csv;
+    string platesDir;
+    std::mutex mutex;
+    std::atomic<int> images, plates;
+    const PlateClassifier* classifier;   // null keeps every candidate
+    const CharRecognizer* recognizer;    // null leaves the text empty
+    ResultCache* cache;                  // null without --cache
+};
+
+// the csv rows of an image: positions N x 4 CV_32S, texts one per plate, each ended by '\n'
+static void writeRows(BatchOutput* out, const string& name, const Mat& positions, const Mat& texts)
+{
+    std::lock_guard<std::mutex> lock(out->mutex);
+    const char* text = texts.empty() ? "" : texts.ptr<char>();
+    for(int i = 0; i < positions.rows; i++){
+        const int* r = positions.ptr<int>(i);
+        const char* end = strchr(text, '\n');
+        out->csv << name << "," << i << "," << r[0] << "," << r[1] << "," << r[2] << "," << r[3] << ","
+                 << string(text, end) << "\n";
+        text = end + 1;
+    }
+}
+
+static void writePlateImage(BatchOutput* out, const string& name, int i, const Mat& plateImg)
+{
+    string base = name.substr(name.find_last_of("/\\") + 1);
+    imwrite(format("%s/%s_%d.png", out->platesDir.c_str(), base.c_str(), i), plateImg);
+}
+
+// the cached fields of an image: positions, texts, then the crops with --plates
+static bool writeCached(BatchOutput* out, const BatchItem& item, vector<Mat>& fields)
+{
+    if(!out->cache || !out->cache->lookup(item.key, fields))
+        return false;
+    writeRows(out, item.name, fields[0], fields[1]);
+    if(!out->platesDir.empty())
+        for(size_t i = 2; i < fields.size(); i++)
+            writePlateImage(out, item.name, (int)i - 2, fields[i]);
+    out->images++;
+    out->plates += fields[0].rows;
+    return true;
+}
+
+static void batchWorker(BatchQueue* queue, BatchOutput* out)
+{
+    // the workers already fill the cores: segmentImpl's parallel_for_ runs inline here,
+    // not as N more threads per worker
+    setNumThreads(1);
+    DetectRegions::SegmentWorkspace ws;
+    BatchItem item;
+    Mat loaded;
+    vector<Mat> fields;
+    while(queue->pop(item)){
+        if(writeCached(out, item, fields))
+            continue;
+        const Mat& input = item.image.empty() ? (loaded = imread(item.name, IMREAD_COLOR)) : item.image;
+        if(input.empty())
+            continue;
+        vector<Plate> plates = DetectRegions::segmentImpl<false>(input, ws);
+        if(out->classifier)
+            out->classifier->filter(plates);
+        if(out->recognizer)
+            out->recognizer->recognize(plates);
+        out->images++;
+        out->plates += (int)plates.size();
+
+        Mat positions((int)plates.size(), 4, CV_32S);
+        string text;
+        for(size_t i = 0; i < plates.size(); i++){
+            const Rect& r = plates[i].position;
+            int* p = positions.ptr<int>((int)i);
+            p[0] = r.x; p[1] = r.y; p[2] = r.width; p[3] = r.height;
+            text += plates[i].str() + "\n";
+            if(!out->platesDir.empty())
+                writePlateImage(out, item.name, (int)i, plates[i].plateImg);
+        }
+        Mat texts(1, (int)text.size() + 1, CV_8U, (void*)text.c_str());   // with the terminating zero
+        writeRows(out, item.name, positions, texts);
+        if(out->cache){
+            fields.clear();
+            fields.push_back(positions);
+            fields.push_back(texts);
+            if(!out->platesDir.empty())
+                for(size_t i = 0; i < plates.size(); i++)
+                    fields.push_back(plates[i].plateImg);
+            out->cache->store(item.key, fields);
+        }
+    }
+}
+
+static int runBatch(const string& source, const string& csvPath, const string& platesDir, int threads,
+                    const PlateClassifier* classifier, const CharRecognizer* recognizer, ResultCache* cache)
+{
+    BatchOutput out;
+    out.classifier = classifier;
+    out.recognizer = recognizer;
+    out.cache = cache;
+    out.csv.open(csvPath.c_str());
+    if(!out.csv.is_open()){
+        cout << "cannot write " << csvPath << endl;
+        return -1;
+    }
+    out.csv << "image,plate,x,y,width,height,text\n";
+    out.platesDir = platesDir;
+    out.images = 0;
+    out.plates = 0;
+
+    if(threads <= 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    BatchQueue queue(threads * 4);
+    vector<std::thread> workers;
+    for(int i = 0; i < threads; i++)
+        workers.push_back(std::thread(batchWorker, &queue, &out));
+
+    int64 start = getTickCount();
+    vector<String> files;
+    const char* patterns[] = { "*.jpg", "*.jpeg", "*.png", "*.bmp" };
+    for(int p = 0; p < 4; p++){
+        vector<String> found;
+        glob(source + "/" + patterns[p], found, false);
+        files.insert(files.end(), found.begin(), found.end());
+    }
+
+    if(!files.empty()){
+        vector<ResultCache::Key> keys;
+        if(cache)
+            keys = cache->keys(files);
+        for(size_t i = 0; i < files.size(); i++){
+            BatchItem item;
+            item.name = files[i];
+            if(cache)
+                item.key = keys[i];
+            queue.push(item);
+        }
+    }else{
+        // not a directory of images: read it as a video file or stream
+        VideoCapture capture(source);
+        if(!capture.isOpened())
+            cout << "no images in and cannot open " << source << endl;
+        for(int index = 0; capture.isOpened(); index++){
+            BatchItem item;
+            if(!capture.read(item.image))
+                break;
+            item.name = format("%s#%d", source.c_str(), index);
+            queue.push(item);
+        }
+    }
+
+    queue.close();
+    for(size_t i = 0; i < workers.size(); i++)
+        workers[i].join();
+
+    double seconds = (getTickCount() - start) / getTickFrequency();
+    cout << out.images << " images, " << out.plates << " plates in " << seconds << " s ("
+         << out.images / std::max(seconds, 1e-9) << " images/s, " << threads << " threads)" << endl;
+    if(cache){
+        cout << cache->hitCount() << " images from the cache, " << cache->missCount() << " segmented" << endl;
+        if(!cache->save())
+            cout << "cannot write the cache" << endl;
+    }
+    return 0;
 }
 
 
 int main(int argc, char** argv)
 {
+    if(argc >= 3 && string(argv[1]) == "--batch"){
+        string csvPath = "plates.csv", platesDir, svmPath, ocrPath, cachePath;
+        int threads = 0;
+        for(int i = 3; i < argc; i++){
+            string arg = argv[i];
+            if(arg.compare(0, 6, "--out=") == 0) csvPath = arg.substr(6);
+            else if(arg.compare(0, 9, "--plates=") == 0) platesDir = arg.substr(9);
+            else if(arg.compare(0, 10, "--threads=") == 0) threads = atoi(arg.c_str() + 10);
+            else if(arg.compare(0, 6, "--svm=") == 0) svmPath = arg.substr(6);
+            else if(arg.compare(0, 6, "--ocr=") == 0) ocrPath = arg.substr(6);
+            else if(arg.compare(0, 8, "--cache=") == 0) cachePath = arg.substr(8);
+        }
+        PlateClassifier classifier;
+        if(!svmPath.empty() && !classifier.load(svmPath))
+            return -1;
+        CharRecognizer recognizer;
+        if(!ocrPath.empty() && !recognizer.load(ocrPath))
+            return -1;
+        // the results depend on the code, the models and where the crops go
+        std::unique_ptr<ResultCache> cache;
+        if(!cachePath.empty()){
+            uint64 svmHash = 0, ocrHash = 0;
+            if(!svmPath.empty()) resultcache::hashFile(svmPath, svmHash);
+            if(!ocrPath.empty()) resultcache::hashFile(ocrPath, ocrHash);
+            cache.reset(new ResultCache(cachePath, format("licence-plate 2 svm=%llx ocr=%llx plates=%s",
+                                                          (unsigned long long)svmHash, (unsigned long long)ocrHash, platesDir.c_str())));
+        }
+        return runBatch(argv[2], csvPath, platesDir, threads, classifier.empty() ? 0 : &classifier,
+                        recognizer.empty() ? 0 : &recognizer, cache.get());
+    }
+
    char* filename = argc >= 2 ? argv[1] : (char*)"licence-plate.jpg";
 
   Mat src = imread( filename, 1 );
 
   vector<Plate> tmp=DetectRegions::segment(src);
+  // licence-plate <image> <SVM.xml>: drop the candidates the SVM rejects
+  PlateClassifier classifier;
+  if(argc >= 3 && classifier.load(argv[2])){
+      classifier.filter(tmp);
+      for(size_t i = 0; i < tmp.size(); i++)
+          rectangle(src, tmp[i].position, Scalar(0, 255, 0), 2);
+  }
+  // licence-plate <image> <SVM.xml> <OCR.xml>: and read them
+  CharRecognizer recognizer;
+  if(argc >= 4 && recognizer.load(argv[3])){
+      recognizer.recognize(tmp);
+      for(size_t i = 0; i < tmp.size(); i++)
+          putText(src, tmp[i].str(), tmp[i].position.tl() - Point(0, 4), FONT_HERSHEY_SIMPLEX, 0.8, Scalar(0, 255, 0), 2);
+  }
 imshow("a",src);
 waitKey();
 }
-
-
-
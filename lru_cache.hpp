@@ -0,0 +1,121 @@
+// Least recently used cache, the bookkeeping shared by the caches of the demos.
+//
+//     LruCache<Size, Maps, SizeLess> maps( 4 );           // at most 4 entries
+//     const Maps& m = maps.get( size, build );            // build( size, m ) on a miss
+//
+//     LruCache<string, Mat> images( 256 << 20 );          // costs in bytes
+//     if( Mat* hit = images.find( path ) ) ...            // most recently used from now on
+//     images.put( path, img.total() * img.elemSize() ) = img;
+//
+// Every entry has a cost, 1 unless put() says otherwise; the least recently used ones
+// are dropped while the costs add up to more than the capacity, except the entry just
+// put. Values are default constructed when they are put and filled in place. Not
+// thread safe: a cache shared between threads is locked by its owner.
+
+#ifndef LRU_CACHE_HPP
+#define LRU_CACHE_HPP
+
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <map>
+
+template<typename Key, typename Value, typename Less = std::less<Key> > class LruCache
+{
+public:
+    explicit LruCache( size_t _capacity ) : hits( 0 ), misses( 0 ), capacity_( _capacity ), used_( 0 ) {}
+
+    // the entry for key, now the most recently used; 0 when there is none
+    Value* find( const Key& key )
+    {
+        typename Index::iterator it = index.find( key );
+        if( it == index.end() )
+            return 0;
+        lru.splice( lru.begin(), lru, it->second );
+        return &it->second->value;
+    }
+
+    // a new entry for key in place of the one there was, the most recently used
+    Value& put( const Key& key, size_t cost = 1 )
+    {
+        erase( key );
+        lru.push_front( Entry() );
+        lru.front().key = key;
+        lru.front().cost = cost;
+        index[key] = lru.begin();
+        used_ += cost;
+        trim( 1 );
+        return lru.front().value;
+    }
+
+    // find(), or on a miss a new entry filled by build( key, value )
+    template<typename Build> Value& get( const Key& key, Build build )
+    {
+        if( Value* v = find( key ) )
+        {
+            hits++;
+            return *v;
+        }
+        misses++;
+        Value& v = put( key );
+        build( key, v );
+        return v;
+    }
+
+    void erase( const Key& key )
+    {
+        typename Index::iterator it = index.find( key );
+        if( it == index.end() )
+            return;
+        used_ -= it->second->cost;
+        lru.erase( it->second );
+        index.erase( it );
+    }
+
+    void clear()
+    {
+        lru.clear();
+        index.clear();
+        used_ = 0;
+    }
+
+    void setCapacity( size_t c )
+    {
+        capacity_ = c;
+        trim( 0 );
+    }
+
+    size_t capacity() const { return capacity_; }
+    size_t used() const { return used_; }
+    size_t size() const { return lru.size(); }
+
+    size_t hits, misses;   // of get()
+
+private:
+    struct Entry
+    {
+        Key key;
+        Value value;
+        size_t cost;
+    };
+
+    typedef std::list<Entry> List;
+    typedef std::map<Key, typename List::iterator, Less> Index;
+
+    // the least recently used entries beyond the capacity, keeping at least keep
+    void trim( size_t keep )
+    {
+        while( used_ > capacity_ && lru.size() > keep )
+        {
+            used_ -= lru.back().cost;
+            index.erase( lru.back().key );
+            lru.pop_back();
+        }
+    }
+
+    size_t capacity_, used_;
+    List lru;          // most recently used first
+    Index index;
+};
+
+#endif
@@ -1,55 +1,192 @@
 #include "qa.hpp"
+#include "image_cache.hpp"
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+#ifdef _MSC_VER
+#pragma comment( lib, "psapi.lib" )
+#endif
+#else
+#include <sys/resource.h>
+#endif
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <thread>
 #include "opencv2/highgui.hpp"
 
 using namespace cv;
 using namespace std;
 
-int main( int argc, char** argv )
+// Runs the registered demos, one after another or several at once, and times them.
+//
+//     qa                                     every demo once, with its windows
+//     qa --headless --repeat 5 --json runs.json
+//     qa --headless --jobs 4 a68942 a66209  only these, four at a time
+//     qa --list
+//     qa a4183 -- image.png                  arguments after -- are the demos' argv
+//
+// --jobs above 1 implies --headless: highgui is not to be used from several threads.
+// Wall time is measured per run. CPU time is the process time spent during the run,
+// so with --jobs it also counts the demos running alongside and is left out of the
+// report. Peak memory is the process high water mark once the demo has run, which
+// only grows: a demo's own footprint is the step from the previous one.
+
+struct DemoResult
 {
-    a68942( argc, argv );
-    destroyAllWindows();
-
-    a66209( argc, argv );
-    destroyAllWindows();
-
-    a65164( argc, argv );
-    a65164a( argc, argv );
-    destroyAllWindows();
-
-    a24405( argc, argv );
-    destroyAllWindows();
-
-    a59782( argc, argv );
-    destroyAllWindows();
-
-    a25912( argc, argv );
-    destroyAllWindows();
-
-    a23910( argc, argv );
-    destroyAllWindows();
-
-    detectAndDrawChessboardCorners();
-    detectAndDrawCentersOfCircles();
-    destroyAllWindows();
-
-    a65061( argc, argv );
-    destroyAllWindows();
-
-    apointSetBoundingRect( argc, argv );
-    destroyAllWindows();
-
-    a69434( argc, argv );
-    destroyAllWindows();
-
-    bitwisesample( argc, argv );
-    destroyAllWindows();
-
-    a1( argc, argv );
-    destroyAllWindows();
+    string name;
+    int runs, status;
+    double wallMin, wallSum, cpuSum;
+    long peakKB;
+    DemoResult() : runs( 0 ), status( 0 ), wallMin( 0 ), wallSum( 0 ), cpuSum( 0 ), peakKB( 0 ) {}
+};
+
+static long peakMemoryKB()
+{
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS pmc;
+    if( !GetProcessMemoryInfo( GetCurrentProcess(), &pmc, sizeof(pmc) ) )
+        return 0;
+    return (long)( pmc.PeakWorkingSetSize >> 10 );
+#else
+    struct rusage ru;
+    getrusage( RUSAGE_SELF, &ru );
+#ifdef __APPLE__
+    return ru.ru_maxrss >> 10;     // bytes on macOS
+#else
+    return ru.ru_maxrss;           // kilobytes on Linux
+#endif
+#endif
+}
 
-    a5147( argc, argv );
+static void runDemo( const qa::Demo& demo, int repeat, vector<char*>& args, DemoResult& r )
+{
+    r.name = demo.name;
+    for( int i = 0; i < repeat; i++ )
+    {
+        // demos may modify argv, each run gets a fresh copy of the pointers
+        vector<char*> argv( args );
+        argv.push_back( 0 );
+        clock_t c = clock();
+        int64 t = getTickCount();
+        r.status = demo.run( (int)args.size(), &argv[0] );
+        double wall = ( getTickCount() - t ) * 1000.0 / getTickFrequency();
+        r.cpuSum += ( clock() - c ) * 1000.0 / CLOCKS_PER_SEC;
+        r.wallMin = r.runs ? std::min( r.wallMin, wall ) : wall;
+        r.wallSum += wall;
+        r.runs++;
+        destroyAllWindows();
+    }
+    r.peakKB = peakMemoryKB();
+}
 
-    a24463( argc, argv );
+static void writeJson( ostream& out, const vector<DemoResult>& results, bool withCpu, int jobs, double totalMs )
+{
+    out << "{\n  \"opencv\": \"" << CV_VERSION << "\",\n  \"threads\": " << getNumThreads()
+        << ",\n  \"jobs\": " << jobs << ",\n  \"total_ms\": " << totalMs << ",\n  \"demos\": [\n";
+    for( size_t i = 0; i < results.size(); i++ )
+    {
+        const DemoResult& r = results[i];
+        out << "    { \"name\": \"" << r.name << "\", \"runs\": " << r.runs << ", \"status\": " << r.status
+            << ", \"wall_min_ms\": " << r.wallMin << ", \"wall_mean_ms\": " << r.wallSum / std::max( r.runs, 1 );
+        if( withCpu )
+            out << ", \"cpu_mean_ms\": " << r.cpuSum / std::max( r.runs, 1 );
+        out << ", \"peak_kb\": " << r.peakKB << " }" << ( i + 1 < results.size() ? "," : "" ) << "\n";
+    }
+    out << "  ]\n}" << endl;
+}
 
+int main( int argc, char** argv )
+{
+    bool headless = false, list = false;
+    int repeat = 1, jobs = 1;
+    const char* json = 0;
+    vector<string> only;
+    vector<char*> args( 1, argv[0] );
+    for( int i = 1; i < argc; i++ )
+    {
+        if( !strcmp( argv[i], "--" ) )
+        {
+            args.insert( args.end(), argv + i + 1, argv + argc );
+            break;
+        }
+        if( !strcmp( argv[i], "--headless" ) )
+            headless = true;
+        else if( !strcmp( argv[i], "--list" ) )
+            list = true;
+        else if( !strcmp( argv[i], "--repeat" ) && i + 1 < argc )
+            repeat = std::max( 1, atoi( argv[++i] ) );
+        else if( !strcmp( argv[i], "--jobs" ) && i + 1 < argc )
+            jobs = std::max( 1, atoi( argv[++i] ) );
+        else if( !strcmp( argv[i], "--json" ) && i + 1 < argc )
+            json = argv[++i];
+        else
+            only.push_back( argv[i] );
+    }
+
+    vector<qa::Demo> demos;
+    for( size_t i = 0; i < qa::demos().size(); i++ )
+        if( only.empty() || std::find( only.begin(), only.end(), qa::demos()[i].name ) != only.end() )
+            demos.push_back( qa::demos()[i] );
+    // static registration order depends on the link order
+    std::sort( demos.begin(), demos.end(), []( const qa::Demo& a, const qa::Demo& b ) { return a.name < b.name; } );
+
+    if( list )
+    {
+        for( size_t i = 0; i < demos.size(); i++ )
+            cout << demos[i].name << endl;
+        return 0;
+    }
+
+    jobs = std::min( jobs, std::max( 1, (int)demos.size() ) );
+    qa::setHeadless( headless || jobs > 1 );
+
+    vector<DemoResult> results( demos.size() );
+    int64 t = getTickCount();
+    if( jobs == 1 )
+    {
+        for( size_t i = 0; i < demos.size(); i++ )
+            runDemo( demos[i], repeat, args, results[i] );
+    }
+    else
+    {
+        // every worker takes the next demo not started yet
+        atomic<int> next( 0 );
+        vector<thread> workers;
+        for( int w = 0; w < jobs; w++ )
+            workers.push_back( thread( [&]()
+            {
+                vector<char*> own( args );
+                for( int i = next++; i < (int)demos.size(); i = next++ )
+                    runDemo( demos[i], repeat, own, results[i] );
+            } ) );
+        for( size_t w = 0; w < workers.size(); w++ )
+            workers[w].join();
+    }
+    double totalMs = ( getTickCount() - t ) * 1000.0 / getTickFrequency();
+
+    for( size_t i = 0; i < results.size(); i++ )
+    {
+        const DemoResult& r = results[i];
+        cout << r.name << ": " << r.runs << " runs, min " << r.wallMin << " ms, mean " << r.wallSum / std::max( r.runs, 1 ) << " ms";
+        if( jobs == 1 )
+            cout << ", cpu " << r.cpuSum / std::max( r.runs, 1 ) << " ms";
+        cout << ", peak " << ( r.peakKB >> 10 ) << " MB" << ( r.status ? ", status " + to_string( r.status ) : string() ) << endl;
+    }
+    if( json )
+    {
+        ofstream out( json );
+        writeJson( out, results, jobs == 1, jobs, totalMs );
+    }
+
+    // demos loading the same files share one decoded copy
+    ImageCache& cache = ImageCache::instance();
+    cout << "image cache: " << cache.hitCount() << " hits, " << cache.missCount() << " decodes, "
+         << ( cache.bytesUsed() >> 10 ) << " KB held" << endl;
     return 0;
 }
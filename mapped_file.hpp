@@ -0,0 +1,112 @@
+// A whole file mapped read only and shared, for the binary formats that wrap Mat
+// headers around their contents (mat_container.hpp, svm_dataset.hpp).
+//
+//     MappedFile f;
+//     if( f.open( "data.bin" ) && f.size() >= sizeof(Header) )
+//         const Header* h = (const Header*)f.data();
+//
+// Nothing is read from disk until a page is touched, and every process mapping the same
+// file shares its page cache pages. Empty files and files larger than the address space
+// do not open.
+
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+
+#include <opencv2/core.hpp>
+#include <string>
+#include <stdint.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+class MappedFile
+{
+public:
+    MappedFile() : base( 0 ), length( 0 ) { init(); }
+    ~MappedFile() { close(); }
+
+    void close()
+    {
+        if( base )
+        {
+#ifdef _WIN32
+            UnmapViewOfFile( base );
+            CloseHandle( mapping );
+            CloseHandle( file );
+            init();
+#else
+            munmap( base, length );
+#endif
+        }
+        base = 0;
+        length = 0;
+    }
+
+    bool isOpened() const { return base != 0; }
+    uchar* data() const { return base; }
+    size_t size() const { return length; }
+
+#ifdef _WIN32
+    bool open( const std::string& path )
+    {
+        close();
+        file = CreateFileA( path.c_str(), GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, 0 );
+        LARGE_INTEGER size;
+        if( file == INVALID_HANDLE_VALUE || !GetFileSizeEx( file, &size ) || size.QuadPart == 0 ||
+            (uint64_t)size.QuadPart > (size_t)-1 ||
+            !( mapping = CreateFileMappingA( file, 0, PAGE_READONLY, 0, 0, 0 ) ) ||
+            !( base = (uchar*)MapViewOfFile( mapping, FILE_MAP_READ, 0, 0, 0 ) ) )
+        {
+            if( mapping )
+                CloseHandle( mapping );
+            if( file != INVALID_HANDLE_VALUE )
+                CloseHandle( file );
+            init();
+            return false;
+        }
+        length = (size_t)size.QuadPart;
+        return true;
+    }
+
+private:
+    void init() { file = INVALID_HANDLE_VALUE; mapping = 0; }
+
+    HANDLE file, mapping;
+#else
+    bool open( const std::string& path )
+    {
+        close();
+        int fd = ::open( path.c_str(), O_RDONLY );
+        if( fd < 0 )
+            return false;
+        struct stat st;
+        void* p = MAP_FAILED;
+        // a 32 bit process cannot map more than its address space
+        if( fstat( fd, &st ) == 0 && st.st_size > 0 && (uint64_t)st.st_size <= (size_t)-1 )
+            p = mmap( 0, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0 );
+        ::close( fd );   // the mapping keeps the file alive
+        if( p == MAP_FAILED )
+            return false;
+        base = (uchar*)p;
+        length = (size_t)st.st_size;
+        return true;
+    }
+
+private:
+    void init() {}
+#endif
+
+    uchar* base;
+    size_t length;
+
+    MappedFile( const MappedFile& );
+    MappedFile& operator=( const MappedFile& );
+};
+
+#endif
@@ -0,0 +1,200 @@
+// Several named Mats in one binary file, loaded by mapping the file instead of reading it.
+//
+//     MatContainerWriter w;
+//     w.add( "table", table );
+//     w.add( "model", model );
+//     w.write( "data.mats" );
+//
+//     MappedMatFile f( "data.mats" );
+//     Mat table = f.get( "table" );    // points into the mapping, no copy
+//
+// Layout, native endian:
+//   MatContainerHeader (64 bytes)
+//   count x MatContainerEntry (128 bytes each)
+//   data of every Mat, each starting on an "alignment" boundary (4096 bytes unless the
+//   writer is given a smaller one, for many small Mats), rows "step" bytes apart
+//
+// The mapping is read only and shared, so every process opening the same file uses the
+// same page cache pages, and nothing is read from disk until a page is touched. The Mats
+// returned by get() do not own their data: they must not be written to and must not be
+// used after the MappedMatFile is closed (clone() them to keep a copy).
+
+#ifndef MAT_CONTAINER_HPP
+#define MAT_CONTAINER_HPP
+
+#include <opencv2/core.hpp>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <stdint.h>
+#include "mapped_file.hpp"
+
+struct MatContainerHeader
+{
+    char magic[8];          // "CVMATS\0\0"
+    uint32_t version;
+    uint32_t count;         // number of entries
+    uint32_t alignment;     // of every data block
+    uint32_t reserved0;
+    uint64_t fileSize;
+    uint8_t reserved[32];
+};
+
+struct MatContainerEntry
+{
+    char name[64];          // zero terminated
+    int32_t rows;
+    int32_t cols;
+    int32_t type;           // CV_8UC3, ...
+    int32_t reserved0;
+    uint64_t step;          // bytes between rows in the file
+    uint64_t offset;        // from the start of the file
+    uint64_t size;          // rows * step
+    uint8_t reserved[24];
+};
+
+static_assert( sizeof(MatContainerHeader) == 64, "MatContainerHeader must stay 64 bytes" );
+static_assert( sizeof(MatContainerEntry) == 128, "MatContainerEntry must stay 128 bytes" );
+
+static const char MAT_CONTAINER_MAGIC[8] = { 'C', 'V', 'M', 'A', 'T', 'S', 0, 0 };
+static const uint32_t MAT_CONTAINER_VERSION = 1;
+static const uint32_t MAT_CONTAINER_ALIGNMENT = 4096;
+
+class MatContainerWriter
+{
+public:
+    // _alignment: a power of two from 16 to 4096
+    explicit MatContainerWriter( uint32_t _alignment = MAT_CONTAINER_ALIGNMENT ) : alignment( _alignment )
+    {
+        CV_Assert( alignment >= 16 && alignment <= MAT_CONTAINER_ALIGNMENT && ( alignment & ( alignment - 1 ) ) == 0 );
+    }
+
+    // the Mat is referenced, not copied, until write()
+    void add( const std::string& name, const cv::Mat& mat )
+    {
+        CV_Assert( !name.empty() && name.size() < sizeof(((MatContainerEntry*)0)->name) && mat.dims <= 2 );
+        names.push_back( name );
+        mats.push_back( mat );
+    }
+
+    bool write( const std::string& path ) const
+    {
+        MatContainerHeader header;
+        memset( &header, 0, sizeof(header) );
+        memcpy( header.magic, MAT_CONTAINER_MAGIC, sizeof(header.magic) );
+        header.version = MAT_CONTAINER_VERSION;
+        header.count = (uint32_t)mats.size();
+        header.alignment = alignment;
+
+        std::vector<MatContainerEntry> entries( mats.size() );
+        uint64_t offset = align( sizeof(header) + entries.size() * sizeof(MatContainerEntry) );
+        for( size_t i = 0; i < mats.size(); i++ )
+        {
+            MatContainerEntry& e = entries[i];
+            memset( &e, 0, sizeof(e) );
+            strncpy( e.name, names[i].c_str(), sizeof(e.name) - 1 );
+            e.rows = mats[i].rows;
+            e.cols = mats[i].cols;
+            e.type = mats[i].type();
+            e.step = mats[i].elemSize() * mats[i].cols;   // stored packed, whatever the source step
+            e.offset = offset;
+            e.size = e.step * e.rows;
+            offset = align( offset + e.size );
+        }
+        header.fileSize = offset;
+
+        FILE* f = fopen( path.c_str(), "wb" );
+        if( !f )
+            return false;
+        bool ok = fwrite( &header, sizeof(header), 1, f ) == 1;
+        ok = ok && ( entries.empty() || fwrite( &entries[0], sizeof(MatContainerEntry), entries.size(), f ) == entries.size() );
+        uint64_t pos = sizeof(header) + entries.size() * sizeof(MatContainerEntry);
+        for( size_t i = 0; ok && i < mats.size(); i++ )
+        {
+            ok = pad( f, entries[i].offset - pos );
+            const cv::Mat& m = mats[i];
+            if( m.isContinuous() )
+                ok = ok && fwrite( m.data, 1, (size_t)entries[i].size, f ) == entries[i].size;
+            else
+                for( int r = 0; ok && r < m.rows; r++ )
+                    ok = fwrite( m.ptr( r ), 1, (size_t)entries[i].step, f ) == entries[i].step;
+            pos = entries[i].offset + entries[i].size;
+        }
+        ok = ok && pad( f, header.fileSize - pos );
+        return fclose( f ) == 0 && ok;
+    }
+
+private:
+    uint64_t align( uint64_t offset ) const { return ( offset + alignment - 1 ) & ~(uint64_t)( alignment - 1 ); }
+
+    static bool pad( FILE* f, uint64_t bytes )
+    {
+        static const char zeros[MAT_CONTAINER_ALIGNMENT] = { 0 };
+        return bytes == 0 || fwrite( zeros, 1, (size_t)bytes, f ) == bytes;
+    }
+
+    uint32_t alignment;
+    std::vector<std::string> names;
+    std::vector<cv::Mat> mats;
+};
+
+class MappedMatFile
+{
+public:
+    MappedMatFile() {}
+    explicit MappedMatFile( const std::string& path ) { open( path ); }
+
+    bool open( const std::string& path )
+    {
+        if( !file.open( path ) )
+            return false;
+        size_t length = file.size();
+        const MatContainerHeader* header = (const MatContainerHeader*)file.data();
+        bool ok = length >= sizeof(MatContainerHeader) &&
+                  memcmp( header->magic, MAT_CONTAINER_MAGIC, sizeof(header->magic) ) == 0 &&
+                  header->version == MAT_CONTAINER_VERSION &&
+                  header->fileSize <= length &&
+                  sizeof(MatContainerHeader) + (uint64_t)header->count * sizeof(MatContainerEntry) <= length;
+        for( uint32_t i = 0; ok && i < header->count; i++ )
+        {
+            const MatContainerEntry& e = entries()[i];
+            ok = e.name[sizeof(e.name) - 1] == 0 && e.offset + e.size <= length &&
+                 e.rows >= 0 && e.cols >= 0 && e.step >= (uint64_t)e.cols * CV_ELEM_SIZE( e.type );
+        }
+        if( !ok )
+            close();
+        return ok;
+    }
+
+    void close() { file.close(); }
+
+    bool isOpened() const { return file.isOpened(); }
+    int count() const { return file.isOpened() ? (int)( (const MatContainerHeader*)file.data() )->count : 0; }
+    std::string name( int i ) const { return entries()[i].name; }
+
+    // read only view into the mapping, empty when there is no such entry
+    cv::Mat get( const std::string& name ) const
+    {
+        for( int i = 0; i < count(); i++ )
+            if( name == entries()[i].name )
+                return get( i );
+        return cv::Mat();
+    }
+
+    cv::Mat get( int i ) const
+    {
+        const MatContainerEntry& e = entries()[i];
+        return cv::Mat( e.rows, e.cols, e.type, file.data() + e.offset, (size_t)e.step );
+    }
+
+private:
+    const MatContainerEntry* entries() const { return (const MatContainerEntry*)( file.data() + sizeof(MatContainerHeader) ); }
+
+    MappedFile file;
+
+    MappedMatFile( const MappedMatFile& );
+    MappedMatFile& operator=( const MappedMatFile& );
+};
+
+#endif
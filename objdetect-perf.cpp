@@ -0,0 +1,442 @@
+// Objdetect performance baseline for the samples in this repo.
+//
+//     objdetect-perf run --data=<opencv_extra/testdata> [--cascades=<eye cascade dir>] [--opencl] > run.txt
+//     objdetect-perf compare opencv_perf_objdetect.txt run.txt [--threshold=5]
+//
+// "run" times the kernels the detection samples rely on (face cascades, HOG people
+// detector, eye cascades inside face ROIs, the plate region front end) and prints the
+// results in the format of the OpenCV perf tests, system header included. The face
+// cascade and HOG tests are those of opencv_perf_objdetect, with the same names,
+// inputs from the same testdata tree and the same parameter strings, so that a run
+// with --opencl pairs row by row with opencv_perf_objdetect.txt. The other tests use
+// the sample images of the repo and have names of their own.
+//
+// "compare" pairs the tests of two such dumps by name and parameters and flags a
+// median regression when it is larger than the threshold (percent) and larger than
+// twice the relative stddev of either run. The exit code is the number of regressions.
+
+#include <opencv2/core.hpp>
+#include <opencv2/core/utility.hpp>
+#include <opencv2/core/ocl.hpp>
+#include <opencv2/core/opencl/opencl_info.hpp>
+#include <opencv2/imgproc.hpp>
+#include <opencv2/imgcodecs.hpp>
+#include <opencv2/objdetect.hpp>
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <cstdio>
+#include <cmath>
+#include <map>
+
+using namespace cv;
+using namespace std;
+
+struct PerfResult
+{
+    string name;
+    string value;     // parameter line, "(...)"
+    int samples;
+    double mean, median, stddev;
+};
+
+// ----------------------------------------------------------------------------------
+// timing
+
+static const int MIN_SAMPLES = 10;
+static const int MAX_SAMPLES = 100;
+static const double TIME_BUDGET_MS = 3000;
+
+template<typename Kernel>
+static void runTest( const string& name, const string& value, Kernel kernel )
+{
+    cout << "[ RUN      ] " << name << endl;
+    int64 start = getTickCount();
+
+    kernel();   // warm up: lazy allocations, OpenCL program builds
+
+    vector<double> times;
+    double spent = 0;
+    while( (int)times.size() < MIN_SAMPLES || ( (int)times.size() < MAX_SAMPLES && spent < TIME_BUDGET_MS ) )
+    {
+        int64 t = getTickCount();
+        kernel();
+        if( ocl::useOpenCL() )
+            ocl::finish();
+        double ms = ( getTickCount() - t ) * 1000. / getTickFrequency();
+        times.push_back( ms );
+        spent += ms;
+    }
+
+    sort( times.begin(), times.end() );
+    size_t n = times.size();
+    double mean = 0, var = 0;
+    for( size_t i = 0; i < n; i++ )
+        mean += times[i];
+    mean /= n;
+    for( size_t i = 0; i < n; i++ )
+        var += ( times[i] - mean ) * ( times[i] - mean );
+    double stddev = std::sqrt( var / n );
+    double median = n % 2 ? times[n / 2] : ( times[n / 2 - 1] + times[n / 2] ) * 0.5;
+
+    cout << format( "[ PERFSTAT ]    (samples = %d, mean = %.2f, median = %.2f, stddev = %.2f (%.1f%%))",
+                    (int)n, mean, median, stddev, mean > 0 ? stddev * 100 / mean : 0. ) << endl;
+    if( !value.empty() )
+        cout << "[ VALUE    ]    " << value << endl;
+    cout << "[       OK ] " << name << " (" << cvRound( ( getTickCount() - start ) * 1000. / getTickFrequency() ) << " ms)" << endl;
+}
+
+// ----------------------------------------------------------------------------------
+// system header, same fields as the OpenCV perf tests print
+
+static string buildInfoField( const string& key )
+{
+    istringstream info( getBuildInformation() );
+    string line;
+    while( getline( info, line ) )
+    {
+        size_t pos = line.find( key );
+        if( pos != string::npos )
+        {
+            string value = line.substr( pos + key.size() );
+            value.erase( 0, value.find_first_not_of( " \t" ) );
+            return value;
+        }
+    }
+    return "unknown";
+}
+
+static void printSystemInfo()
+{
+    static const struct { int id; const char* name; } features[] =
+    {
+        { CV_CPU_MMX, "mmx" }, { CV_CPU_SSE, "sse" }, { CV_CPU_SSE2, "sse2" }, { CV_CPU_SSE3, "sse3" },
+        { CV_CPU_SSSE3, "ssse3" }, { CV_CPU_SSE4_1, "sse4.1" }, { CV_CPU_SSE4_2, "sse4.2" }, { CV_CPU_POPCNT, "popcnt" },
+        { CV_CPU_AVX, "avx" }, { CV_CPU_AVX2, "avx2" }, { CV_CPU_FMA3, "fma3" }, { CV_CPU_NEON, "neon" }
+    };
+
+    cout << "OpenCV version: " << CV_VERSION << endl;
+    cout << "OpenCV VCS version: " << buildInfoField( "Version control:" ) << endl;
+#ifdef _DEBUG
+    cout << "Build type: debug" << endl;
+#else
+    cout << "Build type: release" << endl;
+#endif
+    cout << "Parallel framework: " << buildInfoField( "Parallel framework:" ) << endl;
+    cout << "CPU features:";
+    for( size_t i = 0; i < sizeof(features) / sizeof(features[0]); i++ )
+        if( checkHardwareSupport( features[i].id ) )
+            cout << " " << features[i].name;
+    cout << endl;
+    cout.flush();
+    dumpOpenCLInformation();   // prints through printf
+    fflush( stdout );
+}
+
+// ----------------------------------------------------------------------------------
+// kernels
+
+// as Cascade_Image_MinSize of opencv_perf_objdetect: paths relative to the testdata root
+static void runCascadeTests( const string& data, const string& prefix, bool opencl )
+{
+    const char* cascades[] = { "cv/cascadeandhog/cascades/haarcascade_frontalface_alt.xml",
+                               "cv/cascadeandhog/cascades/haarcascade_frontalface_alt2.xml",
+                               "cv/cascadeandhog/cascades/lbpcascade_frontalface.xml" };
+    const char* images[] = { "cv/shared/lena.png", "cv/cascadeandhog/images/bttf301.png", "cv/cascadeandhog/images/class57.png" };
+    const int minSizes[] = { 30, 64, 90 };
+
+    int index = 0;
+    for( int c = 0; c < 3; c++ )
+    {
+        CascadeClassifier cascade;
+        if( !cascade.load( data + cascades[c] ) )
+        {
+            cerr << "skipping " << cascades[c] << ": cannot load it from '" << data << "'" << endl;
+            index += 9;
+            continue;
+        }
+        for( int i = 0; i < 3; i++ )
+        {
+            Mat img = imread( data + images[i], IMREAD_GRAYSCALE );
+            if( img.empty() )
+            {
+                cerr << "skipping " << images[i] << endl;
+                index += 3;
+                continue;
+            }
+            equalizeHist( img, img );
+            UMat uimg = img.getUMat( ACCESS_READ );
+            for( int m = 0; m < 3; m++, index++ )
+            {
+                vector<Rect> faces;
+                Size minSize( minSizes[m], minSizes[m] );
+                runTest( format( "%sCascade_Image_MinSize_CascadeClassifier.CascadeClassifier/%d", prefix.c_str(), index ),
+                         format( "(\"%s\", \"%s\", %d)", cascades[c], images[i], minSizes[m] ),
+                         [&]() {
+                             if( opencl )
+                                 cascade.detectMultiScale( uimg, faces, 1.1, 3, 0, minSize );
+                             else
+                                 cascade.detectMultiScale( img, faces, 1.1, 3, 0, minSize );
+                         } );
+            }
+        }
+    }
+}
+
+static void runHogTests( const string& data, const string& prefix, bool opencl )
+{
+    HOGDescriptor hog;
+    hog.setSVMDetector( HOGDescriptor::getDefaultPeopleDetector() );
+
+    // as HOGFixture_HOG of opencv_perf_objdetect, which has no parameters
+    Mat road = imread( data + "gpu/hog/road.png", IMREAD_GRAYSCALE );
+    if( road.empty() )
+        cerr << "skipping HOGFixture_HOG: no gpu/hog/road.png in '" << data << "'" << endl;
+    else
+    {
+        UMat uroad = road.getUMat( ACCESS_READ );
+        vector<Rect> found;
+        runTest( prefix + "HOGFixture_HOG.HOG", "",
+                 [&]() {
+                     if( opencl )
+                         hog.detectMultiScale( uroad, found );
+                     else
+                         hog.detectMultiScale( road, found );
+                 } );
+    }
+
+    // the images of the samples
+    const char* images[] = { "scene2.jpg", "right07.jpg" };
+    for( int i = 0; i < 2; i++ )
+    {
+        Mat img = imread( images[i], IMREAD_GRAYSCALE );
+        if( img.empty() )
+        {
+            cerr << "skipping " << images[i] << endl;
+            continue;
+        }
+        UMat uimg = img.getUMat( ACCESS_READ );
+        vector<Rect> found;
+        runTest( format( "%sHOG_SampleImages.HOG/%d", prefix.c_str(), i ), format( "(\"%s\")", images[i] ),
+                 [&]() {
+                     if( opencl )
+                         hog.detectMultiScale( uimg, found );
+                     else
+                         hog.detectMultiScale( img, found );
+                 } );
+    }
+}
+
+// face_eye_detection_sample.cpp: eyes are searched in the upper half of each face
+static void runEyeTests( const string& data, const string& eyeDir, const string& prefix, bool opencl )
+{
+    const char* eyeCascades[] = { "haarcascade_eye.xml", "haarcascade_eye_tree_eyeglasses.xml", "haarcascade_mcs_lefteye.xml" };
+    CascadeClassifier face;
+    Mat img = imread( "lena.jpg", IMREAD_GRAYSCALE );
+    if( !face.load( data + "cv/cascadeandhog/cascades/lbpcascade_frontalface.xml" ) || img.empty() )
+    {
+        cerr << "skipping eye tests: no face cascade or lena.jpg" << endl;
+        return;
+    }
+    equalizeHist( img, img );
+    vector<Rect> faces;
+    face.detectMultiScale( img, faces, 1.1, 3, 0, Size( 64, 64 ) );
+
+    for( int c = 0; c < 3; c++ )
+    {
+        CascadeClassifier eyes;
+        if( !eyes.load( eyeDir + eyeCascades[c] ) )
+        {
+            cerr << "skipping " << eyeCascades[c] << endl;
+            continue;
+        }
+        UMat uimg = img.getUMat( ACCESS_READ );
+        vector<Rect> found;
+        runTest( format( "%sEyes_InFaceROI.CascadeClassifier/%d", prefix.c_str(), c ),
+                 format( "(\"%s\", \"lena.jpg\", %d)", eyeCascades[c], (int)faces.size() ),
+                 [&]() {
+                     for( size_t f = 0; f < faces.size(); f++ )
+                     {
+                         Rect top( faces[f].x, faces[f].y, faces[f].width, faces[f].height / 2 );
+                         if( opencl )
+                             eyes.detectMultiScale( uimg( top ), found, 1.1, 3, 0, Size( 20, 20 ) );
+                         else
+                             eyes.detectMultiScale( img( top ), found, 1.1, 3, 0, Size( 20, 20 ) );
+                     }
+                 } );
+    }
+}
+
+// front end of DetectRegions::segment in licence-plate.cpp over the plate crops, CPU only
+static void runPlateTests()
+{
+    vector<String> files;
+    glob( "MasteringOpenCV-Chapter5_NumberPlateRecognition/pos/*.jpg", files, false );
+    vector<Mat> plates;
+    for( size_t i = 0; i < files.size(); i++ )
+    {
+        Mat img = imread( files[i], IMREAD_GRAYSCALE );
+        if( !img.empty() )
+            plates.push_back( img );
+    }
+    if( plates.empty() )
+    {
+        cerr << "skipping plate tests: no images" << endl;
+        return;
+    }
+
+    Mat element = getStructuringElement( MORPH_RECT, Size( 17, 3 ) );
+    Mat blurred, sobel, thresholded;
+    runTest( "Plate_SegmentFrontEnd.DetectRegions/0", format( "(\"pos/*.jpg\", %d)", (int)plates.size() ),
+             [&]() {
+                 for( size_t i = 0; i < plates.size(); i++ )
+                 {
+                     blur( plates[i], blurred, Size( 5, 5 ) );
+                     Sobel( blurred, sobel, CV_8U, 1, 0, 3, 1, 0, BORDER_DEFAULT );
+                     threshold( sobel, thresholded, 0, 255, THRESH_OTSU + THRESH_BINARY );
+                     morphologyEx( thresholded, thresholded, MORPH_CLOSE, element );
+                     vector<vector<Point> > contours;
+                     findContours( thresholded, contours, RETR_EXTERNAL, CHAIN_APPROX_NONE );
+                 }
+             } );
+}
+
+// ----------------------------------------------------------------------------------
+// parsing and comparing dumps
+
+static bool readResults( const string& path, vector<PerfResult>& results )
+{
+    ifstream in( path.c_str() );
+    if( !in.is_open() )
+        return false;
+
+    string line;
+    PerfResult current;
+    bool open = false;
+    while( getline( in, line ) )
+    {
+        if( line.compare( 0, 13, "[ RUN      ] " ) == 0 )
+        {
+            current = PerfResult();
+            current.name = line.substr( 13 );
+            open = true;
+        }
+        else if( open && line.compare( 0, 12, "[ PERFSTAT ]" ) == 0 )
+        {
+            sscanf( line.c_str(), "[ PERFSTAT ] (samples = %d, mean = %lf, median = %lf, stddev = %lf",
+                    &current.samples, &current.mean, &current.median, &current.stddev );
+        }
+        else if( open && line.compare( 0, 12, "[ VALUE    ]" ) == 0 )
+        {
+            size_t pos = line.find( '(' );
+            current.value = pos == string::npos ? string() : line.substr( pos );
+        }
+        else if( open && line.compare( 0, 12, "[       OK ]" ) == 0 )
+        {
+            results.push_back( current );
+            open = false;
+        }
+        else if( line.compare( 0, 12, "[  FAILED  ]" ) == 0 )
+            open = false;
+    }
+    return true;
+}
+
+static int compareResults( const string& basePath, const string& newPath, double threshold )
+{
+    vector<PerfResult> base, current;
+    if( !readResults( basePath, base ) || !readResults( newPath, current ) )
+    {
+        cerr << "cannot read " << basePath << " or " << newPath << endl;
+        return -1;
+    }
+
+    map<string, const PerfResult*> byKey;
+    for( size_t i = 0; i < base.size(); i++ )
+        byKey[base[i].name + " " + base[i].value] = &base[i];
+
+    int regressions = 0, matched = 0;
+    cout << left << setw(72) << "test" << right << setw(10) << "base" << setw(10) << "new" << setw(10) << "delta" << endl;
+    for( size_t i = 0; i < current.size(); i++ )
+    {
+        const PerfResult& n = current[i];
+        map<string, const PerfResult*>::iterator it = byKey.find( n.name + " " + n.value );
+        if( it == byKey.end() )
+        {
+            cout << left << setw(72) << n.name << right << setw(10) << "-" << setw(10) << fixed << setprecision(2) << n.median << "  new test" << endl;
+            continue;
+        }
+        const PerfResult& b = *it->second;
+        byKey.erase( it );
+        matched++;
+
+        double delta = b.median > 0 ? ( n.median - b.median ) / b.median : 0;
+        double noise = std::max( threshold / 100, 2 * std::max( b.mean > 0 ? b.stddev / b.mean : 0, n.mean > 0 ? n.stddev / n.mean : 0 ) );
+        const char* verdict = delta > noise ? "  REGRESSION" : delta < -noise ? "  faster" : "";
+        if( delta > noise )
+            regressions++;
+
+        cout << left << setw(72) << ( n.name + " " + n.value ).substr( 0, 71 ) << right << fixed << setprecision(2)
+             << setw(10) << b.median << setw(10) << n.median << setw(9) << delta * 100 << "%" << verdict << endl;
+    }
+    for( map<string, const PerfResult*>::iterator it = byKey.begin(); it != byKey.end(); ++it )
+        cout << left << setw(72) << it->second->name << right << setw(10) << fixed << setprecision(2) << it->second->median << setw(10) << "-" << "  missing" << endl;
+
+    cout << matched << " tests compared, " << regressions << " regressions (threshold " << threshold << "%)" << endl;
+    return regressions;
+}
+
+// ----------------------------------------------------------------------------------
+
+int main( int argc, char** argv )
+{
+    string mode = argc > 1 ? argv[1] : "";
+    if( mode == "compare" && argc >= 4 )
+    {
+        double threshold = 5;
+        if( argc > 4 && string( argv[4] ).compare( 0, 12, "--threshold=" ) == 0 )
+            threshold = atof( argv[4] + 12 );
+        return compareResults( argv[2], argv[3], threshold );
+    }
+    if( mode != "run" )
+    {
+        cout << "usage: objdetect-perf run --data=<opencv_extra/testdata> [--cascades=<eye cascade dir>] [--opencl]" << endl
+             << "       objdetect-perf compare base.txt new.txt [--threshold=5]" << endl;
+        return -1;
+    }
+
+    string data, eyeDir;
+    bool opencl = false;
+    for( int i = 2; i < argc; i++ )
+    {
+        string arg = argv[i];
+        string* dir = arg.compare( 0, 7, "--data=" ) == 0 ? &data : arg.compare( 0, 11, "--cascades=" ) == 0 ? &eyeDir : 0;
+        if( dir )
+        {
+            *dir = arg.substr( arg.find( '=' ) + 1 );
+            if( !dir->empty() && (*dir)[dir->size() - 1] != '/' && (*dir)[dir->size() - 1] != '\\' )
+                *dir += '/';
+        }
+        else if( arg == "--opencl" )
+            opencl = true;
+    }
+    // the eye cascades ship with OpenCV (data/haarcascades), not with the testdata
+    if( eyeDir.empty() )
+        eyeDir = data;
+    opencl = opencl && ocl::haveOpenCL();
+    ocl::setUseOpenCL( opencl );
+
+    // same prefix convention as opencv_perf_objdetect: OCL_ tests take UMat inputs
+    string prefix = opencl ? "OCL_" : "";
+
+    printSystemInfo();
+    cout << "[==========] Running objdetect sample benchmarks" << endl;
+    runCascadeTests( data, prefix, opencl );
+    runHogTests( data, prefix, opencl );
+    runEyeTests( data, eyeDir, prefix, opencl );
+    runPlateTests();   // Mat only, no OpenCL variant
+    cout << "[==========] done" << endl;
+    return 0;
+}
@@ -3,6 +3,7 @@
 #include "opencv2/highgui.hpp"
 #include "opencv2/videoio.hpp"
 #include <iostream>
+#include "test_patterns.hpp"
 
 using namespace cv;
 using namespace std;
@@ -14,20 +15,20 @@ int main()
 
     int blockSize = 75;
     int imageSize = blockSize * 8;
-    Mat chessBoard(imageSize, imageSize, CV_8UC3, Scalar::all(0));
-    unsigned char color = 0;
-
-    for (int i = 0; i<imageSize; i = i + blockSize)
-    {
-        color = ~color;
-        for (int j = 0; j<imageSize; j = j + blockSize)
-        {
-            Mat ROI = chessBoard(Rect(i, j, blockSize, blockSize));
-            ROI.setTo(Scalar::all(color));
-            color = ~color;
-        }
-    }
+    Mat chessBoard;
+    testpattern::chessboard(chessBoard, Size(imageSize, imageSize), CV_8UC3, blockSize);
     imshow("Chess board", chessBoard);
+
+    // the other patterns, at any size, the same on every run
+    Mat pattern;
+    testpattern::circlesGrid(pattern, Size(640, 480), CV_8UC1, Size(4, 11), 40, 10, true);
+    imshow("Circles grid", pattern);
+    testpattern::colorBars(pattern, Size(640, 480), CV_8UC3);
+    imshow("Colour bars", pattern);
+    testpattern::gradient(pattern, Size(640, 480), CV_8UC1);
+    imshow("Gradient", pattern);
+    testpattern::noise(pattern, Size(640, 480), CV_8UC3, 42);
+    imshow("Noise", pattern);
     waitKey();
     return 0;
 }
@@ -0,0 +1,179 @@
+// A few colour palette fitted on a sample of the pixels, applied through a lookup table.
+//
+//     PaletteQuantizer q( 3 );           // 3 colours
+//     q.fit( image );                    // k-means on 20000 random pixels
+//     Mat labels, colors;
+//     q.apply( image, labels, colors );  // label per pixel, CV_8UC1; and the palette colour
+//     ...
+//     q.refit( nextFrame );              // video: a few k-means steps from the last palette
+//
+// k-means runs on a random subsample, so fitting costs the same for a 12 MP photograph
+// as for a thumbnail. The palette is then turned into a table from BGR, 5 bits per
+// channel, to the label of the nearest palette colour at the centre of each cell, and
+// the image is labelled in one parallel pass of one table read per pixel. The error of
+// the table is at most half a cell, 4 levels per channel, and only shows on pixels
+// almost halfway between two colours. Labels are sorted by the brightness of their
+// colour, so they keep their meaning from one fit to the next.
+
+#ifndef PALETTE_QUANTIZER_HPP
+#define PALETTE_QUANTIZER_HPP
+
+#include <opencv2/core.hpp>
+#include <opencv2/core/utility.hpp>
+#include <algorithm>
+#include <climits>
+#include <vector>
+
+namespace palette
+{
+
+enum { BITS = 5, SHIFT = 8 - BITS };
+
+inline int cell( const uchar* p )
+{
+    return ( p[0] >> SHIFT ) << ( 2 * BITS ) | ( p[1] >> SHIFT ) << BITS | p[2] >> SHIFT;
+}
+
+class ApplyBody : public cv::ParallelLoopBody
+{
+public:
+    ApplyBody( const cv::Mat& _src, cv::Mat& _labels, cv::Mat* _colors, const std::vector<uchar>& _lut,
+               const std::vector<cv::Vec3b>& _palette )
+        : src( _src ), labels( _labels ), colors( _colors ), lut( _lut ), palette( _palette ) {}
+
+    void operator()( const cv::Range& range ) const
+    {
+        for( int y = range.start; y < range.end; y++ )
+        {
+            const uchar* s = src.ptr<uchar>( y );
+            uchar* l = labels.ptr<uchar>( y );
+            for( int x = 0; x < src.cols; x++ )
+                l[x] = lut[cell( s + x * 3 )];
+            if( colors )
+            {
+                cv::Vec3b* c = colors->ptr<cv::Vec3b>( y );
+                for( int x = 0; x < src.cols; x++ )
+                    c[x] = palette[l[x]];
+            }
+        }
+    }
+
+private:
+    const cv::Mat& src;
+    cv::Mat& labels;
+    cv::Mat* colors;
+    const std::vector<uchar>& lut;
+    const std::vector<cv::Vec3b>& palette;
+};
+
+}
+
+class PaletteQuantizer
+{
+public:
+    // k: colours, up to 256; samples: pixels k-means sees
+    explicit PaletteQuantizer( int _k, int _samples = 20000 ) : k( _k ), samples( _samples )
+    {
+        CV_Assert( k >= 1 && k <= 256 && samples >= k );
+    }
+
+    // a new palette of src, CV_8UC3
+    void fit( const cv::Mat& src ) { fitPalette( src, false ); }
+
+    // the palette moved to the colours of src, from the last one; fit() when there is none
+    void refit( const cv::Mat& src ) { fitPalette( src, !paletteColors.empty() ); }
+
+    bool empty() const { return paletteColors.empty(); }
+    const std::vector<cv::Vec3b>& colors() const { return paletteColors; }
+
+    // any palette, e.g. one saved from an earlier fit
+    void setPalette( const std::vector<cv::Vec3b>& p )
+    {
+        CV_Assert( !p.empty() && p.size() <= 256 );
+        paletteColors = p;
+        buildTable();
+    }
+
+    // labels: CV_8UC1 index into colors(); colors: the palette colour of every pixel
+    void apply( const cv::Mat& src, cv::Mat& labels ) const { run( src, labels, 0 ); }
+    void apply( const cv::Mat& src, cv::Mat& labels, cv::Mat& quantized ) const { run( src, labels, &quantized ); }
+
+private:
+    void fitPalette( const cv::Mat& src, bool fromLast )
+    {
+        CV_Assert( src.type() == CV_8UC3 && !src.empty() );
+        int n = (int)std::min( (size_t)samples, src.total() );
+        cv::Mat data( n, 3, CV_32F ), labels( n, 1, CV_32S ), centers;
+        cv::RNG rng( 0x5eed );
+        for( int i = 0; i < n; i++ )
+        {
+            // all pixels when there are few, otherwise a random sample
+            int j = n == (int)src.total() ? i : rng.uniform( 0, (int)src.total() );
+            const uchar* p = src.ptr<uchar>( j / src.cols ) + ( j % src.cols ) * 3;
+            float* d = data.ptr<float>( i );
+            d[0] = p[0]; d[1] = p[1]; d[2] = p[2];
+            if( fromLast )
+                labels.at<int>( i ) = lut[palette::cell( p )];
+        }
+        int kk = std::min( k, n );
+        cv::TermCriteria crit( cv::TermCriteria::EPS + cv::TermCriteria::COUNT, fromLast ? 5 : 20, 1.0 );
+        if( fromLast && (int)paletteColors.size() == kk )
+            cv::kmeans( data, kk, labels, crit, 1, cv::KMEANS_USE_INITIAL_LABELS, centers );
+        else
+            cv::kmeans( data, kk, labels, crit, 3, cv::KMEANS_PP_CENTERS, centers );
+
+        std::vector<cv::Vec3b> p( kk );
+        for( int i = 0; i < kk; i++ )
+        {
+            const float* c = centers.ptr<float>( i );
+            p[i] = cv::Vec3b( cv::saturate_cast<uchar>( c[0] ), cv::saturate_cast<uchar>( c[1] ), cv::saturate_cast<uchar>( c[2] ) );
+        }
+        std::sort( p.begin(), p.end(), []( const cv::Vec3b& a, const cv::Vec3b& b )
+        {
+            return a[0] + 2 * a[1] + a[2] < b[0] + 2 * b[1] + b[2];
+        } );
+        setPalette( p );
+    }
+
+    void buildTable()
+    {
+        const int levels = 1 << palette::BITS, half = 1 << palette::SHIFT >> 1;
+        lut.resize( levels * levels * levels );
+        for( int b = 0; b < levels; b++ )
+            for( int g = 0; g < levels; g++ )
+                for( int r = 0; r < levels; r++ )
+                {
+                    int cb = ( b << palette::SHIFT ) + half, cg = ( g << palette::SHIFT ) + half, cr = ( r << palette::SHIFT ) + half;
+                    int best = 0, bestDist = INT_MAX;
+                    for( size_t i = 0; i < paletteColors.size(); i++ )
+                    {
+                        const cv::Vec3b& c = paletteColors[i];
+                        int d = ( cb - c[0] ) * ( cb - c[0] ) + ( cg - c[1] ) * ( cg - c[1] ) + ( cr - c[2] ) * ( cr - c[2] );
+                        if( d < bestDist )
+                        {
+                            bestDist = d;
+                            best = (int)i;
+                        }
+                    }
+                    lut[b << ( 2 * palette::BITS ) | g << palette::BITS | r] = (uchar)best;
+                }
+    }
+
+    void run( const cv::Mat& src, cv::Mat& labels, cv::Mat* quantized ) const
+    {
+        CV_Assert( src.type() == CV_8UC3 && !paletteColors.empty() );
+        // fresh outputs have no data yet: only buffers really shared are aliases
+        CV_Assert( !labels.data || ( labels.data != src.data && ( !quantized || quantized->data != labels.data ) ) );
+        labels.create( src.size(), CV_8UC1 );
+        if( quantized )
+            quantized->create( src.size(), CV_8UC3 );
+        cv::parallel_for_( cv::Range( 0, src.rows ), palette::ApplyBody( src, labels, quantized, lut, paletteColors ),
+                           std::max( 1.0, src.total() / (double)( 1 << 16 ) ) );
+    }
+
+    int k, samples;
+    std::vector<cv::Vec3b> paletteColors;
+    std::vector<uchar> lut;
+};
+
+#endif
@@ -0,0 +1,248 @@
+// Stable identities for people detections, between and across detector runs.
+//
+//     PeopleTracker tracker;
+//     for( ;; )
+//     {
+//         tracker.predict();                          // every frame, detector run or not
+//         if( run_detector )
+//             tracker.update( found, searched, frame.size() );   // searched: where the detector looked
+//         for( const PeopleTracker::Track& t : tracker.tracks() )
+//             draw( t.box, t.id, t.confirmed );
+//     }
+//     tracker.peopleSeen();                          // confirmed identities so far
+//
+// Every track is a constant velocity Kalman filter on the centre and size of its box,
+// so between detector runs the boxes keep moving with the people. Detections are
+// matched to the predicted boxes through a spatial hash: the tracks are entered in the
+// grid cells their boxes cover, and a detection is only compared (IoU) with the tracks
+// of its own cells, which keeps association linear in the number of boxes instead of
+// comparing every pair. Candidate pairs are then taken best first, one detection per
+// track.
+//
+// A track starts tentative and is confirmed after confirmHits matches; it is dropped
+// after maxMisses detector runs in a row that looked at it and found nothing (a
+// tentative track at its first miss). update() only counts a miss for the tracks in
+// the searched rects, so the detector can run on part of the frame, e.g. on the
+// unconfirmed tracks only, without losing the others. Whatever was searched, a track
+// is also dropped when its box has left the frame and when it has coasted maxCoast
+// frames without a match, so someone walking out of view does not leave a box that
+// drifts on forever.
+
+#ifndef PEOPLE_TRACKER_HPP
+#define PEOPLE_TRACKER_HPP
+
+#include <opencv2/core/core.hpp>
+#include <opencv2/video/tracking.hpp>
+#include <algorithm>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+class PeopleTracker
+{
+public:
+    struct Track
+    {
+        int id;             // 0 until confirmed, then unique
+        cv::Rect box;       // predicted, or corrected by the last match
+        bool confirmed;
+        int hits;           // matches
+        int misses;         // searched detector runs without a match, in a row
+        int sinceHit;       // frames since the last match
+        cv::KalmanFilter kf;
+    };
+
+    PeopleTracker( int _confirmHits = 3, int _maxMisses = 3, double _minIou = 0.3, int _cellSize = 64, int _maxCoast = 30 )
+        : confirmHits( _confirmHits ), maxMisses( _maxMisses ), minIou( _minIou ), cellSize( _cellSize ),
+          maxCoast( _maxCoast ), nextId( 1 ) {}
+
+    const std::vector<Track>& tracks() const { return active; }
+    int peopleSeen() const { return nextId - 1; }
+
+    void clear()
+    {
+        active.clear();
+        nextId = 1;
+    }
+
+    // one frame ahead
+    void predict()
+    {
+        for( size_t i = 0; i < active.size(); i++ )
+        {
+            active[i].box = toRect( active[i].kf.predict() );
+            active[i].sinceHit++;
+        }
+    }
+
+    // detections of this frame, of size frameSize, found in the searched rects
+    void update( const std::vector<cv::Rect>& found, const std::vector<cv::Rect>& searched, cv::Size frameSize )
+    {
+        std::vector<int> trackOf( found.size(), -1 ), matched( active.size(), 0 );
+        associate( found, trackOf );
+
+        for( size_t d = 0; d < found.size(); d++ )
+        {
+            if( trackOf[d] < 0 )
+            {
+                active.push_back( Track() );
+                start( active.back(), found[d] );
+                continue;
+            }
+            Track& t = active[trackOf[d]];
+            matched[trackOf[d]] = 1;
+            t.box = toRect( t.kf.correct( measurement( found[d] ) ) );
+            t.misses = 0;
+            t.sinceHit = 0;
+            if( ++t.hits >= confirmHits && !t.confirmed )
+            {
+                t.confirmed = true;
+                t.id = nextId++;
+            }
+        }
+
+        // new tracks are past the end of matched
+        size_t kept = 0;
+        cv::Rect frame( cv::Point(), frameSize );
+        for( size_t i = 0; i < active.size(); i++ )
+        {
+            Track& t = active[i];
+            if( i < matched.size() && !matched[i] && inside( t.box, searched ) )
+                t.misses++;
+            if( t.misses > ( t.confirmed ? maxMisses - 1 : 0 ) || t.sinceHit > maxCoast || !inside( t.box, frame ) )
+                continue;
+            if( kept != i )
+                std::swap( active[kept], t );
+            kept++;
+        }
+        active.resize( kept );
+    }
+
+private:
+    typedef long long CellKey;
+
+    // cy is negative for predicted boxes above the frame: multiplied, since shifting it is undefined
+    CellKey key( int cx, int cy ) const { return (CellKey)cy * ( 1LL << 32 ) ^ (unsigned)cx; }
+
+    // calls f( key ) for every cell r covers
+    template<typename F> void forCells( const cv::Rect& r, const F& f ) const
+    {
+        int x0 = cvFloor( (double)r.x / cellSize ), x1 = cvFloor( (double)( r.br().x - 1 ) / cellSize );
+        int y0 = cvFloor( (double)r.y / cellSize ), y1 = cvFloor( (double)( r.br().y - 1 ) / cellSize );
+        for( int cy = y0; cy <= y1; cy++ )
+            for( int cx = x0; cx <= x1; cx++ )
+                f( key( cx, cy ) );
+    }
+
+    // trackOf[d]: the track matched to found[d], -1 for none
+    void associate( const std::vector<cv::Rect>& found, std::vector<int>& trackOf )
+    {
+        grid.clear();
+        for( size_t i = 0; i < active.size(); i++ )
+            forCells( active[i].box, [&]( CellKey k ) { grid[k].push_back( (int)i ); } );
+
+        // ( IoU, detection, track ) of every close pair, each pair once
+        std::vector<std::pair<double, std::pair<int, int> > > pairs;
+        std::vector<int> seen( active.size(), -1 );
+        for( size_t d = 0; d < found.size(); d++ )
+            forCells( found[d], [&]( CellKey k )
+            {
+                std::unordered_map<CellKey, std::vector<int> >::const_iterator cell = grid.find( k );
+                if( cell == grid.end() )
+                    return;
+                for( size_t j = 0; j < cell->second.size(); j++ )
+                {
+                    int t = cell->second[j];
+                    if( seen[t] == (int)d )
+                        continue;
+                    seen[t] = (int)d;
+                    double iou = overlap( found[d], active[t].box );
+                    if( iou >= minIou )
+                        pairs.push_back( std::make_pair( iou, std::make_pair( (int)d, t ) ) );
+                }
+            } );
+
+        std::sort( pairs.begin(), pairs.end(), []( const std::pair<double, std::pair<int, int> >& a,
+                                                   const std::pair<double, std::pair<int, int> >& b ) { return a.first > b.first; } );
+        std::vector<int> taken( active.size(), 0 );
+        for( size_t i = 0; i < pairs.size(); i++ )
+        {
+            int d = pairs[i].second.first, t = pairs[i].second.second;
+            if( trackOf[d] >= 0 || taken[t] )
+                continue;
+            trackOf[d] = t;
+            taken[t] = 1;
+        }
+    }
+
+    void start( Track& t, const cv::Rect& r )
+    {
+        t.id = 0;
+        t.box = r;
+        t.confirmed = confirmHits <= 1;
+        t.hits = 1;
+        t.misses = 0;
+        t.sinceHit = 0;
+        // state: cx, cy, w, h and their velocities, in pixels per frame
+        t.kf.init( 8, 4, 0, CV_32F );
+        cv::setIdentity( t.kf.transitionMatrix );
+        for( int i = 0; i < 4; i++ )
+            t.kf.transitionMatrix.at<float>( i, i + 4 ) = 1;
+        cv::setIdentity( t.kf.measurementMatrix );
+        cv::setIdentity( t.kf.processNoiseCov( cv::Rect( 0, 0, 4, 4 ) ), cv::Scalar::all( 4 ) );
+        cv::setIdentity( t.kf.processNoiseCov( cv::Rect( 4, 4, 4, 4 ) ), cv::Scalar::all( 0.25 ) );
+        cv::setIdentity( t.kf.measurementNoiseCov, cv::Scalar::all( 16 ) );
+        // unknown velocity at the start
+        cv::setIdentity( t.kf.errorCovPost( cv::Rect( 0, 0, 4, 4 ) ), cv::Scalar::all( 16 ) );
+        cv::setIdentity( t.kf.errorCovPost( cv::Rect( 4, 4, 4, 4 ) ), cv::Scalar::all( 100 ) );
+        cv::Mat m = measurement( r );
+        m.copyTo( t.kf.statePost.rowRange( 0, 4 ) );
+        t.kf.statePost.rowRange( 4, 8 ).setTo( 0 );
+        if( t.confirmed )
+            t.id = nextId++;
+    }
+
+    static cv::Mat measurement( const cv::Rect& r )
+    {
+        return ( cv::Mat_<float>( 4, 1 ) << r.x + r.width * 0.5f, r.y + r.height * 0.5f, (float)r.width, (float)r.height );
+    }
+
+    static cv::Rect toRect( const cv::Mat& state )
+    {
+        float cx = state.at<float>( 0 ), cy = state.at<float>( 1 );
+        float w = std::max( state.at<float>( 2 ), 1.f ), h = std::max( state.at<float>( 3 ), 1.f );
+        return cv::Rect( cvRound( cx - w * 0.5f ), cvRound( cy - h * 0.5f ), cvRound( w ), cvRound( h ) );
+    }
+
+    static double overlap( const cv::Rect& a, const cv::Rect& b )
+    {
+        double inter = ( a & b ).area();
+        return inter > 0 ? inter / ( a.area() + b.area() - inter ) : 0;
+    }
+
+    // the centre of r in rect
+    static bool inside( const cv::Rect& r, const cv::Rect& rect )
+    {
+        return rect.contains( cv::Point( r.x + r.width / 2, r.y + r.height / 2 ) );
+    }
+
+    // the centre of r in one of the rects
+    static bool inside( const cv::Rect& r, const std::vector<cv::Rect>& rects )
+    {
+        cv::Point c( r.x + r.width / 2, r.y + r.height / 2 );
+        for( size_t i = 0; i < rects.size(); i++ )
+            if( rects[i].contains( c ) )
+                return true;
+        return false;
+    }
+
+    int confirmHits, maxMisses;
+    double minIou;
+    int cellSize;
+    int maxCoast;
+    int nextId;
+    std::vector<Track> active;
+    std::unordered_map<CellKey, std::vector<int> > grid;
+};
+
+#endif
@@ -0,0 +1,15 @@
+#include <opencv2/opencv.hpp>
+#include <opencv2/photo.hpp>
+#define main block_mean_main
+#include "../so22122309.cpp"
+#undef main
+#include "perf_samples.hpp"
+
+static void blockMeanVariance( const Mat& src, Mat& dst )
+{
+    Mat img;
+    src.convertTo( img, CV_32F, 1.0 / 255.0 );
+    CalcBlockMeanVariance( img, dst );
+}
+
+PERF_CASE( CalcBlockMeanVariance, "scene2.jpg", IMREAD_GRAYSCALE, blockMeanVariance )
@@ -0,0 +1,13 @@
+#include <opencv2/opencv.hpp>
+#include <opencv2/core/hal/intrin.hpp>
+#define main blurriness_main
+#include "../5395-how-to-calculate-blurriness-and-sharpness-of-a-given-image.cpp"
+#undef main
+#include "perf_samples.hpp"
+
+static void blurriness( const Mat& src, Mat& dst )
+{
+    dst = Mat( 1, 1, CV_32F, Scalar( calcBlurriness( src ) ) );
+}
+
+PERF_CASE( calcBlurriness, "lena.jpg", IMREAD_COLOR, blurriness )
@@ -0,0 +1,15 @@
+#include <opencv2/opencv.hpp>
+#define main find_squares_main
+#include "../so36250677.cpp"
+#undef main
+#include "perf_samples.hpp"
+
+// findSquares erodes its input in place, so it gets a copy; dst holds the rects, CV_32SC4
+static void squares( const Mat& src, Mat& dst )
+{
+    vector<Rect> found;
+    findSquares( src.clone(), found );
+    dst = found.empty() ? Mat( 1, 1, CV_32SC4, Scalar::all( 0 ) ) : Mat( found, true );
+}
+
+PERF_CASE( findSquares, "scene2.jpg", IMREAD_COLOR, squares )
@@ -0,0 +1,32 @@
+#include <opencv2/opencv.hpp>
+#define main hist_match_main
+#define BTM_NO_DEBUG   // no windows, no waitKey
+#include "../90288-histMatchRGB.cpp"
+#undef main
+#include "../image_cache.hpp"
+#include "perf_samples.hpp"
+
+// every frame matched to fruits.jpg, as in the sample; the reference follows the frame size
+static const Mat& reference( Size size )
+{
+    static Mat ref;
+    if( ref.size() != size )
+        resize( cachedImread( perf::dataDir() + "/fruits.jpg" ), ref, size, 0, 0, INTER_AREA );
+    return ref;
+}
+
+static void histMatch( const Mat& src, Mat& dst )
+{
+    Mat mask( src.size(), CV_8U, Scalar( 255 ) );
+    src.copyTo( dst );
+    histMatchRGB( dst, mask, reference( src.size() ), mask );
+}
+
+static void histMatcher( const Mat& src, Mat& dst )
+{
+    HistMatcher matcher( reference( src.size() ) );
+    matcher.apply( src, dst );
+}
+
+PERF_CASE( histMatchRGB, "lena.jpg", IMREAD_COLOR, histMatch )
+PERF_VARIANT( histMatchRGB, "HistMatcher", histMatcher )
@@ -0,0 +1,16 @@
+#include <opencv2/opencv.hpp>
+#define main mosaic_main
+#include "../71203.cpp"
+#undef main
+#include "perf_samples.hpp"
+
+// the whole frame pixelated in 10 pixel blocks, the integral image included
+static void mosaic( const Mat& src, Mat& dst )
+{
+    Mat sum;
+    integral( src, sum, CV_32S );
+    src.copyTo( dst );
+    doMosaic( sum, dst, Rect( 0, 0, dst.cols, dst.rows ), 10 );
+}
+
+PERF_CASE( doMosaic, "fruits.jpg", IMREAD_COLOR, mosaic )
@@ -0,0 +1,22 @@
+#include <opencv2/opencv.hpp>
+#include <opencv2/core/hal/intrin.hpp>
+#define main nonlocal_means_main
+#include "../Non-local-Means-Filter.cpp"
+#undef main
+#include "perf_samples.hpp"
+
+// 3x3 templates in a 7x7 search window, h = sigma = 15 as in the sample
+static void nonlocalMeans( const Mat& src, Mat& dst )
+{
+    Mat s = src;
+    nonlocalMeansFilter( s, dst, 3, 7, 15, 15 );
+}
+
+static void nonlocalMeansFast( const Mat& src, Mat& dst )
+{
+    Mat s = src;
+    nonlocalMeansFilterFast( s, dst, 3, 7, 15, 15 );
+}
+
+PERF_CASE( nonlocalMeansFilter, "lena.jpg", IMREAD_COLOR, nonlocalMeans )
+PERF_VARIANT( nonlocalMeansFilter, "box sums", nonlocalMeansFast )
@@ -0,0 +1,19 @@
+#include <opencv2/opencv.hpp>
+#include <opencv2/core/hal/intrin.hpp>
+#define main overlay_main
+#include "../73016.cpp"
+#undef main
+#include "../image_cache.hpp"
+#include "perf_samples.hpp"
+
+// the sample's icon, with its alpha channel, blended at the center of a copy of the frame
+static void overlay( const Mat& src, Mat& dst )
+{
+    static Mat icon = cachedImread( perf::dataDir() + "/73016a.png", IMREAD_UNCHANGED );
+    CV_Assert( icon.type() == CV_8UC4 );
+    cvtColor( src, dst, COLOR_BGR2BGRA );
+    Mat sprite = icon;
+    overlayImage( &dst, &sprite, Point( ( dst.cols - icon.cols ) / 2, ( dst.rows - icon.rows ) / 2 ) );
+}
+
+PERF_CASE( overlayImage, "scene2.jpg", IMREAD_COLOR, overlay )
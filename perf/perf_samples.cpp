@@ -0,0 +1,148 @@
+#include "perf_samples.hpp"
+#include "../image_cache.hpp"
+#include <opencv2/core.hpp>
+#include <opencv2/core/utility.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+using namespace cv;
+using namespace std;
+
+// The hot functions of the samples, timed on the bundled images.
+//
+//     perf_samples                               every case, default sizes and threads
+//     perf_samples --sizes 640x480,1920x1080 --threads 1,4,8 --repeats 10
+//     perf_samples --filter histMatchRGB --csv hist.csv
+//     perf_samples --list
+//
+// Every case loads its image from --data (the source directory by default) and runs
+// every variant at every thread count on the image resized to every size. The
+// reference of a case is its first variant on one thread: the speedup column is
+// the gain over it, "equal" says whether the output is bit exact, so a thread count
+// that changes the result shows up like a fast path that does.
+
+static vector<int> parseInts( const string& s )
+{
+    vector<int> v;
+    stringstream in( s );
+    string item;
+    while( getline( in, item, ',' ) )
+        v.push_back( atoi( item.c_str() ) );
+    return v;
+}
+
+static vector<Size> parseSizes( const string& s )
+{
+    vector<Size> v;
+    stringstream in( s );
+    string item;
+    while( getline( in, item, ',' ) )
+    {
+        int w = 0, h = 0;
+        if( sscanf( item.c_str(), "%dx%d", &w, &h ) == 2 && w > 0 && h > 0 )
+            v.push_back( Size( w, h ) );
+    }
+    return v;
+}
+
+#ifndef PERF_DATA_DIR
+#define PERF_DATA_DIR "."
+#endif
+
+int main( int argc, char** argv )
+{
+    vector<Size> sizes = parseSizes( "320x240,640x480,1280x960" );
+    vector<int> threads( 1, 1 );
+    if( getNumThreads() > 1 )
+        threads.push_back( getNumThreads() );
+    int repeats = 5;
+    string data = PERF_DATA_DIR, filter, csv;
+    bool list = false;
+    for( int i = 1; i < argc; i++ )
+    {
+        bool more = i + 1 < argc;
+        if( !strcmp( argv[i], "--sizes" ) && more )
+            sizes = parseSizes( argv[++i] );
+        else if( !strcmp( argv[i], "--threads" ) && more )
+            threads = parseInts( argv[++i] );
+        else if( !strcmp( argv[i], "--repeats" ) && more )
+            repeats = std::max( 1, atoi( argv[++i] ) );
+        else if( !strcmp( argv[i], "--data" ) && more )
+            data = argv[++i];
+        else if( !strcmp( argv[i], "--filter" ) && more )
+            filter = argv[++i];
+        else if( !strcmp( argv[i], "--csv" ) && more )
+            csv = argv[++i];
+        else if( !strcmp( argv[i], "--list" ) )
+            list = true;
+        else
+        {
+            cerr << "unknown option " << argv[i] << endl;
+            return 1;
+        }
+    }
+
+    perf::dataDir() = data;
+
+    ofstream csvOut;
+    if( !csv.empty() )
+        csvOut.open( csv.c_str() );
+    bool header = true;
+    int defaultThreads = getNumThreads();
+
+    const vector<perf::Case>& cases = perf::cases();
+    for( size_t c = 0; c < cases.size(); c++ )
+    {
+        const perf::Case& pc = cases[c];
+        if( list )
+        {
+            cout << pc.name << " (" << pc.image << ")" << endl;
+            continue;
+        }
+        if( !filter.empty() && pc.name.find( filter ) == string::npos )
+            continue;
+        Mat image = cachedImread( perf::dataDir() + "/" + pc.image, pc.flags );
+        if( image.empty() )
+        {
+            cerr << pc.name << ": cannot read " << data << "/" << pc.image << endl;
+            continue;
+        }
+
+        KernelBench bench( repeats, 1 );
+        for( size_t v = 0; v < pc.kernels.size(); v++ )
+            for( size_t t = 0; t < threads.size(); t++ )
+            {
+                int n = threads[t];
+                KernelBench::Kernel kernel = pc.kernels[v];
+                bench.add( format( "%s/threads:%d", pc.variants[v].c_str(), n ), [n, kernel]( const Mat& src, Mat& dst )
+                {
+                    setNumThreads( n );
+                    kernel( src, dst );
+                } );
+            }
+        bench.runOn( image, sizes );
+        setNumThreads( defaultThreads );
+
+        cout << "== " << pc.name << " on " << pc.image << endl;
+        bench.printTable( cout );
+        cout << endl;
+        if( csvOut.is_open() )
+        {
+            // one header for the whole file, the case name as an extra first column
+            stringstream rows;
+            bench.writeCsv( rows );
+            string line;
+            getline( rows, line );
+            if( header )
+                csvOut << "case," << line << endl;
+            header = false;
+            while( getline( rows, line ) )
+                csvOut << pc.name << "," << line << endl;
+        }
+    }
+    return 0;
+}
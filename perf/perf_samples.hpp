@@ -0,0 +1,81 @@
+// Benchmark cases of the perf_samples target.
+//
+//     #include <opencv2/opencv.hpp>                  // before main is renamed
+//     #define main skin_color_main                   // the sample's own main is not linked
+//     #include "../skin_color.cpp"
+//     #undef main
+//     #include "perf_samples.hpp"
+//
+//     static void thresholdSkin( const Mat& src, Mat& dst ) { dst = ThresholdSkin( src ); }
+//     PERF_CASE( ThresholdSkin, "lena.jpg", IMREAD_COLOR, thresholdSkin )
+//     PERF_VARIANT( ThresholdSkin, "table", thresholdSkinTable )   // compared to the first
+//
+// Every benchmark wraps the kernel of one sample, compiled in its own translation
+// unit so the samples' file scope helpers do not collide. A case names the bundled
+// image it runs on; perf_samples.cpp resizes it to every size and runs every variant
+// with every thread count, the first variant on one thread being the reference.
+
+#ifndef PERF_SAMPLES_HPP
+#define PERF_SAMPLES_HPP
+
+#include "../kernel_bench.hpp"
+#include <string>
+#include <vector>
+
+namespace perf
+{
+
+struct Case
+{
+    std::string name, image;
+    int flags;
+    std::vector<std::string> variants;
+    std::vector<KernelBench::Kernel> kernels;
+};
+
+// where the bundled images are, set by perf_samples.cpp
+inline std::string& dataDir()
+{
+    static std::string dir = ".";
+    return dir;
+}
+
+inline std::vector<Case>& cases()
+{
+    static std::vector<Case> registry;
+    return registry;
+}
+
+struct Registrar
+{
+    Registrar( const char* name, const char* image, int flags, const char* variant, const KernelBench::Kernel& kernel )
+    {
+        Case c;
+        c.name = name;
+        c.image = image;
+        c.flags = flags;
+        cases().push_back( c );
+        cases().back().variants.push_back( variant );
+        cases().back().kernels.push_back( kernel );
+    }
+
+    // a variant of a case registered earlier in the same file
+    Registrar( const char* name, const char* variant, const KernelBench::Kernel& kernel )
+    {
+        for( size_t i = 0; i < cases().size(); i++ )
+            if( cases()[i].name == name )
+            {
+                cases()[i].variants.push_back( variant );
+                cases()[i].kernels.push_back( kernel );
+                return;
+            }
+        CV_Error( cv::Error::StsObjectNotFound, std::string( "no perf case " ) + name );
+    }
+};
+
+}
+
+#define PERF_CASE( name, image, flags, kernel ) static perf::Registrar perf_case_##name( #name, image, flags, #kernel, kernel );
+#define PERF_VARIANT( name, variant, kernel ) static perf::Registrar perf_variant_##name##_##kernel( #name, variant, kernel );
+
+#endif
@@ -0,0 +1,12 @@
+#include <opencv2/opencv.hpp>
+#define main skin_color_main
+#include "../skin_color.cpp"
+#undef main
+#include "perf_samples.hpp"
+
+static void thresholdSkin( const Mat& src, Mat& dst )
+{
+    dst = ThresholdSkin( src );
+}
+
+PERF_CASE( ThresholdSkin, "lena.jpg", IMREAD_COLOR, thresholdSkin )
@@ -0,0 +1,12 @@
+#include <opencv2/opencv.hpp>
+#define main tan_triggs_main
+#include "../tan_triggs.cpp"
+#undef main
+#include "perf_samples.hpp"
+
+static void tanTriggs( const Mat& src, Mat& dst )
+{
+    dst = tan_triggs_preprocessing( src );
+}
+
+PERF_CASE( tan_triggs_preprocessing, "lena.jpg", IMREAD_GRAYSCALE, tanTriggs )
@@ -0,0 +1,330 @@
+// Per-stage latency instrumentation shared by the samples.
+//
+//     PERF_STAGE("grab");            // times the enclosing scope
+//     {
+//         PERF_STAGE("detect");      // nested, reported as "frame/detect" when inside PERF_STAGE("frame")
+//         ...
+//     }
+//     perf::PeriodicReport report(5.0, "stages.csv");   // in the loop: report.tick();
+//     perf::printReport(std::cout);
+//
+// Every thread accumulates into its own fixed block of counters. Recording a sample
+// is a few relaxed atomic stores from the owning thread only, so there is no lock and
+// no contention on the hot path; reports merge the per-thread blocks. Latencies go
+// into log-linear histograms (4 buckets per power of two, ns resolution) from which
+// p50/p95/p99 are read with about 20% relative error; min, max and mean are exact.
+
+#ifndef PERF_STAGES_HPP
+#define PERF_STAGES_HPP
+
+#include <opencv2/core.hpp>
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include <string>
+#include <map>
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdint>
+
+namespace perf
+{
+
+enum { MAX_STAGES = 64, HISTOGRAM_BINS = 160 };
+
+inline int histogramBin( uint64_t ns )
+{
+    if( ns < 4 )
+        return (int)ns;
+    int msb = 63;
+    while( !( ns >> msb ) ) msb--;
+    int bin = msb * 4 + (int)( ( ns >> ( msb - 2 ) ) & 3 );
+    return bin < HISTOGRAM_BINS ? bin : HISTOGRAM_BINS - 1;
+}
+
+// lower edge of a bin in ns
+inline double histogramBinValue( int bin )
+{
+    if( bin < 4 )
+        return bin;
+    int msb = bin / 4;
+    return (double)( ( (uint64_t)4 + ( bin & 3 ) ) << ( msb - 2 ) );
+}
+
+// accumulated samples of one stage on one thread, written only by that thread
+struct StageCounters
+{
+    std::atomic<uint64_t> count;
+    std::atomic<uint64_t> total_ns;
+    std::atomic<uint64_t> max_ns;
+    std::atomic<uint64_t> min_ns;
+    std::atomic<uint64_t> bins[HISTOGRAM_BINS];
+
+    StageCounters() { reset(); }
+
+    void add( uint64_t ns )
+    {
+        count.store( count.load( std::memory_order_relaxed ) + 1, std::memory_order_relaxed );
+        total_ns.store( total_ns.load( std::memory_order_relaxed ) + ns, std::memory_order_relaxed );
+        if( ns > max_ns.load( std::memory_order_relaxed ) ) max_ns.store( ns, std::memory_order_relaxed );
+        if( ns < min_ns.load( std::memory_order_relaxed ) ) min_ns.store( ns, std::memory_order_relaxed );
+        std::atomic<uint64_t>& b = bins[histogramBin( ns )];
+        b.store( b.load( std::memory_order_relaxed ) + 1, std::memory_order_relaxed );
+    }
+
+    void reset()
+    {
+        count = 0; total_ns = 0; max_ns = 0; min_ns = UINT64_MAX;
+        for( int i = 0; i < HISTOGRAM_BINS; i++ ) bins[i] = 0;
+    }
+};
+
+// merged view of one stage over all threads
+struct StageStats
+{
+    std::string name;
+    uint64_t count;
+    double total_ms, mean_ms, min_ms, max_ms, p50_ms, p95_ms, p99_ms;
+
+    double fps() const { return total_ms > 0 ? count * 1000.0 / total_ms : 0; }
+};
+
+class Registry
+{
+public:
+    static Registry& instance()
+    {
+        static Registry registry;
+        return registry;
+    }
+
+    // stage id for name nested under parent (-1 for top level)
+    int stageId( int parent, const char* name )
+    {
+        std::lock_guard<std::mutex> lock( mutex );
+        std::string full = parent >= 0 ? names[parent] + "/" + name : std::string( name );
+        std::map<std::string, int>::iterator it = ids.find( full );
+        if( it != ids.end() )
+            return it->second;
+        CV_Assert( names.size() < MAX_STAGES );
+        int id = (int)names.size();
+        names.push_back( full );
+        ids[full] = id;
+        return id;
+    }
+
+    StageCounters* threadBlock()
+    {
+        std::lock_guard<std::mutex> lock( mutex );
+        blocks.push_back( new StageCounters[MAX_STAGES] );
+        return blocks.back();
+    }
+
+    std::vector<StageStats> collect( bool reset_after = false )
+    {
+        std::lock_guard<std::mutex> lock( mutex );
+        std::vector<StageStats> result;
+        std::vector<uint64_t> bins( HISTOGRAM_BINS );
+        for( size_t id = 0; id < names.size(); id++ )
+        {
+            StageStats s;
+            s.name = names[id];
+            s.count = 0;
+            uint64_t total = 0, mx = 0, mn = UINT64_MAX;
+            std::fill( bins.begin(), bins.end(), 0 );
+            for( size_t t = 0; t < blocks.size(); t++ )
+            {
+                StageCounters& c = blocks[t][id];
+                s.count += c.count.load( std::memory_order_relaxed );
+                total += c.total_ns.load( std::memory_order_relaxed );
+                mx = std::max( mx, (uint64_t)c.max_ns.load( std::memory_order_relaxed ) );
+                mn = std::min( mn, (uint64_t)c.min_ns.load( std::memory_order_relaxed ) );
+                for( int b = 0; b < HISTOGRAM_BINS; b++ )
+                    bins[b] += c.bins[b].load( std::memory_order_relaxed );
+                if( reset_after )
+                    c.reset();
+            }
+            s.total_ms = total * 1e-6;
+            s.mean_ms = s.count ? s.total_ms / s.count : 0;
+            s.max_ms = mx * 1e-6;
+            s.min_ms = s.count ? mn * 1e-6 : 0;
+            s.p50_ms = percentile( bins, s.count, 0.50 ) * 1e-6;
+            s.p95_ms = percentile( bins, s.count, 0.95 ) * 1e-6;
+            s.p99_ms = percentile( bins, s.count, 0.99 ) * 1e-6;
+            result.push_back( s );
+        }
+        return result;
+    }
+
+private:
+    Registry() {}
+
+    static double percentile( const std::vector<uint64_t>& bins, uint64_t count, double q )
+    {
+        if( count == 0 )
+            return 0;
+        uint64_t rank = (uint64_t)( q * ( count - 1 ) ), seen = 0;
+        for( int b = 0; b < HISTOGRAM_BINS; b++ )
+        {
+            seen += bins[b];
+            if( seen > rank )
+                return histogramBinValue( b );
+        }
+        return histogramBinValue( HISTOGRAM_BINS - 1 );
+    }
+
+    std::mutex mutex;
+    std::vector<std::string> names;
+    std::map<std::string, int> ids;
+    std::vector<StageCounters*> blocks; // never freed, threads may outlive reports
+};
+
+// thread local state: the counter block and the stack of open stages
+struct ThreadState
+{
+    StageCounters* block;
+    int current;
+    std::map<std::pair<int, const char*>, int> cache;
+
+    ThreadState() : block( Registry::instance().threadBlock() ), current( -1 ) {}
+
+    static ThreadState& get()
+    {
+        static thread_local ThreadState state;
+        return state;
+    }
+
+    int stageId( const char* name )
+    {
+        std::pair<int, const char*> key( current, name );
+        std::map<std::pair<int, const char*>, int>::iterator it = cache.find( key );
+        if( it != cache.end() )
+            return it->second;
+        int id = Registry::instance().stageId( current, name );
+        cache[key] = id;
+        return id;
+    }
+};
+
+class ScopedStage
+{
+public:
+    explicit ScopedStage( const char* name ) : state( ThreadState::get() )
+    {
+        id = state.stageId( name );
+        parent = state.current;
+        state.current = id;
+        start = std::chrono::steady_clock::now();
+    }
+
+    ~ScopedStage()
+    {
+        uint64_t ns = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::steady_clock::now() - start ).count();
+        state.block[id].add( ns );
+        state.current = parent;
+    }
+
+private:
+    ThreadState& state;
+    int id;
+    int parent;
+    std::chrono::steady_clock::time_point start;
+};
+
+inline StageStats stats( const std::string& name )
+{
+    std::vector<StageStats> all = Registry::instance().collect();
+    for( size_t i = 0; i < all.size(); i++ )
+        if( all[i].name == name )
+            return all[i];
+    StageStats empty = StageStats();
+    empty.name = name;
+    return empty;
+}
+
+inline void printReport( std::ostream& out, bool reset_after = false )
+{
+    std::vector<StageStats> all = Registry::instance().collect( reset_after );
+    out << std::left << std::setw(32) << "stage" << std::right
+        << std::setw(10) << "count" << std::setw(10) << "mean" << std::setw(10) << "p50"
+        << std::setw(10) << "p95" << std::setw(10) << "p99" << std::setw(10) << "max" << "  (ms)" << std::endl;
+    out << std::fixed << std::setprecision(3);
+    for( size_t i = 0; i < all.size(); i++ )
+    {
+        const StageStats& s = all[i];
+        out << std::left << std::setw(32) << s.name << std::right
+            << std::setw(10) << s.count << std::setw(10) << s.mean_ms << std::setw(10) << s.p50_ms
+            << std::setw(10) << s.p95_ms << std::setw(10) << s.p99_ms << std::setw(10) << s.max_ms << std::endl;
+    }
+    out.unsetf( std::ios::floatfield );
+}
+
+inline void writeCsvHeader( std::ostream& out )
+{
+    out << "time,stage,count,mean_ms,p50_ms,p95_ms,p99_ms,max_ms" << std::endl;
+}
+
+inline void writeCsv( std::ostream& out, double timestamp, bool reset_after = false )
+{
+    std::vector<StageStats> all = Registry::instance().collect( reset_after );
+    for( size_t i = 0; i < all.size(); i++ )
+    {
+        const StageStats& s = all[i];
+        out << timestamp << "," << s.name << "," << s.count << "," << s.mean_ms << "," << s.p50_ms << ","
+            << s.p95_ms << "," << s.p99_ms << "," << s.max_ms << std::endl;
+    }
+}
+
+// Call tick() from the hot loop; every interval seconds it dumps the stages (to stdout,
+// or appended to a CSV file when a path is given, the header only when the file is
+// new or empty) and starts a new window. due() tells whether the next tick() reports,
+// for whoever wants the stats of the window just before it is reset. The reset
+// between windows races with threads still recording, so a window boundary may lose
+// or double count a sample or two.
+class PeriodicReport
+{
+public:
+    PeriodicReport( double _interval, const std::string& csv_path = std::string() )
+        : interval( _interval ), begin( std::chrono::steady_clock::now() ), last( begin )
+    {
+        if( !csv_path.empty() )
+        {
+            csv.open( csv_path.c_str(), std::ios::out | std::ios::app );
+            csv.seekp( 0, std::ios::end );
+            if( csv.tellp() == std::streampos( 0 ) )
+                writeCsvHeader( csv );
+        }
+    }
+
+    bool due() const
+    {
+        return std::chrono::duration<double>( std::chrono::steady_clock::now() - last ).count() >= interval;
+    }
+
+    void tick()
+    {
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        if( std::chrono::duration<double>( now - last ).count() < interval )
+            return;
+        last = now;
+        if( csv.is_open() )
+            writeCsv( csv, std::chrono::duration<double>( now - begin ).count(), true );
+        else
+            printReport( std::cout, true );
+    }
+
+private:
+    double interval;
+    std::chrono::steady_clock::time_point begin, last;
+    std::ofstream csv;
+};
+
+} // namespace perf
+
+#define PERF_STAGE_CONCAT_(a, b) a##b
+#define PERF_STAGE_CONCAT(a, b) PERF_STAGE_CONCAT_(a, b)
+#define PERF_STAGE(name) perf::ScopedStage PERF_STAGE_CONCAT(perf_stage_, __LINE__)(name)
+
+#endif
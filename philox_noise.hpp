@@ -0,0 +1,171 @@
+// Gaussian and salt and pepper noise that is the same for a seed on any number of threads.
+//
+//     philox::addNoise( src, noisy, 10.0 );              // sigma 10, seed 0
+//     philox::addNoise( src, noisy, 10.0, 0.02, 1234 );  // and 2% salt and pepper, seed 1234
+//     unsigned r[4];
+//     philox::block( index, seed, r );                    // the 4 random words of any index
+//
+// The random numbers come from Philox4x32-10 (Salmon et al., "Parallel random numbers:
+// as easy as 1, 2, 3"), a counter based generator: the four words of block i are a
+// keyed hash of i, with no state carried from one block to the next. Every two channel
+// values of a row share a block, numbered by their position in the image, so rows can
+// be processed in any order and on any thread with the same result, and there is
+// nothing shared to lock. Two words make the two Gaussian values of the pair (both
+// outputs of Box-Muller), the other two decide, one per value, whether it is replaced
+// by salt or pepper (the top 24 bits) and which (the lowest bit); both kinds of noise
+// are applied in the same pass over the interleaved channels, 8 bit with saturation.
+//
+// A row is done in stages: the blocks four at a time, in lanes the compiler can keep in
+// vector registers, then the log, sqrt and sin / cos of Box-Muller over the whole row
+// with the vectorised cv::log, cv::sqrt and cv::polarToCart, then the sums.
+
+#ifndef PHILOX_NOISE_HPP
+#define PHILOX_NOISE_HPP
+
+#include <opencv2/core.hpp>
+#include <opencv2/core/utility.hpp>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace philox
+{
+
+// Philox4x32 with 10 rounds of counter ctr and key k
+inline void philox4x32( const unsigned ctr[4], unsigned k0, unsigned k1, unsigned out[4] )
+{
+    unsigned c0 = ctr[0], c1 = ctr[1], c2 = ctr[2], c3 = ctr[3];
+    for( int r = 0; r < 10; r++ )
+    {
+        if( r > 0 )
+        {
+            k0 += 0x9E3779B9u;
+            k1 += 0xBB67AE85u;
+        }
+        uint64 p0 = (uint64)0xD2511F53u * c0, p1 = (uint64)0xCD9E8D57u * c2;
+        unsigned n0 = (unsigned)( p1 >> 32 ) ^ c1 ^ k0, n2 = (unsigned)( p0 >> 32 ) ^ c3 ^ k1;
+        c1 = (unsigned)p1;
+        c3 = (unsigned)p0;
+        c0 = n0;
+        c2 = n2;
+    }
+    out[0] = c0; out[1] = c1; out[2] = c2; out[3] = c3;
+}
+
+// the block of a 64 bit index for a 64 bit seed
+inline void block( uint64 index, uint64 seed, unsigned out[4] )
+{
+    unsigned ctr[4] = { (unsigned)index, (unsigned)( index >> 32 ), 0, 0 };
+    philox4x32( ctr, (unsigned)seed, (unsigned)( seed >> 32 ), out );
+}
+
+// the blocks of index, index + 1, index + 2 and index + 3, word w of block l in out[w][l]
+inline void blocks4( uint64 index, uint64 seed, unsigned out[4][4] )
+{
+    unsigned c0[4], c1[4], c2[4] = { 0, 0, 0, 0 }, c3[4] = { 0, 0, 0, 0 };
+    for( int l = 0; l < 4; l++ )
+    {
+        c0[l] = (unsigned)( index + l );
+        c1[l] = (unsigned)( ( index + l ) >> 32 );
+    }
+    unsigned k0 = (unsigned)seed, k1 = (unsigned)( seed >> 32 );
+    for( int r = 0; r < 10; r++ )
+    {
+        if( r > 0 )
+        {
+            k0 += 0x9E3779B9u;
+            k1 += 0xBB67AE85u;
+        }
+        for( int l = 0; l < 4; l++ )
+        {
+            uint64 p0 = (uint64)0xD2511F53u * c0[l], p1 = (uint64)0xCD9E8D57u * c2[l];
+            unsigned n0 = (unsigned)( p1 >> 32 ) ^ c1[l] ^ k0, n2 = (unsigned)( p0 >> 32 ) ^ c3[l] ^ k1;
+            c1[l] = (unsigned)p1;
+            c3[l] = (unsigned)p0;
+            c0[l] = n0;
+            c2[l] = n2;
+        }
+    }
+    for( int l = 0; l < 4; l++ )
+    {
+        out[0][l] = c0[l]; out[1][l] = c1[l]; out[2][l] = c2[l]; out[3][l] = c3[l];
+    }
+}
+
+// [0, 1) and (0, 1] from the top 24 bits of a word
+inline float unit( unsigned w ) { return ( w >> 8 ) * ( 1.f / 16777216.f ); }
+inline float unitOpen( unsigned w ) { return ( ( w >> 8 ) + 1 ) * ( 1.f / 16777216.f ); }
+
+class NoiseBody : public cv::ParallelLoopBody
+{
+public:
+    NoiseBody( const cv::Mat& _src, cv::Mat& _dst, float _sigma, float _saltPepper, uint64 _seed )
+        : src( _src ), dst( _dst ), sigma( _sigma ), saltPepper( _saltPepper ), seed( _seed ) {}
+
+    void operator()( const cv::Range& range ) const
+    {
+        const int n = src.cols * src.channels(), pairs = ( n + 1 ) / 2, padded = ( pairs + 3 ) & ~3;
+        const float twoPi = (float)( 2 * CV_PI );
+        // per pair: the Box-Muller inputs, then the two normals; the salt and pepper words
+        cv::Mat_<float> radius( 1, padded ), angle( 1, padded ), g0, g1;
+        std::vector<unsigned> sp0( padded ), sp1( padded );
+        for( int y = range.start; y < range.end; y++ )
+        {
+            const uchar* s = src.ptr<uchar>( y );
+            uchar* d = dst.ptr<uchar>( y );
+            uint64 index = (uint64)y * pairs;
+            for( int j = 0; j < padded; j += 4 )
+            {
+                unsigned w[4][4];
+                blocks4( index + j, seed, w );
+                for( int l = 0; l < 4; l++ )
+                {
+                    radius( j + l ) = unitOpen( w[0][l] );
+                    angle( j + l ) = twoPi * unit( w[1][l] );
+                    sp0[j + l] = w[2][l];
+                    sp1[j + l] = w[3][l];
+                }
+            }
+            if( sigma > 0 )
+            {
+                // sigma * sqrt( -2 log u ): the normals come out already scaled
+                cv::log( radius, radius );
+                radius.convertTo( radius, CV_32F, -2.0 * sigma * sigma );
+                cv::sqrt( radius, radius );
+                cv::polarToCart( radius, angle, g0, g1 );
+            }
+            for( int i = 0; i < n; i++ )
+            {
+                int j = i >> 1;
+                float v = s[i];
+                if( sigma > 0 )
+                    v += i & 1 ? g1( j ) : g0( j );
+                uchar out = cv::saturate_cast<uchar>( v );
+                unsigned w = i & 1 ? sp1[j] : sp0[j];
+                if( saltPepper > 0 && unit( w ) < saltPepper )
+                    out = w & 1u ? 255 : 0;
+                d[i] = out;
+            }
+        }
+    }
+
+private:
+    const cv::Mat& src;
+    cv::Mat& dst;
+    float sigma, saltPepper;
+    uint64 seed;
+};
+
+// dst: src plus Gaussian noise of sigma, then a share saltPepper of the channel values
+// set to 0 or 255; 8 bit, any number of channels, dst may be src
+inline void addNoise( const cv::Mat& src, cv::Mat& dst, double sigma, double saltPepper = 0, uint64 seed = 0 )
+{
+    CV_Assert( src.depth() == CV_8U && sigma >= 0 && saltPepper >= 0 && saltPepper <= 1 );
+    dst.create( src.size(), src.type() );
+    cv::parallel_for_( cv::Range( 0, src.rows ), NoiseBody( src, dst, (float)sigma, (float)saltPepper, seed ),
+                       std::max( 1.0, src.total() / (double)( 1 << 16 ) ) );
+}
+
+}
+
+#endif
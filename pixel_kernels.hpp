@@ -0,0 +1,94 @@
+// Per pixel loops written once as a lambda, with the element type and channel count
+// known at compile time.
+//
+//     // 8 bit threshold, one output pixel per input pixel
+//     pixelkernel::forEachPixel<uchar, uchar>( src, dst, []( uchar v ) { return v > 70 ? uchar( 0 ) : uchar( 255 ); } );
+//     // in place on BGR
+//     pixelkernel::forEachPixel<Vec3b, Vec3b>( img, img, []( Vec3b p ) { p[1] = p[1] < 127 ? uchar( p[1] * 2 ) : uchar( 255 ); return p; } );
+//     // a hand written row function, e.g. with intrinsics
+//     pixelkernel::forEachRow<uchar, uchar>( src, dst, thresholdRowSIMD );   // void( const uchar*, uchar*, int )
+//
+// forEachRow() checks the types, creates dst, and calls the row function on every row,
+// or on one long row when both images are continuous; the rows, or chunks of the long
+// row, are shared out by parallel_for_ in pieces of about 64K pixels. forEachPixel()
+// is forEachRow() with the lambda inlined in the inner loop (d[x] = op( s[x] )): there
+// is no per pixel test of type, channels or direction left, so a lambda without
+// branches (ternaries, min / max) is usually vectorised by the compiler.
+
+#ifndef PIXEL_KERNELS_HPP
+#define PIXEL_KERNELS_HPP
+
+#include <opencv2/core.hpp>
+#include <opencv2/core/utility.hpp>
+#include <algorithm>
+
+namespace pixelkernel
+{
+
+enum { CHUNK = 1 << 16 };
+
+template<typename S, typename D, typename RowOp> class RowBody : public cv::ParallelLoopBody
+{
+public:
+    RowBody( const cv::Mat& _src, cv::Mat& _dst, const RowOp& _rowOp, bool _flat )
+        : src( _src ), dst( _dst ), rowOp( _rowOp ), flat( _flat ) {}
+
+    void operator()( const cv::Range& range ) const
+    {
+        if( flat )
+        {
+            // chunks of the one long row
+            size_t total = src.total(), begin = (size_t)range.start * CHUNK, end = std::min( total, (size_t)range.end * CHUNK );
+            rowOp( src.ptr<S>() + begin, dst.ptr<D>() + begin, (int)( end - begin ) );
+            return;
+        }
+        for( int y = range.start; y < range.end; y++ )
+            rowOp( src.ptr<S>( y ), dst.ptr<D>( y ), src.cols );
+    }
+
+private:
+    const cv::Mat& src;
+    cv::Mat& dst;
+    const RowOp& rowOp;
+    bool flat;
+};
+
+// rowOp( const S* s, D* d, int n ) over all the pixels of src; dst may be src when S is D
+template<typename S, typename D, typename RowOp> inline void forEachRow( const cv::Mat& src, cv::Mat& dst, const RowOp& rowOp )
+{
+    CV_Assert( src.type() == cv::DataType<S>::type && src.dims <= 2 );
+    dst.create( src.size(), cv::DataType<D>::type );
+    if( src.empty() )
+        return;
+    if( src.isContinuous() && dst.isContinuous() )
+    {
+        int chunks = (int)( ( src.total() + CHUNK - 1 ) / CHUNK );
+        cv::parallel_for_( cv::Range( 0, chunks ), RowBody<S, D, RowOp>( src, dst, rowOp, true ) );
+    }
+    else
+        cv::parallel_for_( cv::Range( 0, src.rows ), RowBody<S, D, RowOp>( src, dst, rowOp, false ),
+                           std::max( 1.0, src.total() / (double)CHUNK ) );
+}
+
+template<typename S, typename D, typename Op> struct PixelRow
+{
+    explicit PixelRow( const Op& _op ) : op( _op ) {}
+
+    void operator()( const S* s, D* d, int n ) const
+    {
+        for( int x = 0; x < n; x++ )
+            d[x] = op( s[x] );
+    }
+
+    const Op& op;
+};
+
+// d = op( s ) for every pixel; op( const S& ) returns something convertible to D
+template<typename S, typename D, typename Op> inline void forEachPixel( const cv::Mat& src, cv::Mat& dst, const Op& op )
+{
+    forEachRow<S, D>( src, dst, PixelRow<S, D, Op>( op ) );
+}
+
+}
+
+#endif
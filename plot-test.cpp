@@ -48,6 +48,9 @@
 #include <opencv2/core.hpp>
 #include <opencv2/imgproc.hpp>
 #include <opencv2/highgui.hpp>
+#include <cfloat>
+#include <cmath>
+#include <iostream>
 
 namespace cv
 {
@@ -537,6 +540,240 @@ Ptr<Plot2d> Plot2d::create(InputArray _plotDataX, InputArray _plotDataY)
 {
     return Ptr<Plot2dImpl>(new Plot2dImpl(_plotDataX, _plotDataY));
 }
+
+//! Scrolling plot of live samples. Every pixel column holds the min and max of
+//! samplesPerColumn consecutive samples of each series, so drawing costs one
+//! vertical segment per column and series whatever the number of samples, and a
+//! render only draws the columns completed since the previous one: the canvas is a
+//! ring of columns, unrolled into the result with two copies. The raw samples are
+//! kept in a ring of capacity samples per series, to rebuild the columns when the
+//! time scale changes. All series share the sample clock: push() takes one value
+//! for each of them.
+class StreamingPlot2d
+{
+public:
+
+    StreamingPlot2d(int _width = 600, int _height = 400, int _samplesPerColumn = 1, int _capacity = 1 << 20)
+        : width(std::max(_width, 16)), height(std::max(_height, 16)), samplesPerColumn(std::max(_samplesPerColumn, 1)),
+          capacity(std::max(_capacity, 1)), ticks(0), drawn(0), minY(0), maxY(1), autoScale(true), needRedraw(true),
+          gridLinesNumber(10), backgroundColor(50, 50, 50), gridColor(255, 255, 255), axisColor(0, 0, 255), textColor(255, 255, 255)
+    {
+        canvas.create(height, width, CV_8UC3);
+    }
+
+    //! returns the index of the new series; series are added before the first push
+    int addSeries(Scalar color)
+    {
+        CV_Assert(ticks == 0);
+        Series s;
+        s.color = color;
+        s.samples.resize(capacity);
+        s.colMin.assign(width, 0);
+        s.colMax.assign(width, 0);
+        s.colLast.assign(width, 0);
+        s.reset();
+        series.push_back(s);
+        return (int)series.size() - 1;
+    }
+
+    //! fixed Y range; autoScale = true grows it to fit the data instead
+    void setRangeY(double _minY, double _maxY, bool _autoScale = false)
+    {
+        CV_Assert(_maxY > _minY);
+        minY = _minY;
+        maxY = _maxY;
+        autoScale = _autoScale;
+        needRedraw = true;
+    }
+
+    void setGridLinesNumber(int _gridLinesNumber)
+    {
+        gridLinesNumber = std::max(_gridLinesNumber, 1);
+        needRedraw = true;
+    }
+
+    //! time scale: columns are rebuilt from the samples still in the ring
+    void setSamplesPerColumn(int _samplesPerColumn)
+    {
+        samplesPerColumn = std::max(_samplesPerColumn, 1);
+        int64 completed = ticks / samplesPerColumn, oldest = std::max<int64>(0, ticks - capacity);
+        for (size_t k = 0; k < series.size(); k++)
+        {
+            Series& s = series[k];
+            for (int64 c = std::max<int64>(0, completed - width); c < completed; c++)
+            {
+                s.reset();
+                for (int64 t = std::max(c * samplesPerColumn, oldest); t < (c + 1) * samplesPerColumn; t++)
+                    s.add(s.samples[t % capacity]);
+                s.store(c % width);
+            }
+            s.reset();
+            for (int64 t = std::max(completed * samplesPerColumn, oldest); t < ticks; t++)
+                s.add(s.samples[t % capacity]);
+        }
+        needRedraw = true;
+    }
+
+    //! one sample of every series, values[k] for series k
+    void push(const double* values)
+    {
+        for (size_t k = 0; k < series.size(); k++)
+        {
+            series[k].samples[ticks % capacity] = values[k];
+            series[k].add(values[k]);
+        }
+        ticks++;
+        if (ticks % samplesPerColumn)
+            return;
+        int64 c = ticks / samplesPerColumn - 1;
+        for (size_t k = 0; k < series.size(); k++)
+        {
+            Series& s = series[k];
+            if (autoScale && (s.curMin < minY || s.curMax > maxY))
+            {
+                double lo = std::min(minY, s.curMin), hi = std::max(maxY, s.curMax), margin = (hi - lo) * 0.1;
+                minY = s.curMin < minY ? lo - margin : minY;
+                maxY = s.curMax > maxY ? hi + margin : maxY;
+                needRedraw = true;
+            }
+            s.store(c % width);
+            s.reset();
+        }
+    }
+
+    void push(double value)
+    {
+        CV_Assert(series.size() == 1);
+        push(&value);
+    }
+
+    //! the last width columns, newest on the right, and the latest value of each series
+    void render(OutputArray _plotResult)
+    {
+        int64 completed = ticks / samplesPerColumn;
+        int64 first = std::max<int64>(0, completed - width);
+        if (needRedraw)
+        {
+            canvas.setTo(backgroundColor);
+            drawn = first;
+            needRedraw = false;
+        }
+        for (int64 c = std::max(drawn, first); c < completed; c++)
+            drawColumn(c, first);
+        drawn = completed;
+
+        // columns [first, completed) sit at canvas x = c % width: unroll the ring
+        _plotResult.create(height, width, CV_8UC3);
+        Mat plotResult = _plotResult.getMat();
+        int split = (int)(completed % width);
+        if (completed < width)
+        {
+            plotResult.colRange(0, width - split).setTo(backgroundColor);
+            canvas.colRange(0, split).copyTo(plotResult.colRange(width - split, width));
+        }
+        else
+        {
+            canvas.colRange(split, width).copyTo(plotResult.colRange(0, width - split));
+            canvas.colRange(0, split).copyTo(plotResult.colRange(width - split, width));
+        }
+
+        putText(plotResult, format("%g", maxY), Point(5, 15), FONT_HERSHEY_COMPLEX_SMALL, 0.7, textColor, 1, 8);
+        putText(plotResult, format("%g", minY), Point(5, height - 5), FONT_HERSHEY_COMPLEX_SMALL, 0.7, textColor, 1, 8);
+        for (size_t k = 0; k < series.size(); k++)
+        {
+            const Series& s = series[k];
+            double last = s.count ? s.curLast : completed > 0 ? s.colLast[(completed - 1) % width] : 0;
+            putText(plotResult, format("%d: %g", (int)k, last), Point(80, 15 + 15 * (int)k), FONT_HERSHEY_COMPLEX_SMALL, 0.7, s.color, 1, 8);
+        }
+    }
+
+    int64 sampleCount() const { return ticks; }
+
+protected:
+
+    struct Series
+    {
+        Scalar color;
+        vector<double> samples;                 //ring of the raw samples
+        vector<double> colMin, colMax, colLast; //ring of the columns, NaN when no sample is left
+        double curMin, curMax, curLast;         //the column being filled
+        int count;
+
+        void reset()
+        {
+            curMin = DBL_MAX;
+            curMax = -DBL_MAX;
+            count = 0;
+        }
+        void add(double v)
+        {
+            curMin = std::min(curMin, v);
+            curMax = std::max(curMax, v);
+            curLast = v;
+            count++;
+        }
+        void store(int64 slot)
+        {
+            colMin[slot] = count ? curMin : NAN;
+            colMax[slot] = count ? curMax : NAN;
+            colLast[slot] = count ? curLast : NAN;
+        }
+    };
+
+    int toRow(double v) const
+    {
+        double r = (height - 1) * (maxY - v) / (maxY - minY);
+        return std::min(std::max(cvRound(r), 0), height - 1);
+    }
+
+    void drawColumn(int64 c, int64 first)
+    {
+        const int TraceSize = 5;
+        int x = (int)(c % width);
+        canvas.col(x).setTo(backgroundColor);
+
+        //dashed horizontal grid, the dashes scroll with the data
+        if ((c / TraceSize) % 2 == 0)
+        {
+            int LineSpace = std::max(1, cvRound(height / (float)gridLinesNumber));
+            for (int y = LineSpace; y < height; y += LineSpace)
+                canvas.at<Vec3b>(y, x) = Vec3b(saturate_cast<uchar>(gridColor[0]), saturate_cast<uchar>(gridColor[1]), saturate_cast<uchar>(gridColor[2]));
+        }
+        if (minY < 0 && maxY > 0)
+            canvas.at<Vec3b>(toRow(0), x) = Vec3b(saturate_cast<uchar>(axisColor[0]), saturate_cast<uchar>(axisColor[1]), saturate_cast<uchar>(axisColor[2]));
+
+        for (size_t k = 0; k < series.size(); k++)
+        {
+            const Series& s = series[k];
+            double lo = s.colMin[x], hi = s.colMax[x];
+            if (cvIsNaN(lo))
+                continue;
+            //joined to the last sample of the previous column, as line() would
+            if (c > first)
+            {
+                double prev = s.colLast[(c - 1) % width];
+                if (!cvIsNaN(prev))
+                {
+                    lo = std::min(lo, prev);
+                    hi = std::max(hi, prev);
+                }
+            }
+            Vec3b color(saturate_cast<uchar>(s.color[0]), saturate_cast<uchar>(s.color[1]), saturate_cast<uchar>(s.color[2]));
+            for (int y = toRow(hi), y1 = toRow(lo); y <= y1; y++)
+                canvas.at<Vec3b>(y, x) = color;
+        }
+    }
+
+    int width, height, samplesPerColumn, capacity;
+    int64 ticks;    //samples pushed
+    int64 drawn;    //columns [0, drawn) are on the canvas
+    double minY, maxY;
+    bool autoScale, needRedraw;
+    int gridLinesNumber;
+    Scalar backgroundColor, gridColor, axisColor, textColor;
+    vector<Series> series;
+    Mat canvas;     //column c at x = c % width
+};
 }
 }
 
@@ -583,5 +820,30 @@ int main(int argc, char** argv)
     imshow("plot", plot_result);
     waitKey();
 
+    // live telemetry: two series, two million samples, 1000 samples per pixel column
+    plot::StreamingPlot2d stream(600, 400, 1000);
+    stream.addSeries(Scalar(50, 255, 255));
+    stream.addSeries(Scalar(255, 128, 50));
+    stream.setRangeY(0, 60, true);
+    RNG rng;
+    double renderMs = 0;
+    int renders = 0;
+    for (int i = 0; i < 2000000; i++)
+    {
+        double v[2] = { 30 + 10 * std::sin(i * 1e-5) + rng.gaussian(2), 15 + rng.gaussian(1) + (i % 200000 == 0 ? 40 : 0) };
+        stream.push(v);
+        if (i % 20000 == 19999)
+        {
+            int64 t = getTickCount();
+            stream.render(plot_result);
+            renderMs += (getTickCount() - t) * 1000.0 / getTickFrequency();
+            renders++;
+            imshow("stream", plot_result);
+            waitKey(1);
+        }
+    }
+    std::cout << stream.sampleCount() << " samples, " << renderMs / renders << " ms per render" << std::endl;
+    waitKey();
+
     return 0;
 }
@@ -1,4 +1,6 @@
 #include "qa.hpp"
+#include "image_cache.hpp"
+#include "point_bounds.hpp"
 #include "opencv2/imgproc.hpp"
 #include "opencv2/highgui.hpp"
 
@@ -6,58 +8,17 @@ using namespace cv;
 using namespace std;
 
 
+// bounding rect of the points, with the leftmost, rightmost, top and bottom points marked on m
 static Rect pointSetBoundingRect( const Mat& points , Mat m)
 {
-    int npoints = points.checkVector(2);
-
-
-    int  xmin = 0, ymin = 0, xmax = -1, ymax = -1, i;
-    Point ptxmin , ptymin , ptxmax , ptymax;
-
-    if( npoints == 0 )
-        return Rect();
-
-    const Point* pts = points.ptr<Point>();
-    Point pt = pts[0];
-
-    ptxmin = ptymin = ptxmax = ptymax = pt;
-    xmin = xmax = pt.x;
-    ymin = ymax = pt.y;
-
-    for( i = 1; i < npoints; i++ )
-    {
-        pt = pts[i];
-
-        if( xmin > pt.x )
-        {
-            xmin = pt.x;
-            ptxmin = pt;
-        }
-
-
-        if( xmax < pt.x )
-        {
-            xmax = pt.x;
-            ptxmax = pt;
-        }
-
-        if( ymin > pt.y )
-        {
-            ymin = pt.y;
-            ptymin = pt;
-        }
-
-        if( ymax < pt.y )
-        {
-            ymax = pt.y;
-            ptymax = pt;
-        }
-    }
-    ellipse( m, ptxmin, Size( 3, 3), 0, 0, 360, Scalar( 255, 0, 255 ), 2, 8, 0 );
-    ellipse( m, ptxmax, Size( 3, 3), 0, 0, 360, Scalar( 255, 0, 255 ), 2, 8, 0 );
-    ellipse( m, ptymin, Size( 3, 3), 0, 0, 360, Scalar( 255, 0, 255 ), 2, 8, 0 );
-    ellipse( m, ptymax, Size( 3, 3), 0, 0, 360, Scalar( 255, 0, 255 ), 2, 8, 0 );
-    return Rect(xmin, ymin, xmax - xmin + 1, ymax - ymin + 1);
+    Point extremes[4];
+    Rect r = pointSetBounds( points, extremes );
+    if( r.area() == 0 )
+        return r;
+
+    for( int k = 0; k < 4; k++ )
+        ellipse( m, extremes[k], Size( 3, 3), 0, 0, 360, Scalar( 255, 0, 255 ), 2, 8, 0 );
+    return r;
 }
 
 
@@ -68,10 +29,12 @@ int main( int argc, char** argv )
 }
 #endif
 
+QA_DEMO( apointSetBoundingRect )
+
 int apointSetBoundingRect(int argc, char** argv)
 {
     char* filename = argc >= 2 ? argv[1] : (char*)"24463.jpg";
-    Mat src=imread( filename, 0 );
+    Mat src=cachedImread( filename, 0 );
 
     Mat dst = Mat::zeros(src.rows, src.cols, CV_8UC3);
 
@@ -0,0 +1,169 @@
+// Bounding rect of a large integer point set, shared by the samples.
+//
+//     Mat points;
+//     findNonZero( mask, points );                   // CV_32SC2, one row per point
+//     Rect r = pointSetBounds( points );
+//
+//     Point extremes[4];                             // leftmost, rightmost, top, bottom
+//     Rect r = pointSetBounds( Mat( contour ), extremes );
+//
+// Points are read as they are stored, x and y interleaved: a min and a max over whole
+// registers leave the x extrema in the even lanes and the y extrema in the odd lanes,
+// so there is no deinterleave and no branch in the loop. The extreme points, when
+// asked, are found by a second pass that stops once all four have been seen; each is
+// the first point with its value, as in the scalar loop. Sets of more than CHUNK
+// points are split over parallel_for_.
+
+#ifndef POINT_BOUNDS_HPP
+#define POINT_BOUNDS_HPP
+
+#include <opencv2/core.hpp>
+#include <opencv2/core/utility.hpp>
+#include <opencv2/core/hal/intrin.hpp>
+#include <algorithm>
+#include <climits>
+
+namespace pointbounds
+{
+
+enum { CHUNK = 1 << 16 };
+
+// b = { xmin, ymin, xmax, ymax } of pts[0..n), n > 0
+inline void minMax( const cv::Point* pts, int n, int b[4] )
+{
+    int i = 0;
+    b[0] = b[2] = pts[0].x;
+    b[1] = b[3] = pts[0].y;
+#if CV_SIMD128
+    if( n >= 4 )
+    {
+        // two registers, four points, per step
+        const int* p = &pts[0].x;
+        cv::v_int32x4 mn0 = cv::v_load( p ), mx0 = mn0, mn1 = cv::v_load( p + 4 ), mx1 = mn1;
+        for( i = 4; i <= n - 4; i += 4 )
+        {
+            cv::v_int32x4 a = cv::v_load( p + 2 * i ), c = cv::v_load( p + 2 * i + 4 );
+            mn0 = cv::v_min( mn0, a );
+            mx0 = cv::v_max( mx0, a );
+            mn1 = cv::v_min( mn1, c );
+            mx1 = cv::v_max( mx1, c );
+        }
+        int mn[4], mx[4];
+        cv::v_store( mn, cv::v_min( mn0, mn1 ) );
+        cv::v_store( mx, cv::v_max( mx0, mx1 ) );
+        b[0] = std::min( mn[0], mn[2] );
+        b[1] = std::min( mn[1], mn[3] );
+        b[2] = std::max( mx[0], mx[2] );
+        b[3] = std::max( mx[1], mx[3] );
+    }
+#endif
+    for( ; i < n; i++ )
+    {
+        b[0] = std::min( b[0], pts[i].x );
+        b[1] = std::min( b[1], pts[i].y );
+        b[2] = std::max( b[2], pts[i].x );
+        b[3] = std::max( b[3], pts[i].y );
+    }
+}
+
+// idx[k] = first index in [begin, end) of a point on side k (xmin, xmax, ymin, ymax), or -1
+inline void findExtremes( const cv::Point* pts, int begin, int end, const int b[4], int idx[4] )
+{
+    idx[0] = idx[1] = idx[2] = idx[3] = -1;
+    int missing = 4;
+    for( int i = begin; i < end && missing > 0; i++ )
+    {
+        const cv::Point& p = pts[i];
+        if( idx[0] < 0 && p.x == b[0] ) { idx[0] = i; missing--; }
+        if( idx[1] < 0 && p.x == b[2] ) { idx[1] = i; missing--; }
+        if( idx[2] < 0 && p.y == b[1] ) { idx[2] = i; missing--; }
+        if( idx[3] < 0 && p.y == b[3] ) { idx[3] = i; missing--; }
+    }
+}
+
+class MinMaxBody : public cv::ParallelLoopBody
+{
+public:
+    MinMaxBody( const cv::Point* _pts, int _n, int* _b, cv::Mutex& _lock ) : pts( _pts ), n( _n ), b( _b ), lock( _lock ) {}
+
+    void operator()( const cv::Range& range ) const
+    {
+        int begin = range.start * CHUNK, end = std::min( range.end * CHUNK, n ), local[4];
+        minMax( pts + begin, end - begin, local );
+        cv::AutoLock l( lock );
+        b[0] = std::min( b[0], local[0] );
+        b[1] = std::min( b[1], local[1] );
+        b[2] = std::max( b[2], local[2] );
+        b[3] = std::max( b[3], local[3] );
+    }
+
+private:
+    const cv::Point* pts;
+    int n;
+    int* b;
+    cv::Mutex& lock;
+};
+
+class ExtremesBody : public cv::ParallelLoopBody
+{
+public:
+    ExtremesBody( const cv::Point* _pts, int _n, const int* _b, int* _idx, cv::Mutex& _lock )
+        : pts( _pts ), n( _n ), b( _b ), idx( _idx ), lock( _lock ) {}
+
+    void operator()( const cv::Range& range ) const
+    {
+        int local[4];
+        findExtremes( pts, range.start * CHUNK, std::min( range.end * CHUNK, n ), b, local );
+        cv::AutoLock l( lock );
+        for( int k = 0; k < 4; k++ )
+            if( local[k] >= 0 && ( idx[k] < 0 || local[k] < idx[k] ) )
+                idx[k] = local[k];
+    }
+
+private:
+    const cv::Point* pts;
+    int n;
+    const int* b;
+    int* idx;
+    cv::Mutex& lock;
+};
+
+}
+
+// Bounding rect of a CV_32SC2 point set (a vector<Point> wrapped in a Mat, or the
+// output of findNonZero). extremes, when given, receives the first leftmost,
+// rightmost, top and bottom points, in that order.
+inline cv::Rect pointSetBounds( const cv::Mat& points, cv::Point* extremes = 0 )
+{
+    if( points.empty() )
+        return cv::Rect();
+    int npoints = points.checkVector( 2, CV_32S );
+    CV_Assert( npoints >= 0 && ( npoints == 0 || points.isContinuous() ) );
+    if( npoints == 0 )
+        return cv::Rect();
+
+    const cv::Point* pts = points.ptr<cv::Point>();
+    int b[4] = { INT_MAX, INT_MAX, INT_MIN, INT_MIN }, idx[4];
+    int chunks = ( npoints + pointbounds::CHUNK - 1 ) / pointbounds::CHUNK;
+    cv::Mutex lock;
+    if( chunks > 1 )
+        cv::parallel_for_( cv::Range( 0, chunks ), pointbounds::MinMaxBody( pts, npoints, b, lock ) );
+    else
+        pointbounds::minMax( pts, npoints, b );
+
+    if( extremes )
+    {
+        if( chunks > 1 )
+        {
+            idx[0] = idx[1] = idx[2] = idx[3] = -1;
+            cv::parallel_for_( cv::Range( 0, chunks ), pointbounds::ExtremesBody( pts, npoints, b, idx, lock ) );
+        }
+        else
+            pointbounds::findExtremes( pts, 0, npoints, b, idx );
+        for( int k = 0; k < 4; k++ )
+            extremes[k] = pts[idx[k]];
+    }
+    return cv::Rect( b[0], b[1], b[2] - b[0] + 1, b[3] - b[1] + 1 );
+}
+
+#endif
@@ -0,0 +1,482 @@
+// Distances between many 2D points at once, shared by the samples.
+//
+//     PointSet set( contour );                       // x and y in separate arrays
+//     int i = nearestPoint( set, pt );               // index of the closest point
+//     distancesToPoint( set, pt, d );                // d[i] = |set[i] - pt|, or squared
+//     pairwiseDistances( a, b, D );                  // D(i, j) = |a[i] - b[j]|
+//     float d2 = farthestPair( set, i, j );          // squared diameter of the set
+//
+//     PointGrid grid( contour );                     // built once, queried many times
+//     int i = grid.nearest( pt );
+//     grid.nearest( queries, indices );              // batch, in parallel
+//     grid.knearest( pt, 5, indices );               // closest first
+//
+// Points are kept as structure of arrays so four x and four y load into two float
+// registers; the loops use universal intrinsics and fall back to plain code. The all
+// pairs kernels run over tiles of TILE points of the second set, small enough to stay
+// in L1 while a stripe of rows of the first set is compared against them, and split
+// the rows over parallel_for_.
+
+#ifndef POINT_DISTANCES_HPP
+#define POINT_DISTANCES_HPP
+
+#include <opencv2/core.hpp>
+#include <opencv2/core/utility.hpp>
+#include <opencv2/core/hal/intrin.hpp>
+#include <algorithm>
+#include <cfloat>
+#include <queue>
+#include <cmath>
+#include <vector>
+
+// distance between two points, in double as the samples used to compute it
+inline double distanceBtwPoints( const cv::Point2f& a, const cv::Point2f& b )
+{
+    double xDiff = a.x - b.x;
+    double yDiff = a.y - b.y;
+
+    return std::sqrt( ( xDiff * xDiff ) + ( yDiff * yDiff ) );
+}
+
+class PointSet
+{
+public:
+    PointSet() {}
+    template<typename T> explicit PointSet( const std::vector<cv::Point_<T> >& points ) { assign( points ); }
+
+    template<typename T> void assign( const std::vector<cv::Point_<T> >& points )
+    {
+        x.resize( points.size() );
+        y.resize( points.size() );
+        for( size_t i = 0; i < points.size(); i++ )
+        {
+            x[i] = (float)points[i].x;
+            y[i] = (float)points[i].y;
+        }
+    }
+
+    int size() const { return (int)x.size(); }
+    cv::Point2f operator[]( int i ) const { return cv::Point2f( x[i], y[i] ); }
+
+    std::vector<float> x, y;
+};
+
+namespace pointdist
+{
+
+enum { TILE = 2048 };
+
+// d[j] = squared distance from (px, py) to points [j0, j1), returns the largest
+inline float squaredRow( const float* x, const float* y, int j0, int j1, float px, float py, float* d )
+{
+    int j = j0;
+    float best = 0;
+#if CV_SIMD128
+    cv::v_float32x4 vx = cv::v_setall_f32( px ), vy = cv::v_setall_f32( py ), vbest = cv::v_setzero_f32();
+    for( ; j <= j1 - 4; j += 4 )
+    {
+        cv::v_float32x4 dx = cv::v_load( x + j ) - vx, dy = cv::v_load( y + j ) - vy;
+        cv::v_float32x4 d2 = dx * dx + dy * dy;
+        vbest = cv::v_max( vbest, d2 );
+        if( d )
+            cv::v_store( d + j - j0, d2 );
+    }
+    best = cv::v_reduce_max( vbest );
+#endif
+    for( ; j < j1; j++ )
+    {
+        float dx = x[j] - px, dy = y[j] - py, d2 = dx * dx + dy * dy;
+        best = std::max( best, d2 );
+        if( d )
+            d[j - j0] = d2;
+    }
+    return best;
+}
+
+inline void sqrtRow( float* d, int n )
+{
+    int j = 0;
+#if CV_SIMD128
+    for( ; j <= n - 4; j += 4 )
+        cv::v_store( d + j, cv::v_sqrt( cv::v_load( d + j ) ) );
+#endif
+    for( ; j < n; j++ )
+        d[j] = std::sqrt( d[j] );
+}
+
+class PairwiseBody : public cv::ParallelLoopBody
+{
+public:
+    PairwiseBody( const PointSet& _a, const PointSet& _b, cv::Mat& _D, bool _squared )
+        : a( _a ), b( _b ), D( _D ), squared( _squared ) {}
+
+    void operator()( const cv::Range& range ) const
+    {
+        for( int j0 = 0; j0 < b.size(); j0 += TILE )
+        {
+            int j1 = std::min( j0 + TILE, b.size() );
+            for( int i = range.start; i < range.end; i++ )
+            {
+                float* d = D.ptr<float>( i ) + j0;
+                squaredRow( &b.x[0], &b.y[0], j0, j1, a.x[i], a.y[i], d );
+                if( !squared )
+                    sqrtRow( d, j1 - j0 );
+            }
+        }
+    }
+
+private:
+    const PointSet &a, &b;
+    cv::Mat& D;
+    bool squared;
+};
+
+// largest squared distance between point i and points j > i, over a stripe of i
+class FarthestBody : public cv::ParallelLoopBody
+{
+public:
+    FarthestBody( const PointSet& _s, float& _best, int& _bi, int& _bj, cv::Mutex& _lock )
+        : s( _s ), best( _best ), bi( _bi ), bj( _bj ), lock( _lock ) {}
+
+    void operator()( const cv::Range& range ) const
+    {
+        const float *x = &s.x[0], *y = &s.y[0];
+        const int n = s.size();
+        float localBest = -1;
+        int li = 0, lj = 0;
+        for( int j0 = range.start + 1; j0 < n; j0 += TILE )
+        {
+            int j1 = std::min( j0 + TILE, n );
+            for( int i = range.start; i < range.end && i < j1 - 1; i++ )
+            {
+                int from = std::max( j0, i + 1 );
+                // the vector pass only finds the value, the index is looked up when it improves
+                if( squaredRow( x, y, from, j1, x[i], y[i], 0 ) <= localBest )
+                    continue;
+                for( int j = from; j < j1; j++ )
+                {
+                    float dx = x[j] - x[i], dy = y[j] - y[i], d2 = dx * dx + dy * dy;
+                    if( d2 > localBest )
+                    {
+                        localBest = d2;
+                        li = i;
+                        lj = j;
+                    }
+                }
+            }
+        }
+        cv::AutoLock l( lock );
+        if( localBest > best )
+        {
+            best = localBest;
+            bi = li;
+            bj = lj;
+        }
+    }
+
+private:
+    const PointSet& s;
+    float& best;
+    int &bi, &bj;
+    cv::Mutex& lock;
+};
+
+}
+
+// d[i] = distance from pt to set[i] (squared when asked, which skips the sqrt)
+inline void distancesToPoint( const PointSet& set, cv::Point2f pt, std::vector<float>& d, bool squared = false )
+{
+    d.resize( set.size() );
+    if( d.empty() )
+        return;
+    pointdist::squaredRow( &set.x[0], &set.y[0], 0, set.size(), pt.x, pt.y, &d[0] );
+    if( !squared )
+        pointdist::sqrtRow( &d[0], set.size() );
+}
+
+// index of the point closest to pt, -1 for an empty set; minDistance: true distance
+inline int nearestPoint( const PointSet& set, cv::Point2f pt, double* minDistance = 0 )
+{
+    const int n = set.size();
+    const float *x = n ? &set.x[0] : 0, *y = n ? &set.y[0] : 0;
+    float best = FLT_MAX;
+    int bestIndex = -1, j = 0;
+#if CV_SIMD128
+    cv::v_float32x4 vx = cv::v_setall_f32( pt.x ), vy = cv::v_setall_f32( pt.y );
+    for( ; j <= n - 4; j += 4 )
+    {
+        cv::v_float32x4 dx = cv::v_load( x + j ) - vx, dy = cv::v_load( y + j ) - vy;
+        cv::v_float32x4 d2 = dx * dx + dy * dy;
+        if( cv::v_reduce_min( d2 ) >= best )
+            continue;
+        float lanes[4];
+        cv::v_store( lanes, d2 );
+        for( int k = 0; k < 4; k++ )
+            if( lanes[k] < best )
+            {
+                best = lanes[k];
+                bestIndex = j + k;
+            }
+    }
+#endif
+    for( ; j < n; j++ )
+    {
+        float dx = x[j] - pt.x, dy = y[j] - pt.y, d2 = dx * dx + dy * dy;
+        if( d2 < best )
+        {
+            best = d2;
+            bestIndex = j;
+        }
+    }
+    if( minDistance )
+        *minDistance = bestIndex >= 0 ? std::sqrt( (double)best ) : DBL_MAX;
+    return bestIndex;
+}
+
+// D: a.size() x b.size() CV_32F, D(i, j) = distance from a[i] to b[j]
+inline void pairwiseDistances( const PointSet& a, const PointSet& b, cv::Mat& D, bool squared = false )
+{
+    D.create( a.size(), b.size(), CV_32F );
+    if( a.size() == 0 || b.size() == 0 )
+        return;
+    cv::parallel_for_( cv::Range( 0, a.size() ), pointdist::PairwiseBody( a, b, D, squared ), std::max( 1.0, a.size() / 64.0 ) );
+}
+
+// largest squared distance between two points of the set, and which points; 0 with
+// i = j = -1 for less than two points
+inline float farthestPair( const PointSet& set, int& i, int& j )
+{
+    float best = -1;
+    i = j = -1;
+    if( set.size() < 2 )
+        return 0;
+    cv::Mutex lock;
+    cv::parallel_for_( cv::Range( 0, set.size() - 1 ), pointdist::FarthestBody( set, best, i, j, lock ), std::max( 1.0, set.size() / 64.0 ) );
+    return best;
+}
+
+// Uniform grid over a point set for nearest point queries. The points are bucketed
+// into square cells (about two points per cell on average) and stored cell by cell;
+// a query visits rings of cells around its own until no unvisited cell can hold a
+// closer point. All comparisons are on squared distances.
+class PointGrid
+{
+public:
+    PointGrid() : cellSize( 1 ), invCell( 1 ), cols( 0 ), rows( 0 ) {}
+    template<typename T> explicit PointGrid( const std::vector<cv::Point_<T> >& points ) { build( points ); }
+
+    template<typename T> void build( const std::vector<cv::Point_<T> >& points )
+    {
+        const int n = (int)points.size();
+        cols = rows = 0;
+        index.clear();
+        x.clear();
+        y.clear();
+        if( n == 0 )
+            return;
+        float x0 = FLT_MAX, y0 = FLT_MAX, x1 = -FLT_MAX, y1 = -FLT_MAX;
+        for( int i = 0; i < n; i++ )
+        {
+            x0 = std::min( x0, (float)points[i].x ); x1 = std::max( x1, (float)points[i].x );
+            y0 = std::min( y0, (float)points[i].y ); y1 = std::max( y1, (float)points[i].y );
+        }
+        origin = cv::Point2f( x0, y0 );
+        float w = std::max( x1 - x0, 1.f ), h = std::max( y1 - y0, 1.f );
+        cellSize = std::max( std::sqrt( w * h * 2 / n ), std::max( w, h ) / 1024 );
+        invCell = 1 / cellSize;
+        cols = (int)( w * invCell ) + 1;
+        rows = (int)( h * invCell ) + 1;
+
+        // counting sort of the points by cell
+        std::vector<int> cellOf( n );
+        start.assign( cols * rows + 1, 0 );
+        for( int i = 0; i < n; i++ )
+        {
+            cellOf[i] = cellIndex( (float)points[i].x, (float)points[i].y );
+            start[cellOf[i] + 1]++;
+        }
+        for( size_t c = 1; c < start.size(); c++ )
+            start[c] += start[c - 1];
+        std::vector<int> fill( start.begin(), start.end() - 1 );
+        index.resize( n );
+        x.resize( n );
+        y.resize( n );
+        for( int i = 0; i < n; i++ )
+        {
+            int k = fill[cellOf[i]]++;
+            index[k] = i;
+            x[k] = (float)points[i].x;
+            y[k] = (float)points[i].y;
+        }
+    }
+
+    int size() const { return (int)index.size(); }
+
+    // index of the closest point, -1 for an empty grid; dist2: its squared distance
+    int nearest( cv::Point2f pt, float* dist2 = 0 ) const
+    {
+        float best = FLT_MAX;
+        int bestIndex = -1;
+        if( !index.empty() )
+        {
+            int cx, cy;
+            cellOf( pt, cx, cy );
+            for( int r = 0; ; r++ )
+            {
+                visitRing( cx, cy, r, pt, best, bestIndex );
+                float m = outsideDistance( pt, cx, cy, r );
+                if( ( m > 0 && best <= m * m ) || covers( cx, cy, r ) )
+                    break;
+            }
+        }
+        if( dist2 )
+            *dist2 = best;
+        return bestIndex >= 0 ? index[bestIndex] : -1;
+    }
+
+    // nearest point of every query, in parallel
+    void nearest( const std::vector<cv::Point2f>& queries, std::vector<int>& indices ) const
+    {
+        indices.resize( queries.size() );
+        cv::parallel_for_( cv::Range( 0, (int)queries.size() ), BatchBody( *this, queries, indices ), std::max( 1.0, queries.size() / 256.0 ) );
+    }
+
+    // the k closest points, closest first (fewer when the set is smaller than k)
+    void knearest( cv::Point2f pt, int k, std::vector<int>& indices, std::vector<float>* dist2 = 0 ) const
+    {
+        indices.clear();
+        if( dist2 )
+            dist2->clear();
+        if( index.empty() || k <= 0 )
+            return;
+        std::priority_queue<std::pair<float, int> > heap;   // largest of the k best on top
+        int cx, cy;
+        cellOf( pt, cx, cy );
+        for( int r = 0; ; r++ )
+        {
+            forRing( cx, cy, r, [&]( int c )
+            {
+                for( int i = start[c]; i < start[c + 1]; i++ )
+                {
+                    float dx = x[i] - pt.x, dy = y[i] - pt.y, d2 = dx * dx + dy * dy;
+                    if( (int)heap.size() < k )
+                        heap.push( std::make_pair( d2, i ) );
+                    else if( d2 < heap.top().first )
+                    {
+                        heap.pop();
+                        heap.push( std::make_pair( d2, i ) );
+                    }
+                }
+            } );
+            float m = outsideDistance( pt, cx, cy, r );
+            if( ( (int)heap.size() == k && m > 0 && heap.top().first <= m * m ) || covers( cx, cy, r ) )
+                break;
+        }
+        indices.resize( heap.size() );
+        if( dist2 )
+            dist2->resize( heap.size() );
+        for( int i = (int)heap.size() - 1; i >= 0; i-- )
+        {
+            indices[i] = index[heap.top().second];
+            if( dist2 )
+                (*dist2)[i] = heap.top().first;
+            heap.pop();
+        }
+    }
+
+private:
+    class BatchBody : public cv::ParallelLoopBody
+    {
+    public:
+        BatchBody( const PointGrid& _grid, const std::vector<cv::Point2f>& _queries, std::vector<int>& _indices )
+            : grid( _grid ), queries( _queries ), indices( _indices ) {}
+
+        void operator()( const cv::Range& range ) const
+        {
+            for( int i = range.start; i < range.end; i++ )
+                indices[i] = grid.nearest( queries[i] );
+        }
+
+    private:
+        const PointGrid& grid;
+        const std::vector<cv::Point2f>& queries;
+        std::vector<int>& indices;
+    };
+
+    int cellIndex( float px, float py ) const
+    {
+        int cx, cy;
+        cellOf( cv::Point2f( px, py ), cx, cy );
+        return cy * cols + cx;
+    }
+
+    // cell of pt, clamped to the grid for queries outside it
+    void cellOf( cv::Point2f pt, int& cx, int& cy ) const
+    {
+        cx = std::min( std::max( (int)std::floor( ( pt.x - origin.x ) * invCell ), 0 ), cols - 1 );
+        cy = std::min( std::max( (int)std::floor( ( pt.y - origin.y ) * invCell ), 0 ), rows - 1 );
+    }
+
+    // calls f( cell ) for the cells at Chebyshev distance r from (cx, cy) inside the grid
+    template<typename F> void forRing( int cx, int cy, int r, F f ) const
+    {
+        int xa = cx - r, xb = cx + r, ya = cy - r, yb = cy + r;
+        for( int gy = std::max( ya, 0 ); gy <= std::min( yb, rows - 1 ); gy++ )
+        {
+            if( gy == ya || gy == yb )
+            {
+                for( int gx = std::max( xa, 0 ); gx <= std::min( xb, cols - 1 ); gx++ )
+                    f( gy * cols + gx );
+                continue;
+            }
+            if( xa >= 0 )
+                f( gy * cols + xa );
+            if( xb < cols && xb != xa )
+                f( gy * cols + xb );
+        }
+    }
+
+    void visitRing( int cx, int cy, int r, cv::Point2f pt, float& best, int& bestIndex ) const
+    {
+        forRing( cx, cy, r, [&]( int c )
+        {
+            for( int i = start[c]; i < start[c + 1]; i++ )
+            {
+                float dx = x[i] - pt.x, dy = y[i] - pt.y, d2 = dx * dx + dy * dy;
+                if( d2 < best )
+                {
+                    best = d2;
+                    bestIndex = i;
+                }
+            }
+        } );
+    }
+
+    // distance from pt to the outside of the square of cells visited after ring r
+    // (<= 0 when pt itself is outside it)
+    float outsideDistance( cv::Point2f pt, int cx, int cy, int r ) const
+    {
+        float left = pt.x - ( origin.x + ( cx - r ) * cellSize ), right = origin.x + ( cx + r + 1 ) * cellSize - pt.x;
+        float top = pt.y - ( origin.y + ( cy - r ) * cellSize ), bottom = origin.y + ( cy + r + 1 ) * cellSize - pt.y;
+        // sides beyond the grid have nothing behind them
+        if( cx - r <= 0 ) left = FLT_MAX;
+        if( cx + r >= cols - 1 ) right = FLT_MAX;
+        if( cy - r <= 0 ) top = FLT_MAX;
+        if( cy + r >= rows - 1 ) bottom = FLT_MAX;
+        return std::min( std::min( left, right ), std::min( top, bottom ) );
+    }
+
+    bool covers( int cx, int cy, int r ) const
+    {
+        return cx - r <= 0 && cy - r <= 0 && cx + r >= cols - 1 && cy + r >= rows - 1;
+    }
+
+    cv::Point2f origin;
+    float cellSize, invCell;
+    int cols, rows;
+    std::vector<int> start;     // points of cell c: [start[c], start[c + 1])
+    std::vector<int> index;     // original index of each stored point
+    std::vector<float> x, y;    // stored cell by cell
+};
+
+#endif
@@ -0,0 +1,154 @@
+// Decodes images on a few threads ahead of the code that uses them.
+//
+//     PrefetchImageLoader loader( IMREAD_REDUCED_COLOR_2 );
+//     loader.start( filenames );              // or push() paths from another thread, then finish()
+//     String path; Mat img;
+//     while( loader.next( path, img ) )       // same order as the paths came in
+//         ...;
+//
+// At most "ahead" paths are queued, decoding or decoded but not taken yet: push()
+// waits when the window is full, so a fast producer (a glob walk) cannot run far
+// ahead of a slow consumer. Images that fail to load come out empty.
+
+#ifndef PREFETCH_LOADER_HPP
+#define PREFETCH_LOADER_HPP
+
+#include <opencv2/core.hpp>
+#include <opencv2/imgcodecs.hpp>
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class PrefetchImageLoader
+{
+public:
+    // flags: imread flags, IMREAD_REDUCED_* decode at 1/2, 1/4 or 1/8 size
+    // threads <= 0: one per hardware thread; ahead <= 0: twice the thread count
+    explicit PrefetchImageLoader( int _flags = cv::IMREAD_COLOR, int threads = 0, int _ahead = 0 )
+        : flags( _flags ), firstSeq( 0 ), nextToDecode( 0 ), finished( false ), canceled( false )
+    {
+        if( threads <= 0 )
+            threads = (int)std::max( 1u, std::thread::hardware_concurrency() );
+        ahead = _ahead > 0 ? (size_t)_ahead : (size_t)threads * 2;
+        for( int i = 0; i < threads; i++ )
+            workers.push_back( std::thread( &PrefetchImageLoader::decodeLoop, this ) );
+    }
+
+    ~PrefetchImageLoader()
+    {
+        cancel();
+        if( feeder.joinable() )
+            feeder.join();
+        for( size_t i = 0; i < workers.size(); i++ )
+            workers[i].join();
+    }
+
+    // feeds a whole list from a background thread and finishes
+    void start( const std::vector<cv::String>& paths )
+    {
+        feeder = std::thread( [this, paths]()
+        {
+            for( size_t i = 0; i < paths.size(); i++ )
+                if( !push( paths[i] ) )
+                    break;
+            finish();
+        } );
+    }
+
+    // returns false once the loader is canceled
+    bool push( const cv::String& path )
+    {
+        std::unique_lock<std::mutex> lock( mutex );
+        changed.wait( lock, [this] { return slots.size() < ahead || canceled; } );
+        if( canceled )
+            return false;
+        Slot s;
+        s.path = path;
+        s.done = false;
+        slots.push_back( s );
+        changed.notify_all();
+        return true;
+    }
+
+    // no more push() calls, next() returns false after the last image
+    void finish()
+    {
+        std::lock_guard<std::mutex> lock( mutex );
+        finished = true;
+        changed.notify_all();
+    }
+
+    void cancel()
+    {
+        std::lock_guard<std::mutex> lock( mutex );
+        canceled = true;
+        changed.notify_all();
+    }
+
+    bool next( cv::String& path, cv::Mat& image )
+    {
+        std::unique_lock<std::mutex> lock( mutex );
+        changed.wait( lock, [this] { return canceled || ( !slots.empty() && slots.front().done ) || ( finished && slots.empty() ); } );
+        if( canceled || slots.empty() )
+            return false;
+        path = slots.front().path;
+        image = slots.front().image;
+        slots.pop_front();
+        firstSeq++;
+        changed.notify_all();
+        return true;
+    }
+
+private:
+    struct Slot
+    {
+        cv::String path;
+        cv::Mat image;
+        bool done;
+    };
+
+    void decodeLoop()
+    {
+        std::unique_lock<std::mutex> lock( mutex );
+        for( ;; )
+        {
+            changed.wait( lock, [this] { return canceled || finished || nextToDecode < firstSeq + slots.size(); } );
+            if( canceled )
+                return;
+            if( nextToDecode >= firstSeq + slots.size() )
+            {
+                if( finished )
+                    return;
+                continue;
+            }
+            // the slot stays in place: next() only removes slots that are done
+            size_t seq = nextToDecode++;
+            cv::String path = slots[seq - firstSeq].path;
+            lock.unlock();
+            cv::Mat image = cv::imread( path, flags );
+            lock.lock();
+            if( canceled )
+                return;
+            Slot& s = slots[seq - firstSeq];
+            s.image = image;
+            s.done = true;
+            changed.notify_all();
+        }
+    }
+
+    int flags;
+    size_t ahead;
+    std::deque<Slot> slots;
+    size_t firstSeq;        // sequence number of slots.front()
+    size_t nextToDecode;    // sequence number of the first slot no worker has taken
+    bool finished, canceled;
+    std::mutex mutex;
+    std::condition_variable changed;
+    std::vector<std::thread> workers;
+    std::thread feeder;
+};
+
+#endif
@@ -1,5 +1,14 @@
+#ifndef QA_HPP
+#define QA_HPP
+
 #define QA_MULTI_DEMO true
 
+#include <opencv2/core.hpp>
+#include <opencv2/highgui.hpp>
+#include <atomic>
+#include <functional>
+#include <string>
+#include <vector>
 
 int a1( int argc, char** argv );
 int a5147( int argc, char** argv );
@@ -7,6 +16,7 @@ int bitwisesample( int argc, char** argv );
 int apointSetBoundingRect( int argc, char** argv );
 bool detectAndDrawChessboardCorners();
 bool detectAndDrawCentersOfCircles();
+int acalibrationFrontEnd( int argc, char** argv );
 int a25912( int argc, char** argv );
 int a69434( int argc, char** argv );
 int a24463( int argc, char** argv );
@@ -20,3 +30,124 @@ int a68942( int argc, char** argv );
 int a66209( int argc, char** argv );
 int a4183( int argc, char** argv );
 int so32584486(int argc, char** argv);
+
+// Demo registry and headless GUI, for the runner in main.cpp.
+//
+//     int a68942( int argc, char** argv )
+//     { ... }
+//     QA_DEMO( a68942 )                              // once, in the demo's own file
+//
+// Every entry point registers itself before main() runs; qa::demos() lists them.
+// With qa::setHeadless( true ) the highgui calls of the files including this header
+// return at once: imshow and the window functions do nothing, waitKey returns 27
+// (ESC) so interactive loops end, trackbars and mouse callbacks are not installed.
+// The calls are redirected by the macros at the end of this file, defined after
+// highgui's own declarations, so the demos keep calling imshow( ... ) or
+// cv::imshow( ... ) unchanged.
+
+namespace qa
+{
+
+struct Demo
+{
+    std::string name;
+    std::function<int( int, char** )> run;
+};
+
+inline std::vector<Demo>& demos()
+{
+    static std::vector<Demo> registry;
+    return registry;
+}
+
+inline std::atomic<bool>& headlessFlag()
+{
+    static std::atomic<bool> flag( false );
+    return flag;
+}
+
+inline void setHeadless( bool on ) { headlessFlag() = on; }
+inline bool headless() { return headlessFlag(); }
+
+struct Registrar
+{
+    Registrar( const char* name, int (*entry)( int, char** ) )
+    {
+        Demo d = { name, entry };
+        demos().push_back( d );
+    }
+
+    // bool entry points return true on success
+    Registrar( const char* name, bool (*entry)() )
+    {
+        Demo d = { name, [entry]( int, char** ) { return entry() ? 0 : 1; } };
+        demos().push_back( d );
+    }
+};
+
+}
+
+#define QA_DEMO( entry ) static qa::Registrar qa_demo_##entry( #entry, entry );
+
+namespace cv
+{
+
+inline void qaImshow( const String& winname, InputArray mat )
+{
+    if( !qa::headless() )
+        imshow( winname, mat );
+}
+
+inline int qaWaitKey( int delay = 0 )
+{
+    return qa::headless() ? 27 : waitKey( delay );
+}
+
+inline void qaNamedWindow( const String& winname, int flags = WINDOW_AUTOSIZE )
+{
+    if( !qa::headless() )
+        namedWindow( winname, flags );
+}
+
+inline void qaMoveWindow( const String& winname, int x, int y )
+{
+    if( !qa::headless() )
+        moveWindow( winname, x, y );
+}
+
+inline void qaDestroyWindow( const String& winname )
+{
+    if( !qa::headless() )
+        destroyWindow( winname );
+}
+
+inline void qaDestroyAllWindows()
+{
+    if( !qa::headless() )
+        destroyAllWindows();
+}
+
+inline int qaCreateTrackbar( const String& trackbarname, const String& winname, int* value, int count,
+                             TrackbarCallback onChange = 0, void* userdata = 0 )
+{
+    return qa::headless() ? 0 : createTrackbar( trackbarname, winname, value, count, onChange, userdata );
+}
+
+inline void qaSetMouseCallback( const String& winname, MouseCallback onMouse, void* userdata = 0 )
+{
+    if( !qa::headless() )
+        setMouseCallback( winname, onMouse, userdata );
+}
+
+}
+
+#define imshow qaImshow
+#define waitKey qaWaitKey
+#define namedWindow qaNamedWindow
+#define moveWindow qaMoveWindow
+#define destroyWindow qaDestroyWindow
+#define destroyAllWindows qaDestroyAllWindows
+#define createTrackbar qaCreateTrackbar
+#define setMouseCallback qaSetMouseCallback
+
+#endif
@@ -4,9 +4,9 @@
  */
 #include <opencv2/imgproc/imgproc.hpp>
 #include <opencv2/highgui/highgui.hpp>
+#include <algorithm>
 #include <iostream>
-
-cv::Point2f center(0,0);
+#include <string>
 
 cv::Point2f computeIntersect(cv::Vec4i a,
                              cv::Vec4i b)
@@ -53,58 +53,230 @@ void sortCorners(std::vector<cv::Point2f>& corners,
 	}
 }
 
-int main( int argc, const char** argv )
+// orientation of a segment in degrees, in [0, 180)
+static float lineAngle(const cv::Vec4i& v)
 {
-	cv::Mat src = cv::imread(argv[1]);
-	if (src.empty())
-		return -1;
+	float a = cv::fastAtan2((float)(v[3] - v[1]), (float)(v[2] - v[0]));
+	return a >= 180 ? a - 180 : a;
+}
 
-	cv::Mat bw;
-	cv::cvtColor(src, bw, CV_BGR2GRAY);
-	cv::blur(bw, bw, cv::Size(3, 3));
-	cv::Canny(bw, bw, 100, 100, 3);
+class IntersectBody : public cv::ParallelLoopBody
+{
+public:
+	IntersectBody(const std::vector<cv::Vec4i>& _lines, const std::vector<cv::Vec2i>& _pairs,
+	              std::vector<cv::Point2f>& _points)
+		: lines(_lines), pairs(_pairs), points(_points) {}
 
-	std::vector<cv::Vec4i> lines;
-	cv::HoughLinesP(bw, lines, 1, CV_PI/180, 70, 30, 10);
+	void operator()(const cv::Range& range) const
+	{
+		for (int k = range.start; k < range.end; k++)
+			points[k] = computeIntersect(lines[pairs[k][0]], lines[pairs[k][1]]);
+	}
 
-	// Expand the lines
+private:
+	const std::vector<cv::Vec4i>& lines;
+	const std::vector<cv::Vec2i>& pairs;
+	std::vector<cv::Point2f>& points;
+};
+
+// Intersections of the lines that cross at minAngle degrees or more. The lines are
+// put in orientation buckets first, so near parallel lines are never paired; the
+// corners come out in the order of the all pairs loop (i < j).
+void findCorners(const std::vector<cv::Vec4i>& lines, const std::vector<float>& angles,
+                 std::vector<cv::Point2f>& corners, float minAngle = 30, int nbuckets = 18)
+{
+	const float width = 180.f / nbuckets;
+	std::vector<std::vector<int> > buckets(nbuckets);
+	std::vector<int> bucketOf(lines.size());
 	for (int i = 0; i < lines.size(); i++)
 	{
-		cv::Vec4i v = lines[i];
-		lines[i][0] = 0;
-		lines[i][1] = ((float)v[1] - v[3]) / (v[0] - v[2]) * -v[0] + v[1];
-		lines[i][2] = src.cols;
-		lines[i][3] = ((float)v[1] - v[3]) / (v[0] - v[2]) * (src.cols - v[2]) + v[3];
+		bucketOf[i] = std::min((int)(angles[i] / width), nbuckets - 1);
+		buckets[bucketOf[i]].push_back(i);
 	}
 
-	std::vector<cv::Point2f> corners;
+	// bucket pairs that may hold two lines minAngle apart (directions wrap at 180)
+	std::vector<std::vector<int> > partners(nbuckets);
+	for (int a = 0; a < nbuckets; a++)
+		for (int b = 0; b < nbuckets; b++)
+		{
+			int d = std::abs(a - b);
+			d = std::min(d, nbuckets - d);
+			if ((d + 1) * width >= minAngle)
+				partners[a].push_back(b);
+		}
+
+	std::vector<cv::Vec2i> pairs;
+	std::vector<int> js;
+	for (int i = 0; i < lines.size(); i++)
+	{
+		js.clear();
+		const std::vector<int>& p = partners[bucketOf[i]];
+		for (int b = 0; b < p.size(); b++)
+			for (int k = 0; k < buckets[p[b]].size(); k++)
+			{
+				int j = buckets[p[b]][k];
+				float d = std::abs(angles[i] - angles[j]);
+				if (j > i && std::min(d, 180 - d) >= minAngle)
+					js.push_back(j);
+			}
+		std::sort(js.begin(), js.end());
+		for (int k = 0; k < js.size(); k++)
+			pairs.push_back(cv::Vec2i(i, js[k]));
+	}
+
+	std::vector<cv::Point2f> points(pairs.size());
+	cv::parallel_for_(cv::Range(0, (int)pairs.size()), IntersectBody(lines, pairs, points),
+	                  std::max(1.0, pairs.size() / 1024.0));
+	corners.clear();
+	for (int k = 0; k < points.size(); k++)
+		if (points[k].x >= 0 && points[k].y >= 0)
+			corners.push_back(points[k]);
+}
+
+// The quad of the tutorial, in one image: Canny + Hough lines, expanded over the
+// image width, their crossings, then the 4 sorted corners (tl, tr, br, bl).
+// lines and center are returned for drawing. gray and edges are work buffers.
+bool detectQuad(const cv::Mat& src, std::vector<cv::Point2f>& corners, std::vector<cv::Vec4i>& lines,
+                cv::Point2f& center, cv::Mat& gray, cv::Mat& edges)
+{
+	cv::cvtColor(src, gray, CV_BGR2GRAY);
+	cv::blur(gray, gray, cv::Size(3, 3));
+	cv::Canny(gray, edges, 100, 100, 3);
+	cv::HoughLinesP(edges, lines, 1, CV_PI/180, 70, 30, 10);
+
+	// Expand the lines; a vertical one spans the image height instead
+	std::vector<float> angles(lines.size());
 	for (int i = 0; i < lines.size(); i++)
 	{
-		for (int j = i+1; j < lines.size(); j++)
+		cv::Vec4i v = lines[i];
+		angles[i] = lineAngle(v);
+		if (v[0] == v[2])
 		{
-			cv::Point2f pt = computeIntersect(lines[i], lines[j]);
-			if (pt.x >= 0 && pt.y >= 0)
-				corners.push_back(pt);
+			lines[i] = cv::Vec4i(v[0], 0, v[0], src.rows);
+			continue;
 		}
+		lines[i][0] = 0;
+		lines[i][1] = ((float)v[1] - v[3]) / (v[0] - v[2]) * -v[0] + v[1];
+		lines[i][2] = src.cols;
+		lines[i][3] = ((float)v[1] - v[3]) / (v[0] - v[2]) * (src.cols - v[2]) + v[3];
 	}
 
+	findCorners(lines, angles, corners);
+	if (corners.size() < 4)
+		return false;
+
 	std::vector<cv::Point2f> approx;
 	cv::approxPolyDP(cv::Mat(corners), approx, cv::arcLength(cv::Mat(corners), true) * 0.02, true);
-
 	if (approx.size() != 4)
-	{
-		std::cout << "The object is not quadrilateral!" << std::endl;
-		return -1;
-	}
+		return false;
 
 	// Get mass center
+	center = cv::Point2f(0, 0);
 	for (int i = 0; i < corners.size(); i++)
 		center += corners[i];
 	center *= (1. / corners.size());
 
 	sortCorners(corners, center);
-	if (corners.size() == 0){
-		std::cout << "The corners were not sorted correctly!" << std::endl;
+	return corners.size() == 4;
+}
+
+// Video mode: once a quad is found, the next frame is searched only around it, in
+// the bounding box of the previous corners grown by margin (a fraction of its size).
+// When the quad is lost there, the full frame is searched again.
+class QuadTracker
+{
+public:
+	explicit QuadTracker(float _margin = 0.15f) : margin(_margin) {}
+
+	bool track(const cv::Mat& frame, std::vector<cv::Point2f>& corners)
+	{
+		cv::Rect full(0, 0, frame.cols, frame.rows);
+		if (!previous.empty())
+		{
+			cv::Rect r = cv::boundingRect(previous);
+			int dx = (int)(r.width * margin) + 8, dy = (int)(r.height * margin) + 8;
+			roi = cv::Rect(r.x - dx, r.y - dy, r.width + 2 * dx, r.height + 2 * dy) & full;
+			if (detectIn(frame, roi, corners))
+				return true;
+		}
+		roi = full;
+		if (detectIn(frame, roi, corners))
+			return true;
+		previous.clear();
+		return false;
+	}
+
+	// the part of the last frame that was searched
+	cv::Rect searched() const { return roi; }
+
+private:
+	bool detectIn(const cv::Mat& frame, const cv::Rect& r, std::vector<cv::Point2f>& corners)
+	{
+		cv::Point2f center;
+		if (r.area() == 0 || !detectQuad(frame(r), corners, lines, center, gray, edges))
+			return false;
+		for (int i = 0; i < corners.size(); i++)
+			corners[i] += cv::Point2f((float)r.x, (float)r.y);
+		previous = corners;
+		return true;
+	}
+
+	float margin;
+	cv::Rect roi;
+	std::vector<cv::Point2f> previous;
+	std::vector<cv::Vec4i> lines;
+	cv::Mat gray, edges;
+};
+
+// usage: quad-segmentation image
+//        quad-segmentation --video [file]      (camera 0 without a file)
+int main( int argc, const char** argv )
+{
+	if (argc > 1 && std::string(argv[1]) == "--video")
+	{
+		cv::VideoCapture cap;
+		if (argc > 2)
+			cap.open(argv[2]);
+		else
+			cap.open(0);
+		if (!cap.isOpened())
+			return -1;
+
+		QuadTracker tracker;
+		cv::Mat frame;
+		std::vector<cv::Point2f> corners;
+		cv::TickMeter tm;
+		for (;;)
+		{
+			cap >> frame;
+			if (frame.empty())
+				break;
+			tm.start();
+			bool found = tracker.track(frame, corners);
+			tm.stop();
+			cv::rectangle(frame, tracker.searched(), CV_RGB(255,255,0), 1);
+			for (int i = 0; found && i < 4; i++)
+				cv::line(frame, corners[i], corners[(i + 1) % 4], CV_RGB(0,255,0), 2);
+			cv::putText(frame, cv::format("%.1f ms", tm.getTimeMilli() / tm.getCounter()), cv::Point(10, 30),
+			            cv::FONT_HERSHEY_SIMPLEX, 0.8, CV_RGB(255,0,0), 2);
+			cv::imshow("quadrilateral tracking", frame);
+			if (cv::waitKey(1) == 27)
+				break;
+		}
+		return 0;
+	}
+
+	cv::Mat src = cv::imread(argv[1]);
+	if (src.empty())
+		return -1;
+
+	cv::Mat gray, edges;
+	std::vector<cv::Vec4i> lines;
+	std::vector<cv::Point2f> corners;
+	cv::Point2f center;
+	if (!detectQuad(src, corners, lines, center, gray, edges))
+	{
+		std::cout << "The object is not quadrilateral!" << std::endl;
 		return -1;
 	}
 	cv::Mat dst = src.clone();
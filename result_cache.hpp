@@ -0,0 +1,290 @@
+// Results of a batch job kept between runs, so a rerun only processes what changed: the
+// plates of licence-plate.cpp's batch mode and the samples and features of trainSVM.cpp.
+//
+//     ResultCache cache( "plates.cache", "segment v3 svm=" + svmHash );   // the parameters as text
+//     vector<ResultCache::Key> keys = cache.keys( files );                 // hashed in parallel
+//     for( size_t i = 0; i < files.size(); i++ )
+//     {
+//         vector<Mat> fields;
+//         if( !cache.lookup( keys[i], fields ) )
+//         {
+//             fields.push_back( Mat( rects ).reshape( 1 ) );                // N x 4 CV_32S
+//             fields.push_back( descriptors );
+//             cache.store( keys[i], fields );
+//         }
+//     }
+//     cache.save();
+//
+// A result is found by the hash of the file content and the hash of the parameters, so
+// a renamed or touched file is still found and a changed one, or new parameters, is
+// computed again. The store is a MatContainer file (mat_container.hpp) mapped at load:
+// every result is a few Mats named "<key>.<field>", written packed on 16 byte
+// boundaries, and lookup() returns views into the mapping without reading the rest of
+// the file. save() writes the results looked up or stored since the load, so entries
+// for deleted files or old parameters disappear after one run, to a temporary file
+// that then replaces the store: a run that is interrupted leaves the old one intact.
+//
+// The hash is 64 bits over 8 byte words with the finaliser of MurmurHash3, not a
+// cryptographic one: two different files have one chance in 2^64 to be confused,
+// which is fine for a cache but not against someone making collisions on purpose.
+// lookup() and store() are thread safe; the views of lookup() are valid until save().
+
+#ifndef RESULT_CACHE_HPP
+#define RESULT_CACHE_HPP
+
+#include <opencv2/core.hpp>
+#include <opencv2/core/utility.hpp>
+#include "mat_container.hpp"
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace resultcache
+{
+
+inline uint64 fmix( uint64 h )
+{
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDULL;
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+// streamed hash; add() takes multiples of 8 bytes except for the last call
+class Hasher
+{
+public:
+    explicit Hasher( uint64 seed = 0 ) : h( seed ), length( 0 ) {}
+
+    void add( const void* data, size_t size )
+    {
+        const uchar* p = (const uchar*)data;
+        size_t i = 0;
+        for( ; i + 8 <= size; i += 8 )
+        {
+            uint64 w;
+            memcpy( &w, p + i, 8 );
+            h = ( h ^ fmix( w ) ) * 0x9E3779B97F4A7C15ULL;
+            h = ( h << 27 ) | ( h >> 37 );
+        }
+        if( i < size )
+        {
+            uint64 w = 0;
+            memcpy( &w, p + i, size - i );
+            h = ( h ^ fmix( w ) ) * 0x9E3779B97F4A7C15ULL;
+        }
+        length += size;
+    }
+
+    uint64 value() const { return fmix( h ^ length ); }
+
+private:
+    uint64 h, length;
+};
+
+inline uint64 hashString( const std::string& s )
+{
+    Hasher h;
+    h.add( s.data(), s.size() );
+    return h.value();
+}
+
+// the hash of a file's content, false when it cannot be read
+inline bool hashFile( const std::string& path, uint64& value )
+{
+    FILE* f = fopen( path.c_str(), "rb" );
+    if( !f )
+        return false;
+    std::vector<uchar> buffer( 1 << 20 );
+    Hasher h;
+    size_t n;
+    while( ( n = fread( &buffer[0], 1, buffer.size(), f ) ) > 0 )
+        h.add( &buffer[0], n );
+    bool ok = !ferror( f );
+    fclose( f );
+    value = h.value();
+    return ok;
+}
+
+}
+
+class ResultCache
+{
+public:
+    struct Key
+    {
+        uint64 content, params;
+        bool valid;    // false when the file could not be read: never found, never stored
+
+        // 32 hex digits
+        std::string name() const { return cv::format( "%016llx%016llx", (unsigned long long)content, (unsigned long long)params ); }
+    };
+
+    ResultCache( const std::string& _path, const std::string& parameters )
+        : path( _path ), params( resultcache::hashString( parameters ) ), hits( 0 ), misses( 0 )
+    {
+        load();
+    }
+
+    // the keys of files, hashed in parallel
+    std::vector<Key> keys( const std::vector<cv::String>& files ) const
+    {
+        std::vector<Key> result( files.size() );
+        cv::parallel_for_( cv::Range( 0, (int)files.size() ), KeyBody( files, params, result ) );
+        return result;
+    }
+
+    Key key( const std::string& file ) const
+    {
+        Key k;
+        k.params = params;
+        k.valid = resultcache::hashFile( file, k.content );
+        return k;
+    }
+
+    bool lookup( const Key& key, std::vector<cv::Mat>& fields )
+    {
+        fields.clear();
+        if( !key.valid )
+            return false;
+        std::string name = key.name();
+        std::lock_guard<std::mutex> lock( mutex );
+        std::map<std::string, std::vector<cv::Mat> >::const_iterator f = fresh.find( name );
+        if( f != fresh.end() )
+            fields = f->second;
+        else
+        {
+            std::unordered_map<std::string, std::pair<int, int> >::const_iterator e = index.find( name );
+            if( e == index.end() )
+            {
+                misses++;
+                return false;
+            }
+            for( int i = 0; i < e->second.second; i++ )
+                fields.push_back( stored.get( e->second.first + i ) );
+            used.insert( name );
+        }
+        hits++;
+        return true;
+    }
+
+    // the fields are copied
+    void store( const Key& key, const std::vector<cv::Mat>& fields )
+    {
+        if( !key.valid )
+            return;
+        std::vector<cv::Mat> copies( fields.size() );
+        for( size_t i = 0; i < fields.size(); i++ )
+            copies[i] = fields[i].clone();
+        std::lock_guard<std::mutex> lock( mutex );
+        fresh[key.name()].swap( copies );
+    }
+
+    // writes the results used and stored since the load and loads the new store
+    bool save()
+    {
+        std::lock_guard<std::mutex> lock( mutex );
+        MatContainerWriter writer( 16 );
+        for( std::unordered_set<std::string>::const_iterator u = used.begin(); u != used.end(); ++u )
+        {
+            if( fresh.count( *u ) )
+                continue;
+            const std::pair<int, int>& e = index[*u];
+            for( int i = 0; i < e.second; i++ )
+                writer.add( cv::format( "%s.%d", u->c_str(), i ), stored.get( e.first + i ) );
+        }
+        for( std::map<std::string, std::vector<cv::Mat> >::const_iterator f = fresh.begin(); f != fresh.end(); ++f )
+            for( size_t i = 0; i < f->second.size(); i++ )
+                writer.add( cv::format( "%s.%d", f->first.c_str(), (int)i ), f->second[i] );
+        std::string temporary = path + ".tmp";
+        if( !writer.write( temporary ) )
+        {
+            remove( temporary.c_str() );
+            return false;
+        }
+        // the mapping is closed first: Windows does not replace a mapped file
+        stored.close();
+        bool ok = replaceFile( temporary, path );
+        if( !ok )
+            remove( temporary.c_str() );
+        load();
+        return ok;
+    }
+
+    int hitCount() const { return hits; }
+    int missCount() const { return misses; }
+    int size() const { return (int)index.size(); }   // results in the loaded store
+
+private:
+    class KeyBody : public cv::ParallelLoopBody
+    {
+    public:
+        KeyBody( const std::vector<cv::String>& _files, uint64 _params, std::vector<Key>& _keys )
+            : files( _files ), params( _params ), keys( _keys ) {}
+
+        void operator()( const cv::Range& range ) const
+        {
+            for( int i = range.start; i < range.end; i++ )
+            {
+                keys[i].params = params;
+                keys[i].valid = resultcache::hashFile( files[i], keys[i].content );
+            }
+        }
+
+    private:
+        const std::vector<cv::String>& files;
+        uint64 params;
+        std::vector<Key>& keys;
+    };
+
+    // to is replaced by from in one step, to stays as it was when that fails
+    static bool replaceFile( const std::string& from, const std::string& to )
+    {
+#ifdef _WIN32
+        return MoveFileExA( from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH ) != 0;
+#else
+        return rename( from.c_str(), to.c_str() ) == 0;
+#endif
+    }
+
+    // the store is missing or unreadable on the first run: it starts empty
+    void load()
+    {
+        index.clear();
+        used.clear();
+        fresh.clear();
+        if( !stored.open( path ) )
+            return;
+        // the fields of a result are consecutive entries "<key>.0", "<key>.1", ...
+        for( int i = 0; i < stored.count(); i++ )
+        {
+            std::string name = stored.name( i );
+            size_t dot = name.find( '.' );
+            if( dot == std::string::npos )
+                continue;
+            std::pair<int, int>& e = index.insert( std::make_pair( name.substr( 0, dot ), std::make_pair( i, 0 ) ) ).first->second;
+            e.second++;
+        }
+    }
+
+    std::string path;
+    uint64 params;
+    MappedMatFile stored;
+    std::unordered_map<std::string, std::pair<int, int> > index;   // key -> first entry, number of fields
+    std::unordered_set<std::string> used;                           // loaded entries to keep
+    std::map<std::string, std::vector<cv::Mat> > fresh;             // stored since the load
+    std::mutex mutex;
+    std::atomic<int> hits, misses;
+};
+
+#endif
@@ -0,0 +1,567 @@
+// Run length encoded binary masks, for sparse foreground.
+//
+//     RleMask fg = RleMask::threshold( gray, 200, THRESH_BINARY_INV );   // no 8 bit mask made
+//     Rect r = fg.boundingRect();
+//     int n = fg.countNonZero();
+//     RleMask both = fg & RleMask::fromMat( roiMask );                  // |, ^ and - as well
+//
+//     Mat stats, centroids;                          // as connectedComponentsWithStats
+//     int labels = fg.label( stats, centroids );
+//
+//     vector<vector<Point> > contours;               // as findContours, RETR_EXTERNAL,
+//     vector<Vec4i> hierarchy;                       // RETR_LIST or RETR_CCOMP
+//     fg.findContours( contours, hierarchy, RETR_CCOMP, CHAIN_APPROX_SIMPLE );
+//
+//     Mat mask;
+//     fg.toMat( mask );                              // back to 0 / 255 when needed
+//
+// A mask is the list of its runs of foreground, [x0, x1) on each row, in raster order,
+// with the index of the first run of every row: memory and analytics grow with the
+// number of runs instead of the number of pixels. threshold() encodes straight from
+// the gray image, 16 pixels at a time with SIMD while a row stays in the same state,
+// rows in parallel stripes. The boolean operators merge the runs row by row.
+// label() joins overlapping runs of consecutive rows with union-find and numbers the
+// components in raster order, as connectedComponents does. findContours() traces
+// each component alone in a buffer of its bounding rect, so the cost follows the
+// foreground; with RETR_EXTERNAL a component is dropped when the background above its
+// first pixel is a hole of another one, found by labeling the background runs.
+
+#ifndef RLE_MASK_HPP
+#define RLE_MASK_HPP
+
+#include <opencv2/core.hpp>
+#include <opencv2/core/utility.hpp>
+#include <opencv2/core/hal/intrin.hpp>
+#include <opencv2/imgproc.hpp>
+#include <algorithm>
+#include <climits>
+#include <vector>
+
+struct RleRun
+{
+    int x0, x1;                // [x0, x1)
+};
+
+namespace rle
+{
+
+inline int find( std::vector<int>& parent, int i )
+{
+    while( parent[i] != i )
+        i = parent[i] = parent[parent[i]];
+    return i;
+}
+
+inline void unite( std::vector<int>& parent, int a, int b )
+{
+    a = find( parent, a );
+    b = find( parent, b );
+    // the smaller index stays the root, the first run of a component in raster order
+    if( a < b )
+        parent[b] = a;
+    else if( b < a )
+        parent[a] = b;
+}
+
+// joins the runs of two consecutive rows that touch; reach 1 for 8, 0 for 4-connectivity
+inline void joinRows( const RleRun* a, int na, int baseA, const RleRun* b, int nb, int baseB, int reach, std::vector<int>& parent )
+{
+    int i = 0, j = 0;
+    while( i < na && j < nb )
+    {
+        if( a[i].x0 < b[j].x1 + reach && b[j].x0 < a[i].x1 + reach )
+            unite( parent, baseA + i, baseB + j );
+        if( a[i].x1 < b[j].x1 )
+            i++;
+        else
+            j++;
+    }
+}
+
+// the runs of one row of an 8 bit image, where ( p[x] > t ) != inv
+inline void encodeRow( const uchar* p, int cols, int t, bool inv, std::vector<RleRun>& runs )
+{
+    int x = 0;
+    bool in = false;
+    RleRun r = { 0, 0 };
+#if CV_SIMD128
+    const cv::v_uint8x16 vt = cv::v_setall_u8( (uchar)t );
+#endif
+    while( x < cols )
+    {
+#if CV_SIMD128
+        // whole registers in the current state are skipped
+        for( ; x <= cols - 16; x += 16 )
+        {
+            cv::v_uint8x16 fg = cv::v_load( p + x ) > vt;
+            if( inv )
+                fg = ~fg;
+            if( in ? !cv::v_check_all( fg ) : cv::v_check_any( fg ) )
+                break;
+        }
+#endif
+        int end = std::min( cols, x + 16 );
+        for( ; x < end; x++ )
+        {
+            bool v = ( p[x] > t ) != inv;
+            if( v == in )
+                continue;
+            if( v )
+                r.x0 = x;
+            else
+            {
+                r.x1 = x;
+                runs.push_back( r );
+            }
+            in = v;
+        }
+    }
+    if( in )
+    {
+        r.x1 = cols;
+        runs.push_back( r );
+    }
+}
+
+class EncodeBody : public cv::ParallelLoopBody
+{
+public:
+    EncodeBody( const cv::Mat& _gray, int _t, bool _inv, int _stripe, std::vector<std::vector<RleRun> >& _runs, std::vector<int>& _counts )
+        : gray( _gray ), t( _t ), inv( _inv ), stripe( _stripe ), runs( _runs ), counts( _counts ) {}
+
+    void operator()( const cv::Range& range ) const
+    {
+        for( int s = range.start; s < range.end; s++ )
+            for( int y = s * stripe; y < std::min( gray.rows, ( s + 1 ) * stripe ); y++ )
+            {
+                size_t before = runs[s].size();
+                encodeRow( gray.ptr<uchar>( y ), gray.cols, t, inv, runs[s] );
+                counts[y] = (int)( runs[s].size() - before );
+            }
+    }
+
+private:
+    const cv::Mat& gray;
+    int t;
+    bool inv;
+    int stripe;
+    std::vector<std::vector<RleRun> >& runs;
+    std::vector<int>& counts;
+};
+
+}
+
+class RleMask
+{
+public:
+    RleMask() : rowStart( 1, 0 ) {}
+    explicit RleMask( cv::Size _size ) : sz( _size ), rowStart( _size.height + 1, 0 ) {}
+
+    // pixels of gray above thresh, or at most thresh with THRESH_BINARY_INV
+    static RleMask threshold( const cv::Mat& gray, double thresh, int type = cv::THRESH_BINARY )
+    {
+        CV_Assert( gray.type() == CV_8UC1 && ( type == cv::THRESH_BINARY || type == cv::THRESH_BINARY_INV ) );
+        bool inv = type == cv::THRESH_BINARY_INV;
+        int t = cvFloor( thresh );
+        RleMask m( gray.size() );
+        // below 0 or from 255 on every pixel is on the same side
+        if( t < 0 || t >= 255 )
+        {
+            if( ( t < 0 ) != inv )
+                for( int y = 0; y < gray.rows; y++ )
+                    m.addRun( y, 0, gray.cols );
+            m.close( gray.rows );
+            return m;
+        }
+        const int stripe = 32;
+        int stripes = ( gray.rows + stripe - 1 ) / stripe;
+        std::vector<std::vector<RleRun> > parts( stripes );
+        std::vector<int> counts( gray.rows, 0 );
+        cv::parallel_for_( cv::Range( 0, stripes ), rle::EncodeBody( gray, t, inv, stripe, parts, counts ) );
+        for( int s = 0; s < stripes; s++ )
+            m.runList.insert( m.runList.end(), parts[s].begin(), parts[s].end() );
+        for( int y = 0; y < gray.rows; y++ )
+            m.rowStart[y + 1] = m.rowStart[y] + counts[y];
+        return m;
+    }
+
+    // the nonzero pixels of a CV_8UC1 mask
+    static RleMask fromMat( const cv::Mat& mask )
+    {
+        return threshold( mask, 0, cv::THRESH_BINARY );
+    }
+
+    void toMat( cv::Mat& dst ) const
+    {
+        dst.create( sz, CV_8UC1 );
+        dst.setTo( cv::Scalar::all( 0 ) );
+        for( int y = 0; y < sz.height; y++ )
+        {
+            uchar* d = dst.ptr<uchar>( y );
+            for( int i = rowStart[y]; i < rowStart[y + 1]; i++ )
+                std::fill( d + runList[i].x0, d + runList[i].x1, (uchar)255 );
+        }
+    }
+
+    cv::Size size() const { return sz; }
+    bool empty() const { return runList.empty(); }
+    size_t runCount() const { return runList.size(); }
+
+    // the runs of row y
+    const RleRun* row( int y, int& n ) const
+    {
+        n = rowStart[y + 1] - rowStart[y];
+        return runList.data() + rowStart[y];
+    }
+
+    int countNonZero() const
+    {
+        int n = 0;
+        for( size_t i = 0; i < runList.size(); i++ )
+            n += runList[i].x1 - runList[i].x0;
+        return n;
+    }
+
+    cv::Rect boundingRect() const
+    {
+        int y0 = 0, y1 = sz.height;
+        while( y0 < y1 && rowStart[y0 + 1] == rowStart[y0] )
+            y0++;
+        while( y1 > y0 && rowStart[y1] == rowStart[y1 - 1] )
+            y1--;
+        if( y0 == y1 )
+            return cv::Rect();
+        int x0 = sz.width, x1 = 0;
+        for( int y = y0; y < y1; y++ )
+            if( rowStart[y + 1] > rowStart[y] )
+            {
+                x0 = std::min( x0, runList[rowStart[y]].x0 );
+                x1 = std::max( x1, runList[rowStart[y + 1] - 1].x1 );
+            }
+        return cv::Rect( x0, y0, x1 - x0, y1 - y0 );
+    }
+
+    void findNonZero( std::vector<cv::Point>& points ) const
+    {
+        points.clear();
+        points.reserve( countNonZero() );
+        for( int y = 0; y < sz.height; y++ )
+            for( int i = rowStart[y]; i < rowStart[y + 1]; i++ )
+                for( int x = runList[i].x0; x < runList[i].x1; x++ )
+                    points.push_back( cv::Point( x, y ) );
+    }
+
+    RleMask operator&( const RleMask& b ) const { return combine( *this, b, AND ); }
+    RleMask operator|( const RleMask& b ) const { return combine( *this, b, OR ); }
+    RleMask operator^( const RleMask& b ) const { return combine( *this, b, XOR ); }
+    RleMask operator-( const RleMask& b ) const { return combine( *this, b, SUB ); }
+
+    // Labels of the components; stats and centroids as connectedComponentsWithStats,
+    // row 0 the background. runLabels, when given, gets the label of every run.
+    int label( cv::Mat& stats, cv::Mat& centroids, int connectivity = 8, std::vector<int>* runLabels = 0 ) const
+    {
+        CV_Assert( connectivity == 8 || connectivity == 4 );
+        std::vector<int> labels;
+        int n = labelRuns( connectivity == 8 ? 1 : 0, labels );
+        stats.create( n + 1, 5, CV_32S );
+        centroids.create( n + 1, 2, CV_64F );
+        std::vector<double> sx( n + 1, 0 ), sy( n + 1, 0 );
+        std::vector<int> box( ( n + 1 ) * 4 );
+        for( int k = 0; k <= n; k++ )
+        {
+            int* s = stats.ptr<int>( k );
+            // background: the whole image minus the components, below
+            s[cv::CC_STAT_AREA] = k ? 0 : sz.area();
+            box[k * 4] = box[k * 4 + 1] = INT_MAX;
+            box[k * 4 + 2] = box[k * 4 + 3] = INT_MIN;
+        }
+        double allX = (double)sz.width * ( sz.width - 1 ) / 2 * sz.height, allY = (double)sz.height * ( sz.height - 1 ) / 2 * sz.width;
+        for( int y = 0; y < sz.height; y++ )
+        {
+            // the background of the row: from the end of the runs starting at its left
+            // edge to the start of the ones ending at its right edge
+            int x0 = 0, x1 = sz.width;
+            for( int i = rowStart[y]; i < rowStart[y + 1] && runList[i].x0 <= x0; i++ )
+                x0 = std::max( x0, runList[i].x1 );
+            for( int i = rowStart[y + 1] - 1; i >= rowStart[y] && runList[i].x1 >= x1; i-- )
+                x1 = std::min( x1, runList[i].x0 );
+            if( x0 < x1 )
+            {
+                box[0] = std::min( box[0], x0 );
+                box[1] = std::min( box[1], y );
+                box[2] = std::max( box[2], x1 );
+                box[3] = std::max( box[3], y + 1 );
+            }
+            for( int i = rowStart[y]; i < rowStart[y + 1]; i++ )
+            {
+                int k = labels[i], len = runList[i].x1 - runList[i].x0;
+                stats.ptr<int>( k )[cv::CC_STAT_AREA] += len;
+                stats.ptr<int>( 0 )[cv::CC_STAT_AREA] -= len;
+                sx[k] += ( runList[i].x0 + runList[i].x1 - 1 ) * 0.5 * len;
+                sy[k] += (double)y * len;
+                int* b = &box[k * 4];
+                b[0] = std::min( b[0], runList[i].x0 );
+                b[1] = std::min( b[1], y );
+                b[2] = std::max( b[2], runList[i].x1 );
+                b[3] = std::max( b[3], y + 1 );
+            }
+        }
+        // no background at all: an empty box at the origin
+        if( box[0] == INT_MAX )
+            box[0] = box[1] = box[2] = box[3] = 0;
+        for( int k = 1; k <= n; k++ )
+        {
+            allX -= sx[k];
+            allY -= sy[k];
+        }
+        sx[0] = allX;
+        sy[0] = allY;
+        for( int k = 0; k <= n; k++ )
+        {
+            int* s = stats.ptr<int>( k );
+            const int* b = &box[k * 4];
+            s[cv::CC_STAT_LEFT] = b[0];
+            s[cv::CC_STAT_TOP] = b[1];
+            s[cv::CC_STAT_WIDTH] = b[2] - b[0];
+            s[cv::CC_STAT_HEIGHT] = b[3] - b[1];
+            double area = std::max( s[cv::CC_STAT_AREA], 1 );
+            centroids.at<double>( k, 0 ) = sx[k] / area;
+            centroids.at<double>( k, 1 ) = sy[k] / area;
+        }
+        if( runLabels )
+            runLabels->swap( labels );
+        return n + 1;
+    }
+
+    // mode: RETR_EXTERNAL, RETR_LIST or RETR_CCOMP; the contours of a component are
+    // together, its outer one first, components in raster order of their first pixel
+    void findContours( std::vector<std::vector<cv::Point> >& contours, std::vector<cv::Vec4i>& hierarchy,
+                       int mode, int method ) const
+    {
+        CV_Assert( mode == cv::RETR_EXTERNAL || mode == cv::RETR_LIST || mode == cv::RETR_CCOMP );
+        contours.clear();
+        hierarchy.clear();
+        std::vector<int> labels;
+        int n = labelRuns( 1, labels );
+        // runs of every component, in raster order
+        std::vector<int> first( n + 1, 0 ), order( runList.size() );
+        for( size_t i = 0; i < labels.size(); i++ )
+            first[labels[i]]++;
+        for( int k = 1, sum = 0; k <= n; k++ )
+        {
+            int c = first[k];
+            first[k] = sum;
+            sum += c;
+        }
+        std::vector<int> next( first );
+        std::vector<int> runRow( runList.size() );
+        for( int y = 0; y < sz.height; y++ )
+            for( int i = rowStart[y]; i < rowStart[y + 1]; i++ )
+            {
+                order[next[labels[i]]++] = i;
+                runRow[i] = y;
+            }
+        std::vector<bool> nested;
+        if( mode == cv::RETR_EXTERNAL )
+            nestedComponents( n, runRow, order, first, nested );
+
+        int prevOuter = -1;
+        cv::Mat buf;
+        for( int k = 1; k <= n; k++ )
+        {
+            if( !nested.empty() && nested[k] )
+                continue;
+            int begin = first[k], end = k < n ? first[k + 1] : (int)order.size();
+            int x0 = INT_MAX, x1 = INT_MIN, y0 = runRow[order[begin]], y1 = runRow[order[end - 1]] + 1;
+            for( int j = begin; j < end; j++ )
+            {
+                x0 = std::min( x0, runList[order[j]].x0 );
+                x1 = std::max( x1, runList[order[j]].x1 );
+            }
+            // one pixel of background around the component
+            buf.create( y1 - y0 + 2, x1 - x0 + 2, CV_8UC1 );
+            buf.setTo( cv::Scalar::all( 0 ) );
+            for( int j = begin; j < end; j++ )
+            {
+                const RleRun& r = runList[order[j]];
+                uchar* d = buf.ptr<uchar>( runRow[order[j]] - y0 + 1 );
+                std::fill( d + r.x0 - x0 + 1, d + r.x1 - x0 + 1, (uchar)255 );
+            }
+            std::vector<std::vector<cv::Point> > cs;
+            std::vector<cv::Vec4i> hs;
+            cv::findContours( buf, cs, hs, mode == cv::RETR_EXTERNAL ? cv::RETR_EXTERNAL : cv::RETR_CCOMP, method,
+                              cv::Point( x0 - 1, y0 - 1 ) );
+            if( cs.empty() )
+                continue;
+            // the outer contour first, then the holes as its children
+            int base = (int)contours.size(), outer = 0;
+            for( size_t c = 0; c < hs.size(); c++ )
+                if( hs[c][3] < 0 )
+                    outer = (int)c;
+            contours.push_back( cs[outer] );
+            hierarchy.push_back( cv::Vec4i( -1, prevOuter, -1, -1 ) );
+            if( prevOuter >= 0 )
+                hierarchy[prevOuter][0] = base;
+            prevOuter = base;
+            for( size_t c = 0; c < cs.size(); c++ )
+            {
+                if( (int)c == outer )
+                    continue;
+                int self = (int)contours.size();
+                contours.push_back( cs[c] );
+                hierarchy.push_back( cv::Vec4i( -1, self > base + 1 ? self - 1 : -1, -1, base ) );
+                if( self > base + 1 )
+                    hierarchy[self - 1][0] = self;
+                else
+                    hierarchy[base][2] = self;
+            }
+        }
+        if( mode == cv::RETR_LIST )
+            for( size_t c = 0; c < hierarchy.size(); c++ )
+                hierarchy[c] = cv::Vec4i( c + 1 < hierarchy.size() ? (int)c + 1 : -1, (int)c - 1, -1, -1 );
+    }
+
+    void findContours( std::vector<std::vector<cv::Point> >& contours, int mode, int method ) const
+    {
+        std::vector<cv::Vec4i> hierarchy;
+        findContours( contours, hierarchy, mode, method );
+    }
+
+private:
+    enum Op { AND, OR, XOR, SUB };
+
+    void addRun( int y, int x0, int x1 )
+    {
+        RleRun r = { x0, x1 };
+        runList.push_back( r );
+        rowStart[y + 1] = (int)runList.size();
+    }
+
+    // rows after the last one with a run get its end
+    void close( int rows )
+    {
+        for( int y = 1; y <= rows; y++ )
+            rowStart[y] = std::max( rowStart[y], rowStart[y - 1] );
+    }
+
+    static RleMask combine( const RleMask& a, const RleMask& b, Op op )
+    {
+        CV_Assert( a.sz == b.sz );
+        RleMask m( a.sz );
+        for( int y = 0; y < a.sz.height; y++ )
+        {
+            int na, nb;
+            const RleRun* ra = a.row( y, na );
+            const RleRun* rb = b.row( y, nb );
+            // sweep over the run ends of both rows, the state of each is a parity
+            int i = 0, j = 0;
+            bool inA = false, inB = false, in = false;
+            int start = 0;
+            while( i < na * 2 || j < nb * 2 )
+            {
+                int xa = i < na * 2 ? ( i & 1 ? ra[i / 2].x1 : ra[i / 2].x0 ) : INT_MAX;
+                int xb = j < nb * 2 ? ( j & 1 ? rb[j / 2].x1 : rb[j / 2].x0 ) : INT_MAX;
+                int x = std::min( xa, xb );
+                if( xa == x ) { inA = !inA; i++; }
+                if( xb == x ) { inB = !inB; j++; }
+                bool v = op == AND ? inA && inB : op == OR ? inA || inB : op == XOR ? inA != inB : inA && !inB;
+                if( v == in )
+                    continue;
+                if( v )
+                    start = x;
+                else if( x > start )
+                    m.addRun( y, start, x );
+                in = v;
+            }
+        }
+        m.close( a.sz.height );
+        return m;
+    }
+
+    // component of every run, 1 to n in raster order of their first run; reach as joinRows
+    int labelRuns( int reach, std::vector<int>& labels ) const
+    {
+        std::vector<int> parent( runList.size() );
+        for( size_t i = 0; i < parent.size(); i++ )
+            parent[i] = (int)i;
+        for( int y = 1; y < sz.height; y++ )
+            rle::joinRows( runList.data() + rowStart[y - 1], rowStart[y] - rowStart[y - 1], rowStart[y - 1],
+                           runList.data() + rowStart[y], rowStart[y + 1] - rowStart[y], rowStart[y], reach, parent );
+        labels.resize( runList.size() );
+        int n = 0;
+        for( size_t i = 0; i < runList.size(); i++ )
+        {
+            int root = rle::find( parent, (int)i );
+            labels[i] = root == (int)i ? ++n : labels[root];
+        }
+        return n;
+    }
+
+    // nested[k]: component k lies in a hole of another one. The background above the
+    // first pixel of a component surrounds it: the outside of the image, or a hole.
+    void nestedComponents( int n, const std::vector<int>& runRow,
+                           const std::vector<int>& order, const std::vector<int>& first, std::vector<bool>& nested ) const
+    {
+        // the background runs, 4-connected, and whether they reach the image border
+        std::vector<RleRun> bg;
+        std::vector<int> bgStart( sz.height + 1, 0 );
+        for( int y = 0; y < sz.height; y++ )
+        {
+            int x = 0;
+            for( int i = rowStart[y]; i < rowStart[y + 1]; i++ )
+            {
+                if( runList[i].x0 > x )
+                {
+                    RleRun r = { x, runList[i].x0 };
+                    bg.push_back( r );
+                }
+                x = runList[i].x1;
+            }
+            if( x < sz.width )
+            {
+                RleRun r = { x, sz.width };
+                bg.push_back( r );
+            }
+            bgStart[y + 1] = (int)bg.size();
+        }
+        nested.assign( n + 1, false );
+        if( bg.empty() )
+            return;
+        std::vector<int> parent( bg.size() );
+        for( size_t i = 0; i < parent.size(); i++ )
+            parent[i] = (int)i;
+        for( int y = 1; y < sz.height; y++ )
+            rle::joinRows( &bg[0] + bgStart[y - 1], bgStart[y] - bgStart[y - 1], bgStart[y - 1],
+                           &bg[0] + bgStart[y], bgStart[y + 1] - bgStart[y], bgStart[y], 0, parent );
+        std::vector<bool> outside( bg.size(), false );
+        for( int y = 0; y < sz.height; y++ )
+            for( int i = bgStart[y]; i < bgStart[y + 1]; i++ )
+                if( y == 0 || y == sz.height - 1 || bg[i].x0 == 0 || bg[i].x1 == sz.width )
+                    outside[rle::find( parent, i )] = true;
+
+        for( int k = 1; k <= n; k++ )
+        {
+            const RleRun& r = runList[order[first[k]]];
+            int y = runRow[order[first[k]]];
+            if( y == 0 )
+                continue;
+            // the background run of the row above covering x0
+            int lo = bgStart[y - 1], hi = bgStart[y];
+            while( lo < hi )
+            {
+                int mid = ( lo + hi ) / 2;
+                if( bg[mid].x1 <= r.x0 )
+                    lo = mid + 1;
+                else
+                    hi = mid;
+            }
+            nested[k] = lo < bgStart[y] && bg[lo].x0 <= r.x0 && !outside[rle::find( parent, lo )];
+        }
+    }
+
+    cv::Size sz;
+    std::vector<RleRun> runList;
+    std::vector<int> rowStart;     // runs of row y: [rowStart[y], rowStart[y + 1])
+};
+
+#endif
@@ -4,98 +4,554 @@
 #include <thread>
 #include <mutex>
 #include <condition_variable>
+#include <atomic>
+#include <memory>
+#include <iostream>
 
 using namespace std;
 using namespace cv;
 
-cv::VideoCapture capture;
-bool capture_frames;
-bool do_detection = false;
-cv::Mat captured_frame;
-const cv::String CASCADE_FILE("haarcascade_frontalface_default.xml");
+// Single-producer/single-consumer frame ring with a "latest frame wins" policy.
+// The producer decodes into a slot it owns and publishes it with one atomic
+// exchange; the consumer swaps its slot with the newest published one. Neither
+// side ever waits for the other and the slot Mats are reused, so decoding
+// stops reallocating once the stream size is known.
+class FrameRing
+{
+public:
+    enum { SLOTS = 3 };
+
+    FrameRing() : write_index(0), read_index(1), published(2), write_seq(0), dropped(0)
+    {
+        for( int i = 0; i < SLOTS; i++ )
+            seq[i] = 0;
+    }
+
+    // producer side
+    cv::Mat& writeSlot() { return frames[write_index]; }
+
+    void publish()
+    {
+        seq[write_index] = ++write_seq;
+        unsigned prev = published.exchange( write_index | FRESH, std::memory_order_acq_rel );
+        if( prev & FRESH )
+            dropped++;
+        write_index = prev & INDEX;
+    }
+
+    // consumer side, returns false when nothing new was published since the last call
+    bool read( cv::Mat& frame, uint64_t& sequence )
+    {
+        if( !( published.load( std::memory_order_acquire ) & FRESH ) )
+            return false;
+        read_index = published.exchange( read_index, std::memory_order_acq_rel ) & INDEX;
+        frame = frames[read_index];
+        sequence = seq[read_index];
+        return true;
+    }
 
-void *CaptureImages( void *threadid )
+    uint64_t publishedFrames() const { return write_seq.load(); }
+    uint64_t droppedFrames() const { return dropped.load(); }
+
+private:
+    enum { INDEX = 0x3, FRESH = 0x4 };
+
+    cv::Mat frames[SLOTS];
+    uint64_t seq[SLOTS];
+    unsigned write_index;
+    unsigned read_index;
+    std::atomic<unsigned> published;
+    std::atomic<uint64_t> write_seq;
+    std::atomic<uint64_t> dropped;
+};
+
+// Trades detection accuracy for speed to hold a per frame time budget. The knobs move
+// together along a ladder of levels, from the most accurate (little downscaling, a
+// detection on every frame, small faces found) to the cheapest; the controller keeps an
+// average of the measured frame time and steps one level cheaper when it is over the
+// budget, one level more accurate when the level above is known, or likely, to fit.
+// Hysteresis: after a step it waits for the average to settle, it only steps up after
+// a long stretch under budget, and the cost seen at each level is remembered (for a
+// while, the load changes) so it does not climb back to a level it just had to leave.
+class QualityController
 {
-    if (!capture.isOpened())
+public:
+    struct Level
     {
-        pthread_exit(NULL);
+        int scale;          // detection downscale
+        int detectEvery;    // frames between full-frame detections when nothing is tracked
+        int minFace;        // smallest face searched, in frame pixels
+    };
+
+    // what the display shows
+    struct Metrics
+    {
+        int level;
+        Level settings;
+        double averageMs;
+        double budgetMs;
+        int changes;
+    };
+
+    explicit QualityController( double _budgetMs = 1000. / 15 )
+        : budgetMs( _budgetMs ), level( 3 ), averageMs( 0 ), framesAtLevel( 0 ), framesUnder( 0 ), changes( 0 ), frame( 0 )
+    {
+        for( int i = 0; i < LEVELS; i++ )
+            seenAt[i] = -1;
     }
-    capture_frames = true;
-    while ( capture_frames && capture.isOpened())
+
+    const Level& settings() const { return ladder()[level]; }
+
+    // the time processFrame took for one frame
+    void record( double ms )
     {
-        capture >> captured_frame;
-        if( captured_frame.empty() )
+        frame++;
+        framesAtLevel++;
+        averageMs = framesAtLevel == 1 ? ms : averageMs + ( ms - averageMs ) * SMOOTHING;
+        if( framesAtLevel < SETTLE_FRAMES )
+            return;
+        costAt[level] = averageMs;
+        seenAt[level] = frame;
+        framesUnder = averageMs < budgetMs * UP_MARGIN ? framesUnder + 1 : 0;
+
+        if( averageMs > budgetMs && level < LEVELS - 1 )
+            step( +1 );
+        else if( level > 0 && framesUnder >= UP_FRAMES )
+        {
+            // the level above: what it cost when last seen, else a guess from how far
+            // under budget we are
+            bool known = seenAt[level - 1] >= 0 && frame - seenAt[level - 1] < MEMORY_FRAMES;
+            if( known ? costAt[level - 1] < budgetMs * 0.9 : averageMs < budgetMs * 0.5 )
+                step( -1 );
+            else
+                framesUnder = 0;
+        }
+    }
+
+    Metrics metrics() const
+    {
+        Metrics m;
+        m.level = level;
+        m.settings = settings();
+        m.averageMs = averageMs;
+        m.budgetMs = budgetMs;
+        m.changes = changes;
+        return m;
+    }
+
+private:
+    enum { LEVELS = 8, SETTLE_FRAMES = 20, UP_FRAMES = 60, MEMORY_FRAMES = 600 };
+    static constexpr double SMOOTHING = 0.1;
+    static constexpr double UP_MARGIN = 0.7;
+
+    static const Level* ladder()
+    {
+        static const Level levels[LEVELS] =
+        {
+            { 2, 1, 40 }, { 2, 2, 48 }, { 3, 2, 64 }, { 4, 3, 80 },
+            { 5, 3, 96 }, { 6, 4, 120 }, { 8, 5, 160 }, { 10, 6, 200 }
+        };
+        return levels;
+    }
+
+    void step( int direction )
+    {
+        level += direction;
+        framesAtLevel = 0;
+        framesUnder = 0;
+        changes++;
+    }
+
+    double budgetMs;
+    int level;
+    double averageMs;
+    int framesAtLevel;
+    int framesUnder;
+    int changes;
+    int64 frame;
+    double costAt[LEVELS];
+    int64 seenAt[LEVELS];
+};
+
+// A face followed between full-frame detections: its last box, a gray template
+// for the fallback matcher and the number of frames it was only template-matched.
+struct FaceTrack
+{
+    cv::Rect box;
+    cv::Mat templ;
+    int misses;
+};
+
+// One camera: its capture thread, its ring and the counters the scheduler and the
+// display read. "busy" is held by the worker currently consuming the ring, which
+// keeps the ring single-consumer and gives every stream at most one frame in flight.
+struct Stream
+{
+    Stream() : busy( false ), running( false ), processed( 0 ), frames_since_detect( 0 ),
+        metrics( controller.metrics() ), last_processed( 0 ), last_captured( 0 ), last_dropped( 0 ), fps( 0 ), capture_fps( 0 ), drop_rate( 0 ) {}
+
+    cv::String url;
+    cv::VideoCapture capture;
+    FrameRing ring;
+    std::thread thread;
+    std::atomic<bool> busy;
+    std::atomic<bool> running;
+    std::atomic<uint64_t> processed;
+    int frames_since_detect;
+    std::vector<cv::Rect> faces;
+    std::vector<FaceTrack> tracks;
+    QualityController controller;   // used by the worker holding "busy"
+
+    std::mutex display_mutex;
+    cv::Mat thumbnail;
+    QualityController::Metrics metrics;
+
+    // owned by the display thread
+    uint64_t last_processed;
+    uint64_t last_captured;
+    uint64_t last_dropped;
+    double fps;
+    double capture_fps;
+    double drop_rate;
+};
+
+std::atomic<bool> capture_frames( false );
+std::atomic<bool> do_detection( false );
+std::atomic<bool> do_tracking( true );
+std::atomic<bool> adaptive( true ); // the controller picks scale, cadence and face size; 'a' toggles
+std::atomic<int> scale( 8 );        // the manual scale, Enter cycles it
+const int DETECT_EVERY = 3;         // the manual cadence
+double TARGET_FPS = 15;             // per stream, the controller's budget is 1 / TARGET_FPS, --target-fps=N
+int FULL_DETECT_PERIOD = 30;        // frames between full-frame sweeps in tracking mode, --full-period=N
+const int MAX_TEMPLATE_MISSES = 5;  // frames a track may live on template matching alone
+const double MIN_TEMPLATE_SCORE = 0.6;
+const cv::Size TILE_SIZE( 320, 180 );
+const cv::String CASCADE_FILE("haarcascade_frontalface_default.xml");
+
+void CaptureImages( Stream* stream )
+{
+    while ( capture_frames && stream->capture.isOpened() )
+    {
+        cv::Mat& slot = stream->ring.writeSlot();
+        stream->capture >> slot;
+        if( slot.empty() )
         {
             break;
         }
+        stream->ring.publish();
     }
-    captured_frame.release();
-    pthread_exit(NULL);
+    stream->running = false;
 }
 
-int main(int argc, char *argv[])
+// minFace: in frame pixels, 0 for the cascade's own minimum
+void detectFullFrame( const cv::Mat& frame, cv::CascadeClassifier& faceCascade, int s, std::vector<cv::Rect>& faces, int minFace = 0 )
 {
-    capture.open( argv[1] );
-    if (!capture.isOpened())
+    cv::Mat resized;
+    cv::resize( frame, resized, cv::Size(), (float) 1/s, (float) 1/s );
+
+    int side = minFace / s;
+    faceCascade.detectMultiScale( resized, faces, 1.1, 3, 0, cv::Size( side, side ) );
+    for( size_t i = 0; i < faces.size(); i++ )
     {
-        return -1;
+        faces[i].x *= s;
+        faces[i].y *= s;
+        faces[i].width *= s;
+        faces[i].height *= s;
     }
-    capture >> captured_frame;
+}
 
-    pthread_t capture_thread;
-    int thread_id=0;
-    int rc = pthread_create(&capture_thread, NULL,
-                            CaptureImages, (void *)thread_id );
-    if (rc)
+// Re-detects one face inside its previous box grown by half on every side. The ROI is
+// scaled so the face is about 48 px wide and only faces of roughly the previous size
+// are searched. If the cascade misses, the stored template is matched in the same ROI.
+// Returns false when the track should be dropped.
+bool updateTrack( const cv::Mat& frame, FaceTrack& track, cv::CascadeClassifier& faceCascade )
+{
+    cv::Rect roi( track.box.x - track.box.width / 2, track.box.y - track.box.height / 2,
+                  track.box.width * 2, track.box.height * 2 );
+    roi &= cv::Rect( 0, 0, frame.cols, frame.rows );
+    if( roi.area() == 0 )
+        return false;
+
+    cv::Mat gray;
+    cv::cvtColor( frame( roi ), gray, cv::COLOR_BGR2GRAY );
+
+    double f = std::min( 1.0, 48.0 / track.box.width );
+    cv::Mat small;
+    cv::resize( gray, small, cv::Size(), f, f );
+    std::vector<cv::Rect> found;
+    int minSide = cvRound( track.box.width * f * 0.7 ), maxSide = cvRound( track.box.width * f * 1.4 );
+    faceCascade.detectMultiScale( small, found, 1.1, 3, 0, cv::Size( minSide, minSide ), cv::Size( maxSide, maxSide ) );
+
+    if( !found.empty() )
     {
-        return -1;
+        size_t best = 0;
+        for( size_t i = 1; i < found.size(); i++ )
+            if( found[i].area() > found[best].area() ) best = i;
+        track.box = cv::Rect( roi.x + cvRound( found[best].x / f ), roi.y + cvRound( found[best].y / f ),
+                              cvRound( found[best].width / f ), cvRound( found[best].height / f ) ) & cv::Rect( 0, 0, frame.cols, frame.rows );
+        cv::Rect inRoi = ( track.box - roi.tl() ) & cv::Rect( 0, 0, gray.cols, gray.rows );
+        gray( inRoi ).copyTo( track.templ );
+        track.misses = 0;
+        return true;
     }
 
-    cv::CascadeClassifier faceCascade;
-    faceCascade.load( CASCADE_FILE );
-    int frameCounter = 0;
-    int tick = 0;
-    int fps;
-    std::time_t timeBegin = std::time(0);
-    int scale = 8;
+    if( track.templ.empty() || track.templ.cols > gray.cols || track.templ.rows > gray.rows || ++track.misses > MAX_TEMPLATE_MISSES )
+        return false;
 
-    while ( capture_frames )
+    cv::Mat result;
+    cv::matchTemplate( gray, track.templ, result, cv::TM_CCOEFF_NORMED );
+    double score;
+    cv::Point loc;
+    cv::minMaxLoc( result, 0, &score, 0, &loc );
+    if( score < MIN_TEMPLATE_SCORE )
+        return false;
+    track.box = cv::Rect( roi.tl() + loc, track.templ.size() );
+    return true;
+}
+
+void processFrame( Stream& stream, cv::Mat& frame, cv::CascadeClassifier& faceCascade )
+{
+    int s = scale, detectEvery = DETECT_EVERY, minFace = 0;
+    if( adaptive )
+    {
+        const QualityController::Level& level = stream.controller.settings();
+        s = level.scale;
+        detectEvery = level.detectEvery;
+        minFace = level.minFace;
+    }
+    if( !do_detection || faceCascade.empty() )
+    {
+        stream.faces.clear();
+        stream.tracks.clear();
+    }
+    else if( !do_tracking )
     {
-        std::vector<cv::Rect> allFaces;
+        stream.tracks.clear();
+        if( ++stream.frames_since_detect >= detectEvery )
+        {
+            stream.frames_since_detect = 0;
+            stream.faces.clear();
+            detectFullFrame( frame, faceCascade, s, stream.faces, minFace );
+        }
+    }
+    else
+    {
+        // tracking mode: follow every face in its own small ROI and sweep the whole
+        // frame on a fixed period or when a track is lost; with nothing tracked the
+        // sweep runs at the plain detection cadence
+        bool lost = false;
+        for( size_t i = 0; i < stream.tracks.size(); )
+        {
+            if( updateTrack( frame, stream.tracks[i], faceCascade ) )
+                i++;
+            else
+            {
+                stream.tracks.erase( stream.tracks.begin() + i );
+                lost = true;
+            }
+        }
 
-        if( ( frameCounter % 3 == 0 ) & do_detection & !faceCascade.empty() )
+        int period = stream.tracks.empty() ? detectEvery : FULL_DETECT_PERIOD;
+        if( lost || ++stream.frames_since_detect >= period )
         {
-            cv::Mat resized;
-            cv::resize( captured_frame, resized, cv::Size(), (float) 1/scale, (float) 1/scale );
+            stream.frames_since_detect = 0;
+            std::vector<cv::Rect> detected;
+            detectFullFrame( frame, faceCascade, s, detected, minFace );
+            stream.tracks.clear();
+            for( size_t i = 0; i < detected.size(); i++ )
+            {
+                FaceTrack track;
+                track.box = detected[i] & cv::Rect( 0, 0, frame.cols, frame.rows );
+                track.misses = 0;
+                if( track.box.area() == 0 )
+                    continue;
+                cv::cvtColor( frame( track.box ), track.templ, cv::COLOR_BGR2GRAY );
+                stream.tracks.push_back( track );
+            }
+        }
 
-            faceCascade.detectMultiScale( resized, allFaces );
+        stream.faces.clear();
+        for( size_t i = 0; i < stream.tracks.size(); i++ )
+            stream.faces.push_back( stream.tracks[i].box );
+    }
+
+    // the ring slot goes back to the producer once this worker releases the
+    // stream, so the display gets its own small copy
+    std::lock_guard<std::mutex> lock( stream.display_mutex );
+    stream.metrics = stream.controller.metrics();
+    cv::resize( frame, stream.thumbnail, TILE_SIZE, 0, 0, cv::INTER_NEAREST );
+    float fx = (float)TILE_SIZE.width / frame.cols;
+    float fy = (float)TILE_SIZE.height / frame.rows;
+    for( size_t i = 0; i < stream.faces.size(); i++ )
+    {
+        const cv::Rect& r = stream.faces[i];
+        cv::rectangle( stream.thumbnail, cv::Rect( cvRound( r.x * fx ), cvRound( r.y * fy ),
+                       cvRound( r.width * fx ), cvRound( r.height * fy ) ), cv::Scalar( 0, 255, 0 ), 2 );
+    }
+}
+
+// Workers sweep the streams round-robin from a shared cursor and take the first one
+// that is idle and has a new frame. Streams that decode faster than detection keeps
+// up with simply drop frames in their ring, which is the backpressure.
+void DetectionWorker( std::vector<std::unique_ptr<Stream> >* streams, std::atomic<size_t>* cursor )
+{
+    cv::CascadeClassifier faceCascade;
+    faceCascade.load( CASCADE_FILE );
+    cv::Mat frame;
+    uint64_t sequence;
+    const size_t n = streams->size();
+
+    while( capture_frames )
+    {
+        bool worked = false;
+        size_t start = cursor->fetch_add( 1 );
+        for( size_t k = 0; k < n; k++ )
+        {
+            Stream& stream = *(*streams)[( start + k ) % n];
+            if( stream.busy.exchange( true, std::memory_order_acquire ) )
+                continue;
+            if( stream.ring.read( frame, sequence ) )
+            {
+                int64 t0 = cv::getTickCount();
+                processFrame( stream, frame, faceCascade );
+                // the time of the whole frame: detection, tracking and drawing
+                if( adaptive && do_detection )
+                    stream.controller.record( ( cv::getTickCount() - t0 ) * 1000. / cv::getTickFrequency() );
+                stream.processed++;
+                worked = true;
+            }
+            stream.busy.store( false, std::memory_order_release );
+            if( worked )
+                break;
         }
+        if( !worked )
+            std::this_thread::sleep_for( std::chrono::milliseconds( 2 ) );
+    }
+}
 
-        for( size_t i = 0; i < allFaces.size(); i++ )
+void updateCounters( std::vector<std::unique_ptr<Stream> >& streams, double seconds )
+{
+    for( size_t i = 0; i < streams.size(); i++ )
+    {
+        Stream& s = *streams[i];
+        uint64_t processed = s.processed, captured = s.ring.publishedFrames(), dropped = s.ring.droppedFrames();
+        s.fps = ( processed - s.last_processed ) / seconds;
+        s.capture_fps = ( captured - s.last_captured ) / seconds;
+        s.drop_rate = captured > s.last_captured ? (double)( dropped - s.last_dropped ) / ( captured - s.last_captured ) : 0;
+        s.last_processed = processed;
+        s.last_captured = captured;
+        s.last_dropped = dropped;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    if( argc < 2 )
+    {
+        cout << "usage: " << argv[0] << " [--full-period=N] [--target-fps=N] url1 [url2 ...]" << endl;
+        return -1;
+    }
+
+    capture_frames = true;
+    std::vector<std::unique_ptr<Stream> > streams;
+    for( int i = 1; i < argc; i++ )
+    {
+        cv::String arg = argv[i];
+        if( arg.find( "--full-period=" ) == 0 )
+        {
+            FULL_DETECT_PERIOD = std::max( 1, atoi( arg.c_str() + 14 ) );
+            continue;
+        }
+        if( arg.find( "--target-fps=" ) == 0 )
+        {
+            TARGET_FPS = std::max( 1.0, atof( arg.c_str() + 13 ) );
+            continue;
+        }
+        std::unique_ptr<Stream> stream( new Stream );
+        stream->controller = QualityController( 1000. / TARGET_FPS );
+        stream->metrics = stream->controller.metrics();
+        stream->url = argv[i];
+        stream->capture.open( stream->url );
+        if( !stream->capture.isOpened() )
         {
-            allFaces[i].x *= scale;
-            allFaces[i].y *= scale;
-            allFaces[i].width *= scale;
-            allFaces[i].height *= scale;
-            cv::rectangle( captured_frame, allFaces[i], cv::Scalar( 0, 255, 0 ), 2 );
+            cout << "can not open " << stream->url << endl;
+            continue;
         }
-        frameCounter++;
+        stream->running = true;
+        streams.push_back( std::move( stream ) );
+    }
+    if( streams.empty() )
+    {
+        return -1;
+    }
 
-        std::time_t timeNow = std::time(0) - timeBegin;
+    for( size_t i = 0; i < streams.size(); i++ )
+        streams[i]->thread = std::thread( CaptureImages, streams[i].get() );
 
-        if (timeNow - tick >= 1)
+    int workerCount = std::max( 1, std::min( (int)std::thread::hardware_concurrency(), (int)streams.size() ) );
+    std::atomic<size_t> cursor( 0 );
+    std::vector<std::thread> workers;
+    for( int i = 0; i < workerCount; i++ )
+        workers.push_back( std::thread( DetectionWorker, &streams, &cursor ) );
+
+    int cols = cvCeil( std::sqrt( (double)streams.size() ) );
+    int rows = cvCeil( (double)streams.size() / cols );
+    cv::Mat mosaic( rows * TILE_SIZE.height, cols * TILE_SIZE.width, CV_8UC3, cv::Scalar::all( 0 ) );
+    int64 lastTick = cv::getTickCount();
+
+    while ( capture_frames )
+    {
+        double elapsed = ( cv::getTickCount() - lastTick ) / cv::getTickFrequency();
+        if( elapsed >= 1.0 )
         {
-            tick++;
-            fps = frameCounter;
-            frameCounter = 0;
+            updateCounters( streams, elapsed );
+            lastTick = cv::getTickCount();
         }
-        cv::putText(captured_frame, cv::format("Average FPS=%d (1/%dx)", fps, scale ), cv::Point(30, 50), cv::FONT_HERSHEY_SIMPLEX, 0.8, cv::Scalar(0,0,255));
-        cv::imshow("Video Capture", captured_frame);
+
+        bool anyRunning = false;
+        for( size_t i = 0; i < streams.size(); i++ )
+        {
+            Stream& s = *streams[i];
+            anyRunning |= s.running;
+            cv::Mat tile = mosaic( cv::Rect( (int)( i % cols ) * TILE_SIZE.width, (int)( i / cols ) * TILE_SIZE.height,
+                                             TILE_SIZE.width, TILE_SIZE.height ) );
+            QualityController::Metrics m;
+            {
+                std::lock_guard<std::mutex> lock( s.display_mutex );
+                if( !s.thumbnail.empty() )
+                    s.thumbnail.copyTo( tile );
+                m = s.metrics;
+            }
+            cv::putText( tile, cv::format( "#%d %.1f/%.1f fps drop %.0f%%", (int)i, s.fps, s.capture_fps, s.drop_rate * 100 ),
+                         cv::Point( 5, 15 ), cv::FONT_HERSHEY_SIMPLEX, 0.4, cv::Scalar( 0, 0, 255 ) );
+            if( adaptive && do_detection )
+                cv::putText( tile, cv::format( "L%d 1/%dx every %d min %d  %.1f/%.1f ms", m.level, m.settings.scale,
+                             m.settings.detectEvery, m.settings.minFace, m.averageMs, m.budgetMs ),
+                             cv::Point( 5, 30 ), cv::FONT_HERSHEY_SIMPLEX, 0.4, cv::Scalar( 0, 0, 255 ) );
+        }
+        if( !anyRunning ) capture_frames = false;
+
+        cv::putText( mosaic, cv::format( "%s %s", adaptive ? cv::format( "auto %.0f fps", TARGET_FPS ).c_str() : cv::format( "1/%dx", (int)scale ).c_str(),
+                     do_tracking ? "tracking" : "detect only" ), cv::Point( 5, mosaic.rows - 5 ), cv::FONT_HERSHEY_SIMPLEX, 0.4, cv::Scalar( 0, 0, 255 ) );
+        cv::imshow("Video Capture", mosaic);
         int key = cv::waitKey(30);
         if( key == 27 ) capture_frames = false;
         if( key == 32 ) do_detection = !do_detection;
-        if( key == 13 ) scale++;
-        if( scale > 10 ) scale = 2;
+        if( key == 't' ) do_tracking = !do_tracking;
+        if( key == 'a' ) adaptive = !adaptive;
+        if( key == 13 ) scale = scale >= 10 ? 2 : scale + 1;
+    }
+
+    for( size_t i = 0; i < workers.size(); i++ )
+        workers[i].join();
+    for( size_t i = 0; i < streams.size(); i++ )
+    {
+        QualityController::Metrics m = streams[i]->controller.metrics();
+        cout << streams[i]->url << " captured " << streams[i]->ring.publishedFrames()
+             << " processed " << streams[i]->processed << " dropped " << streams[i]->ring.droppedFrames()
+             << " level " << m.level << " (1/" << m.settings.scale << "x, every " << m.settings.detectEvery
+             << ", min " << m.settings.minFace << ") after " << m.changes << " changes" << endl;
+        streams[i]->thread.join();
     }
     return 0;
 }
@@ -34,6 +34,9 @@ myCreateHaarClassifierCascade( int stage_count );
 static void*
 writeHaarClassifierconsts( const void* struct_ptr , char* filename );
 
+static void
+writeHaarClassifierSoA( const void* struct_ptr, const char* filename );
+
 
 /** Global variables */
 String face_cascade_name = "haarcascade_frontalface_alt2.xml";
@@ -53,6 +56,7 @@ int main( void )
 
     writeHaarClassifierconsts(oldCascade,"haarclassifierconsts.hpp");
     writeHaarClassifierconsts(oldCascade2,"haarclassifierconsts2.hpp");
+    writeHaarClassifierSoA(oldCascade,"haarclassifiersoa.hpp");
     return 0;
 }
 
@@ -162,11 +166,11 @@ writeHaarClassifierconsts( const void* struct_ptr,char* filename )
     char* fmt;
 
 
-    fprintf(fp,"const int ClassifierCascadeCount=%d;\n",cascade_src->count);
-    fprintf(fp,"const int cascadewidth=%d;\n",cascade_src->orig_window_size.width);
-    fprintf(fp,"const int cascadeheight=%d;\n\n",cascade_src->orig_window_size.height);
+    fprintf(fp,"constexpr int ClassifierCascadeCount=%d;\n",cascade_src->count);
+    fprintf(fp,"constexpr int cascadewidth=%d;\n",cascade_src->orig_window_size.width);
+    fprintf(fp,"constexpr int cascadeheight=%d;\n\n",cascade_src->orig_window_size.height);
 
-    fprintf(fp,"const float stage_classifier_threshold[] = \n{\n");
+    fprintf(fp,"constexpr float stage_classifier_threshold[] = \n{\n");
 
     for( i = 0; i < stage_classifier_threshold.size(); ++i )
     {
@@ -181,7 +185,7 @@ writeHaarClassifierconsts( const void* struct_ptr,char* filename )
         fprintf(fp,fmt,stage_classifier_threshold[i]);
     }
 
-    fprintf(fp,"const int stage_classifier_count[] = \n{\n");
+    fprintf(fp,"constexpr int stage_classifier_count[] = \n{\n");
 
     for( i = 0; i < stage_classifier_count.size(); ++i )
     {
@@ -193,7 +197,7 @@ writeHaarClassifierconsts( const void* struct_ptr,char* filename )
     }
 
 
-    fprintf(fp,"const uchar haar_feature_rect[] = \n{\n");
+    fprintf(fp,"constexpr uchar haar_feature_rect[] = \n{\n");
 
     for( i = 0; i < haar_feature_rect.size(); ++i )
     {
@@ -208,7 +212,7 @@ writeHaarClassifierconsts( const void* struct_ptr,char* filename )
         fprintf(fp,fmt,haar_feature_rect[i]);
     }
 
-    fprintf(fp,"const uchar haar_feature_weight[] = \n{\n");
+    fprintf(fp,"constexpr signed char haar_feature_weight[] = \n{\n");
 
     for( i = 0; i < haar_feature_weight.size(); ++i )
     {
@@ -224,7 +228,7 @@ writeHaarClassifierconsts( const void* struct_ptr,char* filename )
     }
 
 
-    fprintf(fp,"const float classifier_threshold[] = \n{\n");
+    fprintf(fp,"constexpr float classifier_threshold[] = \n{\n");
 
     for( i = 0; i < classifier_threshold.size(); ++i )
     {
@@ -240,7 +244,7 @@ writeHaarClassifierconsts( const void* struct_ptr,char* filename )
     }
 
 
-    fprintf(fp,"const uchar classifier_left[] = \n{\n");
+    fprintf(fp,"constexpr signed char classifier_left[] = \n{\n");
 
     for( i = 0; i < classifier_left.size(); ++i )
     {
@@ -255,7 +259,7 @@ writeHaarClassifierconsts( const void* struct_ptr,char* filename )
         fprintf(fp,fmt,classifier_left[i]);
     }
 
-    fprintf(fp,"const uchar classifier_right[] = \n{\n");
+    fprintf(fp,"constexpr signed char classifier_right[] = \n{\n");
 
     for( i = 0; i < classifier_right.size(); ++i )
     {
@@ -270,7 +274,7 @@ writeHaarClassifierconsts( const void* struct_ptr,char* filename )
         fprintf(fp,fmt,classifier_right[i]);
     }
 
-    fprintf(fp,"const float classifier_alpha[] = \n{\n");
+    fprintf(fp,"constexpr float classifier_alpha[] = \n{\n");
 
     for( i = 0; i < classifier_alpha.size(); ++i )
     {
@@ -284,7 +288,7 @@ writeHaarClassifierconsts( const void* struct_ptr,char* filename )
         else fmt="%.16e , ";
         fprintf(fp,fmt,classifier_alpha[i]);
     }
-    fprintf(fp,"const float classifier_alpha2[] = \n{\n");
+    fprintf(fp,"constexpr float classifier_alpha2[] = \n{\n");
 
     for( i = 0; i < classifier_alpha2.size(); ++i )
     {
@@ -304,6 +308,106 @@ writeHaarClassifierconsts( const void* struct_ptr,char* filename )
     return cascade;
 }
 
+// Structure of arrays copy of the same cascade for the SIMD evaluator in
+// embedded_cascade.hpp. Rect 0/1 geometry and weights get one slot per node and
+// the third rect only exists for the three rect group, indexed by soa_third.
+// The first weight is already rebalanced against the other rects, and the tree
+// shape is reduced to which branch of node 0 leads to node 1.
+template<typename T> static void
+writeSoaTable( FILE* fp, const char* decl, const vector<T>& values, const char* itemfmt, int perline )
+{
+    fprintf(fp,"%s[] = \n{\n",decl);
+    for( size_t i = 0; i < values.size(); ++i )
+    {
+        fprintf(fp,itemfmt,values[i]);
+        if (i == values.size()-1)
+            fprintf(fp," \n};\n\n");
+        else if (i % perline == (size_t)perline-1)
+            fprintf(fp,",\n");
+        else fprintf(fp,",");
+    }
+}
+
+static void
+writeHaarClassifierSoA( const void* struct_ptr, const char* filename )
+{
+    const CvHaarClassifierCascade* cascade_src =
+        (const CvHaarClassifierCascade*) struct_ptr;
+
+    vector<int> rect01, rect2, third, node1_on_left;
+    vector<float> weight0, weight1, weight2, node_threshold, leaf;
+    int i, j, k, l, trees = 0;
+
+    for( i = 0; i < cascade_src->count; ++i )
+        for( j = 0; j < cascade_src->stage_classifier[i].count; ++j, ++trees )
+        {
+            const CvHaarClassifier* classifier = &cascade_src->stage_classifier[i].classifier[j];
+            // the SIMD evaluator reads the leaves by position: alpha[0] for the leaf
+            // child of node 0, alpha[1] and alpha[2] for the children of node 1
+            CV_Assert( classifier->count == 2 );
+            CV_Assert( ( classifier->left[0] == 1 && classifier->right[0] == 0 ) ||
+                       ( classifier->left[0] == 0 && classifier->right[0] == 1 ) );
+            CV_Assert( classifier->left[1] == -1 && classifier->right[1] == -2 );
+
+            for( k = 0; k < classifier->count; ++k )
+            {
+                const CvHaarFeature* feature = &classifier->haar_feature[k];
+                CV_Assert( !feature->tilted );
+
+                double area[CV_HAAR_FEATURE_MAX], sum0 = 0;
+                for( l = 0; l < CV_HAAR_FEATURE_MAX; ++l )
+                    area[l] = (double)feature->rect[l].r.width * feature->rect[l].r.height;
+                for( l = 1; l < CV_HAAR_FEATURE_MAX; ++l )
+                    if( feature->rect[l].weight != 0 )
+                        sum0 += cvRound(feature->rect[l].weight) * area[l];
+
+                for( l = 0; l < 2; ++l )
+                {
+                    rect01.push_back(feature->rect[l].r.x);
+                    rect01.push_back(feature->rect[l].r.y);
+                    rect01.push_back(feature->rect[l].r.width);
+                    rect01.push_back(feature->rect[l].r.height);
+                }
+                weight0.push_back((float)(-sum0/area[0]));
+                weight1.push_back((float)cvRound(feature->rect[1].weight));
+
+                if( feature->rect[2].weight != 0 )
+                {
+                    third.push_back((int)weight2.size());
+                    rect2.push_back(feature->rect[2].r.x);
+                    rect2.push_back(feature->rect[2].r.y);
+                    rect2.push_back(feature->rect[2].r.width);
+                    rect2.push_back(feature->rect[2].r.height);
+                    weight2.push_back((float)cvRound(feature->rect[2].weight));
+                }
+                else third.push_back(-1);
+
+                node_threshold.push_back(classifier->threshold[k]);
+            }
+            node1_on_left.push_back(classifier->left[0] == 1);
+            for( k = 0; k <= classifier->count; ++k )
+                leaf.push_back(classifier->alpha[k]);
+        }
+
+    FILE* fp = fopen(filename, "wt");
+
+    fprintf(fp,"constexpr int soa_tree_count=%d;\n",trees);
+    fprintf(fp,"constexpr int soa_node_count=%d;\n",(int)weight0.size());
+    fprintf(fp,"constexpr int soa_three_rect_count=%d;\n\n",(int)weight2.size());
+
+    writeSoaTable(fp,"constexpr uchar soa_rect01",rect01,"%d",40);
+    writeSoaTable(fp,"constexpr float soa_weight0",weight0,"%.9g",10);
+    writeSoaTable(fp,"constexpr float soa_weight1",weight1,"%.9g",10);
+    writeSoaTable(fp,"constexpr short soa_third",third,"%d",30);
+    writeSoaTable(fp,"constexpr uchar soa_rect2",rect2,"%d",40);
+    writeSoaTable(fp,"constexpr float soa_weight2",weight2,"%.9g",10);
+    writeSoaTable(fp,"constexpr float soa_node_threshold",node_threshold,"%.16e",4);
+    writeSoaTable(fp,"constexpr uchar soa_node1_on_left",node1_on_left,"%d",40);
+    writeSoaTable(fp,"constexpr float soa_leaf",leaf,"%.16e",3);
+
+    fclose(fp);
+}
+
 static CvHaarClassifierCascade*
 myCreateHaarClassifierCascade( int stage_count )
 {
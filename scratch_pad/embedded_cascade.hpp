@@ -0,0 +1,343 @@
+// Haar cascade evaluator that runs straight from the tables constcascade.cpp dumps
+// into haarconsts.hpp. There is no XML parse and no cascade tree on the heap: every
+// stage is a template instantiation over its known range of trees, so rect
+// coordinates, weights, thresholds and leaf values are all compile-time constants
+// folded into the code.
+//
+// The tables describe an old style (CvHaarClassifierCascade) cascade with two node
+// trees and up to three upright rects per feature, e.g. haarcascade_frontalface_alt2.
+// Detection scales the image instead of the features, like CascadeClassifier does,
+// and the integral buffers keep one row step for every scale.
+//
+// With 128 bit SIMD four neighbouring windows of a row go through the cascade
+// together, reading the structure of arrays tables in haarsoa.hpp through integral
+// offsets that are computed once per row step. A batch stops as soon as all of its
+// windows are rejected, which is what happens in the first few stages for almost
+// every batch. Row tails use the unrolled scalar stages.
+
+#ifndef EMBEDDED_CASCADE_HPP
+#define EMBEDDED_CASCADE_HPP
+
+#include <opencv2/core.hpp>
+#include <opencv2/imgproc.hpp>
+#include <opencv2/objdetect.hpp>
+#include <opencv2/core/hal/intrin.hpp>
+#include <cmath>
+#include <vector>
+
+#include "haarconsts.hpp"
+#include "haarsoa.hpp"
+
+namespace embedded_cascade
+{
+
+enum { NODES_PER_TREE = 2, RECTS_PER_FEATURE = 3 };
+
+constexpr int treesBefore( int stage )
+{
+    return stage == 0 ? 0 : treesBefore( stage - 1 ) + stage_classifier_count[stage - 1];
+}
+
+constexpr int rectValue( int node, int r, int field ) { return haar_feature_rect[( node * RECTS_PER_FEATURE + r ) * 4 + field]; }
+constexpr int rectArea( int node, int r ) { return rectValue( node, r, 2 ) * rectValue( node, r, 3 ); }
+constexpr int rectWeight( int node, int r ) { return haar_feature_weight[node * RECTS_PER_FEATURE + r]; }
+
+// the first rect weight is rebalanced so that a flat patch gives 0, as
+// cvSetImagesForHaarClassifierCascade does
+constexpr float firstWeight( int node )
+{
+    return -(float)( rectWeight( node, 1 ) * rectArea( node, 1 ) + rectWeight( node, 2 ) * rectArea( node, 2 ) ) / rectArea( node, 0 );
+}
+
+// leaf k of tree t: the generator stores the first two through classifier_alpha
+// and the last one through classifier_alpha2
+constexpr float leafValue( int tree, int k )
+{
+    return k < NODES_PER_TREE ? classifier_alpha[tree * NODES_PER_TREE + k] : classifier_alpha2[tree];
+}
+
+static_assert( treesBefore( ClassifierCascadeCount ) * NODES_PER_TREE == sizeof(classifier_threshold) / sizeof(classifier_threshold[0]),
+               "haarconsts.hpp does not hold two node trees" );
+static_assert( sizeof(haar_feature_rect) == sizeof(classifier_threshold) / sizeof(classifier_threshold[0]) * RECTS_PER_FEATURE * 4,
+               "haarconsts.hpp does not hold three rects per feature" );
+
+template<int Node, int R>
+inline int rectSum( const int* p, int step )
+{
+    const int x = rectValue( Node, R, 0 ), y = rectValue( Node, R, 1 );
+    const int w = rectValue( Node, R, 2 ), h = rectValue( Node, R, 3 );
+    return p[y * step + x] - p[y * step + x + w] - p[( y + h ) * step + x] + p[( y + h ) * step + x + w];
+}
+
+template<int Node>
+inline float featureValue( const int* p, int step )
+{
+    float value = firstWeight( Node ) * rectSum<Node, 0>( p, step ) + rectWeight( Node, 1 ) * rectSum<Node, 1>( p, step );
+    if( rectWeight( Node, 2 ) != 0 )
+        value += rectWeight( Node, 2 ) * rectSum<Node, 2>( p, step );
+    return value;
+}
+
+// norm is the window standard deviation times the normalization area, which is the
+// same test as the weighted sum over the area against threshold * stddev
+template<int Tree>
+inline float treeValue( const int* p, int step, float norm )
+{
+    const int n0 = Tree * NODES_PER_TREE, n1 = n0 + 1;
+    int idx = featureValue<n0>( p, step ) < classifier_threshold[n0] * norm ? classifier_left[n0] : classifier_right[n0];
+    // the only inner child of a two node tree is node 1
+    if( idx > 0 )
+        idx = featureValue<n1>( p, step ) < classifier_threshold[n1] * norm ? classifier_left[n1] : classifier_right[n1];
+    return idx == 0 ? leafValue( Tree, 0 ) : idx == -1 ? leafValue( Tree, 1 ) : leafValue( Tree, 2 );
+}
+
+template<int Tree, int End>
+struct Trees
+{
+    static inline void accumulate( const int* p, int step, float norm, float& sum )
+    {
+        sum += treeValue<Tree>( p, step, norm );
+        Trees<Tree + 1, End>::accumulate( p, step, norm, sum );
+    }
+};
+
+template<int End>
+struct Trees<End, End>
+{
+    static inline void accumulate( const int*, int, float, float& ) {}
+};
+
+template<int Stage>
+struct Stages
+{
+    static inline bool pass( const int* p, int step, float norm )
+    {
+        float sum = 0;
+        Trees<treesBefore( Stage ), treesBefore( Stage + 1 )>::accumulate( p, step, norm, sum );
+        if( sum < stage_classifier_threshold[Stage] - 0.0001f )
+            return false;
+        return Stages<Stage + 1>::pass( p, step, norm );
+    }
+};
+
+template<>
+struct Stages<ClassifierCascadeCount>
+{
+    static inline bool pass( const int*, int, float ) { return true; }
+};
+
+static_assert( soa_node_count == treesBefore( ClassifierCascadeCount ) * NODES_PER_TREE, "haarsoa.hpp and haarconsts.hpp are out of sync" );
+
+// evaluate4 takes leaf 0 for the leaf child of node 0 and leaves 1 and 2 for the
+// left and right children of node 1, with soa_node1_on_left for the side of node 1
+constexpr bool soaTreeShape( int t )
+{
+    return ( classifier_left[t * NODES_PER_TREE] == 1 ? classifier_right[t * NODES_PER_TREE] == 0 && soa_node1_on_left[t]
+                                                     : classifier_left[t * NODES_PER_TREE] == 0 && classifier_right[t * NODES_PER_TREE] == 1 && !soa_node1_on_left[t] )
+        && classifier_left[t * NODES_PER_TREE + 1] == -1 && classifier_right[t * NODES_PER_TREE + 1] == -2;
+}
+
+// halves the range each call, so the recursion stays well inside the constexpr depth limit
+constexpr bool soaTreeShapes( int begin, int end )
+{
+    return end - begin == 1 ? soaTreeShape( begin )
+                            : soaTreeShapes( begin, ( begin + end ) / 2 ) && soaTreeShapes( ( begin + end ) / 2, end );
+}
+
+static_assert( soa_tree_count == treesBefore( ClassifierCascadeCount ) && soaTreeShapes( 0, soa_tree_count ),
+               "the trees of haarconsts.hpp do not have the leaf layout evaluate4 relies on" );
+
+// corner offsets of every SoA rect for one integral row step
+struct SoaOffsets
+{
+    int step;
+    int rect01[soa_node_count][8];
+    int rect2[soa_three_rect_count][4];
+
+    SoaOffsets() : step( -1 ) {}
+
+    static void corners( const uchar* r, int step, int* ofs )
+    {
+        ofs[0] = r[1] * step + r[0];
+        ofs[1] = ofs[0] + r[2];
+        ofs[2] = ofs[0] + r[3] * step;
+        ofs[3] = ofs[2] + r[2];
+    }
+
+    void build( int _step )
+    {
+        step = _step;
+        for( int n = 0; n < soa_node_count; n++ )
+        {
+            corners( soa_rect01 + n * 8, step, rect01[n] );
+            corners( soa_rect01 + n * 8 + 4, step, rect01[n] + 4 );
+        }
+        for( int n = 0; n < soa_three_rect_count; n++ )
+            corners( soa_rect2 + n * 4, step, rect2[n] );
+    }
+};
+
+#if CV_SIMD128
+// four windows starting at p, Stride pixels apart
+template<int Stride>
+inline cv::v_int32x4 loadWindows( const int* p )
+{
+    return cv::v_int32x4( p[0], p[Stride], p[2 * Stride], p[3 * Stride] );
+}
+
+template<>
+inline cv::v_int32x4 loadWindows<1>( const int* p )
+{
+    return cv::v_load( p );
+}
+
+template<int Stride>
+inline cv::v_float32x4 rectSum4( const int* p, const int* ofs )
+{
+    return cv::v_cvt_f32( loadWindows<Stride>( p + ofs[0] ) - loadWindows<Stride>( p + ofs[1] )
+                        - loadWindows<Stride>( p + ofs[2] ) + loadWindows<Stride>( p + ofs[3] ) );
+}
+
+// bit i of the result is set when window i of the batch passes every stage
+template<int Stride>
+inline int evaluate4( const int* p, const SoaOffsets& offsets, const cv::v_float32x4& norm )
+{
+    cv::v_float32x4 zero = cv::v_setzero_f32();
+    cv::v_float32x4 alive = zero == zero;
+    int t = 0, node = 0;
+    for( int stage = 0; stage < ClassifierCascadeCount; stage++ )
+    {
+        cv::v_float32x4 sum = zero;
+        for( int j = 0; j < stage_classifier_count[stage]; j++, t++, node += NODES_PER_TREE )
+        {
+            cv::v_float32x4 value[NODES_PER_TREE];
+            for( int k = 0; k < NODES_PER_TREE; k++ )
+            {
+                const int n = node + k;
+                const int* ofs = offsets.rect01[n];
+                cv::v_float32x4 f = rectSum4<Stride>( p, ofs ) * cv::v_setall_f32( soa_weight0[n] )
+                                  + rectSum4<Stride>( p, ofs + 4 ) * cv::v_setall_f32( soa_weight1[n] );
+                if( soa_third[n] >= 0 )
+                    f += rectSum4<Stride>( p, offsets.rect2[soa_third[n]] ) * cv::v_setall_f32( soa_weight2[soa_third[n]] );
+                value[k] = f < cv::v_setall_f32( soa_node_threshold[n] ) * norm;
+            }
+            const float* leaf = soa_leaf + t * ( NODES_PER_TREE + 1 );
+            cv::v_float32x4 node1 = cv::v_select( value[1], cv::v_setall_f32( leaf[1] ), cv::v_setall_f32( leaf[2] ) );
+            sum += soa_node1_on_left[t] ? cv::v_select( value[0], node1, cv::v_setall_f32( leaf[0] ) )
+                                        : cv::v_select( value[0], cv::v_setall_f32( leaf[0] ), node1 );
+        }
+        alive = alive & ( sum >= cv::v_setall_f32( stage_classifier_threshold[stage] - 0.0001f ) );
+        if( cv::v_signmask( alive ) == 0 )
+            return 0;
+    }
+    return cv::v_signmask( alive );
+}
+#endif
+
+class EmbeddedCascade
+{
+public:
+    static cv::Size windowSize() { return cv::Size( cascadewidth, cascadeheight ); }
+
+    // variance is measured on the window shrunk by one pixel, as in the old cascade code
+    static float windowNorm( const int* sum, const double* sqsum, int step, int x, int y )
+    {
+        const int nx = x + 1, ny = y + 1, nw = cascadewidth - 2, nh = cascadeheight - 2;
+        const int o0 = ny * step + nx, o1 = o0 + nw, o2 = o0 + nh * step, o3 = o2 + nw;
+        double area = (double)nw * nh;
+        double s = sum[o0] - sum[o1] - sum[o2] + sum[o3];
+        double sq = sqsum[o0] - sqsum[o1] - sqsum[o2] + sqsum[o3];
+        double var = area * sq - s * s;
+        return var > 0 ? (float)std::sqrt( var ) : (float)area;
+    }
+
+    // window at (x, y) of the integral images, step in elements
+    static bool evaluate( const int* sum, const double* sqsum, int step, int x, int y )
+    {
+        return Stages<0>::pass( sum + y * step + x, step, windowNorm( sum, sqsum, step, x, y ) );
+    }
+
+    void detectMultiScale( const cv::Mat& gray, std::vector<cv::Rect>& objects, double scaleFactor = 1.1,
+                           int minNeighbors = 3, cv::Size minSize = cv::Size(), cv::Size maxSize = cv::Size() )
+    {
+        CV_Assert( gray.type() == CV_8UC1 && scaleFactor > 1 );
+        objects.clear();
+        if( maxSize.area() == 0 )
+            maxSize = gray.size();
+
+        // one allocation per input size, every scale is a view with the same step
+        if( sumBuf.rows < gray.rows + 1 || sumBuf.cols < gray.cols + 1 )
+        {
+            sumBuf.create( gray.rows + 1, gray.cols + 1, CV_32S );
+            sqsumBuf.create( gray.rows + 1, gray.cols + 1, CV_64F );
+            smallBuf.create( gray.rows, gray.cols, CV_8U );
+        }
+
+        for( double factor = 1; ; factor *= scaleFactor )
+        {
+            cv::Size window( cvRound( cascadewidth * factor ), cvRound( cascadeheight * factor ) );
+            cv::Size scaled( cvRound( gray.cols / factor ), cvRound( gray.rows / factor ) );
+            if( scaled.width < cascadewidth || scaled.height < cascadeheight )
+                break;
+            if( window.width > maxSize.width || window.height > maxSize.height )
+                break;
+            if( window.width < minSize.width || window.height < minSize.height )
+                continue;
+
+            cv::Mat small( smallBuf, cv::Rect( 0, 0, scaled.width, scaled.height ) );
+            cv::Mat sum( sumBuf, cv::Rect( 0, 0, scaled.width + 1, scaled.height + 1 ) );
+            cv::Mat sqsum( sqsumBuf, cv::Rect( 0, 0, scaled.width + 1, scaled.height + 1 ) );
+            cv::resize( gray, small, scaled, 0, 0, cv::INTER_LINEAR );
+            cv::integral( small, sum, sqsum, CV_32S, CV_64F );
+
+            const int* psum = sum.ptr<int>();
+            const double* psqsum = sqsum.ptr<double>();
+            int step = (int)( sum.step / sizeof(int) );
+            CV_Assert( (int)( sqsum.step / sizeof(double) ) == step );
+
+            if( offsets.step != step )
+                offsets.build( step );
+
+            int yStep = factor > 2 ? 1 : 2;
+            for( int y = 0; y + cascadeheight <= scaled.height; y += yStep )
+            {
+                if( yStep == 1 )
+                    scanRow<1>( psum, psqsum, step, y, scaled.width, factor, window, objects );
+                else
+                    scanRow<2>( psum, psqsum, step, y, scaled.width, factor, window, objects );
+            }
+        }
+
+        if( minNeighbors > 0 )
+            cv::groupRectangles( objects, minNeighbors, 0.2 );
+    }
+
+private:
+    template<int Stride>
+    void scanRow( const int* psum, const double* psqsum, int step, int y, int width, double factor,
+                  cv::Size window, std::vector<cv::Rect>& objects ) const
+    {
+        int x = 0;
+#if CV_SIMD128
+        for( ; x + 3 * Stride + cascadewidth <= width; x += 4 * Stride )
+        {
+            cv::v_float32x4 norm( windowNorm( psum, psqsum, step, x, y ), windowNorm( psum, psqsum, step, x + Stride, y ),
+                                  windowNorm( psum, psqsum, step, x + 2 * Stride, y ), windowNorm( psum, psqsum, step, x + 3 * Stride, y ) );
+            int mask = evaluate4<Stride>( psum + y * step + x, offsets, norm );
+            for( int i = 0; mask != 0; i++, mask >>= 1 )
+                if( mask & 1 )
+                    objects.push_back( cv::Rect( cvRound( ( x + i * Stride ) * factor ), cvRound( y * factor ), window.width, window.height ) );
+        }
+#endif
+        for( ; x + cascadewidth <= width; x += Stride )
+            if( evaluate( psum, psqsum, step, x, y ) )
+                objects.push_back( cv::Rect( cvRound( x * factor ), cvRound( y * factor ), window.width, window.height ) );
+    }
+
+    cv::Mat sumBuf, sqsumBuf, smallBuf;
+    SoaOffsets offsets;
+};
+
+} // namespace embedded_cascade
+
+#endif
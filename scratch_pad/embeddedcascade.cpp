@@ -0,0 +1,56 @@
+#include "opencv2/highgui.hpp"
+#include "opencv2/imgproc.hpp"
+#include "embedded_cascade.hpp"
+
+#include <iostream>
+
+using namespace std;
+using namespace cv;
+
+/** @function main */
+int main( int argc, char** argv )
+{
+    embedded_cascade::EmbeddedCascade cascade;   // nothing to load
+
+    VideoCapture capture;
+    Mat image;
+    if( argc > 1 )
+        image = imread( argv[1] );
+    else
+        capture.open( 0 );
+
+    if( image.empty() && !capture.isOpened() )
+    {
+        cout << "usage: embeddedcascade [image]  (camera 0 when no image is given)" << endl;
+        return -1;
+    }
+
+    Mat frame, gray;
+    vector<Rect> faces;
+    for(;;)
+    {
+        if( capture.isOpened() )
+            capture >> frame;
+        else
+            frame = image.clone();
+        if( frame.empty() )
+            break;
+
+        cvtColor( frame, gray, COLOR_BGR2GRAY );
+        equalizeHist( gray, gray );
+
+        TickMeter tm;
+        tm.start();
+        cascade.detectMultiScale( gray, faces, 1.1, 2, Size(30, 30) );
+        tm.stop();
+
+        for( size_t i = 0; i < faces.size(); i++ )
+            rectangle( frame, faces[i], Scalar(255, 0, 255), 2 );
+        putText( frame, format( "%.1f ms", tm.getTimeMilli() ), Point(10, 30), FONT_HERSHEY_SIMPLEX, 0.8, Scalar(0, 0, 255), 2 );
+        imshow( "embedded cascade", frame );
+
+        if( waitKey( capture.isOpened() ? 10 : 0 ) == 27 || !capture.isOpened() )
+            break;
+    }
+    return 0;
+}
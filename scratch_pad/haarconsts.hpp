@@ -1,8 +1,8 @@
-const int ClassifierCascadeCount=20;
-const int cascadewidth=20;
-const int cascadeheight=20;
+constexpr int ClassifierCascadeCount=20;
+constexpr int cascadewidth=20;
+constexpr int cascadeheight=20;
 
-const float stage_classifier_threshold[] = 
+constexpr float stage_classifier_threshold[] = 
 {
 0.3506923019886017 , 3.4721779823303223 , 5.9844889640808105 , 8.5117864608764648 ,
 8.4680156707763672 , 12.5784997940063480 , 14.5467500686645510 , 18.5722503662109380 ,
@@ -11,12 +11,12 @@ const float stage_classifier_threshold[] =
 44.6829681396484380 , 47.7634506225585940 , 44.2512817382812500 , 53.7555694580078130 
 };
 
-const int stage_classifier_count[] = 
+constexpr int stage_classifier_count[] = 
 {
 3, 9, 14, 19, 19, 27, 31, 39, 45, 47, 53, 67, 63, 71, 75, 78, 91, 97, 90, 109 
 };
 
-const uchar haar_feature_rect[] = 
+constexpr uchar haar_feature_rect[] = 
 {
 2,7,16,4,2,9,16,2,0,0,0,0,8,4,3,14,8,11,3,7,0,0,0,0,13,6,1,6,13,9,1,3,0,0,0,0,4,2,12,8,
 8,2,4,8,0,0,0,0,6,3,1,9,6,6,1,3,0,0,0,0,3,7,14,9,3,10,14,3,0,0,0,0,4,7,4,4,4,9,4,2,
@@ -649,7 +649,7 @@ const uchar haar_feature_rect[] =
 4,8,4,1,0,0,0,0 
 };
 
-const uchar haar_feature_weight[] = 
+constexpr signed char haar_feature_weight[] = 
 {
 -1,2,0,-1,2,0,-1,2,0,-1,3,0,-1,3,0,-1,3,0,-1,2,0,-1,2,0,-1,3,0,-1,2,0,-1,3,0,-1,2,0,-1,3,0,-1,
 3,0,-1,2,0,-1,2,0,-1,2,0,-1,3,0,-1,2,0,-1,3,0,-1,3,0,-1,2,0,-1,3,0,-1,2,0,-1,2,0,-1,3,0,-1,3,
@@ -811,7 +811,7 @@ const uchar haar_feature_weight[] =
 2,0 
 };
 
-const float classifier_threshold[] = 
+constexpr float classifier_threshold[] = 
 {
 4.3272329494357109e-003 , 1.3076160103082657e-002 , 5.2434601821005344e-004 , 4.4573000632226467e-003 ,
 -9.2708261217921972e-004 , 3.3989109215326607e-004 , 2.3025739938020706e-003 , 4.4174338690936565e-003 ,
@@ -1339,7 +1339,7 @@ const float classifier_threshold[] =
 -5.9445449151098728e-003 , -2.8927479870617390e-003 
 };
 
-const uchar classifier_left[] = 
+constexpr signed char classifier_left[] = 
 {
 0,-1,0,-1,1,-1,0,-1,0,-1,0,-1,0,-1,0,-1,1,-1,1,-1,1,-1,1,-1,1,-1,0,-1,0,-1,
 1,-1,0,-1,1,-1,1,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,1,-1,1,-1,0,-1,0,-1,
@@ -1413,7 +1413,7 @@ const uchar classifier_left[] =
 1,-1,1,-1,1,-1,1,-1,1,-1,1,-1,0,-1,1,-1,0,-1,0,-1,1,-1,0,-1 
 };
 
-const uchar classifier_right[] = 
+constexpr signed char classifier_right[] = 
 {
 1,-2,1,-2,0,-2,1,-2,1,-2,1,-2,1,-2,1,-2,0,-2,0,-2,0,-2,0,-2,0,-2,1,-2,1,-2,
 0,-2,1,-2,0,-2,0,-2,1,-2,1,-2,1,-2,1,-2,1,-2,1,-2,1,-2,0,-2,0,-2,1,-2,1,-2,
@@ -1487,7 +1487,7 @@ const uchar classifier_right[] =
 0,-2,0,-2,0,-2,0,-2,0,-2,0,-2,1,-2,0,-2,1,-2,1,-2,0,-2,1,-2 
 };
 
-const float classifier_alpha[] = 
+constexpr float classifier_alpha[] = 
 {
 3.8381900638341904e-002 , 8.9652568101882935e-001 , 1.0216630250215530e-001 , 1.2384019792079926e-001 ,
 1.9536970555782318e-001 , 2.1014410257339478e-001 , 1.0183759778738022e-001 , 8.2190579175949097e-001 ,
@@ -2015,7 +2015,7 @@ const float classifier_alpha[] =
 3.3520698547363281e-001 , 6.9292408227920532e-001 
 };
 
-const float classifier_alpha2[] = 
+constexpr float classifier_alpha2[] = 
 {
 2.6293140649795532e-001 , 6.9103831052780151e-001 , 8.2586747407913208e-001 , 1.9565549492835999e-001 ,
 5.9314841032028198e-001 , 8.0665212869644165e-001 , 2.7790638804435730e-001 , 3.4956431388854980e-001 ,
@@ -0,0 +1,2617 @@
+constexpr int soa_tree_count=1047;
+constexpr int soa_node_count=2094;
+constexpr int soa_three_rect_count=347;
+
+constexpr uchar soa_rect01[] = 
+{
+2,7,16,4,2,9,16,2,8,4,3,14,8,11,3,7,13,6,1,6,13,9,1,3,4,2,12,8,8,2,4,8,6,3,1,9,6,6,1,3,
+3,7,14,9,3,10,14,3,4,7,4,4,4,9,4,2,9,4,2,16,9,12,2,8,1,1,18,5,7,1,6,5,4,5,13,8,4,9,13,4,
+1,7,16,9,1,10,16,3,2,0,15,4,2,2,15,2,7,5,6,4,9,5,2,4,6,3,8,9,6,6,8,3,8,12,3,8,8,16,3,4,
+3,16,2,2,3,17,2,1,14,1,6,12,14,1,3,12,4,4,12,6,8,4,4,6,0,2,6,15,3,2,3,15,5,4,9,6,5,6,9,2,
+13,11,6,3,13,12,6,1,12,12,6,4,12,14,6,2,1,11,6,3,1,12,6,1,2,5,5,8,2,9,5,4,5,4,10,4,5,6,10,2,
+2,4,16,12,2,8,16,4,4,5,12,6,8,5,4,6,13,7,2,9,13,10,2,3,5,7,2,9,5,10,2,3,7,1,6,8,9,1,2,8,
+12,0,4,12,14,0,2,6,5,8,10,2,5,9,10,1,5,1,6,4,7,1,2,4,0,3,9,12,3,3,3,12,9,8,3,12,9,12,3,4,
+0,5,20,15,0,10,20,5,2,2,6,8,2,2,3,4,2,1,6,2,2,2,6,1,10,15,6,4,13,15,3,2,12,14,2,6,12,16,2,2,
+5,15,4,4,5,15,2,2,7,18,1,2,7,19,1,1,4,5,12,10,10,5,6,5,7,4,8,12,11,4,4,6,9,11,2,3,9,12,2,1,
+3,3,12,12,3,3,6,6,15,11,5,3,15,12,5,1,10,18,3,2,11,18,1,2,0,11,5,3,0,12,5,1,7,18,3,2,8,18,1,2,
+2,8,16,2,2,9,16,1,9,6,5,12,9,12,5,6,6,3,8,6,6,6,8,3,4,7,12,2,8,7,4,2,10,9,6,8,10,13,6,4,
+12,5,3,10,12,10,3,5,4,6,3,9,4,9,3,3,7,4,6,4,9,4,2,4,12,3,8,3,12,3,4,3,15,0,3,6,15,3,3,3,
+2,12,10,8,2,12,5,4,5,5,6,8,5,9,6,4,12,3,8,3,12,3,4,3,15,0,3,6,15,3,3,3,0,3,8,3,4,3,4,3,
+2,1,4,4,2,3,4,2,10,2,3,2,11,2,1,2,10,3,3,1,11,3,1,1,7,15,3,4,7,17,3,2,4,13,3,6,4,15,3,2,
+10,5,1,14,10,12,1,7,5,4,10,6,5,6,10,2,5,0,6,3,7,0,2,3,6,0,3,5,7,0,1,5,7,15,6,5,9,15,2,5,
+9,10,2,6,9,12,2,2,8,17,3,2,9,17,1,2,1,12,7,6,1,14,7,2,9,6,3,7,10,6,1,7,16,3,4,9,16,6,4,3,
+8,6,3,7,9,6,1,7,0,5,18,8,0,5,9,4,13,5,2,10,13,10,2,5,12,10,2,6,12,13,2,3,7,0,3,5,8,0,1,5,
+6,5,8,6,6,7,8,2,10,3,6,14,13,3,3,7,13,5,1,8,13,9,1,4,4,3,6,14,4,3,3,7,6,5,1,8,6,9,1,4,
+8,1,1,6,8,3,1,2,2,0,15,2,2,1,15,1,0,7,20,6,0,9,20,2,10,10,6,8,10,14,6,4,7,1,3,2,8,1,1,2,
+8,1,2,2,9,1,1,2,4,3,12,9,4,6,12,3,6,5,9,5,9,5,3,5,5,5,9,5,8,5,3,5,4,6,6,12,4,10,6,4,
+13,0,6,18,13,0,3,18,10,8,1,12,10,12,1,4,3,2,6,10,3,2,3,5,1,2,4,6,3,2,2,6,9,18,3,2,10,18,1,2,
+10,18,3,2,11,18,1,2,2,8,2,6,2,10,2,2,7,5,6,6,7,7,6,2,7,19,6,1,9,19,2,1,10,18,3,2,11,18,1,2,
+8,3,3,1,9,3,1,1,2,2,16,2,2,2,8,1,8,11,5,3,8,12,5,1,7,13,6,3,7,14,6,1,0,1,6,15,2,1,2,15,
+2,12,2,3,2,13,2,1,16,13,1,3,16,14,1,1,13,7,6,4,16,7,3,2,7,13,3,6,7,16,3,3,7,5,1,14,7,12,1,7,
+15,12,2,3,15,13,2,1,10,5,3,14,10,12,3,7,6,10,2,6,6,13,2,3,6,5,1,8,6,9,1,4,13,11,2,1,13,11,1,1,
+12,1,6,10,15,1,3,5,3,12,2,3,3,13,2,1,9,18,2,1,10,18,1,1,1,0,17,9,1,3,17,3,1,2,8,8,1,2,4,4,
+9,5,6,4,9,5,3,4,10,9,7,10,10,14,7,5,5,5,6,4,8,5,3,4,0,7,20,6,0,9,20,2,6,5,9,10,6,10,9,5,
+8,4,4,12,8,10,4,6,6,6,8,3,6,7,8,1,3,13,10,6,3,13,5,3,15,1,4,11,15,1,2,11,5,7,10,10,10,7,5,5,
+1,1,4,11,3,1,2,11,1,5,8,12,1,11,8,6,13,7,6,4,16,7,3,2,11,10,7,4,11,12,7,2,0,4,20,12,0,4,10,6,
+1,5,6,15,1,10,6,5,11,10,3,8,11,14,3,4,11,12,7,6,11,14,7,2,9,11,2,3,9,12,2,1,8,13,4,3,8,14,4,1,
+3,14,14,4,10,14,7,2,18,7,2,4,18,9,2,2,3,12,6,6,3,14,6,2,0,4,3,6,0,6,3,2,9,14,3,3,9,15,3,1,
+10,7,10,4,15,7,5,2,7,2,6,8,7,6,6,4,6,3,6,2,8,3,2,2,10,6,3,5,11,6,1,5,9,0,6,19,11,0,2,19,
+3,12,1,2,3,13,1,1,7,14,5,3,7,15,5,1,2,1,18,4,11,1,9,2,10,5,3,8,11,5,1,8,0,1,18,4,0,1,9,2,
+7,5,3,8,8,5,1,8,9,5,2,6,9,7,2,2,10,8,5,2,10,9,5,1,2,10,15,1,7,10,5,1,2,7,2,6,2,9,2,2,
+9,14,3,3,9,15,3,1,9,7,4,10,9,12,4,5,0,8,8,2,0,8,4,1,5,9,10,8,5,9,5,4,9,7,2,4,9,7,1,4,
+9,6,3,4,10,6,1,4,8,3,2,1,9,3,1,1,8,6,3,4,9,6,1,4,12,0,4,14,14,0,2,7,12,5,6,9,12,5,3,9,
+0,2,6,16,3,2,3,16,1,12,4,2,1,13,4,1,7,7,6,1,9,7,2,1,8,3,4,9,8,6,4,3,12,10,4,6,12,13,4,3,
+8,1,8,16,12,1,4,8,4,6,3,6,4,9,3,3,1,3,6,2,4,3,3,2,9,8,3,12,9,12,3,4,10,9,7,10,10,14,7,5,
+3,9,7,10,3,14,7,5,7,5,1,14,7,12,1,7,13,14,1,6,13,16,1,2,14,12,3,6,14,14,3,2,6,14,1,6,6,16,1,2,
+3,12,3,6,3,14,3,2,8,13,5,3,8,14,5,1,9,14,2,3,9,15,2,1,5,1,10,8,5,1,5,4,6,4,5,4,6,6,5,2,
+1,10,18,1,7,10,6,1,11,10,4,3,11,10,2,3,5,11,6,1,7,11,2,1,3,13,2,3,3,14,2,1,12,12,3,4,12,14,3,2,
+11,10,5,6,11,12,5,2,0,8,16,2,0,9,16,1,2,1,3,4,2,3,3,2,9,7,3,3,10,7,1,3,5,6,12,6,9,6,4,6,
+8,7,3,3,9,7,1,3,3,6,12,6,7,6,4,6,10,5,6,5,12,5,2,5,5,7,10,2,5,7,5,2,4,5,6,5,6,5,2,5,
+9,3,2,10,9,8,2,5,3,1,16,2,11,1,8,1,9,9,3,2,9,10,3,1,1,1,16,2,1,1,8,1,8,14,1,3,8,15,1,1,
+4,5,12,10,10,5,6,5,7,13,6,6,10,13,3,3,8,9,3,2,8,10,3,1,7,2,6,4,9,2,2,4,6,6,9,3,6,7,9,1,
+10,7,6,1,12,7,2,1,0,0,18,6,6,0,6,6,6,10,2,6,6,13,2,3,11,12,3,6,11,15,3,3,4,4,12,12,10,4,6,6,
+1,2,3,6,2,2,1,6,1,5,3,7,2,5,1,7,4,13,12,4,10,13,6,2,3,3,17,12,3,9,17,6,3,3,14,12,3,3,7,6,
+2,11,16,9,2,14,16,3,9,14,3,6,9,17,3,3,8,14,4,6,10,14,2,3,6,2,6,1,8,2,2,1,9,5,2,5,10,5,1,5,
+9,8,3,5,10,8,1,5,9,12,6,1,9,12,3,1,8,8,3,5,9,8,1,5,6,10,4,3,8,10,2,3,0,4,20,6,0,6,20,2,
+1,3,8,6,1,3,4,3,7,15,6,4,7,17,6,2,3,10,14,10,3,15,14,5,6,4,4,4,8,4,2,4,0,4,20,10,0,9,20,5,
+9,4,2,14,9,11,2,7,2,0,16,4,2,2,16,2,4,12,6,8,4,12,3,4,0,5,6,7,3,5,3,7,10,7,10,4,15,7,5,2,
+5,8,12,1,9,8,4,1,9,9,2,2,9,10,2,1,9,4,2,4,9,6,2,2,9,6,3,6,10,6,1,6,12,7,6,4,15,7,3,2,
+8,6,3,6,9,6,1,6,1,6,18,6,1,6,9,3,9,1,3,3,10,1,1,3,10,8,5,2,10,9,5,1,8,1,3,3,9,1,1,3,
+5,8,5,2,5,9,5,1,8,6,8,8,12,6,4,4,5,7,10,2,5,7,5,2,4,5,12,10,4,5,6,5,5,5,2,3,5,6,2,1,
+7,14,6,3,7,15,6,1,9,14,3,3,9,15,3,1,8,14,3,3,8,15,3,1,1,10,8,9,1,13,8,3,9,7,2,3,9,8,2,1,
+12,3,3,3,13,3,1,3,5,3,3,3,6,3,1,3,5,6,2,12,5,10,2,4,1,11,18,4,10,11,9,2,7,12,6,2,7,13,6,1,
+6,0,3,6,7,0,1,6,0,11,18,4,0,11,9,2,7,12,6,2,7,13,6,1,9,12,3,3,9,13,3,1,9,12,2,3,9,13,2,1,
+8,11,4,3,8,12,4,1,13,3,4,2,13,4,4,1,4,0,12,2,4,1,12,1,6,9,8,8,6,9,4,4,1,11,6,2,1,12,6,1,
+2,5,18,8,11,5,9,4,7,1,6,10,7,6,6,5,0,3,3,6,0,5,3,2,4,5,4,3,4,6,4,1,19,3,1,6,19,5,1,2,
+6,15,8,2,6,16,8,1,0,3,1,6,0,5,1,2,5,5,3,3,5,6,3,1,8,8,4,3,8,9,4,1,10,6,6,3,12,6,2,3,
+8,13,2,6,8,16,2,3,9,11,2,8,9,15,2,4,10,6,6,3,12,6,2,3,5,15,15,5,10,15,5,5,2,14,2,2,2,15,2,1,
+4,7,6,2,6,7,2,2,8,3,6,1,10,3,2,1,1,0,18,12,7,0,6,12,0,14,8,6,4,14,4,6,0,15,15,5,5,15,5,5,
+8,3,6,1,10,3,2,1,11,11,3,6,11,14,3,3,6,3,6,1,8,3,2,1,6,11,3,6,6,14,3,3,9,6,3,4,10,6,1,4,
+12,10,4,7,12,10,2,7,8,6,3,4,9,6,1,4,4,6,4,7,6,6,2,7,10,3,4,12,10,3,2,12,10,8,3,4,11,8,1,4,
+1,0,18,14,7,0,6,14,2,8,6,11,5,8,3,11,1,4,15,4,1,6,15,2,5,5,10,8,5,9,10,4,14,2,6,8,14,2,3,8,
+11,6,6,14,14,6,3,7,9,5,2,12,9,11,2,6,3,7,4,6,3,9,4,2,14,3,6,6,14,3,3,6,15,2,4,4,15,4,4,2,
+0,2,6,7,3,2,3,7,3,6,6,14,3,6,3,7,4,6,16,8,4,10,16,4,10,12,2,8,10,16,2,4,7,0,6,20,9,0,2,20,
+1,7,16,12,1,7,8,6,9,11,3,3,9,12,3,1,11,9,4,5,11,9,2,5,3,3,1,2,3,4,1,1,7,17,5,3,7,18,5,1,
+8,12,4,8,10,12,2,4,7,4,10,12,12,4,5,6,8,14,4,3,8,15,4,1,5,9,4,5,7,9,2,5,9,9,8,2,9,9,4,2,
+14,15,5,2,14,16,5,1,9,14,2,3,9,15,2,1,1,7,8,4,1,7,4,2,19,3,1,2,19,4,1,1,9,12,2,3,9,13,2,1,
+3,14,14,4,3,14,7,2,5,0,10,2,5,1,10,1,11,14,4,6,11,16,4,2,7,14,6,3,7,15,6,1,7,13,6,6,7,13,3,3,
+0,2,1,6,0,4,1,2,6,7,8,2,6,8,8,1,9,7,6,1,9,7,3,1,7,1,6,10,7,6,6,5,0,2,6,2,0,3,6,1,
+11,4,2,4,11,4,1,4,11,10,3,6,11,13,3,3,3,9,8,2,7,9,4,2,0,0,4,6,2,0,2,6,7,0,6,2,9,0,2,2,
+9,15,2,3,9,16,2,1,3,12,1,2,3,13,1,1,4,5,11,3,4,6,11,1,11,4,2,4,11,4,1,4,8,3,6,3,10,3,2,3,
+7,4,2,4,8,4,1,4,6,3,6,3,8,3,2,3,11,4,4,3,11,5,4,1,11,8,2,8,11,12,2,4,8,7,3,5,9,7,1,5,
+9,7,2,5,10,7,1,5,14,11,1,6,14,13,1,2,8,8,4,3,8,9,4,1,0,3,2,2,0,4,2,1,4,14,5,6,4,16,5,2,
+11,4,4,3,11,5,4,1,12,4,3,3,12,5,3,1,5,4,4,3,5,5,4,1,5,15,4,2,7,15,2,2,15,1,5,9,15,4,5,3,
+9,10,3,3,9,11,3,1,1,6,2,6,1,8,2,2,2,4,8,15,2,9,8,5,9,12,3,2,9,13,3,1,9,12,3,3,9,13,3,1,
+7,6,3,5,8,6,1,5,5,3,6,2,7,3,2,2,6,1,8,10,10,1,4,5,0,0,20,10,10,0,10,5,6,3,3,1,7,3,1,1,
+0,2,6,8,2,2,2,8,11,10,3,4,11,12,3,2,12,6,3,8,12,10,3,4,6,10,3,4,6,12,3,2,5,6,3,8,5,10,3,4,
+2,6,18,6,11,6,9,3,7,14,7,3,7,15,7,1,0,0,2,12,1,0,1,12,1,2,18,16,1,10,18,8,9,13,5,3,9,14,5,1,
+8,13,4,3,8,14,4,1,0,6,18,6,0,6,9,3,7,13,6,3,7,14,6,1,17,4,1,3,17,5,1,1,12,11,1,9,12,14,1,3,
+2,4,1,3,2,5,1,1,5,4,2,3,5,5,2,1,1,2,18,3,7,2,6,3,0,1,20,6,0,3,20,2,7,5,6,3,9,5,2,3,
+13,7,6,4,16,7,3,2,3,1,4,10,3,1,2,5,0,4,19,10,0,9,19,5,9,8,3,12,9,12,3,4,11,18,5,2,11,19,5,1,
+5,16,6,4,5,16,3,2,5,18,3,2,5,19,3,1,13,11,3,2,13,12,3,1,8,5,8,4,8,5,4,4,1,2,18,6,1,2,9,3,
+3,5,14,6,3,7,14,2,18,1,2,6,18,3,2,2,9,11,6,1,11,11,2,1,0,2,6,11,3,2,3,11,4,12,2,3,4,13,2,1,
+6,12,9,2,9,12,3,2,9,4,6,15,9,4,3,15,5,11,6,1,7,11,2,1,5,4,6,15,8,4,3,15,14,12,6,7,14,12,3,7,
+18,3,2,9,18,6,2,3,8,1,3,1,9,1,1,1,0,12,6,7,3,12,3,7,13,7,6,4,16,7,3,2,8,0,10,2,8,1,10,1,
+1,7,6,4,1,7,3,2,1,2,3,3,1,3,3,1,9,13,4,3,9,14,4,1,12,13,7,2,12,14,7,1,5,12,9,2,8,12,3,2,
+6,10,4,8,6,14,4,4,1,0,18,4,7,0,6,4,12,0,5,2,12,1,5,1,7,7,1,12,7,13,1,6,6,2,3,4,7,2,1,4,
+0,13,20,6,0,15,20,2,8,5,12,2,14,5,6,1,8,14,2,3,8,15,2,1,8,14,4,3,8,15,4,1,12,13,7,6,12,15,7,2,
+6,0,8,12,10,0,4,6,0,15,9,4,0,17,9,2,9,0,2,5,10,0,1,5,9,5,2,6,9,5,1,6,17,2,3,6,17,4,3,2,
+3,11,2,3,3,12,2,1,7,13,3,3,7,14,3,1,14,12,5,3,14,13,5,1,4,8,14,3,4,9,14,1,1,12,5,3,1,13,5,1,
+1,15,12,2,1,15,6,1,12,11,4,2,12,12,4,1,9,8,3,5,10,8,1,5,9,5,2,6,10,5,1,6,0,2,3,6,0,4,3,2,
+12,11,4,2,12,12,4,1,9,7,3,5,10,7,1,5,4,11,4,2,4,12,4,1,8,8,3,5,9,8,1,5,9,3,3,1,10,3,1,1,
+16,5,3,8,17,5,1,8,8,3,3,1,9,3,1,1,1,5,3,8,2,5,1,8,10,1,3,3,11,1,1,3,17,5,2,4,17,5,1,4,
+2,8,14,3,2,9,14,1,9,7,1,3,9,8,1,1,6,1,8,10,6,6,8,5,13,0,6,8,16,0,3,4,1,5,2,4,2,5,1,4,
+4,2,12,2,4,3,12,1,8,8,4,4,8,10,4,2,5,6,12,4,9,6,4,4,1,2,8,1,5,2,4,1,1,1,6,10,3,1,2,10,
+8,6,8,2,8,6,4,2,10,7,6,6,12,7,2,6,4,6,8,2,8,6,4,2,4,7,6,6,6,7,2,6,3,14,16,4,3,16,16,2,
+8,12,4,2,8,13,4,1,8,12,3,3,8,13,3,1,5,12,6,1,8,12,3,1,18,10,2,3,18,11,2,1,16,8,4,6,16,10,4,2,
+8,3,2,1,9,3,1,1,7,1,3,9,8,1,1,9,5,11,11,6,5,14,11,3,12,2,3,14,12,9,3,7,8,7,3,3,9,7,1,3,
+3,5,12,5,7,5,4,5,1,2,6,3,4,2,3,3,5,5,6,10,5,5,3,5,16,18,2,2,16,18,1,2,16,18,2,2,16,18,1,2,
+8,4,2,5,9,4,1,5,8,4,1,4,8,6,1,2,7,15,12,4,13,15,6,2,11,18,6,2,11,19,6,1,7,7,4,10,7,12,4,5,
+5,6,10,8,5,10,10,4,11,1,6,12,14,1,3,6,5,8,12,1,9,8,4,1,4,7,3,6,4,9,3,2,4,11,3,4,4,13,3,2,
+14,16,2,2,14,17,2,1,15,15,2,2,15,16,2,1,7,12,6,2,7,13,6,1,8,13,4,2,8,14,4,1,11,1,6,12,14,1,3,6,
+12,2,4,2,12,3,4,1,3,10,12,6,3,10,6,3,3,1,6,12,3,1,3,6,16,6,4,14,18,6,2,7,5,1,10,8,10,1,5,4,
+0,6,4,14,0,6,2,7,1,15,12,4,1,15,6,2,10,17,3,3,11,17,1,3,11,2,2,6,12,2,1,3,7,17,3,3,8,17,1,3,
+8,15,4,3,8,16,4,1,10,15,4,2,12,15,2,1,13,13,4,3,13,14,4,1,3,13,4,3,3,14,4,1,7,2,2,6,7,2,1,3,
+2,1,16,3,2,2,16,1,10,15,4,2,12,15,2,1,6,15,4,2,6,15,2,1,3,0,13,3,3,1,13,1,0,9,20,3,0,10,20,1,
+6,7,9,2,6,8,9,1,8,14,3,6,9,14,1,6,9,10,2,2,9,11,2,1,9,7,2,5,9,7,1,5,5,6,10,3,5,6,5,3,
+9,7,2,5,10,7,1,5,5,6,10,3,10,6,5,3,13,9,2,2,13,9,1,2,4,3,12,11,8,3,4,11,7,1,2,7,8,1,1,7,
+7,4,3,8,8,4,1,8,13,9,2,2,13,9,1,2,11,6,2,2,12,6,1,1,5,4,2,3,5,5,2,1,6,5,1,3,6,6,1,1,
+13,9,2,2,13,9,1,2,16,14,3,3,16,15,3,1,5,9,2,2,6,9,1,2,1,14,3,3,1,15,3,1,13,1,1,6,13,3,1,2,
+13,3,7,2,13,4,7,1,0,6,20,14,0,13,20,7,0,4,3,6,0,6,3,2,10,1,9,6,10,3,9,2,8,0,12,5,8,0,6,5,
+0,0,18,5,6,0,6,5,1,1,9,6,1,3,9,2,15,15,2,2,15,16,2,1,13,16,3,4,13,18,3,2,3,15,2,2,3,16,2,1,
+4,16,3,4,4,18,3,2,11,14,1,3,11,15,1,1,9,13,5,3,9,14,5,1,0,0,3,6,0,2,3,2,4,1,6,3,6,1,2,3,
+9,13,4,3,9,14,4,1,8,15,5,3,8,16,5,1,8,3,3,2,9,3,1,2,1,8,18,2,1,9,18,1,11,14,1,3,11,15,1,1,
+8,13,6,3,8,14,6,1,8,14,1,3,8,15,1,1,4,13,12,4,4,13,6,2,10,7,2,2,10,7,1,2,13,4,2,8,14,4,1,4,
+0,5,4,6,0,7,4,2,8,7,2,2,9,7,1,2,13,0,3,7,14,0,1,7,11,2,2,14,11,2,1,14,4,0,3,7,5,0,1,7,
+5,5,8,12,5,5,4,6,11,4,6,3,11,5,6,1,12,3,4,3,12,4,4,1,5,5,10,12,5,5,5,6,3,6,12,3,9,6,6,3,
+9,6,2,7,9,6,1,7,9,5,2,4,9,5,1,4,8,7,3,3,9,7,1,3,5,1,6,4,7,1,2,4,13,16,7,3,13,17,7,1,
+12,4,3,3,12,5,3,1,0,16,7,3,0,17,7,1,5,4,3,3,5,5,3,1,12,9,8,10,12,9,4,10,8,10,12,5,12,10,4,5,
+0,9,8,10,4,9,4,10,0,10,12,5,4,10,4,5,2,3,6,2,5,3,3,2,0,0,17,9,0,3,17,3,4,7,12,2,8,7,4,2,
+10,4,6,4,12,4,2,4,0,10,20,4,0,12,20,2,4,3,6,5,6,3,2,5,1,1,18,4,7,1,6,4,13,9,2,3,13,9,1,3,
+6,15,7,4,6,17,7,2,3,17,4,2,3,18,4,1,9,4,8,10,9,9,8,5,9,17,3,2,10,17,1,2,8,2,4,8,8,6,4,4,
+3,4,14,12,3,4,7,6,7,7,6,4,9,7,2,4,6,7,9,4,6,9,9,2,2,10,3,3,2,11,3,1,4,6,2,9,4,9,2,3,
+9,11,3,3,9,12,3,1,3,1,15,2,3,2,15,1,9,8,2,3,9,9,2,1,9,6,2,5,10,6,1,5,9,7,2,3,9,8,2,1,
+4,10,12,10,4,15,12,5,0,10,4,2,0,11,4,1,5,15,9,2,5,16,9,1,8,14,6,3,8,15,6,1,8,16,4,3,8,17,4,1,
+8,9,4,2,8,10,4,1,3,3,14,2,3,4,14,1,11,12,1,2,11,13,1,1,4,12,12,1,8,12,4,1,0,2,1,2,0,3,1,1,
+7,4,4,6,9,4,2,6,0,2,20,14,10,2,10,7,14,6,1,3,14,7,1,1,0,4,20,12,0,4,10,6,8,12,1,2,8,13,1,1,
+9,18,3,2,10,18,1,2,9,17,6,2,11,17,2,2,5,6,2,3,5,7,2,1,5,4,3,3,5,5,3,1,14,15,3,2,14,16,3,1,
+11,3,3,4,12,3,1,4,3,15,3,2,3,16,3,1,9,12,2,3,9,13,2,1,9,13,3,7,10,13,1,7,12,12,5,3,12,13,5,1,
+8,18,3,2,9,18,1,2,4,7,12,4,4,7,6,2,6,19,14,1,6,19,7,1,16,14,3,2,16,15,3,1,1,0,6,10,1,0,3,5,
+1,0,4,10,1,0,2,5,15,3,5,6,15,5,5,2,9,5,2,15,9,10,2,5,0,3,5,6,0,5,5,2,6,0,3,2,7,0,1,2,
+12,8,8,2,16,8,4,1,5,8,12,1,9,8,4,1,3,13,3,3,3,14,3,1,5,13,3,2,5,14,3,1,9,15,3,3,9,16,3,1,
+7,15,7,3,7,16,7,1,3,14,11,6,3,16,11,2,0,19,14,1,7,19,7,1,9,17,6,2,11,17,2,2,12,11,6,2,14,11,2,2,
+5,17,6,2,7,17,2,2,0,1,9,10,3,1,3,10,10,1,3,3,11,1,1,3,9,5,6,4,9,5,3,4,7,1,3,3,8,1,1,3,
+0,4,4,11,2,4,2,11,9,5,6,4,9,5,3,4,6,0,8,10,10,0,4,5,6,6,5,14,6,13,5,7,8,5,4,14,8,12,4,7,
+7,7,6,5,9,7,2,5,9,3,3,9,9,6,3,3,8,1,3,3,9,1,1,3,9,6,2,4,10,6,1,4,10,8,6,9,10,8,3,9,
+16,4,3,8,17,4,1,8,5,9,10,6,5,9,5,3,5,5,6,4,8,5,3,4,9,8,4,2,9,9,4,1,11,7,2,2,11,7,1,2,
+8,12,4,8,8,12,2,4,0,1,4,9,0,4,4,3,9,10,3,3,9,11,3,1,8,11,4,2,8,12,4,1,7,8,4,2,7,9,4,1,
+7,8,6,1,9,8,2,1,16,0,4,9,16,0,2,9,16,0,3,6,16,3,3,3,0,0,4,9,2,0,2,9,1,0,3,6,1,3,3,3,
+9,7,6,9,11,7,2,9,10,6,3,6,11,6,1,6,1,2,18,2,1,2,9,1,5,8,6,8,7,8,2,8,9,0,6,16,11,0,2,16,
+14,1,6,18,17,1,3,9,2,9,2,3,2,10,2,1,0,1,6,18,0,1,3,9,11,8,4,12,11,8,2,12,2,1,18,18,2,10,18,9,
+6,3,3,1,7,3,1,1,4,12,2,2,4,13,2,1,8,13,5,3,8,14,5,1,8,14,4,3,8,15,4,1,3,12,5,3,3,13,5,1,
+6,3,3,4,7,3,1,4,11,10,2,2,12,10,1,1,5,8,12,1,9,8,4,1,8,4,4,8,10,4,2,8,6,6,8,5,10,6,4,5,
+10,4,6,4,12,4,2,4,12,7,2,2,13,7,1,1,3,5,10,8,3,9,10,4,7,1,2,12,7,7,2,6,12,7,2,2,13,7,1,1,
+11,13,1,6,11,16,1,3,5,1,6,15,7,1,2,15,6,7,2,2,6,7,1,1,17,5,2,2,17,6,2,1,10,3,4,10,12,3,2,5,
+1,5,2,2,1,6,2,1,7,10,2,2,7,10,1,1,3,12,14,4,10,12,7,2,9,15,3,2,9,16,3,1,1,13,3,3,1,14,3,1,
+0,3,1,2,0,4,1,1,7,7,6,1,9,7,2,1,0,4,16,6,0,6,16,2,9,3,2,14,9,10,2,7,12,0,4,3,12,0,2,3,
+4,18,12,2,8,18,4,2,4,10,12,4,8,10,4,4,9,9,2,2,9,10,2,1,14,1,2,8,15,1,1,4,3,4,9,1,6,4,3,1,
+3,3,4,2,3,4,4,1,11,15,2,4,11,17,2,2,14,13,2,6,14,15,2,2,6,6,1,6,6,9,1,3,6,10,8,8,6,14,8,4,
+8,13,4,3,8,14,4,1,10,11,4,8,10,15,4,4,5,11,6,1,7,11,2,1,5,4,6,10,8,4,3,10,14,2,6,3,14,3,6,1,
+9,12,3,2,9,13,3,1,8,1,4,6,8,3,4,2,3,5,13,8,3,9,13,4,12,5,5,3,12,6,5,1,5,14,15,6,5,16,15,2,
+3,5,5,3,3,6,5,1,9,14,2,6,9,14,1,3,9,12,3,2,9,13,3,1,9,13,3,2,9,14,3,1,0,2,6,3,0,3,6,1,
+0,1,9,11,3,1,3,11,8,13,4,6,10,13,2,3,7,13,6,3,7,14,6,1,3,12,14,4,3,12,7,2,7,14,1,4,7,16,1,2,
+8,13,4,6,10,13,2,3,10,14,1,3,10,15,1,1,8,13,4,6,8,13,2,3,9,14,1,3,9,15,1,1,10,15,2,3,10,16,2,1,
+11,16,1,2,11,17,1,1,9,0,2,2,9,1,2,1,0,1,5,8,0,5,5,4,10,14,2,3,10,15,2,1,10,13,2,3,10,14,2,1,
+0,3,16,6,0,6,16,3,4,1,2,2,5,1,1,2,9,7,2,3,9,8,2,1,10,8,2,12,10,12,2,4,9,7,2,2,10,7,1,2,
+5,0,6,8,7,0,2,8,9,7,3,6,10,7,1,6,8,12,10,8,8,16,10,4,8,7,3,6,9,7,1,6,4,7,12,2,10,7,6,2,
+8,6,8,3,8,6,4,3,16,15,3,3,16,16,3,1,4,6,12,3,10,6,6,3,7,8,3,5,8,8,1,5,0,10,20,2,10,10,10,1,
+11,16,9,4,14,16,3,4,0,5,3,4,1,5,1,4,8,15,4,2,8,15,2,1,1,8,19,3,1,9,19,1,15,16,3,3,15,17,3,1,
+0,4,20,10,0,4,10,5,2,14,7,6,2,16,7,2,8,6,6,6,10,6,2,6,16,4,4,6,16,6,4,2,7,13,6,3,7,14,6,1,
+7,13,4,3,7,14,4,1,13,13,6,2,13,14,6,1,14,12,2,3,14,13,2,1,1,13,6,2,1,14,6,1,4,12,2,3,4,13,2,1,
+17,4,3,5,18,4,1,5,5,5,14,8,12,5,7,4,6,8,6,5,8,8,2,5,0,4,4,6,0,6,4,2,9,1,3,6,10,1,1,6,
+10,4,6,3,10,5,6,1,8,1,3,6,9,1,1,6,4,4,6,3,4,5,6,1,12,4,3,3,12,5,3,1,12,11,4,2,12,12,4,1,
+0,2,20,6,0,2,10,3,5,4,3,3,5,5,3,1,2,10,16,4,10,10,8,2,3,10,16,6,11,10,8,3,1,10,16,6,1,10,8,3,
+4,7,2,4,5,7,1,4,11,16,9,4,14,16,3,4,3,16,14,4,10,16,7,2,0,16,9,4,3,16,3,4,1,14,6,6,1,14,3,3,
+9,0,2,1,9,0,1,1,6,7,8,10,10,7,4,5,2,15,1,2,2,16,1,1,0,14,7,6,0,16,7,2,7,8,6,2,7,9,6,1,
+9,2,2,15,9,7,2,5,5,6,2,2,5,7,2,1,6,6,8,3,6,7,8,1,12,13,5,6,12,15,5,2,0,0,20,18,0,9,20,9,
+5,1,6,6,7,1,2,6,5,1,4,9,7,1,2,9,1,19,18,1,7,19,6,1,14,16,5,2,14,17,5,1,0,5,15,10,0,10,15,5,
+7,15,4,2,7,15,2,1,14,11,2,2,14,12,2,1,9,8,3,3,9,9,3,1,4,11,2,2,4,12,2,1,8,8,3,3,8,9,3,1,
+9,10,2,3,9,11,2,1,8,8,4,3,8,9,4,1,1,9,4,10,1,9,2,5,0,12,6,8,2,12,2,8,9,1,4,2,11,1,2,1,
+12,13,7,6,12,15,7,2,7,0,2,3,7,1,2,1,7,14,6,3,9,14,2,3,9,6,6,4,11,6,2,4,8,10,8,3,8,10,4,3,
+6,10,4,3,8,10,2,3,6,8,3,5,7,8,1,5,0,4,8,1,4,4,4,1,8,2,2,6,8,2,1,3,0,7,20,6,0,9,20,2,
+12,10,3,6,12,13,3,3,8,15,1,4,8,17,1,2,5,16,2,4,5,18,2,2,6,2,8,12,6,6,8,4,4,7,12,2,8,7,4,2,
+7,0,6,1,9,0,2,1,8,11,3,3,8,12,3,1,12,11,3,6,12,14,3,3,11,2,6,10,14,2,3,5,5,7,10,12,5,7,5,6,
+4,4,2,10,4,9,2,5,9,7,2,3,9,7,1,3,11,9,6,2,11,9,3,2,4,7,2,2,5,7,1,2,0,2,4,6,0,4,4,2,
+10,7,3,4,11,7,1,4,9,7,3,5,10,7,1,5,9,1,1,3,9,2,1,1,0,6,16,6,0,6,8,3,10,15,3,3,10,16,3,1,
+9,14,4,3,9,15,4,1,3,2,6,10,3,2,3,5,3,0,14,2,3,1,14,1,9,14,3,3,9,15,3,1,10,15,3,3,10,16,3,1,
+9,13,2,6,9,16,2,3,7,13,6,3,7,14,6,1,12,11,3,6,12,14,3,3,8,12,5,2,8,13,5,1,5,11,3,6,5,14,3,3,
+8,12,3,2,8,13,3,1,11,13,7,6,11,15,7,2,7,14,6,3,7,15,6,1,3,13,14,4,3,13,7,2,8,14,4,6,8,14,2,3,
+8,15,4,3,8,16,4,1,7,16,6,2,9,16,2,2,7,7,6,2,7,8,6,1,3,9,13,3,3,10,13,1,9,8,3,4,9,10,3,2,
+8,10,4,3,8,11,4,1,7,7,3,4,8,7,1,4,8,7,3,5,9,7,1,5,12,3,3,4,13,3,1,4,9,7,2,3,9,7,1,3,
+5,3,3,4,6,3,1,4,3,7,12,1,7,7,4,1,12,5,3,3,12,6,3,1,11,2,6,2,11,3,6,1,3,2,14,2,3,2,7,1,
+6,1,7,14,6,8,7,7,8,0,12,5,8,0,6,5,1,9,18,1,7,9,6,1,0,0,10,5,5,0,5,5,2,5,8,15,2,10,8,5,
+12,5,3,3,12,6,3,1,13,4,2,3,13,5,2,1,2,15,4,3,2,16,4,1,5,6,10,3,10,6,5,3,11,6,2,2,12,6,1,1,
+12,4,4,3,12,5,4,1,7,6,2,2,7,6,1,1,4,4,4,3,4,5,4,1,11,4,3,3,12,4,1,3,9,3,2,1,9,3,1,1,
+4,5,5,3,4,6,5,1,4,6,4,3,4,7,4,1,11,4,3,3,12,4,1,3,8,8,4,3,8,9,4,1,6,4,3,3,7,4,1,3,
+4,14,1,3,4,15,1,1,9,7,2,3,9,7,1,3,17,0,3,2,17,1,3,1,8,10,2,9,8,13,2,3,0,8,18,2,0,9,18,1,
+9,15,2,3,9,16,2,1,8,7,4,3,8,8,4,1,1,14,6,6,1,14,3,3,0,18,6,2,0,19,6,1,12,9,4,3,12,9,2,3,
+9,8,3,8,10,8,1,8,4,9,4,3,6,9,2,3,4,18,6,1,6,18,2,1,9,7,3,2,10,7,1,2,6,7,8,12,10,7,4,6,
+8,7,3,2,9,7,1,2,8,7,3,6,9,7,1,6,3,16,14,4,10,16,7,2,1,14,18,4,10,14,9,2,8,7,3,3,8,8,3,1,
+0,4,20,12,0,4,10,6,5,5,10,12,10,5,5,6,10,2,4,7,10,2,2,7,8,11,4,3,8,12,4,1,8,12,3,3,8,13,3,1,
+13,13,5,6,13,15,5,2,7,0,6,6,9,0,2,6,2,13,5,6,2,15,5,2,0,4,2,12,0,4,1,6,9,19,3,1,10,19,1,1,
+18,0,2,6,18,2,2,2,0,3,1,6,0,5,1,2,0,0,3,6,0,2,3,2,17,2,3,7,18,2,1,7,10,3,4,7,10,3,2,7,
+0,2,3,7,1,2,1,7,6,2,4,8,8,2,2,8,13,0,1,4,13,2,1,2,5,1,12,5,9,1,4,5,6,0,1,4,6,2,1,2,
+3,1,12,5,7,1,4,5,9,12,3,8,10,12,1,8,7,13,6,1,9,13,2,1,7,14,6,3,7,15,6,1,5,16,7,3,5,17,7,1,
+0,12,20,6,0,14,20,2,4,18,14,2,4,19,14,1,8,12,3,8,9,12,1,8,7,13,3,3,7,14,3,1,5,5,12,10,11,5,6,5,
+8,1,5,10,8,6,5,5,5,4,9,12,5,10,9,6,7,13,6,6,7,15,6,2,8,4,5,16,8,12,5,8,8,12,4,6,8,15,4,3,
+7,13,2,2,7,13,1,1,7,12,2,2,7,12,1,1,18,0,2,14,18,0,1,14,12,11,7,2,12,12,7,1,1,18,1,2,1,19,1,1,
+2,18,1,2,2,19,1,1,9,7,2,1,9,7,1,1,9,6,2,3,9,6,1,3,3,1,2,2,4,1,1,2,3,0,3,2,3,1,3,1,
+12,10,3,4,12,12,3,2,7,7,8,2,7,8,8,1,8,8,3,4,8,10,3,2,7,12,6,3,7,13,6,1,0,2,10,3,5,2,5,3,
+0,1,20,6,0,3,20,2,7,6,6,3,9,6,2,3,3,7,14,4,3,9,14,2,5,7,3,6,5,9,3,2,8,8,3,12,8,12,3,4,
+9,17,6,2,12,17,3,1,10,17,4,3,10,18,4,1,4,2,4,2,4,3,4,1,7,3,6,14,9,3,2,14,15,13,1,6,15,16,1,3,
+13,14,2,6,13,16,2,2,4,11,5,6,4,14,5,3,4,17,4,2,6,17,2,2,0,6,20,2,0,6,10,2,6,5,10,12,11,5,5,6,
+4,0,2,12,4,0,1,6,4,1,6,2,6,1,2,2,13,7,2,1,13,7,1,1,5,5,15,6,5,7,15,2,1,10,18,2,1,10,9,1,
+1,6,15,7,6,6,5,7,8,14,4,3,8,15,4,1,9,14,3,3,9,15,3,1,8,14,4,3,8,15,4,1,8,13,3,2,8,14,3,1,
+15,14,5,3,15,15,5,1,0,14,20,1,0,14,10,1,0,14,6,3,0,15,6,1,5,3,4,2,5,4,4,1,0,6,20,1,0,6,10,1,
+6,3,10,14,11,3,5,7,8,12,4,2,8,13,4,1,6,3,8,6,6,3,4,3,13,7,2,1,13,7,1,1,6,3,10,14,11,3,5,7,
+5,7,2,1,6,7,1,1,4,3,10,14,4,3,5,7,9,7,2,2,9,7,1,2,0,3,20,1,0,3,10,1,2,1,10,3,2,2,10,1,
+9,7,2,2,10,7,1,2,9,17,3,2,10,17,1,2,9,7,3,6,10,7,1,6,8,17,3,2,9,17,1,2,8,7,3,6,9,7,1,6,
+16,3,4,6,16,5,4,2,15,6,2,12,16,6,1,6,1,4,18,10,1,4,9,5,9,4,2,4,9,6,2,2,12,5,3,2,12,6,3,1,
+5,12,10,4,5,14,10,2,5,5,3,2,5,6,3,1,4,6,12,6,8,6,4,6,14,4,6,6,14,6,6,2,16,0,4,6,18,0,2,3,
+0,4,6,6,0,6,6,2,0,0,4,6,0,0,2,3,12,0,8,5,12,0,4,5,16,0,4,17,16,0,2,17,1,0,18,20,7,0,6,20,
+6,0,2,5,7,0,1,5,0,6,20,1,0,6,10,1,8,7,6,4,10,7,2,4,1,1,16,4,1,1,8,2,7,2,4,2,7,2,2,1,
+7,4,9,3,7,5,9,1,10,4,5,12,10,10,5,6,3,12,2,3,3,13,2,1,8,8,3,5,9,8,1,5,13,9,2,3,13,9,1,3,
+15,11,2,2,15,12,2,1,5,6,2,3,5,7,2,1,2,11,6,2,2,12,6,1,15,11,4,3,15,12,4,1,16,0,4,17,16,0,2,17,
+1,11,4,3,1,12,4,1,9,11,1,3,9,12,1,1,10,9,6,7,10,9,3,7,8,15,4,2,8,16,4,1,4,9,6,7,7,9,3,7,
+9,14,2,3,9,15,2,1,0,2,20,2,10,2,10,1,6,7,8,2,6,8,8,1,0,2,20,2,0,2,10,1,3,1,2,10,3,1,1,5,
+13,4,1,10,13,9,1,5,9,8,4,3,9,9,4,1,2,11,16,4,2,11,8,2,5,1,3,5,6,1,1,5,9,10,2,3,9,11,2,1,
+9,11,2,2,9,12,2,1,0,10,20,2,0,11,20,1,1,7,6,4,1,7,3,2,12,0,8,8,16,0,4,4,14,1,6,4,16,1,2,4,
+6,3,2,14,6,10,2,7,6,1,7,12,6,7,7,6,5,0,15,5,10,0,5,5,15,0,4,10,15,0,2,10,1,0,18,3,7,0,6,3,
+0,0,17,2,0,1,17,1,10,0,3,3,11,0,1,3,10,0,3,12,11,0,1,12,1,3,4,16,1,3,2,8,7,0,3,3,8,0,1,3,
+9,13,2,6,9,16,2,3,9,0,6,13,11,0,2,13,7,7,3,2,8,7,1,2,8,2,1,12,8,6,1,4,4,10,12,6,10,10,6,3,
+13,5,2,3,13,6,2,1,4,10,12,6,4,10,6,3,5,5,2,3,5,6,2,1,8,6,6,7,10,6,2,7,9,6,2,4,9,6,1,4,
+6,6,6,7,8,6,2,7,9,6,2,4,10,6,1,4,12,9,2,3,12,9,1,3,0,6,20,1,0,6,10,1,5,7,10,2,10,7,5,2,
+1,16,4,3,1,17,4,1,12,4,3,3,12,5,3,1,10,3,5,3,10,4,5,1,3,9,14,8,3,9,7,4,6,8,8,10,6,8,4,5,
+12,4,3,3,12,5,3,1,10,3,5,3,10,4,5,1,5,4,3,3,5,5,3,1,5,3,5,3,5,4,5,1,13,16,2,3,13,17,2,1,
+0,5,20,6,0,7,20,2,3,14,3,3,3,15,3,1,7,15,5,3,7,16,5,1,12,9,2,3,12,9,1,3,15,13,2,6,15,13,1,6,
+6,9,2,3,7,9,1,3,3,13,2,6,4,13,1,6,11,4,2,4,11,4,1,4,13,4,2,5,13,4,1,5,7,4,2,4,8,4,1,4,
+5,4,2,5,6,4,1,5,19,6,1,2,19,7,1,1,12,7,8,13,12,7,4,13,0,6,1,2,0,7,1,1,6,15,4,3,6,16,4,1,
+11,8,2,2,11,9,2,1,11,7,2,4,11,7,1,4,4,13,2,3,4,14,2,1,0,17,18,3,6,17,6,3,1,0,18,5,7,0,6,5,
+5,7,3,4,5,9,3,2,10,6,2,2,10,6,1,2,6,4,14,4,13,4,7,2,5,16,6,4,5,16,3,2,7,15,2,4,7,17,2,2,
+8,5,5,14,8,12,5,7,9,9,2,2,9,10,2,1,7,5,3,7,8,5,1,7,0,0,3,9,0,3,3,3,8,6,8,8,12,6,4,4,
+4,8,13,2,4,9,13,1,4,3,6,1,6,3,2,1,9,1,2,6,9,3,2,2,10,5,6,4,12,5,2,4,9,5,2,12,9,9,2,4,
+8,14,4,3,8,15,4,1,8,12,4,3,8,13,4,1,10,3,6,7,12,3,2,7,3,10,16,6,3,12,16,2,5,5,3,10,5,10,3,5,
+6,10,3,6,6,13,3,3,17,2,2,12,17,2,1,12,16,6,2,14,16,13,2,7,3,11,12,9,3,14,12,3,0,2,4,12,2,2,2,12,
+18,0,2,18,18,0,1,18,16,12,3,2,16,13,3,1,0,2,2,15,1,2,1,15,1,10,2,4,1,12,2,2,11,1,2,18,11,1,1,18,
+3,2,14,2,10,2,7,1,7,1,2,18,8,1,1,18,6,1,8,12,6,7,8,6,8,14,4,3,8,15,4,1,7,14,6,3,7,15,6,1,
+0,13,5,2,0,14,5,1,9,0,2,6,9,0,1,3,9,0,2,6,10,0,1,3,9,7,3,6,10,7,1,6,9,0,2,6,9,0,1,3,
+8,7,3,6,9,7,1,6,9,6,2,6,9,6,1,6,9,4,4,3,9,4,2,3,0,4,4,3,0,5,4,1,8,7,4,2,8,8,4,1,
+10,6,6,3,12,6,2,3,9,6,3,12,9,10,3,4,5,4,2,3,5,5,2,1,5,6,1,3,5,7,1,1,9,17,3,2,10,17,1,2,
+0,7,20,2,0,8,20,1,4,3,6,7,6,3,2,7,5,10,6,10,5,10,3,5,9,17,3,2,10,17,1,2,9,10,2,2,9,11,2,1,
+8,17,3,2,9,17,1,2,5,6,1,3,5,7,1,1,0,1,20,2,10,1,10,1,14,2,6,9,14,5,6,3,5,3,3,2,5,4,3,1,
+5,4,4,2,7,4,2,2,14,2,6,9,14,5,6,3,0,12,20,6,0,14,20,2,2,2,16,4,2,2,8,2,7,12,5,3,7,13,5,1,
+14,9,6,10,14,9,3,10,16,6,3,2,16,7,3,1,0,9,6,10,3,9,3,10,0,16,5,2,0,17,5,1,9,12,2,3,9,13,2,1,
+9,7,2,12,9,11,2,4,3,2,6,2,5,2,2,2,4,1,1,2,4,2,1,1,11,15,1,2,11,16,1,1,3,1,16,2,11,1,8,1,
+3,6,2,2,3,6,1,1,5,11,10,6,5,11,5,3,10,11,4,6,10,14,4,3,14,9,6,11,16,9,2,11,0,9,6,11,2,9,2,11,
+2,11,16,6,2,11,8,3,12,0,8,10,16,0,4,5,14,2,6,4,16,2,2,4,0,0,8,10,0,0,4,5,0,2,6,4,2,2,2,4,
+4,9,15,2,9,9,5,2,12,3,4,8,14,3,2,4,9,2,2,9,10,2,1,9,0,2,20,1,10,2,10,1,16,1,4,5,16,1,2,5,
+16,0,4,6,16,3,4,3,4,3,6,4,6,3,2,4,0,0,18,5,6,0,6,5,6,2,12,14,12,2,6,7,11,8,3,5,12,8,1,5,
+5,12,2,2,5,13,2,1,5,10,4,3,7,10,2,3,4,9,15,2,9,9,5,2,10,7,6,2,12,7,2,2,1,9,15,2,6,9,5,2,
+5,0,2,10,5,0,1,5,0,0,20,14,0,7,20,7,12,7,8,4,12,7,4,4,0,7,8,4,4,7,4,4,8,1,3,3,9,1,1,3,
+9,7,3,4,10,7,1,4,9,9,3,1,10,9,1,1,8,9,3,2,8,10,3,1,8,4,2,8,8,4,1,4,5,8,12,3,5,9,12,1,
+11,14,1,3,11,15,1,1,6,10,3,6,6,12,3,2,4,17,8,3,4,18,8,1,17,6,2,3,17,7,2,1,9,12,2,2,10,12,1,1,
+9,13,2,4,9,13,1,2,9,11,2,3,9,12,2,1,5,5,12,10,11,5,6,5,6,3,12,12,12,3,6,6,5,7,2,2,5,7,1,1,
+4,3,3,2,5,3,1,2,6,2,12,14,12,2,6,7,5,2,12,3,9,2,4,3,1,1,18,17,7,1,6,17,0,9,10,1,5,9,5,1,
+16,8,4,3,16,9,4,1,7,13,6,6,7,16,6,3,6,14,1,6,6,16,1,2,6,17,4,2,6,18,4,1,10,18,6,2,13,18,3,1,
+16,8,1,3,16,9,1,1,8,13,4,3,8,14,4,1,9,15,1,2,9,16,1,1,13,0,3,12,14,0,1,12,15,11,1,3,15,12,1,1,
+8,15,3,3,8,16,3,1,4,0,3,12,5,0,1,12,9,7,3,3,10,7,1,3,9,9,3,1,10,9,1,1,2,2,12,14,2,2,6,7,
+4,2,12,3,8,2,4,3,18,18,2,2,18,18,1,2,17,2,3,8,18,2,1,8,0,18,2,2,1,18,1,2,6,11,2,6,6,14,2,3,
+13,10,5,6,13,12,5,2,5,8,15,3,5,9,15,1,2,10,5,6,2,12,5,2,0,8,15,3,0,9,15,1,16,2,3,1,17,2,1,1,
+17,4,3,2,18,4,1,2,0,8,8,12,0,8,4,6,1,7,8,6,1,7,4,3,14,1,6,2,16,1,2,2,15,0,4,4,17,0,2,2,
+1,1,4,11,3,1,2,11,5,5,1,8,5,9,1,4,7,7,6,1,9,7,2,1,4,7,12,2,8,7,4,2,8,4,4,4,8,6,4,2,
+2,4,9,1,5,4,3,1,9,12,2,8,9,16,2,4,3,8,14,12,3,14,14,6,6,13,7,3,6,14,7,1,5,9,6,3,7,9,2,3,
+12,1,6,3,12,2,6,1,8,12,6,2,8,13,6,1,0,2,18,2,0,2,9,1,6,10,3,6,6,13,3,3,14,0,6,6,14,0,3,6,
+15,0,5,8,15,4,5,4,7,16,6,4,9,16,2,4,2,11,14,4,2,11,7,2,14,10,6,10,14,10,3,10,9,8,10,12,14,8,5,6,
+0,10,6,10,3,10,3,10,1,8,10,12,1,8,5,6,9,3,6,1,11,3,2,1,7,4,6,3,9,4,2,3,5,3,6,1,7,3,2,1,
+4,5,6,3,6,5,2,3,9,16,3,3,9,17,3,1,8,14,6,3,8,15,6,1,6,0,8,12,6,0,4,6,4,12,2,3,4,13,2,1,
+12,16,6,3,12,17,6,1,7,12,7,2,7,13,7,1,2,16,6,3,2,17,6,1,0,7,16,6,0,10,16,3,9,7,3,3,10,7,1,3,
+9,7,3,5,10,7,1,5,0,5,20,10,0,5,10,5,3,1,4,2,5,1,2,2,7,6,8,10,11,6,4,5,17,6,3,2,17,7,3,1,
+5,6,8,10,5,6,4,5,5,12,10,6,5,14,10,2,9,7,3,3,10,7,1,3,10,3,2,6,11,3,1,3,0,4,3,3,0,5,3,1,
+3,16,8,4,3,16,4,2,8,13,5,2,8,14,5,1,8,7,4,12,8,11,4,4,5,9,2,2,6,9,1,2,9,15,2,3,9,16,2,1,
+13,9,2,3,13,9,1,3,14,0,6,17,16,0,2,17,5,10,2,2,6,10,1,2,2,9,9,1,5,9,3,1,9,11,2,3,9,12,2,1,
+7,11,6,3,7,12,6,1,0,6,3,2,0,7,3,1,7,0,6,1,9,0,2,1,9,16,3,3,9,17,3,1,2,13,17,6,2,16,17,3,
+1,3,3,7,2,3,1,7,1,1,6,4,3,1,2,4,14,1,6,5,14,1,3,5,13,2,3,2,13,3,3,1,0,1,6,5,3,1,3,5,
+2,3,2,6,2,5,2,2,9,10,3,2,9,11,3,1,8,13,4,3,8,14,4,1,6,3,3,1,7,3,1,1,8,2,3,12,8,6,3,4,
+11,12,1,2,11,13,1,1,11,12,2,2,12,12,1,1,5,5,2,2,5,6,2,1,5,4,1,3,5,5,1,1,3,11,16,4,11,11,8,2,
+0,10,20,3,0,11,20,1,1,11,16,4,1,11,8,2,4,2,4,2,4,3,4,1,12,6,2,2,13,6,1,1,12,11,6,6,12,13,6,2,
+6,6,2,2,6,6,1,1,6,4,4,16,8,4,2,16,11,18,3,2,11,19,3,1,9,17,6,2,12,17,3,1,2,13,5,2,2,14,5,1,
+3,15,2,2,3,16,2,1,9,7,3,3,10,7,1,3,9,6,2,6,9,6,1,6,1,14,7,6,1,16,7,2,8,1,2,11,9,1,1,11,
+9,7,2,4,9,7,1,4,11,10,2,1,11,10,1,1,0,3,3,9,1,3,1,9,0,3,3,6,0,5,3,2,11,15,2,2,12,15,1,1,
+11,14,2,2,12,14,1,1,7,15,2,2,7,15,1,1,7,14,2,2,7,14,1,1,8,13,4,6,10,13,2,3,2,14,16,4,10,14,8,2,
+9,8,2,2,9,9,2,1,7,7,5,3,7,8,5,1,7,5,6,2,9,5,2,2,9,1,6,18,11,1,2,18,8,6,3,4,9,6,1,4,
+8,5,2,4,8,5,1,2,9,13,2,6,10,13,1,3,11,0,3,18,12,0,1,18,6,0,3,18,7,0,1,18,5,15,4,2,7,15,2,2,
+1,9,18,1,7,9,6,1,0,0,20,3,0,1,20,1,9,6,2,4,10,6,1,4,6,10,6,2,8,10,2,2,0,7,20,1,0,7,10,1,
+11,3,5,4,11,5,5,2,5,7,10,1,10,7,5,1,8,10,3,3,8,11,3,1,2,0,16,8,10,0,8,4,11,0,9,10,11,5,9,5,
+0,2,8,18,4,2,4,18,0,0,2,6,0,2,2,2,6,0,9,2,6,1,9,1,4,1,12,2,4,2,12,1,2,1,16,14,2,8,16,7,
+5,1,8,12,5,7,8,6,9,11,2,2,9,12,2,1,9,10,5,6,9,12,5,2,3,0,13,8,3,4,13,4,6,7,5,8,6,11,5,4,
+9,5,2,3,9,6,2,1,6,8,8,3,6,9,8,1,2,2,7,6,2,5,7,3,2,1,14,4,2,1,7,2,11,14,1,3,11,15,1,1,
+6,15,8,2,6,16,8,1,8,14,1,3,8,15,1,1,8,11,2,8,8,15,2,4,6,15,8,2,6,16,8,1,7,16,8,3,7,17,8,1,
+0,16,2,2,0,17,2,1,1,16,8,4,1,16,4,2,2,9,16,3,2,10,16,1,13,11,2,4,13,11,1,4,0,13,16,6,0,15,16,2,
+5,11,2,4,6,11,1,4,18,2,2,18,19,2,1,9,19,7,1,9,19,10,1,3,0,2,2,18,0,2,1,9,0,7,1,9,0,10,1,3,
+14,12,2,2,14,13,2,1,11,14,2,3,11,15,2,1,7,8,6,2,7,9,6,1,7,12,4,6,7,12,2,3,8,13,5,3,8,14,5,1,
+12,14,2,2,13,14,1,1,7,13,6,3,7,14,6,1,7,13,5,2,7,14,5,1,2,10,16,4,10,10,8,2,7,0,6,6,9,0,2,6,
+7,1,6,3,7,2,6,1,0,12,6,2,0,13,6,1,6,3,11,2,6,4,11,1,12,0,8,6,16,0,4,3,8,12,1,2,8,13,1,1,
+8,8,1,12,8,12,1,4,11,11,2,2,12,11,1,1,12,7,3,13,13,7,1,13,7,11,2,2,7,11,1,1,3,13,1,3,3,14,1,1,
+10,18,3,2,11,18,1,2,11,11,2,1,11,11,1,1,1,10,5,9,1,13,5,3,4,8,6,4,6,8,2,4,13,12,1,4,13,14,1,2,
+11,3,4,14,13,3,2,7,6,12,1,4,6,14,1,2,5,3,4,14,5,3,2,7,10,18,3,2,11,18,1,2,9,12,3,3,9,13,3,1,
+2,2,12,6,2,2,6,3,6,6,6,2,9,6,3,2,1,0,18,12,7,0,6,12,5,7,6,4,5,7,3,2,5,7,10,4,5,9,10,2,
+7,7,6,4,9,7,2,4,9,5,2,2,9,6,2,1,9,9,2,2,9,10,2,1,6,17,8,3,6,18,8,1,9,17,6,2,12,17,3,1,
+4,12,2,2,4,13,2,1,3,12,9,2,3,13,9,1,8,3,6,1,10,3,2,1,9,3,4,6,11,3,2,3,0,3,6,5,3,3,3,5,
+2,0,2,18,2,6,2,6,14,2,4,9,14,5,4,3,10,18,3,2,11,18,1,2,2,2,4,9,2,5,4,3,7,18,3,2,8,18,1,2,
+10,14,3,3,10,15,3,1,10,12,2,6,10,15,2,3,7,5,3,6,7,7,3,2,3,3,6,2,3,4,6,1,8,4,7,3,8,5,7,1,
+13,6,2,3,13,7,2,1,8,8,2,12,8,12,2,4,5,4,8,14,5,4,4,7,0,1,20,8,10,1,10,4,4,0,12,2,4,1,12,1,
+0,1,20,8,0,1,10,4,4,0,12,2,4,1,12,1,9,5,6,3,9,5,3,3,8,13,10,6,8,15,10,2,5,5,6,3,8,5,3,3,
+6,3,6,1,8,3,2,1,11,18,9,2,14,18,3,2,13,11,6,7,13,11,3,7,4,6,12,10,4,6,6,5,8,17,3,3,9,17,1,3,
+11,18,9,2,14,18,3,2,13,11,6,8,13,11,3,8,4,16,2,2,4,17,2,1,7,15,4,4,7,17,4,2,12,4,3,3,12,5,3,1,
+13,6,2,3,13,7,2,1,5,11,6,1,7,11,2,1,7,10,3,1,8,10,1,1,0,12,20,4,0,14,20,2,10,2,3,2,10,3,3,1,
+5,4,3,3,5,5,3,1,5,5,4,3,5,6,4,1,8,8,4,3,8,9,4,1,10,4,2,12,10,8,2,4,0,3,4,3,0,4,4,1,
+1,3,2,3,1,4,2,1,16,1,4,11,16,1,2,11,18,2,2,16,19,2,1,8,1,8,6,12,3,8,2,12,7,2,6,2,7,2,3,1,
+12,4,8,2,16,4,4,1,10,6,6,2,12,6,2,2,0,4,8,2,0,4,4,1,1,3,3,5,2,3,1,5,16,3,4,6,16,5,4,2,
+8,6,4,3,8,7,4,1,8,14,1,3,8,15,1,1,4,11,1,2,4,12,1,1,8,14,6,3,8,15,6,1,7,15,7,3,7,16,7,1,
+9,12,2,8,9,16,2,4,4,6,6,2,6,6,2,2,12,7,4,2,12,8,4,1,5,3,13,10,5,8,13,5,4,7,4,2,4,8,4,1,
+0,8,16,2,0,8,8,1,11,8,2,5,11,8,1,5,10,0,6,13,10,0,3,13,1,6,4,2,1,7,4,1,4,3,2,1,5,3,1,1,
+11,8,2,5,11,8,1,5,12,10,4,8,12,10,2,8,7,8,2,5,8,8,1,5,4,10,4,8,6,10,2,8,6,7,9,12,9,7,3,12,
+11,13,2,3,11,13,1,3,7,10,6,10,10,10,3,10,8,11,4,8,8,11,2,4,16,1,4,11,16,1,2,11,18,2,2,4,18,2,1,4,
+5,6,6,2,5,6,3,1,5,4,1,3,5,5,1,1,11,1,4,14,11,1,2,14,4,2,12,3,8,2,4,3,5,1,4,14,7,1,2,14,
+7,3,6,2,9,3,2,2,2,0,18,4,8,0,6,4,9,5,2,10,9,10,2,5,8,6,3,4,9,6,1,4,5,5,9,11,8,5,3,11,
+10,6,3,5,11,6,1,5,8,9,6,5,8,9,3,5,7,6,3,5,8,6,1,5,6,10,6,3,9,10,3,3,10,0,3,7,11,0,1,7,
+0,3,20,12,0,9,20,6,9,7,2,2,10,7,1,2,5,9,4,1,7,9,2,1,13,13,3,2,13,14,3,1,16,9,4,6,16,9,2,6,
+7,15,6,3,7,16,6,1,6,16,7,3,6,17,7,1,11,14,9,6,11,16,9,2,19,14,1,3,19,15,1,1,0,9,6,6,3,9,3,6,
+0,19,9,1,3,19,3,1,11,14,9,6,11,16,9,2,12,12,6,6,12,14,6,2,1,14,8,6,1,16,8,2,8,1,3,2,9,1,1,2,
+18,2,2,4,18,2,1,4,14,0,6,3,16,0,2,3,0,2,2,4,1,2,1,4,0,0,6,3,2,0,2,3,9,0,3,2,10,0,1,2,
+12,1,2,2,12,1,1,2,8,0,3,2,9,0,1,2,6,1,2,2,7,1,1,2,10,8,2,3,10,9,2,1,13,15,6,2,13,16,6,1,
+8,12,2,2,8,12,1,1,8,15,3,5,9,15,1,5,8,6,4,12,8,12,4,6,7,6,7,8,7,10,7,4,0,11,8,2,0,12,8,1,
+8,11,2,2,8,11,1,1,7,7,12,1,11,7,4,1,10,8,3,2,11,8,1,2,1,7,12,1,5,7,4,1,6,5,8,2,6,5,4,1,
+9,10,3,10,10,10,1,10,16,0,2,4,16,0,1,4,8,10,3,10,9,10,1,10,9,10,2,3,9,11,2,1,8,9,4,2,10,9,2,1,
+12,14,7,6,12,16,7,2,6,1,3,1,7,1,1,1,2,0,2,4,3,0,1,4,11,11,2,2,12,11,1,1,12,12,6,6,12,14,6,2,
+1,0,6,10,1,0,3,5,3,0,2,9,3,3,2,3,14,13,3,2,14,14,3,1,15,2,3,2,15,3,3,1,2,13,5,2,2,14,5,1,
+3,4,12,10,3,4,6,5,5,1,14,6,5,3,14,2,15,3,3,2,15,4,3,1,7,11,2,2,7,11,1,1,2,14,6,6,2,16,6,2,
+6,13,8,3,6,14,8,1,1,19,18,1,7,19,6,1,8,12,1,6,8,15,1,3,0,0,14,15,0,5,14,5,3,0,16,8,3,4,16,4,
+6,1,8,12,6,7,8,6,5,3,3,3,6,3,1,3,5,1,3,4,6,1,1,4,15,14,4,6,17,14,2,3,12,11,6,8,15,11,3,4,
+8,7,2,4,9,7,1,4,6,11,3,1,7,11,1,1,12,3,2,14,12,3,1,14,12,11,6,2,15,11,3,1,0,2,5,2,0,3,5,1,
+0,0,15,1,5,0,5,1,12,11,6,2,15,11,3,1,10,5,2,2,10,5,1,2,9,7,2,2,10,7,1,2,9,0,2,10,9,0,1,5,
+18,14,2,2,18,15,2,1,13,11,4,9,13,14,4,3,8,13,2,2,8,13,1,1,7,8,4,3,7,9,4,1,8,9,4,2,8,10,4,1,
+13,12,4,2,13,13,4,1,6,14,2,2,6,14,1,1,0,14,2,2,0,15,2,1,7,13,6,3,7,14,6,1,7,9,10,6,7,11,10,2,
+2,9,12,4,6,9,4,4,7,9,6,11,10,9,3,11,9,7,2,3,9,8,2,1,9,14,4,3,9,15,4,1,2,3,3,17,3,3,1,17,
+0,11,6,3,0,12,6,1,4,3,11,9,4,6,11,3,0,2,6,11,3,2,3,11,13,0,4,5,13,0,2,5,9,7,6,4,12,7,3,2,
+5,7,8,2,9,7,4,2,1,8,15,1,6,8,5,1,4,12,12,2,8,12,4,2,13,0,4,10,15,0,2,5,9,9,2,2,9,10,2,1,
+3,9,6,2,6,9,3,2,8,17,4,3,8,18,4,1,8,3,9,2,11,3,3,2,3,3,9,2,6,3,3,2,5,0,9,14,8,0,3,14,
+7,3,7,10,7,8,7,5,4,8,13,3,4,9,13,1,3,12,14,4,3,12,7,2,8,12,4,2,8,13,4,1,6,10,9,8,6,14,9,4,
+9,12,2,8,9,16,2,4,8,12,3,3,8,13,3,1,5,5,4,10,7,5,2,10,14,15,3,3,14,16,3,1,4,6,13,3,4,7,13,1,
+3,15,3,3,3,16,3,1,3,9,4,2,3,9,2,1,0,11,20,4,10,11,10,2,8,15,4,3,8,16,4,1,0,11,20,4,0,11,10,2,
+8,15,4,3,8,16,4,1,10,13,1,6,10,16,1,3,2,1,18,2,11,1,9,1,8,14,3,3,8,15,3,1,4,1,6,1,6,1,2,1,
+11,13,1,3,11,14,1,1,13,5,2,12,13,11,2,6,1,14,18,6,1,16,18,2,8,13,1,3,8,14,1,1,7,13,6,3,7,14,6,1,
+9,10,3,2,9,11,3,1,5,1,3,3,6,1,1,3,5,5,6,5,8,5,3,5,7,5,6,14,7,12,6,7,7,16,6,2,9,16,2,2,
+0,2,2,12,1,2,1,12,1,0,5,3,1,1,5,1,12,4,3,3,12,5,3,1,12,6,3,3,12,7,3,1,5,4,3,3,5,5,3,1,
+5,6,3,3,5,7,3,1,8,12,4,8,10,12,2,4,2,17,18,2,11,17,9,1,9,3,2,2,9,4,2,1,8,5,4,6,8,7,4,2,
+9,0,8,6,9,2,8,2,1,0,18,4,7,0,6,4,0,0,4,8,2,0,2,8,0,4,6,9,2,4,2,9,1,4,18,2,7,4,6,2,
+8,16,12,4,14,16,6,2,0,0,18,2,0,0,9,1,3,0,3,18,4,0,1,18,14,9,4,7,14,9,2,7,15,14,2,2,15,15,2,1,
+2,9,4,7,4,9,2,7,3,14,2,2,3,15,2,1,11,0,6,6,11,2,6,2,14,0,2,6,15,0,1,3,7,11,2,2,7,11,1,1,
+7,10,2,2,8,10,1,2,9,14,2,6,9,17,2,3,12,18,4,2,12,19,4,1,8,17,4,3,8,18,4,1,2,18,8,2,2,19,8,1,
+2,9,16,3,2,10,16,1,9,9,2,2,9,10,2,1,5,14,2,4,5,14,1,2,8,9,4,2,8,9,2,1,9,5,2,5,9,5,1,5,
+9,9,3,2,10,9,1,2,8,9,3,2,9,9,1,2,8,8,3,6,9,8,1,6,8,12,4,8,10,12,2,4,2,17,16,2,10,17,8,1,
+8,12,3,8,9,12,1,8,3,10,1,3,3,11,1,1,9,14,10,6,14,14,5,3,14,13,3,6,14,15,3,2,1,19,18,1,7,19,6,1,
+2,10,15,2,7,10,5,2,4,17,16,3,4,18,16,1,8,6,4,9,8,9,4,3,9,16,2,4,9,16,1,2,5,5,10,8,5,9,10,4,
+13,1,4,2,13,1,2,2,14,0,3,6,14,2,3,2,6,7,2,2,6,7,1,1,7,1,6,1,9,1,2,1,9,11,3,3,9,12,3,1,
+12,9,3,3,13,9,1,3,8,11,3,3,8,12,3,1,5,9,3,3,6,9,1,3,10,11,1,3,10,12,1,1,7,9,6,4,10,9,3,2,
+4,7,2,2,4,7,1,1,5,7,3,1,6,7,1,1,18,3,2,3,18,4,2,1,13,1,4,2,13,1,2,2,3,1,4,2,5,1,2,2,
+3,0,5,2,3,1,5,1,14,7,6,4,17,7,3,2,4,8,16,2,4,9,16,1,2,11,5,6,2,13,5,2,5,16,2,4,5,16,1,2,
+15,6,2,12,16,6,1,6,13,3,6,16,15,3,2,16,4,5,12,12,4,5,6,6,5,1,10,13,10,1,5,13,11,5,2,2,12,5,1,1,
+13,5,1,3,13,6,1,1,7,4,2,4,7,4,1,2,7,5,6,4,10,5,3,4,12,4,4,6,14,4,2,3,12,11,7,6,12,13,7,2,
+5,6,6,6,7,6,2,6,9,8,2,2,9,9,2,1,15,6,2,2,16,6,1,1,14,7,4,4,16,7,2,2,5,5,6,2,7,5,2,2,
+1,19,18,1,7,19,6,1,12,3,3,3,12,4,3,1,16,0,2,3,16,1,2,1,5,3,3,3,5,4,3,1,2,0,2,3,2,1,2,1,
+15,6,2,2,16,6,1,1,10,13,1,6,10,16,1,3,0,7,10,2,0,7,5,1,3,10,6,2,3,11,6,1,12,18,4,2,12,19,4,1,
+12,18,2,2,13,18,1,1,6,19,2,1,7,19,1,1,0,4,2,16,0,4,1,8,16,1,4,9,16,4,4,3,10,2,1,2,10,3,1,1,
+4,14,4,6,4,14,2,3,4,15,1,4,4,17,1,2,0,2,20,4,10,2,10,2,14,5,2,8,14,9,2,4,5,12,4,5,7,12,2,5,
+0,13,9,6,0,15,9,2,9,14,11,3,9,15,11,1,7,14,7,3,7,15,7,1,3,6,2,2,3,6,1,1,6,7,2,7,7,7,1,7,
+14,5,1,3,14,6,1,1,13,4,4,3,13,5,4,1,2,7,4,4,2,7,2,2,2,9,13,6,2,12,13,3,10,1,3,4,11,1,1,4,
+9,8,5,2,9,9,5,1,0,14,11,3,0,15,11,1,8,11,2,8,8,15,2,4,5,11,10,6,5,14,10,3,5,13,15,5,10,13,5,5,
+8,10,1,10,8,15,1,5,4,14,6,2,6,14,2,2,7,14,7,3,7,15,7,1,7,16,9,3,7,17,9,1,8,7,3,3,8,8,3,1,
+3,5,1,6,3,8,1,3,6,5,11,2,6,6,11,1,9,0,3,2,10,0,1,2,5,5,1,3,5,6,1,1,8,7,3,2,9,7,1,2,
+5,2,10,6,10,2,5,3,8,4,6,4,8,4,3,4,8,16,3,4,9,16,1,4,9,13,2,6,9,13,1,3,9,8,3,1,10,8,1,1,
+2,5,18,15,2,10,18,5,1,3,6,2,4,3,3,2,7,6,6,2,9,6,2,2,8,17,4,3,8,18,4,1,10,13,2,3,10,14,2,1,
+0,10,20,4,0,12,20,2,5,7,6,4,5,7,3,2,11,12,1,2,11,13,1,1,10,10,2,3,10,11,2,1,9,5,2,2,9,6,2,1,
+4,4,1,10,4,9,1,5,11,18,4,2,11,18,2,2,12,18,3,2,12,19,3,1,0,6,16,6,0,6,8,3,7,6,4,12,7,12,4,6,
+11,18,4,2,11,18,2,2,12,18,3,2,12,19,3,1,8,12,1,2,8,13,1,1,8,13,1,3,8,14,1,1,11,18,4,2,11,18,2,2,
+14,12,4,6,14,12,2,6,6,0,3,4,7,0,1,4,4,0,2,8,4,0,1,4,11,17,9,3,14,17,3,3,16,2,4,5,16,2,2,5,
+0,2,5,9,0,5,5,3,7,2,3,2,8,2,1,2,11,17,9,3,14,17,3,3,16,2,4,5,16,2,2,5,0,17,9,3,3,17,3,3,
+0,2,4,5,2,2,2,5,5,11,10,9,5,14,10,3,9,6,3,3,9,7,3,1,3,17,5,3,3,18,5,1,7,5,4,7,9,5,2,7,
+9,8,2,5,9,8,1,5,2,2,18,2,2,3,18,1,2,8,15,6,7,8,5,6,9,8,2,5,10,8,1,5,12,10,4,6,12,12,4,2,
+14,3,6,2,14,4,6,1,5,5,2,3,5,6,2,1,4,6,3,3,4,7,3,1,14,12,3,3,14,13,3,1,6,12,11,3,6,13,11,1,
+1,2,3,6,1,4,3,2,1,0,4,7,3,0,2,7,9,8,3,4,10,8,1,4,10,9,2,2,10,10,2,1,8,8,3,4,9,8,1,4,
+4,4,10,10,4,9,10,5,9,10,3,2,10,10,1,2,9,10,3,2,9,11,3,1,8,10,3,2,9,10,1,2,2,4,14,12,2,4,7,6,
+10,12,1,6,10,15,1,3,7,3,8,16,11,3,4,8,5,6,8,10,5,6,4,5,6,2,8,8,6,2,4,4,10,5,4,2,12,5,2,1,
+12,4,3,3,12,5,3,1,4,19,12,1,8,19,4,1,8,2,3,1,9,2,1,1,13,17,4,3,13,18,4,1,7,14,6,3,7,15,6,1,
+9,14,2,3,9,15,2,1,7,15,6,3,7,16,6,1,10,18,3,2,11,18,1,2,14,12,2,3,14,13,2,1,4,10,4,6,4,12,4,2,
+4,13,3,2,4,14,3,1,9,16,2,3,9,17,2,1,10,18,3,2,11,18,1,2,7,18,3,2,8,18,1,2,1,10,4,2,1,11,4,1,
+12,4,6,3,12,5,6,1,14,4,1,3,14,5,1,1,2,4,6,3,2,5,6,1,5,4,1,3,5,5,1,1,14,12,3,3,14,13,3,1,
+15,12,2,3,15,13,2,1,3,16,4,3,3,17,4,1,8,0,4,2,8,1,4,1,0,0,20,1,0,0,10,1,9,7,3,4,10,7,1,4,
+0,0,20,1,10,0,10,1,8,7,3,4,9,7,1,4,1,6,19,3,1,7,19,1,12,7,4,2,12,8,4,1,7,8,3,3,7,9,3,1,
+7,7,3,3,8,7,1,3,2,9,16,3,2,10,16,1,9,4,2,12,9,8,2,4,7,3,2,5,8,3,1,5,9,7,2,3,9,8,2,1,
+9,14,4,3,9,15,4,1,7,8,6,4,10,8,3,2,9,7,2,2,10,7,1,2,5,5,6,6,7,5,2,6,9,1,3,6,10,1,1,6,
+4,5,12,2,8,5,4,2,4,2,6,4,6,2,2,4,4,7,8,2,4,8,8,1,3,6,14,6,10,6,7,3,3,6,14,3,3,6,7,3,
+0,5,2,2,0,6,2,1,8,13,4,3,8,14,4,1,13,0,3,20,14,0,1,20,10,8,10,3,10,9,10,1,4,0,3,20,5,0,1,20,
+0,8,10,3,0,9,10,1,12,5,3,4,13,5,1,4,6,7,12,4,10,7,4,4,1,14,6,6,1,14,3,3,1,17,6,2,1,18,6,1,
+14,8,6,12,17,8,3,6,18,5,2,2,18,6,2,1,3,16,4,2,3,16,2,1,2,16,6,2,4,16,2,2,14,8,6,12,17,8,3,6,
+18,5,2,2,18,6,2,1,5,16,9,2,8,16,3,2,3,14,6,6,3,14,3,3,14,8,6,12,17,8,3,6,11,7,2,12,11,11,2,4,
+0,8,6,12,0,8,3,6,7,7,2,12,7,11,2,4,14,12,1,2,14,13,1,1,12,13,8,1,12,13,4,1,0,3,16,6,0,6,16,3,
+1,4,8,2,1,4,4,1,14,12,1,2,14,13,1,1,15,12,2,3,15,13,2,1,8,16,3,3,8,17,3,1,5,12,1,2,5,13,1,1,
+13,4,3,15,14,4,1,15,17,3,2,6,18,3,1,3,4,4,3,15,5,4,1,15,1,3,2,6,1,3,1,3,7,15,12,4,7,17,12,2,
+1,0,19,3,1,1,19,1,3,17,10,2,3,17,5,1,2,5,10,15,2,10,10,5,13,8,3,4,13,10,3,2,19,13,1,2,19,14,1,1,
+4,8,3,4,4,10,3,2,0,13,1,2,0,14,1,1,12,7,2,12,12,13,2,6,14,7,2,2,15,7,1,1,5,3,8,2,5,4,8,1,
+0,2,2,6,0,4,2,2,18,2,2,12,19,2,1,6,18,1,1,2,18,2,1,1,0,2,2,12,0,2,1,6,1,1,1,2,1,2,1,1,
+16,4,4,14,18,4,2,7,10,14,1,6,10,17,1,3,0,4,4,14,0,4,2,7,9,14,1,6,9,17,1,3,9,14,4,3,9,15,4,1,
+4,7,12,2,8,7,4,2,0,8,4,3,0,9,4,1,4,7,2,2,4,7,1,1,13,7,2,1,13,7,1,1,11,4,4,5,11,4,2,5,
+4,8,3,3,5,8,1,3,0,3,8,1,4,3,4,1,13,7,2,1,13,7,1,1,14,7,3,2,15,7,1,2,5,7,2,1,6,7,1,1,
+3,7,3,2,4,7,1,2,18,5,2,2,18,6,2,1,12,14,2,2,13,14,1,1,0,5,2,2,0,6,2,1,6,14,2,2,6,14,1,1,
+7,12,6,5,9,12,2,5,12,17,5,2,12,18,5,1,1,11,6,3,4,11,3,3,1,9,6,3,4,9,3,3,12,7,2,12,12,13,2,6,
+8,7,5,3,8,8,5,1,6,7,2,12,6,13,2,6,1,2,9,18,4,2,3,18,12,17,5,2,12,18,5,1,4,7,12,2,4,7,6,2,
+6,7,6,1,8,7,2,1,7,3,3,2,8,3,1,2,9,4,3,1,10,4,1,1,11,11,3,1,12,11,1,1,8,4,3,1,9,4,1,1,
+6,11,3,1,7,11,1,1,12,13,6,6,12,15,6,2,14,13,1,6,14,15,1,2,2,13,6,6,2,15,6,2,1,5,18,1,7,5,6,1,
+4,7,12,2,10,7,6,1,6,1,8,10,10,1,4,5,3,13,4,3,3,14,4,1,6,13,4,3,6,14,4,1,9,14,4,3,9,15,4,1,
+12,9,2,3,12,10,2,1,7,14,4,3,7,15,4,1,9,0,2,1,10,0,1,1,5,0,10,5,5,0,5,5,6,6,8,7,6,6,4,7,
+5,0,10,5,10,0,5,5,6,6,8,7,10,6,4,7,5,9,10,8,10,9,5,4,10,0,4,10,12,0,2,5,1,4,8,3,1,5,8,1,
+4,4,8,3,4,5,8,1,9,7,4,3,9,8,4,1,12,8,3,12,12,14,3,6,7,7,4,3,7,8,4,1,5,8,3,12,5,14,3,6,
+10,0,7,6,10,2,7,2,2,1,18,1,8,1,6,1,5,0,3,8,6,0,1,8,4,7,4,2,4,8,4,1 
+};
+
+constexpr float soa_weight0[] = 
+{
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1 
+};
+
+constexpr float soa_weight1[] = 
+{
+2,2,2,3,3,3,2,2,3,2,
+3,2,3,3,2,2,2,3,2,3,
+3,2,3,2,2,3,3,3,3,3,
+2,2,3,3,3,3,2,2,2,3,
+2,2,2,2,3,2,3,3,3,3,
+2,2,2,3,2,2,3,3,2,2,
+2,2,2,2,2,2,3,3,2,3,
+2,3,3,3,3,3,3,3,3,3,
+3,2,2,2,3,3,2,2,2,2,
+3,2,3,2,3,2,3,3,3,3,
+2,3,2,2,3,3,3,3,3,3,
+3,2,3,3,3,3,3,2,2,2,
+3,2,2,2,2,2,3,2,3,2,
+2,2,2,3,2,2,3,2,2,2,
+2,2,2,2,2,3,2,3,3,3,
+2,2,3,3,3,2,2,3,3,3,
+2,3,2,3,2,3,3,2,3,3,
+3,2,2,2,2,3,2,3,2,2,
+2,2,3,3,2,2,2,2,3,2,
+2,2,3,3,3,3,3,3,2,2,
+3,2,3,3,2,3,2,2,3,3,
+3,3,3,2,3,2,2,2,2,3,
+2,2,2,3,3,3,3,2,2,2,
+3,3,2,2,2,3,2,2,3,2,
+3,2,3,2,3,2,2,2,2,2,
+2,2,2,2,2,3,2,2,3,2,
+3,2,3,2,3,2,2,2,2,3,
+3,3,3,3,3,3,3,3,2,2,
+3,2,2,3,3,3,2,2,2,2,
+2,2,3,3,3,2,3,3,3,3,
+2,2,3,3,2,3,3,3,2,3,
+3,2,3,2,3,2,3,2,2,3,
+3,2,2,2,2,2,2,3,2,2,
+2,2,2,2,3,2,3,2,2,3,
+2,2,3,2,2,2,3,2,2,3,
+2,2,3,3,2,3,2,2,2,2,
+2,2,2,2,3,3,2,3,2,3,
+2,3,3,2,3,2,3,3,2,3,
+3,3,3,2,3,3,3,3,2,3,
+3,3,2,2,3,3,2,2,2,2,
+2,3,2,2,3,3,2,3,3,3,
+3,3,3,3,3,2,2,2,3,2,
+2,2,2,2,2,3,3,3,2,3,
+3,2,3,2,2,3,3,2,2,2,
+2,3,3,2,3,2,3,2,2,3,
+3,2,3,3,3,2,2,2,2,3,
+3,3,3,3,3,2,2,3,2,3,
+2,3,2,3,3,3,3,3,3,2,
+3,3,2,2,2,2,2,3,2,3,
+2,3,2,3,2,2,3,2,3,3,
+2,3,2,2,3,3,2,2,2,2,
+2,2,2,2,2,2,2,3,3,2,
+2,2,2,2,2,2,2,2,2,2,
+2,2,3,2,3,3,2,3,3,2,
+3,2,2,3,3,2,3,2,2,2,
+2,2,2,3,2,3,2,2,3,3,
+2,3,2,3,3,2,2,3,3,2,
+3,3,2,2,2,2,3,3,3,3,
+3,3,3,2,3,3,3,2,2,2,
+3,2,3,2,3,2,3,3,2,2,
+2,2,3,3,3,3,3,3,2,3,
+2,3,2,3,3,3,2,3,3,2,
+2,2,2,3,2,2,3,2,3,3,
+3,2,3,2,3,2,2,2,3,3,
+2,2,2,3,2,2,2,3,2,2,
+3,3,3,3,2,3,2,3,3,3,
+3,2,2,2,2,2,3,3,3,3,
+2,3,3,2,3,3,3,2,3,3,
+3,3,3,2,3,2,2,2,2,2,
+3,3,3,2,2,3,2,2,2,2,
+2,3,3,2,2,3,2,2,2,2,
+3,3,2,3,3,2,3,2,2,2,
+3,2,3,3,3,3,2,3,2,2,
+3,2,2,2,2,2,3,2,2,2,
+2,2,2,2,3,2,3,3,2,2,
+3,3,2,2,3,2,2,3,2,2,
+3,2,3,2,3,2,3,2,3,3,
+3,2,2,2,3,3,2,3,2,2,
+2,3,2,3,3,2,2,2,3,3,
+2,2,3,3,2,3,3,2,3,2,
+2,3,2,3,2,3,3,2,3,3,
+2,3,3,3,3,3,2,3,2,3,
+3,2,3,3,3,3,3,3,3,2,
+2,3,2,2,2,2,3,2,3,2,
+2,2,2,3,2,3,2,3,3,2,
+3,2,3,2,2,2,2,3,2,3,
+3,3,2,3,2,3,3,3,3,2,
+2,3,2,2,3,2,2,2,3,3,
+3,3,2,2,2,2,2,2,2,3,
+3,3,3,2,3,3,2,2,3,3,
+2,3,2,2,2,2,3,3,2,2,
+3,3,2,3,2,3,3,3,3,2,
+3,3,3,2,2,2,2,3,2,3,
+3,3,3,2,2,3,2,3,3,2,
+3,3,3,3,3,3,2,2,3,2,
+3,3,2,2,2,3,2,3,3,2,
+3,3,2,2,3,2,2,2,3,3,
+3,3,3,2,3,3,3,3,3,2,
+3,2,2,3,2,3,3,3,3,3,
+3,2,3,3,2,2,2,3,2,2,
+2,2,2,2,2,2,2,2,2,2,
+2,2,2,3,2,3,3,2,3,3,
+2,3,2,3,2,3,2,2,2,2,
+2,3,2,3,2,3,3,3,3,2,
+3,2,3,2,2,2,2,2,2,2,
+2,2,2,2,3,2,3,3,3,3,
+3,2,2,2,2,2,2,3,3,2,
+3,2,2,2,3,2,2,3,2,2,
+3,2,3,3,2,2,3,2,3,2,
+3,3,2,2,2,3,2,2,2,2,
+2,3,2,3,3,2,2,2,2,3,
+2,2,3,2,3,2,3,3,2,3,
+2,3,3,3,2,3,2,3,3,2,
+3,2,2,2,2,3,3,3,2,2,
+3,3,3,3,3,3,3,3,2,2,
+2,2,2,2,2,2,2,2,2,3,
+2,2,3,3,3,2,2,2,2,2,
+2,2,3,3,2,2,3,3,3,3,
+3,3,3,3,2,2,2,2,3,2,
+2,2,2,2,2,2,2,2,3,3,
+2,2,2,3,2,3,2,2,3,2,
+3,3,3,3,3,2,3,2,3,2,
+3,3,2,3,2,2,3,3,2,3,
+2,2,2,2,3,3,3,2,2,2,
+2,2,2,3,3,2,2,3,2,3,
+3,2,2,2,2,2,3,3,2,3,
+2,2,3,3,3,2,2,2,2,3,
+3,3,2,2,3,3,3,3,3,2,
+2,3,2,2,2,3,2,3,3,2,
+3,2,3,2,2,3,3,2,3,3,
+3,3,3,3,2,3,2,3,2,2,
+3,3,3,3,3,3,2,2,3,2,
+2,2,3,3,2,3,2,2,3,3,
+3,2,2,2,2,2,3,2,2,2,
+2,2,3,3,3,3,3,3,2,3,
+3,2,3,2,3,3,2,2,2,2,
+2,3,3,2,3,2,2,3,2,3,
+2,3,2,3,3,3,2,3,3,2,
+3,3,2,2,2,3,2,3,3,3,
+2,2,2,3,2,3,2,2,2,3,
+2,2,2,2,2,2,3,2,3,2,
+2,2,3,3,2,2,2,2,2,2,
+2,3,3,3,3,2,2,3,3,2,
+3,3,2,3,2,2,2,3,2,2,
+2,3,2,2,2,2,2,3,2,2,
+3,3,2,2,3,2,3,2,2,3,
+2,2,3,2,3,2,2,3,2,3,
+2,3,2,2,3,2,3,2,2,3,
+3,2,2,2,2,3,2,3,2,3,
+3,2,3,3,2,2,2,2,3,3,
+2,2,3,2,2,3,2,2,3,2,
+2,2,3,2,2,3,3,3,3,3,
+3,2,3,2,3,3,3,2,2,2,
+2,2,2,3,2,3,3,2,2,3,
+3,2,2,2,3,3,3,3,2,2,
+3,3,3,3,3,3,2,2,3,2,
+2,3,2,3,3,3,3,2,3,3,
+2,3,2,2,2,2,2,2,2,2,
+2,2,2,2,3,2,2,2,2,2,
+2,3,2,3,2,3,3,2,3,3,
+3,2,3,2,3,2,2,2,2,2,
+3,3,3,3,2,3,3,3,3,3,
+2,3,2,3,3,2,3,2,3,2,
+2,3,2,2,2,2,3,3,3,2,
+3,2,3,3,2,3,3,2,2,3,
+2,3,2,2,2,2,3,2,2,3,
+3,3,2,3,2,2,3,3,2,2,
+2,3,2,2,2,3,2,2,2,2,
+2,3,2,3,2,2,2,2,3,3,
+3,2,3,3,3,3,3,2,2,2,
+2,3,3,2,2,2,3,3,3,3,
+2,3,2,2,2,2,3,2,3,3,
+3,2,2,3,2,3,2,2,3,3,
+3,2,3,3,3,2,3,2,2,3,
+2,3,3,3,3,3,2,2,2,3,
+3,3,2,3,3,2,2,3,2,2,
+2,2,3,2,2,2,2,2,3,2,
+3,2,2,2,2,3,3,3,2,2,
+3,3,2,3,3,3,3,3,2,2,
+2,3,2,3,3,3,3,3,3,2,
+2,3,3,2,2,2,2,2,3,2,
+2,3,2,2,2,3,2,2,2,3,
+3,2,2,2,3,3,3,3,3,3,
+2,2,2,2,2,2,2,2,3,2,
+2,2,2,2,2,3,3,3,2,2,
+3,3,2,2,3,2,3,2,2,3,
+2,3,3,3,3,2,2,3,3,3,
+2,2,3,2,3,3,2,3,3,3,
+2,2,2,3,2,2,2,2,2,2,
+2,2,2,3,2,2,3,2,3,2,
+3,3,3,2,3,2,3,3,3,2,
+2,2,3,2,3,2,3,3,3,3,
+3,2,3,2,3,2,3,2,3,2,
+2,2,2,2,2,3,3,3,3,3,
+3,3,3,3,3,2,3,3,3,2,
+3,3,3,3,3,3,3,2,2,3,
+2,3,3,2,3,3,3,3,2,3,
+3,2,2,3,3,3,3,2,2,2,
+2,3,3,3,3,3,3,3,2,2,
+2,2,2,3,2,2,3,2,2,3,
+2,3,2,2,2,2,2,3,3,2,
+3,2,3,2,2,3,2,3,2,2,
+2,2,2,2,2,3,2,2,2,2,
+2,2,2,2,3,3,3,2,2,2,
+3,2,2,3,2,3,2,2,2,2,
+3,2,2,2,2,3,2,3,2,2,
+3,3,3,3,3,3,3,3,3,3,
+2,2,3,3,3,3,3,2,2,2,
+2,2,2,2,3,3,3,2,3,2,
+3,3,3,2 
+};
+
+constexpr short soa_third[] = 
+{
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+0,-1,-1,-1,-1,-1,1,-1,2,-1,3,-1,4,5,-1,6,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+7,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,8,-1,-1,-1,-1,9,-1,10,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,11,-1,-1,-1,-1,-1,-1,-1,-1,12,-1,-1,-1,-1,-1,13,-1,-1,
+-1,-1,-1,-1,-1,14,-1,-1,-1,15,-1,-1,-1,-1,-1,-1,-1,16,-1,17,-1,-1,18,-1,19,-1,-1,-1,-1,-1,
+20,-1,-1,-1,-1,21,-1,-1,-1,-1,-1,-1,22,-1,23,-1,-1,-1,-1,-1,-1,-1,24,25,-1,-1,-1,-1,26,-1,
+-1,-1,-1,-1,-1,27,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,28,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,29,-1,30,-1,31,32,-1,-1,-1,-1,-1,-1,-1,33,-1,-1,34,-1,35,-1,-1,36,-1,-1,
+-1,-1,-1,-1,-1,37,-1,-1,-1,-1,-1,-1,38,-1,39,-1,-1,-1,-1,40,-1,41,-1,-1,-1,-1,42,-1,43,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,44,-1,-1,45,-1,-1,-1,-1,-1,-1,46,-1,47,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,48,-1,-1,-1,-1,
+-1,49,-1,-1,-1,50,-1,-1,-1,-1,51,52,-1,-1,-1,-1,-1,53,-1,-1,54,-1,-1,-1,55,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,56,57,-1,-1,-1,-1,-1,-1,58,-1,-1,-1,-1,-1,59,-1,-1,-1,-1,-1,-1,-1,-1,60,61,-1,-1,-1,
+62,-1,-1,-1,63,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,64,-1,65,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,66,-1,-1,-1,67,-1,-1,-1,-1,-1,-1,-1,-1,-1,68,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,69,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,70,-1,-1,
+-1,-1,71,-1,-1,-1,72,-1,-1,-1,-1,-1,-1,-1,73,-1,74,75,76,77,78,79,-1,80,-1,-1,81,-1,-1,82,
+-1,83,84,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,85,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,86,-1,87,-1,-1,-1,-1,-1,88,-1,-1,89,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,90,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,91,-1,92,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,93,-1,-1,94,95,-1,-1,-1,-1,96,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,97,-1,-1,
+-1,-1,-1,-1,-1,-1,98,-1,-1,-1,99,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,100,-1,-1,101,-1,102,-1,-1,
+-1,-1,-1,-1,-1,-1,103,-1,-1,-1,-1,104,-1,-1,105,-1,-1,106,-1,107,-1,108,109,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,110,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,111,-1,-1,-1,-1,112,-1,113,-1,
+114,-1,115,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,116,-1,-1,117,-1,-1,
+118,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,119,-1,-1,-1,-1,-1,-1,-1,-1,120,-1,121,122,123,-1,-1,124,-1,125,
+-1,126,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,127,-1,-1,-1,-1,-1,-1,128,-1,129,-1,-1,-1,-1,-1,
+-1,-1,-1,130,-1,-1,-1,-1,-1,-1,-1,-1,-1,131,132,-1,-1,-1,-1,-1,-1,-1,-1,133,-1,-1,134,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,135,136,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,137,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,138,-1,139,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,140,-1,-1,-1,-1,-1,-1,141,
+-1,-1,142,143,-1,144,145,-1,-1,-1,-1,-1,-1,146,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,147,-1,-1,-1,-1,-1,148,149,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+150,-1,-1,-1,-1,-1,-1,-1,-1,151,152,-1,-1,-1,153,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,154,-1,155,-1,156,
+-1,157,-1,-1,-1,-1,-1,-1,-1,-1,-1,158,159,-1,-1,-1,-1,-1,-1,160,-1,161,-1,-1,-1,-1,-1,-1,162,163,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,164,-1,165,166,-1,-1,167,-1,-1,-1,-1,168,169,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,170,-1,-1,-1,-1,-1,171,-1,172,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,173,174,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,175,176,-1,
+-1,-1,-1,-1,177,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,178,-1,-1,-1,-1,
+-1,179,180,-1,181,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,182,-1,-1,-1,-1,183,-1,-1,-1,-1,-1,184,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,185,186,187,-1,-1,-1,188,189,-1,190,-1,-1,191,-1,-1,-1,-1,-1,-1,192,-1,
+-1,-1,-1,-1,-1,193,-1,-1,-1,-1,-1,-1,-1,194,-1,-1,-1,-1,-1,195,196,-1,197,198,199,-1,200,-1,-1,-1,
+-1,-1,-1,-1,201,-1,-1,-1,-1,-1,-1,-1,-1,-1,202,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,203,204,-1,205,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,206,-1,-1,-1,-1,207,-1,208,-1,209,-1,-1,-1,-1,-1,-1,210,-1,
+-1,-1,-1,-1,-1,-1,211,-1,212,-1,213,-1,-1,214,-1,215,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,216,-1,-1,217,-1,218,-1,219,-1,220,-1,-1,221,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,222,223,224,225,226,227,-1,-1,-1,-1,-1,228,229,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,230,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,231,-1,-1,-1,-1,-1,-1,-1,232,-1,-1,-1,-1,233,-1,234,-1,
+-1,-1,-1,235,-1,236,-1,-1,237,-1,-1,-1,-1,238,-1,-1,239,-1,240,-1,-1,-1,-1,-1,-1,241,-1,242,-1,-1,
+243,-1,-1,244,-1,-1,-1,-1,-1,245,-1,-1,-1,246,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,247,248,-1,
+249,-1,-1,-1,-1,-1,-1,-1,250,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,251,-1,252,
+253,-1,254,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,255,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,256,-1,-1,
+257,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,258,-1,-1,-1,-1,259,-1,-1,-1,260,-1,-1,-1,-1,261,-1,-1,-1,262,-1,
+263,-1,-1,-1,-1,264,-1,-1,265,-1,-1,-1,-1,-1,-1,-1,-1,-1,266,267,-1,-1,-1,268,-1,-1,269,-1,-1,270,
+-1,-1,271,-1,-1,-1,272,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,273,-1,-1,-1,274,-1,-1,-1,-1,-1,-1,
+-1,-1,275,-1,-1,-1,-1,-1,-1,-1,-1,276,277,-1,278,-1,-1,279,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,280,281,-1,-1,-1,-1,-1,-1,-1,282,283,-1,-1,-1,-1,-1,-1,284,285,-1,-1,-1,-1,-1,
+-1,-1,286,287,-1,-1,-1,-1,288,289,-1,-1,290,-1,-1,-1,-1,-1,291,-1,-1,-1,292,-1,-1,-1,-1,-1,-1,293,
+294,-1,-1,-1,-1,-1,295,-1,-1,296,297,-1,298,-1,299,-1,300,-1,301,-1,-1,-1,302,303,-1,-1,-1,-1,-1,-1,
+304,-1,305,-1,-1,306,-1,307,-1,-1,308,-1,309,-1,-1,-1,-1,-1,310,-1,-1,-1,311,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,312,-1,-1,313,-1,-1,-1,-1,-1,-1,-1,314,-1,-1,-1,-1,-1,-1,315,-1,
+-1,-1,-1,-1,-1,-1,-1,316,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,317,-1,318,319,320,321,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,322,-1,-1,-1,-1,-1,-1,323,-1,
+-1,-1,-1,-1,-1,-1,-1,-1,324,-1,325,-1,326,-1,327,-1,-1,328,329,-1,330,-1,-1,-1,-1,331,-1,-1,-1,-1,
+-1,332,-1,333,-1,-1,334,-1,-1,-1,-1,-1,-1,335,-1,-1,336,-1,337,-1,338,-1,339,-1,-1,-1,-1,340,-1,-1,
+-1,-1,-1,-1,-1,-1,-1,341,-1,342,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+343,344,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,345,346,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1 
+};
+
+constexpr uchar soa_rect2[] = 
+{
+12,6,2,6,5,6,3,4,10,17,3,2,7,17,2,2,4,10,6,5,7,10,4,6,9,9,6,6,7,16,5,4,9,9,9,4,10,10,3,7,
+7,10,3,7,6,7,3,5,10,3,8,1,13,9,3,2,12,6,3,5,5,6,4,4,8,16,5,3,5,12,5,5,13,9,3,2,10,10,10,6,
+3,16,7,2,10,9,5,2,2,3,9,2,9,3,9,2,4,9,4,1,10,13,5,4,12,7,2,7,8,9,4,8,10,5,5,4,3,2,8,1,
+9,2,8,1,4,10,6,5,7,16,3,3,4,10,6,6,4,15,6,2,10,9,7,6,8,17,2,3,5,6,4,3,7,16,3,4,10,9,5,2,
+12,9,3,2,10,9,9,3,8,10,4,4,10,10,6,5,1,13,9,2,9,13,9,2,10,13,4,4,2,9,9,4,11,13,3,7,6,13,3,7,
+9,13,8,6,8,16,2,4,7,10,5,6,5,9,4,2,10,16,7,2,10,16,3,3,6,6,4,5,0,5,10,5,2,9,9,3,9,9,9,3,
+13,9,3,2,5,6,2,5,8,18,3,2,10,5,9,3,13,9,3,2,4,9,3,2,8,6,6,1,6,6,4,6,7,16,6,1,13,4,3,4,
+8,10,3,5,7,17,6,2,11,7,3,6,11,7,3,6,9,13,6,3,6,7,3,6,16,13,2,7,5,5,5,4,2,13,2,7,7,17,6,2,
+11,5,1,3,10,16,2,1,8,5,1,3,10,16,2,1,8,16,2,1,11,7,1,1,10,15,6,2,13,8,1,4,9,11,4,6,10,11,5,6,
+10,10,7,6,0,9,10,7,10,10,10,6,10,9,6,2,4,5,3,5,3,5,2,5,12,9,4,1,6,5,4,5,10,12,5,3,10,16,2,4,
+10,3,9,1,14,10,3,9,3,10,3,9,11,11,1,1,12,8,1,1,12,8,1,1,7,8,1,1,10,8,2,5,8,11,1,1,3,14,7,2,
+14,5,1,4,10,17,1,3,8,16,2,3,10,14,7,2,8,16,2,3,10,16,2,3,0,11,10,1,10,16,2,1,10,9,10,5,5,9,7,4,
+10,5,10,3,2,12,8,2,3,13,8,3,9,13,8,3,3,18,7,2,4,17,3,3,6,12,4,5,9,16,2,1,3,14,2,5,9,2,2,1,
+9,5,1,3,11,7,3,5,10,13,5,6,8,9,8,3,6,7,3,5,10,15,7,2,10,17,2,3,10,3,7,1,11,7,1,1,8,7,1,1,
+4,17,3,3,6,13,4,6,3,18,7,2,1,16,9,2,10,10,10,6,5,11,5,6,1,10,1,6,5,10,6,5,8,14,1,1,8,13,1,1,
+9,18,3,1,6,11,5,6,5,6,1,6,10,11,9,1,6,10,5,7,10,6,4,3,6,10,5,7,9,10,5,7,15,12,1,6,10,9,9,5,
+16,3,2,3,2,3,2,3,9,3,8,2,9,3,2,1,0,3,10,1,10,3,10,1,4,6,1,5,10,13,8,2,4,9,3,2,12,4,4,4,
+3,11,2,8,4,13,6,3,10,13,6,3,10,13,7,4,10,13,4,5,6,6,7,2,8,18,3,2,8,10,4,4,3,3,7,1,10,3,1,3,
+9,3,1,3,10,3,1,3,8,15,3,5,0,2,10,1,10,4,8,2,3,2,8,1,4,7,1,1,10,14,5,3,10,14,8,3,12,5,4,5,
+4,5,4,5,12,7,2,4,6,9,6,7,6,5,1,5,9,8,1,4,9,13,1,1,10,15,1,2,5,10,6,5,6,9,6,6,6,8,1,1,
+6,9,6,7,10,19,3,1,8,9,6,7,4,14,4,6,5,10,4,3,15,2,2,2,9,3,9,1,9,13,7,2,9,14,5,6,6,14,5,6,
+10,6,4,6,10,10,10,5,7,11,4,5,9,11,4,5,10,6,1,3,7,18,4,2,11,13,1,1,3,13,8,2,9,13,8,2,12,7,1,1,
+7,7,1,1,9,18,3,1,11,16,1,1,11,15,1,1,8,16,1,1,8,15,1,1,8,16,2,3,2,16,8,2,9,7,1,2,9,16,1,3,
+2,4,8,4,9,3,7,2,5,18,4,2,18,11,1,9,1,11,1,9,9,15,2,3,12,15,1,1,2,12,8,2,12,3,4,3,11,12,1,1,
+8,12,1,1,11,10,2,7,7,10,2,7,8,5,6,3,8,9,3,2,9,18,3,1,9,6,2,3,9,11,4,7,0,5,10,4,10,5,10,4,
+10,11,6,5,18,10,1,8,10,3,3,1,12,5,4,1,4,5,4,1,8,9,8,1,10,15,2,4,8,7,3,1,9,13,1,1,9,12,1,1,
+10,6,4,1,8,10,2,1,11,12,1,1,4,5,3,5,9,9,6,5,8,12,1,1,15,17,2,3,12,15,3,4,12,12,3,1,12,12,3,1,
+10,5,1,5,9,14,1,1,7,15,1,1,9,9,3,2,13,5,2,5,10,14,7,2,5,10,2,1,0,13,10,2,10,13,10,2,2,2,9,1,
+8,16,2,4,2,18,9,1,8,18,6,2,9,1,9,1,14,3,1,3,8,12,1,1,6,16,1,2,10,10,2,1,8,16,2,4,2,18,8,1,
+9,17,5,3,10,18,1,2,7,8,1,1,7,11,3,2,5,8,1,1,14,9,3,2,6,18,1,2,15,12,1,6,10,11,6,6,11,6,1,1,
+8,6,1,2,12,7,2,3,15,7,1,1,14,9,2,2,15,7,1,1,5,8,5,1,12,19,1,1,1,12,1,8,6,17,2,3,0,4,10,2,
+4,7,1,1,4,9,2,2,5,5,5,3,10,16,1,3,8,9,3,2,8,9,8,3,5,4,1,4,9,10,7,6,7,11,4,8,9,11,4,5,
+10,6,4,4,10,6,2,1,7,10,3,2,3,9,7,3,4,17,3,3,14,14,3,6,5,17,2,1,14,14,3,6,6,17,3,3,14,14,3,6,
+3,14,3,6,5,5,4,1,17,6,1,3,2,6,1,3,8,18,5,1,14,8,1,1,18,8,1,6,1,8,1,6,16,11,2,7,2,11,2,7,
+5,8,1,1,12,15,1,1,7,15,1,1,4,8,6,1,6,6,4,5,5,13,5,4,10,5,2,5 
+};
+
+constexpr float soa_weight2[] = 
+{
+2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2 
+};
+
+constexpr float soa_node_threshold[] = 
+{
+4.3272329494357109e-03,1.3076160103082657e-02,5.2434601821005344e-04,4.4573000632226467e-03,
+-9.2708261217921972e-04,3.3989109215326607e-04,2.3025739938020706e-03,4.4174338690936565e-03,
+2.2203210741281509e-02,-1.7283110355492681e-04,4.3567270040512085e-03,-2.6032889727503061e-03,
+1.7309630056843162e-03,-7.8146401792764664e-03,-8.7343417108058929e-03,9.4522320432588458e-04,
+4.9414858222007751e-02,4.4891750440001488e-03,6.0313619673252106e-02,-1.0762850288301706e-03,
+-9.5083238556981087e-03,7.6601309701800346e-03,7.6467678882181644e-03,-8.4662932204082608e-04,
+-4.8506218008697033e-03,-4.6141650527715683e-03,-2.4301309604197741e-03,4.1787960799410939e-04,
+1.0010929545387626e-03,1.0577100329101086e-03,1.2376549420878291e-03,3.5315038985572755e-04,
+-1.1953660286962986e-02,1.4182999730110168e-03,3.4642980899661779e-03,-1.4948950149118900e-02,
+-1.0506849503144622e-03,-4.0782918222248554e-03,5.4242828628048301e-04,-7.3204059153795242e-03,
+1.1421289527788758e-03,1.1783400550484657e-03,4.4077109545469284e-02,3.7900090683251619e-03,
+-2.4291418958455324e-03,9.4262324273586273e-03,8.0630257725715637e-03,5.2240812219679356e-03,
+-7.0630568079650402e-03,5.6897541508078575e-03,1.2472929665818810e-03,4.9543488770723343e-02,
+-4.9326149746775627e-03,2.7918140403926373e-05,3.0876200180500746e-03,7.4669660534709692e-06,
+1.8739729421213269e-03,9.3380251200869679e-04,1.9151850137859583e-03,-5.9683797881007195e-03,
+-7.2115601506084204e-04,-5.9663117863237858e-03,3.0874179676175117e-02,-1.1099710129201412e-02,
+2.1164179779589176e-03,-9.4317439943552017e-03,-3.5266019403934479e-03,-1.6907559474930167e-03,
+4.6470930101349950e-04,-1.0215570218861103e-02,1.2634709710255265e-03,-1.1875299736857414e-02,
+-1.0732339695096016e-02,7.1836481802165508e-03,-2.8340889140963554e-02,-4.5813230099156499e-04,
+4.2940340936183929e-03,1.0751079767942429e-02,2.2465119138360023e-02,-5.7988539338111877e-02,
+7.2110891342163086e-03,-4.8367571085691452e-02,-1.4418059960007668e-02,-2.3156389594078064e-02,
+7.6985340565443039e-03,-5.6248619221150875e-03,-7.2936748620122671e-04,6.1783898854628205e-04,
+-4.5803939428878948e-05,-1.4719359569426160e-05,-1.3469370314851403e-03,-2.4774789344519377e-03,
+5.2632777951657772e-03,4.9075339920818806e-03,-2.3254349362105131e-03,-1.4665479538962245e-03,
+-1.2311690300703049e-01,2.2108340635895729e-03,2.0661531016230583e-03,3.6130280932411551e-04,
+7.9957872629165649e-02,2.6064720004796982e-03,6.5699010156095028e-03,1.6259610420092940e-03,
+3.6204981151968241e-03,-4.4391951523721218e-03,-9.0540945529937744e-03,-4.6067481162026525e-04,
+-5.6621041148900986e-03,5.1165837794542313e-03,-2.1362339612096548e-03,-5.4809921421110630e-03,
+-8.1061907112598419e-03,6.0048708692193031e-03,-8.7028548121452332e-02,-4.7809639945626259e-03,
+-2.2166660055518150e-03,1.3642730191349983e-03,-9.0077864006161690e-03,-1.5494120307266712e-02,
+-4.2165028862655163e-03,4.3249759823083878e-02,2.8786511393263936e-04,1.2373150093480945e-03,
+1.9528300035744905e-03,-1.4947060262784362e-03,3.5878680646419525e-03,-2.5938691105693579e-03,
+3.5810680128633976e-03,-2.8552350122481585e-03,1.9758539274334908e-03,3.2583118882030249e-03,
+2.3711679386906326e-04,2.5942500215023756e-03,-2.5032449513673782e-02,6.3087949529290199e-03,
+-3.2494920305907726e-03,-1.4885730110108852e-02,8.0623216927051544e-03,2.7405679225921631e-02,
+3.4368600696325302e-02,-2.7292970567941666e-02,7.4452121043577790e-04,7.0336280623450875e-04,
+-1.2275460362434387e-01,3.2559928949922323e-03,-3.2090399414300919e-02,3.2957999501377344e-03,
+-3.2273170072585344e-03,1.1171669466421008e-03,-1.7279950901865959e-02,1.1741200461983681e-02,
+4.6405228786170483e-03,-1.6913030296564102e-02,1.0060169734060764e-02,-6.0715491417795420e-04,
+-1.0865400545299053e-03,8.9362077414989471e-03,-2.6372660067863762e-04,1.3110050000250340e-02,
+-2.9806280508637428e-03,-4.1619571857154369e-03,3.3842328935861588e-02,-1.2564560165628791e-03,
+-1.9635230302810669e-02,-9.9625496659427881e-04,-2.3127110674977303e-02,2.3525709286332130e-02,
+-1.9356520846486092e-02,-4.1787112131714821e-03,3.1488779932260513e-03,7.3972279205918312e-03,
+7.1955118983169086e-06,4.7114409506320953e-02,7.2878710925579071e-03,-6.1887511983513832e-03,
+2.9757320880889893e-03,-1.8449809867888689e-03,1.0239540279144421e-04,2.4277009069919586e-03,
+-6.4751312136650085e-02,3.9380151429213583e-04,1.4397440245375037e-03,-5.4068560712039471e-04,
+-7.1237959673453588e-06,-2.3661039303988218e-03,1.7343269428238273e-03,1.5874590026214719e-03,
+3.7285638973116875e-03,-1.2883819639682770e-01,7.9412180930376053e-03,-1.2661729939281940e-02,
+3.0146789868013002e-05,-1.6330160200595856e-02,1.4622770322603174e-05,-2.0858660340309143e-02,
+2.8194559272378683e-03,3.7899368908256292e-03,3.5344641655683517e-02,-1.1571600334718823e-03,
+-5.8742752298712730e-03,-1.5201780115603469e-05,-2.2681879636365920e-04,3.7845689803361893e-03,
+-8.5295992903411388e-05,-4.4394891709089279e-02,1.0126030538231134e-03,-7.6327780261635780e-03,
+4.0330411866307259e-03,1.3676689565181732e-01,-5.0060478970408440e-03,-1.2475839816033840e-02,
+-9.4012258341535926e-04,-1.2191980145871639e-02,-5.4959481349214911e-04,-2.1802430273965001e-04,
+6.9115799851715565e-03,-9.7631698008626699e-04,-8.7870173156261444e-03,-1.6761029837653041e-03,
+-5.5694948881864548e-02,-1.9844379276037216e-02,-7.4751611100509763e-04,2.3032890632748604e-02,
+-3.0700280331075191e-03,-1.1636839481070638e-03,2.2464339435100555e-01,1.4412109740078449e-03,
+-3.0011249706149101e-02,-5.3078960627317429e-02,2.0800929050892591e-03,-4.0738182142376900e-03,
+-1.9529370591044426e-02,-5.3309470415115356e-02,-3.4849561750888824e-02,-1.2658450007438660e-01,
+7.3325118137290701e-06,-1.1843870393931866e-02,-4.8470678739249706e-03,8.1693977117538452e-03,
+-6.4716790802776814e-03,-1.5188479665084742e-05,3.0696711037307978e-03,-1.6296720423270017e-04,
+-9.8275858908891678e-03,-4.1693858802318573e-03,3.5341319744475186e-04,4.8054549843072891e-03,
+2.1071180526632816e-04,-2.8318869881331921e-03,-7.5633679443853907e-06,-8.2888139877468348e-04,
+1.6209259629249573e-03,9.1338958591222763e-03,-4.1212290525436401e-03,-2.5447290390729904e-03,
+-6.2652782071381807e-04,-3.6596331483451650e-05,1.3882719911634922e-02,1.0493700392544270e-03,
+1.8215360119938850e-02,-1.1334580369293690e-02,-4.1097560897469521e-03,4.2612891411408782e-04,
+6.0301548801362514e-03,3.3587709185667336e-04,6.2279507983475924e-04,-2.5837119668722153e-02,
+2.1774910390377045e-02,1.7682299949228764e-03,-1.3793810270726681e-02,-5.0852829590439796e-03,
+6.1795017682015896e-03,1.0030319914221764e-02,-6.4201927743852139e-03,-5.6961281225085258e-03,
+-7.1498160250484943e-03,2.4450740311294794e-03,-3.7503410130739212e-02,4.7799441381357610e-04,
+-7.0806080475449562e-03,3.2818000763654709e-02,6.5188988810405135e-04,4.6485587954521179e-03,
+-1.9827929791063070e-03,-1.6011310508474708e-03,-3.0539939180016518e-03,4.3212040327489376e-04,
+-2.7452120557427406e-02,9.3099439982324839e-04,6.7144189961254597e-03,-3.3701690845191479e-03,
+-1.8903959542512894e-02,-6.5850871615111828e-03,5.8810501359403133e-03,8.0092082498595119e-04,
+1.8510579830035567e-03,6.3273650594055653e-03,-3.3820930402725935e-03,-1.9292969955131412e-03,
+1.4995220117270947e-02,-2.6330750435590744e-02,-4.1734222322702408e-03,2.7268350124359131e-02,
+9.8880263976752758e-04,-1.0528849670663476e-03,5.2288072183728218e-03,3.0395459383726120e-02,
+-7.9113930463790894e-02,1.8231669440865517e-02,5.2288072183728218e-03,4.3922828626818955e-04,
+-8.6501962505280972e-04,1.0326979681849480e-03,-7.2997747920453548e-03,-9.3629042385146022e-04,
+-6.0483231209218502e-03,6.7529221996665001e-03,5.3078029304742813e-02,-1.0225810110569000e-03,
+3.1270649284124374e-02,-6.3522169366478920e-03,-6.2215630896389484e-03,2.1097389981150627e-03,
+1.0845859535038471e-02,6.4230401767417789e-04,7.3311722371727228e-04,1.0134200565516949e-03,
+1.1093559674918652e-02,-7.9127531498670578e-03,1.2905309908092022e-02,-4.2430912144482136e-03,
+-2.1304309484548867e-04,-2.2308640182018280e-03,2.6400520000606775e-03,7.5101032853126526e-02,
+-7.7012968249619007e-03,1.5588370151817799e-03,-4.7687938786111772e-04,8.4234727546572685e-04,
+-1.2825109995901585e-02,-6.5156567143276334e-04,-1.2006159871816635e-02,1.3213419588282704e-03,
+-2.0307440310716629e-02,4.0180929936468601e-03,4.5315311290323734e-03,-4.4381739571690559e-03,
+1.5692010056227446e-03,-4.9516442231833935e-03,-2.7429679408669472e-02,1.4181969454512000e-03,
+-1.3078940100967884e-02,-3.5092779435217381e-03,1.8920730799436569e-02,2.1683350205421448e-03,
+1.6401590546593070e-03,1.4005920093040913e-04,-3.3137591090053320e-03,-2.9459029901772738e-03,
+1.3612229668069631e-04,6.0512032359838486e-04,-1.7513990402221680e-02,-1.8735030665993690e-02,
+1.2065649963915348e-02,-2.6544178836047649e-03,1.4501289697363973e-03,1.0954019613564014e-02,
+1.5771709382534027e-02,-1.4252689667046070e-02,3.0411860279855318e-05,2.3486299440264702e-02,
+5.2205449901521206e-03,-2.5812430307269096e-02,-1.9526650430634618e-03,-8.1470049917697906e-03,
+3.2962448894977570e-03,-1.3961310032755136e-03,-4.1055441834032536e-03,-1.0888779535889626e-02,
+-7.6768421567976475e-03,-9.7729787230491638e-03,6.0439710505306721e-03,-4.6134641161188483e-04,
+5.7992361485958099e-02,5.9384980704635382e-04,-6.2353480607271194e-03,-1.2784929946064949e-02,
+4.1973669431172311e-04,8.0646801507100463e-04,-1.6339010326191783e-03,-4.8299999907612801e-03,
+-6.3992068171501160e-03,1.0819199681282043e-01,6.5056560561060905e-04,2.0611250773072243e-02,
+-2.5129050016403198e-02,1.7922939732670784e-03,1.5626220265403390e-03,-6.1898730928078294e-04,
+4.8111421056091785e-03,2.2484229411929846e-03,-3.0147239565849304e-02,2.7548679709434509e-01,
+3.6894630175083876e-03,7.2957701049745083e-03,-5.6211069226264954e-02,-2.6478560175746679e-03,
+-1.4534000074490905e-03,2.8540920466184616e-03,5.8243022067472339e-04,9.2509482055902481e-04,
+1.9806440919637680e-02,7.0395611692219973e-04,2.5563780218362808e-03,1.0824160417541862e-03,
+-9.2893769033253193e-04,-1.8009729683399200e-02,2.3500190582126379e-03,8.1822491483762860e-04,
+6.2095321482047439e-04,9.6780969761312008e-04,4.8000211245380342e-04,9.0538640506565571e-05,
+-4.3914798647165298e-02,-5.6501338258385658e-03,3.8661491125822067e-03,-6.3069426687434316e-05,
+5.2533738315105438e-02,1.3818660518154502e-03,-8.9264067355543375e-04,8.5579507052898407e-02,
+-1.8343339615967125e-04,-9.7924815490841866e-03,1.4428620226681232e-02,-4.5687001198530197e-02,
+-2.5763090234249830e-03,-3.8301859050989151e-02,2.8978290501981974e-03,-2.5165060069411993e-03,
+5.6281982688233256e-04,3.6684391088783741e-03,2.1319789811968803e-03,7.6037310063838959e-03,
+-1.1668079969240353e-04,3.1659509986639023e-03,-2.2569499909877777e-02,2.7129601221531630e-04,
+-1.5434459783136845e-02,-8.4861656650900841e-03,-1.1807470023632050e-01,-1.2300079688429832e-03,
+-7.0290351286530495e-03,8.9325206354260445e-03,-4.7735981643199921e-02,-4.4155579060316086e-02,
+-2.5983480736613274e-02,-4.7885831445455551e-03,6.7423451691865921e-03,1.1654750443994999e-02,
+-5.6982729583978653e-03,-7.2983349673449993e-03,7.9091778025031090e-03,-1.5874979726504534e-04,
+-6.2235877849161625e-03,1.3308860361576080e-03,5.2055278792977333e-03,1.4065169729292393e-02,
+-6.7384149879217148e-03,3.3406780567020178e-03,-1.1880699545145035e-02,1.4226379571482539e-03,
+2.9858129564672709e-03,-2.0481580868363380e-03,1.7122729914262891e-03,-1.6980869695544243e-02,
+-1.1290470138192177e-03,2.8620059601962566e-03,-3.8065758999437094e-03,5.9090270660817623e-03,
+1.1004370171576738e-03,-2.3396299220621586e-03,-3.6068160552531481e-03,4.0831189602613449e-02,
+-7.1082250215113163e-03,-9.3759730225428939e-04,-1.6740820137783885e-03,8.8287703692913055e-02,
+8.2009629113599658e-04,-7.6624617213383317e-04,6.5769668435677886e-04,-2.1304790861904621e-03,
+-3.7317050737328827e-04,-1.1172230355441570e-02,4.3435219675302505e-02,9.6736161503940821e-04,
+-3.1452889088541269e-03,1.5233129961416125e-03,2.0854279864579439e-03,3.6098200827836990e-02,
+1.6179570229724050e-03,-6.2132300809025764e-04,7.1878539165481925e-04,-3.9339520037174225e-02,
+-1.0988829890266061e-03,2.1191420964896679e-03,5.2359891124069691e-03,-2.2169889416545630e-03,
+-8.2303592935204506e-03,-8.2303592935204506e-03,4.5343261444941163e-04,-4.1777061414904892e-04,
+2.7823769487440586e-03,-6.0361868236213923e-05,3.5061789676547050e-03,1.7013119941111654e-04,
+-2.3378930054605007e-03,-2.1369170863181353e-03,1.0250400518998504e-03,-4.4726220949087292e-05,
+5.7102291611954570e-04,5.7743012439459562e-04,7.9692091094329953e-04,3.5945948911830783e-04,
+4.3973900028504431e-04,-8.9061429025605321e-04,5.4110242053866386e-03,-8.5764907998964190e-04,
+-2.2000649943947792e-02,-7.8731682151556015e-03,-2.7444459497928619e-02,1.9792269449681044e-03,
+-5.6783691979944706e-03,1.5057219570735469e-05,-5.4136710241436958e-03,5.3679239936172962e-03,
+-3.1426660716533661e-03,1.0907390154898167e-02,5.8436761610209942e-03,9.0507230197545141e-05,
+-1.6345789656043053e-02,1.5987500082701445e-03,-4.0257978253066540e-03,-6.7750471644103527e-03,
+-3.2470689620822668e-03,1.5409620245918632e-03,-1.2858119793236256e-02,-1.4824670506641269e-04,
+-9.0210810303688049e-03,-2.8795029968023300e-02,9.0210810303688049e-03,7.4121179059147835e-03,
+-3.7217529024928808e-03,1.9865889847278595e-01,1.5208719560177997e-05,-3.9089918136596680e-03,
+2.5106288958340883e-03,2.3921660613268614e-04,6.9443131797015667e-03,1.2065629707649350e-03,
+2.5106288958340883e-03,1.7514040227979422e-03,-4.1978210210800171e-03,1.3092850567772985e-03,
+6.7396182566881180e-04,-1.0530710220336914e-02,-4.0672299265861511e-01,-2.6314549148082733e-02,
+2.2557149641215801e-03,1.2154860422015190e-02,-1.8436539918184280e-02,5.3676147945225239e-04,
+-2.6265541091561317e-03,-5.1119807176291943e-04,4.1454841266386211e-04,-5.5028748465701938e-04,
+-1.0347720235586166e-03,-3.3966631162911654e-03,3.1795909162610769e-03,-1.6528950072824955e-04,
+8.3725210279226303e-03,-2.5799809955060482e-03,9.0194388758391142e-04,3.6952210939489305e-04,
+9.9746137857437134e-04,-3.6688039544969797e-03,-8.9501030743122101e-04,5.1904921419918537e-03,
+4.2274440056644380e-04,8.5176713764667511e-03,-3.6623608320951462e-02,-4.1103712283074856e-03,
+-6.6017331555485725e-03,2.5578640401363373e-02,1.1447439901530743e-02,7.2427501436322927e-04,
+9.7127500921487808e-03,-1.1337569914758205e-02,-8.1453882157802582e-03,-8.5570756345987320e-03,
+2.2993308957666159e-03,3.8430930580943823e-03,-9.9116540513932705e-04,2.5496469810605049e-02,
+-1.5748359262943268e-02,-1.8046120181679726e-02,1.0323390364646912e-02,1.6452240524813533e-03,
+1.5881149098277092e-02,1.0586519725620747e-02,-2.1531689912080765e-02,5.2480469457805157e-03,
+1.8219340126961470e-03,8.1313941627740860e-03,1.7055979697033763e-03,-7.4483548814896494e-05,
+3.8342390325851738e-04,3.1868910882622004e-03,1.6044320166110992e-01,-6.7285560071468353e-03,
+7.2638481469766703e-06,5.5551197146996856e-04,-1.0822320356965065e-02,-4.5834020711481571e-03,
+-3.0205070506781340e-03,7.7864617109298706e-02,2.6494380086660385e-02,3.6912109702825546e-02,
+5.7857790961861610e-03,9.3849771656095982e-04,-1.1003199964761734e-02,-1.1737640015780926e-03,
+-3.6596669815480709e-03,-2.4822750128805637e-03,-4.4606071896851063e-03,-3.5969649907201529e-03,
+-3.6222559865564108e-03,1.2059339787811041e-03,4.3124938383698463e-03,-4.4961250387132168e-03,
+-1.3860689941793680e-03,-5.1588460337370634e-04,7.0330002927221358e-05,-2.0976549421902746e-04,
+1.3642259873449802e-03,1.5483660390600562e-03,1.9179609417915344e-01,-4.4776909053325653e-03,
+-1.2649179995059967e-01,6.5253327193204314e-05,4.1856421157717705e-03,2.7478230185806751e-04,
+-2.2906810045242310e-03,1.6744500026106834e-03,1.2349759927019477e-03,-8.7158754467964172e-03,
+4.6613621525466442e-03,-8.5815992206335068e-03,1.4352120459079742e-02,-7.7948719263076782e-03,
+-3.4155680332332850e-03,-4.2639090679585934e-03,8.7177697569131851e-03,-3.2232629600912333e-03,
+-4.2188368737697601e-02,1.9875749945640564e-02,-3.1134510412812233e-02,5.7032387703657150e-03,
+5.2733682096004486e-03,-3.1231069006025791e-03,4.6453849063254893e-04,3.0355889350175858e-02,
+-4.2992769740521908e-03,1.9509199773892760e-04,-7.7784480527043343e-03,1.6917599365115166e-02,
+-5.1948569715023041e-02,-5.4751220159232616e-03,1.5210839592327829e-05,1.0235579684376717e-03,
+-1.0427719826111570e-04,8.7853781878948212e-03,3.4012699034065008e-03,5.8582378551363945e-04,
+-2.2973360028117895e-03,-1.4330189675092697e-02,9.8565965890884399e-04,-4.6640761196613312e-02,
+-1.1907300353050232e-01,1.9333280622959137e-02,3.1427849084138870e-02,2.0082130504306406e-04,
+-6.2584900297224522e-03,8.2861045375466347e-03,2.0529709290713072e-03,3.2524869311600924e-03,
+-3.1884901225566864e-02,1.8379340181127191e-03,-4.8512680223211646e-04,-2.5407879147678614e-03,
+-5.1559060811996460e-03,-4.4968750327825546e-02,5.8984281495213509e-03,3.2763120252639055e-03,
+-1.0161520185647532e-04,-1.6290300118271261e-04,9.0541364625096321e-03,3.5398490726947784e-02,
+5.6469351984560490e-03,-2.4807190056890249e-03,-4.1088787838816643e-03,-2.0714469719678164e-03,
+-2.8939060866832733e-03,1.3467279495671391e-03,-9.0779133141040802e-02,-8.3171762526035309e-02,
+-1.4107000315561891e-03,5.5668760091066360e-02,5.7701539248228073e-02,-4.2503291368484497e-01,
+-4.4380719191394746e-04,1.7924769781529903e-04,5.0382469780743122e-03,1.5191170386970043e-02,
+-1.2300389818847179e-02,1.5168030513450503e-03,9.5754547510296106e-04,-1.8962200731039047e-02,
+-2.2272260859608650e-02,-2.5145230814814568e-02,1.9533900544047356e-02,-1.1231349781155586e-03,
+-1.4861139934509993e-03,3.5002888762392104e-04,-1.1231349781155586e-03,1.0409739799797535e-02,
+-8.7832562625408173e-02,1.6584879485890269e-03,-2.3008750285953283e-03,3.3026169985532761e-02,
+-1.3585069682449102e-03,7.8067491995170712e-04,-1.8025759607553482e-02,1.2354910140857100e-03,
+-9.2583027435466647e-04,8.0123997759073973e-04,2.4914839304983616e-03,-5.0488598644733429e-02,
+-7.7838351717218757e-04,2.3572890495415777e-04,4.5575071126222610e-03,8.1241987645626068e-03,
+-4.4612158671952784e-04,-2.8972938889637589e-04,7.1604831646254752e-06,-3.8497708737850189e-04,
+1.9489860278554261e-04,-1.7083849757909775e-02,8.3513697609305382e-04,7.5499608647078276e-04,
+8.0216713249683380e-03,-3.8930509239435196e-02,-7.0348767621908337e-05,-8.5350573062896729e-03,
+1.0854450054466724e-02,4.5329501153901219e-04,1.8117150466423482e-04,4.6641560038551688e-04,
+-8.4854792803525925e-03,-1.8934309482574463e-02,4.9814549274742603e-03,3.4286780282855034e-03,
+4.4203791185282171e-04,2.3822550429031253e-04,-6.4261639490723610e-03,9.9637769162654877e-03,
+1.3654050417244434e-02,-9.9892877042293549e-03,3.6558631807565689e-02,4.8999379941960797e-05,
+1.3654050417244434e-02,1.8802779959514737e-03,-1.3654050417244434e-02,1.2778700329363346e-03,
+9.8843395244330168e-04,1.4511500012304168e-05,-2.2775429533794522e-04,-1.4753740280866623e-02,
+-3.4148250706493855e-03,7.5806681998074055e-03,-5.7734688743948936e-03,7.4033669079653919e-05,
+-8.2278084009885788e-03,5.3380909375846386e-03,-2.7049109339714050e-03,7.7341338619589806e-03,
+1.0886609554290771e-02,1.1038660071790218e-02,-1.0054199956357479e-02,7.7072880230844021e-03,
+-5.8278098003938794e-04,-2.5739220436662436e-03,-7.0167761296033859e-03,-1.7727289814502001e-03,
+-1.6318289563059807e-02,-1.1663000099360943e-02,2.5881489273160696e-03,-3.7328999023884535e-03,
+-1.4355930034071207e-03,1.8340899841859937e-03,1.2280289828777313e-01,5.0228700041770935e-02,
+-2.1437000483274460e-02,-3.1009620055556297e-02,-1.2973720207810402e-02,1.5818020328879356e-03,
+-9.7806248813867569e-03,1.1735740117728710e-03,1.4651629608124495e-03,2.3532148916274309e-03,
+-6.1809681355953217e-03,6.5688649192452431e-04,2.6228010654449463e-02,-1.7958110198378563e-02,
+-7.6468721963465214e-03,-2.7482809964567423e-03,1.3851850293576717e-02,2.6369190309196711e-03,
+-3.1513599678874016e-03,-1.4788460248382762e-05,-7.3676988482475281e-02,-3.0912780202925205e-03,
+7.9240966588258743e-03,8.5778040811419487e-03,5.5403169244527817e-03,-1.1886510037584230e-04,
+-1.8408369272947311e-02,-2.3490579333156347e-03,-7.6157399453222752e-03,-3.3190969843417406e-03,
+-9.4642979092895985e-04,8.7858550250530243e-03,1.6395459533669055e-04,-2.3508940357714891e-03,
+7.5449963333085179e-05,2.7018489316105843e-02,8.4561208495870233e-04,-1.1687109945341945e-03,
+2.2897500544786453e-02,7.0879262685775757e-01,3.7483830004930496e-02,1.2827500468119979e-03,
+-5.1718312315642834e-03,2.7545939665287733e-03,-3.6072919610887766e-03,-2.5258748792111874e-04,
+-7.0514748804271221e-03,-5.4323761723935604e-03,-1.4652940080850385e-05,-1.8556920113041997e-03,
+4.7609540633857250e-03,1.5676260227337480e-03,5.4239919409155846e-03,-6.4692399464547634e-03,
+-7.8038539504632354e-04,4.5086450874805450e-02,-5.1405387930572033e-03,-2.1236129105091095e-02,
+-2.3763340432196856e-03,5.4122589528560638e-02,-5.3492980077862740e-04,-5.8454048121348023e-04,
+3.0031939968466759e-03,6.9161207647994161e-04,1.1212790384888649e-02,-7.6108198845759034e-04,
+1.1984579759882763e-04,-1.9725349557120353e-04,-5.5180420167744160e-03,1.2148249661549926e-03,
+-4.2497441172599792e-03,-9.4915721565485001e-03,6.5378600265830755e-04,-4.9741100519895554e-04,
+-4.3079249560832977e-02,-5.1999092102050781e-04,-4.5451628975570202e-03,-7.9610403627157211e-03,
+-3.1919340835884213e-04,-1.9223889335989952e-02,-1.3076990144327283e-03,1.9825039431452751e-02,
+-2.2013280540704727e-03,-7.8596705570816994e-03,1.4142199652269483e-03,-1.1232759803533554e-02,
+2.9746301006525755e-03,5.3283828310668468e-04,1.0105259716510773e-02,-1.1653699912130833e-02,
+-7.0609981194138527e-03,2.2343141026794910e-03,-2.9802279546856880e-02,1.1611840454861522e-03,
+9.4824447296559811e-04,4.1284630424343050e-04,-3.1203540042042732e-02,2.7652881108224392e-03,
+2.5644779205322266e-02,-7.5331530533730984e-03,3.2047149725258350e-03,-2.4282479716930538e-04,
+-6.1979342717677355e-04,-8.0101029016077518e-04,-9.1816839994862676e-04,1.2239529751241207e-03,
+-6.8743730662390590e-04,-1.8252469599246979e-03,-7.4570789001882076e-03,5.3775748237967491e-03,
+3.7602309603244066e-03,8.7752222316339612e-04,5.5084479972720146e-03,-7.5949047459289432e-04,
+1.6352660022675991e-03,-1.2750849418807775e-04,2.2067610174417496e-02,-1.9203789532184601e-02,
+-1.2998109683394432e-02,-3.1332690268754959e-03,-5.2937557920813560e-03,2.1857069805264473e-03,
+-4.5750709250569344e-03,-4.5152138918638229e-02,-2.7783559635281563e-03,-2.5752480141818523e-03,
+1.1614130344241858e-03,2.3350189439952374e-03,3.8499289657920599e-03,2.4529630318284035e-03,
+3.6731390282511711e-03,2.1937100682407618e-03,-6.4666871912777424e-03,-5.7186251506209373e-03,
+9.9941878579556942e-04,-7.8276498243212700e-04,4.3231188319623470e-03,4.0838290005922318e-03,
+3.0515898833982646e-04,1.2640280183404684e-03,-1.0152660310268402e-02,-2.6863690000027418e-03,
+-9.0515613555908203e-03,-6.3204211182892323e-03,2.6117300149053335e-03,1.4339019544422626e-02,
+2.8452780097723007e-03,1.4783289771003183e-05,8.1814555451273918e-03,6.6321990452706814e-03,
+-2.2483461070805788e-03,1.2374560348689556e-02,-6.6516688093543053e-03,-8.5750613361597061e-03,
+6.5078441984951496e-03,2.8675209730863571e-02,7.0673860609531403e-03,1.2367829913273454e-03,
+7.4818679131567478e-03,4.7109839506447315e-03,-6.9405790418386459e-03,3.3302098512649536e-02,
+3.6104630678892136e-02,1.9674649462103844e-02,3.4766150638461113e-03,1.3987369602546096e-03,
+4.0974249131977558e-03,2.6973790954798460e-03,-5.6591699831187725e-03,3.9460969856008887e-04,
+2.1750570740550756e-03,1.4614439569413662e-03,-5.3006567759439349e-04,1.4869309961795807e-01,
+-5.8816498494707048e-05,-1.6275369562208652e-03,-1.2881809845566750e-02,9.4982917653396726e-04,
+-1.2315999716520309e-02,9.0286601334810257e-03,-8.6876116693019867e-02,-1.5107560102478601e-05,
+-1.7457660287618637e-02,-2.5219470262527466e-03,1.0656520025804639e-03,-4.2540300637483597e-03,
+-9.0349102392792702e-03,-1.5230999561026692e-03,2.8441150207072496e-03,-3.2824429217725992e-03,
+3.2161718991119415e-05,3.0118400900391862e-05,-5.6150099262595177e-03,-1.7389209941029549e-02,
+-4.4361080654198304e-05,1.0354899859521538e-04,1.5939630102366209e-03,2.5440789759159088e-03,
+1.5083180187502876e-05,-9.9282202427275479e-05,5.5371708003804088e-04,1.9186759600415826e-03,
+-5.0764222396537662e-04,1.7236480489373207e-03,1.3092169538140297e-02,4.1446479735895991e-04,
+2.1835729479789734e-02,4.8323940485715866e-02,1.6091950237751007e-03,1.3469760306179523e-03,
+1.7729059618432075e-04,3.6743620876222849e-04,-1.2352119665592909e-03,1.1705530341714621e-03,
+-2.9695429475395940e-05,2.7050738572143018e-04,-7.9626210208516568e-05,3.3152441028505564e-04,
+-5.2305828779935837e-02,2.6880469173192978e-02,-2.4203000066336244e-04,-1.6424639616161585e-03,
+-2.6830288697965443e-04,-2.2649629972875118e-03,1.5627209097146988e-02,1.6211320459842682e-01,
+-3.7391691002994776e-03,-2.0878419745713472e-03,2.3334210272878408e-03,6.5116386394947767e-05,
+7.4625718407332897e-03,-2.2032689303159714e-02,-8.3081610500812531e-03,-4.3259368976578116e-04,
+-3.2209228724241257e-02,-9.0424838708713651e-04,2.2727500181645155e-03,5.9820008464157581e-03,
+-5.8856618124991655e-04,-8.8227191008627415e-04,-7.4473457061685622e-05,3.9148979703895748e-04,
+-3.6939629353582859e-03,-1.1207849718630314e-02,-1.0337409563362598e-02,3.6883640568703413e-03,
+-3.8984280545264482e-03,-5.9986729174852371e-03,4.5043681748211384e-03,1.7799530178308487e-02,
+-1.8462570384144783e-02,1.4931300029275008e-05,-8.6021229624748230e-02,-6.0818758356617764e-05,
+1.2670679716393352e-03,1.3699879636988044e-03,3.3162781037390232e-03,-1.4532039640471339e-03,
+-7.1492061018943787e-02,1.9857978913933039e-03,6.2516499310731888e-03,2.7005500160157681e-03,
+1.1130389757454395e-02,1.5092849731445312e-02,-2.7943300083279610e-02,4.4036991312168539e-05,
+-1.2232770211994648e-02,-6.8591412855312228e-04,-3.8992990739643574e-03,4.9113907152786851e-04,
+8.2117747515439987e-03,-4.5564480125904083e-02,-5.3631910122931004e-03,-1.2274970300495625e-02,
+5.4185991175472736e-03,8.1846961984410882e-04,4.1358140297234058e-03,3.9578010910190642e-04,
+4.6887691132724285e-03,-1.8255440518260002e-02,-6.2736468389630318e-03,2.4320168886333704e-03,
+-4.9617629498243332e-02,1.1701210169121623e-03,-4.5237291604280472e-02,4.7563421539962292e-03,
+-1.4835969544947147e-02,7.7436608262360096e-04,1.4835969544947147e-02,-8.0892542609944940e-04,
+7.7517668250948191e-04,-6.7618978209793568e-03,-4.0135860443115234e-02,-3.3651469275355339e-03,
+7.4713007779791951e-04,-4.2727389372885227e-03,3.6202510818839073e-03,4.7307618660852313e-04,
+3.3094909042119980e-02,-1.1544119566679001e-02,-7.4234469793736935e-03,-4.2252950370311737e-03,
+1.8133109435439110e-02,7.0903049781918526e-03,-1.3272940181195736e-02,1.4632199599873275e-04,
+-3.5790191031992435e-03,-4.6997101162560284e-04,-4.8179440200328827e-02,-9.2581362696364522e-04,
+-1.4780730009078979e-02,-1.0027450323104858e-01,-9.3848101096227765e-04,-2.8861360624432564e-03,
+-4.3682761490345001e-02,2.6115700602531433e-03,4.3682761490345001e-02,1.7179530113935471e-03,
+-3.3964909613132477e-02,-1.0993590112775564e-03,5.4301079362630844e-02,1.0993590112775564e-03,
+-1.4954120160837192e-05,3.1415868550539017e-02,1.0831849649548531e-02,8.6545711383223534e-04,
+2.2743160370737314e-03,3.9340821094810963e-03,8.1451907753944397e-03,-5.2763288840651512e-03,
+-8.3787851035594940e-03,1.5621910570189357e-03,3.2318739686161280e-03,6.6804019734263420e-03,
+-3.3396480139344931e-03,-2.0933480560779572e-01,6.3805822283029556e-03,-6.0137799009680748e-03,
+-8.1756077706813812e-03,6.3951779156923294e-04,1.0127760469913483e-03,4.9784599104896188e-04,
+1.3596490316558629e-04,1.3571660034358501e-02,3.0259079721872695e-05,-3.2625840976834297e-03,
+-1.9217010412830859e-04,2.1993879228830338e-02,7.8907777788117528e-04,5.0893891602754593e-04,
+1.1662710312521085e-04,8.0604078248143196e-03,9.5925969071686268e-04,-1.9526129588484764e-02,
+4.1242439299821854e-02,1.5626709908246994e-02,2.9947189614176750e-04,-1.0037609608843923e-03,
+6.8128242855891585e-04,1.3098999625071883e-04,3.1696720980107784e-03,-2.0587369799613953e-03,
+-4.6395038953050971e-04,3.5089480224996805e-03,-2.3975980002433062e-03,1.0901279747486115e-03,
+-1.6524370585102588e-04,-4.1602319106459618e-04,-2.3739910102449358e-04,2.4739760905504227e-02,
+-1.5342839993536472e-02,1.1540469713509083e-02,6.4230621792376041e-03,1.2977809645235538e-02,
+1.1063399724662304e-03,1.3743690215051174e-03,1.6233779489994049e-02,-8.1519351806491613e-04,
+-9.0782493352890015e-02,1.1665210127830505e-02,-2.3286409676074982e-02,2.1559339947998524e-03,
+-4.3167220428586006e-03,1.5610599657520652e-03,1.4076639898121357e-02,7.1018589660525322e-03,
+-4.8221647739410400e-03,-5.3852899000048637e-03,7.3483278974890709e-03,-3.5707519855350256e-03,
+2.3340100888162851e-03,4.7432780265808105e-03,6.5055489540100098e-03,1.2589249759912491e-02,
+-6.3358368352055550e-03,-5.7639651931822300e-03,1.3599749654531479e-03,2.8404260054230690e-02,
+-9.2958156019449234e-03,-1.1800320353358984e-03,-2.0948140881955624e-03,4.1679958812892437e-03,
+5.4458891972899437e-03,-1.2766510481014848e-03,5.9404270723462105e-04,4.2309608310461044e-02,
+5.6189671158790588e-03,7.2401198558509350e-03,-4.5610670931637287e-03,4.5506159949582070e-05,
+-6.1903791502118111e-03,8.1186462193727493e-04,1.3779809698462486e-02,1.1290319962427020e-03,
+-1.0610350000206381e-04,1.6695790691301227e-04,1.1290319962427020e-03,-1.2019349634647369e-01,
+-1.5230740420520306e-02,3.5759829916059971e-03,1.3479460030794144e-02,-2.1162950433790684e-03,
+-1.7877709120512009e-02,1.0931970318779349e-03,-3.0553159303963184e-03,3.6365049891173840e-03,
+9.7896481747739017e-05,-3.2714448752813041e-04,4.3425030889920890e-04,1.4005579985678196e-02,
+-9.2654931358993053e-04,3.9504268206655979e-03,-5.8086868375539780e-04,-1.2018020264804363e-02,
+-1.4521540701389313e-01,-6.6049019806087017e-03,-3.4909751266241074e-02,3.7478420417755842e-03,
+3.3038031309843063e-02,3.6872599739581347e-03,-4.5311939902603626e-03,4.1058510541915894e-03,
+-8.7599847465753555e-03,-2.3003309965133667e-02,5.3664818406105042e-03,3.8971770554780960e-02,
+-2.7767190709710121e-02,-9.8894089460372925e-03,-3.2073140610009432e-03,-6.7484978353604674e-04,
+-5.1947520114481449e-03,-2.6169899501837790e-04,2.2421479225158691e-03,-1.2139769969508052e-03,
+-2.9469770379364491e-03,-3.9291830034926534e-04,6.2550729513168335e-01,9.7744520753622055e-03,
+9.4378247857093811e-02,-1.9560910295695066e-03,9.0652769431471825e-03,4.2138071148656309e-04,
+-4.4220191193744540e-04,-4.7313501127064228e-03,1.5395509544759989e-03,2.4315000046044588e-03,
+-1.5581619925796986e-02,1.0816920548677444e-03,-2.2197659127414227e-03,-9.3048671260476112e-04,
+-4.7418707981705666e-03,-6.2950369901955128e-03,3.5216049291193485e-03,-2.4289379362016916e-03,
+-2.5261470582336187e-03,-1.4817339833825827e-03,-2.2474530339241028e-01,2.8342509176582098e-03,
+-2.0821610465645790e-02,1.4896340144332498e-04,-3.3524499740451574e-03,-3.7279881536960602e-02,
+1.3896770542487502e-04,-3.1912620761431754e-04,5.4003461264073849e-04,3.8956850767135620e-03,
+1.6084529925137758e-03,-5.7474587811157107e-04,1.3435039669275284e-02,2.1368139423429966e-03,
+1.4157629571855068e-02,5.3884391672909260e-03,8.8013410568237305e-03,3.8858849438838661e-04,
+-2.2143588867038488e-03,-8.4642972797155380e-03,1.5044390223920345e-02,7.6346402056515217e-03,
+3.3895121305249631e-04,2.1157610171940178e-04,-2.7514949440956116e-02,5.1603060215711594e-02,
+3.7510651163756847e-03,-2.1457639522850513e-03,-5.8178009930998087e-04,-9.3638541875407100e-04,
+4.1667491197586060e-02,-6.7763780243694782e-03,-2.9170580673962831e-03,3.2789530814625323e-04,
+1.1729800142347813e-02,1.1712179984897375e-03,9.3555096536874771e-03,1.6570610459893942e-03,
+-1.3387809740379453e-03,1.7580550047568977e-04,-2.9473248869180679e-03,8.3220899105072021e-03,
+7.4366689659655094e-03,-2.1322889369912446e-04,-7.8024631366133690e-03,5.6611228501424193e-04,
+-9.2346500605344772e-03,-1.4676499631605111e-05,9.7007937729358673e-03,-3.5320650786161423e-03,
+2.1616410464048386e-02,3.4567608963698149e-03,2.2914320230484009e-02,3.4328910987824202e-03,
+-8.6510833352804184e-03,1.4510039472952485e-03,7.8191719949245453e-03,2.0798550394829363e-04,
+-3.9962218143045902e-03,-1.5010139577498194e-05,-4.2428788729012012e-03,9.1374982148408890e-03,
+8.8254585862159729e-03,9.4092212384566665e-04,-1.2503350153565407e-02,8.6759645491838455e-03,
+-1.0416760109364986e-02,2.7432460337877274e-03,-4.2385691776871681e-03,1.8325870856642723e-02,
+-2.4334540590643883e-02,4.6469361404888332e-04,3.4260009415447712e-03,-2.5827318895608187e-03,
+1.0545699624344707e-03,-9.1257691383361816e-04,2.6589010376483202e-03,4.8598358407616615e-03,
+8.0638676881790161e-03,-7.5898370705544949e-03,3.6368070868775249e-04,6.2594950199127197e-02,
+-4.9753207713365555e-03,-2.0880119409412146e-03,9.5644511748105288e-04,-3.1721461564302444e-02,
+1.2898689601570368e-03,9.8405163735151291e-03,1.2237089686095715e-03,-8.4232585504651070e-03,
+-7.2726322105154395e-04,4.6842931769788265e-03,-1.0379579616710544e-03,9.1342730447649956e-03,
+1.4971119817346334e-03,1.5762320253998041e-03,8.7496247142553329e-03,-8.5103599121794105e-04,
+-1.7325570806860924e-02,-8.3266440778970718e-03,1.5157909729168750e-05,1.8041470320895314e-03,
+3.0691560823470354e-03,-5.2225510444259271e-05,1.0072169970953837e-04,1.3573700562119484e-04,
+9.2137878527864814e-04,3.0316581251099706e-04,3.9582479745149612e-02,4.7519680112600327e-02,
+1.8871759995818138e-02,-3.9876459049992263e-04,4.6556600136682391e-04,6.7090610973536968e-03,
+-1.8931160448119044e-03,-1.3056949712336063e-02,-1.9484119547996670e-04,1.5093220099515747e-05,
+-7.1617960202274844e-06,3.0164679628796875e-04,4.4195181690156460e-03,-7.3984181508421898e-03,
+-7.8031201846897602e-03,-1.0731429792940617e-02,1.4246780192479491e-03,-8.2717568147927523e-05,
+4.4803409837186337e-03,3.0789140146225691e-03,-1.1310289846733212e-03,-1.0410690447315574e-03,
+1.1648540385067463e-03,9.0057362103834748e-04,6.8781538866460323e-03,-3.5283900797367096e-02,
+-1.3320200378075242e-03,-2.3177571129053831e-03,2.1332940377760679e-04,1.3467900454998016e-02,
+-1.2829169863834977e-03,5.1571638323366642e-04,3.9254198782145977e-03,-3.3780589699745178e-02,
+-3.7853721529245377e-02,-4.0752900531515479e-04,-3.1193809118121862e-03,-1.5714969485998154e-02,
+-7.8525702701881528e-04,-2.8750501223839819e-04,2.8016859665513039e-02,-1.9018839811906219e-03,
+2.0647559314966202e-02,4.3002571910619736e-03,1.3459140434861183e-02,-1.0320040397346020e-02,
+3.1990748643875122e-01,9.2198798665776849e-04,4.1852539288811386e-04,3.5891108564101160e-04,
+-2.0992439985275269e-01,-4.9328152090311050e-03,2.3409130517393351e-03,4.7120270319283009e-03,
+2.8713190928101540e-02,-2.6156550738960505e-03,-1.3558969832956791e-02,-3.0331799644045532e-04,
+-5.5601762142032385e-04,2.4025330785661936e-03,-3.4089901018887758e-03,8.0019602319225669e-04,
+2.1901070140302181e-03,3.3745369873940945e-03,8.0019602319225669e-04,1.7346069216728210e-02,
+-1.9568449351936579e-03,-1.1229019612073898e-02,-2.6608388870954514e-03,-1.1615100316703320e-02,
+-9.5248602330684662e-02,7.3701781220734119e-03,-1.4953900128602982e-02,5.7038792874664068e-04,
+5.8516198769211769e-03,2.1150549582671374e-04,-6.9679190346505493e-06,-7.9677387839183211e-04,
+1.9459480419754982e-02,-1.1160830035805702e-02,1.4056149870157242e-02,-3.2958350493572652e-04,
+-5.4636420682072639e-03,5.8881669247057289e-05,6.6343429498374462e-03,4.5263409614562988e-02,
+-8.0646127462387085e-03,4.7389548853971064e-04,1.4877359717502259e-05,2.4321159347891808e-02,
+6.9931396865285933e-05,2.6287760119885206e-03,3.8190539926290512e-03,-2.5989150628447533e-02,
+1.2062400346621871e-03,-1.5557400183752179e-03,-2.2691930644214153e-03,2.3287249496206641e-04,
+-5.5999699980020523e-03,-1.0496189817786217e-02,-1.4814930182183161e-05,-6.4287078566849232e-04,
+-1.8891949730459601e-04,-9.0413521975278854e-03,7.9534705728292465e-03,-2.7908999472856522e-03,
+3.2857100013643503e-03,7.7063008211553097e-04,6.3021942973136902e-02,-2.8374609537422657e-03,
+4.6461950987577438e-02,2.9152540490031242e-02,-1.4000290320836939e-05,-1.2757079675793648e-03,
+1.3596529606729746e-03,1.7991929780691862e-04,-1.4166639630275313e-05,6.0252390539972112e-05,
+6.4320368692278862e-03,4.6682319953106344e-04,5.7436279021203518e-03,3.2019240316003561e-03,
+-5.7637941790744662e-04,-3.7901920732110739e-03,4.8914109356701374e-03,4.6459292061626911e-03,
+-6.8799369037151337e-03,-1.8147470429539680e-02,1.1409220314817503e-04,-5.4334272863343358e-04,
+-2.7602489572018385e-03,-1.9730569329112768e-03,2.4565239436924458e-03,1.9392010290175676e-04,
+7.8643016517162323e-02,6.5276869572699070e-03,-7.8716799616813660e-02,5.7298499159514904e-03,
+6.2386557692661881e-04,-8.5267230868339539e-02,4.0981110185384750e-02,7.7135749161243439e-03,
+-6.8663940764963627e-03,1.4559639617800713e-02,-1.0064310394227505e-02,3.6274080630391836e-03,
+-2.3421540390700102e-03,-2.4686409160494804e-02,1.9456120207905769e-04,3.1714211218059063e-04,
+2.0793990697711706e-03,1.7982709687203169e-03,-2.2287059982772917e-04,3.2623921288177371e-04,
+-6.6792681813240051e-02,-1.4869889710098505e-03,-5.0454870797693729e-03,-4.8297587782144547e-03,
+-1.0722599690780044e-03,8.7901195511221886e-03,-7.1750381030142307e-03,1.1251230025663972e-03,
+1.0634710080921650e-02,-1.1763219721615314e-02,9.2324063181877136e-02,1.8991080578416586e-03,
+-1.0510340332984924e-02,-7.4531312566250563e-04,8.0041000619530678e-03,5.8110528625547886e-03,
+-2.7918580919504166e-02,2.1739399526268244e-03,-4.0639587678015232e-03,6.0017139185220003e-04,
+1.9214770291000605e-03,-1.3860830105841160e-02,2.3006850853562355e-02,-1.3857929734513164e-03,
+1.2637410545721650e-03,-1.4675210230052471e-02,-2.9535070061683655e-03,-1.7189770005643368e-03,
+-4.2484089499339461e-04,-8.5248658433556557e-04,8.9034568518400192e-03,1.4895649655954912e-05,
+-4.7091601300053298e-04,4.3084810022264719e-04,-6.3893961487337947e-04,-7.3733746830839664e-05,
+-8.8991485536098480e-03,-1.0253350250422955e-02,-5.9637490659952164e-02,2.1707199513912201e-02,
+9.9107045680284500e-03,-1.0998300276696682e-02,7.4608891736716032e-04,2.9539171373471618e-04,
+5.0054129213094711e-02,-7.2330660186707973e-03,-2.6863380335271358e-03,-1.0195849463343620e-03,
+-2.0204920321702957e-02,2.1340379025787115e-03,-1.8348889425396919e-03,-5.9489468112587929e-03,
+-2.3030120064504445e-04,5.0581009127199650e-03,-5.1950011402368546e-04,-6.8620947422459722e-04,
+-7.4936267919838428e-03,-1.5682930126786232e-02,-3.2649750355631113e-03,3.8463930832222104e-04,
+4.4492390006780624e-03,2.3118320852518082e-02,2.0835159812122583e-03,1.1513150529935956e-03,
+3.6104708909988403e-02,3.6256198654882610e-04,-3.4635469783097506e-03,-2.8796829283237457e-03,
+-8.1119500100612640e-03,4.5932079665362835e-03,7.0014740340411663e-03,8.0169539432972670e-04,
+-8.6652329191565514e-03,-2.7315050829201937e-03,1.3301590224727988e-03,-4.2648240923881531e-03,
+6.3251499086618423e-03,-3.0753740575164557e-03,-7.3622138006612659e-04,3.0082479497650638e-05,
+-3.8722730241715908e-03,6.2879058532416821e-04,1.3411579420790076e-03,-8.3681922405958176e-03,
+9.3305751215666533e-04,-1.0746510233730078e-03,-1.8610050901770592e-02,1.3651419430971146e-03,
+7.3744421824812889e-03,8.4163323044776917e-03,5.1413988694548607e-03,4.5847031287848949e-03,
+2.8565239161252975e-02,4.3958800961263478e-04,3.1459458172321320e-02,5.6011630222201347e-03,
+7.1835669223219156e-04,-5.5303089320659637e-03,1.4129279879853129e-03,2.5530709535814822e-04,
+3.1966410460881889e-04,5.0411392003297806e-03,7.7617880888283253e-03,2.9374631121754646e-03,
+-1.6497720498591661e-03,-5.8834417723119259e-03,8.7459187489002943e-04,-1.5308779664337635e-02,
+3.2292451709508896e-02,-4.3842519517056644e-04,1.5429529594257474e-03,-2.4733028840273619e-03,
+2.0994939841330051e-03,-5.7541108690202236e-03,-1.0233130306005478e-02,2.2554509341716766e-01,
+2.9666559770703316e-02,-2.8518449980765581e-03,9.7465328872203827e-04,1.4044740055396687e-05,
+-1.7579430714249611e-02,-5.2381679415702820e-02,-1.1242110282182693e-02,-3.6728400737047195e-03,
+3.5082760732620955e-03,6.1679710634052753e-03,-9.7009900491684675e-04,-1.0957010090351105e-02,
+-8.3272513002157211e-03,2.9798380637657829e-05,2.8244039276614785e-04,-8.1364117795601487e-04,
+1.8008040497079492e-03,-6.9944779388606548e-03,4.5625398342963308e-05,-7.3189922841265798e-04,
+-2.9980219551362097e-04,-2.9060940505587496e-05,-5.9742690064013004e-04,1.4831830048933625e-04,
+-2.9441029764711857e-03,1.3741210103034973e-01,-8.8414177298545837e-02,7.0610277354717255e-02,
+-7.7188978902995586e-03,1.5115399844944477e-02,1.0671879863366485e-03,7.0487911580130458e-04,
+-9.8690733313560486e-02,6.2373418360948563e-02,1.9496519817039371e-03,-8.9139147894456983e-04,
+-5.5150408297777176e-04,-1.1721949558705091e-03,-7.4480642797425389e-04,-2.6264840271323919e-03,
+-3.9712688885629177e-04,3.5984949208796024e-03,5.3080618381500244e-03,9.6319877775385976e-04,
+5.0776469288393855e-04,3.6223160568624735e-03,-6.2061410397291183e-02,6.4387189922854304e-04,
+2.6239909231662750e-02,8.1940297968685627e-04,2.3833119485061616e-04,-1.5869759954512119e-03,
+-6.7263417877256870e-03,1.1006110347807407e-02,7.1445819921791553e-03,-4.7233798541128635e-03,
+9.8437406122684479e-03,1.5124640412977897e-05,3.9908871054649353e-02,5.3903679363429546e-03,
+-3.9908871054649353e-02,5.3903679363429546e-03,6.7005190066993237e-03,-1.2623789720237255e-02,
+1.1806610040366650e-02,-3.4257229417562485e-03,3.9385299896821380e-04,3.4388188272714615e-02,
+-7.5009986758232117e-02,4.9022492021322250e-04,-8.5525289177894592e-03,1.3135520566720515e-04,
+4.7948658466339111e-03,2.0124691072851419e-03,-1.1785479635000229e-01,1.5575019642710686e-03,
+-1.5573759563267231e-02,-2.1854790393263102e-03,2.9272339306771755e-03,6.4663668163120747e-03,
+-7.6140360906720161e-03,4.1512572206556797e-03,2.7711640577763319e-03,-1.2836109846830368e-02,
+-2.4380050599575043e-03,2.1713329479098320e-03,6.2800728483125567e-04,-9.7982389852404594e-03,
+7.3543828912079334e-03,-1.4665040187537670e-02,3.0244510620832443e-02,-5.6660208851099014e-02,
+-5.6967479176819324e-03,3.0806770548224449e-02,2.2748769260942936e-03,2.0436900667846203e-03,
+-8.6277956143021584e-03,6.5113382879644632e-04,8.8188261725008488e-04,-1.4594909735023975e-02,
+-1.2304580304771662e-03,-2.1867299801670015e-04,-1.0909959673881531e-03,3.5210378700867295e-04,
+-7.2563779540359974e-03,1.4701850013807416e-03,1.1472719779703766e-04,3.0506469774991274e-03,
+2.6269949739798903e-04,-3.6365550477057695e-03,-8.4893293678760529e-03,5.8107408694922924e-03,
+7.5583951547741890e-04,-2.2017690353095531e-03,2.7908938936889172e-03,-1.8228569533675909e-03,
+-7.2495508939027786e-03,-6.8744522286579013e-04,2.5174440816044807e-03,-1.0151379741728306e-02,
+-4.1399952024221420e-03,-4.7078551724553108e-03,4.1981041431427002e-02,-1.4272999949753284e-02,
+4.0869521908462048e-03,1.7606799956411123e-03,1.2550549581646919e-04,-2.9503209516406059e-03,
+-1.1312420247122645e-03,-1.6983180539682508e-03,-1.1457820422947407e-02,-8.4962565451860428e-03,
+1.1919089592993259e-02,6.4416420646011829e-03,-8.7857811013236642e-04,-2.0312711130827665e-03,
+-1.5262430533766747e-03,4.2860880494117737e-03,3.5010920837521553e-03,1.2587670236825943e-02,
+2.6207490009255707e-04,4.4701730075757951e-05,7.8084698179736733e-04,8.8851212058216333e-04,
+2.3369069676846266e-03,1.6688359901309013e-03,3.0844469438306987e-04,3.4617560449987650e-03,
+1.8961310386657715e-02,1.7347310483455658e-01,2.0020549709443003e-04,1.0967060225084424e-03,
+1.5107099898159504e-04,-3.4463501069694757e-03,8.5176620632410049e-03,-3.5812109708786011e-02,
+-2.1155400201678276e-02,8.9890940580517054e-04,-1.5613760333508253e-03,6.7120860330760479e-04,
+-2.1597029641270638e-02,-2.4947229772806168e-02,1.8725979607552290e-03,6.3912719488143921e-03,
+-9.1552399098873138e-03,2.1715660113841295e-03,1.2330369791015983e-03,-4.0785901364870369e-04,
+4.6437609125860035e-04,-1.1600199650274590e-04,-1.2718720361590385e-02,8.9431880041956902e-05,
+-3.3913689549081028e-04,-1.8026340752840042e-02,6.9179181009531021e-03,-1.1839679791592062e-04,
+-3.9474181830883026e-03,6.0050919273635373e-05,9.1423643752932549e-03,2.1305440168362111e-04,
+-2.0855850016232580e-04,1.3130389852449298e-03,-2.9134768992662430e-03,2.9645769391208887e-03,
+1.7772549763321877e-03,-7.7136349864304066e-03,5.1027478184551001e-04,1.7460630042478442e-03,
+3.8068278809078038e-04,2.8228890150785446e-03,-5.3000478073954582e-03,4.4951299059903249e-05,
+3.2752458937466145e-03,-2.8162579983472824e-03,1.4112279750406742e-03,8.3062034100294113e-03,
+2.2164839319884777e-03,-4.9868631176650524e-03,-3.6664260551333427e-03,-1.0581229813396931e-02,
+7.3366491124033928e-03,-3.9318940252996981e-04,-8.1375334411859512e-03,2.4809150490909815e-03,
+8.8749779388308525e-04,-4.2194919660687447e-04,-7.9790111631155014e-03,1.1439629597589374e-03,
+7.5542130507528782e-03,1.0288399644196033e-03,-1.7234670231118798e-03,5.7586699724197388e-01,
+6.6640521399676800e-03,8.9905522763729095e-03,5.7154200039803982e-03,1.1257929727435112e-03,
+-9.1789010912179947e-04,-1.0492859873920679e-03,3.5453929740469903e-05,2.9015709878876805e-04,
+1.6071660502348095e-04,-5.2961107576265931e-04,2.6682569296099246e-04,-1.3492540165316314e-04,
+-1.0841679759323597e-02,1.2077829800546169e-02,2.2128869313746691e-03,-1.5266190283000469e-02,
+6.7929533543065190e-05,1.7633590323384851e-04,8.1311381654813886e-04,3.2630451023578644e-03,
+-3.9503918960690498e-03,-3.9864578866399825e-04,-1.1432520113885403e-02,5.3339172154664993e-03,
+8.3193257451057434e-03,-4.2479918920435011e-04,-1.1189430207014084e-01,-7.5553781352937222e-03,
+-7.0337029173970222e-03,-1.4833680354058743e-02,8.7506724521517754e-03,1.6645010327920318e-03,
+9.4900820404291153e-03,1.1133110383525491e-03,9.4940755516290665e-03,-1.5396620146930218e-03,
+1.3434959948062897e-01,-9.4940755516290665e-03,2.0011790096759796e-02,-1.8875009845942259e-03,
+7.1842782199382782e-03,1.6976969782263041e-03,4.9219978973269463e-03,1.1803199537098408e-02,
+-9.7703449428081512e-03,2.1174899302423000e-03,9.4801411032676697e-03,-2.6078789960592985e-03,
+-5.7252747938036919e-03,-8.2325618714094162e-03,8.9571950957179070e-04,-1.5021569561213255e-04,
+4.8489659093320370e-04,-9.6192650496959686e-02,-1.1053519556298852e-03,-1.0215040296316147e-01,
+3.0147889629006386e-03,7.6131648384034634e-03,1.5197630273178220e-03,-1.4197279699146748e-02,
+-1.3818879611790180e-02,-5.0701329018920660e-04,-9.3537531793117523e-03,-9.4771059229969978e-03,
+1.6923650400713086e-03,5.8652542065829039e-04,-2.5826620403677225e-03,-2.7307639829814434e-03,
+2.1871570497751236e-02,-1.5010299648565706e-05,5.3583700209856033e-03,5.0057549960911274e-03,
+-1.9030070398002863e-03,-7.8506693243980408e-03,-2.7093670796602964e-03,1.4138079714030027e-03,
+9.0300198644399643e-03,-9.7925681620836258e-04,1.3984439428895712e-03,8.3372107474133372e-04,
+1.0551059618592262e-02,8.8344102550763637e-05,-4.1022308170795441e-02,7.5065628625452518e-03,
+4.1022308170795441e-02,-5.3961377125233412e-04,-6.8696036934852600e-02,-1.8447940237820148e-03,
+-6.0959919355809689e-03,-4.2068301700055599e-03,-7.1332789957523346e-04,1.1756779998540878e-01,
+5.9354289987822995e-05,-6.3173691742122173e-03,1.4941499568521976e-02,-2.0789399277418852e-03,
+-7.0736219640821218e-04,-3.1247111037373543e-03,-7.8919378574937582e-04,1.0179580189287663e-02,
+-2.7506109327077866e-03,1.0601329617202282e-02,5.1466780714690685e-03,7.6321147382259369e-02,
+-1.5027689514681697e-03,1.2266670353710651e-02,-3.1118579208850861e-02,2.8905589133501053e-02,
+4.7598380595445633e-02,3.0808549374341965e-02,-2.1277810446918011e-04,7.8969962894916534e-02,
+-1.0257950052618980e-02,1.2604889925569296e-03,-3.3490460366010666e-02,-5.9202767442911863e-04,
+3.0320750738610514e-05,-5.4369680583477020e-04,-3.3490460366010666e-02,-5.9202767442911863e-04,
+2.0550889894366264e-03,-4.4353571720421314e-03,-8.4170423448085785e-02,6.7419027909636497e-03,
+1.0278150439262390e-02,5.8800862170755863e-03,-6.9679190346505493e-06,8.2419527461752295e-04,
+-5.5268318392336369e-03,9.6128671430051327e-04,2.4810510221868753e-03,-1.0480589699000120e-03,
+-6.1287907883524895e-03,1.1682329932227731e-04,-3.9909478276968002e-02,1.5859459526836872e-03,
+-2.2690229117870331e-02,2.0916070789098740e-03,-2.4715419858694077e-02,-1.3419450260698795e-02,
+-6.0629472136497498e-03,-2.0921030081808567e-03,2.5961859151721001e-02,1.7908669542521238e-04,
+-3.1546850223094225e-03,-1.1397759662941098e-03,-4.7840211540460587e-02,4.1577088995836675e-04,
+-4.4247039477340877e-04,1.4479350065812469e-03,1.5701510012149811e-02,2.7805729769170284e-04,
+-2.9010509606450796e-03,2.0830519497394562e-04,-5.1530029624700546e-02,1.7163449956569821e-04,
+2.3614279925823212e-02,-5.6427798699587584e-04,6.6903959959745407e-03,-4.8789530992507935e-03,
+-6.8537332117557526e-03,9.9893810693174601e-04,-1.3354700058698654e-04,1.0165109997615218e-03,
+9.1216771397739649e-04,1.0080259526148438e-03,-1.3102490629535168e-04,5.5228749988600612e-04,
+-1.2130969844292849e-04,-1.5112989785848185e-05,-4.0125829400494695e-04,-6.5766851184889674e-04,
+6.2220421386882663e-04,1.4663359615951777e-03,-4.9547709524631500e-02,1.3017569435760379e-03,
+-4.4914530590176582e-03,1.6592369647696614e-03,6.4695458859205246e-03,4.9810269847512245e-03,
+-3.8536980748176575e-02,-2.8275650739669800e-01,-9.0301828458905220e-03,-4.3866269290447235e-02,
+-4.5701069757342339e-03,-2.3362410720437765e-03,5.3960331715643406e-03,-2.6297608856111765e-03,
+-3.8577478844672441e-03,1.3963800156489015e-03,-8.8699469342827797e-03,-7.0626288652420044e-04,
+4.2645810171961784e-03,6.1572100967168808e-02,-4.5381980016827583e-03,-4.0877899155020714e-03,
+6.4308601431548595e-03,7.0455260574817657e-03,-2.3246440105140209e-03,6.0276601288933307e-05,
+1.8084559589624405e-02,8.4693520329892635e-04,-2.6931039988994598e-02,-4.2346641421318054e-03,
+2.6947110891342163e-02,4.6446882188320160e-03,-6.9577661342918873e-03,8.7609712500125170e-04,
+1.6103329835459590e-03,-1.2848590267822146e-03,1.0243539698421955e-02,2.6889349101111293e-04,
+3.7903659977018833e-03,-2.9369680210947990e-02,6.0743088833987713e-03,-1.2710720300674438e-02,
+-5.9445449151098728e-03,-2.8927479870617390e-03 
+};
+
+constexpr uchar soa_node1_on_left[] = 
+{
+0,0,1,0,0,0,0,0,1,1,1,1,1,0,0,1,0,1,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,1,0,0,1,1,
+1,0,1,1,1,0,0,0,1,0,1,1,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,0,1,1,1,0,0,0,0,1,1,1,1,1,
+0,0,0,0,0,1,0,0,1,0,0,0,1,0,1,1,0,0,1,1,0,1,1,0,0,0,1,0,0,0,1,0,1,1,0,1,1,0,0,0,
+1,1,1,0,0,1,0,0,0,1,1,1,1,1,1,0,1,0,0,1,0,1,0,0,0,0,0,1,1,0,1,1,1,0,0,0,0,0,0,0,
+1,1,0,1,0,0,0,0,0,0,1,0,0,1,1,0,0,1,0,1,0,0,1,1,0,0,1,0,1,0,1,1,1,0,1,1,1,1,1,1,
+0,0,1,0,1,1,0,0,1,1,0,1,0,1,1,1,1,0,0,0,0,1,1,0,0,0,0,1,0,0,0,0,0,1,0,1,1,0,0,0,
+0,0,0,0,0,1,1,1,0,1,1,1,0,0,1,0,0,1,1,0,1,1,1,1,0,0,0,0,0,1,0,0,0,0,1,1,0,0,0,1,
+0,0,0,0,1,0,1,1,0,1,1,1,0,0,0,0,1,1,1,0,0,1,1,1,0,0,0,0,1,1,0,0,1,0,1,0,0,0,0,1,
+0,0,1,0,0,0,0,1,1,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1,0,0,0,0,0,0,0,
+0,1,0,1,0,0,0,1,0,1,0,1,0,0,1,0,0,0,0,0,1,1,0,0,1,1,1,0,0,1,0,0,1,0,0,1,0,0,0,0,
+0,0,1,1,0,1,1,0,1,1,0,1,1,1,0,0,0,1,0,1,1,1,1,1,1,1,0,0,1,1,1,1,0,0,0,0,0,0,0,1,
+0,1,0,1,1,0,0,1,1,1,0,1,1,0,1,1,0,1,0,1,1,1,1,0,0,1,0,1,1,1,1,1,1,0,1,0,1,0,1,0,
+0,1,1,0,1,1,1,0,1,1,1,1,1,0,1,0,0,0,0,1,1,0,0,0,0,1,1,0,0,0,0,0,1,1,1,1,1,1,0,1,
+0,0,1,1,1,1,1,0,1,1,0,0,1,1,1,1,0,0,0,0,1,0,0,1,0,0,0,0,1,1,0,0,1,1,1,0,0,0,0,0,
+0,0,1,1,1,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,1,1,0,0,0,1,1,1,0,0,0,1,0,0,0,0,0,0,0,1,
+1,0,0,0,0,0,1,0,0,0,0,0,0,1,0,0,0,0,0,1,0,1,0,1,1,0,0,0,0,0,0,0,0,1,1,0,1,0,0,0,
+0,0,0,0,0,0,1,1,1,1,1,0,0,1,1,1,1,1,1,1,0,1,1,0,1,0,0,0,1,0,0,0,0,0,1,0,0,0,0,1,
+1,0,1,0,0,1,0,1,0,0,0,0,0,0,1,1,1,1,1,0,0,1,1,0,1,0,1,1,1,0,0,0,0,0,0,0,0,1,1,0,
+1,0,0,1,0,0,0,1,1,1,0,0,0,1,1,1,1,1,0,0,0,1,0,1,0,1,1,0,0,1,1,0,0,1,0,1,1,0,1,1,
+0,1,0,1,0,0,1,1,0,0,0,1,0,0,0,0,1,0,0,1,1,1,0,0,1,1,0,0,1,1,0,0,0,0,0,1,1,0,0,0,
+0,0,0,0,1,1,1,0,1,1,1,1,0,0,0,1,1,0,0,0,1,1,0,1,1,0,1,1,1,1,1,0,1,1,0,0,0,1,0,1,
+1,0,0,0,1,0,0,0,1,0,0,1,0,1,0,0,1,1,0,1,1,0,0,1,1,0,0,0,1,0,0,0,0,0,0,1,1,0,0,0,
+0,0,0,0,0,0,0,1,1,0,0,0,1,1,1,0,0,1,1,0,0,1,0,0,0,0,0,1,0,1,0,1,0,0,0,1,0,0,0,1,
+0,1,1,1,1,1,1,1,0,0,0,1,1,0,1,0,1,1,0,1,1,0,1,0,0,0,1,1,0,0,1,0,0,1,1,0,1,1,1,1,
+0,0,0,0,0,0,1,1,0,0,1,0,1,1,0,1,1,1,1,1,1,0,0,1,0,1,0,1,1,0,0,1,1,1,0,1,1,1,0,1,
+1,1,0,1,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,1,0,1,1,1,1,1,
+1,0,1,0,0,1,0 
+};
+
+constexpr float soa_leaf[] = 
+{
+3.8381900638341904e-02,8.9652568101882935e-01,2.6293140649795532e-01,
+1.0216630250215530e-01,1.2384019792079926e-01,6.9103831052780151e-01,
+1.9536970555782318e-01,2.1014410257339478e-01,8.2586747407913208e-01,
+1.0183759778738022e-01,8.2190579175949097e-01,1.9565549492835999e-01,
+2.2054070234298706e-01,7.3263257741928101e-02,5.9314841032028198e-01,
+1.8441149592399597e-01,4.0322139859199524e-01,8.0665212869644165e-01,
+2.5483280420303345e-01,6.0570698976516724e-01,2.7790638804435730e-01,
+2.8899800777435303e-01,7.6165872812271118e-01,3.4956431388854980e-01,
+8.1516528129577637e-01,2.8087830543518066e-01,6.0277748107910156e-01,
+7.6075017452239990e-01,4.4440358877182007e-01,1.4373120665550232e-01,
+5.3181701898574829e-01,5.4110521078109741e-01,2.1806870400905609e-01,
+1.1589600145816803e-01,2.3406790196895599e-01,5.9903818368911743e-01,
+1.8054960668087006e-01,2.1778939664363861e-01,8.0182367563247681e-01,
+1.1413549631834030e-01,1.2030939757823944e-01,6.1085307598114014e-01,
+2.0799599587917328e-01,3.3020541071891785e-01,7.5110942125320435e-01,
+2.7682220935821533e-01,1.6682930290699005e-01,5.8294767141342163e-01,
+1.5087880194187164e-01,4.3912279605865479e-01,7.6465952396392822e-01,
+2.6515561342239380e-01,2.2980530560016632e-01,5.4421657323837280e-01,
+3.6228439211845398e-01,2.6012599468231201e-01,7.2336578369140625e-01,
+3.8496789336204529e-01,2.9655128717422485e-01,5.4803091287612915e-01,
+4.1047701239585876e-01,7.2390240430831909e-01,2.7872839570045471e-01,
+5.6405162811279297e-01,5.9475481510162354e-01,3.3120200037956238e-01,
+6.6032320261001587e-01,4.6806651353836060e-01,2.0643380284309387e-01,
+5.2988511323928833e-01,5.2816027402877808e-01,1.9095499813556671e-01,
+1.3806459307670593e-01,5.4906368255615234e-01,1.2602810561656952e-01,
+2.3726630210876465e-01,5.2401661872863770e-01,1.7692160606384277e-01,
+1.9980649650096893e-01,2.2993800044059753e-01,7.3932111263275146e-01,
+1.5338400006294250e-01,2.0368589460849762e-01,5.8549159765243530e-01,
+2.0498959720134735e-01,3.2341998815536499e-01,7.3230141401290894e-01,
+3.0451491475105286e-01,2.9321339726448059e-01,5.6212961673736572e-01,
+3.6580368876457214e-01,2.7121558785438538e-01,7.2263348102569580e-01,
+4.4198378920555115e-01,3.6129769682884216e-01,5.2514511346817017e-01,
+3.6286169290542603e-01,1.6010950505733490e-01,7.0522767305374146e-01,
+1.3012880086898804e-01,1.7863239347934723e-01,5.5215299129486084e-01,
+3.4873831272125244e-01,2.6739910244941711e-01,6.6679191589355469e-01,
+3.4378638863563538e-01,5.9953361749649048e-01,3.4977179765701294e-01,
+2.1504899859428406e-01,6.2714362144470215e-01,2.5195419788360596e-01,
+8.2411892712116241e-02,5.9100568294525146e-01,3.7052011489868164e-01,
+1.5947279334068298e-01,5.9804809093475342e-01,2.8325080871582031e-01,
+7.8770911693572998e-01,1.5557409822940826e-01,5.2396571636199951e-01,
+6.6203659772872925e-01,1.4247199892997742e-01,4.4298338890075684e-01,
+1.5885409712791443e-01,2.3757989704608917e-01,5.2171349525451660e-01,
+1.9417250156402588e-01,6.2784057855606079e-01,3.7460449337959290e-01,
+3.8409221172332764e-01,3.1064930558204651e-01,5.5378472805023193e-01,
+3.4444490075111389e-01,2.7295520901679993e-01,6.4289510250091553e-01,
+1.6570860147476196e-01,2.2738510370254517e-01,6.9893497228622437e-01,
+1.5120740234851837e-01,5.5644702911376953e-01,1.6054420173168182e-01,
+1.8802590668201447e-01,3.1224989891052246e-01,7.1653962135314941e-01,
+3.8595831394195557e-01,2.4552939832210541e-01,5.6957101821899414e-01,
+2.7165201306343079e-01,2.2933620214462280e-01,7.2086298465728760e-01,
+7.8336209058761597e-01,5.5452322959899902e-01,2.5506898760795593e-01,
+1.8193900585174561e-01,3.5298758745193481e-01,6.5528190135955811e-01,
+5.4623097181320190e-01,1.3598430156707764e-01,5.4158151149749756e-01,
+1.1151199787855148e-01,5.8467197418212891e-01,2.5983488559722900e-01,
+1.6105690598487854e-01,5.3766787052154541e-01,1.7394550144672394e-01,
+1.9020730257034302e-01,3.2720080018043518e-01,6.3648408651351929e-01,
+6.9148528575897217e-01,4.3273261189460754e-01,6.9638431072235107e-01,
+8.5941338539123535e-01,9.7394466400146484e-02,4.5870301127433777e-01,
+2.5546258687973022e-01,3.3190909028053284e-01,5.9641027450561523e-01,
+2.6665949821472168e-01,1.8481859564781189e-01,6.2459707260131836e-01,
+5.3799271583557129e-01,5.1830291748046875e-01,2.1704199910163879e-01,
+2.6133841276168823e-01,2.7865320444107056e-01,5.9089881181716919e-01,
+2.6128691434860229e-01,5.9154129028320312e-01,3.4557819366455078e-01,
+1.5870520472526550e-01,1.2704110145568848e-01,5.9794288873672485e-01,
+1.9951049983501434e-01,7.3730701208114624e-01,2.9217371344566345e-01,
+1.9564199447631836e-01,5.6920468807220459e-01,1.8390649557113647e-01,
+2.1716670691967010e-01,2.7199891209602356e-01,7.1502441167831421e-01,
+1.8251839280128479e-01,5.6998378038406372e-01,3.5098528861999512e-01,
+4.0239268541336060e-01,3.6040958762168884e-01,7.2919952869415283e-01,
+6.4914900064468384e-01,5.5189931392669678e-01,2.6596811413764954e-01,
+6.7125129699707031e-01,1.6913780570030212e-01,4.3262779712677002e-01,
+3.4051001071929932e-01,5.5167931318283081e-01,3.3113878965377808e-01,
+1.6753150522708893e-01,3.6157518625259399e-01,6.4207828044891357e-01,
+2.9210790991783142e-01,5.6130319833755493e-01,3.3578601479530334e-01,
+6.9706428050994873e-01,3.5411500930786133e-01,6.1440062522888184e-01,
+5.5371809005737305e-01,5.3419572114944458e-01,2.7571049332618713e-01,
+2.4895210564136505e-01,1.7119289934635162e-01,5.5239528417587280e-01,
+8.2734507322311401e-01,3.7793910503387451e-01,5.4762518405914307e-01,
+3.2965409755706787e-01,6.0628837347030640e-01,2.4342200160026550e-01,
+3.8140949606895447e-01,5.5176162719726562e-01,3.7268930673599243e-01,
+1.2296640127897263e-01,7.2522747516632080e-01,4.9734550714492798e-01,
+5.3483128547668457e-01,5.8519148826599121e-01,4.3841668963432312e-01,
+2.2978340089321136e-01,6.2959378957748413e-01,4.1315990686416626e-01,
+1.6954590380191803e-01,5.1741302013397217e-01,5.9519391506910324e-02,
+1.3572479784488678e-01,2.9966288805007935e-01,5.7916951179504395e-01,
+6.5925890207290649e-01,5.3071719408035278e-01,3.7951210141181946e-01,
+3.1283149123191833e-01,5.5378931760787964e-01,1.0273090004920959e-01,
+4.6608591079711914e-01,7.1588581800460815e-01,4.7244489192962646e-01,
+5.9345688670873642e-02,7.0273017883300781e-01,4.7187310457229614e-01,
+5.8947342634201050e-01,4.8623558878898621e-01,5.2475881576538086e-01,
+6.9174712896347046e-01,4.6696171164512634e-01,2.3824059963226318e-01,
+2.7734708786010742e-01,7.4271547794342041e-01,2.4797350168228149e-01,
+2.1995030343532562e-01,5.8899897336959839e-01,2.5957161188125610e-01,
+1.8601259589195251e-01,4.1518709063529968e-01,7.1034741401672363e-01,
+2.5279670953750610e-01,1.3930009305477142e-01,5.2545148134231567e-01,
+2.4877290427684784e-01,2.7107000350952148e-01,6.6188377141952515e-01,
+3.8128259778022766e-01,2.3264320194721222e-01,5.2630108594894409e-01,
+4.2933320999145508e-01,1.6004039347171783e-01,6.7823147773742676e-01,
+6.6792941093444824e-01,4.5877051353454590e-01,7.1762388944625854e-01,
+1.8640750646591187e-01,5.5382597446441650e-01,3.1504508852958679e-01,
+2.8287911415100098e-01,5.8702242374420166e-01,3.7048238515853882e-01,
+4.2189309000968933e-01,6.6670012474060059e-01,2.4611820280551910e-01,
+3.5575878620147705e-01,1.6655470430850983e-01,5.2348488569259644e-01,
+2.8846129775047302e-01,2.9693400859832764e-01,6.0801112651824951e-01,
+4.5363900065422058e-01,5.1772642135620117e-01,1.4491820335388184e-01,
+7.6169097423553467e-01,2.1597060561180115e-01,5.4601877927780151e-01,
+3.9262959361076355e-01,3.4788811206817627e-01,5.5426627397537231e-01,
+6.0642760992050171e-01,5.6974071264266968e-01,1.7797139286994934e-01,
+5.3793722391128540e-01,3.3278390765190125e-01,5.4615312814712524e-01,
+2.1161609888076782e-01,6.6358232498168945e-01,4.3658590316772461e-01,
+5.3874248266220093e-01,1.6028049588203430e-01,5.3304588794708252e-01,
+2.9174768924713135e-01,5.6081241369247437e-01,1.9979810714721680e-01,
+3.9383140206336975e-01,5.7574361562728882e-01,4.2394569516181946e-01,
+7.6765531301498413e-01,5.3538662195205688e-01,2.5147768855094910e-01,
+2.3649039864540100e-01,2.3858639597892761e-01,5.4146647453308105e-01,
+6.5116149187088013e-01,6.0304141044616699e-01,3.5877010226249695e-01,
+5.4235929250717163e-01,2.3609539866447449e-01,5.4017579555511475e-01,
+2.8369858860969543e-01,1.8135160207748413e-01,5.4210460186004639e-01,
+3.9803659915924072e-01,2.6163849234580994e-01,5.2377301454544067e-01,
+2.4381080269813538e-01,5.3271460533142090e-01,8.1903767585754395e-01,
+4.6796938776969910e-01,5.5639117956161499e-01,4.3675860762596130e-01,
+6.6643488407135010e-01,5.5946111679077148e-01,3.0427119135856628e-01,
+2.1160189807415009e-01,6.9246852397918701e-01,3.0437770485877991e-01,
+3.1832858920097351e-01,5.4565590620040894e-01,2.5222688913345337e-01,
+2.9026180505752563e-01,3.1304559111595154e-01,6.8849372863769531e-01,
+2.9624658823013306e-01,3.0996260046958923e-01,5.7525151968002319e-01,
+3.9931958913803101e-01,4.8273721337318420e-01,7.5378328561782837e-01,
+2.6169270277023315e-01,3.1087028980255127e-01,5.4912358522415161e-01,
+3.2396918535232544e-01,6.5174108743667603e-01,4.1789120435714722e-01,
+6.7712038755416870e-01,4.1595110297203064e-01,5.6528919935226440e-01,
+7.6896011829376221e-01,2.8733238577842712e-01,4.9889329075813293e-01,
+5.4630082845687866e-01,3.6312350630760193e-01,5.5125522613525391e-01,
+1.1437670141458511e-01,2.8910788893699646e-01,5.4473417997360229e-01,
+3.0234318971633911e-01,2.1670059859752655e-01,5.2781528234481812e-01,
+3.2548341155052185e-01,5.2630507946014404e-01,7.5263291597366333e-01,
+7.4103301763534546e-01,6.8366098403930664e-01,4.5790711045265198e-01,
+7.4499362707138062e-01,4.8607799410820007e-01,2.3614570498466492e-01,
+1.4673270285129547e-01,2.3478199541568756e-01,5.3233772516250610e-01,
+1.4770570397377014e-01,3.4985339641571045e-01,5.8035618066787720e-01,
+5.2595508098602295e-01,4.3628829717636108e-01,6.2089228630065918e-01,
+2.0394609868526459e-01,5.1983588933944702e-01,1.3711960613727570e-01,
+6.3234299421310425e-01,4.7201630473136902e-01,6.5670871734619141e-01,
+6.0530602931976318e-01,5.0905191898345947e-01,3.1169331073760986e-01,
+3.4298041462898254e-01,3.8384029269218445e-01,5.7755982875823975e-01,
+2.1434690058231354e-01,5.9529662132263184e-01,3.7601581215858459e-01,
+5.6926268339157104e-01,5.7843041419982910e-01,3.9742821455001831e-01,
+1.8188929557800293e-01,6.8491101264953613e-01,4.3515840172767639e-01,
+2.7266609668731689e-01,4.2364311218261719e-01,5.8446758985519409e-01,
+3.3713209629058838e-01,5.2702218294143677e-01,8.0536508560180664e-01,
+2.8660181164741516e-01,5.8889460563659668e-01,3.8957870006561279e-01,
+2.1778169274330139e-01,1.7753170430660248e-01,5.6714701652526855e-01,
+4.6529620885848999e-01,4.7683110833168030e-01,5.6952387094497681e-01,
+3.3974018692970276e-01,6.2500411272048950e-01,4.2884120345115662e-01,
+5.3477621078491211e-01,4.1155189275741577e-01,5.6607538461685181e-01,
+7.8813230991363525e-01,3.6043399572372437e-01,5.5695050954818726e-01,
+5.4166442155838013e-01,5.5071568489074707e-01,3.8822770118713379e-01,
+3.1858509778976440e-01,5.5783641338348389e-01,3.2192459702491760e-01,
+7.0732331275939941e-01,5.5580157041549683e-01,4.6138420701026917e-01,
+6.8692898750305176e-01,4.8703178763389587e-01,2.6503708958625793e-01,
+5.2815151214599609e-01,6.0858821868896484e-01,4.3048679828643799e-01,
+5.4458320140838623e-01,5.3283357620239258e-01,2.3643240332603455e-01,
+2.6255810260772705e-01,1.5649929642677307e-01,6.7928832769393921e-01,
+3.4858089685440063e-01,3.6982551217079163e-01,5.9216582775115967e-01,
+3.0070841312408447e-01,3.6249229311943054e-01,7.0724260807037354e-01,
+4.4167020916938782e-01,3.0287081003189087e-01,5.4173761606216431e-01,
+4.3745040893554688e-01,4.4015899300575256e-01,7.5651907920837402e-01,
+2.3107869923114777e-01,3.5681959986686707e-01,5.7499992847442627e-01,
+3.5936889052391052e-01,6.3635677099227905e-01,2.3270289599895477e-01,
+7.0746237039566040e-01,5.7002371549606323e-01,3.5904508829116821e-01,
+2.8054410219192505e-01,4.1254189610481262e-01,6.1779958009719849e-01,
+5.4030781984329224e-01,5.6336438655853271e-01,3.3565390110015869e-01,
+7.1095108985900879e-01,4.9038508534431458e-01,2.8245830535888672e-01,
+1.8913699686527252e-01,5.3779661655426025e-01,3.1194949150085449e-01,
+7.2067582607269287e-01,1.8546679615974426e-01,4.9817329645156860e-01,
+2.6382741332054138e-01,6.8710672855377197e-01,4.7146868705749512e-01,
+1.5482850372791290e-01,4.3768429756164551e-01,6.3273680210113525e-01,
+3.1668141484260559e-01,6.1997437477111816e-01,4.3796870112419128e-01,
+1.4707140624523163e-01,5.8094590902328491e-01,3.4319490194320679e-01,
+3.9594578742980957e-01,3.2400250434875488e-01,5.6466472148895264e-01,
+4.2745280265808105e-01,3.3416679501533508e-01,6.6279602050781250e-01,
+4.0469279885292053e-01,5.4840582609176636e-01,3.5699409246444702e-01,
+1.8241509795188904e-01,7.9718202352523804e-01,5.0685691833496094e-01,
+2.1670070290565491e-01,6.5841788053512573e-01,4.6282431483268738e-01,
+2.0902520418167114e-01,5.1123052835464478e-01,7.7845758199691772e-01,
+5.1323592662811279e-01,1.7424149811267853e-01,5.2671480178833008e-01,
+3.4184479713439941e-01,5.6312650442123413e-01,2.0063939690589905e-01,
+6.2496489286422729e-01,3.2032281160354614e-01,5.1993298530578613e-01,
+6.1407059431076050e-01,6.5928959846496582e-01,3.7111249566078186e-01,
+2.9521119594573975e-01,3.3208039402961731e-01,5.5284148454666138e-01,
+1.7105500400066376e-01,3.3594349026679993e-01,5.6749051809310913e-01,
+4.7732418775558472e-01,8.0810451507568359e-01,4.8458281159400940e-01,
+6.7840021848678589e-01,5.5146390199661255e-01,3.6423599720001221e-01,
+1.2544350326061249e-01,4.4248789548873901e-01,5.7284617424011230e-01,
+2.8050419688224792e-01,1.9509120285511017e-01,5.6529247760772705e-01,
+6.1664837598800659e-01,4.5265799760818481e-01,5.9444868564605713e-01,
+4.0869420766830444e-01,2.7935269474983215e-01,6.4449352025985718e-01,
+5.6716561317443848e-01,5.3118121623992920e-01,2.6143568754196167e-01,
+2.9967740178108215e-01,4.4899430871009827e-01,6.8882799148559570e-01,
+5.1968640089035034e-01,3.4669959545135498e-01,5.5335879325866699e-01,
+3.0814400315284729e-01,2.6938709616661072e-01,5.5444890260696411e-01,
+5.5878478288650513e-01,4.6721130609512329e-01,6.0908252000808716e-01,
+9.0275919437408447e-01,4.7198349237442017e-01,2.1969200670719147e-01,
+6.2730091810226440e-01,4.8392179608345032e-01,6.9090622663497925e-01,
+1.7384879291057587e-01,6.3041448593139648e-01,4.4743019342422485e-01,
+5.3025382757186890e-01,5.3383970260620117e-01,3.7968829274177551e-01,
+3.2698369026184082e-01,4.5548120141029358e-01,6.3583481311798096e-01,
+2.8097251057624817e-01,3.1198260188102722e-01,7.0903062820434570e-01,
+2.9819479584693909e-01,3.0205601453781128e-01,5.8088111877441406e-01,
+3.7381029129028320e-01,2.1631260216236115e-01,6.6192537546157837e-01,
+2.9104039072990417e-01,5.5786228179931641e-01,3.3666279911994934e-01,
+4.0724259614944458e-01,6.8595957756042480e-01,3.1054618954658508e-01,
+3.3373329043388367e-01,3.3709588646888733e-01,5.4512107372283936e-01,
+2.6256701350212097e-01,6.0504627227783203e-01,3.2324150204658508e-01,
+3.2626131176948547e-01,5.8173078298568726e-01,4.1643899679183960e-01,
+7.0953989028930664e-01,5.2928757667541504e-01,2.5413888692855835e-01,
+4.0853410959243774e-01,5.2632361650466919e-01,3.0032029747962952e-01,
+4.0292051434516907e-01,3.5213199257850647e-01,6.6640049219131470e-01,
+4.5935660600662231e-01,1.4747560024261475e-01,5.1786321401596069e-01,
+1.8372780084609985e-01,8.0826580524444580e-01,5.1666879653930664e-01,
+4.7980138659477234e-01,3.3462959527969360e-01,5.4444491863250732e-01,
+3.5890269279479980e-01,5.9831297397613525e-01,2.9839640855789185e-01,
+6.1632239818572998e-01,5.2171301841735840e-01,2.0541590452194214e-01,
+3.4466689825057983e-01,5.5974847078323364e-01,2.6737868785858154e-01,
+6.9002681970596313e-01,4.4866389036178589e-01,5.5087852478027344e-01,
+2.0483230054378510e-01,1.2549529969692230e-01,5.0603562593460083e-01,
+6.7633062601089478e-02,5.6607007980346680e-01,4.2922011017799377e-01,
+7.1364039182662964e-01,4.3388760089874268e-01,7.0608752965927124e-01,
+5.2686852216720581e-01,2.5805801153182983e-01,5.4069608449935913e-01,
+1.9050540030002594e-01,2.5518929958343506e-01,5.3390771150588989e-01,
+4.6933099627494812e-01,5.2619642019271851e-01,3.1454348564147949e-01,
+1.7568530142307281e-01,7.7747297286987305e-01,5.1242929697036743e-01,
+5.2845597267150879e-01,3.8878020644187927e-01,5.5011737346649170e-01,
+2.4898290634155273e-01,4.2621460556983948e-01,5.9350621700286865e-01,
+2.5452229380607605e-01,4.8519900441169739e-01,7.0214188098907471e-01,
+7.1432709693908691e-01,5.1757252216339111e-01,2.8086438775062561e-01,
+5.1732218265533447e-01,4.5028659701347351e-01,5.7956951856613159e-01,
+1.9151160120964050e-01,6.5024322271347046e-01,4.5593151450157166e-01,
+5.3762471675872803e-01,7.0562332868576050e-01,4.9146059155464172e-01,
+2.6787060499191284e-01,4.4108539819717407e-01,6.3683199882507324e-01,
+2.7635639905929565e-01,4.8673018813133240e-01,6.7287760972976685e-01,
+4.0705141425132751e-01,2.6049488782882690e-01,6.1548602581024170e-01,
+5.7319998741149902e-01,4.9733769893646240e-01,7.3870068788528442e-01,
+6.9847512245178223e-01,2.6911678910255432e-01,4.7417798638343811e-01,
+3.5510140657424927e-01,5.2446138858795166e-01,2.0966500043869019e-01,
+4.1310968995094299e-01,4.6202930808067322e-01,6.7754101753234863e-01,
+5.6282752752304077e-01,5.5768597126007080e-01,4.5776501297950745e-01,
+4.9592560529708862e-01,5.6256359815597534e-01,2.0471079647541046e-01,
+2.2421480715274811e-01,4.5333439111709595e-01,6.1999320983886719e-01,
+6.6627562046051025e-01,5.0079882144927979e-01,2.3849929869174957e-01,
+3.7535008788108826e-01,5.1771712303161621e-01,1.6344930231571198e-01,
+2.5873818993568420e-01,6.2995338439941406e-01,4.6587899327278137e-01,
+3.3540761470794678e-01,2.1541289985179901e-01,5.2357137203216553e-01,
+6.4688968658447266e-01,2.8930890560150146e-01,5.2548158168792725e-01,
+3.2997110486030579e-01,7.0415931940078735e-01,3.2354658842086792e-01,
+4.9611708521842957e-01,7.1280431747436523e-01,4.9611708521842957e-01,
+3.2084721326828003e-01,6.6139167547225952e-01,3.5513329505920410e-01,
+3.7101349234580994e-01,5.7463937997817993e-01,3.8948801159858704e-01,
+3.0541029572486877e-01,2.8855779767036438e-01,6.4877450466156006e-01,
+3.1744310259819031e-01,3.8209199905395508e-01,5.2328932285308838e-01,
+3.6227950453758240e-01,6.5389591455459595e-01,4.0036809444427490e-01,
+3.8931730389595032e-01,5.6145328283309937e-01,3.6876440048217773e-01,
+6.4430278539657593e-01,3.3808529376983643e-01,5.8246481418609619e-01,
+3.9387670159339905e-01,3.4279710054397583e-01,5.5156987905502319e-01,
+3.8035380840301514e-01,6.4395052194595337e-01,4.1683459281921387e-01,
+6.6546010971069336e-01,4.1827228665351868e-01,5.6047242879867554e-01,
+6.5868628025054932e-01,3.2449120283126831e-01,4.8828700184822083e-01,
+2.2290790081024170e-01,4.1072851419448853e-01,5.7475912570953369e-01,
+2.0657970011234283e-01,4.9264231324195862e-01,7.1394848823547363e-01,
+6.7800867557525635e-01,5.2149301767349243e-01,1.1439959704875946e-01,
+1.9375260174274445e-01,3.8125771284103394e-01,5.5141878128051758e-01,
+2.4740239977836609e-01,4.8177829384803772e-01,5.9230798482894897e-01,
+7.5082087516784668e-01,2.8798109292984009e-01,5.1996952295303345e-01,
+3.0449101328849792e-01,4.0634828805923462e-01,5.6765627861022949e-01,
+9.6717558801174164e-02,4.5378330349922180e-01,6.1153751611709595e-01,
+4.8077508807182312e-01,3.4037950634956360e-01,5.2555292844772339e-01,
+7.5058358907699585e-01,5.4554468393325806e-01,3.2260689139366150e-01,
+2.3118489980697632e-01,5.2710479497909546e-01,1.4699299633502960e-01,
+3.6781388521194458e-01,7.1319299936294556e-01,4.9938669800758362e-01,
+5.3120541572570801e-01,4.6893781423568726e-01,5.7140219211578369e-01,
+6.9487977027893066e-01,4.0045049786567688e-01,5.8748817443847656e-01,
+5.3295719623565674e-01,5.5458492040634155e-01,3.4495818614959717e-01,
+1.2171830236911774e-01,5.3750497102737427e-01,3.4156250953674316e-01,
+4.1951790452003479e-01,3.4607538580894470e-01,5.1558601856231689e-01,
+5.8065678924322128e-02,1.4734490215778351e-01,5.5593782663345337e-01,
+5.4777151346206665e-01,4.2077910900115967e-01,5.6218808889389038e-01,
+6.4471471309661865e-01,2.7651271224021912e-01,4.8885959386825562e-01,
+5.2646911144256592e-01,5.7853102684020996e-01,4.2911028861999512e-01,
+3.4554108977317810e-01,6.0269188880920410e-01,4.1438931226730347e-01,
+6.0952937602996826e-01,6.1082822084426880e-01,4.7077208757400513e-01,
+3.2443669438362122e-01,3.8307571411132812e-01,5.7343262434005737e-01,
+6.6109192371368408e-01,6.1393070220947266e-01,4.6861499547958374e-01,
+3.5200220346450806e-01,2.5787541270256042e-01,5.4672420024871826e-01,
+4.8201468586921692e-01,5.7101500034332275e-01,4.8319110274314880e-01,
+6.1336791515350342e-01,4.9285829067230225e-01,2.5813090801239014e-01,
+4.4711241126060486e-01,5.1610249280929565e-01,3.3165338635444641e-01,
+9.2606216669082642e-02,8.5221147537231445e-01,5.1379078626632690e-01,
+5.4590600728988647e-01,5.2193528413772583e-01,1.9271859526634216e-01,
+1.9160020351409912e-01,5.2315711975097656e-01,3.5353401303291321e-01,
+6.4641010761260986e-01,7.3830378055572510e-01,4.9647438526153564e-01,
+3.6117058992385864e-01,3.4219071269035339e-01,5.9435117244720459e-01,
+4.5501041412353516e-01,4.7168621420860291e-01,6.6561907529830933e-01,
+4.5927169919013977e-01,6.5634012222290039e-01,1.2588350474834442e-01,
+5.2395021915435791e-01,8.0158519744873047e-01,5.0079578161239624e-01,
+2.2748200595378876e-01,4.3519461154937744e-01,5.8676278591156006e-01,
+4.4650518894195557e-01,4.5444580912590027e-01,5.7071107625961304e-01,
+6.5276437997817993e-01,3.4447279572486877e-01,5.3246361017227173e-01,
+3.1087881326675415e-01,3.1332370638847351e-01,6.6458672285079956e-01,
+2.6401311159133911e-01,5.6472051143646240e-01,3.4853729605674744e-01,
+3.1406548619270325e-01,6.4891988039016724e-01,3.8877290487289429e-01,
+7.2165298461914062e-01,1.6531379520893097e-01,5.1398259401321411e-01,
+3.1406199932098389e-01,5.9936988353729248e-01,3.3173981308937073e-01,
+2.6529380679130554e-01,1.8495689332485199e-01,5.3139579296112061e-01,
+4.0400999784469604e-01,6.1581897735595703e-01,1.7864869534969330e-01,
+4.5110899209976196e-01,4.5282199978828430e-01,5.9722828865051270e-01,
+2.5338920950889587e-01,3.4104120731353760e-01,5.9236437082290649e-01,
+6.9580441713333130e-01,3.8510841131210327e-01,5.4081892967224121e-01,
+2.0093089342117310e-01,6.2953931093215942e-01,4.3950408697128296e-01,
+2.4052999913692474e-01,5.4501742124557495e-01,3.7823578715324402e-01,
+3.0338969826698303e-01,4.6337789297103882e-01,6.3359522819519043e-01,
+6.5988260507583618e-01,6.6216969490051270e-01,4.7552469372749329e-01,
+2.8012010455131531e-01,3.8294890522956848e-01,5.6236267089843750e-01,
+4.5363429188728333e-01,5.6081390380859375e-01,4.2657798528671265e-01,
+2.6370918750762939e-01,4.1707509756088257e-01,5.9329879283905029e-01,
+5.2567642927169800e-01,6.6326218843460083e-01,4.8925888538360596e-01,
+1.4997789263725281e-01,4.2333200573921204e-01,5.7560402154922485e-01,
+5.2888268232345581e-01,4.5240178704261780e-01,5.6041252613067627e-01,
+5.5782741308212280e-01,3.3230578899383545e-01,5.5587881803512573e-01,
+3.6539471149444580e-01,1.9245339930057526e-01,5.3136497735977173e-01,
+2.0277309417724609e-01,7.6360601186752319e-01,5.1408261060714722e-01,
+5.2529758214950562e-01,2.6329371333122253e-01,5.3286892175674438e-01,
+2.4160879850387573e-01,3.9365449547767639e-01,5.4787421226501465e-01,
+4.7881990671157837e-01,3.6316120624542236e-01,5.2883160114288330e-01,
+6.9311392307281494e-01,4.5201000571250916e-01,6.8550550937652588e-01,
+5.3004240989685059e-01,5.6068921089172363e-01,4.2306229472160339e-01,
+3.2472288608551025e-01,1.9856959581375122e-01,5.3498727083206177e-01,
+4.2075088620185852e-01,5.1534587144851685e-01,3.1181010603904724e-01,
+3.2745069265365601e-01,5.9530782699584961e-01,4.2255210876464844e-01,
+7.2111797332763672e-01,4.9365919828414917e-01,7.0302772521972656e-01,
+1.4255349338054657e-01,6.0593318939208984e-01,4.3939951062202454e-01,
+4.4888499379158020e-01,4.2565500736236572e-01,5.7954382896423340e-01,
+4.2460399866104126e-01,4.9580091238021851e-01,6.7594307661056519e-01,
+5.4234808683395386e-01,3.6365428566932678e-01,5.4643487930297852e-01,
+2.5488188862800598e-01,6.5876567363739014e-01,4.5328021049499512e-01,
+3.8227710127830505e-01,3.0773219466209412e-01,5.2441328763961792e-01,
+1.0338629782199860e-01,5.5547451972961426e-01,3.2213169336318970e-01,
+4.6823790669441223e-01,5.3730702400207520e-01,3.8006669282913208e-01,
+1.7992070317268372e-01,5.0950688123703003e-01,7.5446051359176636e-01,
+5.6286448240280151e-01,4.8016890883445740e-01,5.8021020889282227e-01,
+1.7427450418472290e-01,3.4665969014167786e-01,5.1071548461914062e-01,
+5.3260862827301025e-01,6.3427752256393433e-01,4.9926930665969849e-01,
+3.4334290027618408e-01,1.8681369721889496e-01,5.2154648303985596e-01,
+6.2293052673339844e-01,4.9357721209526062e-01,7.2179448604583740e-01,
+5.0079762935638428e-01,6.0241490602493286e-01,2.3295080661773682e-01,
+4.5104169845581055e-01,5.1419967412948608e-01,2.8602918982505798e-01,
+4.7049251198768616e-01,4.1798511147499084e-01,6.7266470193862915e-01,
+5.8098018169403076e-01,6.0747838020324707e-01,4.5240598917007446e-01,
+3.3835199475288391e-01,5.6969100236892700e-01,3.9708450436592102e-01,
+1.5027019381523132e-01,7.5736707448959351e-01,4.9364370107650757e-01,
+3.3909329771995544e-01,5.0250971317291260e-01,7.4220830202102661e-01,
+5.1973718404769897e-01,9.7346916794776917e-02,5.1857399940490723e-01,
+3.6493501067161560e-01,5.6192791461944580e-01,3.7602970004081726e-01,
+6.3284450769424438e-01,4.9360820651054382e-01,7.4265247583389282e-01,
+1.3893499970436096e-01,5.0919622182846069e-01,3.4826481342315674e-01,
+6.0363167524337769e-01,2.3191730678081512e-01,5.1166528463363647e-01,
+6.5550220012664795e-01,1.3260710239410400e-01,4.6740341186523438e-01,
+5.1820272207260132e-01,6.3182431459426880e-01,4.8255190253257751e-01,
+2.9186710715293884e-01,5.6213712692260742e-01,4.2492130398750305e-01,
+4.8137450218200684e-01,5.1840060949325562e-01,2.0512230694293976e-01,
+1.1799219995737076e-01,4.9878111481666565e-01,6.9737559556961060e-01,
+5.3398311138153076e-01,5.0332891941070557e-01,6.8519067764282227e-01,
+3.0028221011161804e-01,4.5930838584899902e-01,6.4400452375411987e-01,
+5.3112912178039551e-01,4.7291061282157898e-01,5.7214611768722534e-01,
+3.6623328924179077e-01,5.3619897365570068e-01,3.0086329579353333e-01,
+3.4223890304565430e-01,7.7034580707550049e-01,4.5163908600807190e-01,
+3.2563421130180359e-01,3.4065559506416321e-01,5.8970272541046143e-01,
+4.3065789341926575e-01,7.1495872735977173e-01,4.3456849455833435e-01,
+3.2959741353988647e-01,5.8456200361251831e-01,3.5266879200935364e-01,
+4.0819549560546875e-01,4.2031130194664001e-01,6.6341269016265869e-01,
+3.9424669742584229e-01,2.2940720617771149e-01,5.2389609813690186e-01,
+3.0260318517684937e-01,6.0321962833404541e-01,3.4124588966369629e-01,
+7.3062407970428467e-01,3.5993251204490662e-01,5.2343809604644775e-01,
+3.4937581419944763e-01,2.7461090683937073e-01,5.6265860795974731e-01,
+5.2822262048721313e-01,4.5220491290092468e-01,6.0543018579483032e-01,
+3.3068621158599854e-01,1.4550000429153442e-01,5.3849279880523682e-01,
+4.8141559958457947e-01,3.5637411475181580e-01,5.4051452875137329e-01,
+6.9577431678771973e-01,5.0508928298950195e-01,2.3169949650764465e-01,
+6.0185819864273071e-01,4.7550821304321289e-01,5.5852377414703369e-01,
+2.2824659943580627e-01,4.0405881404876709e-01,5.6501698493957520e-01,
+5.2677392959594727e-01,6.7940497398376465e-01,4.7970339655876160e-01,
+8.8425733149051666e-02,4.0207880735397339e-01,5.4573321342468262e-01,
+5.2676129341125488e-01,4.8060521483421326e-01,6.3943648338317871e-01,
+1.7248100042343140e-01,4.4798240065574646e-01,6.3100087642669678e-01,
+5.9481692314147949e-01,4.8541748523712158e-01,5.3093612194061279e-01,
+3.1836318969726562e-01,3.0849760770797729e-01,5.3520262241363525e-01,
+6.1153268814086914e-01,4.9516460299491882e-01,7.0613312721252441e-01,
+3.7542209029197693e-01,4.1155171394348145e-01,5.8894449472427368e-01,
+9.5610566437244415e-02,5.3005087375640869e-01,3.9618980884552002e-01,
+6.4818692207336426e-01,5.1104402542114258e-01,3.1215190887451172e-01,
+4.8014289140701294e-01,5.4297101497650146e-01,4.1623631119728088e-01,
+7.3293352127075195e-01,5.3568720817565918e-01,3.4555470943450928e-01,
+3.6550220847129822e-01,3.7767601013183594e-01,5.3917747735977173e-01,
+4.0393048524856567e-01,6.9504439830780029e-01,4.9811169505119324e-01,
+5.2967327833175659e-01,5.8426398038864136e-01,4.7895029187202454e-01,
+6.0921788215637207e-01,6.7217427492141724e-01,4.0668940544128418e-01,
+3.5850879549980164e-01,5.3711581230163574e-01,4.0335071086883545e-01,
+1.5475720167160034e-01,5.4338437318801880e-01,8.4292672574520111e-02,
+4.8600539565086365e-01,1.8330100178718567e-01,5.2075541019439697e-01,
+7.0482409000396729e-01,4.1705870628356934e-01,5.8651638031005859e-01,
+5.3079181909561157e-01,5.5224531888961792e-01,3.5071650147438049e-01,
+3.0426511168479919e-01,5.3393232822418213e-01,2.8062361478805542e-01,
+6.4101332426071167e-01,5.6208711862564087e-01,4.3903189897537231e-01,
+6.4455568790435791e-01,2.0027139782905579e-01,4.6246650815010071e-01,
+5.2632009983062744e-01,5.8739811182022095e-01,4.8366001248359680e-01,
+1.5661309659481049e-01,4.2701789736747742e-01,5.8066600561141968e-01,
+6.2158662080764771e-01,5.5766427516937256e-01,4.1220021247863770e-01,
+1.5367099642753601e-01,6.3442689180374146e-01,4.5074120163917542e-01,
+5.4579752683639526e-01,5.4016572237014771e-01,3.8907998800277710e-01,
+3.5556110739707947e-01,5.8367502689361572e-01,4.2743161320686340e-01,
+5.8604401350021362e-01,4.4989579916000366e-01,5.4981988668441772e-01,
+4.1009929776191711e-01,6.7013788223266602e-01,4.3530011177062988e-01,
+5.3911769390106201e-01,5.5040502548217773e-01,3.9909350872039795e-01,
+3.5929331183433533e-01,4.0341728925704956e-01,5.8060771226882935e-01,
+5.4123848676681519e-01,4.9449229240417480e-01,5.5894362926483154e-01,
+5.8092182874679565e-01,4.7469571232795715e-01,2.8458958864212036e-01,
+2.4144110083580017e-01,5.1957648992538452e-01,1.0300920158624649e-01,
+1.8146389722824097e-01,4.2460718750953674e-01,5.7079732418060303e-01,
+6.1433231830596924e-01,5.2056711912155151e-01,4.2204418778419495e-01,
+3.1825920939445496e-01,5.7104682922363281e-01,4.2260938882827759e-01,
+5.1628297567367554e-01,2.6662889122962952e-01,5.2146798372268677e-01,
+3.9817610383033752e-01,3.3227631449699402e-01,5.7058340311050415e-01,
+6.6365581750869751e-01,5.5055677890777588e-01,4.4206619262695312e-01,
+5.9599381685256958e-01,5.3695940971374512e-01,3.7443399429321289e-01,
+4.1035950183868408e-01,5.1775068044662476e-01,1.8781000375747681e-01,
+2.3528920114040375e-01,1.7087510228157043e-01,5.4249739646911621e-01,
+5.8365309238433838e-01,5.1174330711364746e-01,1.8659310042858124e-01,
+5.1086932420730591e-01,4.7754910588264465e-01,2.4398539960384369e-01,
+3.3496499061584473e-01,4.5183679461479187e-01,7.2893542051315308e-01,
+2.9508009552955627e-01,5.6690549850463867e-01,2.8308510780334473e-01,
+4.0905779600143433e-01,6.9514942169189453e-01,4.6378681063652039e-01,
+3.1676751375198364e-01,3.3167061209678650e-01,5.3963977098464966e-01,
+2.6005738973617554e-01,7.4842947721481323e-01,5.0731921195983887e-01,
+3.9520108699798584e-01,5.8802747726440430e-01,3.5521200299263000e-01,
+2.4348780512809753e-01,3.1955629587173462e-01,5.5854547023773193e-01,
+4.8452898859977722e-01,3.8011810183525085e-01,5.3585118055343628e-01,
+4.3563291430473328e-01,2.6130661368370056e-01,6.1554962396621704e-01,
+5.9420621395111084e-01,4.9454280734062195e-01,7.3848551511764526e-01,
+2.2144819796085358e-01,3.6009770631790161e-01,5.2985501289367676e-01,
+5.7765662670135498e-01,6.9344568252563477e-01,4.8272070288658142e-01,
+3.2166770100593567e-01,3.9625000953674316e-01,5.6803637742996216e-01,
+7.5674182176589966e-01,6.5235567092895508e-01,5.0270539522171021e-01,
+2.5387701392173767e-01,4.3872770667076111e-01,6.1776322126388550e-01,
+5.2011400461196899e-01,4.6479099988937378e-01,6.1842548847198486e-01,
+3.0409941077232361e-01,4.5188081264495850e-01,6.2457829713821411e-01,
+2.7889358997344971e-01,4.6985000371932983e-01,6.5024542808532715e-01,
+1.8051710724830627e-01,3.2080689072608948e-01,5.5220228433609009e-01,
+6.4369338750839233e-01,5.6767052412033081e-01,4.5091038942337036e-01,
+3.1221461296081543e-01,2.9651939868927002e-01,5.2304947376251221e-01,
+5.4647117853164673e-01,4.6185028553009033e-01,5.6795489788055420e-01,
+5.4308801889419556e-01,5.4336231946945190e-01,3.3852210640907288e-01,
+5.2655947208404541e-01,4.8572158813476562e-01,6.8151241540908813e-01,
+2.8321608901023865e-01,3.9668309688568115e-01,5.5124807357788086e-01,
+6.7846202850341797e-01,3.9065030217170715e-01,5.4572027921676636e-01,
+3.6402040719985962e-01,5.8297240734100342e-01,4.1949799656867981e-01,
+4.6067029237747192e-01,3.2614830136299133e-01,5.2360808849334717e-01,
+7.0221120119094849e-01,2.8704708814620972e-01,5.0764769315719604e-01,
+4.7095209360122681e-01,4.7082918882369995e-01,6.1698418855667114e-01,
+3.1142529845237732e-01,1.8514350056648254e-01,5.5048149824142456e-01,
+4.9373480677604675e-01,6.1529481410980225e-01,4.7354999184608459e-01,
+6.5105718374252319e-01,4.0883418917655945e-01,5.6841522455215454e-01,
+3.0258288979530334e-01,5.2325028181076050e-01,2.0176209509372711e-01,
+6.4284259080886841e-01,4.3288651108741760e-01,6.4205098152160645e-01,
+5.2540659904479980e-01,2.4909840524196625e-01,5.2876192331314087e-01,
+3.3297958970069885e-01,3.5983449220657349e-01,5.4983407258987427e-01,
+4.8187050223350525e-01,5.2663302421569824e-01,3.1057891249656677e-01,
+3.9952918887138367e-01,3.2284379005432129e-01,5.8192151784896851e-01,
+8.0260711908340454e-01,3.8756170868873596e-01,5.4665708541870117e-01,
+4.3720579147338867e-01,1.1265510320663452e-01,6.3954162597656250e-01,
+5.4239892959594727e-01,4.9792730808258057e-01,6.0422360897064209e-01,
+3.4910920262336731e-01,4.1950678825378418e-01,5.7759660482406616e-01,
+4.8859870433807373e-01,5.4444682598114014e-01,4.4209951162338257e-01,
+6.6997921466827393e-01,4.4786059856414795e-01,6.5648937225341797e-01,
+5.5118787288665771e-01,4.0174451470375061e-01,5.4055362939834595e-01,
+2.2943930327892303e-01,5.1779001951217651e-01,3.5677561163902283e-01,
+5.5646997690200806e-01,3.6276981234550476e-01,5.5724138021469116e-01,
+6.7849111557006836e-01,4.1212528944015503e-01,6.0722357034683228e-01,
+5.4597669839859009e-01,5.2767068147659302e-01,2.3749159276485443e-01,
+7.2492793202400208e-02,4.6263459324836731e-01,8.2089632749557495e-01,
+5.2087318897247314e-01,5.4844141006469727e-01,4.2300349473953247e-01,
+2.7805531024932861e-01,5.4038310050964355e-01,3.7909889221191406e-01,
+4.7983360290527344e-01,3.7669500708580017e-01,5.4292291402816772e-01,
+6.2071627378463745e-01,3.3579450845718384e-01,5.1426321268081665e-01,
+5.3446400165557861e-01,5.1596081256866455e-01,2.5618231296539307e-01,
+5.1230919361114502e-01,6.0176461935043335e-01,3.1093719601631165e-01,
+2.7122870087623596e-01,5.4424422979354858e-01,4.0288880467414856e-01,
+4.7360658645629883e-01,7.4514347314834595e-01,3.4879919886589050e-01,
+2.2903330624103546e-01,5.5178898572921753e-01,4.3931490182876587e-01,
+9.0167902410030365e-02,6.2335401773452759e-01,4.7894591093063354e-01,
+5.4896962642669678e-01,5.5798089504241943e-01,4.3758779764175415e-01,
+3.5791561007499695e-01,5.6136602163314819e-01,3.9390438795089722e-01,
+3.9015549421310425e-01,4.5286190509796143e-01,5.4413431882858276e-01,
+5.8031117916107178e-01,3.3368501067161560e-01,5.5048561096191406e-01,
+6.1247891187667847e-01,8.7271630764007568e-02,5.2045881748199463e-01,
+3.9353290200233459e-01,5.9188538789749146e-01,4.1196140646934509e-01,
+4.8396238684654236e-01,4.7873649001121521e-01,6.3606631755828857e-01,
+4.2311170697212219e-01,4.2745891213417053e-01,6.0940480232238770e-01,
+4.2719879746437073e-01,4.4971078634262085e-01,5.5491220951080322e-01,
+5.4771959781646729e-01,2.8829228878021240e-01,5.6151270866394043e-01,
+3.3388701081275940e-01,3.0993521213531494e-01,6.6774922609329224e-01,
+4.3690490722656250e-01,4.3017241358757019e-01,6.1538851261138916e-01,
+3.3873260021209717e-01,6.2487137317657471e-01,3.5941308736801147e-01,
+3.8684248924255371e-01,4.4093450903892517e-01,5.4764741659164429e-01,
+3.2601711153984070e-01,4.1113489866256714e-01,6.0881638526916504e-01,
+4.2694228887557983e-01,4.3064668774604797e-01,5.8105140924453735e-01,
+3.6691430211067200e-01,4.6106639504432678e-01,6.2905901670455933e-01,
+5.3286898136138916e-01,5.2132612466812134e-01,3.2312199473381042e-01,
+3.5685700178146362e-01,3.4406611323356628e-01,5.6256049871444702e-01,
+4.5611730217933655e-01,5.3213518857955933e-01,3.6741548776626587e-01,
+2.0293539762496948e-01,5.5630332231521606e-01,2.6188498735427856e-01,
+6.0621947050094604e-01,5.9507638216018677e-01,4.5451170206069946e-01,
+6.4355242252349854e-01,3.5207340121269226e-01,5.1797789335250854e-01,
+5.3266882896423340e-01,3.4919810295104980e-01,5.4292368888854980e-01,
+2.0840230584144592e-01,3.9652720093727112e-01,5.4254537820816040e-01,
+5.3064119815826416e-01,5.4503858089447021e-01,4.2566969990730286e-01,
+5.9686112403869629e-01,4.7581401467323303e-01,3.1509441137313843e-01,
+4.8477488756179810e-01,5.4263162612915039e-01,4.3383410573005676e-01,
+4.2875099182128906e-01,6.3451850414276123e-01,4.1018518805503845e-01,
+4.8491048812866211e-01,4.1463369131088257e-01,5.4712641239166260e-01,
+2.8771838545799255e-01,5.1019018888473511e-01,7.2169512510299683e-01,
+5.2761822938919067e-01,6.6184598207473755e-01,4.8416310548782349e-01,
+1.8741579353809357e-01,4.6169349551200867e-01,7.0889657735824585e-01,
+3.0019798874855042e-01,4.5618081092834473e-01,5.6107878684997559e-01,
+2.3417009413242340e-01,5.6722861528396606e-01,4.1999641060829163e-01,
+6.2074822187423706e-01,5.3949588537216187e-01,3.8238629698753357e-01,
+7.0616811513900757e-01,3.0655130743980408e-01,4.8273730278015137e-01,
+5.1931220293045044e-01,4.6424350142478943e-01,5.8076947927474976e-01,
+2.9498139023780823e-01,4.5858868956565857e-01,6.0223537683486938e-01,
+4.3578410148620605e-01,4.5615398883819580e-01,6.1190617084503174e-01,
+6.5371441841125488e-01,3.4747231006622314e-01,5.3369677066802979e-01,
+3.7316760420799255e-01,5.7172292470932007e-01,4.7933790087699890e-01,
+4.0564361214637756e-01,6.1740481853485107e-01,4.4717541337013245e-01,
+6.1796981096267700e-01,2.2854949533939362e-01,5.2495658397674561e-01,
+1.7849500477313995e-01,7.2619527578353882e-01,4.5503988862037659e-01,
+5.2529907226562500e-01,5.4452222585678101e-01,3.2722181081771851e-01,
+7.0138317346572876e-01,4.9659439921379089e-01,3.2955980300903320e-01,
+5.3626418113708496e-01,6.4961087703704834e-01,4.7571370005607605e-01,
+2.3437410593032837e-01,4.6201181411743164e-01,6.8984192609786987e-01,
+2.1007199585437775e-01,4.6215289831161499e-01,5.7971358299255371e-01,
+2.1182620525360107e-01,4.8846149444580078e-01,6.8724989891052246e-01,
+5.2751058340072632e-01,4.1723209619522095e-01,5.4911398887634277e-01,
+2.1248769760131836e-01,5.4952150583267212e-01,4.2077958583831787e-01,
+3.3219420909881592e-01,2.2129580378532410e-01,5.2326530218124390e-01,
+1.1017960309982300e-01,3.8101008534431458e-01,5.6172919273376465e-01,
+5.7950568199157715e-01,6.3922691345214844e-01,4.7114381194114685e-01,
+3.4098839759826660e-01,3.6593028903007507e-01,5.3881710767745972e-01,
+7.1703857183456421e-01,6.3868182897567749e-01,4.6813040971755981e-01,
+3.2637009024620056e-01,5.7678192853927612e-01,4.3464180827140808e-01,
+4.6978279948234558e-01,4.4373890757560730e-01,6.0616689920425415e-01,
+6.5585112571716309e-01,3.3763539791107178e-01,5.0916552543640137e-01,
+2.9478839039802551e-01,5.5569821596145630e-01,4.6654561161994934e-01,
+7.3383557796478271e-01,3.5438719391822815e-01,5.2851498126983643e-01,
+1.9444419443607330e-01,9.9049292504787445e-02,5.1398539543151855e-01,
+5.8271098136901855e-01,3.4414279460906982e-01,5.1488387584686279e-01,
+5.2079981565475464e-01,4.8355031013488770e-01,6.3222199678421021e-01,
+1.3645380735397339e-01,4.5373201370239258e-01,6.0667508840560913e-01,
+4.9683749675750732e-01,5.8316808938980103e-01,4.6882399916648865e-01,
+7.5682890415191650e-01,4.3301481008529663e-01,5.7684689760208130e-01,
+4.4432818889617920e-01,5.2744728326797485e-01,3.0378559231758118e-01,
+3.5817208886146545e-01,5.9375840425491333e-01,4.2946299910545349e-01,
+5.9545767307281494e-01,4.7922229766845703e-01,5.8561331033706665e-01,
+3.5734778642654419e-01,4.0260228514671326e-01,5.7647430896759033e-01,
+4.9813330173492432e-01,4.7365880012512207e-01,5.5836081504821777e-01,
+6.1674368381500244e-01,4.1314241290092468e-01,6.2806951999664307e-01,
+3.4463581442832947e-01,1.0386580228805542e-01,5.2044892311096191e-01,
+2.1674020588397980e-01,6.7383992671966553e-01,4.8966509103775024e-01,
+5.1779150962829590e-01,4.8196458816528320e-01,5.4644381999969482e-01,
+3.4235960245132446e-01,4.4884610176086426e-01,5.9126710891723633e-01,
+5.5688631534576416e-01,5.1610678434371948e-01,1.7130009829998016e-01,
+4.9162039160728455e-01,6.4046627283096313e-01,2.8590849041938782e-01,
+5.4592829942703247e-01,4.7157138586044312e-01,5.6900751590728760e-01,
+3.2798269391059875e-01,4.3020078539848328e-01,5.6960451602935791e-01,
+5.3872352838516235e-01,5.0214231014251709e-01,5.9653222560882568e-01,
+3.4734940528869629e-01,6.4755451679229736e-01,4.6437820792198181e-01,
+3.3933150768280029e-01,5.1041001081466675e-01,7.7728152275085449e-01,
+3.6646738648414612e-01,5.4056507349014282e-01,3.9262050390243530e-01,
+4.2515191435813904e-01,4.1351449489593506e-01,6.9257462024688721e-01,
+3.4558731317520142e-01,2.2341939806938171e-01,5.2861189842224121e-01,
+4.2065200209617615e-01,6.5029817819595337e-01,4.1175979375839233e-01,
+3.6733010411262512e-01,2.9062381386756897e-01,5.4451119899749756e-01,
+4.2335158586502075e-01,3.8863611221313477e-01,6.2691658735275269e-01,
+5.5244511365890503e-01,4.9600958824157715e-01,5.3734910488128662e-01,
+6.8494051694869995e-01,4.0372350811958313e-01,6.7869400978088379e-01,
+3.8146761059761047e-01,5.5270588397979736e-01,3.7449559569358826e-01,
+3.5209289193153381e-01,5.6419032812118530e-01,3.0750259757041931e-01,
+4.8888280987739563e-01,5.4563212394714355e-01,4.7435501217842102e-01,
+2.9252481460571289e-01,4.6884548664093018e-01,6.2303477525711060e-01,
+6.8958431482315063e-01,5.3558021783828735e-01,3.4234660863876343e-01,
+5.9370762109756470e-01,4.7086599469184875e-01,2.7369970083236694e-01,
+5.2871561050415039e-01,5.3361928462982178e-01,3.2248139381408691e-01,
+2.9839101433753967e-01,5.6239992380142212e-01,4.2959120869636536e-01,
+6.8139612674713135e-01,5.8579689264297485e-01,4.6034291386604309e-01,
+2.7448511123657227e-01,5.0475269556045532e-01,2.3627419769763947e-01,
+5.2422481775283813e-01,4.8236909508705139e-01,6.7525368928909302e-01,
+1.7346349358558655e-01,6.3543808460235596e-01,4.5874750614166260e-01,
+4.5803809165954590e-01,5.1763808727264404e-01,1.2043850123882294e-01,
+2.3379570245742798e-01,3.9028140902519226e-01,5.6529301404953003e-01,
+5.5120289325714111e-01,5.4559761285781860e-01,4.7989490628242493e-01,
+6.1270868778228760e-01,5.3171318769454956e-01,3.8509321212768555e-01,
+5.4464370012283325e-01,5.2346438169479370e-01,2.2130440175533295e-01,
+4.9161979556083679e-01,1.4714759588241577e-01,4.8528939485549927e-01,
+2.7737739682197571e-01,4.6264618635177612e-01,5.7680791616439819e-01,
+1.6442899405956268e-01,4.7785910964012146e-01,6.2618649005889893e-01,
+5.2573078870773315e-01,5.4980480670928955e-01,3.9831069111824036e-01,
+4.0335190296173096e-01,4.1493400931358337e-01,5.7953411340713501e-01,
+3.9341148734092712e-01,7.3400482535362244e-02,5.2025860548019409e-01,
+3.7495058774948120e-01,5.0781500339508057e-01,6.6060662269592285e-01,
+4.5477110147476196e-01,3.3110061287879944e-01,5.3842592239379883e-01,
+6.5132528543472290e-01,5.2647650241851807e-01,3.4569910168647766e-01,
+6.2686139345169067e-01,5.3992128372192383e-01,4.3453970551490784e-01,
+3.8356059789657593e-01,3.3376678824424744e-01,5.5391657352447510e-01,
+5.7882702350616455e-01,5.2750778198242188e-01,2.7011251449584961e-01,
+5.8522802591323853e-01,4.7283369302749634e-01,3.3139181137084961e-01,
+4.2588108777999878e-01,5.6097871065139771e-01,4.8951920866966248e-01,
+4.3894480913877487e-02,4.2291709780693054e-01,5.6162929534912109e-01,
+4.7881281375885010e-01,4.8002821207046509e-01,5.8013892173767090e-01,
+7.0781761407852173e-01,4.4496241211891174e-01,5.9577310085296631e-01,
+4.1770470142364502e-01,5.3729480504989624e-01,3.7369269132614136e-01,
+6.6588079929351807e-01,2.6479220390319824e-01,5.1018178462982178e-01,
+4.5486348867416382e-01,5.1570618152618408e-01,3.4364390373229980e-01,
+2.3543910682201385e-01,6.8877410888671875e-01,5.1110517978668213e-01,
+5.4388678073883057e-01,5.4511487483978271e-01,4.8313531279563904e-01,
+2.1134190261363983e-01,5.2736818790435791e-01,3.9925870299339294e-01,
+4.6882608532905579e-01,5.5042350292205811e-01,4.3848711252212524e-01,
+3.8928470015525818e-01,6.0017228126525879e-01,4.5616629719734192e-01,
+6.8125613033771515e-02,4.8130258917808533e-01,5.6206572055816650e-01,
+6.6632293164730072e-02,3.5882329940795898e-01,5.2954071760177612e-01,
+4.8226881027221680e-01,4.6703329682350159e-01,5.6831127405166626e-01,
+5.3607952594757080e-01,6.1372458934783936e-01,3.1880891323089600e-01,
+4.4877201318740845e-01,4.8941668868064880e-01,6.7166537046432495e-01,
+3.3367419242858887e-01,4.7182199358940125e-01,5.9606271982192993e-01,
+3.5885548591613770e-01,6.2187129259109497e-01,4.8173001408576965e-01,
+2.5500270724296570e-01,6.7280787229537964e-01,5.0510638952255249e-01,
+5.4019099473953247e-01,5.4194617271423340e-01,4.3471428751945496e-01,
+6.9706249237060547e-01,3.2634168863296509e-01,4.9178731441497803e-01,
+7.2937291115522385e-03,4.5792299509048462e-01,5.3798812627792358e-01,
+6.0240888595581055e-01,3.3361440896987915e-01,4.9628159403800964e-01,
+3.5587510466575623e-01,1.6985629498958588e-01,5.2089858055114746e-01,
+5.5906862020492554e-01,5.8487337827682495e-01,3.7958368659019470e-01,
+5.6702882051467896e-01,5.1826947927474976e-01,3.3277091383934021e-01,
+5.4104858636856079e-01,6.0226422548294067e-01,3.6446440219879150e-01,
+3.4412819147109985e-01,5.2924340963363647e-01,2.7470758557319641e-01,
+8.0278682708740234e-01,5.2223151922225952e-01,3.5867279767990112e-01,
+4.9003869295120239e-01,4.6810561418533325e-01,5.7219529151916504e-01,
+5.3888058662414551e-01,6.6755378246307373e-01,3.4484419226646423e-01,
+9.2396140098571777e-01,4.8848968744277954e-01,6.3060528039932251e-01,
+3.9974310994148254e-01,5.6639820337295532e-01,3.9729809761047363e-01,
+5.2010637521743774e-01,5.1407301425933838e-01,1.2451309710741043e-01,
+3.8020950555801392e-01,3.3094480633735657e-01,5.4745388031005859e-01,
+4.8926019668579102e-01,5.9373992681503296e-01,4.6646690368652344e-01,
+7.0213532447814941e-01,3.2227510213851929e-01,5.0683951377868652e-01,
+4.7177010774612427e-01,4.5093831419944763e-01,5.6511628627777100e-01,
+3.8052248954772949e-01,3.1400179862976074e-01,6.8581461906433105e-01,
+6.8346732854843140e-01,2.9924729466438293e-01,5.4756778478622437e-01,
+2.9414069652557373e-01,3.8969779014587402e-01,5.8729708194732666e-01,
+3.5765719413757324e-01,5.2324008941650391e-01,3.2310879230499268e-01,
+6.7156732082366943e-01,5.4705417156219482e-01,3.8633960485458374e-01,
+2.7714601159095764e-01,4.6891361474990845e-01,5.8519637584686279e-01,
+2.7043971419334412e-01,5.6225502490997314e-01,3.5793170332908630e-01,
+4.1738718748092651e-01,4.1950130462646484e-01,5.5494689941406250e-01,
+2.8573909401893616e-01,6.0245329141616821e-01,4.3775078654289246e-01,
+4.6893501281738281e-01,4.6646049618721008e-01,5.7625621557235718e-01,
+6.3817399740219116e-01,3.7114879488945007e-01,5.5307507514953613e-01,
+5.2643620967864990e-01,3.7305128574371338e-01,5.4457312822341919e-01,
+2.4381700158119202e-01,5.3246712684631348e-01,3.6829888820648193e-01,
+6.4814740419387817e-01,4.8961588740348816e-01,6.5588432550430298e-01,
+3.6138701438903809e-01,5.5028957128524780e-01,3.6325180530548096e-01,
+2.2611320018768311e-01,4.9878901243209839e-01,6.8471962213516235e-01,
+2.4462990462779999e-01,3.5115250945091248e-01,5.3998267650604248e-01,
+6.8236732482910156e-01,4.8915800452232361e-01,7.1356189250946045e-01,
+3.5225218534469604e-01,4.0498688817024231e-01,5.5158257484436035e-01,
+4.1267699003219604e-01,2.8994289040565491e-01,5.3864318132400513e-01,
+3.7713441252708435e-01,5.8273869752883911e-01,4.2675569653511047e-01,
+4.6881249547004700e-01,4.8539221286773682e-01,6.1636447906494141e-01,
+1.7491950094699860e-01,6.8261897563934326e-01,4.8940700292587280e-01,
+4.6145960688591003e-01,5.1830172538757324e-01,2.6866960525512695e-01,
+1.7584669589996338e-01,6.3693821430206299e-01,4.9300441145896912e-01,
+4.1393989324569702e-01,6.0455572605133057e-01,4.8163640499114990e-01,
+5.4508107900619507e-01,2.9240009188652039e-01,6.6996061801910400e-01,
+6.2828367948532104e-01,5.9865701198577881e-01,4.8525801301002502e-01,
+3.3400490880012512e-01,5.1689237356185913e-01,2.6794800162315369e-01,
+5.9257918596267700e-01,5.4377281665802002e-01,4.3468001484870911e-01,
+4.1295009851455688e-01,4.5228740572929382e-01,6.5562921762466431e-01,
+4.5320340991020203e-01,3.7859839200973511e-01,5.4169750213623047e-01,
+6.8842482566833496e-01,3.0913260579109192e-01,5.2436548471450806e-01,
+4.7657939791679382e-01,4.7253859043121338e-01,5.7165551185607910e-01,
+2.1433599293231964e-01,5.6532102823257446e-01,4.3851110339164734e-01,
+5.9247761964797974e-01,4.5734488964080811e-01,5.7693827152252197e-01,
+5.9926092624664307e-01,3.6100810766220093e-01,5.0493258237838745e-01,
+1.5384890139102936e-01,5.2161407470703125e-01,1.4283910393714905e-01,
+2.8255069255828857e-01,4.0350168943405151e-01,5.4377931356430054e-01,
+4.6689969301223755e-01,5.3313547372817993e-01,4.1365718841552734e-01,
+7.1551632881164551e-01,3.1178998947143555e-01,5.2084398269653320e-01,
+4.6376588940620422e-01,4.5616531372070312e-01,5.4452341794967651e-01,
+4.1931080818176270e-01,5.9662377834320068e-01,4.1005000472068787e-01,
+4.8450559377670288e-01,6.2068462371826172e-01,4.9312090873718262e-01,
+5.2824628353118896e-01,9.1048341989517212e-01,3.4559220075607300e-01,
+4.7085541486740112e-01,5.6516230106353760e-01,4.7310239076614380e-01,
+6.1758869886398315e-01,5.1395332813262939e-01,3.4230878949165344e-01,
+4.9182820320129395e-01,5.9420871734619141e-01,4.9230429530143738e-01,
+6.4052718877792358e-01,4.5043969154357910e-01,6.1920768022537231e-01,
+5.3748130798339844e-01,2.2471010684967041e-01,5.2171707153320312e-01,
+2.5547030568122864e-01,3.7925159931182861e-01,5.2432268857955933e-01,
+3.8603371381759644e-01,5.3806877136230469e-01,4.1783639788627625e-01,
+6.1336231231689453e-01,4.0285378694534302e-01,5.5368518829345703e-01,
+5.2799212932586670e-01,2.3346750438213348e-01,5.1759117841720581e-01,
+1.0748530179262161e-01,5.3459298610687256e-01,4.1989380121231079e-01,
+3.8558250665664673e-01,3.3351901173591614e-01,5.2632021903991699e-01,
+5.8603972196578979e-01,5.4377847909927368e-01,3.7161049246788025e-01,
+3.3307549357414246e-01,5.3665977716445923e-01,4.6937939524650574e-01,
+1.0069560259580612e-01,4.8160359263420105e-01,6.2156772613525391e-01,
+5.4619538784027100e-01,4.5784530043601990e-01,5.4193097352981567e-01,
+2.0080469548702240e-01,5.1932811737060547e-01,3.9121940732002258e-01,
+4.2997440695762634e-01,4.3445029854774475e-01,5.5319738388061523e-01,
+1.0757210105657578e-01,5.7627969980239868e-01,4.5746439695358276e-01,
+7.4768078327178955e-01,5.2617651224136353e-01,4.5055508613586426e-01,
+4.4071030616760254e-01,4.2442709207534790e-01,6.8929767608642578e-01,
+1.2522679567337036e-01,4.0777918696403503e-01,5.4428178071975708e-01,
+5.3780037164688110e-01,3.1665799021720886e-01,5.2857381105422974e-01,
+4.9052149057388306e-01,4.5227360725402832e-01,5.5806142091751099e-01,
+6.6126817464828491e-01,5.1077651977539062e-01,3.3869299292564392e-01,
+5.7075601816177368e-01,5.0160211324691772e-01,6.3064599037170410e-01,
+3.0178061127662659e-01,6.2938511371612549e-01,4.5204889774322510e-01,
+3.3440071344375610e-01,2.8253790736198425e-01,5.1509708166122437e-01,
+1.3982650637626648e-01,5.2939987182617188e-01,2.3317280411720276e-01,
+4.9404659867286682e-01,5.4665708541870117e-01,4.6267679333686829e-01,
+6.2700408697128296e-01,5.5081409215927124e-01,4.0618729591369629e-01,
+4.0965679287910461e-01,5.6155568361282349e-01,4.6668860316276550e-01,
+2.3114809393882751e-01,3.0870118737220764e-01,5.5146622657775879e-01,
+7.0050561428070068e-01,5.7974857091903687e-01,4.6916508674621582e-01,
+5.9285950660705566e-01,3.7413978576660156e-01,5.1701688766479492e-01,
+5.4149878025054932e-01,5.1803272962570190e-01,1.5296840667724609e-01,
+2.5154680013656616e-01,5.1219987869262695e-01,3.7259489297866821e-01,
+5.5324357748031616e-01,4.9607661366462708e-01,5.9833151102066040e-01,
+4.1639530658721924e-01,5.8801448345184326e-01,3.3996629714965820e-01,
+7.8466212749481201e-01,3.2881140708923340e-01,5.1550877094268799e-01,
+4.5960599184036255e-01,3.1269869208335876e-01,7.1833992004394531e-01,
+5.2740061283111572e-01,4.8786661028862000e-01,5.6151527166366577e-01,
+5.1608121395111084e-01,5.7016140222549438e-01,3.2048508524894714e-01,
+5.5388379096984863e-01,5.3494292497634888e-01,4.4721511006355286e-01,
+5.0128370523452759e-01,2.5629359483718872e-01,4.5033830404281616e-01,
+2.6304998993873596e-01,5.7565087080001831e-01,4.8548638820648193e-01,
+4.0847519040107727e-01,4.0733560919761658e-01,5.9202408790588379e-01,
+3.4193828701972961e-01,6.8295639753341675e-01,4.4045230746269226e-01,
+4.3917450308799744e-01,4.6010631322860718e-01,6.3579368591308594e-01,
+3.7300100922584534e-01,3.0938240885734558e-01,5.9013700485229492e-01,
+4.3375650048255920e-01,4.2175039649009705e-01,5.8468478918075562e-01,
+4.0846911072731018e-01,5.0872868299484253e-01,7.2771841287612915e-01,
+2.9679030179977417e-01,4.1104629635810852e-01,5.5812197923660278e-01,
+4.2873099446296692e-01,4.2661958932876587e-01,6.4440459012985229e-01,
+4.0848249197006226e-01,3.1819209456443787e-01,5.2306932210922241e-01,
+3.5483568906784058e-01,5.6105977296829224e-01,2.6938489079475403e-01,
+6.2354081869125366e-01,2.8619819879531860e-01,5.2268481254577637e-01,
+3.2578331232070923e-01,3.8829690217971802e-01,5.3411662578582764e-01,
+6.3539659976959229e-01,5.8807611465454102e-01,4.5930901169776917e-01,
+3.1340101361274719e-01,5.2771317958831787e-01,3.6041069030761719e-01,
+5.2903419733047485e-01,4.6544799208641052e-01,6.0449051856994629e-01,
+2.5411269068717957e-01,4.3669191002845764e-01,5.8228862285614014e-01,
+5.4726922512054443e-01,1.4616079628467560e-01,5.1818108558654785e-01,
+1.2701350450515747e-01,4.8326849937438965e-01,2.2235789895057678e-01,
+5.9189289808273315e-01,4.7615069150924683e-01,5.7272237539291382e-01,
+3.6367309093475342e-01,5.2717310190200806e-01,2.7405250072479248e-01,
+5.4977840185165405e-01,6.0598951578140259e-01,4.9603140354156494e-01,
+3.7694650888442993e-01,4.0623620152473450e-01,5.6682151556015015e-01,
+4.6186569333076477e-01,4.8675051331520081e-01,6.5184497833251953e-01,
+5.6775957345962524e-01,3.7107339501380920e-01,5.6766051054000854e-01,
+2.5115218758583069e-01,3.8867509365081787e-01,5.2622538805007935e-01,
+6.5574729442596436e-01,5.9341061115264893e-01,4.2859220504760742e-01,
+5.4260587692260742e-01,5.3513032197952271e-01,4.8342779278755188e-01,
+2.0671689510345459e-01,5.1122522354125977e-01,3.4687140583992004e-01,
+4.4790080189704895e-01,6.2539017200469971e-01,4.9689871072769165e-01,
+2.0313039422035217e-01,5.6187218427658081e-01,4.0465721487998962e-01,
+4.9432641267776489e-01,5.6134277582168579e-01,3.8453319668769836e-01,
+7.7598422765731812e-01,4.6247330307960510e-01,6.2862771749496460e-01,
+2.4093140661716461e-01,5.3455048799514771e-01,3.5079580545425415e-01,
+6.6471010446548462e-01,4.9985098838806152e-01,3.0221650004386902e-01,
+5.9191507101058960e-01,6.3517677783966064e-01,4.9933108687400818e-01,
+1.9023360311985016e-01,5.2533692121505737e-01,3.9858600497245789e-01,
+4.6661040186882019e-01,3.8231649994850159e-01,5.3266328573226929e-01,
+7.0636558532714844e-01,3.8134628534317017e-01,5.2467352151870728e-01,
+4.7916388511657715e-01,4.4912180304527283e-01,5.3709012269973755e-01,
+2.0764739811420441e-01,4.4476351141929626e-01,5.6671631336212158e-01,
+5.4650712013244629e-01,5.4932618141174316e-01,4.5807081460952759e-01,
+5.5015718936920166e-01,5.0857907533645630e-01,3.3056980371475220e-01,
+4.2764690518379211e-01,1.1232180148363113e-01,5.1527231931686401e-01,
+7.3867720365524292e-01,4.9962919950485229e-01,1.3394139707088470e-01,
+4.6790120005607605e-01,6.9286561012268066e-01,5.0120681524276733e-01,
+5.8335822820663452e-01,3.8263911008834839e-01,5.5663508176803589e-01,
+3.0027210712432861e-01,5.9080427885055542e-01,5.0008708238601685e-01,
+3.9750349521636963e-01,3.6976858973503113e-01,5.7561928033828735e-01,
+6.3752681016921997e-01,5.3632658720016479e-01,4.4331708550453186e-01,
+5.8289992809295654e-01,2.6806709170341492e-01,4.6428859233856201e-01,
+5.4753202199935913e-01,5.3208339214324951e-01,4.6464928984642029e-01,
+5.2327448129653931e-01,4.9350860714912415e-01,3.1031179428100586e-01,
+2.8830468654632568e-01,3.6403131484985352e-01,5.3687548637390137e-01,
+6.4686310291290283e-01,5.2596598863601685e-01,3.8314279913902283e-01,
+2.0868189632892609e-01,4.9785330891609192e-01,5.9612572193145752e-01,
+5.7464218139648438e-01,3.5868450999259949e-01,5.3634738922119141e-01,
+2.8331369161605835e-01,5.4777222871780396e-01,4.1105321049690247e-01,
+5.9903860092163086e-01,5.7252532243728638e-01,4.1495120525360107e-01,
+5.3963518142700195e-01,5.3797042369842529e-01,3.8913029432296753e-01,
+3.7146711349487305e-01,5.5295670032501221e-01,3.7558048963546753e-01,
+5.0257730484008789e-01,5.8503222465515137e-01,4.6175739169120789e-01,
+5.9377008676528931e-01,5.6453680992126465e-01,3.9376249909400940e-01,
+5.1821058988571167e-01,3.0074161291122437e-01,5.1964038610458374e-01,
+3.6975800991058350e-01,4.3275931477546692e-01,5.7158088684082031e-01,
+3.4737130999565125e-01,5.4382592439651489e-01,4.4539061188697815e-01,
+6.5117138624191284e-01,1.4432950317859650e-01,4.8881998658180237e-01,
+3.9511090517044067e-01,3.9102658629417419e-01,5.3495037555694580e-01,
+1.2757439911365509e-01,5.0382888317108154e-01,6.9513040781021118e-01,
+5.2534431219100952e-01,5.0112438201904297e-01,7.3113328218460083e-01,
+4.9535360932350159e-01,2.5355559587478638e-01,6.4624428749084473e-01,
+2.3307220637798309e-01,4.7022441029548645e-01,5.5445492267608643e-01,
+3.3689688891172409e-02,4.7871211171150208e-01,6.3383519649505615e-01,
+5.4314869642257690e-01,4.1058328747749329e-01,5.4039907455444336e-01,
+3.1055399775505066e-01,4.2544719576835632e-01,5.4471540451049805e-01,
+6.1183619499206543e-01,5.2900421619415283e-01,4.2247870564460754e-01,
+4.3153458833694458e-01,6.6292631626129150e-01,3.0289649963378906e-01,
+5.4918527603149414e-01,3.1885540485382080e-01,5.1842892169952393e-01,
+3.3288308978080750e-01,3.9236080646514893e-01,5.2351391315460205e-01,
+5.9776467084884644e-01,4.5416879653930664e-01,5.3694289922714233e-01,
+6.3181412220001221e-01,3.4906330704689026e-01,4.7590249776840210e-01,
+5.8871978521347046e-01,5.9613317251205444e-01,4.8419830203056335e-01,
+1.7054040729999542e-01,4.7793799638748169e-01,9.7879663109779358e-02,
+5.8222240209579468e-01,5.4596269130706787e-01,4.6100661158561707e-01,
+3.6703228950500488e-01,4.3023860454559326e-01,5.6917107105255127e-01,
+6.9173210859298706e-01,7.1100401878356934e-01,5.0601547956466675e-01,
+8.7691891193389893e-01,6.5191918611526489e-01,4.5460689067840576e-01,
+5.3298658132553101e-01,5.2204591035842896e-01,2.9535189270973206e-01,
+5.0486332178115845e-01,5.8373582363128662e-01,3.0200859904289246e-01,
+3.1580638885498047e-01,4.3863898515701294e-01,5.4432111978530884e-01,
+5.6253957748413086e-01,5.2811980247497559e-01,3.4014078974723816e-01,
+3.4716591238975525e-01,4.4816970825195312e-01,5.3857702016830444e-01,
+4.4925129413604736e-01,4.1673120856285095e-01,6.0211020708084106e-01,
+4.1484281420707703e-01,5.5920898914337158e-01,4.0732109546661377e-01,
+6.0889142751693726e-01,5.2983051538467407e-01,3.7619501352310181e-01,
+4.7160848975181580e-01,5.1013368368148804e-01,4.6746801584959030e-02,
+1.1818689852952957e-01,5.1190632581710815e-01,7.7784419059753418e-01,
+1.8741349875926971e-01,4.9800279736518860e-01,7.0058178901672363e-01,
+4.4822388887405396e-01,6.2657529115676880e-01,4.4026550650596619e-01,
+3.9994749426841736e-01,5.2477848529815674e-01,8.1935757398605347e-01,
+3.5298168659210205e-01,5.8527278900146484e-01,3.2459780573844910e-01,
+3.8928169012069702e-01,4.3350520730018616e-01,6.5206241607666016e-01,
+4.0411350131034851e-01,5.6249821186065674e-01,3.9675250649452209e-01,
+3.8561120629310608e-01,5.9978890419006348e-01,4.2416140437126160e-01,
+6.6601687669754028e-01,4.4813790917396545e-01,5.5834877490997314e-01,
+3.5354590415954590e-01,3.4098070859909058e-01,5.4206877946853638e-01,
+1.9340839982032776e-01,4.0836268663406372e-01,5.4902219772338867e-01,
+2.2857080399990082e-01,4.6486678719520569e-01,6.0173559188842773e-01,
+3.5980388522148132e-01,4.2596510052680969e-01,5.4764348268508911e-01,
+6.5072381496429443e-01,5.1494097709655762e-01,3.3629849553108215e-01,
+2.6729300618171692e-01,5.6521821022033691e-01,4.2981448769569397e-01,
+1.1518859863281250e-01,4.3735980987548828e-01,5.6121289730072021e-01,
+5.2046489715576172e-01,4.8134678602218628e-01,6.3612091541290283e-01,
+1.5068709850311279e-01,4.5816949009895325e-01,6.2002408504486084e-01,
+3.4322351217269897e-01,3.0882269144058228e-01,5.2267378568649292e-01,
+7.1879392862319946e-01,3.1208148598670959e-01,5.0658440589904785e-01,
+4.7545841336250305e-01,5.2616578340530396e-01,3.3501741290092468e-01,
+1.7134809494018555e-01,4.7258019447326660e-01,5.9564691781997681e-01,
+6.5582227706909180e-01,4.8354008793830872e-01,5.5869138240814209e-01,
+2.6457059383392334e-01,3.6579450964927673e-01,5.1247721910476685e-01,
+2.3856540024280548e-01,5.4904741048812866e-01,4.2747479677200317e-01,
+6.9389009475708008e-01,3.6459881067276001e-01,5.0925260782241821e-01,
+4.6858081221580505e-01,4.9734100699424744e-01,7.7260971069335938e-01,
+6.8774658441543579e-01,4.7885251045227051e-01,6.9216579198837280e-01,
+5.4818397760391235e-01,3.8001629710197449e-01,5.2044928073883057e-01,
+2.5824350118637085e-01,4.9611631035804749e-01,3.2152029871940613e-01,
+5.4604238271713257e-01,6.0465437173843384e-01,4.9399220943450928e-01,
+5.2910941839218140e-01,5.4461228847503662e-01,3.5673621296882629e-01,
+5.5183291435241699e-01,6.9309788942337036e-01,5.0933879613876343e-01,
+3.2015261054039001e-01,4.9892461299896240e-01,2.2770540416240692e-01,
+4.8109310865402222e-01,5.2838671207427979e-01,3.2559248805046082e-01,
+6.2665361166000366e-01,5.0971370935440063e-01,3.1919100880622864e-01,
+4.5495858788490295e-01,2.6450389623641968e-01,5.1538681983947754e-01,
+6.1975848674774170e-01,5.4691988229751587e-01,4.2068558931350708e-01,
+4.1407600045204163e-01,5.4766088724136353e-01,4.1550210118293762e-01,
+7.1604692935943604e-01,5.2408081293106079e-01,3.7296628952026367e-01,
+4.0337988734245300e-01,5.2639859914779663e-01,3.5600930452346802e-01,
+4.5697999000549316e-01,3.0425709486007690e-01,5.8682537078857422e-01,
+4.9141570925712585e-01,4.9185299873352051e-01,6.2669628858566284e-01,
+5.6332361698150635e-01,5.5539160966873169e-01,3.8276460766792297e-01,
+5.4986977577209473e-01,4.3822830915451050e-01,5.4240328073501587e-01,
+2.8881219029426575e-01,3.4726551175117493e-01,5.0763708353042603e-01,
+4.6612051129341125e-01,3.7447750568389893e-01,5.2940011024475098e-01,
+4.6604850888252258e-01,4.1750618815422058e-01,6.9163060188293457e-01,
+2.0182150602340698e-01,7.5111979246139526e-01,5.0320839881896973e-01,
+2.5045138597488403e-01,3.3014011383056641e-01,5.2183371782302856e-01,
+4.6144428849220276e-01,4.6199500560760498e-01,5.2470302581787109e-01,
+6.3143682479858398e-01,3.4013068675994873e-01,5.0555270910263062e-01,
+4.9399960041046143e-01,2.9654508829116821e-01,5.1943677663803101e-01,
+7.8869980573654175e-01,5.1069867610931396e-01,2.9671460390090942e-01,
+5.7143712043762207e-01,4.4812008738517761e-01,5.3849118947982788e-01,
+6.1935687065124512e-01,4.3398851156234741e-01,7.6972991228103638e-01,
+3.1713891029357910e-01,5.2466988563537598e-01,4.2412081360816956e-01,
+4.2318999767303467e-01,4.1741389036178589e-01,5.9196037054061890e-01,
+4.2773890495300293e-01,3.7201610207557678e-01,5.2268189191818237e-01,
+5.4780668020248413e-01,3.6286789178848267e-01,6.1500048637390137e-01,
+4.7470751404762268e-01,4.5801380276679993e-01,5.5856817960739136e-01,
+5.2988010644912720e-01,3.6983850598335266e-01,8.4986197948455811e-01,
+5.5656617879867554e-01,4.7957131266593933e-01,6.2862598896026611e-01,
+4.0524059534072876e-01,6.1730152368545532e-01,4.4142639636993408e-01,
+3.5705709457397461e-01,3.1513288617134094e-01,5.2527028322219849e-01,
+6.1247211694717407e-01,5.1699757575988770e-01,3.5962718725204468e-01,
+4.9149879813194275e-01,4.5462110638618469e-01,5.3958117961883545e-01,
+1.9031339883804321e-01,6.9740772247314453e-01,4.9677160382270813e-01,
+4.7489479184150696e-01,5.1801782846450806e-01,2.9243218898773193e-01,
+7.6658701896667480e-01,5.2155512571334839e-01,3.3657190203666687e-01,
+6.2609577178955078e-01,4.5335099101066589e-01,5.3864890336990356e-01,
+4.1034960746765137e-01,5.8303910493850708e-01,4.3041059374809265e-01,
+2.1325829625129700e-01,4.8728910088539124e-01,5.4589152336120605e-01,
+3.9743649959564209e-01,7.5685507059097290e-01,5.0456118583679199e-01,
+3.9662998914718628e-01,4.1980829834938049e-01,5.4358041286468506e-01,
+6.3694578409194946e-01,5.2695667743682861e-01,3.8122430443763733e-01,
+4.1567629575729370e-01,3.5235330462455750e-01,5.3494542837142944e-01,
+4.4033220410346985e-01,6.0581612586975098e-01,4.4682189822196960e-01,
+4.8257058858871460e-01,4.8359981179237366e-01,6.0392779111862183e-01,
+6.8718272447586060e-01,2.8422209620475769e-01,5.1454281806945801e-01,
+6.0244262218475342e-01,4.7566100955009460e-01,5.7211542129516602e-01,
+4.9310690164566040e-01,3.3116981387138367e-01,6.2275981903076172e-01,
+5.2320927381515503e-01,3.9952319860458374e-01,5.3147977590560913e-01,
+4.4816198945045471e-01,3.9079719781875610e-01,6.6716408729553223e-01,
+5.3570109605789185e-01,4.7709658741950989e-01,5.5700999498367310e-01,
+4.9471241235733032e-01,5.2413070201873779e-01,2.5126549601554871e-01,
+4.6195539832115173e-01,6.3017189502716064e-01,4.9730318784713745e-01,
+2.8709700703620911e-01,4.2528051137924194e-01,5.5792468786239624e-01,
+5.7473158836364746e-01,5.2033740282058716e-01,3.9035668969154358e-01,
+5.5343210697174072e-01,5.3380441665649414e-01,3.9258408546447754e-01,
+4.1443160176277161e-01,4.7013729810714722e-01,5.2817362546920776e-01,
+2.5272560119628906e-01,5.6051462888717651e-01,4.2978560924530029e-01,
+4.8396828770637512e-01,5.1105028390884399e-01,8.0489329993724823e-02,
+3.8289201259613037e-01,4.8584291338920593e-01,7.3549592494964600e-01,
+6.7232239246368408e-01,4.4295778870582581e-01,6.0707777738571167e-01,
+3.0763450264930725e-01,5.5936437845230103e-01,3.6510229110717773e-01,
+4.2779681086540222e-01,4.5835450291633606e-01,5.2846831083297729e-01,
+3.7981921434402466e-01,3.8504371047019958e-01,5.9396880865097046e-01,
+4.1230249404907227e-01,5.7605999708175659e-01,4.2376458644866943e-01,
+3.9299210906028748e-01,5.7619231939315796e-01,2.7804449200630188e-01,
+4.7945070266723633e-01,7.4055880308151245e-02,5.1535779237747192e-01,
+5.8587378263473511e-01,3.5676109790802002e-01,5.5989629030227661e-01,
+5.3468507528305054e-01,4.7825369238853455e-01,5.4567539691925049e-01,
+2.8318119049072266e-01,5.4852157831192017e-01,4.1596978902816772e-01,
+5.6391012668609619e-01,4.5969840884208679e-01,5.9312427043914795e-01,
+3.2306200265884399e-01,3.7952938675880432e-01,5.4086112976074219e-01,
+1.1322979629039764e-01,6.3393700122833252e-01,4.8387709259986877e-01,
+5.6652551889419556e-01,6.7514181137084961e-01,4.1409450769424438e-01,
+3.5612589120864868e-01,5.3472799062728882e-01,3.6497798562049866e-01,
+2.7546560764312744e-01,4.2259928584098816e-01,5.6291788816452026e-01,
+4.9060368537902832e-01,4.0070518851280212e-01,5.3807091712951660e-01,
+2.2146719694137573e-01,7.3531562089920044e-01,5.0050330162048340e-01,
+3.3279061317443848e-01,3.9152890443801880e-01,5.4018497467041016e-01,
+7.1766048669815063e-01,4.5269781351089478e-01,6.0769128799438477e-01,
+2.5698339939117432e-01,4.9996379017829895e-01,5.9582281112670898e-01,
+3.4590938687324524e-01,4.5151269435882568e-01,5.8297157287597656e-01,
+4.8073920607566833e-01,3.4622168540954590e-01,5.2015948295593262e-01,
+6.5998530387878418e-01,2.8218281269073486e-01,5.1252847909927368e-01,
+4.8838189244270325e-01,4.8299181461334229e-01,5.4287171363830566e-01,
+4.4345989823341370e-01,2.2566360235214233e-01,5.9562277793884277e-01,
+4.5272240042686462e-01,2.8443491458892822e-01,5.1864528656005859e-01,
+3.8089990615844727e-01,5.7186990976333618e-01,4.2625638842582703e-01,
+5.9427189826965332e-01,7.7311038970947266e-01,4.9976539611816406e-01,
+6.6811382770538330e-01,3.3056080341339111e-01,4.7499749064445496e-01,
+2.8609329462051392e-01,6.1888831853866577e-01,4.8421001434326172e-01,
+6.0702490806579590e-01,3.7826898694038391e-01,5.3681969642639160e-01,
+3.6902099847793579e-01,3.8571149110794067e-01,5.3181087970733643e-01,
+2.3270089924335480e-01,5.5607229471206665e-01,4.3014100193977356e-01,
+6.7676377296447754e-01,5.1949042081832886e-01,3.6128538846969604e-01,
+3.2378450036048889e-01,1.1948519945144653e-01,4.9917238950729370e-01,
+4.8549601435661316e-01,4.8723229765892029e-01,5.9035778045654297e-01,
+6.5473157167434692e-01,5.8492732048034668e-01,4.5542308688163757e-01,
+4.0646260976791382e-01,5.3995430469512939e-01,4.1528099775314331e-01,
+1.7966809868812561e-01,4.2518630623817444e-01,5.4135227203369141e-01,
+5.2281248569488525e-01,4.8537430167198181e-01,6.0934442281723022e-01,
+2.2050240635871887e-01,5.6927317380905151e-01,4.4687569141387939e-01,
+1.4833140373229980e-01,6.2112838029861450e-01,4.9666011333465576e-01,
+2.2946719825267792e-01,6.4070910215377808e-01,4.7485628724098206e-01,
+5.3549361228942871e-01,5.1369780302047729e-01,1.0595739819109440e-02,
+3.7118038535118103e-01,1.7120739817619324e-01,5.0617581605911255e-01,
+6.7291188240051270e-01,4.4106459617614746e-01,5.4440277814865112e-01,
+5.5689108371734619e-01,5.0238692760467529e-01,3.5624051094055176e-01,
+5.4567861557006836e-01,5.5451387166976929e-01,4.6223109960556030e-01,
+4.9425360560417175e-01,2.9612338542938232e-01,5.9643387794494629e-01,
+5.4952287673950195e-01,5.1739591360092163e-01,2.9402169585227966e-01,
+3.1062999367713928e-01,4.6511501073837280e-01,6.8466138839721680e-01,
+5.2260571718215942e-01,5.1822441816329956e-01,2.7054280042648315e-01,
+1.1095120012760162e-01,4.9386250972747803e-01,1.4041109383106232e-01,
+4.3923568725585938e-01,5.2165520191192627e-01,2.2941139340400696e-01,
+6.1766529083251953e-01,5.2362227439880371e-01,3.3289659023284912e-01,
+4.8661869764328003e-01,4.1164070367813110e-01,5.3956401348114014e-01,
+5.6107360124588013e-01,5.6213891506195068e-01,3.4612038731575012e-01,
+4.8967620730400085e-01,4.3054041266441345e-01,5.3407138586044312e-01,
+5.5449998378753662e-01,6.0385400056838989e-01,3.7465929985046387e-01,
+5.0073480606079102e-01,5.2980971336364746e-01,4.7161450982093811e-01,
+6.2693750858306885e-01,5.1548278331756592e-01,3.8130408525466919e-01,
+4.4402399659156799e-01,4.6975341439247131e-01,5.4855042695999146e-01,
+5.5136048793792725e-01,3.6186391115188599e-01,5.8384567499160767e-01,
+2.5232228636741638e-01,4.1172578930854797e-01,5.3929960727691650e-01,
+6.7263299226760864e-01,5.0411927700042725e-01,3.6077290773391724e-01,
+1.5637390315532684e-01,4.8919808864593506e-01,5.7798451185226440e-01,
+2.1868790686130524e-01,4.7715771198272705e-01,6.0992312431335449e-01,
+3.4639969468116760e-01,3.6306929588317871e-01,5.2521961927413940e-01,
+6.6663217544555664e-01,3.3995470404624939e-01,5.0356978178024292e-01,
+5.0368028879165649e-01,5.4185307025909424e-01,4.3189769983291626e-01,
+7.2210252285003662e-01,3.3209729194641113e-01,5.0244337320327759e-01,
+1.9387650489807129e-01,4.8021888732910156e-01,5.7307147979736328e-01,
+4.2625150084495544e-01,5.7191711664199829e-01,4.0641531348228455e-01,
+4.9957260489463806e-01,5.2892869710922241e-01,4.5817288756370544e-01,
+6.0121482610702515e-01,5.0579768419265747e-01,3.5994321107864380e-01,
+4.9917969107627869e-01,4.6754699945449829e-01,5.3747731447219849e-01,
+6.5864789485931396e-01,3.8532960414886475e-01,5.1960402727127075e-01,
+6.0042357444763184e-01,3.2932278513908386e-01,5.2452367544174194e-01,
+2.5659140944480896e-01,4.6154940128326416e-01,5.9424322843551636e-01,
+5.4873758554458618e-01,4.5783591270446777e-01,5.4269278049468994e-01,
+3.9394611120223999e-01,4.0497899055480957e-01,5.5207037925720215e-01,
+4.8790889978408813e-01,4.8449438810348511e-01,5.5128258466720581e-01,
+4.3679711222648621e-01,6.4259552955627441e-01,4.8818269371986389e-01,
+5.3720992803573608e-01,5.8345532417297363e-01,4.8690780997276306e-01,
+3.8246369361877441e-01,4.8134881258010864e-01,6.9667392969131470e-01,
+5.3927659988403320e-02,5.3374558687210083e-01,4.1607481241226196e-01,
+5.9974372386932373e-01,3.7271851301193237e-01,5.1156342029571533e-01,
+5.2520352602005005e-01,5.2567178010940552e-01,3.9344060420989990e-01,
+2.0619249343872070e-01,6.1883211135864258e-02,4.9250578880310059e-01,
+3.1575900316238403e-01,2.0336820185184479e-01,5.1647698879241943e-01,
+6.6111832857131958e-01,2.8077891469001770e-01,4.9628761410713196e-01,
+5.1463878154754639e-01,6.2844878435134888e-01,4.9555888772010803e-01,
+1.4867480099201202e-01,4.7013381123542786e-01,6.3209718465805054e-01,
+5.2868181467056274e-01,4.6483701467514038e-01,5.3332102298736572e-01,
+5.0848782062530518e-01,3.6296251416206360e-01,8.7571567296981812e-01,
+4.8566961288452148e-01,4.5841160416603088e-01,5.4202407598495483e-01,
+2.7073028683662415e-01,5.0574868917465210e-01,7.0265239477157593e-01,
+4.8272788524627686e-01,4.2472490668296814e-01,5.5087631940841675e-01,
+8.1048011779785156e-01,5.1546192169189453e-01,3.5143798589706421e-01,
+4.8868888616561890e-01,4.6223780512809753e-01,5.3824782371520996e-01,
+6.3665962219238281e-01,5.3685069084167480e-01,3.7654298543930054e-01,
+4.2346870899200439e-01,4.6724060177803040e-01,5.3506839275360107e-01,
+5.7327628135681152e-01,5.4817992448806763e-01,3.7845930457115173e-01,
+5.1559072732925415e-01,5.3531897068023682e-01,4.3871539831161499e-01,
+5.0320029258728027e-01,5.8735388517379761e-01,2.2154450416564941e-01,
+5.4170298576354980e-01,6.0565119981765747e-01,4.9851819872856140e-01,
+3.3520698547363281e-01,6.9292408227920532e-01,4.7782200574874878e-01 
+};
+
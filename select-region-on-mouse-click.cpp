@@ -2,6 +2,7 @@
 
 #include "opencv2/opencv.hpp"
 #include "iostream"
+#include "color_range.hpp"
 
 using namespace cv;
 using namespace std;
@@ -20,7 +21,38 @@ void CallBackFunc(int event, int x, int y, int flags, void* userdata)
     }
 }
 
+// Mean and deviation of the hues of an HSV patch, on the circle: a red patch straddles
+// 0/180, where the linear mean lands near 90 (cyan) with a huge deviation.
+static void circularHue(const Mat& hsv, double& mean, double& dev)
+{
+    const double toAngle = CV_PI / 90;   // 180 hue steps per turn
+    double s = 0, c = 0;
+    for (int y = 0; y < hsv.rows; y++)
+        for (int x = 0; x < hsv.cols; x++)
+        {
+            double a = hsv.at<Vec3b>(y, x)[0] * toAngle;
+            s += std::sin(a);
+            c += std::cos(a);
+        }
+    mean = std::atan2(s, c) / toAngle;
+    if (mean < 0)
+        mean += 180;
+    // each hue's distance to the mean the short way round
+    double sq = 0;
+    for (int y = 0; y < hsv.rows; y++)
+        for (int x = 0; x < hsv.cols; x++)
+        {
+            double d = hsv.at<Vec3b>(y, x)[0] - mean;
+            d -= 180 * std::floor((d + 90) / 180);
+            sq += d * d;
+        }
+    dev = std::sqrt(sq / std::max((int)hsv.total(), 1));
+}
 
+// Click on a colour to add it to the mask, as many times as needed; 'c' clears the
+// colours, ESC quits. Only the clicked patch is converted to HSV: the frames are
+// classified from BGR through the compiled table, which takes each new colour without
+// converting the previous ones again.
 int main(int, char**)
 {
     VideoCapture cap(0); // open the default camera
@@ -28,58 +60,51 @@ int main(int, char**)
         return -1;
 
     namedWindow("Video",1);
-    int area = (2*radius+1)*(2*radius+1);
-
-    Mat frame;
+    //set the callback function for any mouse event
+    setMouseCallback("Video", CallBackFunc, NULL);
 
-    //select the region on the image
-    while(var1==1)
+    ColorRangeClassifier classifier(ColorRangeClassifier::HSV);
+    Mat frame, blurred, out;
+    for(;;)
     {
-        //set the callback function for any mouse event
-        setMouseCallback("Video", CallBackFunc, NULL);
-
         cap >> frame;         // get a new frame from camera
-        //show the image
-        imshow("Video", frame);
+        if(frame.empty())
+            break;
+        GaussianBlur( frame, blurred, Size( 15, 15 ), 0, 0 );
 
-        // Wait until user press some key
-        waitKey(10);
-    }
-
-    GaussianBlur( frame, frame, Size( 15, 15 ), 0, 0 );imshow("blur",frame);
-    Mat imgHSV,out;
-    cvtColor(frame, imgHSV, CV_BGR2HSV);    imshow("HSV",imgHSV);
-    Mat final;
-    final = frame;
-
-    float blue=0, green=0,red=0, b_var=0, g_var=0, r_var=0;
-    for(int var2=pos.y-radius;var2<=pos.y+radius;var2++)
-        for(int var3=pos.x-radius;var3<=pos.x+radius;var3++)
-        {
-            Vec3b intensity = final.at<Vec3b>(var2,var3);
-            blue = blue + intensity.val[0];
-            green = green + intensity.val[1];
-            red = red + intensity.val[2];
-        }
-    red=red/area; green=green/area; blue=blue/area;
-
-    for(int var2=pos.y-radius;var2<=pos.y+radius;var2++)
-        for(int var3=pos.x-radius;var3<=pos.x+radius;var3++)
+        if(var1==0)
         {
-            Vec3b intensity = final.at<Vec3b>(var2,var3);
-            b_var = b_var + (intensity.val[0]-blue)*(intensity.val[0]-blue);
-            g_var = g_var + (intensity.val[1]-green)*(intensity.val[1]-green);
-            r_var = r_var + (intensity.val[2]-red)*(intensity.val[2]-red);
+            var1=1;
+            Rect patch = Rect(pos.x-radius, pos.y-radius, 2*radius+1, 2*radius+1) & Rect(0, 0, frame.cols, frame.rows);
+            Mat patchHSV;
+            cvtColor(blurred(patch), patchHSV, COLOR_BGR2HSV);
+            Scalar mean, dev;
+            meanStdDev(patchHSV, mean, dev);
+            circularHue(patchHSV, mean[0], dev[0]);
+            cout<<"H "<<mean[0]<<" S "<<mean[1]<<" V "<<mean[2]<<" +- "<<dev[0]<<" "<<dev[1]<<" "<<dev[2]<<endl;
+
+            // hue is circular: a range across 0 wraps, given as lower > upper; one as
+            // wide as the circle (a deviation of 85 or more) takes every hue
+            double h0 = mean[0]-dev[0]-5, h1 = mean[0]+dev[0]+5;
+            if (h1-h0 >= 180)
+                h0 = 0, h1 = 179;
+            classifier.addRange(Scalar(h0 < 0 ? h0+180 : h0, mean[1]-2*dev[1]-20, mean[2]-2*dev[2]-40),
+                                Scalar(h1 >= 180 ? h1-180 : h1, mean[1]+2*dev[1]+20, mean[2]+2*dev[2]+40));
         }
 
-    r_var/=area; g_var/=area; b_var/=area;
-    r_var=sqrt(r_var); g_var=sqrt(g_var); b_var=sqrt(b_var);
-    cout<<red<<" "<<green<<"  "<<blue<<" "<<r_var<<" "<<g_var<<" "<<b_var;
+        int64 t = getTickCount();
+        classifier.classify(blurred, out);
+        double ms = (getTickCount()-t)*1000.0/getTickFrequency();
 
+        putText(frame, format("mask %.2f ms", ms), Point(10, 30), FONT_HERSHEY_SIMPLEX, 0.8, Scalar(0, 255, 255), 2);
+        imshow("Video", frame);
+        imshow("out", out);
 
-
-    inRange(final,Scalar(blue-b_var,green-g_var,red-r_var),Scalar(blue+b_var,green+g_var,red+r_var),out);imshow("out",out);
-
-    waitKey(0);
+        int key = waitKey(10);
+        if(key==27)
+            break;
+        if(key=='c')
+            classifier.clear();
+    }
     return 0;
 }
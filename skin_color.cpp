@@ -19,6 +19,7 @@
 #include <opencv2/core/core.hpp>
 #include <opencv2/imgproc/imgproc.hpp>
 #include <opencv2/highgui/highgui.hpp>
+#include "pixel_kernels.hpp"
 
 #include <iostream>
 
@@ -49,61 +50,62 @@ bool R3(float H, float S, float V) {
     return (H<25) || (H > 230);
 }
  
-Mat ThresholdSkin(const Mat &src) {
-    // Allocate the result matrix
-    Mat dst = Mat::zeros(src.rows, src.cols, CV_8UC1);
-    // We operate in YCrCb and HSV:     
-    Mat src_ycrcb, src_hsv;
-    // OpenCV scales the YCrCb components, so that they
-    // cover the whole value range of [0,255], so there's
-    // no need to scale the values:
-    cvtColor(src, src_ycrcb, CV_BGR2YCrCb);
-    // OpenCV scales the Hue Channel to [0,180] for
-    // 8bit images, make sure we are operating on
-    // the full spectrum from [0,360] by using floating
-    // point precision:
-    src.convertTo(src_hsv, CV_32FC3);
-    cvtColor(src_hsv, src_hsv, CV_BGR2HSV);
-    // And then scale between [0,255] for the rules in the paper
-    // to apply. This uses normalize with CV_32FC3, which may fail
-    // on older OpenCV versions. If so, you probably want to split
-    // the channels first and call normalize independently on each
-    // channel:
-    normalize(src_hsv, src_hsv, 0.0, 255.0, NORM_MINMAX, CV_32FC3);
-    // Iterate over the data:
-    for(int i = 0; i < src.rows; i++) {
-        for(int j = 0; j < src.cols; j++) {
-            // Get the pixel in BGR space: 
-            Vec3b pix_bgr = src.ptr<Vec3b>(i)[j];
-            int B = pix_bgr.val[0];
-            int G = pix_bgr.val[1];
-            int R = pix_bgr.val[2];
-            // And apply RGB rule:
-            bool a = R1(R,G,B);
-            // Get the pixel in YCrCB space:
-            Vec3b pix_ycrcb = src_ycrcb.ptr<Vec3b>(i)[j];
-            int Y = pix_ycrcb.val[0];
-            int Cr = pix_ycrcb.val[1];
-            int Cb = pix_ycrcb.val[2];
-            // And apply the YCrCB rule:
-            bool b = R2(Y,Cr,Cb);
-            // Get the pixel in HSV space:
-            Vec3f pix_hsv = src_hsv.ptr<Vec3f>(i)[j];
-            float H = pix_hsv.val[0];
-            float S = pix_hsv.val[1];
-            float V = pix_hsv.val[2];
-            // And apply the HSV rule:
-            bool c = R3(H,S,V);
-            // If not skin, then black 
-            if(a && b && c) {
-                dst.at<unsigned char>(i,j) = 255;
+// All three rules only depend on the BGR value, so they are evaluated once for each
+// of the 2^24 colours and stored as one bit per colour (2 MB). The YCrCb and HSV
+// values come from cvtColor itself, one 256x256 slice of the colour cube at a time,
+// so they are exactly what a per image conversion gives. Hue is used on its full
+// [0,360] range scaled to [0,255]; the old per image normalize() did the same for
+// any image containing both a grey pixel and a hue near 360, but moved with the
+// image content otherwise.
+class SkinTable {
+public:
+    SkinTable() : bits(1 << 21, 0) {
+        Mat bgr(256, 256, CV_8UC3), ycrcb, hsv;
+        for(int r = 0; r < 256; r++) {
+            // slice r: row g, column b
+            for(int g = 0; g < 256; g++) {
+                Vec3b* p = bgr.ptr<Vec3b>(g);
+                for(int b = 0; b < 256; b++)
+                    p[b] = Vec3b((uchar)b, (uchar)g, (uchar)r);
+            }
+            cvtColor(bgr, ycrcb, CV_BGR2YCrCb);
+            bgr.convertTo(hsv, CV_32FC3);
+            cvtColor(hsv, hsv, CV_BGR2HSV);
+            for(int g = 0; g < 256; g++) {
+                const Vec3b* yc = ycrcb.ptr<Vec3b>(g);
+                const Vec3f* hv = hsv.ptr<Vec3f>(g);
+                for(int b = 0; b < 256; b++) {
+                    bool skin = R1(r, g, b) &&
+                                R2(yc[b][0], yc[b][1], yc[b][2]) &&
+                                R3(hv[b][0] * (255.f / 360.f), hv[b][1] * 255.f, hv[b][2]);
+                    if(skin) {
+                        int idx = (b << 16) | (g << 8) | r;
+                        bits[idx >> 3] |= (uchar)(1 << (idx & 7));
+                    }
+                }
             }
         }
     }
+
+    bool operator()(const Vec3b& bgr) const {
+        int idx = (bgr[0] << 16) | (bgr[1] << 8) | bgr[2];
+        return (bits[idx >> 3] >> (idx & 7)) & 1;
+    }
+
+private:
+    vector<uchar> bits;
+};
+
+Mat ThresholdSkin(const Mat &src) {
+    CV_Assert(src.type() == CV_8UC3);
+    // built on the first call
+    static const SkinTable table;
+    Mat dst;
+    // the table lookup is a shift and a mask, -bit turns it into 0 or 255 without a branch
+    pixelkernel::forEachPixel<Vec3b, uchar>(src, dst, [](const Vec3b& p) { return (uchar)-(int)table(p); });
     return dst;
 }
  
- 
 int main(int argc, const char *argv[]) {
     // Get filename to the source image:
     if (argc != 2) {
@@ -11,33 +11,63 @@ using namespace cv;
 //-----------------------------------------------------------------------------------------------------
 // 
 //-----------------------------------------------------------------------------------------------------
-void CalcBlockMeanVariance(Mat& Img, Mat& Res, float blockSide = 21) // blockSide - the parameter (set greater for larger font on image)
+// Mean of every (blockSide+1)^2 block whose standard deviation is above minStdDev, 0
+// elsewhere. Sums come from one integral and one squared integral image, so a block
+// costs the same whatever its size, and blocks may overlap (step < side) for free.
+class BlockMeanBody : public ParallelLoopBody
 {
-	Mat I;
-	Img.convertTo(I, CV_32FC1);
-	Res = Mat::zeros(Img.rows / blockSide, Img.cols / blockSide, CV_32FC1);
-	Mat inpaintmask;
-	Mat patch;
-	Mat smallImg;
-	Scalar m, s;
+public:
+	BlockMeanBody(const Mat& _sum, const Mat& _sqsum, Mat& _res, int _side, int _step, double _minStdDev)
+		: sum(_sum), sqsum(_sqsum), res(_res), side(_side), step(_step), minStdDev(_minStdDev) {}
 
-	for (int i = 0; i<Img.rows - blockSide; i += blockSide)
+	void operator()(const Range& range) const
 	{
-		for (int j = 0; j<Img.cols - blockSide; j += blockSide)
+		const int rows = sum.rows - 1, cols = sum.cols - 1;
+		const double n = double(side + 1) * (side + 1);
+		for (int r = range.start; r < range.end; r++)
 		{
-			patch = I(Range(i, i + blockSide + 1), Range(j, j + blockSide + 1));
-			cv::meanStdDev(patch, m, s);
-			if (s[0]>0.01) // Thresholding parameter (set smaller for lower contrast image)
+			int i = r * step;
+			float* out = res.ptr<float>(r);
+			if (i >= rows - side)
+				continue;
+			const double *s0 = sum.ptr<double>(i), *s1 = sum.ptr<double>(i + side + 1);
+			const double *q0 = sqsum.ptr<double>(i), *q1 = sqsum.ptr<double>(i + side + 1);
+			for (int c = 0; c < res.cols; c++)
 			{
-				Res.at<float>(i / blockSide, j / blockSide) = m[0];
-			}
-			else
-			{
-				Res.at<float>(i / blockSide, j / blockSide) = 0;
+				int j = c * step;
+				if (j >= cols - side)
+					break;
+				int k = j + side + 1;
+				double m = (s1[k] - s1[j] - s0[k] + s0[j]) / n;
+				double v = (q1[k] - q1[j] - q0[k] + q0[j]) / n - m * m;
+				out[c] = v > minStdDev * minStdDev ? (float)m : 0.f;
 			}
 		}
 	}
 
+private:
+	const Mat &sum, &sqsum;
+	Mat& res;
+	int side, step;
+	double minStdDev;
+};
+
+// blockSide - the parameter (set greater for larger font on image)
+// blockStep - distance between blocks, 0 for blockSide (no overlap)
+void CalcBlockMeanVariance(Mat& Img, Mat& Res, float blockSide = 21, int blockStep = 0)
+{
+	Mat I;
+	Img.convertTo(I, CV_32FC1);
+	int side = (int)blockSide, step = blockStep > 0 ? blockStep : side;
+	Res = Mat::zeros(Img.rows / step, Img.cols / step, CV_32FC1);
+	Mat inpaintmask;
+	Mat smallImg;
+
+	Mat sum, sqsum;
+	integral(I, sum, sqsum, CV_64F, CV_64F);
+	// 0.01: thresholding parameter (set smaller for lower contrast image)
+	parallel_for_(Range(0, Res.rows), BlockMeanBody(sum, sqsum, Res, side, step, 0.01));
+
 	cv::resize(I, smallImg, Res.size());
 
 	cv::threshold(Res, inpaintmask, 0.02, 1.0, cv::THRESH_BINARY);
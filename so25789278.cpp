@@ -17,6 +17,8 @@
 #include <opencv2/highgui/highgui.hpp>
 #include <opencv2/imgproc/imgproc.hpp>
 
+#include "blob_labels.hpp"
+
 int main()
 {
     cv::Mat img = cv::imread("beans.png");
@@ -52,20 +54,25 @@ int main()
     border = dilation - erosion;
     cv::imwrite("border.png", border);
 
-    // Get the distance transform and normalize the result to [0,255]
+    // Get the distance transform and normalize the result to [0,255];
+    // computed in tiles, exact for beans up to 128 pixels in radius
+    BlobLabeler labeler;
     cv::Mat dt;
-    cv::distanceTransform(img_bin, dt, cv::DIST_L2, 5);
+    labeler.distance(img_bin, dt, 128);
     cv::normalize(dt, dt, 0, 255, cv::NORM_MINMAX);
 
     // Threshold it to isolate the peaks
     cv::threshold(dt, dt, 135, 255, cv::THRESH_BINARY);
     cv::imwrite("dt_thres.png", dt);
 
-    // Use connectedComponents() to isolate the objects
+    // Label the peaks to isolate the objects, with their area, box and centroid
     dt.convertTo(dt, CV_8U);
-    cv::Mat lbl(dt.size(), CV_32S);
-    int ncc = cv::connectedComponents(dt, lbl, 4);
-    //std::cout << "Number of Connected Components: " << ncc << std::endl;
+    cv::Mat lbl, stats, centroids;
+    int ncc = labeler.label(dt, lbl, stats, centroids, 4);
+    std::cout << "Number of Connected Components: " << ncc << std::endl;
+    for (int label = 1; label < ncc; ++label)
+        std::cout << "  peak " << label << ": area " << stats.at<int>(label, cv::CC_STAT_AREA)
+                  << " at " << cv::Point2d(centroids.at<double>(label, 0), centroids.at<double>(label, 1)) << std::endl;
 
     // Create a gray color spectrum to paint the peaks
     std::vector<unsigned char> colors(ncc);
@@ -1,6 +1,7 @@
 #include <opencv2\opencv.hpp>
 #include <vector>
 #include <algorithm>
+#include "histogram8u.hpp"
 
 using namespace std;
 using namespace cv;
@@ -13,51 +14,18 @@ void imadjust(const Mat1b& src, Mat1b& dst, int tol = 1, Vec2i in = Vec2i(0, 255
     // in  : src image bounds
     // out : dst image buonds
 
-    dst = src.clone();
-
     tol = max(0, min(100, tol));
 
     if (tol > 0)
     {
-        // Compute in and out limits
-
-        // Histogram
-        vector<int> hist(256, 0);
-        for (int r = 0; r < src.rows; ++r)
-        {
-            for (int c = 0; c < src.cols; ++c)
-            {
-                hist[src(r,c)]++;
-            }
-        }
-
-        // Cumulative histogram
-        vector<int> cum = hist;
-        for (int i = 1; i < hist.size(); ++i)
-        {
-            cum[i] = cum[i - 1] + hist[i];
-        }
-
-        // Compute bounds
-        int total = src.rows * src.cols;
-        int low_bound = total * tol / 100;
-        int upp_bound = total * (100-tol) / 100;
-        in[0] = distance(cum.begin(), lower_bound(cum.begin(), cum.end(), low_bound));
-        in[1] = distance(cum.begin(), lower_bound(cum.begin(), cum.end(), upp_bound));
-
+        // Compute in and out limits from the histogram percentiles
+        Histogram8u hist(src);
+        in[0] = hist.percentile(tol);
+        in[1] = hist.percentile(100 - tol);
     }
 
-    // Stretching
-    float scale = float(out[1] - out[0]) / float(in[1] - in[0]);
-    for (int r = 0; r < dst.rows; ++r)
-    {
-        for (int c = 0; c < dst.cols; ++c)
-        {
-            int vs = max(src(r, c) - in[0], 0);
-            int vd = min(int(vs * scale + 0.5f) + out[0], out[1]);
-            dst(r, c) = saturate_cast<uchar>(vd);
-        }
-    }
+    // Stretching, one table lookup per pixel
+    LUT(src, Histogram8u::stretchLut(in[0], in[1], out[0], out[1]), dst);
 }
 
 int main()
@@ -2,6 +2,7 @@
 #include <opencv2\opencv.hpp>
 #include <iostream>
 #include <fstream>
+#include "mat_container.hpp"
 
 using namespace std;
 using namespace cv;
@@ -63,6 +64,14 @@ int main()
         fs << "m" << m;
 
         matwrite("raw.bin", m);
+
+        // same data plus a second matrix, one file, page aligned
+        Mat lut(256, 256, CV_32FC1);
+        randu(lut, 0, 1);
+        MatContainerWriter w;
+        w.add("m", m);
+        w.add("lut", lut);
+        w.write("mats.bin");
     }
 
     // Load the saved matrix
@@ -89,6 +98,23 @@ int main()
         cout << "Using Raw: " << toc << endl;
     }
 
+    {
+        // Method 3: mapping the container, the Mat points into the file
+        double tic = double(getTickCount());
+
+        MappedMatFile f("mats.bin");
+        Mat m3 = f.get("m");
+
+        double toc = (double(getTickCount()) - tic) * 1000. / getTickFrequency();
+        cout << "Using mmap: " << toc << " (" << f.count() << " mats)" << endl;
+
+        // pages are only read when touched
+        tic = double(getTickCount());
+        Scalar s = sum(m3);
+        toc = (double(getTickCount()) - tic) * 1000. / getTickFrequency();
+        cout << "First pass over the mapped data: " << toc << " (sum " << s[0] << ")" << endl;
+    }
+
     int dummy;
     cin >> dummy;
 
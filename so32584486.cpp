@@ -2,6 +2,7 @@
 #include "qa.hpp"
 #include "opencv2/imgproc.hpp"
 #include "opencv2/highgui.hpp"
+#include "channel_remap.hpp"
 
 using namespace cv;
 using namespace std;
@@ -13,6 +14,133 @@ int main( int argc, char** argv )
 }
 #endif
 
+QA_DEMO( so32584486 )
+
+
+// Feathers the edges of one channel in place. Above Threshold is inside; a pixel
+// nearer than radius to the edge gets a ramp across it, 0 at radius outside, 255 at
+// radius inside, the others are not written. The image is cut into tiles and only
+// the tiles with both inside and outside pixels within a radius (the edge band,
+// the mask XOR its erosion and dilation) run distanceTransform, on the tile plus a
+// halo; the work is proportional to the band, not to the image.
+class FeatherBody : public ParallelLoopBody
+{
+public:
+    FeatherBody(const Mat& _img, int _channel, double _radius, int _thresh, int _tile, vector<Mat>& _band, vector<Mat>& _alpha)
+        : img(_img), channel(_channel), radius(_radius), thresh(_thresh), tile(_tile), band(_band), alpha(_alpha) {}
+
+    void operator()(const Range& range) const
+    {
+        const int halo = cvCeil(radius) + 2, tilesX = (img.cols + tile - 1) / tile;
+        const Rect all(0, 0, img.cols, img.rows);
+        for (int t = range.start; t < range.end; t++)
+        {
+            Rect inner = Rect(t % tilesX * tile, t / tilesX * tile, tile, tile) & all;
+            Rect outer = Rect(inner.x - halo, inner.y - halo, inner.width + 2 * halo, inner.height + 2 * halo) & all;
+            Mat crop, bin;
+            ChannelMap(1).from(0, channel).apply(img(outer), crop);
+            threshold(crop, bin, thresh, 255, THRESH_BINARY);
+            int n = countNonZero(bin);
+            if (n == 0 || n == (int)bin.total())
+                continue; // no edge within a radius
+
+            // distance to the nearest outside pixel, and to the nearest inside one
+            Mat dIn, dOut;
+            distanceTransform(bin, dIn, DIST_L2, DIST_MASK_5);
+            distanceTransform(255 - bin, dOut, DIST_L2, DIST_MASK_5);
+
+            Mat m(inner.size(), CV_8UC1, Scalar(0)), a(inner.size(), CV_8UC1, Scalar(0));
+            for (int y = 0; y < inner.height; y++)
+            {
+                int oy = y + inner.y - outer.y, ox = inner.x - outer.x;
+                const uchar* b = bin.ptr<uchar>(oy) + ox;
+                const float* di = dIn.ptr<float>(oy) + ox;
+                const float* dout = dOut.ptr<float>(oy) + ox;
+                for (int x = 0; x < inner.width; x++)
+                {
+                    float s = b[x] ? di[x] - 0.5f : 0.5f - dout[x];
+                    if (std::abs(s) < radius)
+                    {
+                        m.at<uchar>(y, x) = 255;
+                        a.at<uchar>(y, x) = saturate_cast<uchar>(255 * (0.5 + s / (2 * radius)));
+                    }
+                }
+            }
+            if (countNonZero(m))
+            {
+                band[t] = m;
+                alpha[t] = a;
+            }
+        }
+    }
+
+private:
+    const Mat& img;
+    int channel;
+    double radius;
+    int thresh, tile;
+    vector<Mat>& band;
+    vector<Mat>& alpha;
+};
+
+static void FeatherChannel(Mat& img, int channel, double radius, int Threshold)
+{
+    const int tile = 64;
+    int tilesX = (img.cols + tile - 1) / tile, tilesY = (img.rows + tile - 1) / tile;
+    vector<Mat> band(tilesX * tilesY), alpha(tilesX * tilesY);
+    // the tiles read the halos of their neighbours: all of them are computed first
+    parallel_for_(Range(0, (int)band.size()), FeatherBody(img, channel, radius, Threshold, tile, band, alpha));
+
+    const int cn = img.channels();
+    for (size_t t = 0; t < band.size(); t++)
+    {
+        if (band[t].empty())
+            continue;
+        int x0 = (int)t % tilesX * tile, y0 = (int)t / tilesX * tile;
+        for (int y = 0; y < band[t].rows; y++)
+        {
+            uchar* p = img.ptr<uchar>(y0 + y) + x0 * cn + channel;
+            const uchar* m = band[t].ptr<uchar>(y);
+            const uchar* a = alpha[t].ptr<uchar>(y);
+            for (int x = 0; x < band[t].cols; x++)
+                if (m[x])
+                    p[x * cn] = a[x];
+        }
+    }
+}
+
+// in place on a CV_8UC1 mask
+bool FeatherEdgeSingleChannel( Mat& mImage, double radius, int Threshold)
+{
+    if(mImage.empty())
+    {
+        return 0;
+    }
+    CV_Assert(mImage.type() == CV_8UC1);
+    if(radius<1)
+        radius=1;
+
+    FeatherChannel(mImage, 0, radius, Threshold);
+    return true;
+}
+
+// in place on a CV_8UC3 image, each channel on its own
+bool FeatherEdge( Mat& mImage_Bgr, double radius, int Threshold)
+{
+    if(mImage_Bgr.empty())
+    {
+        return 0;
+    }
+    CV_Assert(mImage_Bgr.type() == CV_8UC3);
+
+    if(radius<1)
+        radius=1;
+
+    for (int i = 0; i < 3; i++)
+        FeatherChannel(mImage_Bgr, i, radius, Threshold);
+
+    return true;
+}
 
 bool SmoothEdgeSingleChannel( Mat mInput,Mat &mOutput, double amount, double radius, int Threshold)
 {
@@ -80,8 +208,22 @@ int so32584486(int argc, char** argv)
 
     imshow("Source Image",mSource_Bgr);
     imshow("Output Image",mSmoothEdge);
-    waitKey(0);
 
+    // feathering, on a mask in colour and in gray
+    Mat mMask_Bgr(Size(640,480),CV_8UC3,Scalar(0));
+    ellipse( mMask_Bgr, Point( 200, 200 ), Size( 100, 160 ), 45, 0, 360, Scalar( 255, 0, 0 ), -1, 8 );
+    ellipse( mMask_Bgr, Point( 420, 260 ), Size( 140, 90 ), 0, 0, 360, Scalar( 0, 255, 255 ), -1, 8 );
+    Mat mMask;
+    cvtColor(mMask_Bgr, mMask, COLOR_BGR2GRAY);
+    threshold(mMask, mMask, 0, 255, THRESH_BINARY);
+
+    FeatherEdge(mMask_Bgr,m_Radius,127);
+    FeatherEdgeSingleChannel(mMask,m_Radius,127);
+
+    imshow("Feathered Image",mMask_Bgr);
+    imshow("Feathered Mask",mMask);
+    waitKey(0);
+    return 0;
 }
 
 /*
@@ -1,5 +1,6 @@
 #include <opencv2/opencv.hpp>
 #include <vector>
+#include "channel_remap.hpp"
 using namespace std;
 using namespace cv;
 
@@ -10,49 +11,29 @@ int main()
     Mat3b ycrcb;
     cvtColor(bgr, ycrcb, COLOR_BGR2YCrCb);
 
-    vector<Mat1b> planes;
-    split(ycrcb, planes);
-
-    // Collage planes
-    Mat1b collagePlanes(bgr.rows, bgr.cols*3);
+    // Collage planes, each written straight into its part of the collage
+    Mat collagePlanes(bgr.rows, bgr.cols*3, CV_8UC1);
     for (int i = 0; i < 3; ++i)
     {
-        planes[i].copyTo(collagePlanes(Rect(i*bgr.cols, 0, bgr.cols, bgr.rows)));
+        Mat part = collagePlanes(Rect(i*bgr.cols, 0, bgr.cols, bgr.rows));
+        ChannelMap(1).from(0, i).apply(ycrcb, part);
     }
 
-    Mat1b gray(bgr.rows, bgr.cols, uchar(128));
-
-    // Y
-    vector<Mat1b> vy(3);
-    vy[0] = planes[0];
-    vy[1] = gray.clone();
-    vy[2] = gray.clone();
-    Mat3b my;
-    merge(vy, my);
-
-    // Cr
-    vector<Mat1b> vcr(3);
-    vcr[0] = gray.clone();
-    vcr[1] = planes[1];
-    vcr[2] = gray.clone();
-    Mat3b mcr;
-    merge(vcr, mcr);
-
-    // Cb
-    vector<Mat1b> vcb(3);
-    vcb[0] = gray.clone();
-    vcb[1] = gray.clone();
-    vcb[2] = planes[2];
-    Mat3b mcb;
-    merge(vcb, mcb);
-
-
-
-    // Collage planes
-    Mat3b collageColor(bgr.rows, bgr.cols * 3);
-    my.copyTo(collageColor(Rect(0, 0, bgr.cols, bgr.rows)));
-    mcr.copyTo(collageColor(Rect(bgr.cols, 0, bgr.cols, bgr.rows)));
-    mcb.copyTo(collageColor(Rect(2 * bgr.cols, 0, bgr.cols, bgr.rows)));
+    // Collage planes colored: one plane, the others at 128
+    Mat collageColor(bgr.rows, bgr.cols * 3, CV_8UC3);
+    for (int i = 0; i < 3; ++i)
+    {
+        ChannelMap m(3);
+        for (int c = 0; c < 3; ++c)
+        {
+            if (c == i)
+                m.from(c, c);
+            else
+                m.constant(c, 128);
+        }
+        Mat part = collageColor(Rect(i*bgr.cols, 0, bgr.cols, bgr.rows));
+        m.apply(ycrcb, part);
+    }
 
     cvtColor(collageColor, collageColor, COLOR_YCrCb2BGR);
 
@@ -60,10 +41,12 @@ int main()
     ////////////////////////////
 
     // Blur Y
-    boxFilter(planes[0], planes[0], CV_8U, Size(7,7));
+    Mat y;
+    ChannelMap(1).from(0, 0).apply(ycrcb, y);
+    boxFilter(y, y, CV_8U, Size(7,7));
 
-    Mat3b blurred;
-    merge(planes, blurred);
+    Mat blurred;
+    ChannelMap(3).plane(0, y).from(1, 1).from(2, 2).apply(ycrcb, blurred);
     cvtColor(blurred, blurred, COLOR_YCrCb2BGR);
 
 
@@ -1,74 +1,138 @@
 #include <opencv2\opencv.hpp>
+#include <opencv2/core/hal/intrin.hpp>
+#include <fstream>
 #include <iostream>
+#include "kernel_bench.hpp"
+#include "pixel_kernels.hpp"
 using namespace cv;
 using namespace std;
 
-int main()
-{
-    Mat1b src(720,960);
-    randu(src, 0, 256);
-
-    Mat1b src1 = src.clone();
-    Mat1b src2 = src.clone();
-    Mat1b src3 = src.clone();
-
-    double tic1 = double(getTickCount());
+// dst = src > 70 ? 0 : 255, written in several ways
 
-    // Method @HenryChen (corrected)
-    for (int i = 0; i < src1.rows; i++)
+// Method @HenryChen (corrected)
+static void thresholdAt(const Mat& src, Mat& dst)
+{
+    dst.create(src.size(), CV_8UC1);
+    for (int i = 0; i < src.rows; i++)
     {
-        //cout << i << endl;
-        for (int j = 0; j < src1.cols; j++)
+        for (int j = 0; j < src.cols; j++)
         {
-            if (src1.at<uchar>(i, j) > 70) {
-                src1.at<uchar>(i, j) = 0;
-                //cout << j << endl;
-            }
+            if (src.at<uchar>(i, j) > 70)
+                dst.at<uchar>(i, j) = 0;
             else
-                src1.at<uchar>(i, j) = 255;
+                dst.at<uchar>(i, j) = 255;
         }
     }
+}
 
-    double toc1 = (double(getTickCount()) - tic1) * 1000.0 / getTickFrequency();
-    cout << "Time @HenryChen (ms): \t" << toc1 << endl;
+static void thresholdRow(const uchar* s, uchar* d, int n)
+{
+    for (int j = 0; j < n; j++)
+        d[j] = (s[j] > 70) ? uchar(0) : uchar(255);
+}
 
-    //-------------------------------------
+static void thresholdRowSIMD(const uchar* s, uchar* d, int n)
+{
+    int j = 0;
+#if CV_SIMD128
+    v_uint8x16 t = v_setall_u8(70);
+    for (; j <= n - 16; j += 16)
+        v_store(d + j, v_load(s + j) <= t);     // all ones where s <= 70, zero elsewhere
+#endif
+    thresholdRow(s + j, d + j, n - j);
+}
 
-    double tic2 = double(getTickCount());
+static void thresholdPtr(const Mat& src, Mat& dst)
+{
+    dst.create(src.size(), CV_8UC1);
+    for (int i = 0; i < src.rows; i++)
+        thresholdRow(src.ptr<uchar>(i), dst.ptr<uchar>(i), src.cols);
+}
 
-    // Method @Miki
-    int rows = src2.rows;
-    int cols = src2.cols;
-    if (src2.isContinuous())
+// Method @Miki: one long row when the data is continuous
+static void thresholdFlat(const Mat& src, Mat& dst)
+{
+    dst.create(src.size(), CV_8UC1);
+    int rows = src.rows;
+    int cols = src.cols;
+    if (src.isContinuous() && dst.isContinuous())
     {
         cols = rows * cols;
         rows = 1;
     }
-
     for (int i = 0; i < rows; i++)
+        thresholdRow(src.ptr<uchar>(i), dst.ptr<uchar>(i), cols);
+}
+
+static void thresholdLUT(const Mat& src, Mat& dst)
+{
+    static Mat lut;
+    if (lut.empty())
     {
-        uchar* pdata = src2.ptr<uchar>(0);
-        int base = i*cols;
-        for (int j = 0; j < cols; j++)
-        {
-            pdata[base + j] = (pdata[base + j] > 70) ? uchar(0) : uchar(255);
-        }
+        lut.create(1, 256, CV_8U);
+        for (int v = 0; v < 256; v++)
+            lut.at<uchar>(v) = (v > 70) ? uchar(0) : uchar(255);
     }
+    LUT(src, lut, dst);
+}
 
-    double toc2 = (double(getTickCount()) - tic2) * 1000.0 / getTickFrequency();
-    cout << "Time @Miki (ms): \t" << toc2 << endl;
-
-    //-------------------------------------
-
-    double tic3 = double(getTickCount());
+static void thresholdSIMD(const Mat& src, Mat& dst)
+{
+    dst.create(src.size(), CV_8UC1);
+    if (src.isContinuous() && dst.isContinuous())
+    {
+        thresholdRowSIMD(src.ptr<uchar>(), dst.ptr<uchar>(), (int)src.total());
+        return;
+    }
+    for (int i = 0; i < src.rows; i++)
+        thresholdRowSIMD(src.ptr<uchar>(i), dst.ptr<uchar>(i), src.cols);
+}
 
-    // Method @OpenCV
-    threshold(src3, src3, 70, 255, THRESH_BINARY_INV);
+// the intrinsics row on parallel_for_, by rows or chunks of the continuous data
+static void thresholdParallel(const Mat& src, Mat& dst)
+{
+    pixelkernel::forEachRow<uchar, uchar>(src, dst, thresholdRowSIMD);
+}
 
-    double toc3 = (double(getTickCount()) - tic3) * 1000.0 / getTickFrequency();
-    cout << "Time @OpenCV (ms): \t" << toc3 << endl;
+// the plain comparison as a lambda, inlined and vectorised by the compiler
+static void thresholdKernel(const Mat& src, Mat& dst)
+{
+    pixelkernel::forEachPixel<uchar, uchar>(src, dst, [](uchar v) { return v > 70 ? uchar(0) : uchar(255); });
+}
 
+// Method @OpenCV
+static void thresholdOpenCV(const Mat& src, Mat& dst)
+{
+    threshold(src, dst, 70, 255, THRESH_BINARY_INV);
+}
 
-    getchar();
+// usage: so35603092 [repeats] [results.csv]
+int main(int argc, char** argv)
+{
+    int repeats = argc > 1 ? atoi(argv[1]) : 20;
+
+    KernelBench bench(repeats);
+    bench.add("at<>", thresholdAt);
+    bench.add("row pointer", thresholdPtr);
+    bench.add("continuous flat", thresholdFlat);
+    bench.add("LUT", thresholdLUT);
+    bench.add("intrinsics", thresholdSIMD);
+    bench.add("parallel_for_", thresholdParallel);
+    bench.add("pixel kernel", thresholdKernel);
+    bench.add("threshold()", thresholdOpenCV);
+
+    vector<Size> sizes;
+    sizes.push_back(Size(320, 240));
+    sizes.push_back(Size(960, 720));
+    sizes.push_back(Size(1920, 1080));
+    sizes.push_back(Size(3840, 2160));
+    bench.run(sizes, CV_8UC1);
+
+    bench.printTable(cout);
+    if (argc > 2)
+    {
+        ofstream csv(argv[2]);
+        bench.writeCsv(csv);
+    }
     return 0;
 }
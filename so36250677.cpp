@@ -2,6 +2,7 @@
     #include "opencv2/highgui.hpp"
     #include "opencv2/imgproc.hpp"
     #include <iostream>
+    #include <unordered_map>
     
     using namespace cv;
     using namespace std;
@@ -22,92 +23,149 @@
         return (dx1*dx2 + dy1*dy2)/sqrt((dx1*dx1 + dy1*dy1)*(dx2*dx2 + dy2*dy2) + 1e-10);
     }
     
-    // returns sequence of squares detected on the image.
-    // the sequence is stored in the specified memory storage
-    
-    static void findSquares( const Mat& image, vector<Rect>& squares )
+    // the squares of one colour plane at one threshold level
+    static void findSquaresAt( const Mat& gray0, int l, double maxWidth, vector<Rect>& squares )
     {
-        squares.clear();
-    	erode(image, image, Mat(), Point(-1, -1), 5);
-        Mat pyr, timg, gray0(image.size(), CV_8U), gray;
-    
-        // down-scale and upscale the image to filter out the noise
-        pyrDown(image, pyr, Size(image.cols/2, image.rows/2));
-        pyrUp(pyr, timg, image.size());
+        Mat gray;
+        // hack: use Canny instead of zero threshold level.
+        // Canny helps to catch squares with gradient shading
+        if( l == 0 )
+        {
+            // apply Canny. Take the upper threshold from slider
+            // and set the lower to 0 (which forces edges merging)
+            Canny(gray0, gray, 0, thresh, 5);
+            // dilate canny output to remove potential
+            // holes between edge segments
+            dilate(gray, gray, Mat(), Point(-1,-1));
+        }
+        else
+        {
+            // apply threshold if l!=0:
+            //     tgray(x,y) = gray(x,y) < (l+1)*255/N ? 255 : 0
+            gray = gray0 >= (l+1)*255/N;
+        }
+
+        // find contours and store them all as a list
         vector<vector<Point> > contours;
-    
-        // find squares in every color plane of the image
-        for( int c = 0; c < 3; c++ )
+        findContours(gray, contours, RETR_LIST, CHAIN_APPROX_SIMPLE);
+
+        vector<Point> approx;
+
+        // test each contour
+        for( size_t i = 0; i < contours.size(); i++ )
         {
-            int ch[] = {c, 0};
-            mixChannels(&timg, 1, &gray0, 1, ch, 1);
-    
-            // try several threshold levels
-            for( int l = 0; l < N; l++ )
+            // approximate contour with accuracy proportional
+            // to the contour perimeter
+            approxPolyDP(Mat(contours[i]), approx, arcLength(Mat(contours[i]), true)*0.02, true);
+
+            // square contours should have 4 vertices after approximation
+            // relatively large area (to filter out noisy contours)
+            // and be convex.
+            // Note: absolute value of an area is used because
+            // area may be positive or negative - in accordance with the
+            // contour orientation
+            if( approx.size() == 4 &&
+                fabs(contourArea(Mat(approx))) > 1000 &&
+                isContourConvex(Mat(approx)) )
             {
-                // hack: use Canny instead of zero threshold level.
-                // Canny helps to catch squares with gradient shading
-                if( l == 0 )
+                double maxCosine = 0;
+
+                for( int j = 2; j < 5; j++ )
                 {
-                    // apply Canny. Take the upper threshold from slider
-                    // and set the lower to 0 (which forces edges merging)
-                    Canny(gray0, gray, 0, thresh, 5);
-                    // dilate canny output to remove potential
-                    // holes between edge segments
-                    dilate(gray, gray, Mat(), Point(-1,-1));
-    
+                    // find the maximum cosine of the angle between joint edges
+                    double cosine = fabs(angle(approx[j%4], approx[j-2], approx[j-1]));
+                    maxCosine = MAX(maxCosine, cosine);
                 }
-                else
+
+                // if cosines of all angles are small
+                // (all angles are ~90 degree) then write quandrange
+                // vertices to resultant sequence
+                if (maxCosine < 0.3)
                 {
-                    // apply threshold if l!=0:
-                    //     tgray(x,y) = gray(x,y) < (l+1)*255/N ? 255 : 0
-                    gray = gray0 >= (l+1)*255/N;
+                    Rect r = boundingRect(approx);
+                    if(r.width < maxWidth)
+                        squares.push_back( r );
                 }
-    
-                // find contours and store them all as a list
-                findContours(gray, contours, RETR_LIST, CHAIN_APPROX_SIMPLE);
-    
-                vector<Point> approx;
-    
-                // test each contour
-                for( size_t i = 0; i < contours.size(); i++ )
+            }
+        }
+    }
+
+    // one task per colour plane and threshold level, each into its own vector
+    class SquaresBody : public ParallelLoopBody
+    {
+    public:
+        SquaresBody( const Mat* _planes, double _maxWidth, vector<vector<Rect> >& _found )
+            : planes(_planes), maxWidth(_maxWidth), found(_found) {}
+
+        void operator()( const Range& range ) const
+        {
+            for( int t = range.start; t < range.end; t++ )
+                findSquaresAt( planes[t / N], t % N, maxWidth, found[t] );
+        }
+
+    private:
+        const Mat* planes;
+        double maxWidth;
+        vector<vector<Rect> >& found;
+    };
+
+    // the same box found at several levels: rectangles are hashed by the 16 pixel cell
+    // of their centre, and one overlapping a kept rectangle of a nearby cell by more than
+    // 80% is dropped. Such an overlap keeps the centres less than a quarter of the width
+    // (height) of r apart, so the cells searched around r grow with its size
+    static int64 cellKey( int cx, int cy )
+    {
+        // multiplied, not shifted: cy is -1 above the first cell row
+        return (int64)cy * ((int64)1 << 32) + cx;
+    }
+
+    static void addUnique( const Rect& r, vector<Rect>& squares, unordered_map<int64, vector<int> >& cells )
+    {
+        const int cell = 16;
+        int cx = (r.x + r.width / 2) / cell, cy = (r.y + r.height / 2) / cell;
+        int rx = (r.width / 4 + 1) / cell + 1, ry = (r.height / 4 + 1) / cell + 1;
+        for( int dy = -ry; dy <= ry; dy++ )
+            for( int dx = -rx; dx <= rx; dx++ )
+            {
+                unordered_map<int64, vector<int> >::const_iterator it = cells.find( cellKey( cx + dx, cy + dy ) );
+                if( it == cells.end() )
+                    continue;
+                for( size_t k = 0; k < it->second.size(); k++ )
                 {
-                    // approximate contour with accuracy proportional
-                    // to the contour perimeter
-                    approxPolyDP(Mat(contours[i]), approx, arcLength(Mat(contours[i]), true)*0.02, true);
-    
-                    // square contours should have 4 vertices after approximation
-                    // relatively large area (to filter out noisy contours)
-                    // and be convex.
-                    // Note: absolute value of an area is used because
-                    // area may be positive or negative - in accordance with the
-                    // contour orientation
-                    if( approx.size() == 4 &&
-                        fabs(contourArea(Mat(approx))) > 1000 &&
-                        isContourConvex(Mat(approx)) )
-                    {
-                        double maxCosine = 0;
-    
-                        for( int j = 2; j < 5; j++ )
-                        {
-                            // find the maximum cosine of the angle between joint edges
-                            double cosine = fabs(angle(approx[j%4], approx[j-2], approx[j-1]));
-                            maxCosine = MAX(maxCosine, cosine);
-                        }
-    
-                        // if cosines of all angles are small
-                        // (all angles are ~90 degree) then write quandrange
-                        // vertices to resultant sequence
-    					if (maxCosine < 0.3)
-    					{
-    						Rect r = boundingRect(approx);
-    						if(r.width < (image.cols * 0.8))
-    						squares.push_back( r );
-    					}
-                    }
+                    const Rect& q = squares[it->second[k]];
+                    if( (r & q).area() > 0.8 * max(r.area(), q.area()) )
+                        return;
                 }
             }
-        }
+        cells[cellKey( cx, cy )].push_back( (int)squares.size() );
+        squares.push_back( r );
+    }
+
+    // returns sequence of squares detected on the image.
+    // the sequence is stored in the specified memory storage
+
+    static void findSquares( const Mat& image, vector<Rect>& squares )
+    {
+        squares.clear();
+    	erode(image, image, Mat(), Point(-1, -1), 5);
+        Mat pyr, timg;
+
+        // down-scale and upscale the image to filter out the noise
+        pyrDown(image, pyr, Size(image.cols/2, image.rows/2));
+        pyrUp(pyr, timg, image.size());
+
+        // find squares in every color plane of the image, at several threshold
+        // levels: the 3 x N searches are independent and run in parallel
+        Mat planes[3];
+        split(timg, planes);
+        vector<vector<Rect> > found(3 * N);
+        parallel_for_(Range(0, 3 * N), SquaresBody(planes, image.cols * 0.8, found));
+
+        // merged in plane and level order, as they were found one after the other
+        unordered_map<int64, vector<int> > cells;
+        for( size_t t = 0; t < found.size(); t++ )
+            for( size_t i = 0; i < found[t].size(); i++ )
+                addUnique( found[t][i], squares, cells );
     }
     
     
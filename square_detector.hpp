@@ -0,0 +1,144 @@
+// Frame rate square detection for video, as findSquares() of the 70958 samples.
+//
+//     SquareDetector detector;                          // buffers kept between frames
+//     vector<vector<Point> > squares;
+//     for( ;; )
+//     {
+//         cap >> frame;
+//         detector.detect( frame, squares );            // in frame coordinates
+//         if( detector.reused() ) ...                   // the squares of an earlier frame
+//     }
+//
+// The frame is downscaled to at most maxWidth columns before the blur / Canny /
+// findContours chain, contours whose bounding box is too small for a square are
+// dropped before approxPolyDP, and the remaining ones are tested in parallel. Found
+// squares are mapped back to the frame. While the downscaled gray image differs from
+// the one of the last detection by less than stableDiff (mean absolute difference),
+// the previous squares are returned again, for at most maxSkipped frames in a row.
+
+#ifndef SQUARE_DETECTOR_HPP
+#define SQUARE_DETECTOR_HPP
+
+#include <opencv2/core.hpp>
+#include <opencv2/core/utility.hpp>
+#include <opencv2/imgproc.hpp>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// the helper of the squares samples, shared by them and isSquare():
+// finds a cosine of angle between vectors
+// from pt0->pt1 and from pt0->pt2
+inline double angle( cv::Point pt1, cv::Point pt2, cv::Point pt0 )
+{
+    double dx1 = pt1.x - pt0.x;
+    double dy1 = pt1.y - pt0.y;
+    double dx2 = pt2.x - pt0.x;
+    double dy2 = pt2.y - pt0.y;
+    return ( dx1*dx2 + dy1*dy2 ) / std::sqrt( ( dx1*dx1 + dy1*dy1 ) * ( dx2*dx2 + dy2*dy2 ) + 1e-10 );
+}
+
+// the corner test of findSquares(): all angles of the convex quad are close to 90 degrees
+inline bool isSquare( const std::vector<cv::Point>& approx )
+{
+    if( approx.size() != 4 || !cv::isContourConvex( approx ) )
+        return false;
+    double maxCosine = 0;
+    for( int j = 2; j < 5; j++ )
+        maxCosine = std::max( maxCosine, std::fabs( angle( approx[j%4], approx[j-2], approx[j-1] ) ) );
+    return maxCosine < 0.3;
+}
+
+class SquareCandidateBody : public cv::ParallelLoopBody
+{
+public:
+    SquareCandidateBody( const std::vector<std::vector<cv::Point> >& _contours, double _epsilon, double _minArea,
+                         std::vector<std::vector<cv::Point> >& _found )
+        : contours( _contours ), epsilon( _epsilon ), minArea( _minArea ), found( _found ) {}
+
+    void operator()( const cv::Range& range ) const
+    {
+        std::vector<cv::Point> approx;
+        for( int i = range.start; i < range.end; i++ )
+        {
+            cv::approxPolyDP( contours[i], approx, epsilon, true );
+            if( approx.size() == 4 && cv::contourArea( approx ) > minArea && isSquare( approx ) )
+                found[i] = approx;
+        }
+    }
+
+private:
+    const std::vector<std::vector<cv::Point> >& contours;
+    double epsilon, minArea;
+    std::vector<std::vector<cv::Point> >& found;
+};
+
+class SquareDetector
+{
+public:
+    explicit SquareDetector( int _maxWidth = 480, double _stableDiff = 2.0, int _maxSkipped = 15 )
+        : maxWidth( _maxWidth ), stableDiff( _stableDiff ), maxSkipped( _maxSkipped ), skipped( 0 ), lastSkipped( false ) {}
+
+    void detect( const cv::Mat& frame, std::vector<std::vector<cv::Point> >& squares )
+    {
+        double scale = maxWidth > 0 && frame.cols > maxWidth ? (double)maxWidth / frame.cols : 1.0;
+        if( scale < 1 )
+        {
+            cv::resize( frame, small, cv::Size(), scale, scale, cv::INTER_AREA );
+            cv::cvtColor( small, gray, cv::COLOR_BGR2GRAY );
+        }
+        else
+            cv::cvtColor( frame, gray, cv::COLOR_BGR2GRAY );
+
+        lastSkipped = !previous.empty() && skipped < maxSkipped && previousGray.size() == gray.size()
+                      && cv::norm( gray, previousGray, cv::NORM_L1 ) < stableDiff * gray.total();
+        if( lastSkipped )
+        {
+            skipped++;
+            squares = previous;
+            return;
+        }
+        skipped = 0;
+
+        cv::GaussianBlur( gray, blurred, cv::Size( 7, 7 ), 1.5 * std::max( scale, 0.5 ), 1.5 * std::max( scale, 0.5 ) );
+        cv::Canny( blurred, edges, 0, 30, 3 );
+        cv::findContours( edges, contours, cv::RETR_LIST, cv::CHAIN_APPROX_SIMPLE );
+
+        // the thresholds of findSquares(), in downscaled pixels
+        double minArea = frame.cols * scale * scale;
+        candidates.clear();
+        for( size_t i = 0; i < contours.size(); i++ )
+            if( contours[i].size() >= 4 && cv::boundingRect( contours[i] ).area() > minArea )
+                candidates.push_back( contours[i] );
+
+        found.assign( candidates.size(), std::vector<cv::Point>() );
+        cv::parallel_for_( cv::Range( 0, (int)candidates.size() ),
+                           SquareCandidateBody( candidates, 9 * scale, minArea, found ),
+                           std::max( 1.0, candidates.size() / 64.0 ) );
+
+        squares.clear();
+        for( size_t i = 0; i < found.size(); i++ )
+        {
+            if( found[i].empty() )
+                continue;
+            for( size_t j = 0; j < found[i].size(); j++ )
+                found[i][j] = cv::Point( cvRound( found[i][j].x / scale ), cvRound( found[i][j].y / scale ) );
+            squares.push_back( found[i] );
+        }
+        previous = squares;
+        gray.copyTo( previousGray );
+    }
+
+    // true when the last call returned the squares of an earlier frame
+    bool reused() const { return lastSkipped; }
+
+private:
+    int maxWidth;
+    double stableDiff;
+    int maxSkipped, skipped;
+    bool lastSkipped;
+    cv::Mat small, gray, blurred, edges, previousGray;
+    std::vector<std::vector<cv::Point> > contours, candidates, found, previous;
+};
+
+#endif
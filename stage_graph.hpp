@@ -0,0 +1,239 @@
+// Memoized processing stages for the trackbar tuning demos.
+//
+//     StageGraph graph;
+//     int gray  = graph.add( "gray", [&]( const StageGraph& ) { cvtColor( src, g, COLOR_BGR2GRAY ); } );
+//     int bw    = graph.add( "threshold", [&]( const StageGraph& s ) { bw = g < s.value( &threshval ); },
+//                            { gray }, { &threshval } );
+//     int boxes = graph.add( "draw", [&]( const StageGraph& s ) { ... }, { bw }, { &minHeight } );
+//
+//     AsyncStageRunner runner( graph, result );      // result: the Mat the last stage writes
+//     createTrackbar( ..., &threshval, ..., []( int, void* p ) { ((AsyncStageRunner*)p)->request(); }, &runner );
+//     for(;;) { if( runner.fetch( shown ) ) imshow( ..., shown ); if( waitKey( 30 ) == 27 ) break; }
+//
+// A stage declares the stages it reads and the int parameters (trackbar variables) it
+// depends on. run() executes a stage only when it has never run, when one of its
+// parameters differs from the value of its last run, or when one of its inputs was
+// executed in this run; everything upstream of a change is reused as it is.
+// Stages are added in dependency order, an input must be added before its readers.
+//
+// Stages read their parameters with value(), which returns the snapshot taken when the
+// run was requested, never the live variable the GUI thread writes to. With
+// AsyncStageRunner the stages run on a worker thread: request() takes the snapshot and
+// returns at once, and requests made while a run is in progress are coalesced into a
+// single run with the latest snapshot. fetch() hands a copy of the output to the GUI
+// thread, which is the only one allowed to call imshow.
+
+#ifndef STAGE_GRAPH_HPP
+#define STAGE_GRAPH_HPP
+
+#include <opencv2/core.hpp>
+#include <opencv2/core/utility.hpp>
+#include <algorithm>
+#include <condition_variable>
+#include <functional>
+#include <iomanip>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+class StageGraph
+{
+public:
+    typedef std::function<void( const StageGraph& )> Compute;
+
+    int add( const std::string& name, const Compute& compute,
+             const std::vector<int>& inputs = std::vector<int>(), const std::vector<const int*>& params = std::vector<const int*>() )
+    {
+        Stage s;
+        s.name = name;
+        s.compute = compute;
+        s.inputs = inputs;
+        for( size_t i = 0; i < inputs.size(); i++ )
+            CV_Assert( inputs[i] >= 0 && inputs[i] < (int)stages.size() );
+        for( size_t i = 0; i < params.size(); i++ )
+        {
+            int p = (int)( std::find( allParams.begin(), allParams.end(), params[i] ) - allParams.begin() );
+            if( p == (int)allParams.size() )
+                allParams.push_back( params[i] );
+            s.params.push_back( p );
+        }
+        stages.push_back( s );
+        return (int)stages.size() - 1;
+    }
+
+    // current value of every parameter, in the order run() expects
+    std::vector<int> capture() const
+    {
+        std::vector<int> values( allParams.size() );
+        for( size_t i = 0; i < allParams.size(); i++ )
+            values[i] = *allParams[i];
+        return values;
+    }
+
+    // executes the stale stages with the given parameter values, returns how many ran
+    int run( const std::vector<int>& values )
+    {
+        CV_Assert( values.size() == allParams.size() );
+        current = values;
+        int executed = 0;
+        for( size_t i = 0; i < stages.size(); i++ )
+        {
+            Stage& s = stages[i];
+            bool stale = !s.valid;
+            for( size_t k = 0; k < s.params.size() && !stale; k++ )
+                stale = s.seen[k] != values[s.params[k]];
+            for( size_t k = 0; k < s.inputs.size() && !stale; k++ )
+                stale = stages[s.inputs[k]].ran;
+            s.ran = stale;
+            if( !stale )
+                continue;
+
+            int64 t = cv::getTickCount();
+            s.compute( *this );
+            s.last_ms = ( cv::getTickCount() - t ) * 1000.0 / cv::getTickFrequency();
+            s.runs++;
+            s.seen.resize( s.params.size() );
+            for( size_t k = 0; k < s.params.size(); k++ )
+                s.seen[k] = values[s.params[k]];
+            s.valid = true;
+            executed++;
+        }
+        return executed;
+    }
+
+    int run() { return run( capture() ); }
+
+    // value of a parameter for the run in progress
+    int value( const int* param ) const
+    {
+        size_t p = std::find( allParams.begin(), allParams.end(), param ) - allParams.begin();
+        CV_Assert( p < current.size() );
+        return current[p];
+    }
+
+    // forces a stage, and so everything that reads it, to run again (e.g. a new image)
+    void invalidate( int stage ) { stages[stage].valid = false; }
+
+    // runs and time of the last run of every stage, "-" when a stage was reused
+    void printStats( std::ostream& out ) const
+    {
+        for( size_t i = 0; i < stages.size(); i++ )
+        {
+            out << std::left << std::setw( 16 ) << stages[i].name << std::right << std::setw( 6 ) << stages[i].runs << " runs  ";
+            if( stages[i].ran )
+                out << std::fixed << std::setprecision( 2 ) << stages[i].last_ms << " ms" << std::endl;
+            else
+                out << "-" << std::endl;
+        }
+        out.unsetf( std::ios::floatfield );
+    }
+
+private:
+    struct Stage
+    {
+        std::string name;
+        Compute compute;
+        std::vector<int> inputs, params, seen;
+        bool valid, ran;
+        int runs;
+        double last_ms;
+        Stage() : valid( false ), ran( false ), runs( 0 ), last_ms( 0 ) {}
+    };
+
+    std::vector<Stage> stages;
+    std::vector<const int*> allParams;
+    std::vector<int> current;
+};
+
+class AsyncStageRunner
+{
+public:
+    // output: the Mat written by the last stage, copied out after every run
+    AsyncStageRunner( StageGraph& _graph, const cv::Mat& output )
+        : graph( _graph ), outputs( 1, &output ), pending( false ), stopping( false ), fresh( false ),
+          worker( &AsyncStageRunner::loop, this ) {}
+
+    // several outputs, fetched together
+    AsyncStageRunner( StageGraph& _graph, const std::vector<const cv::Mat*>& _outputs )
+        : graph( _graph ), outputs( _outputs ), pending( false ), stopping( false ), fresh( false ),
+          worker( &AsyncStageRunner::loop, this ) {}
+
+    ~AsyncStageRunner()
+    {
+        {
+            std::lock_guard<std::mutex> l( lock );
+            stopping = true;
+        }
+        wake.notify_one();
+        worker.join();
+    }
+
+    // GUI thread: snapshot the parameters and schedule a run; replaces a pending request
+    void request()
+    {
+        {
+            std::lock_guard<std::mutex> l( lock );
+            snapshot = graph.capture();
+            pending = true;
+        }
+        wake.notify_one();
+    }
+
+    // GUI thread: true, and the latest output in dst, once per finished run
+    bool fetch( cv::Mat& dst )
+    {
+        std::vector<cv::Mat> all;
+        if( !fetch( all ) )
+            return false;
+        dst = all[0];
+        return true;
+    }
+
+    bool fetch( std::vector<cv::Mat>& dst )
+    {
+        std::lock_guard<std::mutex> l( lock );
+        if( !fresh )
+            return false;
+        fresh = false;
+        dst.swap( results );
+        return true;
+    }
+
+private:
+    void loop()
+    {
+        std::unique_lock<std::mutex> l( lock );
+        for( ;; )
+        {
+            wake.wait( l, [this] { return pending || stopping; } );
+            if( stopping )
+                return;
+            std::vector<int> values;
+            values.swap( snapshot );
+            pending = false;
+            l.unlock();
+
+            graph.run( values );
+            std::vector<cv::Mat> copies( outputs.size() );
+            for( size_t i = 0; i < outputs.size(); i++ )
+                copies[i] = outputs[i]->clone();
+
+            l.lock();
+            results.swap( copies );
+            fresh = true;
+        }
+    }
+
+    StageGraph& graph;
+    std::vector<const cv::Mat*> outputs;
+    std::mutex lock;
+    std::condition_variable wake;
+    std::vector<int> snapshot;
+    std::vector<cv::Mat> results;
+    bool pending, stopping, fresh;
+    std::thread worker;
+};
+
+#endif
@@ -0,0 +1,37 @@
+// The red and blue swap of packed 3 byte pixels, shared by videoInput::processPixels
+// in cap_dshow.cpp and by processPixels-benchmark.cpp, so the benchmark times the
+// kernel that ships.
+//
+//     swapRedAndBlueRow( src, dst, width );            // one row of width pixels
+//     swapRedAndBlueRow( src, dst, width * height );   // a continuous image at once
+//
+// The vector path deinterleaves 16 pixels into planes and stores them back in reverse
+// order; the scalar tail handles the rest. src and dst may be the same buffer.
+
+#ifndef SWAP_RED_BLUE_HPP
+#define SWAP_RED_BLUE_HPP
+
+#include "opencv2/core.hpp"
+#include "opencv2/core/hal/intrin.hpp"
+
+inline void swapRedAndBlueRow( const unsigned char* src, unsigned char* dst, int width )
+{
+    int x = 0;
+#if CV_SIMD128
+    for( ; x <= width - 16; x += 16, src += 48, dst += 48 )
+    {
+        cv::v_uint8x16 b, g, r;
+        cv::v_load_deinterleave( src, b, g, r );
+        cv::v_store_interleave( dst, r, g, b );
+    }
+#endif
+    for( ; x < width; x++, src += 3, dst += 3 )
+    {
+        unsigned char t = src[0];
+        dst[1] = src[1];
+        dst[0] = src[2];
+        dst[2] = t;
+    }
+}
+
+#endif
@@ -19,6 +19,7 @@
 #include <opencv2/core/core.hpp>
 #include <opencv2/imgproc/imgproc.hpp>
 #include <opencv2/highgui/highgui.hpp>
+#include <opencv2/core/hal/intrin.hpp>
  
 #include <iostream>
 
@@ -55,61 +56,146 @@ Mat norm_0_255(const Mat& src) {
 //
 // Default parameters are taken from the paper.
 //
-Mat tan_triggs_preprocessing(InputArray src,
-        float alpha = 0.1, float tau = 10.0, float gamma = 0.2, int sigma0 = 1,
-        int sigma1 = 2) {
+struct TanTriggsParams {
+    float alpha, tau, gamma;
+    int sigma0, sigma1;
+
+    TanTriggsParams(float _alpha = 0.1, float _tau = 10.0, float _gamma = 0.2, int _sigma0 = 1, int _sigma1 = 2)
+        : alpha(_alpha), tau(_tau), gamma(_gamma), sigma0(_sigma0), sigma1(_sigma1) {}
+};
+
+// Buffers kept from one image to the next; same size images reuse them as they are.
+struct TanTriggsWorkspace {
+    Mat X, I, gaussian0, gaussian1;
+};
+
+// Sum of a row of floats, and of the row clamped to limit.
+static double sumRow(const float* p, int n) {
+    double sum = 0;
+    int x = 0;
+#if CV_SIMD128
+    v_float32x4 acc = v_setzero_f32();
+    for (; x <= n - 4; x += 4)
+        acc += v_load(p + x);
+    sum = v_reduce_sum(acc);
+#endif
+    for (; x < n; x++)
+        sum += p[x];
+    return sum;
+}
+
+static double sumMinRow(const float* p, int n, float limit) {
+    double sum = 0;
+    int x = 0;
+#if CV_SIMD128
+    v_float32x4 acc = v_setzero_f32(), vlimit = v_setall_f32(limit);
+    for (; x <= n - 4; x += 4)
+        acc += v_min(v_load(p + x), vlimit);
+    sum = v_reduce_sum(acc);
+#endif
+    for (; x < n; x++)
+        sum += std::min(p[x], limit);
+    return sum;
+}
+
+// Same result as the step by step version, with fewer passes and no temporaries:
+//  - the two contrast equalization steps only scale the image, so they are folded
+//    into one factor applied at the end. With P = |I|^alpha:
+//        m1 = mean(P),  m2 = mean(min(P, m1 * tau^alpha)) / m1
+//    and I / (m1 * m2)^(1/alpha) is what the two divisions give;
+//  - tau * tanh(x / tau) is tau * (1 - 2 / (exp(2x / tau) + 1)), one exp() instead of
+//    two exp() and a divide.
+void tan_triggs_preprocessing(InputArray src, OutputArray _dst, TanTriggsWorkspace& ws,
+        const TanTriggsParams& p = TanTriggsParams()) {
 
     // Convert to floating point:
-    Mat X = src.getMat();
-    X.convertTo(X, CV_32FC1);
-    // Start preprocessing:
-    Mat I;
-    pow(X, gamma, I);
+    src.getMat().convertTo(ws.X, CV_32FC1);
+    pow(ws.X, p.gamma, ws.X);
     // Calculate the DOG Image:
     {
-        Mat gaussian0, gaussian1;
         // Kernel Size:
-        int kernel_sz0 = (3*sigma0);
-        int kernel_sz1 = (3*sigma1);
+        int kernel_sz0 = (3*p.sigma0);
+        int kernel_sz1 = (3*p.sigma1);
         // Make them odd for OpenCV:
         kernel_sz0 += ((kernel_sz0 % 2) == 0) ? 1 : 0;
         kernel_sz1 += ((kernel_sz1 % 2) == 0) ? 1 : 0;
-        GaussianBlur(I, gaussian0, Size(kernel_sz0,kernel_sz0), sigma0, sigma0, BORDER_REPLICATE);
-        GaussianBlur(I, gaussian1, Size(kernel_sz1,kernel_sz1), sigma1, sigma1, BORDER_REPLICATE);
-        subtract(gaussian0, gaussian1, I);
+        GaussianBlur(ws.X, ws.gaussian0, Size(kernel_sz0,kernel_sz0), p.sigma0, p.sigma0, BORDER_REPLICATE);
+        GaussianBlur(ws.X, ws.gaussian1, Size(kernel_sz1,kernel_sz1), p.sigma1, p.sigma1, BORDER_REPLICATE);
+        subtract(ws.gaussian0, ws.gaussian1, ws.I);
     }
 
-    {
-        double meanI = 0.0;
-        {
-            Mat tmp;
-            pow(abs(I), alpha, tmp);
-            meanI = mean(tmp).val[0];
-
-        }
-        I = I / pow(meanI, 1.0/alpha);
+    // Both normalization means from P = |I|^alpha (pow() uses |x| for a non integer power),
+    // each in one pass over the rows: P of a row is summed while it is still in cache, then
+    // min(P, m1 * tau^alpha) is summed without being written anywhere.
+    Mat& P = ws.X;
+    P.create(ws.I.size(), CV_32F);
+    double sum1 = 0;
+    for (int y = 0; y < P.rows; y++) {
+        Mat row = P.row(y);
+        pow(ws.I.row(y), p.alpha, row);
+        sum1 += sumRow(row.ptr<float>(), P.cols);
     }
+    double m1 = sum1 / P.total();
+    float limit = (float)(m1 * std::pow((double)p.tau, (double)p.alpha));
+    double sum2 = 0;
+    for (int y = 0; y < P.rows; y++)
+        sum2 += sumMinRow(P.ptr<float>(y), P.cols, limit);
+    double m2 = sum2 / P.total() / m1;
+    double scale = std::pow(m1 * m2, 1.0 / p.alpha);
 
-    {
-        double meanI = 0.0;
-        {
-            Mat tmp;
-            pow(min(abs(I), tau), alpha, tmp);
-            meanI = mean(tmp).val[0];
-        }
-        I = I / pow(meanI, 1.0/alpha);
+    // Squash into the tanh: one exp() over the image, then tau - 2 tau / (e + 1)
+    Mat& E = ws.gaussian0;
+    ws.I.convertTo(E, CV_32F, 2.0 / (scale * p.tau));
+    exp(E, E);
+    _dst.create(ws.I.size(), CV_32FC1);
+    Mat dst = _dst.getMat();
+    const float tau = p.tau;
+    for (int y = 0; y < E.rows; y++) {
+        const float* e = E.ptr<float>(y);
+        float* d = dst.ptr<float>(y);
+        int x = 0;
+#if CV_SIMD128
+        v_float32x4 vtau = v_setall_f32(tau), vtau2 = v_setall_f32(2 * tau), one = v_setall_f32(1.f);
+        for (; x <= E.cols - 4; x += 4)
+            v_store(d + x, vtau - vtau2 / (v_load(e + x) + one));
+#endif
+        for (; x < E.cols; x++)
+            d[x] = tau - 2 * tau / (e[x] + 1);
     }
+}
 
-    // Squash into the tanh:
-    {
-        Mat exp_x, exp_negx;
-	exp( I / tau, exp_x );
-	exp( -I / tau, exp_negx );
-	divide( exp_x - exp_negx, exp_x + exp_negx, I );
-        I = tau * I;
-    }
+Mat tan_triggs_preprocessing(InputArray src,
+        float alpha = 0.1, float tau = 10.0, float gamma = 0.2, int sigma0 = 1,
+        int sigma1 = 2) {
+    TanTriggsWorkspace ws;
+    Mat I;
+    tan_triggs_preprocessing(src, I, ws, TanTriggsParams(alpha, tau, gamma, sigma0, sigma1));
     return I;
 }
+
+// Many face crops with the same parameters, one workspace per stripe of faces.
+class TanTriggsBatchBody : public ParallelLoopBody {
+public:
+    TanTriggsBatchBody(const vector<Mat>& _faces, vector<Mat>& _out, const TanTriggsParams& _p)
+        : faces(_faces), out(_out), p(_p) {}
+
+    void operator()(const Range& range) const {
+        TanTriggsWorkspace ws;
+        for (int i = range.start; i < range.end; i++)
+            tan_triggs_preprocessing(faces[i], out[i], ws, p);
+    }
+
+private:
+    const vector<Mat>& faces;
+    vector<Mat>& out;
+    TanTriggsParams p;
+};
+
+void tan_triggs_preprocessing(const vector<Mat>& faces, vector<Mat>& out,
+        const TanTriggsParams& p = TanTriggsParams()) {
+    out.resize(faces.size());
+    parallel_for_(Range(0, (int)faces.size()), TanTriggsBatchBody(faces, out, p));
+}
  
 int main(int argc, const char *argv[]) {
     // Get filename to the source image:
@@ -121,6 +207,15 @@ int main(int argc, const char *argv[]) {
     Mat image = imread(argv[1], CV_LOAD_IMAGE_GRAYSCALE);
     // Calculate the TanTriggs Preprocessed image with default parameters:
     Mat preprocessed = tan_triggs_preprocessing(image);
+    // A batch of crops, as before recognition:
+    {
+        vector<Mat> faces(64, image), normalized;
+        TickMeter tm;
+        tm.start();
+        tan_triggs_preprocessing(faces, normalized);
+        tm.stop();
+        cout << faces.size() << " images in " << tm.getTimeMilli() << " ms" << endl;
+    }
     // Draw it on screen:
     imshow("Original Image", image);
     imshow("TanTriggs Preprocessed Image", norm_0_255(preprocessed));
@@ -0,0 +1,181 @@
+// Synthetic test images of any size, the same on every run, for benchmarks and demos.
+//
+//     Mat img( 4320, 7680, CV_8UC3 );                  // 8K, or an empty Mat and a size
+//     testpattern::chessboard( img, img.size(), img.type(), 75 );
+//     testpattern::gradient( img, img.size(), CV_8UC1, true );      // 0 .. 255 left to right
+//     testpattern::circlesGrid( img, Size( 640, 480 ), CV_8UC1, Size( 4, 11 ), 40, 10, true );
+//     testpattern::noise( img, img.size(), CV_8UC3, 42 );            // seed 42
+//     testpattern::colorBars( img, Size( 1920, 1080 ), CV_8UC3 );
+//
+// Every function writes into dst, allocated only when its size or type differ (a ROI
+// of a larger image can be filled in place), 8 bit with 1 or 3 channels; the value of
+// a pixel only depends on its position and the arguments. Rows are made in parallel:
+// the patterns that repeat along y build their one or two distinct rows once and copy
+// them, the circles are filled span by span from their equation, and the noise fills
+// each row from a generator seeded with the seed and the row index, so the image does
+// not depend on how the rows are shared between threads.
+
+#ifndef TEST_PATTERNS_HPP
+#define TEST_PATTERNS_HPP
+
+#include <opencv2/core.hpp>
+#include <opencv2/core/utility.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+namespace testpattern
+{
+
+template<typename Row> class RowBody : public cv::ParallelLoopBody
+{
+public:
+    RowBody( cv::Mat& _dst, const Row& _row ) : dst( _dst ), row( _row ) {}
+
+    void operator()( const cv::Range& range ) const
+    {
+        for( int y = range.start; y < range.end; y++ )
+            row( y, dst.ptr<uchar>( y ) );
+    }
+
+private:
+    cv::Mat& dst;
+    const Row& row;
+};
+
+// row( y, ptr ) for every row of dst, in parallel
+template<typename Row> inline void forRows( cv::Mat& dst, const Row& row )
+{
+    cv::parallel_for_( cv::Range( 0, dst.rows ), RowBody<Row>( dst, row ), std::max( 1.0, dst.total() / (double)( 1 << 16 ) ) );
+}
+
+inline void prepare( cv::Mat& dst, cv::Size size, int type )
+{
+    CV_Assert( type == CV_8UC1 || type == CV_8UC3 );
+    CV_Assert( size.width > 0 && size.height > 0 );
+    dst.create( size, type );
+}
+
+// a pixel of colour bgr at p; gray images take bgr[0]
+inline void put( uchar* p, int cn, const cv::Vec3b& bgr )
+{
+    if( cn == 1 )
+        p[0] = bgr[0];
+    else
+    {
+        p[0] = bgr[0];
+        p[1] = bgr[1];
+        p[2] = bgr[2];
+    }
+}
+
+// squares of side square, white first (top left), then black
+inline void chessboard( cv::Mat& dst, cv::Size size, int type, int square )
+{
+    CV_Assert( square > 0 );
+    prepare( dst, size, type );
+    const size_t bytes = (size_t)size.width * dst.elemSize();
+    // the rows starting with a white square, and with a black one
+    std::vector<uchar> rows( 2 * bytes );
+    for( int x = 0; x < size.width; x++ )
+    {
+        uchar v = ( x / square ) % 2 ? 0 : 255;
+        for( int c = 0; c < dst.channels(); c++ )
+        {
+            rows[x * dst.channels() + c] = v;
+            rows[bytes + x * dst.channels() + c] = (uchar)~v;
+        }
+    }
+    forRows( dst, [&]( int y, uchar* p ) { memcpy( p, &rows[( y / square ) % 2 * bytes], bytes ); } );
+}
+
+// 0 to 255 across the width (horizontal) or down the height
+inline void gradient( cv::Mat& dst, cv::Size size, int type, bool horizontal = true )
+{
+    prepare( dst, size, type );
+    const int cn = dst.channels();
+    const size_t bytes = (size_t)size.width * dst.elemSize();
+    std::vector<uchar> row( bytes );
+    for( int x = 0; x < size.width; x++ )
+        memset( &row[x * cn], size.width > 1 ? x * 255 / ( size.width - 1 ) : 0, cn );
+    forRows( dst, [&]( int y, uchar* p )
+    {
+        if( horizontal )
+            memcpy( p, &row[0], bytes );
+        else
+            memset( p, size.height > 1 ? y * 255 / ( size.height - 1 ) : 0, bytes );
+    } );
+}
+
+// black discs of radius on white, grid.width per row and grid.height rows, spacing
+// apart from the first at ( spacing, spacing ); asymmetric: the layout of
+// findCirclesGrid( CALIB_CB_ASYMMETRIC_GRID ), disc j of row i at
+// ( ( 2 j + i % 2 ) spacing, i spacing ) from the first, so 2 spacing apart in a row
+// and nearest to the discs of the rows next to it
+inline void circlesGrid( cv::Mat& dst, cv::Size size, int type, cv::Size grid, int spacing, int radius, bool asymmetric = false )
+{
+    CV_Assert( grid.width > 0 && grid.height > 0 && spacing > 0 && radius > 0 );
+    prepare( dst, size, type );
+    const int cn = dst.channels();
+    forRows( dst, [&]( int y, uchar* p )
+    {
+        memset( p, 255, (size_t)size.width * cn );
+        // the grid rows whose discs cross this row
+        double fy = y + 0.5;
+        int first = std::max( 0, (int)std::ceil( ( fy - radius ) / spacing ) - 1 );
+        int last = std::min( grid.height - 1, (int)std::floor( ( fy + radius ) / spacing ) - 1 );
+        for( int i = first; i <= last; i++ )
+        {
+            double cy = spacing * ( i + 1 ), dy = fy - cy;
+            if( std::abs( dy ) > radius )
+                continue;
+            double half = std::sqrt( (double)radius * radius - dy * dy );
+            for( int j = 0; j < grid.width; j++ )
+            {
+                double cx = asymmetric ? spacing * ( 2 * j + i % 2 + 1 ) : spacing * ( j + 1 );
+                int x0 = std::max( 0, (int)std::ceil( cx - half - 0.5 ) );
+                int x1 = std::min( size.width, (int)std::floor( cx + half - 0.5 ) + 1 );
+                if( x1 > x0 )
+                    memset( p + x0 * cn, 0, (size_t)( x1 - x0 ) * cn );
+            }
+        }
+    } );
+}
+
+// uniform noise in [low, high), deterministic for a seed
+inline void noise( cv::Mat& dst, cv::Size size, int type, uint64 seed, int low = 0, int high = 256 )
+{
+    prepare( dst, size, type );
+    forRows( dst, [&]( int y, uchar* p )
+    {
+        cv::Mat row( 1, size.width, type, p );
+        cv::RNG rng( seed * 0x9E3779B97F4A7C15ULL + (uint64)y + 1 );
+        rng.fill( row, cv::RNG::UNIFORM, cv::Scalar::all( low ), cv::Scalar::all( high ) );
+    } );
+}
+
+// 8 bars of equal width: white, yellow, cyan, green, magenta, red, blue, black; in
+// gray, their luma
+inline void colorBars( cv::Mat& dst, cv::Size size, int type )
+{
+    static const cv::Vec3b bars[8] = { cv::Vec3b( 255, 255, 255 ), cv::Vec3b( 0, 255, 255 ), cv::Vec3b( 255, 255, 0 ),
+                                       cv::Vec3b( 0, 255, 0 ), cv::Vec3b( 255, 0, 255 ), cv::Vec3b( 0, 0, 255 ),
+                                       cv::Vec3b( 255, 0, 0 ), cv::Vec3b( 0, 0, 0 ) };
+    prepare( dst, size, type );
+    const int cn = dst.channels();
+    const size_t bytes = (size_t)size.width * dst.elemSize();
+    std::vector<uchar> row( bytes );
+    for( int x = 0; x < size.width; x++ )
+    {
+        cv::Vec3b c = bars[(int64)x * 8 / size.width];
+        if( cn == 1 )
+            c[0] = cv::saturate_cast<uchar>( 0.114 * c[0] + 0.587 * c[1] + 0.299 * c[2] );
+        put( &row[x * cn], cn, c );
+    }
+    forRows( dst, [&]( int, uchar* p ) { memcpy( p, &row[0], bytes ); } );
+}
+
+}
+
+#endif
@@ -0,0 +1,141 @@
+// Runs a kernel over the tiles of an image on all cores, shared by the samples.
+//
+//     TileScheduler tiles;                           // cache sized tiles, no halo
+//     tiles.run( src, dst, []( const Mat& s, Mat& d, const Tile& ) { cv::threshold( s, d, 70, 255, THRESH_BINARY ); } );
+//
+//     TileScheduler blur( Size(), 3 );               // 3 pixel halo around every tile
+//     blur.run( src, dst, []( const Mat& s, Mat& d, const Tile& t ) {
+//         Mat tmp; cv::GaussianBlur( s, tmp, Size( 7, 7 ), 0, 0, BORDER_ISOLATED ); tmp( t.inner() ).copyTo( d );
+//     } );
+//
+// The kernel gets views, never copies: s is src( tile.halo ), the tile grown by the
+// halo and clipped to the image, and d is dst( tile.dst ), where it writes its result
+// in place. dst may be smaller or larger than src (a resize): the tiles of dst are the
+// tiles of src scaled, and they still cover it exactly. src and dst may be the same
+// Mat when the halo is 0.
+//
+// The default tile holds about CACHE_BYTES of source pixels, so a tile and its output
+// stay in L2 while the kernel runs. Tiles are handed out from a shared counter: every
+// worker claims the next tile as soon as it is done with one, so a slow tile does not
+// hold back a whole stripe of them.
+
+#ifndef TILE_SCHEDULER_HPP
+#define TILE_SCHEDULER_HPP
+
+#include <opencv2/core.hpp>
+#include <opencv2/core/utility.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <functional>
+#include <vector>
+
+struct Tile
+{
+    int index;
+    cv::Rect rect;      // the tile in src
+    cv::Rect halo;      // rect grown by the halo, clipped to src
+    cv::Rect dst;       // the tile in dst
+
+    // rect in the coordinates of the halo view
+    cv::Rect inner() const { return rect - halo.tl(); }
+};
+
+namespace tiles
+{
+
+enum { CACHE_BYTES = 256 * 1024 };
+
+class ClaimBody : public cv::ParallelLoopBody
+{
+public:
+    typedef std::function<void( const cv::Mat&, cv::Mat&, const Tile& )> Kernel;
+
+    ClaimBody( const cv::Mat& _src, cv::Mat& _dst, const std::vector<Tile>& _list, const Kernel& _kernel, std::atomic<int>& _next )
+        : src( _src ), dst( _dst ), list( _list ), kernel( _kernel ), next( _next ) {}
+
+    void operator()( const cv::Range& ) const
+    {
+        for( int i = next++; i < (int)list.size(); i = next++ )
+        {
+            const Tile& t = list[i];
+            cv::Mat out = dst( t.dst );
+            kernel( src( t.halo ), out, t );
+        }
+    }
+
+private:
+    const cv::Mat& src;
+    cv::Mat& dst;
+    const std::vector<Tile>& list;
+    const Kernel& kernel;
+    std::atomic<int>& next;
+};
+
+}
+
+class TileScheduler
+{
+public:
+    typedef tiles::ClaimBody::Kernel Kernel;
+
+    // tileSize: empty for cache sized tiles
+    explicit TileScheduler( cv::Size _tileSize = cv::Size(), int _halo = 0 ) : tileSize( _tileSize ), halo( std::max( 0, _halo ) ) {}
+
+    cv::Size defaultTileSize( size_t elemSize ) const
+    {
+        int side = (int)std::sqrt( (double)tiles::CACHE_BYTES / std::max( (size_t)1, elemSize ) );
+        side = std::max( 16, side / 16 * 16 );
+        return cv::Size( side, side );
+    }
+
+    // the tiles of a src of size srcSize, mapped onto a dst of size dstSize
+    std::vector<Tile> layout( cv::Size srcSize, size_t elemSize, cv::Size dstSize ) const
+    {
+        cv::Size t = tileSize.area() > 0 ? tileSize : defaultTileSize( elemSize );
+        cv::Rect full( 0, 0, srcSize.width, srcSize.height );
+        std::vector<Tile> list;
+        for( int y = 0; y < srcSize.height; y += t.height )
+            for( int x = 0; x < srcSize.width; x += t.width )
+            {
+                Tile tile;
+                tile.index = (int)list.size();
+                tile.rect = cv::Rect( x, y, t.width, t.height ) & full;
+                tile.halo = cv::Rect( x - halo, y - halo, t.width + 2 * halo, t.height + 2 * halo ) & full;
+                int x0 = scale( tile.rect.x, srcSize.width, dstSize.width ), x1 = scale( tile.rect.br().x, srcSize.width, dstSize.width );
+                int y0 = scale( tile.rect.y, srcSize.height, dstSize.height ), y1 = scale( tile.rect.br().y, srcSize.height, dstSize.height );
+                tile.dst = cv::Rect( x0, y0, x1 - x0, y1 - y0 );
+                if( tile.dst.area() > 0 )
+                    list.push_back( tile );
+            }
+        return list;
+    }
+
+    // dst must be allocated by the caller: its size and type are the kernel's business
+    void run( const cv::Mat& src, cv::Mat& dst, const Kernel& kernel ) const
+    {
+        CV_Assert( !dst.empty() && ( halo == 0 || src.data != dst.data ) );
+        std::vector<Tile> list = layout( src.size(), src.elemSize(), dst.size() );
+        std::atomic<int> next( 0 );
+        int workers = std::min( (int)list.size(), std::max( 1, cv::getNumThreads() ) );
+        cv::parallel_for_( cv::Range( 0, workers ), tiles::ClaimBody( src, dst, list, kernel, next ), workers );
+    }
+
+    // same size and type as src
+    void run( const cv::Mat& src, cv::Mat& dst, int type, const Kernel& kernel ) const
+    {
+        dst.create( src.size(), type < 0 ? src.type() : type );
+        run( src, dst, kernel );
+    }
+
+private:
+    static int scale( int v, int from, int to )
+    {
+        return (int)( (int64)v * to / from );
+    }
+
+    cv::Size tileSize;
+    int halo;
+};
+
+#endif
@@ -0,0 +1,144 @@
+// HOG people detection that only reruns where the scene changed.
+//
+//     TiledPeopleDetector detector( hog );
+//     detector.detect( frame, fgmask, found );   // fgmask: non-zero is foreground
+//
+// The frame is split into a grid of tiles and the detections of every tile are kept
+// between frames. A tile is scanned again only when the share of foreground pixels
+// in it moved by more than changeThreshold since it was last scanned; tiles with
+// (almost) no foreground are not scanned at all. Dirty tiles run in a parallel_for_.
+//
+// Each tile is scanned with a margin so that people crossing tile borders are seen
+// whole, and a detection belongs to the tile holding its centre, which keeps the
+// same person from being reported by two tiles.
+
+#ifndef TILED_PEOPLE_DETECTOR_HPP
+#define TILED_PEOPLE_DETECTOR_HPP
+
+#include <opencv2/core/core.hpp>
+#include <opencv2/imgproc/imgproc.hpp>
+#include <opencv2/objdetect/objdetect.hpp>
+#include <vector>
+#include <cmath>
+
+class TiledPeopleDetector
+{
+public:
+    TiledPeopleDetector( const cv::HOGDescriptor& _hog, cv::Size _tileSize = cv::Size( 160, 160 ),
+                         double _changeThreshold = 0.05, double _minForeground = 0.01 )
+        : hog( _hog ), tileSize( _tileSize ), changeThreshold( _changeThreshold ),
+          minForeground( _minForeground ), lastDirty( 0 )
+    {
+        // people up to twice the window height are found whole across tile borders
+        margin = cv::Size( hog.winSize.width, hog.winSize.height );
+    }
+
+    void detect( const cv::Mat& frame, const cv::Mat& fgmask, std::vector<cv::Rect>& found )
+    {
+        CV_Assert( fgmask.type() == CV_8UC1 && fgmask.size() == frame.size() );
+        if( frame.size() != frameSize )
+            reset( frame.size() );
+
+        std::vector<int> dirty;
+        for( size_t i = 0; i < tiles.size(); i++ )
+        {
+            Tile& t = tiles[i];
+            double ratio = (double)cv::countNonZero( fgmask( t.area ) ) / t.area.area();
+            if( t.scanned && std::abs( ratio - t.foreground ) <= changeThreshold )
+                continue;
+            t.foreground = ratio;
+            t.scanned = true;
+            if( ratio < minForeground )
+                t.found.clear();
+            else
+                dirty.push_back( (int)i );
+        }
+        lastDirty = (int)dirty.size();
+
+        if( !dirty.empty() )
+        {
+            if( frame.channels() == 3 )
+                cv::cvtColor( frame, gray, cv::COLOR_BGR2GRAY );
+            else
+                gray = frame;
+            cv::parallel_for_( cv::Range( 0, (int)dirty.size() ), ScanBody( *this, dirty ) );
+        }
+
+        found.clear();
+        for( size_t i = 0; i < tiles.size(); i++ )
+            found.insert( found.end(), tiles[i].found.begin(), tiles[i].found.end() );
+    }
+
+    // forget every cached result, e.g. after a cut or a camera move
+    void reset( cv::Size size = cv::Size() )
+    {
+        if( size.area() > 0 )
+            frameSize = size;
+        tiles.clear();
+        for( int y = 0; y < frameSize.height; y += tileSize.height )
+            for( int x = 0; x < frameSize.width; x += tileSize.width )
+            {
+                Tile t;
+                t.area = cv::Rect( x, y, tileSize.width, tileSize.height ) & cv::Rect( cv::Point(), frameSize );
+                t.scan = cv::Rect( t.area.x - margin.width, t.area.y - margin.height,
+                                   t.area.width + margin.width * 2, t.area.height + margin.height * 2 ) & cv::Rect( cv::Point(), frameSize );
+                t.foreground = 0;
+                t.scanned = false;
+                tiles.push_back( t );
+            }
+    }
+
+    int tileCount() const { return (int)tiles.size(); }
+    int dirtyTiles() const { return lastDirty; }   // tiles scanned by the last detect()
+
+private:
+    struct Tile
+    {
+        cv::Rect area;       // pixels owned by the tile
+        cv::Rect scan;       // area plus margin, what HOG looks at
+        double foreground;   // foreground ratio at the last scan
+        bool scanned;
+        std::vector<cv::Rect> found;
+    };
+
+    class ScanBody : public cv::ParallelLoopBody
+    {
+    public:
+        ScanBody( TiledPeopleDetector& _owner, const std::vector<int>& _dirty ) : owner( _owner ), dirty( _dirty ) {}
+
+        void operator()( const cv::Range& range ) const
+        {
+            for( int i = range.start; i < range.end; i++ )
+            {
+                Tile& t = owner.tiles[dirty[i]];
+                t.found.clear();
+                if( t.scan.width <= owner.hog.winSize.width || t.scan.height <= owner.hog.winSize.height )
+                    continue;
+                std::vector<cv::Rect> rects;
+                owner.hog.detectMultiScale( owner.gray( t.scan ), rects );
+                for( size_t k = 0; k < rects.size(); k++ )
+                {
+                    cv::Rect r = rects[k] + t.scan.tl();
+                    if( t.area.contains( cv::Point( r.x + r.width / 2, r.y + r.height / 2 ) ) )
+                        t.found.push_back( r );
+                }
+            }
+        }
+
+    private:
+        TiledPeopleDetector& owner;
+        const std::vector<int>& dirty;
+    };
+
+    const cv::HOGDescriptor& hog;
+    cv::Size tileSize;
+    cv::Size margin;
+    double changeThreshold;
+    double minForeground;
+    cv::Size frameSize;
+    std::vector<Tile> tiles;
+    cv::Mat gray;
+    int lastDirty;
+};
+
+#endif
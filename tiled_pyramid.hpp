@@ -0,0 +1,217 @@
+// Viewing images too large to decode whole: a pyramid of tiles on disk.
+//
+//     TiledPyramid pyr;
+//     if( !pyr.load( "scan.tiles" ) )                      // index.yml written by build()
+//         pyr.build( "scan.tif", "scan.tiles" );            // once: decodes the image one time
+//     Mat view, crop;
+//     pyr.render( Rect2d( x, y, w, h ), Size( 1024, 768 ), view );   // any zoom, fit to the size
+//     pyr.crop( Rect( x, y, w, h ), Size( 800, 600 ), crop );   // at most 800 x 600
+//     pyr.crop( Rect( x, y, w, h ), crop );                 // full resolution, to save
+//
+// Level 0 is the image cut into tiles of 512 x 512 (the last ones smaller), level
+// l + 1 is level l at half size, down to a level that fits in one tile. Each tile is a
+// PNG of its own, <dir>/<level>/<row>_<col>.png, so a view decodes only the tiles it
+// covers, at the level where one tile pixel is at least one screen pixel: about the
+// screen area, whatever the zoom. Decoded tiles stay in a least recently used cache
+// (256 tiles, 192 MB of BGR tiles, unless the constructor says otherwise).
+//
+// build() reads the image once with imread, then makes each level from the tiles of
+// the level below, 2 x 2 tiles at a time, so only level 0 ever needs the whole image
+// in memory; it can run once on a bigger machine and the directory be copied.
+
+#ifndef TILED_PYRAMID_HPP
+#define TILED_PYRAMID_HPP
+
+#include <opencv2/core.hpp>
+#include <opencv2/imgcodecs.hpp>
+#include <opencv2/imgproc.hpp>
+#include <algorithm>
+#include <cmath>
+#include "lru_cache.hpp"
+#ifdef _WIN32
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#endif
+
+class TiledPyramid
+{
+public:
+    explicit TiledPyramid( size_t _cacheTiles = 256 ) : tileSize( 512 ), levels( 0 ), cache( _cacheTiles ) {}
+
+    bool load( const cv::String& _dir )
+    {
+        cv::FileStorage fs( _dir + "/index.yml", cv::FileStorage::READ );
+        if( !fs.isOpened() )
+            return false;
+        fs["width"] >> size.width;
+        fs["height"] >> size.height;
+        fs["tile"] >> tileSize;
+        fs["levels"] >> levels;
+        dir = _dir;
+        clearCache();
+        return levels > 0 && tileSize > 0;
+    }
+
+    bool build( const cv::String& image, const cv::String& _dir, int _tileSize = 512 )
+    {
+        cv::Mat src = cv::imread( image, cv::IMREAD_COLOR );
+        if( src.empty() )
+            return false;
+        dir = _dir;
+        tileSize = _tileSize;
+        size = src.size();
+        clearCache();
+        makeDir( dir );
+        for( levels = 0; ; levels++ )
+        {
+            makeDir( cv::format( "%s/%d", dir.c_str(), levels ) );
+            cv::Size ls = levelSize( levels ), grid = tiles( levels );
+            for( int ty = 0; ty < grid.height; ty++ )
+                for( int tx = 0; tx < grid.width; tx++ )
+                {
+                    cv::Rect r = cv::Rect( tx * tileSize, ty * tileSize, tileSize, tileSize ) & cv::Rect( cv::Point(), ls );
+                    cv::Mat t;
+                    if( levels == 0 )
+                        t = src( r );
+                    else
+                    {
+                        // the 2 x 2 tiles below, shrunk
+                        cv::Mat below;
+                        compose( levels - 1, cv::Rect( r.x * 2, r.y * 2, r.width * 2, r.height * 2 ) & cv::Rect( cv::Point(), levelSize( levels - 1 ) ), below );
+                        cv::resize( below, t, r.size(), 0, 0, cv::INTER_AREA );
+                    }
+                    cv::imwrite( path( levels, tx, ty ), t );
+                }
+            if( levels == 0 )
+                src.release();
+            if( grid.area() == 1 )
+                break;
+        }
+        levels++;
+        cv::FileStorage fs( dir + "/index.yml", cv::FileStorage::WRITE );
+        fs << "width" << size.width << "height" << size.height << "tile" << tileSize << "levels" << levels;
+        return true;
+    }
+
+    cv::Size imageSize() const { return size; }
+    int levelCount() const { return levels; }
+
+    // view: a rectangle of the full resolution image, drawn into out at outSize; the
+    // parts outside the image are black
+    void render( const cv::Rect2d& view, cv::Size outSize, cv::Mat& out )
+    {
+        CV_Assert( levels > 0 && view.width > 0 && view.height > 0 );
+        double scale = std::max( view.width / outSize.width, view.height / outSize.height );
+        int level = levelFor( scale );
+        double f = 1.0 / ( 1 << level );
+        cv::Rect r( cvFloor( view.x * f ), cvFloor( view.y * f ), cvCeil( view.width * f ), cvCeil( view.height * f ) );
+        cv::Mat part;
+        compose( level, r, part );
+        cv::resize( part, out, outSize, 0, 0, scale > 1 ? cv::INTER_AREA : cv::INTER_LINEAR );
+    }
+
+    // rect of the full resolution image, from the level 0 tiles
+    void crop( const cv::Rect& rect, cv::Mat& out ) { compose( 0, rect, out ); }
+
+    // rect of the full resolution image, shrunk to fit in maxSize when it is bigger:
+    // from the level that matches, so it costs about maxSize whatever the rect
+    void crop( const cv::Rect& rect, cv::Size maxSize, cv::Mat& out )
+    {
+        CV_Assert( levels > 0 && rect.width > 0 && rect.height > 0 );
+        double scale = std::max( 1.0, std::max( (double)rect.width / maxSize.width, (double)rect.height / maxSize.height ) );
+        int level = levelFor( scale );
+        double f = 1.0 / ( 1 << level );
+        cv::Rect r( cvFloor( rect.x * f ), cvFloor( rect.y * f ), std::max( 1, cvRound( rect.width * f ) ), std::max( 1, cvRound( rect.height * f ) ) );
+        cv::Mat part;
+        compose( level, r, part );
+        double s = std::min( (double)maxSize.width / part.cols, (double)maxSize.height / part.rows );
+        if( s < 1 )
+            cv::resize( part, out, cv::Size( std::max( 1, cvFloor( part.cols * s ) ), std::max( 1, cvFloor( part.rows * s ) ) ), 0, 0, cv::INTER_AREA );
+        else
+            out = part;
+    }
+
+private:
+    // an existing directory is fine, the tiles are written over
+    static void makeDir( const cv::String& path )
+    {
+#ifdef _WIN32
+        _mkdir( path.c_str() );
+#else
+        mkdir( path.c_str(), 0755 );
+#endif
+    }
+
+    // the level where one pixel is at most scale full resolution pixels
+    int levelFor( double scale ) const
+    {
+        return std::min( levels - 1, std::max( 0, cvFloor( std::log( scale ) / std::log( 2.0 ) ) ) );
+    }
+
+    cv::Size levelSize( int level ) const
+    {
+        return cv::Size( std::max( 1, ( size.width + ( 1 << level ) - 1 ) >> level ),
+                         std::max( 1, ( size.height + ( 1 << level ) - 1 ) >> level ) );
+    }
+
+    cv::Size tiles( int level ) const
+    {
+        cv::Size s = levelSize( level );
+        return cv::Size( ( s.width + tileSize - 1 ) / tileSize, ( s.height + tileSize - 1 ) / tileSize );
+    }
+
+    cv::String path( int level, int tx, int ty ) const
+    {
+        return cv::format( "%s/%d/%d_%d.png", dir.c_str(), level, ty, tx );
+    }
+
+    // rect of one level, pasted from its tiles
+    void compose( int level, const cv::Rect& rect, cv::Mat& out )
+    {
+        out.create( rect.size(), CV_8UC3 );
+        out = cv::Scalar::all( 0 );
+        cv::Rect inside = rect & cv::Rect( cv::Point(), levelSize( level ) );
+        if( inside.area() == 0 )
+            return;
+        for( int ty = inside.y / tileSize; ty <= ( inside.br().y - 1 ) / tileSize; ty++ )
+            for( int tx = inside.x / tileSize; tx <= ( inside.br().x - 1 ) / tileSize; tx++ )
+            {
+                const cv::Mat& t = tile( level, tx, ty );
+                cv::Rect tr( tx * tileSize, ty * tileSize, t.cols, t.rows );
+                cv::Rect common = tr & inside;
+                if( common.area() > 0 )
+                    t( common - tr.tl() ).copyTo( out( common - rect.tl() ) );
+            }
+    }
+
+    const cv::Mat& tile( int level, int tx, int ty )
+    {
+        Key key( level, ty * tiles( level ).width + tx );
+        if( cv::Mat* t = cache.find( key ) )
+            return *t;
+        cv::Mat& t = cache.put( key );
+        t = cv::imread( path( level, tx, ty ), cv::IMREAD_COLOR );
+        if( t.empty() )
+        {
+            // a missing tile is drawn black
+            cv::Size ls = levelSize( level );
+            t = cv::Mat( std::min( tileSize, ls.height - ty * tileSize ), std::min( tileSize, ls.width - tx * tileSize ), CV_8UC3, cv::Scalar::all( 0 ) );
+        }
+        return t;
+    }
+
+    void clearCache()
+    {
+        cache.clear();
+    }
+
+    typedef std::pair<int, int> Key;              // level, tile index
+
+    cv::String dir;
+    cv::Size size;
+    int tileSize, levels;
+    LruCache<Key, cv::Mat> cache;
+};
+
+#endif
@@ -1,62 +1,181 @@
 #include <opencv2/highgui.hpp>
 #include <opencv2/imgproc.hpp>
 #include <condition_variable>
-#include <windows.h>
+#include <thread>
+#include <mutex>
+#include <deque>
+#include <chrono>
+#include <iostream>
 
 using namespace cv;
 
+typedef std::chrono::steady_clock Clock;
+
+struct TimedFrame
+{
+    Mat image;
+    double pts; // presentation time in milliseconds from the start of the stream
+};
+
+// Bounded queue filled by the decoder thread. The decoder blocks when it is
+// "capacity" frames ahead of presentation, the player never blocks on it.
+class DecodeAheadQueue
+{
+public:
+    DecodeAheadQueue( size_t _capacity ) : capacity(_capacity), finished(false), stopped(false) {}
+
+    bool push( TimedFrame& frame )
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        not_full.wait(lock, [this] { return queue.size() < capacity || stopped; });
+        if( stopped )
+            return false;
+        queue.push_back(frame);
+        return true;
+    }
+
+    bool tryPop( TimedFrame& frame )
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if( queue.empty() )
+            return false;
+        frame = queue.front();
+        queue.pop_front();
+        not_full.notify_one();
+        return true;
+    }
+
+    bool peekPts( double& pts )
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if( queue.empty() )
+            return false;
+        pts = queue.front().pts;
+        return true;
+    }
+
+    size_t size()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return queue.size();
+    }
+
+    void finish() { std::lock_guard<std::mutex> lock(mutex); finished = true; }
+    bool isDrained() { std::lock_guard<std::mutex> lock(mutex); return finished && queue.empty(); }
+    void stop() { std::lock_guard<std::mutex> lock(mutex); stopped = true; not_full.notify_all(); }
+
+private:
+    size_t capacity;
+    bool finished;
+    bool stopped;
+    std::deque<TimedFrame> queue;
+    std::mutex mutex;
+    std::condition_variable not_full;
+};
+
+static void decodeFrames( VideoCapture* capture, DecodeAheadQueue* queue, double fps_of_video )
+{
+    double frame_duration = 1000.0 / fps_of_video;
+    double last_pts = -1;
+    for( int index = 0; ; index++ )
+    {
+        TimedFrame frame;
+        if( !capture->read(frame.image) )
+            break;
+
+        // trust the container timestamps when they are monotonic, otherwise derive
+        // the time from the frame index with full floating point precision
+        frame.pts = capture->get(CAP_PROP_POS_MSEC);
+        if( frame.pts <= last_pts )
+            frame.pts = index * frame_duration;
+        last_pts = frame.pts;
+
+        if( !queue->push(frame) )
+            break;
+    }
+    queue->finish();
+}
+
 int main( int argc, char** argv )
 {
     char* filename = argc >= 2 ? argv[1] : (char*)"D:\\opencv\\samples\\data\\768x576.avi";
+    int queue_size = argc >= 3 ? atoi(argv[2]) : 8;
 
     VideoCapture capture( filename ); // open video file
     if(!capture.isOpened())  // check if we succeeded
         return -1;
 
-    int fps_of_video = (int) capture.get( CAP_PROP_FPS );
-    int time_to_wait = 1000 / fps_of_video;
+    double fps_of_video = capture.get( CAP_PROP_FPS );
+    if( fps_of_video <= 0 )
+        fps_of_video = 25;
+    double frame_duration = 1000.0 / fps_of_video;
+
+    DecodeAheadQueue queue( std::max(queue_size, 1) );
+    std::thread decoder( decodeFrames, &capture, &queue, fps_of_video );
+
+    // wait until the decoder is a few frames ahead before starting the clock
+    while( queue.size() < (size_t)std::max(queue_size / 2, 1) && !queue.isDrained() )
+        std::this_thread::sleep_for( std::chrono::milliseconds(1) );
 
+    int presented = 0, dropped = 0, repeated = 0;
     int frameCounter = 0;
-    int tick = 0;
-    int fps = fps_of_video;
-    std::time_t timeBegin = std::time(0);
+    double fps = fps_of_video;
+    Clock::time_point start = Clock::now();
+    Clock::time_point second_start = start;
+    double start_pts = -1;
+    Mat shown;
 
     for(;;)
     {
-        double time_start = (double)getTickCount();
+        TimedFrame frame;
+        if( !queue.tryPop(frame) )
+        {
+            if( queue.isDrained() )
+                break;
+            // decoder fell behind: the previous frame stays on screen one more period
+            if( !shown.empty() )
+                repeated++;
+            if( waitKey( std::max(1, cvRound(frame_duration)) ) == 27 ) break;
+            continue;
+        }
+        if( start_pts < 0 )
+            start_pts = frame.pts;
 
-        Mat frame;
-        capture >> frame; // get a new frame
+        Clock::time_point due = start + std::chrono::microseconds( (long long)((frame.pts - start_pts) * 1000) );
+        Clock::time_point now = Clock::now();
 
-        if( frame.empty() )
+        // more than a frame late and the next one is already decoded: skip this one
+        double next_pts;
+        if( now > due + std::chrono::microseconds( (long long)(frame_duration * 1000) ) && queue.peekPts(next_pts) )
         {
-            break;
+            dropped++;
+            continue;
         }
+        if( due > now )
+            std::this_thread::sleep_until( due );
 
         frameCounter++;
-
-        std::time_t timeNow = std::time(0) - timeBegin;
-
-        if (timeNow - tick >= 1)
+        double elapsed = std::chrono::duration<double>( Clock::now() - second_start ).count();
+        if( elapsed >= 1.0 )
         {
-            tick++;
-            fps = frameCounter;
+            fps = frameCounter / elapsed;
             frameCounter = 0;
+            second_start = Clock::now();
         }
 
-        cv::putText(frame, cv::format("Original FPS of Video=%d", fps_of_video ), cv::Point(30, 50), cv::FONT_HERSHEY_SIMPLEX, 0.8, cv::Scalar(0,0,255));
-        cv::putText(frame, cv::format("Average FPS=%d", fps ), cv::Point(30, 80), cv::FONT_HERSHEY_SIMPLEX, 0.8, cv::Scalar(0,0,255));
+        cv::putText(frame.image, cv::format("Original FPS of Video=%.2f", fps_of_video ), cv::Point(30, 50), cv::FONT_HERSHEY_SIMPLEX, 0.8, cv::Scalar(0,0,255));
+        cv::putText(frame.image, cv::format("Average FPS=%.2f", fps ), cv::Point(30, 80), cv::FONT_HERSHEY_SIMPLEX, 0.8, cv::Scalar(0,0,255));
+        cv::putText(frame.image, cv::format("queued %d dropped %d repeated %d", (int)queue.size(), dropped, repeated ), cv::Point(30, 110), cv::FONT_HERSHEY_SIMPLEX, 0.8, cv::Scalar(0,0,255));
 
-        imshow( "Video Player", frame );
+        imshow( "Video Player", frame.image );
+        shown = frame.image;
+        presented++;
 
         if( waitKey( 1 ) == 27 ) break;
-
-        // wait for some time to correct FPS
-        while( time_to_wait > ((double)getTickCount() - time_start)/getTickFrequency() * 1000 )
-        {
-            //http://stackoverflow.com/questions/1157209/is-there-an-alternative-sleep-function-in-c-to-milliseconds
-            Sleep( 2 );
-        }
     }
+
+    queue.stop();
+    decoder.join();
+    std::cout << "presented " << presented << " dropped " << dropped << " repeated " << repeated << std::endl;
     return 0;
 }
@@ -1,4 +1,7 @@
     #include "opencv2/opencv.hpp"
+    #include "frame_pipeline.hpp"
+    #include "yuv_frame.hpp"
+    #include <iostream>
 
     using namespace cv;
 
@@ -8,18 +11,33 @@
         if(!cap.isOpened())  // check if we succeeded
             return -1;
 
+        // the camera's own YUV frames when the backend can deliver them: the gray image
+        // is their Y plane, no conversion to BGR and back
+        YuvFrame::enable(cap);
+        YuvFrame yuv;
+
+        // each step on its own thread: while one frame is blurred the next is captured
+        FramePipeline pipe;
+        pipe.source("capture", [&](Mat& gray) // get a new frame from camera
+        {
+            if (!yuv.read(cap))
+                return false;
+            yuv.gray().copyTo(gray); // the capture buffer is reused by the next read
+            return true;
+        });
+        pipe.stage("blur", [](const Mat& gray, Mat& blurred) { GaussianBlur(gray, blurred, Size(7,7), 1.5, 1.5); });
+        pipe.stage("canny", [](const Mat& blurred, Mat& edges) { Canny(blurred, edges, 0, 30, 3); });
+        pipe.start();
+
         Mat edges;
         namedWindow("edges",1);
-        for(;;)
+        while(pipe.next(edges))
         {
-            Mat frame;
-            cap >> frame; // get a new frame from camera
-            cvtColor(frame, edges, COLOR_BGR2GRAY);
-            GaussianBlur(edges, edges, Size(7,7), 1.5, 1.5);
-            Canny(edges, edges, 0, 30, 3);
             imshow("edges", edges);
-            if(waitKey(30) >= 0) break;
+            if(waitKey(1) >= 0) break;
         }
+        pipe.stop();
+        pipe.report(std::cout);
         // the camera will be deinitialized automatically in VideoCapture destructor
         return 0;
     }
@@ -0,0 +1,62 @@
+// Additions to the videoio API implemented in cap.cpp, for the callers of
+// VideoCapture and VideoWriter: include it after opencv2/videoio.hpp.
+
+#ifndef VIDEOIO_EXT_HPP
+#define VIDEOIO_EXT_HPP
+
+#include "opencv2/videoio.hpp"
+#include <vector>
+
+namespace cv
+{
+
+/**
+ * Multi-camera batch capture.
+ * All devices are grabbed back-to-back first so their capture instants stay as
+ * close as the drivers allow, then the (much slower) retrieve/decode step runs
+ * for every device in parallel.
+ */
+struct CV_EXPORTS VideoFrameSet
+{
+    std::vector<Mat> frames;        // one frame per device, empty if it failed
+    std::vector<int64> timestamps;  // host tick count right after each grab()
+    std::vector<double> positions;  // CAP_PROP_POS_MSEC reported by the backend
+    std::vector<uchar> valid;       // grab and retrieve both succeeded
+    double skewMsec;                // spread between the first and last grab of valid devices
+    bool synchronized;              // skewMsec <= maxSkewMsec and all devices delivered
+
+    VideoFrameSet() : skewMsec(0), synchronized(false) {}
+};
+
+/** Grabs every capture, then retrieves them all in parallel into set. Returns true
+ * when every device delivered a frame; set.synchronized also asks for the grabs to
+ * be at most maxSkewMsec apart. Passing the same set again reuses its frames.
+ */
+CV_EXPORTS bool grabRetrieveSynchronized(const std::vector<VideoCapture*>& captures, VideoFrameSet& set, double maxSkewMsec);
+
+/**
+ * Asynchronous writing.
+ * VideoWriter::set(VIDEOWRITER_PROP_ASYNC_QUEUE, n) with n > 0 puts the current backend
+ * behind a queue of n frames drained by an encoder thread, n == 0 goes back to
+ * synchronous writing after flushing the queue. write() only stores a new Mat header,
+ * so the caller must not write into a frame after handing it over (allocate a new Mat
+ * per frame instead of reusing one buffer).
+ */
+enum
+{
+    VIDEOWRITER_PROP_ASYNC_QUEUE = 0x1000,   // queue capacity, 0 = synchronous (default)
+    VIDEOWRITER_PROP_ASYNC_POLICY = 0x1001,  // one of the ASYNC_WRITE_* values below
+    VIDEOWRITER_PROP_QUEUE_DEPTH = 0x1002,   // read only, frames currently queued
+    VIDEOWRITER_PROP_DROPPED_FRAMES = 0x1003 // read only, frames discarded by the policy
+};
+
+enum
+{
+    ASYNC_WRITE_BLOCK = 0,       // write() waits for a free slot
+    ASYNC_WRITE_DROP_OLDEST = 1, // the oldest queued frame is discarded
+    ASYNC_WRITE_DROP_NEWEST = 2  // the frame being written is discarded
+};
+
+}
+
+#endif
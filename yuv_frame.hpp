@@ -0,0 +1,198 @@
+// Camera frames in their native YUV layout, for pipelines that mostly need gray.
+//
+//     VideoCapture cap( 0 );
+//     YuvFrame::enable( cap );               // cap.set( CAP_PROP_CONVERT_RGB, 0 )
+//     YuvFrame frame;
+//     while( frame.read( cap ) )
+//     {
+//         const Mat& gray = frame.gray();    // NV12: a view of the Y plane, no copy
+//         Mat uv = frame.chroma();           // U and V at chroma resolution, on demand
+//         Mat bgr;
+//         frame.bgr( bgr );                  // only where colour is needed
+//     }
+//
+// With CAP_PROP_CONVERT_RGB 0 the backends that support it (DirectShow for NV12 and YUY2
+// cameras, V4L, ...) return the camera buffer instead of converting it to BGR first.
+// read() works out the layout from the type and shape of the Mat and the FOURCC of the
+// stream: one plane of height * 3 / 2 rows is NV12 (I420, YV12 or NV21 when the FOURCC
+// says so), two channels are YUY2 (or UYVY), three channels are BGR. Gray from the
+// planar layouts is a header on the first rows, from the packed ones one channel
+// extraction, and from BGR the usual cvtColor, so the same code runs whether the
+// backend honoured the request or not. A layout it does not know (a compressed buffer,
+// say) turns the conversion back on and reads the frame again as BGR.
+//
+// The returned Mats share the capture buffer: they are valid until the next read(), and
+// are copied (copyTo) when they must outlive it, e.g. when handed to another thread.
+
+#ifndef YUV_FRAME_HPP
+#define YUV_FRAME_HPP
+
+#include <opencv2/core.hpp>
+#include <opencv2/imgproc.hpp>
+#include <opencv2/videoio.hpp>
+#include <utility>
+
+class YuvFrame
+{
+public:
+    enum Format { UNKNOWN = -1, BGR, GRAY, NV12, NV21, I420, YV12, YUY2, UYVY };
+
+    YuvFrame() : fmt( UNKNOWN ), grayReady( false ) {}
+
+    // asks the backend for native frames; false when it cannot deliver them
+    static bool enable( cv::VideoCapture& cap ) { return cap.set( cv::CAP_PROP_CONVERT_RGB, 0 ); }
+
+    bool read( cv::VideoCapture& cap )
+    {
+        grayReady = false;
+        if( !cap.read( raw ) )
+            return false;
+        fmt = classify( raw, (int)cap.get( cv::CAP_PROP_FRAME_HEIGHT ), (int)cap.get( cv::CAP_PROP_FOURCC ) );
+        if( fmt == UNKNOWN )
+        {
+            cap.set( cv::CAP_PROP_CONVERT_RGB, 1 );
+            if( !cap.read( raw ) )
+                return false;
+            fmt = classify( raw, raw.rows, 0 );
+        }
+        return fmt != UNKNOWN;
+    }
+
+    // a frame from elsewhere, e.g. a decoder, in a known layout
+    void set( const cv::Mat& data, Format format )
+    {
+        raw = data;
+        fmt = format;
+        grayReady = false;
+    }
+
+    Format format() const { return fmt; }
+    const cv::Mat& data() const { return raw; }
+    bool empty() const { return raw.empty(); }
+
+    cv::Size size() const
+    {
+        return planar() ? cv::Size( raw.cols, raw.rows * 2 / 3 ) : raw.size();
+    }
+
+    // CV_8UC1, computed once per frame
+    const cv::Mat& gray()
+    {
+        if( grayReady )
+            return grayMat;
+        switch( fmt )
+        {
+        case GRAY: grayMat = raw; break;
+        case NV12: case NV21: case I420: case YV12: grayMat = raw.rowRange( 0, size().height ); break;
+        case YUY2: cv::extractChannel( raw, grayMat, 0 ); break;
+        case UYVY: cv::extractChannel( raw, grayMat, 1 ); break;
+        case BGR: cv::cvtColor( raw, grayMat, cv::COLOR_BGR2GRAY ); break;
+        default: grayMat.release();
+        }
+        grayReady = true;
+        return grayMat;
+    }
+
+    // CV_8UC2 of U, V: half size for the 4:2:0 layouts (a view for NV12), half width for
+    // 4:2:2, full size for BGR; empty for gray
+    cv::Mat chroma() const
+    {
+        cv::Size s = size();
+        cv::Mat uv;
+        switch( fmt )
+        {
+        case NV12:
+            return raw.rowRange( s.height, raw.rows ).reshape( 2 );
+        case NV21:
+        {
+            cv::Mat vu = raw.rowRange( s.height, raw.rows ).reshape( 2 );
+            int order[] = { 0, 1, 1, 0 };
+            uv.create( vu.size(), CV_8UC2 );
+            cv::mixChannels( &vu, 1, &uv, 1, order, 2 );
+            return uv;
+        }
+        case I420: case YV12:
+        {
+            // the chroma planes follow the Y plane, each of ( width / 2 ) x ( height / 2 )
+            CV_Assert( raw.isContinuous() );
+            cv::Size cs( s.width / 2, s.height / 2 );
+            const uchar* first = raw.ptr( s.height );
+            cv::Mat planes[2] = { cv::Mat( cs, CV_8UC1, (void*)first ), cv::Mat( cs, CV_8UC1, (void*)( first + cs.area() ) ) };
+            if( fmt == YV12 )
+                std::swap( planes[0], planes[1] );
+            cv::merge( planes, 2, uv );
+            return uv;
+        }
+        case YUY2: case UYVY:
+        {
+            // Y0 U Y1 V (YUY2) or U Y0 V Y1 (UYVY) for every pair of pixels
+            cv::Mat pairs = raw.reshape( 4 );
+            int order[] = { fmt == YUY2 ? 1 : 0, 0, fmt == YUY2 ? 3 : 2, 1 };
+            uv.create( pairs.size(), CV_8UC2 );
+            cv::mixChannels( &pairs, 1, &uv, 1, order, 2 );
+            return uv;
+        }
+        case BGR:
+        {
+            cv::Mat yuv;
+            cv::cvtColor( raw, yuv, cv::COLOR_BGR2YUV );
+            int order[] = { 1, 0, 2, 1 };
+            uv.create( yuv.size(), CV_8UC2 );
+            cv::mixChannels( &yuv, 1, &uv, 1, order, 2 );
+            return uv;
+        }
+        default:
+            return uv;
+        }
+    }
+
+    // the frame in BGR; BGR frames are shared, not copied
+    void bgr( cv::Mat& dst ) const
+    {
+        switch( fmt )
+        {
+        case BGR: dst = raw; break;
+        case GRAY: cv::cvtColor( raw, dst, cv::COLOR_GRAY2BGR ); break;
+        case NV12: cv::cvtColor( raw, dst, cv::COLOR_YUV2BGR_NV12 ); break;
+        case NV21: cv::cvtColor( raw, dst, cv::COLOR_YUV2BGR_NV21 ); break;
+        case I420: cv::cvtColor( raw, dst, cv::COLOR_YUV2BGR_I420 ); break;
+        case YV12: cv::cvtColor( raw, dst, cv::COLOR_YUV2BGR_YV12 ); break;
+        case YUY2: cv::cvtColor( raw, dst, cv::COLOR_YUV2BGR_YUY2 ); break;
+        case UYVY: cv::cvtColor( raw, dst, cv::COLOR_YUV2BGR_UYVY ); break;
+        default: dst.release();
+        }
+    }
+
+    // the layout of a frame of height rows (0: unknown) for a stream FOURCC
+    static Format classify( const cv::Mat& m, int height, int fourcc )
+    {
+        if( m.empty() || m.depth() != CV_8U )
+            return UNKNOWN;
+        if( m.channels() == 3 )
+            return BGR;
+        if( m.channels() == 2 && m.cols % 2 == 0 )
+            return fourcc == cv::VideoWriter::fourcc( 'U', 'Y', 'V', 'Y' ) ? UYVY : YUY2;
+        if( m.channels() != 1 )
+            return UNKNOWN;
+        if( height > 0 && m.rows * 2 == height * 3 && m.cols % 2 == 0 && height % 2 == 0 )
+        {
+            if( fourcc == cv::VideoWriter::fourcc( 'I', '4', '2', '0' ) || fourcc == cv::VideoWriter::fourcc( 'I', 'Y', 'U', 'V' ) )
+                return I420;
+            if( fourcc == cv::VideoWriter::fourcc( 'Y', 'V', '1', '2' ) )
+                return YV12;
+            if( fourcc == cv::VideoWriter::fourcc( 'N', 'V', '2', '1' ) )
+                return NV21;
+            return NV12;
+        }
+        return height <= 0 || m.rows == height ? GRAY : UNKNOWN;
+    }
+
+private:
+    bool planar() const { return fmt == NV12 || fmt == NV21 || fmt == I420 || fmt == YV12; }
+
+    cv::Mat raw, grayMat;
+    Format fmt;
+    bool grayReady;
+};
+
+#endif